@@ -45,6 +45,8 @@
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Band.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BitMatrix.h>
+#include <blaze/math/BitVector.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
@@ -54,6 +56,7 @@
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
+#include <blaze/math/FirstTouch.h>
 #include <blaze/math/Functors.h>
 #include <blaze/math/IdentityMatrix.h>
 #include <blaze/math/Infinity.h>
@@ -65,11 +68,18 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/math/MappedVector.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/math/PackingFlag.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/PatternMatrix.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SmallMatrix.h>
+#include <blaze/math/SmallVector.h>
 #include <blaze/math/SMP.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
@@ -83,6 +93,7 @@
 #include <blaze/math/UniformMatrix.h>
 #include <blaze/math/UniformVector.h>
 #include <blaze/math/UniLowerMatrix.h>
+#include <blaze/math/Uninitialized.h>
 #include <blaze/math/UniUpperMatrix.h>
 #include <blaze/math/UpperMatrix.h>
 #include <blaze/math/Views.h>
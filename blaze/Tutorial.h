@@ -652,18 +652,20 @@
    #include <blaze/math/DynamicVector.h>
    \endcode
 
-// The type of the elements and the transpose flag of the vector can be specified via the two
-// template parameters:
+// The type of the elements, the transpose flag of the vector, and the allocator can be specified
+// via the three template parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename Alloc >
    class DynamicVector;
    \endcode
 
-//  - \c Type: specifies the type of the vector elements. DynamicVector can be used with any
-//             non-cv-qualified, non-reference, non-pointer element type.
-//  - \c TF  : specifies whether the vector is a row vector (\c blaze::rowVector) or a column
-//             vector (\c blaze::columnVector). The default value is \c blaze::columnVector.
+//  - \c Type : specifies the type of the vector elements. DynamicVector can be used with any
+//              non-cv-qualified, non-reference, non-pointer element type.
+//  - \c TF   : specifies whether the vector is a row vector (\c blaze::rowVector) or a column
+//              vector (\c blaze::columnVector). The default value is \c blaze::columnVector.
+//  - \c Alloc: specifies the type of the allocator for the vector elements. The default value
+//              is \c blaze::AlignedAllocator.
 //
 // The blaze::DynamicVector is the default choice for all kinds of dense vectors and the best
 // choice for medium to large vectors. Its size can be modified at runtime:
@@ -679,6 +681,25 @@
    blaze::DynamicVector<double,blaze::rowVector> c;
    \endcode
 
+// By means of the third template parameter it is possible to provide a custom, standard
+// conforming allocator (e.g. a pool or an arena allocator). The allocator is default constructed
+// by all constructors, is propagated on copy construction via its
+// \c select_on_container_copy_construction() function, and is moved and swapped along with the
+// vector elements. The allocator must provide memory that satisfies the alignment restrictions
+// of the element type, else a \c std::bad_alloc exception is thrown. All temporaries created
+// during the evaluation of expressions involving the vector use the same kind of allocator:
+
+   \code
+   template< typename Type >
+   class PoolAllocator;  // Custom allocator
+
+   using Vector = blaze::DynamicVector< double, blaze::columnVector, PoolAllocator<double> >;
+
+   Vector a( 1000UL ), b( 1000UL );
+
+   Vector c( a + b );  // Memory for c is acquired from a PoolAllocator<double>
+   \endcode
+
 // \n \section vector_types_hybrid_vector HybridVector
 // <hr>
 //
@@ -2882,18 +2903,21 @@
    #include <blaze/math/DynamicMatrix.h>
    \endcode
 
-// The type of the elements and the storage order of the matrix can be specified via the two
-// template parameters:
+// The type of the elements, the storage order of the matrix, and the allocator can be specified
+// via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename Alloc >
    class DynamicMatrix;
    \endcode
 
-//  - \c Type: specifies the type of the matrix elements. DynamicMatrix can be used with any
-//             non-cv-qualified, non-reference element type.
-//  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
-//             The default value is blaze::rowMajor.
+//  - \c Type : specifies the type of the matrix elements. DynamicMatrix can be used with any
+//              non-cv-qualified, non-reference element type.
+//  - \c SO   : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//              The default value is blaze::rowMajor.
+//  - \c Alloc: specifies the type of the allocator for the matrix elements (see also the
+//              \ref vector_types_dynamic_vector section). The default value is
+//              \c blaze::AlignedAllocator.
 //
 // The blaze::DynamicMatrix is the default choice for all kinds of dense matrices and the best
 // choice for medium to large matrices. The number of rows and columns can be modified at runtime:
@@ -3240,18 +3264,21 @@
    #include <blaze/math/CompressedMatrix.h>
    \endcode
 
-// The type of the elements and the storage order of the matrix can be specified via the two
-// template parameters:
+// The type of the elements, the storage order of the matrix, and the allocator can be specified
+// via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename Alloc >
    class CompressedMatrix;
    \endcode
 
-//  - \c Type: specifies the type of the matrix elements. CompressedMatrix can be used with
-//             any non-cv-qualified, non-reference, non-pointer element type.
-//  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
-//             The default value is blaze::rowMajor.
+//  - \c Type : specifies the type of the matrix elements. CompressedMatrix can be used with
+//              any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c SO   : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//              The default value is blaze::rowMajor.
+//  - \c Alloc: specifies the type of the allocator for the matrix elements. The allocator is
+//              rebound to the internal element and index types of the matrix. The default value
+//              is \c blaze::AlignedAllocator.
 //
 // The blaze::CompressedMatrix is the right choice for all kinds of sparse matrices:
 
@@ -4557,6 +4584,12 @@
 //  - ... the given submatrix affects the restricted parts of a triangular matrix;
 //  - ... the given submatrix would cause non-deterministic results in a symmetric/Hermitian matrix.
 //
+// Dense matrices are transposed by means of cache-oblivious kernels, which recursively split the
+// matrix into blocks that fit into the cache and transpose these blocks tile by tile within the
+// SIMD registers. The in-place transposition of a large square dense matrix is executed in
+// parallel (see the \c BLAZE_SMP_DMATTRANSPOSE_THRESHOLD setting). A non-square \c DynamicMatrix
+// without padding elements is transposed in-place without allocating a temporary matrix.
+//
 //
 // \n \subsection matrix_operations_ctranspose ctranspose()
 //
@@ -12596,11 +12629,75 @@
 // When any of the shared memory parallelization techniques is activated, all arithmetic
 // operations on dense vectors and matrices (including additions, subtractions, multiplications,
 // divisions, and all componentwise arithmetic operations) and most operations on sparse vectors
-// and matrices are automatically run in parallel. However, in addition, \b Blaze provides means
-// to enforce the serial execution of specific operations:
+// and matrices are automatically run in parallel. This also includes total reductions (as for
+// instance sum(), prod(), min(), and max()), norms, and inner products of large vectors and
+// matrices. The partial results of all threads are combined in a fixed order, and therefore the
+// result of a parallel reduction is deterministic for a given number of threads. However, in
+// addition, \b Blaze provides means to enforce the serial execution of specific operations:
 //
 //  - \ref serial_execution
 //
+// Additionally, the async_assign() function allows to start an assignment in the background and
+// to overlap it with other work, as for instance communication or I/O:
+
+   \code
+   blaze::DynamicMatrix<double> A( 5000UL, 5000UL );
+   blaze::DynamicVector<double> x( 5000UL ), y;
+   // ... Initialization of A and x
+
+   blaze::AsyncAssignment f = blaze::async_assign( y, A * x );
+   // ... Communication or I/O not involving A, x, or y
+   f.wait();
+   \endcode
+
+// Asynchronous assignments that access the same vector or matrix are executed in the order they
+// have been started, whereas independent asynchronous assignments are executed concurrently to
+// each other. Every other assignment or reduction (including serial operations) waits for the
+// completion of those pending asynchronous assignments that write to one of its operands or that
+// access its target, whereas independent operations are not blocked. The operands of the
+// assignment are not copied, but referenced. Thus all other accesses to the target or the operands
+// of the assignment (as for instance element access) require an explicit call to wait(). In case
+// \c BLAZE_USER_ASSERT() is active, an element access to the target of a pending assignment or a
+// modifying access (i.e. a non-const element access, a call to data() or a resize()) to one of its
+// operands by the thread that started the assignment results in an assertion. In case of the HPX
+// parallelization the assignments are chained as HPX continuations (see \ref hpx_dataflow). In
+// case no shared memory parallelization is active, the assignment is executed immediately.
+//
+// Several independent assignments can be evaluated concurrently by means of an AssignmentGroup.
+// Small assignments, which would not be parallelized on their own, are executed as whole tasks
+// in parallel to each other, whereas large assignments are partitioned among all threads:
+
+   \code
+   blaze::AssignmentGroup group;
+   group.add( y1, A * x1 );
+   group.add( y2, B * x2 );
+   group.add( z, u + v );
+   group.run();  // Single parallel section for all three assignments
+   \endcode
+
+// Whether an operation is executed in parallel depends on the size of the operation and the
+// according SMP threshold (see <tt>./blaze/config/Thresholds.h</tt>). Since the optimal
+// thresholds depend on the system architecture, they can be calibrated at runtime. The
+// calibrateSMPThresholds() function determines the crossover between the serial and the
+// parallel execution of all dense vector and dense matrix operations for the current number of
+// threads or, in case an SMP threshold file is given, for several numbers of threads. The SMP
+// thresholds of all sparse operations depend on the sparsity pattern of the operands and
+// therefore keep their compile time default values. The SMP threshold file can be loaded
+// explicitly or automatically by means of the \c BLAZE_SMP_THRESHOLDS environment variable. In
+// the latter case, the values for the current number of threads are selected whenever the number
+// of threads changes (for instance via the \c setNumThreads() function):
+
+   \code
+   // Calibration, once per host type, for 2, 4, 8, ... threads up to the current number of threads
+   blaze::calibrateSMPThresholds( "blaze_smp_thresholds.txt" );
+
+   // Calibration for a given list of numbers of threads
+   blaze::calibrateSMPThresholds( "blaze_smp_thresholds.txt", { 4UL, 6UL, 12UL } );
+
+   // Any later run of the application
+   blaze::loadSMPThresholds( "blaze_smp_thresholds.txt" );
+   \endcode
+
 // \n Previous: \ref logical_or &nbsp; &nbsp; Next: \ref hpx_parallelization
 */
 //*************************************************************************************************
@@ -12675,6 +12772,39 @@
 // have been determined using the OpenMP parallelization and require individual adaption for
 // the HPX-based parallelization.
 //
+//
+// \n \section hpx_dataflow HPX Dataflow
+// <hr>
+//
+// In combination with the HPX-based parallelization, asynchronous assignments (see the
+// async_assign() function) are not executed by separate threads, but are attached as HPX
+// continuations to the previously started asynchronous assignments they depend on (i.e. the
+// assignments that write to one of their operands or that access their target). Thus successive
+// assignments form a dataflow graph, which is executed by the HPX runtime without blocking the calling thread
+// and without any global barrier. The HPX future of an assignment is available via the future()
+// function of the AsyncAssignment handle, and an additional HPX future can be passed as third
+// argument to the async_assign() function. This allows to embed \b Blaze assignments into the
+// task graph of an HPX application and to overlap them with other tasks of the application:
+
+   \code
+   blaze::DynamicMatrix<double> A( 5000UL, 5000UL );
+   blaze::DynamicVector<double> x( 5000UL ), y( 5000UL ), z( 5000UL );
+   // ... Initialization of A
+
+   hpx::shared_future<void> input = hpx::async( [&x]() { receive( x ); } );
+
+   blaze::AsyncAssignment f1 = blaze::async_assign( y, A * x, input );  // Executed after input
+   blaze::AsyncAssignment f2 = blaze::async_assign( z, A * y );         // Executed after f1
+
+   hpx::future<void> output = f2.future().then( [&z]( auto&& ) { send( z ); } );
+
+   // ... Other HPX tasks not involving A, x, y, or z
+   \endcode
+
+// Note that every assignment or reduction that is started directly (i.e. not via the async_assign()
+// function) waits for the completion of all pending asynchronous assignments it conflicts with.
+// Therefore the future passed to async_assign() must not depend on such an operation.
+//
 // \n Previous: \ref shared_memory_parallelization &nbsp; &nbsp; Next: \ref cpp_threads_parallelization
 */
 //*************************************************************************************************
@@ -12735,6 +12865,23 @@
 // In the context of C++11 threads, the function will return the previously specified number of
 // threads.
 //
+// Additionally, the threads can be pinned to logical CPUs via the environment variable
+// \c BLAZE_AFFINITY. It accepts either an affinity policy or an explicit list of logical CPUs:
+
+   \code
+   export BLAZE_AFFINITY=compact  // Pins the threads to consecutive logical CPUs
+   export BLAZE_AFFINITY=cores    // Pins the threads to separate physical cores first
+   export BLAZE_AFFINITY=scatter  // Distributes the threads among all last-level caches
+   export BLAZE_AFFINITY=0-3,8    // Pins the threads to the logical CPUs 0, 1, 2, 3, and 8
+   \endcode
+
+// The topology of the system is determined via \c /sys/devices/system/cpu. In case the threads
+// are pinned, neighboring blocks of a matrix are assigned to threads sharing the last-level
+// cache. Note that the same setting also applies to the Boost thread parallelization. For the
+// OpenMP parallelization please use the \c OMP_PLACES and \c OMP_PROC_BIND environment variables
+// instead. In case the given affinity is invalid or the operating system does not support thread
+// pinning, the threads remain unpinned.
+//
 //
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
@@ -13117,9 +13264,10 @@
 /*!\page serial_execution Serial Execution
 //
 // Sometimes it may be necessary to enforce the serial execution of specific operations. For this
-// purpose, the \b Blaze library offers three possible options: the serialization of a single
+// purpose, the \b Blaze library offers four possible options: the serialization of a single
 // expression via the \c serial() function, the serialization of a block of expressions via the
-// \c BLAZE_SERIAL_SECTION, and the general deactivation of the parallel execution.
+// \c BLAZE_SERIAL_SECTION, the restriction of the parallel execution via an execution policy,
+// and the general deactivation of the parallel execution.
 //
 //
 // \n \section serial_execution_serial_expression Option 1: Serialization of a Single Expression
@@ -13173,14 +13321,58 @@
 // Outside the scope of the serial section, all operations are run in parallel (if beneficial for
 // the performance).
 //
-// Note that the \c BLAZE_SERIAL_SECTION must only be used within a single thread of execution.
-// The use of the serial section within several concurrent threads will result undefined behavior!
+// Note that a \c BLAZE_SERIAL_SECTION only affects the thread that executes it. In case of the
+// HPX parallelization, however, the serial section must only be used within a single thread of
+// execution. The use of the serial section within several concurrent HPX threads will result in
+// undefined behavior!
 //
 //
-// \n \section serial_execution_deactivate_parallelism Option 3: Deactivation of Parallel Execution
+// \n \section serial_execution_execution_policy Option 3: Thread-Local Execution Policies
 // <hr>
 //
-// The third option is the general deactivation of the parallel execution (even in case OpenMP is
+// The third option is the restriction of the parallel execution of all operations of a thread by
+// means of an ExecutionPolicy. An execution policy specifies the maximum number of threads per
+// operation, whether operations started from within a parallel region (as for instance within
+// an OpenMP parallel region) may be executed in parallel, and optionally an executor to run the
+// parallel tasks on. It is activated for the calling thread by an ExecutionScope and restored
+// at the end of the scope:
+
+   \code
+   // Restriction of all operations of this thread to two threads
+   {
+      blaze::ExecutionScope scope( blaze::ExecutionPolicy().threads( 2UL ) );
+      y = A * c;
+   }
+   \endcode
+
+// Applications with their own task system can run the parallel operations of \b Blaze on their
+// own workers instead of the thread pool of \b Blaze to avoid an oversubscription of the cores.
+// For that purpose the executor receives the number of tasks and a task function, which it has
+// to call once for each task index before returning. In case of the C++11 and Boost thread-based
+// parallelization, all tasks of an operation are handed over to the executor:
+
+   \code
+   blaze::ExecutionPolicy policy;
+   policy.threads( 8UL )
+         .nested( true )
+         .executor( [&pool]( size_t n, const std::function<void(size_t)>& task ) {
+            pool.parallel_for( 0UL, n, task );  // Runs all tasks and waits for their completion
+         } );
+
+   // Within a task of the application
+   blaze::ExecutionScope scope( policy );
+   y = A * c;  // Executed by eight tasks of the application's pool
+   \endcode
+
+// Operations within a parallel region are executed serially unless the policy allows a nested
+// parallel execution. Note that the thread pool of \b Blaze itself never executes operations in
+// parallel that are started from within one of its own tasks.
+//
+//
+// \n \section serial_execution_deactivate_parallelism Option 4: Deactivation of Parallel Execution
+// <hr>
+//
+// The fourth option is the general deactivation of the parallel execution (even in case OpenMP is
 // enabled on the command line). This can be achieved via the \c BLAZE_USE_SHARED_MEMORY_PARALLELIZATION
 // switch in the <tt>./blaze/config/SMP.h</tt> configuration file:
 
@@ -13647,6 +13839,81 @@
 // streaming is beneficial or hurtful for performance.
 //
 //
+// \n \section numa NUMA Placement
+// <hr>
+//
+// On systems with several NUMA nodes (as for instance multi-socket systems) the memory pages of a
+// vector or matrix are usually placed on the NUMA node of the thread that first writes to them.
+// In case a large vector or matrix is initialized by a single thread, all its pages are placed
+// on a single NUMA node and all threads on the other NUMA nodes are restricted to the bandwidth
+// of the remote memory. The configuration file <tt>./blaze/config/Optimizations.h</tt> provides
+// two compile time switches to control the placement of dense vectors and matrices:
+
+   \code
+   #define BLAZE_USE_NUMA_FIRST_TOUCH 1
+   #define BLAZE_USE_NUMA_INTERLEAVE 0
+   \endcode
+
+// If \c BLAZE_USE_NUMA_FIRST_TOUCH is set to 1, the homogeneous initialization of large
+// \c DynamicVector and \c DynamicMatrix instances is performed in parallel, based on the same
+// partitioning as all shared-memory parallel operations. If \c BLAZE_USE_NUMA_INTERLEAVE is set
+// to 1, the pages of all large allocations are distributed round-robin across all NUMA nodes.
+// Additionally, the placement of individual dense vectors and matrices can be selected via the
+// \c blaze::firstTouch token and the \c interleave() and \c bindToNode() functions:
+
+   \code
+   blaze::DynamicVector<double> a( 100000000UL, 0.0 );
+   blaze::DynamicVector<double> b( 100000000UL, 0.0, blaze::firstTouch );
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL, 0.0 );
+
+   interleave( a );       // Distributes the elements of a across all NUMA nodes
+   bindToNode( A, 1UL );  // Moves the elements of A to the NUMA node 1
+   \endcode
+
+// The \c blaze::firstTouch token selects the parallel first-touch initialization for an
+// individual vector or matrix, independent of the \c BLAZE_USE_NUMA_FIRST_TOUCH switch.
+
+// Note that NUMA placement is only supported on Linux systems. On all other systems the switches
+// and functions have no effect.
+//
+//
+// \n \section huge_pages Huge Pages
+// <hr>
+//
+// Large vectors and matrices span a large number of 4 KiB memory pages, which results in a high
+// number of TLB misses, especially for strided or transposed access patterns. The configuration
+// file <tt>./blaze/config/Optimizations.h</tt> provides two compile time switches to back all
+// large allocations with huge pages:
+
+   \code
+   #define BLAZE_USE_HUGE_PAGES 0
+   #define BLAZE_HUGE_PAGE_THRESHOLD 4194304UL
+   \endcode
+
+// If \c BLAZE_USE_HUGE_PAGES is set to 1, all allocations of at least \c BLAZE_HUGE_PAGE_THRESHOLD
+// bytes are aligned to 2 MiB and marked as eligible for transparent huge pages. If it is set to 2,
+// these allocations are mapped from the hugetlbfs pool, falling back to transparent huge pages
+// in case the pool is exhausted. Alternatively, individual vectors and matrices can request huge
+// pages via the \c HugePageAllocator class template:
+
+   \code
+   using Allocator = blaze::HugePageAllocator<double,blaze::hugetlbPages>;
+
+   blaze::DynamicMatrix<double,blaze::rowMajor,Allocator> A( 20000UL, 20000UL );
+
+   blaze::getHugetlbBytes();              // Number of bytes mapped from the hugetlbfs pool
+   blaze::getAdvisedHugePageBytes();      // Number of bytes marked for transparent huge pages
+   blaze::getTransparentHugePageBytes();  // Number of bytes backed by transparent huge pages
+   blaze::getHugePageFallbacks();         // Number of allocations without huge page support
+   \endcode
+
+// Note that the operating system is free to back advised memory with ordinary pages. Therefore
+// the \c getTransparentHugePageBytes() function reports the number of bytes of the process that
+// are actually backed by transparent huge pages. Also note that huge pages are only supported on
+// Linux systems. On all other systems the switches have no effect and the \c HugePageAllocator
+// behaves as the \c AlignedAllocator.
+//
+//
 // \n Previous: \ref customization &nbsp; &nbsp; Next: \ref vector_and_matrix_customization \n
 */
 //*************************************************************************************************
@@ -16404,6 +16671,32 @@
    y = eval( A * B ) * x;
    \endcode
 
+// Note that several expressions require the evaluation of temporaries. For instance, in the
+// statement \c y = eval( A * B ) * x the result of the matrix/matrix multiplication is stored in
+// an intermediate matrix. By default, all these temporaries are dynamically allocated during the
+// assignment. In case the same statements are evaluated repeatedly (as for instance in a control
+// loop), the \c TemporaryScope class can be used to place all internal temporaries in a bump
+// arena that is owned by the current thread and that is reused by all subsequent scopes:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x, y;
+
+   // ... Resizing and initialization
+
+   while( ... )
+   {
+      blaze::TemporaryScope scope( 1048576UL );  // Reserving an arena of 1 MiB
+
+      y = eval( A * B ) * x;  // Evaluation without any dynamic memory allocation
+   }
+   \endcode
+
+// The \c highWater() and \c misses() member functions of the scope report the maximum number
+// of bytes required for the temporaries and the number of temporaries that did not fit into the
+// arena, respectively. Vectors and matrices that are created by the user (including the result
+// of the \c evaluate() function) are never placed in the arena.
+//
 // \n Previous: \ref block_vectors_and_matrices &nbsp; &nbsp; Next: \ref faq \n
 */
 //*************************************************************************************************
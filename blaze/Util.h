@@ -46,9 +46,11 @@
 #include <blaze/util/Algorithms.h>
 #include <blaze/util/AsConst.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/Bits.h>
 #include <blaze/util/CheckedDelete.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/ConcurrentMemoryPool.h>
 #include <blaze/util/Constraints.h>
 #include <blaze/util/DimensionOf.h>
 #include <blaze/util/DisableIf.h>
@@ -56,12 +58,16 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/HugePageAllocator.h>
+#include <blaze/util/HugePages.h>
 #include <blaze/util/Indices.h>
 #include <blaze/util/InitializerList.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Limits.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryMapping.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
@@ -76,6 +82,8 @@
 #include <blaze/util/SmallArray.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Suffix.h>
+#include <blaze/util/TemporaryAllocator.h>
+#include <blaze/util/TemporaryScope.h>
 #include <blaze/util/Thread.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Time.h>
@@ -85,3 +85,32 @@
 #define BLAZE_USE_FUNCTION_TRACES 0
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the instrumentation of allocations and assignments.
+// \ingroup config
+//
+// This compilation switch triggers the instrumentation of the Blaze library. In case the switch
+// is set to 1, all allocations and deallocations of vector and matrix elements as well as all
+// constructions of vectors and matrices from expressions are counted (see the globalCounters()
+// and threadCounters() functions) and an optional callback is called after each assignment of
+// an expression to a vector or matrix (see the setAssignmentCallback() function). In case the
+// switch is set to 0, the instrumentation is completely removed from the code.
+//
+// Possible settings for the instrumentation switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the instrumentation via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_INSTRUMENTATION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_INSTRUMENTATION
+#define BLAZE_USE_INSTRUMENTATION 0
+#endif
+//*************************************************************************************************
@@ -149,3 +149,129 @@
 #define BLAZE_USE_DEFAULT_INITIALIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the parallel first-touch initialization.
+// \ingroup config
+//
+// This configuration switch enables/disables the parallel first-touch initialization of the
+// \a DynamicVector and \a DynamicMatrix class templates. On NUMA systems the memory pages of a
+// vector or matrix are placed on the NUMA node of the thread that first writes to them. In case
+// the switch is set to 1, the homogeneous initialization of large vectors and matrices (as for
+// instance via the constructor taking an initial value) is performed in parallel, based on the
+// same partitioning as all shared-memory parallel assignments. Therefore every thread works on
+// memory that is local to its NUMA node. In case the switch is set to 0 the initialization is
+// performed by the constructing thread only and all memory pages are placed on a single NUMA
+// node. Please note that the parallel initialization is only performed in case a shared-memory
+// parallelization is active and the construction does not happen within a parallel section.
+// Independent of this switch, individual vectors and matrices can select the parallel
+// initialization via the \a blaze::firstTouch token.
+//
+// Possible settings for the parallel first-touch initialization:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the parallel first-touch initialization via command line
+// or by defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_NUMA_FIRST_TOUCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_NUMA_FIRST_TOUCH
+#define BLAZE_USE_NUMA_FIRST_TOUCH 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the interleaved NUMA placement of dynamic memory.
+// \ingroup config
+//
+// This configuration switch enables/disables the interleaved placement of all dynamic memory
+// allocated by the Blaze library. In case the switch is set to 1, the memory pages of all large
+// allocations are distributed round-robin across all NUMA nodes. This provides a uniform memory
+// bandwidth for all threads, independent of the thread that initializes the memory. In case
+// the switch is set to 0 the placement is left to the operating system (i.e. usually first
+// touch). Please note that the interleaved placement is only supported on Linux systems. On
+// all other systems the switch has no effect. Individual vectors and matrices can be placed
+// via the interleave() and bindToNode() functions.
+//
+// Possible settings for the interleaved NUMA placement:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the interleaved NUMA placement via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_NUMA_INTERLEAVE 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_NUMA_INTERLEAVE
+#define BLAZE_USE_NUMA_INTERLEAVE 0
+#endif
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Configuration of the huge page backing of large dynamic allocations.
+// \ingroup config
+//
+// This configuration switch selects the use of huge pages for all large dynamic allocations of
+// the Blaze library (see the BLAZE_HUGE_PAGE_THRESHOLD setting). Huge pages considerably reduce
+// the number of TLB misses for large vectors and matrices, especially for strided or transposed
+// access patterns. In case the switch is set to 1, large allocations are aligned to 2 MiB and
+// marked as eligible for transparent huge pages via \c madvise(MADV_HUGEPAGE). In case the switch
+// is set to 2, large allocations are mapped from the hugetlbfs pool (first attempting 1 GiB and
+// then 2 MiB pages). In case no huge pages are available in the pool, the allocation falls back
+// to transparent huge pages. In case the switch is set to 0, no huge pages are requested and the
+// use of huge pages is left to the system. Please note that huge pages are only supported on
+// Linux systems. On all other systems the switch has no effect. Individual vectors and matrices
+// can request huge pages via the HugePageAllocator class template.
+//
+// Possible settings for the huge page backing:
+//  - Disabled                : \b 0
+//  - Transparent huge pages  : \b 1
+//  - hugetlbfs (1 GiB/2 MiB) : \b 2
+//
+// \note It is possible to specify the huge page backing via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_HUGE_PAGES 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_HUGE_PAGES
+#define BLAZE_USE_HUGE_PAGES 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size threshold for the huge page backing of dynamic allocations.
+// \ingroup config
+//
+// This setting specifies the minimum size in bytes of a dynamic allocation to be backed by huge
+// pages (see the BLAZE_USE_HUGE_PAGES switch and the HugePageAllocator class template). Smaller
+// allocations are never backed by huge pages in order to not waste memory.
+//
+// The default setting for this threshold is 4 MiB. In case the threshold is set to a value
+// smaller than 2 MiB, it is automatically adjusted to 2 MiB.
+//
+// \note It is possible to specify the threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_HUGE_PAGE_THRESHOLD 4194304UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_HUGE_PAGE_THRESHOLD
+#define BLAZE_HUGE_PAGE_THRESHOLD 4194304UL
+#endif
+//*************************************************************************************************
+
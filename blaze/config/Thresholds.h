@@ -1424,6 +1424,108 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix addition threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/sparse matrix addition can be executed in
+// parallel. This threshold affects all additions between two sparse matrices with a dense
+// target matrix. In case the total number of non-zero elements of both operands is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 36100 non-zero elements. In case the threshold is
+// set to 0, the operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATSMATADD_THRESHOLD 36100UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATSMATADD_THRESHOLD
+#define BLAZE_SMP_SMATSMATADD_THRESHOLD 36100UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix subtraction threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/sparse matrix subtraction can be executed in
+// parallel. This threshold affects all subtractions between two sparse matrices with a dense
+// target matrix. In case the total number of non-zero elements of both operands is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 36100 non-zero elements. In case the threshold is
+// set to 0, the operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATSMATSUB_THRESHOLD 36100UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATSMATSUB_THRESHOLD
+#define BLAZE_SMP_SMATSMATSUB_THRESHOLD 36100UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix Schur product threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/sparse matrix Schur product can be executed in
+// parallel. This threshold affects all Schur products between two sparse matrices with a dense
+// target matrix. In case the total number of non-zero elements of both operands is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 36100 non-zero elements. In case the threshold is
+// set to 0, the operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATSMATSCHUR_THRESHOLD 36100UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATSMATSCHUR_THRESHOLD
+#define BLAZE_SMP_SMATSMATSCHUR_THRESHOLD 36100UL
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/row-major dense matrix multiplication threshold.
 // \ingroup config
@@ -2032,3 +2134,333 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix permutation threshold.
+// \ingroup config
+//
+// This threshold specifies when the symmetric permutation of a sparse matrix (see the permute()
+// function) can be executed in parallel. In case the number of non-zero elements of the sparse
+// matrix is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of non-zero elements is below this threshold the operation is executed single-threaded.
+// This threshold is considered by all shared memory parallelizations (HPX, C++11 threads, Boost
+// threads, and OpenMP).
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATPERMUTE_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATPERMUTE_THRESHOLD
+#define BLAZE_SMP_SMATPERMUTE_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP pattern-preserving sparse matrix assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when the pattern-preserving assignment of the values of a sparse
+// matrix (see the assignValues() function of the CompressedMatrix class template) can be
+// executed in parallel. In case the number of non-zero elements of the target matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded. This threshold is
+// considered by all shared memory parallelizations (HPX, C++11 threads, Boost threads, and
+// OpenMP).
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATASSIGN_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATASSIGN_THRESHOLD
+#define BLAZE_SMP_SMATASSIGN_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the reduction of a dense vector (as for instance via the
+// reduce(), sum(), prod(), min(), or max() functions) can be executed in parallel. In case the
+// number of elements of the dense vector is larger or equal to this threshold, the operation is
+// executed in parallel. If the number of elements is below this threshold the operation is
+// executed single-threaded. The partial results of all threads are combined in a fixed order and
+// therefore the result is deterministic for a given number of threads.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECREDUCE_THRESHOLD
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector norm threshold.
+// \ingroup config
+//
+// This threshold specifies when the norm of a dense vector (as for instance via the norm(),
+// l1Norm(), or lpNorm() functions) can be executed in parallel. In case the number of elements of
+// the dense vector is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+// The partial results of all threads are combined in a fixed order and therefore the result is
+// deterministic for a given number of threads.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECNORM_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECNORM_THRESHOLD
+#define BLAZE_SMP_DVECNORM_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This threshold specifies when the inner product of two dense vectors (as for instance via the
+// dot() function) can be executed in parallel. In case the number of elements of the dense
+// vectors is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of elements is below this threshold the operation is executed single-threaded. The
+// partial results of all threads are combined in a fixed order and therefore the result is
+// deterministic for a given number of threads.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECDVECINNER_THRESHOLD
+#define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a dense matrix (as for instance via the
+// reduce(), sum(), prod(), min(), or max() functions) can be executed in parallel. In case the
+// number of elements of the dense matrix is larger or equal to this threshold, the operation is
+// executed in parallel. If the number of elements is below this threshold the operation is
+// executed single-threaded. The partial results of all threads are combined in a fixed order and
+// therefore the result is deterministic for a given number of threads.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD
+#define BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix norm threshold.
+// \ingroup config
+//
+// This threshold specifies when the norm of a dense matrix (as for instance via the norm(),
+// l1Norm(), or lpNorm() functions) can be executed in parallel. In case the number of elements of
+// the dense matrix is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+// The partial results of all threads are combined in a fixed order and therefore the result is
+// deterministic for a given number of threads.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATNORM_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATNORM_THRESHOLD
+#define BLAZE_SMP_DMATNORM_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the reduction or the norm of a sparse vector can be executed in
+// parallel. In case the number of non-zero elements of the sparse vector is larger or equal to
+// this threshold, the operation is executed in parallel. If the number of non-zero elements is
+// below this threshold the operation is executed single-threaded. The partial results of all
+// threads are combined in a fixed order and therefore the result is deterministic for a given
+// number of threads.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SVECREDUCE_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SVECREDUCE_THRESHOLD
+#define BLAZE_SMP_SVECREDUCE_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix total reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction or the norm of a sparse matrix can be
+// executed in parallel. In case the number of non-zero elements of the sparse matrix is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded. The partial results
+// of all threads are combined in a fixed order and therefore the result is deterministic for a
+// given number of threads.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATTOTALREDUCE_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATTOTALREDUCE_THRESHOLD
+#define BLAZE_SMP_SMATTOTALREDUCE_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix in-place transposition threshold.
+// \ingroup config
+//
+// This threshold specifies when the in-place transposition of a square dense matrix (as for
+// instance by means of the transpose() or ctranspose() member functions) can be executed in
+// parallel. In case the number of elements of the dense matrix is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATTRANSPOSE_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATTRANSPOSE_THRESHOLD
+#define BLAZE_SMP_DMATTRANSPOSE_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
@@ -0,0 +1,140 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/BitMatrix.h
+//  \brief Header file for the complete BitMatrix implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_BITMATRIX_H_
+#define _BLAZE_MATH_BITMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/BitVector.h>
+#include <blaze/math/dense/BitMatrix.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for BitMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of BitMatrix.
+*/
+template< bool SO >  // Storage order
+class Rand< BitMatrix<SO> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const BitMatrix<SO> generate( size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( BitMatrix<SO>& matrix ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random BitMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return The generated random matrix.
+*/
+template< bool SO >  // Storage order
+inline const BitMatrix<SO> Rand< BitMatrix<SO> >::generate( size_t m, size_t n ) const
+{
+   BitMatrix<SO> matrix( m, n );
+   randomize( matrix );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a BitMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+//
+// Each bit of the matrix is set with a probability of 50%.
+*/
+template< bool SO >  // Storage order
+inline void Rand< BitMatrix<SO> >::randomize( BitMatrix<SO>& matrix ) const
+{
+   const size_t major( SO ? matrix.columns() : matrix.rows() );
+   const size_t minor( SO ? matrix.rows() : matrix.columns() );
+   const size_t n( bitWords( minor ) );
+
+   if( n == 0UL ) return;
+
+   for( size_t i=0UL; i<major; ++i )
+   {
+      uint64_t* words( matrix.words( i ) );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         words[k] = rand<uint64_t>();
+      }
+
+      words[n-1UL] &= tailMask( minor );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
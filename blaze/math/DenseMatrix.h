@@ -51,6 +51,7 @@
 #include <blaze/math/dense/LLH.h>
 #include <blaze/math/dense/LQ.h>
 #include <blaze/math/dense/LU.h>
+#include <blaze/math/dense/NUMA.h>
 #include <blaze/math/dense/QL.h>
 #include <blaze/math/dense/QR.h>
 #include <blaze/math/dense/RQ.h>
@@ -118,6 +119,7 @@
 #include <blaze/math/expressions/TSVecTDMatMultExpr.h>
 #include <blaze/math/Matrix.h>
 #include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/Reduce.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
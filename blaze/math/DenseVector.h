@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/dense/NUMA.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/DVecDVecAddExpr.h>
 #include <blaze/math/expressions/DVecDVecCrossExpr.h>
@@ -72,6 +73,7 @@
 #include <blaze/math/expressions/SVecDVecSubExpr.h>
 #include <blaze/math/expressions/SVecSVecCrossExpr.h>
 #include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/Reduce.h>
 #include <blaze/math/smp/SparseVector.h>
 #include <blaze/math/Vector.h>
 #include <blaze/math/views/Subvector.h>
@@ -69,28 +69,29 @@ namespace blaze {
 //
 // This specialization of the Rand class creates random instances of DynamicMatrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-class Rand< DynamicMatrix<Type,SO> >
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+class Rand< DynamicMatrix<Type,SO,Alloc> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const DynamicMatrix<Type,SO> generate( size_t m, size_t n ) const;
+   inline const DynamicMatrix<Type,SO,Alloc> generate( size_t m, size_t n ) const;
 
    template< typename Arg >
-   inline const DynamicMatrix<Type,SO> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+   inline const DynamicMatrix<Type,SO,Alloc> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( DynamicMatrix<Type,SO>& matrix ) const;
+   inline void randomize( DynamicMatrix<Type,SO,Alloc>& matrix ) const;
 
    template< typename Arg >
-   inline void randomize( DynamicMatrix<Type,SO>& matrix, const Arg& min, const Arg& max ) const;
+   inline void randomize( DynamicMatrix<Type,SO,Alloc>& matrix, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 };
@@ -106,12 +107,13 @@ class Rand< DynamicMatrix<Type,SO> >
 // \param n The number of columns of the random matrix.
 // \return The generated random matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline const DynamicMatrix<Type,SO>
-   Rand< DynamicMatrix<Type,SO> >::generate( size_t m, size_t n ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline const DynamicMatrix<Type,SO,Alloc>
+   Rand< DynamicMatrix<Type,SO,Alloc> >::generate( size_t m, size_t n ) const
 {
-   DynamicMatrix<Type,SO> matrix( m, n );
+   DynamicMatrix<Type,SO,Alloc> matrix( m, n );
    randomize( matrix );
    return matrix;
 }
@@ -129,13 +131,14 @@ inline const DynamicMatrix<Type,SO>
 // \param max The largest possible value for a matrix element.
 // \return The generated random matrix.
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Arg >  // Min/max argument type
-inline const DynamicMatrix<Type,SO>
-   Rand< DynamicMatrix<Type,SO> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Arg >    // Min/max argument type
+inline const DynamicMatrix<Type,SO,Alloc>
+   Rand< DynamicMatrix<Type,SO,Alloc> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
 {
-   DynamicMatrix<Type,SO> matrix( m, n );
+   DynamicMatrix<Type,SO,Alloc> matrix( m, n );
    randomize( matrix, min, max );
    return matrix;
 }
@@ -150,9 +153,10 @@ inline const DynamicMatrix<Type,SO>
 // \param matrix The matrix to be randomized.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< DynamicMatrix<Type,SO> >::randomize( DynamicMatrix<Type,SO>& matrix ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void Rand< DynamicMatrix<Type,SO,Alloc> >::randomize( DynamicMatrix<Type,SO,Alloc>& matrix ) const
 {
    using blaze::randomize;
 
@@ -178,11 +182,12 @@ inline void Rand< DynamicMatrix<Type,SO> >::randomize( DynamicMatrix<Type,SO>& m
 // \param max The largest possible value for a matrix element.
 // \return void
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Arg >  // Min/max argument type
-inline void Rand< DynamicMatrix<Type,SO> >::randomize( DynamicMatrix<Type,SO>& matrix,
-                                                       const Arg& min, const Arg& max ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Arg >    // Min/max argument type
+inline void Rand< DynamicMatrix<Type,SO,Alloc> >::randomize( DynamicMatrix<Type,SO,Alloc>& matrix,
+                                                             const Arg& min, const Arg& max ) const
 {
    using blaze::randomize;
 
@@ -215,9 +220,10 @@ inline void Rand< DynamicMatrix<Type,SO> >::randomize( DynamicMatrix<Type,SO>& m
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void makeSymmetric( DynamicMatrix<Type,SO>& matrix )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void makeSymmetric( DynamicMatrix<Type,SO,Alloc>& matrix )
 {
    using blaze::randomize;
 
@@ -253,8 +259,9 @@ void makeSymmetric( DynamicMatrix<Type,SO>& matrix )
 */
 template< typename Type   // Data type of the matrix
         , bool SO         // Storage order
+        , typename Alloc  // Type of the allocator
         , typename Arg >  // Min/max argument type
-void makeSymmetric( DynamicMatrix<Type,SO>& matrix, const Arg& min, const Arg& max )
+void makeSymmetric( DynamicMatrix<Type,SO,Alloc>& matrix, const Arg& min, const Arg& max )
 {
    using blaze::randomize;
 
@@ -286,9 +293,10 @@ void makeSymmetric( DynamicMatrix<Type,SO>& matrix, const Arg& min, const Arg& m
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void makeHermitian( DynamicMatrix<Type,SO>& matrix )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void makeHermitian( DynamicMatrix<Type,SO,Alloc>& matrix )
 {
    using blaze::randomize;
 
@@ -328,8 +336,9 @@ void makeHermitian( DynamicMatrix<Type,SO>& matrix )
 */
 template< typename Type   // Data type of the matrix
         , bool SO         // Storage order
+        , typename Alloc  // Type of the allocator
         , typename Arg >  // Min/max argument type
-void makeHermitian( DynamicMatrix<Type,SO>& matrix, const Arg& min, const Arg& max )
+void makeHermitian( DynamicMatrix<Type,SO,Alloc>& matrix, const Arg& min, const Arg& max )
 {
    using blaze::randomize;
 
@@ -365,9 +374,10 @@ void makeHermitian( DynamicMatrix<Type,SO>& matrix, const Arg& min, const Arg& m
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void makePositiveDefinite( DynamicMatrix<Type,SO>& matrix )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void makePositiveDefinite( DynamicMatrix<Type,SO,Alloc>& matrix )
 {
    using blaze::randomize;
 
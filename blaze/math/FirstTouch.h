@@ -0,0 +1,102 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/FirstTouch.h
+//  \brief Header file for the first-touch token
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_FIRSTTOUCH_H_
+#define _BLAZE_MATH_FIRSTTOUCH_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of the blaze::firstTouch instance.
+// \ingroup math
+//
+// blaze::FirstTouch is the type of the blaze::firstTouch instance, which is an optional token
+// for the homogeneous initialization of dense vectors and matrices. It selects the parallel
+// first-touch initialization for an individual vector or matrix.
+*/
+struct FirstTouch
+{
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline constexpr FirstTouch() = default;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FIRSTTOUCH INSTANCE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Global FirstTouch instance.
+// \ingroup math
+//
+// The blaze::firstTouch instance is an optional token for the homogeneous initialization of
+// dense vectors and matrices. Independent of the \a BLAZE_USE_NUMA_FIRST_TOUCH configuration
+// switch it initializes all elements (including the padding elements) in parallel, based on the
+// same partitioning as all shared-memory parallel assignments. Therefore the memory pages of the
+// vector or matrix are placed on the NUMA nodes of the threads that later work on them:
+
+   \code
+   blaze::DynamicVector<double> a( 100000000UL, 0.0, blaze::firstTouch );
+   blaze::DynamicVector<double> b( 100000000UL, 1.0, blaze::firstTouch );
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL, 0.0, blaze::firstTouch );
+
+   a += b;  // Every thread works on memory local to its NUMA node
+   \endcode
+
+// Please note that the parallel initialization is only performed in case a shared-memory
+// parallelization is active and the construction does not happen within a parallel section.
+*/
+constexpr FirstTouch firstTouch;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
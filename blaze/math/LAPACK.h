@@ -76,6 +76,9 @@
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/lapack/potri.h>
 #include <blaze/math/lapack/potrs.h>
+#include <blaze/math/lapack/pptrf.h>
+#include <blaze/math/lapack/pptri.h>
+#include <blaze/math/lapack/pptrs.h>
 #include <blaze/math/lapack/syev.h>
 #include <blaze/math/lapack/syevd.h>
 #include <blaze/math/lapack/syevx.h>
@@ -0,0 +1,1353 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedMatrix.h
+//  \brief Header file for the complete PackedMatrix implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKEDMATRIX_H_
+#define _BLAZE_MATH_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <blaze/math/adaptors/DiagonalMatrix.h>
+#include <blaze/math/adaptors/HermitianMatrix.h>
+#include <blaze/math/adaptors/LowerMatrix.h>
+#include <blaze/math/adaptors/SymmetricMatrix.h>
+#include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/blas/hpmv.h>
+#include <blaze/math/blas/spmv.h>
+#include <blaze/math/blas/tpmv.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/PackingFlag.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsBLASCompatible.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/Views.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for PackedMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of PackedMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+class Rand< PackedMatrix<Type,PF,SO> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const PackedMatrix<Type,PF,SO> generate( size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( PackedMatrix<Type,PF,SO>& matrix ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random PackedMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return The generated random matrix.
+// \exception std::invalid_argument Invalid non-square packed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline const PackedMatrix<Type,PF,SO>
+   Rand< PackedMatrix<Type,PF,SO> >::generate( size_t m, size_t n ) const
+{
+   PackedMatrix<Type,PF,SO> matrix( m, n );
+   randomize( matrix );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a PackedMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+//
+// All elements of the stored triangle are randomized. In case of a Hermitian matrix the diagonal
+// elements are restricted to real values.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void Rand< PackedMatrix<Type,PF,SO> >::randomize( PackedMatrix<Type,PF,SO>& matrix ) const
+{
+   using blaze::randomize;
+
+   for( size_t k=0UL; k<matrix.rows(); ++k ) {
+      const size_t lend( matrix.storedEnd( k ) );
+      Type* element( matrix.data( k ) );
+      for( size_t l=matrix.storedBegin( k ); l<lend; ++l, ++element ) {
+         randomize( *element );
+      }
+      if( PF == packedHermitian ) {
+         matrix(k,k) = real( matrix(k,k) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX/VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Helper variable template for the selection of the BLAS packed matrix/vector kernels.
+// \ingroup packed_matrix
+//
+// In case the packed matrix and the two involved vectors are suited for a BLAS kernel (spmv(),
+// hpmv(), or tpmv()), the variable will be set to 1, otherwise it will be 0. Note that there
+// is no BLAS kernel for complex symmetric matrices and no packed BLAS kernel for diagonal
+// matrices.
+*/
+template< PackingFlag PF  // Structure of the packed matrix
+        , typename T1     // Element type of the target vector
+        , typename T2     // Element type of the packed matrix
+        , typename T3 >   // Element type of the right-hand side vector
+constexpr bool UsePackedBlasKernel_v =
+   ( BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION &&
+     IsBLASCompatible_v<T1> && IsSame_v<T1,T2> && IsSame_v<T1,T3> &&
+     PF != packedDiagonal && !( PF == packedSymmetric && IsComplex_v<T1> ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a packed matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param y Pointer to the first element of the target vector.
+// \param A Pointer to the first element of the packed matrix.
+// \param n The number of rows/columns of the packed matrix.
+// \param x Pointer to the first element of the right-hand side vector.
+// \return void
+//
+// This function traverses the packed matrix row by row (in case of a row-major matrix) or
+// column by column (in case of a column-major matrix). Since the stored part of each row/column
+// is contiguous in memory, each step is performed via a vectorized dot product or a vectorized
+// scaled vector addition, respectively. In case of a symmetric or Hermitian matrix, the mirrored
+// (and conjugated) elements of the unstored triangle are handled in the same pass over the
+// stored triangle. In case of a diagonal matrix the multiplication reduces to a single
+// vectorized componentwise product.
+*/
+template< PackingFlag PF  // Structure of the packed matrix
+        , bool SO         // Storage order of the packed matrix
+        , typename T1     // Element type of the target vector
+        , typename T2     // Element type of the packed matrix
+        , typename T3 >   // Element type of the right-hand side vector
+inline DisableIf_t< UsePackedBlasKernel_v<PF,T1,T2,T3> >
+   packedMultiply( T1* y, const T2* A, size_t n, const T3* x )
+{
+   using YT = CustomVector<T1,unaligned,unpadded,columnVector>;
+   using AT = CustomVector<const T2,unaligned,unpadded,columnVector>;
+   using XT = CustomVector<const T3,unaligned,unpadded,columnVector>;
+
+   constexpr bool trailing( ( PF == packedLower && SO ) || ( PF == packedUpper && !SO ) );
+
+   if( PF == packedDiagonal ) {
+      YT( y, n ) = AT( A, n ) * XT( x, n );
+      return;
+   }
+
+   if( PF == packedSymmetric || PF == packedHermitian || SO ) {
+      YT( y, n ).reset();
+   }
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      if( trailing )
+      {
+         const AT a( A, n-k );
+
+         if( SO ) {
+            YT( y+k, n-k ) += a * x[k];
+         }
+         else {
+            y[k] = dot( a, XT( x+k, n-k ) );
+         }
+
+         A += n-k;
+      }
+      else if( PF == packedLower || PF == packedUpper )
+      {
+         const AT a( A, k+1UL );
+
+         if( SO ) {
+            YT( y, k+1UL ) += a * x[k];
+         }
+         else {
+            y[k] = dot( a, XT( x, k+1UL ) );
+         }
+
+         A += k+1UL;
+      }
+      else
+      {
+         const AT a( A, k );
+
+         if( SO ) {
+            YT( y, k ) += a * x[k];
+            y[k] += ( PF == packedHermitian )?( dot( conj( a ), XT( x, k ) ) ):( dot( a, XT( x, k ) ) );
+         }
+         else {
+            y[k] += dot( a, XT( x, k ) );
+            if( PF == packedHermitian )
+               YT( y, k ) += conj( a ) * x[k];
+            else
+               YT( y, k ) += a * x[k];
+         }
+
+         y[k] += A[k] * x[k];
+         A += k+1UL;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief BLAS-based kernel for the multiplication of a real packed symmetric matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param order The storage order of the packed matrix.
+// \param uplo The stored triangle of the packed matrix.
+// \param n The number of rows/columns of the packed matrix.
+// \param A Pointer to the first element of the packed matrix.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param y Pointer to the first element of the target vector.
+// \return void
+*/
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION
+template< typename T >  // Element type of the packed matrix
+inline void packedSymmetricMultiply( CBLAS_ORDER order, CBLAS_UPLO uplo, int n,
+                                     const T* A, const T* x, T* y, FalseType )
+{
+   spmv( order, uplo, n, T(1), A, x, 1, T(0), y, 1 );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief BLAS-based kernel for the multiplication of a complex packed Hermitian matrix and a
+//        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param order The storage order of the packed matrix.
+// \param uplo The stored triangle of the packed matrix.
+// \param n The number of rows/columns of the packed matrix.
+// \param A Pointer to the first element of the packed matrix.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param y Pointer to the first element of the target vector.
+// \return void
+*/
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION
+template< typename T >  // Element type of the packed matrix
+inline void packedSymmetricMultiply( CBLAS_ORDER order, CBLAS_UPLO uplo, int n,
+                                     const T* A, const T* x, T* y, TrueType )
+{
+   hpmv( order, uplo, n, T(1), A, x, 1, T(0), y, 1 );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief BLAS-based kernel for the multiplication of a packed matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param y Pointer to the first element of the target vector.
+// \param A Pointer to the first element of the packed matrix.
+// \param n The number of rows/columns of the packed matrix.
+// \param x Pointer to the first element of the right-hand side vector.
+// \return void
+//
+// This function relays to the BLAS spmv() function for symmetric and real Hermitian matrices,
+// to the hpmv() function for complex Hermitian matrices, and to the tpmv() function for
+// triangular matrices.
+*/
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION
+template< PackingFlag PF  // Structure of the packed matrix
+        , bool SO         // Storage order of the packed matrix
+        , typename T1     // Element type of the target vector
+        , typename T2     // Element type of the packed matrix
+        , typename T3 >   // Element type of the right-hand side vector
+inline EnableIf_t< UsePackedBlasKernel_v<PF,T1,T2,T3> >
+   packedMultiply( T1* y, const T2* A, size_t n, const T3* x )
+{
+   const CBLAS_ORDER order( SO ? CblasColMajor : CblasRowMajor );
+   const CBLAS_UPLO  uplo ( ( PF == packedLower || ( PF != packedUpper && !SO ) )
+                            ?( CblasLower ):( CblasUpper ) );
+   const int N( numeric_cast<int>( n ) );
+
+   if( N == 0 ) {
+      return;
+   }
+
+   if( PF == packedLower || PF == packedUpper ) {
+      std::copy( x, x+n, y );
+      tpmv( order, uplo, CblasNoTrans, CblasNonUnit, N, A, y, 1 );
+   }
+   else {
+      packedSymmetricMultiply( order, uplo, N, A, x, y, IsComplex<T1>() );
+   }
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a packed matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param A Pointer to the first element of the packed matrix.
+// \param n The number of rows/columns of the packed matrix.
+// \param x The right-hand side dense vector.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< PackingFlag PF  // Structure of the packed matrix
+        , bool SO         // Storage order of the packed matrix
+        , typename Type   // Element type of the packed matrix
+        , typename VT >   // Type of the right-hand side dense vector
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   packedMultiply( const Type* A, size_t n, const DenseVector<VT,columnVector>& x )
+{
+   using ET = MultTrait_t< Type, ElementType_t<VT> >;
+   using XT = If_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT>, const VT&, const ResultType_t<VT> >;
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   XT x_( ~x );
+   DynamicVector<ET,columnVector> y( n );
+
+   packedMultiply<PF,SO>( y.data(), A, n, x_.data() );
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the detection of packed diagonal matrices.
+// \ingroup packed_matrix
+//
+// In case the given type is a PackedMatrix with diagonal structure, the variable is set to
+// \a true, otherwise it is set to \a false.
+*/
+template< typename MT >  // Type of the matrix
+constexpr bool IsPackedDiagonal_v = false;
+
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order of the matrix
+constexpr bool IsPackedDiagonal_v< PackedMatrix<Type,packedDiagonal,SO> > = true;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//=================================================================================================
+//
+//  CLASS PACKEDDIAGONAL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief View on the contiguous diagonal of a packed diagonal matrix.
+// \ingroup packed_matrix
+//
+// The PackedDiagonal class template represents the diagonal elements of a packed diagonal matrix
+// as a dense vector. It is built on an unaligned, unpadded CustomVector of constant elements. In
+// contrast to the CustomVector, which is stored by reference within expression templates, the
+// PackedDiagonal is a view and is therefore stored by value. Thus it can be used as operand of
+// lazily evaluated expressions that outlive the function creating the view, as for instance in
+// the multiplication operators of packed diagonal matrices. The viewed packed matrix must stay
+// alive until the evaluation of these expressions.
+*/
+template< typename Type  // Data type of the diagonal elements
+        , bool TF >      // Transpose flag
+class PackedDiagonal
+   : public View< DenseVector< PackedDiagonal<Type,TF>, TF > >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Operand = CustomVector<const Type,unaligned,unpadded,TF>;  //!< Type of the viewed elements.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = PackedDiagonal<Type,TF>;         //!< Type of this PackedDiagonal instance.
+   using BaseType       = DenseVector<This,TF>;            //!< Base type of this PackedDiagonal instance.
+   using ResultType     = ResultType_t<Operand>;           //!< Result type for expression template evaluations.
+   using TransposeType  = TransposeType_t<ResultType>;     //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                            //!< Type of the vector elements.
+   using SIMDType       = SIMDTrait_t<ElementType>;        //!< SIMD type of the vector elements.
+   using ReturnType     = const Type&;                     //!< Return type for expression template evaluations
+   using CompositeType  = const PackedDiagonal&;           //!< Data type for composite expression templates.
+   using Reference      = const Type&;                     //!< Reference to a non-constant vector value.
+   using ConstReference = const Type&;                     //!< Reference to a constant vector value.
+   using Pointer        = const Type*;                     //!< Pointer to a non-constant vector value.
+   using ConstPointer   = const Type*;                     //!< Pointer to a constant vector value.
+   using Iterator       = ConstIterator_t<Operand>;        //!< Iterator over non-constant elements.
+   using ConstIterator  = ConstIterator_t<Operand>;        //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = Operand::simdEnabled;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = Operand::smpAssignable;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the PackedDiagonal class template.
+   //
+   // \param ptr Pointer to the first diagonal element.
+   // \param n The number of diagonal elements.
+   */
+   explicit inline PackedDiagonal( const Type* ptr, size_t n )
+      : vector_( ptr, n )  // The viewed diagonal elements
+   {}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\brief Subscript operator for the direct access to the diagonal elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed value.
+   */
+   inline ConstReference operator[]( size_t index ) const noexcept {
+      return vector_[index];
+   }
+
+   /*!\brief Checked access to the diagonal elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ConstReference at( size_t index ) const {
+      return vector_.at( index );
+   }
+
+   /*!\brief Low-level data access to the diagonal elements.
+   //
+   // \return Pointer to the first diagonal element.
+   */
+   inline ConstPointer data() const noexcept {
+      return vector_.data();
+   }
+
+   /*!\brief Returns an iterator to the first diagonal element.
+   //
+   // \return Iterator to the first diagonal element.
+   */
+   inline ConstIterator begin() const noexcept {
+      return vector_.begin();
+   }
+
+   /*!\brief Returns an iterator to the first diagonal element.
+   //
+   // \return Iterator to the first diagonal element.
+   */
+   inline ConstIterator cbegin() const noexcept {
+      return vector_.cbegin();
+   }
+
+   /*!\brief Returns an iterator just past the last diagonal element.
+   //
+   // \return Iterator just past the last diagonal element.
+   */
+   inline ConstIterator end() const noexcept {
+      return vector_.end();
+   }
+
+   /*!\brief Returns an iterator just past the last diagonal element.
+   //
+   // \return Iterator just past the last diagonal element.
+   */
+   inline ConstIterator cend() const noexcept {
+      return vector_.cend();
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of diagonal elements.
+   //
+   // \return The number of diagonal elements.
+   */
+   inline size_t size() const noexcept {
+      return vector_.size();
+   }
+
+   /*!\brief Returns the minimum capacity of the viewed diagonal.
+   //
+   // \return The minimum capacity of the viewed diagonal.
+   */
+   inline size_t spacing() const noexcept {
+      return vector_.spacing();
+   }
+
+   /*!\brief Returns the number of non-zero diagonal elements.
+   //
+   // \return The number of non-zero diagonal elements.
+   */
+   inline size_t nonZeros() const {
+      return vector_.nonZeros();
+   }
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\brief Returns whether the view can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the alias corresponds to this view, \a false if not.
+   */
+   template< typename Other >
+   inline bool canAlias( const Other* alias ) const noexcept {
+      return vector_.canAlias( alias );
+   }
+
+   /*!\brief Returns whether the view is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the alias corresponds to this view, \a false if not.
+   */
+   template< typename Other >
+   inline bool isAliased( const Other* alias ) const noexcept {
+      return vector_.isAliased( alias );
+   }
+
+   /*!\brief Returns whether the diagonal elements are properly aligned in memory.
+   //
+   // \return \a true in case the diagonal elements are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return vector_.isAligned();
+   }
+
+   /*!\brief Returns whether the view can be used in SMP assignments.
+   //
+   // \return \a true in case the view can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return vector_.canSMPAssign();
+   }
+
+   /*!\brief Load of a SIMD element of the diagonal.
+   //
+   // \param index Access index. The index must be smaller than the number of diagonal elements.
+   // \return The loaded SIMD element.
+   */
+   BLAZE_ALWAYS_INLINE SIMDType load( size_t index ) const noexcept {
+      return vector_.load( index );
+   }
+
+   /*!\brief Aligned load of a SIMD element of the diagonal.
+   //
+   // \param index Access index. The index must be smaller than the number of diagonal elements.
+   // \return The loaded SIMD element.
+   */
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t index ) const noexcept {
+      return vector_.loada( index );
+   }
+
+   /*!\brief Unaligned load of a SIMD element of the diagonal.
+   //
+   // \param index Access index. The index must be smaller than the number of diagonal elements.
+   // \return The loaded SIMD element.
+   */
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t index ) const noexcept {
+      return vector_.loadu( index );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand vector_;  //!< The viewed diagonal elements.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED DIAGONAL MATRIX KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a packed diagonal matrix and a dense matrix (\f$ C=D*A \f$).
+// \ingroup packed_matrix
+//
+// \param d Pointer to the first diagonal element of the packed diagonal matrix.
+// \param n The number of rows/columns of the packed diagonal matrix.
+// \param A The right-hand side dense matrix.
+// \return Expression representing the scaled rows of the dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function scales each row \a i of the given dense matrix by the diagonal element \a d[i].
+// The scaling is expressed as the lazily evaluated Schur product of the expanded diagonal and
+// the dense matrix and is therefore both vectorized and parallelized.
+*/
+template< typename Type  // Element type of the packed diagonal matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline decltype(auto) packedScaleRows( const Type* d, size_t n, const DenseMatrix<MT,SO>& A )
+{
+   if( (~A).rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const PackedDiagonal<Type,columnVector> diag( d, n );
+
+   return expand( diag, (~A).columns() ) % (~A);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a dense matrix and a packed diagonal matrix (\f$ C=A*D \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side dense matrix.
+// \param d Pointer to the first diagonal element of the packed diagonal matrix.
+// \param n The number of rows/columns of the packed diagonal matrix.
+// \return Expression representing the scaled columns of the dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function scales each column \a j of the given dense matrix by the diagonal element
+// \a d[j]. The scaling is expressed as the lazily evaluated Schur product of the dense matrix
+// and the expanded diagonal and is therefore both vectorized and parallelized.
+*/
+template< typename MT      // Type of the left-hand side dense matrix
+        , bool SO          // Storage order of the left-hand side dense matrix
+        , typename Type >  // Element type of the packed diagonal matrix
+inline decltype(auto) packedScaleColumns( const DenseMatrix<MT,SO>& A, const Type* d, size_t n )
+{
+   if( (~A).columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const PackedDiagonal<Type,rowVector> diag( d, n );
+
+   return (~A) % expand( diag, (~A).rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a packed diagonal matrix and a dense vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param d Pointer to the first diagonal element of the packed diagonal matrix.
+// \param n The number of rows/columns of the packed diagonal matrix.
+// \param x The right-hand side dense vector.
+// \return Expression representing the componentwise product of the diagonal and the vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename Type  // Element type of the packed diagonal matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline decltype(auto) packedScaleVector( const Type* d, size_t n, const DenseVector<VT,columnVector>& x )
+{
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const PackedDiagonal<Type,columnVector> diag( d, n );
+
+   return diag * (~x);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, PackingFlag PF, bool SO, typename VT >
+DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const PackedMatrix<Type,PF,SO>& A, const DenseVector<VT,columnVector>& x );
+
+template< typename Type, bool SO, typename VT >
+DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const SymmetricMatrix<PackedMatrix<Type,packedSymmetric,SO>,SO,true,true>& A,
+              const DenseVector<VT,columnVector>& x );
+
+template< typename Type, bool SO, typename VT >
+DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const HermitianMatrix<PackedMatrix<Type,packedHermitian,SO>,SO,true>& A,
+              const DenseVector<VT,columnVector>& x );
+
+template< typename Type, bool SO, typename VT >
+DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const LowerMatrix<PackedMatrix<Type,packedLower,SO>,SO,true>& A,
+              const DenseVector<VT,columnVector>& x );
+
+template< typename Type, bool SO, typename VT >
+DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const UpperMatrix<PackedMatrix<Type,packedUpper,SO>,SO,true>& A,
+              const DenseVector<VT,columnVector>& x );
+
+template< typename Type, bool SO, typename VT >
+decltype(auto)
+   operator*( const PackedMatrix<Type,packedDiagonal,SO>& D, const DenseVector<VT,columnVector>& x );
+
+template< typename Type, bool SO, typename VT >
+decltype(auto)
+   operator*( const DiagonalMatrix<PackedMatrix<Type,packedDiagonal,SO>,SO,true>& D,
+              const DenseVector<VT,columnVector>& x );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+decltype(auto)
+   operator*( const PackedMatrix<Type,packedDiagonal,SO>& D, const DenseMatrix<MT,SO2>& A );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+decltype(auto)
+   operator*( const DiagonalMatrix<PackedMatrix<Type,packedDiagonal,SO>,SO,true>& D,
+              const DenseMatrix<MT,SO2>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side packed matrix for the multiplication.
+// \param x The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication of a packed matrix and a dense vector. In contrast
+// to the multiplication of general dense matrices, the multiplication is evaluated immediately
+// by means of a dedicated packed kernel, which only traverses the stored triangle of the matrix
+// once. In case BLAS mode is enabled, the BLAS functions spmv(), hpmv(), and tpmv() are used
+// for \c float, \c double, \c complex<float>, and \c complex<double> operands.
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::DynamicVector;
+   using blaze::packedSymmetric;
+
+   PackedMatrix<double,packedSymmetric> A( 100UL, 100UL );
+   DynamicVector<double> x( 100UL );
+   // ... Initialization
+
+   DynamicVector<double> y( A * x );
+   \endcode
+
+// In case the current size of the vector \a x doesn't match the current number of columns of
+// the matrix \a A, a \a std::invalid_argument is thrown.
+*/
+template< typename Type   // Data type of the packed matrix
+        , PackingFlag PF  // Structure of the packed matrix
+        , bool SO         // Storage order of the packed matrix
+        , typename VT >   // Type of the right-hand side dense vector
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const PackedMatrix<Type,PF,SO>& A, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedMultiply<PF,SO>( A.data(), A.columns(), ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed symmetric matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side symmetric packed matrix for the multiplication.
+// \param x The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication of a symmetric matrix in packed storage format
+// and a dense vector, which is evaluated immediately by means of the packed kernel.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const SymmetricMatrix<PackedMatrix<Type,packedSymmetric,SO>,SO,true,true>& A,
+              const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedMultiply<packedSymmetric,SO>( A.data(), A.columns(), ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed Hermitian matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side Hermitian packed matrix for the multiplication.
+// \param x The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication of a Hermitian matrix in packed storage format
+// and a dense vector, which is evaluated immediately by means of the packed kernel.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const HermitianMatrix<PackedMatrix<Type,packedHermitian,SO>,SO,true>& A,
+              const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedMultiply<packedHermitian,SO>( A.data(), A.columns(), ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed lower matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side lower packed matrix for the multiplication.
+// \param x The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication of a lower triangular matrix in packed storage
+// format and a dense vector, which is evaluated immediately by means of the packed kernel.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const LowerMatrix<PackedMatrix<Type,packedLower,SO>,SO,true>& A,
+              const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedMultiply<packedLower,SO>( A.data(), A.columns(), ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed upper matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side upper packed matrix for the multiplication.
+// \param x The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication of an upper triangular matrix in packed storage
+// format and a dense vector, which is evaluated immediately by means of the packed kernel.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const UpperMatrix<PackedMatrix<Type,packedUpper,SO>,SO,true>& A,
+              const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedMultiply<packedUpper,SO>( A.data(), A.columns(), ~x );
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed diagonal matrix and a dense
+//        vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param D The left-hand side diagonal packed matrix for the multiplication.
+// \param x The right-hand side dense vector for the multiplication.
+// \return Expression for the multiplication.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication of a diagonal matrix in packed storage format
+// and a dense vector. The multiplication is not evaluated immediately, but represented as the
+// lazily evaluated componentwise product of the diagonal and the vector. Note that the diagonal
+// matrix must stay alive until the evaluation of the resulting expression.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const PackedMatrix<Type,packedDiagonal,SO>& D, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedScaleVector( D.data(), D.columns(), ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed diagonal matrix and a dense
+//        vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param D The left-hand side diagonal packed matrix for the multiplication.
+// \param x The right-hand side dense vector for the multiplication.
+// \return Expression for the multiplication.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication of a diagonal matrix in packed storage format
+// and a dense vector, which is represented as the lazily evaluated componentwise product of the
+// diagonal and the vector.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const DiagonalMatrix<PackedMatrix<Type,packedDiagonal,SO>,SO,true>& D,
+              const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedScaleVector( D.data(), D.columns(), ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed diagonal matrix and a dense
+//        matrix (\f$ C=D*A \f$).
+// \ingroup packed_matrix
+//
+// \param D The left-hand side diagonal packed matrix for the multiplication.
+// \param A The right-hand side dense matrix for the multiplication.
+// \return Expression for the multiplication.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a diagonal matrix in packed storage format
+// and a dense matrix. The multiplication is not evaluated immediately, but represented as the
+// lazily evaluated scaling of each row of the dense matrix by the according diagonal element,
+// which requires only a single (vectorized and parallelized) pass over the dense matrix. Note
+// that the diagonal matrix must stay alive until the evaluation of the resulting expression.
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::DiagonalMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::packedDiagonal;
+
+   DiagonalMatrix< PackedMatrix<double,packedDiagonal> > D( 100000UL );  // Stores 100000 elements
+   DynamicMatrix<double> A( 100000UL, 10UL );
+   // ... Initialization
+
+   DynamicMatrix<double> B( D * A );
+   \endcode
+
+// In case the current number of columns of \a D doesn't match the current number of rows of
+// \a A, a \a std::invalid_argument is thrown.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const PackedMatrix<Type,packedDiagonal,SO>& D, const DenseMatrix<MT,SO2>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedScaleRows( D.data(), D.columns(), ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense matrix and a packed diagonal
+//        matrix (\f$ C=A*D \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side dense matrix for the multiplication.
+// \param D The right-hand side diagonal packed matrix for the multiplication.
+// \return Expression for the multiplication.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a dense matrix and a diagonal matrix in packed
+// storage format. The multiplication is not evaluated immediately, but represented as the lazily
+// evaluated scaling of each column of the dense matrix by the according diagonal element.
+*/
+template< typename MT    // Type of the left-hand side dense matrix
+        , bool SO2       // Storage order of the left-hand side dense matrix
+        , typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , DisableIf_t< IsDiagonal_v<MT> || IsPackedDiagonal_v<MT> >* = nullptr >
+inline decltype(auto)
+   operator*( const DenseMatrix<MT,SO2>& A, const PackedMatrix<Type,packedDiagonal,SO>& D )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedScaleColumns( ~A, D.data(), D.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed diagonal matrix and a dense
+//        matrix (\f$ C=D*A \f$).
+// \ingroup packed_matrix
+//
+// \param D The left-hand side diagonal packed matrix for the multiplication.
+// \param A The right-hand side dense matrix for the multiplication.
+// \return Expression for the multiplication.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a diagonal matrix in packed storage format
+// and a dense matrix, which is represented as the lazily evaluated scaling of each row of the
+// dense matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const DiagonalMatrix<PackedMatrix<Type,packedDiagonal,SO>,SO,true>& D,
+              const DenseMatrix<MT,SO2>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedScaleRows( D.data(), D.columns(), ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense matrix and a packed diagonal
+//        matrix (\f$ C=A*D \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side dense matrix for the multiplication.
+// \param D The right-hand side diagonal packed matrix for the multiplication.
+// \return Expression for the multiplication.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a dense matrix and a diagonal matrix in packed
+// storage format, which is represented as the lazily evaluated scaling of each column of the
+// dense matrix.
+*/
+template< typename MT    // Type of the left-hand side dense matrix
+        , bool SO2       // Storage order of the left-hand side dense matrix
+        , typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , DisableIf_t< IsDiagonal_v<MT> || IsPackedDiagonal_v<MT> >* = nullptr >
+inline decltype(auto)
+   operator*( const DenseMatrix<MT,SO2>& A,
+              const DiagonalMatrix<PackedMatrix<Type,packedDiagonal,SO>,SO,true>& D )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return packedScaleColumns( ~A, D.data(), D.rows() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RANK-K UPDATE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Rank-k update functions */
+//@{
+template< typename Type, PackingFlag PF, bool SO, typename MT, bool SO2, typename ST >
+void rankUpdate( PackedMatrix<Type,PF,SO>& A, const DenseMatrix<MT,SO2>& B, ST alpha );
+
+template< typename Type, bool SO, typename MT, bool SO2, typename ST >
+void rankUpdate( SymmetricMatrix<PackedMatrix<Type,packedSymmetric,SO>,SO,true,true>& A,
+                 const DenseMatrix<MT,SO2>& B, ST alpha );
+
+template< typename Type, bool SO, typename MT, bool SO2, typename ST >
+void rankUpdate( HermitianMatrix<PackedMatrix<Type,packedHermitian,SO>,SO,true>& A,
+                 const DenseMatrix<MT,SO2>& B, ST alpha );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-k update of a symmetric or Hermitian packed matrix
+//        (\f$ A+=\alpha*B*B^T \f$ or \f$ A+=\alpha*B*B^H \f$).
+// \ingroup packed_matrix
+//
+// \param A The symmetric or Hermitian packed matrix to be updated.
+// \param B The \f$ N \times K \f$ dense matrix operand.
+// \param alpha The scaling factor of the update.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function performs a rank-k update of the given symmetric (\f$ A+=\alpha*B*B^T \f$) or
+// Hermitian (\f$ A+=\alpha*B*B^H \f$) packed matrix. The update is computed block-wise: Each
+// block of the result that overlaps the stored triangle is computed by a general dense matrix
+// multiplication (which uses the BLAS gemm() functions in BLAS mode) and is then added to the
+// contiguous segments of the packed storage. Thus only the stored triangle is updated and the
+// full \f$ N \times N \f$ result is never formed. Note that in case of a Hermitian matrix the
+// scaling factor \a alpha is expected to be real.
+*/
+template< typename Type   // Data type of the packed matrix
+        , PackingFlag PF  // Structure of the packed matrix
+        , bool SO         // Storage order of the packed matrix
+        , typename MT     // Type of the dense matrix operand
+        , bool SO2        // Storage order of the dense matrix operand
+        , typename ST >   // Type of the scaling factor
+void rankUpdate( PackedMatrix<Type,PF,SO>& A, const DenseMatrix<MT,SO2>& B, ST alpha )
+{
+   BLAZE_STATIC_ASSERT( PF == packedSymmetric || PF == packedHermitian );
+
+   using TmpType = DynamicMatrix< MultTrait_t< ElementType_t<MT>, ST >, rowMajor >;
+
+   constexpr size_t block( 128UL );
+
+   if( (~B).rows() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT> B_( ~B );
+
+   const size_t n( A.rows() );
+   const size_t m( B_.columns() );
+
+   if( n == 0UL || m == 0UL ) {
+      return;
+   }
+
+   TmpType tmp;
+
+   for( size_t kk=0UL; kk<n; kk+=block )
+   {
+      const size_t kblock( min( block, n-kk ) );
+      const auto Bk( submatrix( B_, kk, 0UL, kblock, m ) );
+
+      for( size_t ll=0UL; ll<kk+kblock; ll+=block )
+      {
+         const size_t lblock( min( block, n-ll ) );
+         const auto Bl( submatrix( B_, ll, 0UL, lblock, m ) );
+
+         if( PF == packedHermitian )
+            tmp = alpha * ( Bk * ctrans( Bl ) );
+         else
+            tmp = alpha * ( Bk * trans( Bl ) );
+
+         for( size_t k=kk; k<kk+kblock; ++k )
+         {
+            const size_t lend( min( ll+lblock, k+1UL ) );
+
+            if( lend <= ll ) continue;
+
+            CustomVector<Type,unaligned,unpadded,rowVector> a( A.data( k )+ll, lend-ll );
+            const auto t( subvector( row( tmp, k-kk ), 0UL, lend-ll ) );
+
+            if( PF == packedHermitian && SO )
+               a += conj( t );
+            else
+               a += t;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-k update of a symmetric packed matrix (\f$ A+=\alpha*B*B^T \f$).
+// \ingroup packed_matrix
+//
+// \param A The symmetric packed matrix to be updated.
+// \param B The \f$ N \times K \f$ dense matrix operand.
+// \param alpha The scaling factor of the update.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function performs a rank-k update of the given symmetric packed matrix. Since the result
+// is symmetric by construction, the update is performed directly on the packed storage.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename MT    // Type of the dense matrix operand
+        , bool SO2       // Storage order of the dense matrix operand
+        , typename ST >  // Type of the scaling factor
+inline void rankUpdate( SymmetricMatrix<PackedMatrix<Type,packedSymmetric,SO>,SO,true,true>& A,
+                        const DenseMatrix<MT,SO2>& B, ST alpha )
+{
+   rankUpdate( derestrict( A ), ~B, alpha );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-k update of a Hermitian packed matrix (\f$ A+=\alpha*B*B^H \f$).
+// \ingroup packed_matrix
+//
+// \param A The Hermitian packed matrix to be updated.
+// \param B The \f$ N \times K \f$ dense matrix operand.
+// \param alpha The real scaling factor of the update.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid non-real scaling factor.
+//
+// This function performs a rank-k update of the given Hermitian packed matrix. Since the result
+// is Hermitian by construction for any real scaling factor, the update is performed directly on
+// the packed storage. In case the given scaling factor is not real, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename MT    // Type of the dense matrix operand
+        , bool SO2       // Storage order of the dense matrix operand
+        , typename ST >  // Type of the scaling factor
+inline void rankUpdate( HermitianMatrix<PackedMatrix<Type,packedHermitian,SO>,SO,true>& A,
+                        const DenseMatrix<MT,SO2>& B, ST alpha )
+{
+   if( !isReal( alpha ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-real scaling factor" );
+   }
+
+   rankUpdate( derestrict( A ), ~B, alpha );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
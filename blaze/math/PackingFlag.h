@@ -0,0 +1,76 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackingFlag.h
+//  \brief Header file for the packed matrix storage flags
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKINGFLAG_H_
+#define _BLAZE_MATH_PACKINGFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKING FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Packing flag.
+// \ingroup math
+//
+// The PackingFlag type enumeration represents the structures of square matrices that can be
+// stored in packed format (see the PackedMatrix class template), i.e. by storing only the
+// \f$ N(N+1)/2 \f$ elements of a single triangle or only the \f$ N \f$ diagonal elements. The
+// following flags are available:
+//
+//  - \c packedSymmetric: The matrix is symmetric. The elements of the unstored triangle are
+//          the mirrored elements of the stored triangle.
+//  - \c packedHermitian: The matrix is Hermitian. The elements of the unstored triangle are
+//          the complex conjugates of the mirrored elements of the stored triangle.
+//  - \c packedLower: The matrix is lower triangular. All elements above the diagonal are zero.
+//  - \c packedUpper: The matrix is upper triangular. All elements below the diagonal are zero.
+//  - \c packedDiagonal: The matrix is diagonal. All off-diagonal elements are zero.
+*/
+enum PackingFlag
+{
+   packedSymmetric = 0,  //!< Flag for a packed symmetric matrix.
+   packedHermitian = 1,  //!< Flag for a packed Hermitian matrix.
+   packedLower     = 2,  //!< Flag for a packed lower triangular matrix.
+   packedUpper     = 3,  //!< Flag for a packed upper triangular matrix.
+   packedDiagonal  = 4   //!< Flag for a packed diagonal matrix.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
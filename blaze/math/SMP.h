@@ -40,11 +40,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/smp/AssignmentGroup.h>
+#include <blaze/math/smp/AsyncAssign.h>
+#include <blaze/math/smp/Calibration.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/ExecutionPolicy.h>
 #include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Reduce.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/smp/Transpose.h>
 
 #endif
@@ -0,0 +1,210 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/SmallMatrix.h
+//  \brief Header file for the complete SmallMatrix implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMALLMATRIX_H_
+#define _BLAZE_MATH_SMALLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/SmallMatrix.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/SmallVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for SmallMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of SmallMatrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+class Rand< SmallMatrix<Type,M,N,SO,Alloc> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const SmallMatrix<Type,M,N,SO,Alloc> generate( size_t m, size_t n ) const;
+
+   template< typename Arg >
+   inline const SmallMatrix<Type,M,N,SO,Alloc> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( SmallMatrix<Type,M,N,SO,Alloc>& matrix ) const;
+
+   template< typename Arg >
+   inline void randomize( SmallMatrix<Type,M,N,SO,Alloc>& matrix, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SmallMatrix.
+//
+// \return The generated random matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline const SmallMatrix<Type,M,N,SO,Alloc>
+   Rand< SmallMatrix<Type,M,N,SO,Alloc> >::generate( size_t m, size_t n ) const
+{
+   SmallMatrix<Type,M,N,SO,Alloc> matrix( m, n );
+   randomize( matrix );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SmallMatrix.
+//
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Arg >    // Min/max argument type
+inline const SmallMatrix<Type,M,N,SO,Alloc>
+   Rand< SmallMatrix<Type,M,N,SO,Alloc> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+{
+   SmallMatrix<Type,M,N,SO,Alloc> matrix( m, n );
+   randomize( matrix, min, max );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SmallMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void Rand< SmallMatrix<Type,M,N,SO,Alloc> >::randomize( SmallMatrix<Type,M,N,SO,Alloc>& matrix ) const
+{
+   using blaze::randomize;
+
+   const size_t m( matrix.rows()    );
+   const size_t n( matrix.columns() );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         randomize( matrix(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SmallMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Arg >    // Min/max argument type
+inline void Rand< SmallMatrix<Type,M,N,SO,Alloc> >::randomize( SmallMatrix<Type,M,N,SO,Alloc>& matrix,
+                                                                const Arg& min, const Arg& max ) const
+{
+   using blaze::randomize;
+
+   const size_t m( matrix.rows()    );
+   const size_t n( matrix.columns() );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         randomize( matrix(i,j), min, max );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,192 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/SmallVector.h
+//  \brief Header file for the complete SmallVector implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMALLVECTOR_H_
+#define _BLAZE_MATH_SMALLVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/SmallVector.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for SmallVector.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of SmallVector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+class Rand< SmallVector<Type,N,TF,Alloc> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const SmallVector<Type,N,TF,Alloc> generate( size_t n ) const;
+
+   template< typename Arg >
+   inline const SmallVector<Type,N,TF,Alloc> generate( size_t n, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( SmallVector<Type,N,TF,Alloc>& vector ) const;
+
+   template< typename Arg >
+   inline void randomize( SmallVector<Type,N,TF,Alloc>& vector, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SmallVector.
+//
+// \param n The size of the random vector.
+// \return The generated random vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline const SmallVector<Type,N,TF,Alloc> Rand< SmallVector<Type,N,TF,Alloc> >::generate( size_t n ) const
+{
+   SmallVector<Type,N,TF,Alloc> vector( n );
+   randomize( vector );
+   return vector;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SmallVector.
+//
+// \param n The size of the random vector.
+// \param min The smallest possible value for a vector element.
+// \param max The largest possible value for a vector element.
+// \return The generated random vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Arg >    // Min/max argument type
+inline const SmallVector<Type,N,TF,Alloc>
+   Rand< SmallVector<Type,N,TF,Alloc> >::generate( size_t n, const Arg& min, const Arg& max ) const
+{
+   SmallVector<Type,N,TF,Alloc> vector( n );
+   randomize( vector, min, max );
+   return vector;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SmallVector.
+//
+// \param vector The vector to be randomized.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void Rand< SmallVector<Type,N,TF,Alloc> >::randomize( SmallVector<Type,N,TF,Alloc>& vector ) const
+{
+   using blaze::randomize;
+
+   for( size_t i=0UL; i<vector.size(); ++i ) {
+      randomize( vector[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SmallVector.
+//
+// \param vector The vector to be randomized.
+// \param min The smallest possible value for a vector element.
+// \param max The largest possible value for a vector element.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Arg >    // Min/max argument type
+inline void Rand< SmallVector<Type,N,TF,Alloc> >::randomize( SmallVector<Type,N,TF,Alloc>& vector,
+                                                              const Arg& min, const Arg& max ) const
+{
+   using blaze::randomize;
+
+   for( size_t i=0UL; i<vector.size(); ++i ) {
+      randomize( vector[i], min, max );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
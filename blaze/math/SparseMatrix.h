@@ -103,7 +103,9 @@
 #include <blaze/math/expressions/TSVecTSMatMultExpr.h>
 #include <blaze/math/Matrix.h>
 #include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/Reduce.h>
 #include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/sparse/Reordering.h>
 #include <blaze/math/sparse/SparseMatrix.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
@@ -69,6 +69,7 @@
 #include <blaze/math/expressions/SVecTransExpr.h>
 #include <blaze/math/expressions/SVecVarExpr.h>
 #include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/Reduce.h>
 #include <blaze/math/smp/SparseVector.h>
 #include <blaze/math/sparse/SparseVector.h>
 #include <blaze/math/Vector.h>
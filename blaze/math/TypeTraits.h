@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/typetraits/DynamicAllocator.h>
 #include <blaze/math/typetraits/HasAbs.h>
 #include <blaze/math/typetraits/HasAcos.h>
 #include <blaze/math/typetraits/HasAcosh.h>
@@ -256,6 +257,7 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/typetraits/TransposeFlag.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/typetraits/UnderlyingElement.h>
@@ -0,0 +1,214 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/Uninitialized.h
+//  \brief Header file for the uninitialized token
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_UNINITIALIZED_H_
+#define _BLAZE_MATH_UNINITIALIZED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Debugging.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of the blaze::uninitialized instance.
+// \ingroup math
+//
+// blaze::Uninitialized is the type of the blaze::uninitialized instance, which is an optional
+// token for the construction and the resize operation of dense vectors and matrices. It can be
+// used to skip the initialization of all elements that are subsequently overwritten anyway.
+*/
+struct Uninitialized
+{
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline constexpr Uninitialized() = default;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL UNINITIALIZED INSTANCE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Global Uninitialized instance.
+// \ingroup math
+//
+// The blaze::uninitialized instance is an optional token for the construction and the resize
+// operation of dense vectors and matrices. Independent of the \a BLAZE_USE_DEFAULT_INITIALIZATION
+// configuration switch it skips the initialization of all elements, which avoids a complete pass
+// over the memory in case the elements are overwritten anyway:
+
+   \code
+   blaze::DynamicMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization of A
+
+   blaze::DynamicVector<double> x( 1000UL, 1.0 );
+   blaze::DynamicVector<double> y( 1000UL, blaze::uninitialized );
+   y = A * x;
+
+   blaze::StaticMatrix<double,3UL,3UL> B( blaze::uninitialized );
+   B = submatrix( A, 0UL, 0UL, 3UL, 3UL );
+   \endcode
+
+// Note that the elements of uninitialized vectors and matrices must not be read before they are
+// assigned. In order to detect such reads, in debug mode (i.e. in case the \a BLAZE_USE_DEBUG_MODE
+// switch is set to 1 and \a NDEBUG is not defined) all uninitialized floating point elements are
+// set to NaN.
+*/
+constexpr Uninitialized uninitialized;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Poisoning of an uninitialized floating point value.
+// \ingroup math
+//
+// \param value The uninitialized value.
+// \return void
+*/
+template< typename Type >
+BLAZE_ALWAYS_INLINE EnableIf_t< IsFloatingPoint_v<Type> > poison( Type& value ) noexcept
+{
+   value = std::numeric_limits<Type>::quiet_NaN();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Poisoning of an uninitialized complex value.
+// \ingroup math
+//
+// \param value The uninitialized value.
+// \return void
+*/
+template< typename Type >
+BLAZE_ALWAYS_INLINE EnableIf_t< IsFloatingPoint_v<Type> > poison( complex<Type>& value ) noexcept
+{
+   value = complex<Type>( std::numeric_limits<Type>::quiet_NaN(),
+                          std::numeric_limits<Type>::quiet_NaN() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Poisoning of an uninitialized value of any other type.
+// \ingroup math
+//
+// \param value The uninitialized value.
+// \return void
+//
+// Values that cannot represent NaN are left untouched.
+*/
+template< typename Type >
+BLAZE_ALWAYS_INLINE EnableIf_t< !IsFloatingPoint_v<Type> &&
+                                !( IsComplex_v<Type> && IsFloatingPoint_v< UnderlyingBuiltin_t<Type> > ) >
+   poison( Type& value ) noexcept
+{
+   MAYBE_UNUSED( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Poisoning of a range of uninitialized elements.
+// \ingroup math
+//
+// \param first Pointer to the first uninitialized element.
+// \param last Pointer one past the last uninitialized element.
+// \return void
+//
+// In debug mode this function sets all floating point elements in the range \f$ [first,last) \f$
+// to NaN in order to detect reads of uninitialized elements. Otherwise the function has no
+// effect.
+*/
+template< typename Type >
+inline void poison( Type* first, Type* last ) noexcept
+{
+   if( BLAZE_DEBUG_MODE ) {
+      for( ; first!=last; ++first ) {
+         poison( *first );
+      }
+   }
+   else {
+      MAYBE_UNUSED( first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -1803,7 +1803,7 @@ struct IsRestricted< DiagonalMatrix<MT,SO,DF> >
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
 struct HasConstDataAccess< DiagonalMatrix<MT,SO,true> >
-   : public TrueType
+   : public HasConstDataAccess<MT>
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -329,6 +329,31 @@ inline void invert( HermitianMatrix<MT,SO,true>& m )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the instance without the access restrictions of the adaptor.
+// \ingroup hermitian_matrix
+//
+// \param m The Hermitian matrix to be derestricted.
+// \return Reference to the matrix without access restrictions.
+//
+// This function returns a reference to the adapted dense matrix of the given Hermitian matrix
+// instance, which gives unrestricted access to the elements of the matrix. This allows to
+// update a matrix with compact storage (as for instance a PackedMatrix) in place.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in the violation of invariants, erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the adapted matrix
+        , bool SO >    // Storage order of the adapted matrix
+inline MT& derestrict( HermitianMatrix<MT,SO,true>& m )
+{
+   return m.matrix_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Predict invariant violations by setting a single element of an Hermitian matrix.
@@ -1422,7 +1447,7 @@ struct IsRestricted< HermitianMatrix<MT,SO,DF> >
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
 struct HasConstDataAccess< HermitianMatrix<MT,SO,true> >
-   : public TrueType
+   : public HasConstDataAccess<MT>
 {};
 /*! \endcond */
 //*************************************************************************************************
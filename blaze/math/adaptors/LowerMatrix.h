@@ -1825,7 +1825,7 @@ struct IsRestricted< LowerMatrix<MT,SO,DF> >
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
 struct HasConstDataAccess< LowerMatrix<MT,SO,true> >
-   : public TrueType
+   : public HasConstDataAccess<MT>
 {};
 /*! \endcond */
 //*************************************************************************************************
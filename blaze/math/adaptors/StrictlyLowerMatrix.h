@@ -1764,7 +1764,7 @@ struct IsRestricted< StrictlyLowerMatrix<MT,SO,DF> >
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
 struct HasConstDataAccess< StrictlyLowerMatrix<MT,SO,true> >
-   : public TrueType
+   : public HasConstDataAccess<MT>
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -1766,7 +1766,7 @@ struct IsRestricted< StrictlyUpperMatrix<MT,SO,DF> >
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
 struct HasConstDataAccess< StrictlyUpperMatrix<MT,SO,true> >
-   : public TrueType
+   : public HasConstDataAccess<MT>
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -334,6 +334,31 @@ inline void invert( SymmetricMatrix<MT,SO,true,true>& m )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the instance without the access restrictions of the adaptor.
+// \ingroup symmetric_matrix
+//
+// \param m The symmetric matrix to be derestricted.
+// \return Reference to the matrix without access restrictions.
+//
+// This function returns a reference to the adapted dense matrix of the given symmetric matrix
+// instance, which gives unrestricted access to the elements of the matrix. This allows to
+// update a matrix with compact storage (as for instance a PackedMatrix) in place.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in the violation of invariants, erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the adapted matrix
+        , bool SO >    // Storage order of the adapted matrix
+inline MT& derestrict( SymmetricMatrix<MT,SO,true,true>& m )
+{
+   return m.matrix_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Predict invariant violations by the assignment of a matrix to a symmetric matrix.
@@ -686,7 +711,7 @@ struct IsRestricted< SymmetricMatrix<MT,SO,DF,NF> >
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO, bool NF >
 struct HasConstDataAccess< SymmetricMatrix<MT,SO,true,NF> >
-   : public TrueType
+   : public HasConstDataAccess<MT>
 {};
 /*! \endcond */
 //*************************************************************************************************
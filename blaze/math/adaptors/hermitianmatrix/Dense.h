@@ -935,6 +935,9 @@ class HermitianMatrix<MT,SO,true>
 
    template< InversionFlag IF, typename MT2, bool SO2 >
    friend void invert( HermitianMatrix<MT2,SO2,true>& m );
+
+   template< typename MT2, bool SO2 >
+   friend MT2& derestrict( HermitianMatrix<MT2,SO2,true>& m );
    //**********************************************************************************************
 
    //**Compile time checks*************************************************************************
@@ -918,6 +918,9 @@ class SymmetricMatrix<MT,SO,true,true>
 
    template< InversionFlag IF, typename MT2, bool SO2 >
    friend void invert( SymmetricMatrix<MT2,SO2,true,true>& m );
+
+   template< typename MT2, bool SO2 >
+   friend MT2& derestrict( SymmetricMatrix<MT2,SO2,true,true>& m );
    //**********************************************************************************************
 
    //**Compile time checks*************************************************************************
@@ -0,0 +1,146 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/blas/hpmv.h
+//  \brief Header file for BLAS packed Hermitian matrix/vector multiplication functions (hpmv)
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_BLAS_HPMV_H_
+#define _BLAZE_MATH_BLAS_HPMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/BLAS.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLAS WRAPPER FUNCTIONS (HPMV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BLAS wrapper functions (hpmv) */
+//@{
+#if BLAZE_BLAS_MODE
+
+BLAZE_ALWAYS_INLINE void hpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, int n, complex<float> alpha,
+                               const complex<float>* A, const complex<float>* x, int incX,
+                               complex<float> beta, complex<float>* y, int incY );
+
+BLAZE_ALWAYS_INLINE void hpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, int n, complex<double> alpha,
+                               const complex<double>* A, const complex<double>* x, int incX,
+                               complex<double> beta, complex<double>* y, int incY );
+
+#endif
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a packed Hermitian dense matrix/dense vector multiplication for single precision complex
+//        operands (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of matrix \a A (\a CblasRowMajor or \a CblasColMajor).
+// \param uplo \a CblasLower if \a A stores the lower triangle, \a CblasUpper if it stores the upper triangle.
+// \param n The number of rows/columns of matrix \a A \f$[0..\infty)\f$.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the packed matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param incX The stride within vector \a x.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of vector \a y.
+// \param incY The stride within vector \a y.
+// \return void
+//
+// This function performs the multiplication of a single precision complex Hermitian matrix in packed
+// storage format by a vector based on the cblas_chpmv() function.
+*/
+BLAZE_ALWAYS_INLINE void hpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, int n, complex<float> alpha,
+                               const complex<float>* A, const complex<float>* x, int incX,
+                               complex<float> beta, complex<float>* y, int incY )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+   cblas_chpmv( order, uplo, n, reinterpret_cast<const float*>( &alpha ),
+                reinterpret_cast<const float*>( A ), reinterpret_cast<const float*>( x ), incX,
+                reinterpret_cast<const float*>( &beta ), reinterpret_cast<float*>( y ), incY );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a packed Hermitian dense matrix/dense vector multiplication for double precision complex
+//        operands (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of matrix \a A (\a CblasRowMajor or \a CblasColMajor).
+// \param uplo \a CblasLower if \a A stores the lower triangle, \a CblasUpper if it stores the upper triangle.
+// \param n The number of rows/columns of matrix \a A \f$[0..\infty)\f$.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the packed matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param incX The stride within vector \a x.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of vector \a y.
+// \param incY The stride within vector \a y.
+// \return void
+//
+// This function performs the multiplication of a double precision complex Hermitian matrix in packed
+// storage format by a vector based on the cblas_zhpmv() function.
+*/
+BLAZE_ALWAYS_INLINE void hpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, int n, complex<double> alpha,
+                               const complex<double>* A, const complex<double>* x, int incX,
+                               complex<double> beta, complex<double>* y, int incY )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+   cblas_zhpmv( order, uplo, n, reinterpret_cast<const double*>( &alpha ),
+                reinterpret_cast<const double*>( A ), reinterpret_cast<const double*>( x ), incX,
+                reinterpret_cast<const double*>( &beta ), reinterpret_cast<double*>( y ), incY );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,198 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/blas/tpmv.h
+//  \brief Header file for BLAS packed triangular matrix/vector multiplication functions (tpmv)
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_BLAS_TPMV_H_
+#define _BLAZE_MATH_BLAS_TPMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/BLAS.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLAS WRAPPER FUNCTIONS (TPMV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BLAS wrapper functions (tpmv) */
+//@{
+#if BLAZE_BLAS_MODE
+
+BLAZE_ALWAYS_INLINE void tpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA,
+                               CBLAS_DIAG diag, int n, const float* A, float* x, int incX );
+
+BLAZE_ALWAYS_INLINE void tpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA,
+                               CBLAS_DIAG diag, int n, const double* A, double* x, int incX );
+
+BLAZE_ALWAYS_INLINE void tpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA,
+                               CBLAS_DIAG diag, int n, const complex<float>* A, complex<float>* x, int incX );
+
+BLAZE_ALWAYS_INLINE void tpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA,
+                               CBLAS_DIAG diag, int n, const complex<double>* A, complex<double>* x, int incX );
+
+#endif
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a packed triangular dense matrix/dense vector multiplication for
+//        single precision operands (\f$ \vec{x}=A*\vec{x} \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of matrix \a A (\a CblasRowMajor or \a CblasColMajor).
+// \param uplo \a CblasLower if \a A is lower triangular, \a CblasUpper if \a A is upper triangular.
+// \param transA Specifies whether to transpose matrix \a A (\a CblasNoTrans or \a CblasTrans).
+// \param diag Specifies whether \a A is unitriangular (\a CblasNonUnit or \a CblasUnit).
+// \param n The number of rows/columns of matrix \a A \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the packed matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param incX The stride within vector \a x.
+// \return void
+//
+// This function performs the multiplication of a single precision triangular matrix in packed
+// storage format by a vector based on the cblas_stpmv() function.
+*/
+BLAZE_ALWAYS_INLINE void tpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA,
+                               CBLAS_DIAG diag, int n, const float* A, float* x, int incX )
+{
+   cblas_stpmv( order, uplo, transA, diag, n, A, x, incX );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a packed triangular dense matrix/dense vector multiplication for
+//        double precision operands (\f$ \vec{x}=A*\vec{x} \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of matrix \a A (\a CblasRowMajor or \a CblasColMajor).
+// \param uplo \a CblasLower if \a A is lower triangular, \a CblasUpper if \a A is upper triangular.
+// \param transA Specifies whether to transpose matrix \a A (\a CblasNoTrans or \a CblasTrans).
+// \param diag Specifies whether \a A is unitriangular (\a CblasNonUnit or \a CblasUnit).
+// \param n The number of rows/columns of matrix \a A \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the packed matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param incX The stride within vector \a x.
+// \return void
+//
+// This function performs the multiplication of a double precision triangular matrix in packed
+// storage format by a vector based on the cblas_dtpmv() function.
+*/
+BLAZE_ALWAYS_INLINE void tpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA,
+                               CBLAS_DIAG diag, int n, const double* A, double* x, int incX )
+{
+   cblas_dtpmv( order, uplo, transA, diag, n, A, x, incX );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a packed triangular dense matrix/dense vector multiplication for
+//        single precision complex operands (\f$ \vec{x}=A*\vec{x} \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of matrix \a A (\a CblasRowMajor or \a CblasColMajor).
+// \param uplo \a CblasLower if \a A is lower triangular, \a CblasUpper if \a A is upper triangular.
+// \param transA Specifies whether to transpose matrix \a A (\a CblasNoTrans or \a CblasTrans).
+// \param diag Specifies whether \a A is unitriangular (\a CblasNonUnit or \a CblasUnit).
+// \param n The number of rows/columns of matrix \a A \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the packed matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param incX The stride within vector \a x.
+// \return void
+//
+// This function performs the multiplication of a single precision complex triangular matrix in packed
+// storage format by a vector based on the cblas_ctpmv() function.
+*/
+BLAZE_ALWAYS_INLINE void tpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA,
+                               CBLAS_DIAG diag, int n, const complex<float>* A, complex<float>* x, int incX )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+   cblas_ctpmv( order, uplo, transA, diag, n, reinterpret_cast<const float*>( A ),
+                reinterpret_cast<float*>( x ), incX );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a packed triangular dense matrix/dense vector multiplication for
+//        double precision complex operands (\f$ \vec{x}=A*\vec{x} \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of matrix \a A (\a CblasRowMajor or \a CblasColMajor).
+// \param uplo \a CblasLower if \a A is lower triangular, \a CblasUpper if \a A is upper triangular.
+// \param transA Specifies whether to transpose matrix \a A (\a CblasNoTrans or \a CblasTrans).
+// \param diag Specifies whether \a A is unitriangular (\a CblasNonUnit or \a CblasUnit).
+// \param n The number of rows/columns of matrix \a A \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the packed matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param incX The stride within vector \a x.
+// \return void
+//
+// This function performs the multiplication of a double precision complex triangular matrix in packed
+// storage format by a vector based on the cblas_ztpmv() function.
+*/
+BLAZE_ALWAYS_INLINE void tpmv( CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA,
+                               CBLAS_DIAG diag, int n, const complex<double>* A, complex<double>* x, int incX )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+   cblas_ztpmv( order, uplo, transA, diag, n, reinterpret_cast<const double*>( A ),
+                reinterpret_cast<double*>( x ), incX );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
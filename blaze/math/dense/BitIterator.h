@@ -0,0 +1,479 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BitIterator.h
+//  \brief Header file for the BitIterator and BitReference class templates
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BITITERATOR_H_
+#define _BLAZE_MATH_DENSE_BITITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/dense/BitKernels.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/mpl/If.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BITREFERENCE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Proxy class for a single bit of a bit-packed data structure.
+// \ingroup dense
+//
+// The BitReference class represents a single, modifiable bit within a bit-packed data structure
+// (as for instance BitVector or BitMatrix). It can be used like a \c bool lvalue:
+
+   \code
+   blaze::BitVector<> a( 100UL );
+
+   a[5] = true;    // Setting bit 5
+   a[7] |= a[5];   // Bitwise OR assignment of bit 5 to bit 7
+   a[5].flip();    // Flipping bit 5
+   \endcode
+*/
+class BitReference
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\brief Constructor for the BitReference class.
+   //
+   // \param word Pointer to the word containing the referenced bit.
+   // \param bit The index of the referenced bit within the word \f$[0..63]\f$.
+   */
+   inline BitReference( uint64_t* word, size_t bit ) noexcept
+      : word_( word )                // Pointer to the word containing the bit
+      , mask_( uint64_t(1) << bit )  // Mask of the bit within the word
+   {}
+
+   BitReference( const BitReference& ) = default;
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\brief Assignment of a boolean value to the referenced bit.
+   //
+   // \param value The new value of the bit.
+   // \return Reference to the assigned proxy.
+   */
+   inline BitReference& operator=( bool value ) noexcept {
+      if( value ) *word_ |=  mask_;
+      else        *word_ &= ~mask_;
+      return *this;
+   }
+
+   /*!\brief Assignment of the value of another bit to the referenced bit.
+   //
+   // \param ref The bit to be copied.
+   // \return Reference to the assigned proxy.
+   */
+   inline BitReference& operator=( const BitReference& ref ) noexcept {
+      return operator=( static_cast<bool>( ref ) );
+   }
+
+   /*!\brief Bitwise AND assignment to the referenced bit.
+   //
+   // \param value The right-hand side value.
+   // \return Reference to the assigned proxy.
+   */
+   inline BitReference& operator&=( bool value ) noexcept {
+      if( !value ) *word_ &= ~mask_;
+      return *this;
+   }
+
+   /*!\brief Bitwise OR assignment to the referenced bit.
+   //
+   // \param value The right-hand side value.
+   // \return Reference to the assigned proxy.
+   */
+   inline BitReference& operator|=( bool value ) noexcept {
+      if( value ) *word_ |= mask_;
+      return *this;
+   }
+
+   /*!\brief Bitwise XOR assignment to the referenced bit.
+   //
+   // \param value The right-hand side value.
+   // \return Reference to the assigned proxy.
+   */
+   inline BitReference& operator^=( bool value ) noexcept {
+      if( value ) *word_ ^= mask_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Flipping the referenced bit.
+   //
+   // \return Reference to the flipped proxy.
+   */
+   inline BitReference& flip() noexcept {
+      *word_ ^= mask_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the value of the referenced bit.
+   //
+   // \return The current value of the bit.
+   */
+   inline operator bool() const noexcept {
+      return ( *word_ & mask_ ) != uint64_t(0);
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   uint64_t* word_;  //!< Pointer to the word containing the referenced bit.
+   uint64_t  mask_;  //!< Mask of the referenced bit within the word.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the bit referenced by the given BitReference is in default state.
+// \ingroup dense
+//
+// \param ref The BitReference to be tested for its default state.
+// \return \a true in case the referenced bit is not set, \a false otherwise.
+*/
+template< bool RF >  // Relaxation flag
+inline bool isDefault( const BitReference& ref ) noexcept
+{
+   return !ref;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS BITITERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Random access iterator over the bits of a bit-packed data structure.
+// \ingroup dense
+//
+// The BitIterator class template represents a random access iterator over a contiguous range
+// of bits. The template argument \a Const specifies whether the iterator provides read-only
+// access (\a true) or whether the bits can be modified via BitReference proxies (\a false).
+*/
+template< bool Const >  // Read-only flag
+class BitIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of the underlying words.
+   using WordType = If_t< Const, const uint64_t, uint64_t >;
+
+   using IteratorCategory = std::random_access_iterator_tag;    //!< The iterator category.
+   using ValueType        = bool;                               //!< Type of the underlying elements.
+   using PointerType      = void;                               //!< Pointer return type.
+   using ReferenceType    = If_t< Const, bool, BitReference >;  //!< Reference return type.
+   using DifferenceType   = ptrdiff_t;                          //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Default constructor for the BitIterator class.
+   */
+   inline constexpr BitIterator() noexcept
+      : words_( nullptr )  // Pointer to the first word of the range
+      , index_( 0UL )      // Index of the current bit
+   {}
+
+   /*!\brief Constructor for the BitIterator class.
+   //
+   // \param words Pointer to the first word of the range.
+   // \param index Index of the initial bit.
+   */
+   inline constexpr BitIterator( WordType* words, size_t index ) noexcept
+      : words_( words )  // Pointer to the first word of the range
+      , index_( index )  // Index of the current bit
+   {}
+
+   /*!\brief Conversion constructor from a modifiable BitIterator.
+   //
+   // \param it The iterator to be copied.
+   */
+   template< bool C2, typename = EnableIf_t< Const && !C2 > >
+   inline constexpr BitIterator( const BitIterator<C2>& it ) noexcept
+      : words_( it.words() )  // Pointer to the first word of the range
+      , index_( it.index() )  // Index of the current bit
+   {}
+
+   BitIterator( const BitIterator& ) = default;
+   BitIterator& operator=( const BitIterator& ) = default;
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return Reference to the incremented iterator.
+   */
+   inline constexpr BitIterator& operator+=( ptrdiff_t inc ) noexcept {
+      index_ += inc;
+      return *this;
+   }
+
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return Reference to the decremented iterator.
+   */
+   inline constexpr BitIterator& operator-=( ptrdiff_t dec ) noexcept {
+      index_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline constexpr BitIterator& operator++() noexcept {
+      ++index_;
+      return *this;
+   }
+
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline constexpr const BitIterator operator++( int ) noexcept {
+      return BitIterator( words_, index_++ );
+   }
+
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline constexpr BitIterator& operator--() noexcept {
+      --index_;
+      return *this;
+   }
+
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline constexpr const BitIterator operator--( int ) noexcept {
+      return BitIterator( words_, index_-- );
+   }
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\brief Direct access to the bit at the current iterator position.
+   //
+   // \return The current bit (as value in case of a read-only iterator, as proxy otherwise).
+   */
+   inline ReferenceType operator*() const noexcept {
+      return access( index_ );
+   }
+
+   /*!\brief Direct access to a bit relative to the current iterator position.
+   //
+   // \param index Offset of the accessed bit.
+   // \return The accessed bit (as value in case of a read-only iterator, as proxy otherwise).
+   */
+   inline ReferenceType operator[]( size_t index ) const noexcept {
+      return access( index_ + index );
+   }
+   //**********************************************************************************************
+
+   //**Comparison operators************************************************************************
+   /*!\brief Equality comparison between two BitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same bit, \a false if not.
+   */
+   inline constexpr bool operator==( const BitIterator& rhs ) const noexcept {
+      return index_ == rhs.index_ && words_ == rhs.words_;
+   }
+
+   /*!\brief Inequality comparison between two BitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same bit, \a false if they do.
+   */
+   inline constexpr bool operator!=( const BitIterator& rhs ) const noexcept {
+      return !( *this == rhs );
+   }
+
+   /*!\brief Less-than comparison between two BitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   inline constexpr bool operator<( const BitIterator& rhs ) const noexcept {
+      return index_ < rhs.index_;
+   }
+
+   /*!\brief Greater-than comparison between two BitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   inline constexpr bool operator>( const BitIterator& rhs ) const noexcept {
+      return index_ > rhs.index_;
+   }
+
+   /*!\brief Less-or-equal-than comparison between two BitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   inline constexpr bool operator<=( const BitIterator& rhs ) const noexcept {
+      return index_ <= rhs.index_;
+   }
+
+   /*!\brief Greater-or-equal-than comparison between two BitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   inline constexpr bool operator>=( const BitIterator& rhs ) const noexcept {
+      return index_ >= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Arithmetic operators************************************************************************
+   /*!\brief Addition between a BitIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline constexpr const BitIterator operator+( const BitIterator& it, ptrdiff_t inc ) noexcept {
+      return BitIterator( it.words_, it.index_ + inc );
+   }
+
+   /*!\brief Addition between an integral value and a BitIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline constexpr const BitIterator operator+( ptrdiff_t inc, const BitIterator& it ) noexcept {
+      return BitIterator( it.words_, it.index_ + inc );
+   }
+
+   /*!\brief Subtraction between a BitIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline constexpr const BitIterator operator-( const BitIterator& it, ptrdiff_t dec ) noexcept {
+      return BitIterator( it.words_, it.index_ - dec );
+   }
+
+   /*!\brief Calculating the number of elements between two BitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   inline constexpr DifferenceType operator-( const BitIterator& rhs ) const noexcept {
+      return static_cast<DifferenceType>( index_ ) - static_cast<DifferenceType>( rhs.index_ );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Access to the underlying range of words.
+   //
+   // \return Pointer to the first word of the range.
+   */
+   inline constexpr WordType* words() const noexcept {
+      return words_;
+   }
+
+   /*!\brief Access to the index of the current bit.
+   //
+   // \return The index of the current bit.
+   */
+   inline constexpr size_t index() const noexcept {
+      return index_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Access function*****************************************************************************
+   /*!\brief Access to the bit with the given index.
+   //
+   // \param index The index of the accessed bit.
+   // \return The accessed bit.
+   */
+   inline ReferenceType access( size_t index ) const noexcept {
+      return access( index, BoolConstant<Const>() );
+   }
+
+   inline bool access( size_t index, TrueType ) const noexcept {
+      return ( words_[index/BITS_PER_WORD] >> ( index%BITS_PER_WORD ) ) & uint64_t(1);
+   }
+
+   inline BitReference access( size_t index, FalseType ) const noexcept {
+      return BitReference( words_ + index/BITS_PER_WORD, index%BITS_PER_WORD );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   WordType* words_;  //!< Pointer to the first word of the range.
+   size_t    index_;  //!< Index of the current bit.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,283 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BitKernels.h
+//  \brief Header file for the word-parallel kernels of the bit-packed data structures
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BITKERNELS_H_
+#define _BLAZE_MATH_DENSE_BITKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Bits.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  WORD-PARALLEL KERNELS FOR BIT-PACKED DATA STRUCTURES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The number of bits stored in a single word of a bit-packed data structure.
+// \ingroup dense
+*/
+constexpr size_t BITS_PER_WORD = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of 64-bit words required to store the given number of bits.
+// \ingroup dense
+//
+// \param bits The number of bits.
+// \return The number of required words.
+*/
+BLAZE_ALWAYS_INLINE constexpr size_t bitWords( size_t bits ) noexcept
+{
+   return ( bits + BITS_PER_WORD - 1UL ) / BITS_PER_WORD;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the padded number of 64-bit words required to store the given number of bits.
+// \ingroup dense
+//
+// \param bits The number of bits.
+// \return The number of words rounded up to a multiple of the SIMD width.
+//
+// The padding guarantees that every range of words can be processed by means of aligned SIMD
+// loads and stores without a scalar remainder loop.
+*/
+BLAZE_ALWAYS_INLINE constexpr size_t paddedBitWords( size_t bits ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<uint64_t>::size );
+   return ( ( bitWords( bits ) + SIMDSIZE - 1UL ) / SIMDSIZE ) * SIMDSIZE;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a mask for the valid bits of the last word of a range of the given size.
+// \ingroup dense
+//
+// \param bits The total number of bits of the range.
+// \return The mask for the valid bits of the final word.
+*/
+BLAZE_ALWAYS_INLINE constexpr uint64_t tailMask( size_t bits ) noexcept
+{
+   return ( bits % BITS_PER_WORD == 0UL )
+          ?( ~uint64_t(0) )
+          :( ( uint64_t(1) << ( bits % BITS_PER_WORD ) ) - uint64_t(1) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default word-wise assignment kernel for bit-packed data (\f$ lhs = lhs \odot rhs \f$).
+// \ingroup dense
+//
+// \param lhs Pointer to the first word of the left-hand side range.
+// \param rhs Pointer to the first word of the right-hand side range.
+// \param n The number of words of both ranges.
+// \param op The bitwise operation (Bitand, Bitor, or Bitxor).
+// \return void
+*/
+template< typename OP >  // Type of the bitwise operation
+inline auto wordwiseAssign( uint64_t* lhs, const uint64_t* rhs, size_t n, OP op ) noexcept
+   -> DisableIf_t< OP::template simdEnabled<uint64_t,uint64_t>() >
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      lhs[i] = op( lhs[i], rhs[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD-optimized word-wise assignment kernel for bit-packed data (\f$ lhs = lhs \odot rhs \f$).
+// \ingroup dense
+//
+// \param lhs Pointer to the first word of the left-hand side range.
+// \param rhs Pointer to the first word of the right-hand side range.
+// \param n The number of words of both ranges.
+// \param op The bitwise operation (Bitand, Bitor, or Bitxor).
+// \return void
+//
+// This kernel requires both ranges to be properly aligned and \a n to be a multiple of the
+// SIMD width, which is guaranteed by the padding of all bit-packed data structures.
+*/
+template< typename OP >  // Type of the bitwise operation
+inline auto wordwiseAssign( uint64_t* lhs, const uint64_t* rhs, size_t n, OP op ) noexcept
+   -> EnableIf_t< OP::template simdEnabled<uint64_t,uint64_t>() >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<uint64_t>::size );
+
+   BLAZE_INTERNAL_ASSERT( n % SIMDSIZE == 0UL, "Invalid number of words detected" );
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*3UL) < n; i+=SIMDSIZE*4UL ) {
+      storea( lhs+i             , op.load( loada( lhs+i              ), loada( rhs+i              ) ) );
+      storea( lhs+i+SIMDSIZE    , op.load( loada( lhs+i+SIMDSIZE     ), loada( rhs+i+SIMDSIZE     ) ) );
+      storea( lhs+i+SIMDSIZE*2UL, op.load( loada( lhs+i+SIMDSIZE*2UL ), loada( rhs+i+SIMDSIZE*2UL ) ) );
+      storea( lhs+i+SIMDSIZE*3UL, op.load( loada( lhs+i+SIMDSIZE*3UL ), loada( rhs+i+SIMDSIZE*3UL ) ) );
+   }
+   for( ; i<n; i+=SIMDSIZE ) {
+      storea( lhs+i, op.load( loada( lhs+i ), loada( rhs+i ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Word-wise negation kernel for bit-packed data (\f$ lhs = \sim lhs \f$).
+// \ingroup dense
+//
+// \param lhs Pointer to the first word of the range.
+// \param bits The number of valid bits of the range.
+// \return void
+//
+// This kernel flips all valid bits of the given range. All padding bits beyond the given
+// number of valid bits remain zero.
+*/
+inline void wordwiseNegate( uint64_t* lhs, size_t bits ) noexcept
+{
+   const size_t n( bitWords( bits ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      lhs[i] = ~lhs[i];
+   }
+
+   if( n > 0UL ) {
+      lhs[n-1UL] &= tailMask( bits );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of common set bits of two ranges of words (\f$ |a \wedge b| \f$).
+// \ingroup dense
+//
+// \param a Pointer to the first word of the left-hand side range.
+// \param b Pointer to the first word of the right-hand side range.
+// \param n The number of words of both ranges.
+// \return The number of bits that are set in both ranges.
+*/
+inline size_t popcountAnd( const uint64_t* a, const uint64_t* b, size_t n ) noexcept
+{
+   const size_t ipos( n & size_t(-4) );
+
+   size_t c1( 0UL ), c2( 0UL ), c3( 0UL ), c4( 0UL );
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=4UL ) {
+      c1 += popcount( a[i    ] & b[i    ] );
+      c2 += popcount( a[i+1UL] & b[i+1UL] );
+      c3 += popcount( a[i+2UL] & b[i+2UL] );
+      c4 += popcount( a[i+3UL] & b[i+3UL] );
+   }
+   for( ; i<n; ++i ) {
+      c1 += popcount( a[i] & b[i] );
+   }
+
+   return c1 + c2 + c3 + c4;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Accumulates the elements of a dense vector selected by the set bits of a range of words.
+// \ingroup dense
+//
+// \param words Pointer to the first word of the range.
+// \param bits The number of valid bits of the range.
+// \param v The dense vector whose selected elements are accumulated.
+// \return The sum of all elements \f$ v_i \f$ for which bit \f$ i \f$ is set.
+//
+// This kernel scans the set bits of the given range word by word. Words without any set bit
+// are skipped, the set bits of all other words are visited via a count-trailing-zeros scan.
+*/
+template< typename VT >  // Type of the dense vector
+inline auto maskedSum( const uint64_t* words, size_t bits, const VT& v )
+{
+   using ET = RemoveCVRef_t< decltype( v[0UL] ) >;
+
+   ET sum{};
+   const size_t n( bitWords( bits ) );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      uint64_t word( words[k] );
+      while( word ) {
+         sum += v[k*BITS_PER_WORD + ctz( word )];
+         word &= word - uint64_t(1);
+      }
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1889 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BitMatrix.h
+//  \brief Header file for the implementation of a bit-packed dense matrix
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BITMATRIX_H_
+#define _BLAZE_MATH_DENSE_BITMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/BitIterator.h>
+#include <blaze/math/dense/BitKernels.h>
+#include <blaze/math/dense/BitVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/functors/Bitand.h>
+#include <blaze/math/functors/Bitor.h>
+#include <blaze/math/functors/Bitxor.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Bits.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup bit_matrix BitMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a bit-packed, arbitrary sized boolean matrix.
+// \ingroup bit_matrix
+//
+// The BitMatrix class template is the representation of an arbitrary sized matrix of boolean
+// values, which stores every element in a single bit. The storage order of the matrix can be
+// specified via the template parameter:
+
+   \code
+   template< bool SO >
+   class BitMatrix;
+   \endcode
+
+//  - SO: specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//        The default value is blaze::rowMajor.
+//
+// Depending on the storage order, each row (in case of a row-major matrix) or each column (in
+// case of a column-major matrix) is stored in a separate, SIMD-aligned range of 64-bit words.
+// In comparison to a \c DynamicMatrix<bool> the memory requirement is reduced by a factor of 8,
+// in comparison to a \c CompressedMatrix<bool> by up to a factor of 72. All bitwise operations
+// between two bit matrices are performed word-parallel via SIMD operations, all reductions are
+// based on the hardware population count. The multiplication with a real-valued dense vector
+// only visits the set bits of the matrix:
+
+   \code
+   using blaze::BitMatrix;
+   using blaze::DynamicVector;
+
+   BitMatrix<> A( 1000UL, 1000UL ), B( 1000UL, 1000UL );
+   A.set( 2UL, 3UL );
+   B.set( 2UL, 3UL );
+   B.set( 4UL, 5UL );
+
+   BitMatrix<> C = A | B;        // Word-parallel bitwise OR
+   C &= B;                       // Word-parallel bitwise AND assignment
+   const size_t n = C.count();   // Population count (results in 2)
+
+   DynamicVector<double> x( 1000UL, 1.0 );
+   DynamicVector<double> y = C * x;  // Sparse-pattern matrix/vector multiplication
+   \endcode
+*/
+template< bool SO = defaultStorageOrder >  // Storage order
+class BitMatrix
+   : public Expression< DenseMatrix< BitMatrix<SO>, SO > >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = BitMatrix<SO>;          //!< Type of this BitMatrix instance.
+   using BaseType      = DenseMatrix<This,SO>;   //!< Base type of this BitMatrix instance.
+   using ResultType    = This;                   //!< Result type for expression template evaluations.
+   using OppositeType  = BitMatrix<!SO>;         //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = BitMatrix<!SO>;         //!< Transpose type for expression template evaluations.
+   using ElementType   = bool;                   //!< Type of the matrix elements.
+   using ReturnType    = bool;                   //!< Return type for expression template evaluations.
+   using CompositeType = const This&;            //!< Data type for composite expression templates.
+
+   using Reference      = BitReference;  //!< Reference to a non-constant matrix value.
+   using ConstReference = bool;          //!< Reference to a constant matrix value.
+
+   using Iterator      = BitIterator<false>;  //!< Iterator over non-constant elements.
+   using ConstIterator = BitIterator<true>;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a dense matrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = DynamicMatrix<NewType,SO>;  //!< The type of the other matrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a BitMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = BitMatrix<SO>;  //!< The type of the other BitMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the elements of a bit matrix are not
+       individually addressable, the flag is set to \a false. Note however that all bitwise
+       operations between two bit matrices are vectorized on word level. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since neighboring elements share a common word, the flag is set to
+       \a false. */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BitMatrix() noexcept;
+   explicit inline BitMatrix( size_t m, size_t n );
+   explicit inline BitMatrix( size_t m, size_t n, bool init );
+
+   inline BitMatrix( const BitMatrix& m );
+   inline BitMatrix( BitMatrix&& m ) noexcept;
+
+   template< typename MT, bool SO2 >
+   inline BitMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BitMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference       operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference  operator()( size_t i, size_t j ) const noexcept;
+   inline Reference       at( size_t i, size_t j );
+   inline ConstReference  at( size_t i, size_t j ) const;
+   inline uint64_t*       words() noexcept;
+   inline const uint64_t* words() const noexcept;
+   inline uint64_t*       words( size_t i ) noexcept;
+   inline const uint64_t* words( size_t i ) const noexcept;
+   inline Iterator        begin ( size_t i ) noexcept;
+   inline ConstIterator   begin ( size_t i ) const noexcept;
+   inline ConstIterator   cbegin( size_t i ) const noexcept;
+   inline Iterator        end   ( size_t i ) noexcept;
+   inline ConstIterator   end   ( size_t i ) const noexcept;
+   inline ConstIterator   cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BitMatrix& operator=( bool rhs ) noexcept;
+   inline BitMatrix& operator=( const BitMatrix& rhs );
+   inline BitMatrix& operator=( BitMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline BitMatrix& operator=( const Matrix<MT,SO2>& rhs );
+
+   inline BitMatrix& operator&=( const BitMatrix& rhs );
+   inline BitMatrix& operator|=( const BitMatrix& rhs );
+   inline BitMatrix& operator^=( const BitMatrix& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset() noexcept;
+   inline void   reset( size_t i ) noexcept;
+   inline void   clear() noexcept;
+   inline void   resize( size_t m, size_t n, bool preserve=true );
+   inline void   swap( BitMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Bit functions*******************************************************************************
+   /*!\name Bit functions */
+   //@{
+   inline BitMatrix& set  ( size_t i, size_t j ) noexcept;
+   inline BitMatrix& set  () noexcept;
+   inline BitMatrix& unset( size_t i, size_t j ) noexcept;
+   inline BitMatrix& flip ( size_t i, size_t j ) noexcept;
+   inline BitMatrix& flip () noexcept;
+   inline bool       test ( size_t i, size_t j ) const noexcept;
+   inline size_t     count() const noexcept;
+   inline bool       any  () const noexcept;
+   inline bool       all  () const noexcept;
+   inline bool       none () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void assign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t majorSize() const noexcept;
+   inline size_t minorSize() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t    m_;         //!< The current number of rows of the matrix.
+   size_t    n_;         //!< The current number of columns of the matrix.
+   size_t    nn_;        //!< The number of words per row (row-major) or column (column-major).
+   size_t    capacity_;  //!< The maximum capacity of the matrix in words.
+   uint64_t* v_;         //!< The bit-packed matrix elements.
+                         /*!< Access to the matrix elements is gained via the function call
+                              operator. Each row (row-major) or column (column-major) occupies
+                              \a nn_ consecutive words. All bits beyond the current number of
+                              columns of a row (or rows of a column) are guaranteed to be zero. */
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BitMatrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>::BitMatrix() noexcept
+   : m_       ( 0UL )      // The current number of rows of the matrix
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , nn_      ( 0UL )      // The number of words per row/column
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The bit-packed matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$. All bits are initialized to \a false.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>::BitMatrix( size_t m, size_t n )
+   : m_       ( m )                                // The current number of rows of the matrix
+   , n_       ( n )                                // The current number of columns of the matrix
+   , nn_      ( paddedBitWords( SO ? m : n ) )     // The number of words per row/column
+   , capacity_( nn_ * ( SO ? n : m ) )             // The maximum capacity of the matrix
+   , v_       ( allocate<uint64_t>( capacity_ ) )  // The bit-packed matrix elements
+{
+   std::fill( v_, v_+capacity_, uint64_t(0) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all \f$ m \times n \f$ bits.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the matrix elements.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>::BitMatrix( size_t m, size_t n, bool init )
+   : BitMatrix( m, n )
+{
+   if( init ) {
+      set();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BitMatrix.
+//
+// \param m Bit matrix to be copied.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>::BitMatrix( const BitMatrix& m )
+   : BitMatrix( m.m_, m.n_ )
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BitMatrix.
+//
+// \param m The bit matrix to be moved into this instance.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>::BitMatrix( BitMatrix&& m ) noexcept
+   : m_       ( m.m_        )  // The current number of rows of the matrix
+   , n_       ( m.n_        )  // The current number of columns of the matrix
+   , nn_      ( m.nn_       )  // The number of words per row/column
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_        )  // The bit-packed matrix elements
+{
+   m.m_        = 0UL;
+   m.n_        = 0UL;
+   m.nn_       = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+//
+// All non-default elements of the given matrix are represented by set bits.
+*/
+template< bool SO >     // Storage order
+template< typename MT   // Type of the foreign matrix
+        , bool SO2 >    // Storage order of the foreign matrix
+inline BitMatrix<SO>::BitMatrix( const Matrix<MT,SO2>& m )
+   : BitMatrix( (~m).rows(), (~m).columns() )
+{
+   blaze::assign( *this, ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BitMatrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>::~BitMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed bit.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::Reference
+   BitMatrix<SO>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   const size_t k( SO ? i : j );
+   return Reference( words( SO ? j : i ) + k/BITS_PER_WORD, k%BITS_PER_WORD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed bit.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::ConstReference
+   BitMatrix<SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   return test( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed bit.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::Reference
+   BitMatrix<SO>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed bit.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::ConstReference
+   BitMatrix<SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the bit-packed matrix elements.
+//
+// \return Pointer to the first word of the bit matrix.
+*/
+template< bool SO >  // Storage order
+inline uint64_t* BitMatrix<SO>::words() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the bit-packed matrix elements.
+//
+// \return Pointer to the first word of the bit matrix.
+*/
+template< bool SO >  // Storage order
+inline const uint64_t* BitMatrix<SO>::words() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the bit-packed elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first word of row/column \a i.
+//
+// This function returns a pointer to the first word of row \a i in case of a row-major matrix
+// and to the first word of column \a i in case of a column-major matrix. Each row/column is
+// stored in spacing()/64 consecutive, SIMD-aligned words.
+*/
+template< bool SO >  // Storage order
+inline uint64_t* BitMatrix<SO>::words( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   return v_ + i*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the bit-packed elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first word of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline const uint64_t* BitMatrix<SO>::words( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   return v_ + i*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::Iterator BitMatrix<SO>::begin( size_t i ) noexcept
+{
+   return Iterator( words( i ), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::ConstIterator BitMatrix<SO>::begin( size_t i ) const noexcept
+{
+   return ConstIterator( words( i ), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::ConstIterator BitMatrix<SO>::cbegin( size_t i ) const noexcept
+{
+   return ConstIterator( words( i ), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::Iterator BitMatrix<SO>::end( size_t i ) noexcept
+{
+   return Iterator( words( i ), minorSize() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::ConstIterator BitMatrix<SO>::end( size_t i ) const noexcept
+{
+   return ConstIterator( words( i ), minorSize() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename BitMatrix<SO>::ConstIterator BitMatrix<SO>::cend( size_t i ) const noexcept
+{
+   return ConstIterator( words( i ), minorSize() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogeneous assignment to all matrix elements.
+//
+// \param rhs Boolean value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::operator=( bool rhs ) noexcept
+{
+   if( rhs ) set();
+   else reset();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BitMatrix.
+//
+// \param rhs Bit matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::operator=( const BitMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.m_, rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+nn_*majorSize(), v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BitMatrix.
+//
+// \param rhs The bit matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::operator=( BitMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   nn_       = rhs.nn_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.nn_       = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given matrix. All non-default elements of the given
+// matrix are represented by set bits.
+*/
+template< bool SO >   // Storage order
+template< typename MT  // Type of the right-hand side matrix
+        , bool SO2 >  // Storage order of the right-hand side matrix
+inline BitMatrix<SO>& BitMatrix<SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).canAlias( this ) ) {
+      BitMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise AND assignment operator (\f$ A\&=B \f$).
+//
+// \param rhs The right-hand side bit matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The bitwise AND is performed word-parallel by means of SIMD operations.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::operator&=( const BitMatrix& rhs )
+{
+   if( rhs.m_ != m_ || rhs.n_ != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   wordwiseAssign( v_, rhs.v_, nn_*majorSize(), Bitand() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise OR assignment operator (\f$ A|=B \f$).
+//
+// \param rhs The right-hand side bit matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The bitwise OR is performed word-parallel by means of SIMD operations.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::operator|=( const BitMatrix& rhs )
+{
+   if( rhs.m_ != m_ || rhs.n_ != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   wordwiseAssign( v_, rhs.v_, nn_*majorSize(), Bitor() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise XOR assignment operator (\f$ A\hat{}=B \f$).
+//
+// \param rhs The right-hand side bit matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The bitwise XOR is performed word-parallel by means of SIMD operations.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::operator^=( const BitMatrix& rhs )
+{
+   if( rhs.m_ != m_ || rhs.n_ != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   wordwiseAssign( v_, rhs.v_, nn_*majorSize(), Bitxor() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns (in bits).
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::spacing() const noexcept
+{
+   return nn_ * BITS_PER_WORD;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix (in bits).
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::capacity() const noexcept
+{
+   return capacity_ * BITS_PER_WORD;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i (in bits).
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::capacity( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   return nn_ * BITS_PER_WORD;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of set bits in the matrix.
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::nonZeros() const noexcept
+{
+   return count();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of set bits in row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::nonZeros( size_t i ) const noexcept
+{
+   return popcount( words( i ), nn_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void BitMatrix<SO>::reset() noexcept
+{
+   std::fill( v_, v_+capacity_, uint64_t(0) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void BitMatrix<SO>::reset( size_t i ) noexcept
+{
+   std::fill( words( i ), words( i )+nn_, uint64_t(0) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< bool SO >  // Storage order
+inline void BitMatrix<SO>::clear() noexcept
+{
+   reset();
+   m_  = 0UL;
+   n_  = 0UL;
+   nn_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. In case the
+// matrix is enlarged, the new bits are initialized to \a false. In case \a preserve is
+// \a false, all bits are reset.
+*/
+template< bool SO >  // Storage order
+inline void BitMatrix<SO>::resize( size_t m, size_t n, bool preserve )
+{
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+   const size_t nn   ( paddedBitWords( minor ) );
+   const size_t nwords( nn * major );
+
+   if( m == m_ && n == n_ ) {
+      if( !preserve ) reset();
+      return;
+   }
+
+   if( preserve )
+   {
+      uint64_t* tmp( allocate<uint64_t>( nwords > capacity_ ? nwords : capacity_ ) );
+      std::fill( tmp, tmp+( nwords > capacity_ ? nwords : capacity_ ), uint64_t(0) );
+
+      const size_t kmax ( majorSize() < major ? majorSize() : major );
+      const size_t nmax ( minorSize() < minor ? minorSize() : minor );
+      const size_t wmax ( bitWords( nmax ) );
+
+      for( size_t k=0UL; k<kmax; ++k ) {
+         std::copy( v_+k*nn_, v_+k*nn_+wmax, tmp+k*nn );
+         if( wmax > 0UL ) tmp[k*nn+wmax-1UL] &= tailMask( nmax );
+      }
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = ( nwords > capacity_ ? nwords : capacity_ );
+   }
+   else if( nwords > capacity_ )
+   {
+      uint64_t* tmp( allocate<uint64_t>( nwords ) );
+      std::fill( tmp, tmp+nwords, uint64_t(0) );
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = nwords;
+   }
+   else
+   {
+      reset();
+   }
+
+   m_  = m;
+   n_  = n;
+   nn_ = nn;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void BitMatrix<SO>::swap( BitMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_ , m.m_  );
+   swap( n_ , m.n_  );
+   swap( nn_, m.nn_ );
+   swap( capacity_, m.capacity_ );
+   swap( v_ , m.v_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows/columns.
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::majorSize() const noexcept
+{
+   return SO ? n_ : m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns (row-major) or rows (column-major) of the matrix.
+//
+// \return The number of columns/rows.
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::minorSize() const noexcept
+{
+   return SO ? m_ : n_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BIT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting a single bit of the matrix.
+//
+// \param i The row index of the bit. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the bit. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::set( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   const size_t k( SO ? i : j );
+   words( SO ? j : i )[k/BITS_PER_WORD] |= uint64_t(1) << ( k%BITS_PER_WORD );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting all bits of the matrix.
+//
+// \return Reference to the matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::set() noexcept
+{
+   const size_t n( bitWords( minorSize() ) );
+
+   for( size_t i=0UL; i<majorSize(); ++i ) {
+      uint64_t* const w( words( i ) );
+      std::fill( w, w+n, ~uint64_t(0) );
+      if( n > 0UL ) w[n-1UL] &= tailMask( minorSize() );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting a single bit of the matrix.
+//
+// \param i The row index of the bit. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the bit. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::unset( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   const size_t k( SO ? i : j );
+   words( SO ? j : i )[k/BITS_PER_WORD] &= ~( uint64_t(1) << ( k%BITS_PER_WORD ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Flipping a single bit of the matrix.
+//
+// \param i The row index of the bit. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the bit. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::flip( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   const size_t k( SO ? i : j );
+   words( SO ? j : i )[k/BITS_PER_WORD] ^= uint64_t(1) << ( k%BITS_PER_WORD );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Flipping all bits of the matrix.
+//
+// \return Reference to the matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO>& BitMatrix<SO>::flip() noexcept
+{
+   for( size_t i=0UL; i<majorSize(); ++i ) {
+      wordwiseNegate( words( i ), minorSize() );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the value of a single bit of the matrix.
+//
+// \param i The row index of the bit. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the bit. The index has to be in the range \f$[0..N-1]\f$.
+// \return \a true in case the bit is set, \a false if not.
+*/
+template< bool SO >  // Storage order
+inline bool BitMatrix<SO>::test( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   const size_t k( SO ? i : j );
+   return ( words( SO ? j : i )[k/BITS_PER_WORD] >> ( k%BITS_PER_WORD ) ) & uint64_t(1);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of set bits of the matrix.
+//
+// \return The number of set bits.
+//
+// The number of set bits is computed word by word by means of the hardware population count.
+// Due to the zero padding of all rows/columns, the padding words can be included in the count.
+*/
+template< bool SO >  // Storage order
+inline size_t BitMatrix<SO>::count() const noexcept
+{
+   return popcount( v_, nn_*majorSize() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether at least one bit of the matrix is set.
+//
+// \return \a true in case at least one bit is set, \a false if not.
+*/
+template< bool SO >  // Storage order
+inline bool BitMatrix<SO>::any() const noexcept
+{
+   const size_t n( nn_*majorSize() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( v_[i] ) return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether all bits of the matrix are set.
+//
+// \return \a true in case all bits are set, \a false if not.
+*/
+template< bool SO >  // Storage order
+inline bool BitMatrix<SO>::all() const noexcept
+{
+   return count() == m_*n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether no bit of the matrix is set.
+//
+// \return \a true in case no bit is set, \a false if at least one bit is set.
+*/
+template< bool SO >  // Storage order
+inline bool BitMatrix<SO>::none() const noexcept
+{
+   return !any();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BitMatrix<SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BitMatrix<SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// Since all rows/columns of a bit matrix are padded to a multiple of the SIMD width and are
+// allocated with SIMD alignment, the function always returns \a true.
+*/
+template< bool SO >  // Storage order
+inline bool BitMatrix<SO>::isAligned() const noexcept
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// Since neighboring elements of a bit matrix share a common word, a bit matrix cannot be
+// assigned concurrently and the function always returns \a false.
+*/
+template< bool SO >  // Storage order
+inline bool BitMatrix<SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< bool SO >   // Storage order
+template< typename MT  // Type of the right-hand side dense matrix
+        , bool SO2 >  // Storage order of the right-hand side dense matrix
+inline void BitMatrix<SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t major( majorSize() );
+   const size_t minor( minorSize() );
+   const size_t n( bitWords( minor ) );
+
+   for( size_t i=0UL; i<major; ++i )
+   {
+      uint64_t* const w( words( i ) );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const size_t jbegin( k*BITS_PER_WORD );
+         const size_t jend  ( ( jbegin+BITS_PER_WORD < minor )?( jbegin+BITS_PER_WORD ):( minor ) );
+
+         uint64_t word( 0UL );
+         for( size_t j=jbegin; j<jend; ++j ) {
+            if( !isDefault( SO ? (~rhs)(j,i) : (~rhs)(i,j) ) )
+               word |= uint64_t(1) << ( j-jbegin );
+         }
+         w[k] = word;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< bool SO >   // Storage order
+template< typename MT  // Type of the right-hand side sparse matrix
+        , bool SO2 >  // Storage order of the right-hand side sparse matrix
+inline void BitMatrix<SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   reset();
+
+   const size_t kmax( SO2 ? n_ : m_ );
+
+   for( size_t k=0UL; k<kmax; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         if( !isDefault( element->value() ) ) {
+            if( SO2 ) set( element->index(), k );
+            else      set( k, element->index() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BITMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BitMatrix operators */
+//@{
+template< bool SO >
+void reset( BitMatrix<SO>& m ) noexcept;
+
+template< bool SO >
+void reset( BitMatrix<SO>& m, size_t i ) noexcept;
+
+template< bool SO >
+void clear( BitMatrix<SO>& m ) noexcept;
+
+template< bool RF, bool SO >
+bool isDefault( const BitMatrix<SO>& m ) noexcept;
+
+template< bool SO >
+bool isIntact( const BitMatrix<SO>& m ) noexcept;
+
+template< bool SO >
+void swap( BitMatrix<SO>& a, BitMatrix<SO>& b ) noexcept;
+
+template< bool SO >
+BitMatrix<SO> operator&( const BitMatrix<SO>& lhs, const BitMatrix<SO>& rhs );
+
+template< bool SO >
+BitMatrix<SO> operator|( const BitMatrix<SO>& lhs, const BitMatrix<SO>& rhs );
+
+template< bool SO >
+BitMatrix<SO> operator^( const BitMatrix<SO>& lhs, const BitMatrix<SO>& rhs );
+
+template< bool SO >
+BitMatrix<SO> operator~( const BitMatrix<SO>& m );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given bit matrix.
+// \ingroup bit_matrix
+//
+// \param m The bit matrix to be resetted.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void reset( BitMatrix<SO>& m ) noexcept
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the specified row/column of the given bit matrix.
+// \ingroup bit_matrix
+//
+// \param m The bit matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void reset( BitMatrix<SO>& m, size_t i ) noexcept
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given bit matrix.
+// \ingroup bit_matrix
+//
+// \param m The bit matrix to be cleared.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void clear( BitMatrix<SO>& m ) noexcept
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given bit matrix is in default state.
+// \ingroup bit_matrix
+//
+// \param m The bit matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< bool RF    // Relaxation flag
+        , bool SO >  // Storage order
+inline bool isDefault( const BitMatrix<SO>& m ) noexcept
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given bit matrix are intact.
+// \ingroup bit_matrix
+//
+// \param m The bit matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the bit matrix are intact, i.e. if its state
+// is valid. The invariants require that all padding bits of all rows/columns are zero.
+*/
+template< bool SO >  // Storage order
+inline bool isIntact( const BitMatrix<SO>& m ) noexcept
+{
+   const size_t major( SO ? m.columns() : m.rows() );
+   const size_t minor( SO ? m.rows() : m.columns() );
+   const size_t nn( m.spacing() / BITS_PER_WORD );
+   const size_t n( bitWords( minor ) );
+
+   if( nn*major > m.capacity() / BITS_PER_WORD )
+      return false;
+
+   for( size_t i=0UL; i<major; ++i )
+   {
+      const uint64_t* const w( m.words( i ) );
+
+      if( n > 0UL && ( w[n-1UL] & ~tailMask( minor ) ) )
+         return false;
+
+      for( size_t k=n; k<nn; ++k ) {
+         if( w[k] ) return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two bit matrices.
+// \ingroup bit_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void swap( BitMatrix<SO>& a, BitMatrix<SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise AND operator for two bit matrices (\f$ A=B\&C \f$).
+// \ingroup bit_matrix
+//
+// \param lhs The left-hand side bit matrix.
+// \param rhs The right-hand side bit matrix.
+// \return The resulting bit matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In contrast to the bitwise AND of two general dense matrices, the bitwise AND of two bit
+// matrices is evaluated immediately and word-parallel by means of SIMD operations.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO> operator&( const BitMatrix<SO>& lhs, const BitMatrix<SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BitMatrix<SO> tmp( lhs );
+   tmp &= rhs;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise OR operator for two bit matrices (\f$ A=B|C \f$).
+// \ingroup bit_matrix
+//
+// \param lhs The left-hand side bit matrix.
+// \param rhs The right-hand side bit matrix.
+// \return The resulting bit matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In contrast to the bitwise OR of two general dense matrices, the bitwise OR of two bit
+// matrices is evaluated immediately and word-parallel by means of SIMD operations.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO> operator|( const BitMatrix<SO>& lhs, const BitMatrix<SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BitMatrix<SO> tmp( lhs );
+   tmp |= rhs;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise XOR operator for two bit matrices (\f$ A=B\hat{}C \f$).
+// \ingroup bit_matrix
+//
+// \param lhs The left-hand side bit matrix.
+// \param rhs The right-hand side bit matrix.
+// \return The resulting bit matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In contrast to the bitwise XOR of two general dense matrices, the bitwise XOR of two bit
+// matrices is evaluated immediately and word-parallel by means of SIMD operations.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO> operator^( const BitMatrix<SO>& lhs, const BitMatrix<SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BitMatrix<SO> tmp( lhs );
+   tmp ^= rhs;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise negation of a bit matrix (\f$ A=\sim B \f$).
+// \ingroup bit_matrix
+//
+// \param m The bit matrix to be negated.
+// \return The negated bit matrix.
+*/
+template< bool SO >  // Storage order
+inline BitMatrix<SO> operator~( const BitMatrix<SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BitMatrix<SO> tmp( m );
+   tmp.flip();
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a bit matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup bit_matrix
+//
+// \param mat The left-hand side bit matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// The multiplication is evaluated immediately by visiting only the set bits of the matrix.
+// In case of a row-major matrix, each element of the result is computed by scanning the
+// set bits of the corresponding row, in case of a column-major matrix the elements of the
+// vector are scattered along the set bits of the corresponding columns.
+*/
+template< bool SO        // Storage order of the left-hand side bit matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline DynamicVector< ElementType_t<VT>, false >
+   operator*( const BitMatrix<SO>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   CompositeType_t<VT> x( ~vec );
+   DynamicVector< ElementType_t<VT>, false > y( mat.rows(), ElementType_t<VT>() );
+
+   if( SO == rowMajor ) {
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         y[i] = maskedSum( mat.words( i ), mat.columns(), x );
+      }
+   }
+   else {
+      const size_t n( bitWords( mat.rows() ) );
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         if( isDefault( x[j] ) ) continue;
+         const uint64_t* const w( mat.words( j ) );
+         for( size_t k=0UL; k<n; ++k ) {
+            uint64_t word( w[k] );
+            while( word ) {
+               y[k*BITS_PER_WORD + ctz( word )] += x[j];
+               word &= word - uint64_t(1);
+            }
+         }
+      }
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense vector and a bit matrix
+//        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+// \ingroup bit_matrix
+//
+// \param vec The left-hand side transpose dense vector for the multiplication.
+// \param mat The right-hand side bit matrix for the multiplication.
+// \return The resulting transpose dense vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// The multiplication is evaluated immediately by visiting only the set bits of the matrix.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , bool SO >    // Storage order of the right-hand side bit matrix
+inline DynamicVector< ElementType_t<VT>, true >
+   operator*( const DenseVector<VT,true>& vec, const BitMatrix<SO>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~vec).size() != mat.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   CompositeType_t<VT> x( ~vec );
+   DynamicVector< ElementType_t<VT>, true > y( mat.columns(), ElementType_t<VT>() );
+
+   if( SO == columnMajor ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         y[j] = maskedSum( mat.words( j ), mat.rows(), x );
+      }
+   }
+   else {
+      const size_t n( bitWords( mat.columns() ) );
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         if( isDefault( x[i] ) ) continue;
+         const uint64_t* const w( mat.words( i ) );
+         for( size_t k=0UL; k<n; ++k ) {
+            uint64_t word( w[k] );
+            while( word ) {
+               y[k*BITS_PER_WORD + ctz( word )] += x[i];
+               word &= word - uint64_t(1);
+            }
+         }
+      }
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a bit matrix and a bit vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup bit_matrix
+//
+// \param mat The left-hand side bit matrix for the multiplication.
+// \param vec The right-hand side bit vector for the multiplication.
+// \return The resulting vector of counts.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// Each element of the resulting vector contains the number of common set bits of the
+// corresponding row of the matrix and the vector (e.g. the number of neighbors within a
+// given set of vertices in case of an adjacency matrix). For a row-major matrix the counts
+// are computed by a word-parallel AND followed by a population count.
+*/
+template< bool SO >  // Storage order of the left-hand side bit matrix
+inline DynamicVector< size_t, false >
+   operator*( const BitMatrix<SO>& mat, const BitVector<false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != vec.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   DynamicVector< size_t, false > y( mat.rows(), 0UL );
+
+   if( SO == rowMajor ) {
+      const size_t n( bitWords( mat.columns() ) );
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         y[i] = popcountAnd( mat.words( i ), vec.words(), n );
+      }
+   }
+   else {
+      const size_t nx( bitWords( vec.size() ) );
+      const size_t n ( bitWords( mat.rows() ) );
+      for( size_t kx=0UL; kx<nx; ++kx ) {
+         uint64_t xword( vec.words()[kx] );
+         while( xword ) {
+            const uint64_t* const w( mat.words( kx*BITS_PER_WORD + ctz( xword ) ) );
+            for( size_t k=0UL; k<n; ++k ) {
+               uint64_t word( w[k] );
+               while( word ) {
+                  ++y[k*BITS_PER_WORD + ctz( word )];
+                  word &= word - uint64_t(1);
+               }
+            }
+            xword &= xword - uint64_t(1);
+         }
+      }
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< bool SO >
+struct IsResizable< BitMatrix<SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1722 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BitVector.h
+//  \brief Header file for the implementation of a bit-packed dense vector
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BITVECTOR_H_
+#define _BLAZE_MATH_DENSE_BITVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/BitIterator.h>
+#include <blaze/math/dense/BitKernels.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/functors/Bitand.h>
+#include <blaze/math/functors/Bitor.h>
+#include <blaze/math/functors/Bitxor.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Bits.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/InitializerList.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup bit_vector BitVector
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a bit-packed, arbitrary sized boolean vector.
+// \ingroup bit_vector
+//
+// The BitVector class template is the representation of an arbitrary sized vector of boolean
+// values, which stores every element in a single bit. The transpose flag of the vector can be
+// specified via the template parameter:
+
+   \code
+   template< bool TF >
+   class BitVector;
+   \endcode
+
+//  - TF: specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//        vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//
+// In comparison to a \c DynamicVector<bool>, which requires one byte per element, a BitVector
+// requires only a single bit per element. Additionally, all bitwise operations between two
+// bit vectors (AND, OR, and XOR) are performed word-parallel via SIMD operations and all
+// reductions (count(), any(), all(), none()) are based on the hardware population count:
+
+   \code
+   using blaze::BitVector;
+   using blaze::DynamicVector;
+
+   BitVector<> a( 1000UL ), b( 1000UL );
+   a.set( 3UL );
+   b.set( 3UL );
+   b.set( 5UL );
+
+   BitVector<> c = a & b;        // Word-parallel bitwise AND
+   c |= b;                       // Word-parallel bitwise OR assignment
+   const size_t n = c.count();   // Population count (results in 2)
+
+   DynamicVector<double> x( 1000UL, 1.0 );
+   const double s = inner( b, x );  // Sum of all elements of x selected by b (results in 2.0)
+   \endcode
+
+// Note that BitVector is a dense vector with element type \c bool, which can be used in all
+// dense and sparse vector operations. The elements of a BitVector can be modified via the
+// subscript operator, which returns a proxy to the referenced bit (see BitReference).
+*/
+template< bool TF = defaultTransposeFlag >  // Transpose flag
+class BitVector
+   : public Expression< DenseVector< BitVector<TF>, TF > >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = BitVector<TF>;           //!< Type of this BitVector instance.
+   using BaseType      = DenseVector<This,TF>;    //!< Base type of this BitVector instance.
+   using ResultType    = This;                    //!< Result type for expression template evaluations.
+   using TransposeType = BitVector<!TF>;          //!< Transpose type for expression template evaluations.
+   using ElementType   = bool;                    //!< Type of the vector elements.
+   using ReturnType    = bool;                    //!< Return type for expression template evaluations
+   using CompositeType = const BitVector&;        //!< Data type for composite expression templates.
+
+   using Reference      = BitReference;  //!< Reference to a non-constant vector value.
+   using ConstReference = bool;          //!< Reference to a constant vector value.
+
+   using Iterator      = BitIterator<false>;  //!< Iterator over non-constant elements.
+   using ConstIterator = BitIterator<true>;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a dense vector with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other vector
+   struct Rebind {
+      using Other = DynamicVector<NewType,TF>;  //!< The type of the other vector.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a BitVector with a different fixed number of elements.
+   */
+   template< size_t NewN >  // Number of elements of the other vector
+   struct Resize {
+      using Other = BitVector<TF>;  //!< The type of the other BitVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the vector is involved
+       in can be optimized via SIMD operations. Since the elements of a bit vector are not
+       individually addressable, the flag is set to \a false. Note however that all bitwise
+       operations between two bit vectors are vectorized on word level. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since neighboring elements share a common word, the flag is set to
+       \a false. */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BitVector() noexcept;
+   explicit inline BitVector( size_t n );
+   explicit inline BitVector( size_t n, bool init );
+   explicit inline BitVector( initializer_list<bool> list );
+
+   inline BitVector( const BitVector& v );
+   inline BitVector( BitVector&& v ) noexcept;
+
+   template< typename VT >
+   inline BitVector( const Vector<VT,TF>& v );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BitVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference       operator[]( size_t index ) noexcept;
+   inline ConstReference  operator[]( size_t index ) const noexcept;
+   inline Reference       at( size_t index );
+   inline ConstReference  at( size_t index ) const;
+   inline uint64_t*       words() noexcept;
+   inline const uint64_t* words() const noexcept;
+   inline Iterator        begin () noexcept;
+   inline ConstIterator   begin () const noexcept;
+   inline ConstIterator   cbegin() const noexcept;
+   inline Iterator        end   () noexcept;
+   inline ConstIterator   end   () const noexcept;
+   inline ConstIterator   cend  () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BitVector& operator=( bool rhs ) noexcept;
+   inline BitVector& operator=( initializer_list<bool> list );
+   inline BitVector& operator=( const BitVector& rhs );
+   inline BitVector& operator=( BitVector&& rhs ) noexcept;
+
+   template< typename VT > inline BitVector& operator=( const Vector<VT,TF>& rhs );
+
+   inline BitVector& operator&=( const BitVector& rhs );
+   inline BitVector& operator|=( const BitVector& rhs );
+   inline BitVector& operator^=( const BitVector& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline void   reset() noexcept;
+   inline void   clear() noexcept;
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   extend( size_t n, bool preserve=true );
+   inline void   reserve( size_t n );
+   inline void   swap( BitVector& v ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Bit functions*******************************************************************************
+   /*!\name Bit functions */
+   //@{
+   inline BitVector& set  ( size_t index ) noexcept;
+   inline BitVector& set  () noexcept;
+   inline BitVector& unset( size_t index ) noexcept;
+   inline BitVector& flip ( size_t index ) noexcept;
+   inline BitVector& flip () noexcept;
+   inline bool       test ( size_t index ) const noexcept;
+   inline size_t     count() const noexcept;
+   inline bool       any  () const noexcept;
+   inline bool       all  () const noexcept;
+   inline bool       none () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename VT > inline void assign( const DenseVector<VT,TF>& rhs );
+   template< typename VT > inline void assign( const SparseVector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t    size_;      //!< The current size/dimension of the bit vector.
+   size_t    capacity_;  //!< The maximum capacity of the bit vector in words.
+   uint64_t* v_;         //!< The bit-packed vector elements.
+                         /*!< Access to the vector elements is gained via the subscript operator.
+                              All bits beyond the current size of the vector are guaranteed to
+                              be zero. */
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BitVector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>::BitVector() noexcept
+   : size_    ( 0UL )      // The current size/dimension of the vector
+   , capacity_( 0UL )      // The maximum capacity of the vector
+   , v_       ( nullptr )  // The bit-packed vector elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a bit vector of size \a n. All bits are initialized to \a false.
+//
+// \param n The size of the vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>::BitVector( size_t n )
+   : size_    ( n )                                // The current size/dimension of the vector
+   , capacity_( paddedBitWords( n ) )              // The maximum capacity of the vector
+   , v_       ( allocate<uint64_t>( capacity_ ) )  // The bit-packed vector elements
+{
+   std::fill( v_, v_+capacity_, uint64_t(0) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all \a n bits.
+//
+// \param n The size of the vector.
+// \param init The initial value of the vector elements.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>::BitVector( size_t n, bool init )
+   : BitVector( n )
+{
+   if( init ) {
+      set();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all vector elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the vector
+// within a constructor call:
+
+   \code
+   blaze::BitVector<> v{ true, false, true, true };
+   \endcode
+
+// The vector is sized according to the size of the initializer list.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>::BitVector( initializer_list<bool> list )
+   : BitVector( list.size() )
+{
+   size_t i( 0UL );
+   for( bool element : list ) {
+      if( element ) set( i );
+      ++i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BitVector.
+//
+// \param v Bit vector to be copied.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>::BitVector( const BitVector& v )
+   : BitVector( v.size_ )
+{
+   std::copy( v.v_, v.v_+bitWords( size_ ), v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BitVector.
+//
+// \param v The bit vector to be moved into this instance.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>::BitVector( BitVector&& v ) noexcept
+   : size_    ( v.size_     )  // The current size/dimension of the vector
+   , capacity_( v.capacity_ )  // The maximum capacity of the vector
+   , v_       ( v.v_        )  // The bit-packed vector elements
+{
+   v.size_     = 0UL;
+   v.capacity_ = 0UL;
+   v.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different vectors.
+//
+// \param v Vector to be copied.
+//
+// All non-default elements of the given vector are represented by set bits.
+*/
+template< bool TF >      // Transpose flag
+template< typename VT >  // Type of the foreign vector
+inline BitVector<TF>::BitVector( const Vector<VT,TF>& v )
+   : BitVector( (~v).size() )
+{
+   blaze::assign( *this, ~v );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BitVector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>::~BitVector()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed bit.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::Reference
+   BitVector<TF>::operator[]( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return Reference( v_ + index/BITS_PER_WORD, index%BITS_PER_WORD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed bit.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::ConstReference
+   BitVector<TF>::operator[]( size_t index ) const noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return test( index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed bit.
+// \exception std::out_of_range Invalid vector access index.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::Reference
+   BitVector<TF>::at( size_t index )
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed bit.
+// \exception std::out_of_range Invalid vector access index.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::ConstReference
+   BitVector<TF>::at( size_t index ) const
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the bit-packed vector elements.
+//
+// \return Pointer to the first word of the bit vector.
+//
+// This function returns a pointer to the internal storage of the bit vector. Bit \f$ i \f$ of
+// the vector is stored in bit \f$ i \bmod 64 \f$ of word \f$ \lfloor i/64 \rfloor \f$. All
+// bits beyond the current size of the vector must remain zero.
+*/
+template< bool TF >  // Transpose flag
+inline uint64_t* BitVector<TF>::words() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the bit-packed vector elements.
+//
+// \return Pointer to the first word of the bit vector.
+*/
+template< bool TF >  // Transpose flag
+inline const uint64_t* BitVector<TF>::words() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the bit vector.
+//
+// \return Iterator to the first element of the bit vector.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::Iterator BitVector<TF>::begin() noexcept
+{
+   return Iterator( v_, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the bit vector.
+//
+// \return Iterator to the first element of the bit vector.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::ConstIterator BitVector<TF>::begin() const noexcept
+{
+   return ConstIterator( v_, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the bit vector.
+//
+// \return Iterator to the first element of the bit vector.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::ConstIterator BitVector<TF>::cbegin() const noexcept
+{
+   return ConstIterator( v_, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the bit vector.
+//
+// \return Iterator just past the last element of the bit vector.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::Iterator BitVector<TF>::end() noexcept
+{
+   return Iterator( v_, size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the bit vector.
+//
+// \return Iterator just past the last element of the bit vector.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::ConstIterator BitVector<TF>::end() const noexcept
+{
+   return ConstIterator( v_, size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the bit vector.
+//
+// \return Iterator just past the last element of the bit vector.
+*/
+template< bool TF >  // Transpose flag
+inline typename BitVector<TF>::ConstIterator BitVector<TF>::cend() const noexcept
+{
+   return ConstIterator( v_, size_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogeneous assignment to all vector elements.
+//
+// \param rhs Boolean value to be assigned to all vector elements.
+// \return Reference to the assigned vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::operator=( bool rhs ) noexcept
+{
+   if( rhs ) set();
+   else reset();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all vector elements.
+//
+// \param list The initializer list.
+// \return Reference to the assigned vector.
+//
+// The vector is resized according to the size of the initializer list.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::operator=( initializer_list<bool> list )
+{
+   resize( list.size(), false );
+
+   size_t i( 0UL );
+   for( bool element : list ) {
+      if( element ) set( i );
+      ++i;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BitVector.
+//
+// \param rhs Bit vector to be copied.
+// \return Reference to the assigned vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::operator=( const BitVector& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.size_, false );
+   std::copy( rhs.v_, rhs.v_+bitWords( size_ ), v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BitVector.
+//
+// \param rhs The bit vector to be moved into this instance.
+// \return Reference to the assigned vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::operator=( BitVector&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different vectors.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+//
+// The vector is resized according to the given vector. All non-default elements of the given
+// vector are represented by set bits.
+*/
+template< bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side vector
+inline BitVector<TF>& BitVector<TF>::operator=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).canAlias( this ) ) {
+      BitVector tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).size(), false );
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise AND assignment operator (\f$ \vec{a}\&=\vec{b} \f$).
+//
+// \param rhs The right-hand side bit vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The bitwise AND is performed word-parallel by means of SIMD operations.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::operator&=( const BitVector& rhs )
+{
+   if( rhs.size_ != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   wordwiseAssign( v_, rhs.v_, paddedBitWords( size_ ), Bitand() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise OR assignment operator (\f$ \vec{a}|=\vec{b} \f$).
+//
+// \param rhs The right-hand side bit vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The bitwise OR is performed word-parallel by means of SIMD operations.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::operator|=( const BitVector& rhs )
+{
+   if( rhs.size_ != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   wordwiseAssign( v_, rhs.v_, paddedBitWords( size_ ), Bitor() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise XOR assignment operator (\f$ \vec{a}\hat{}=\vec{b} \f$).
+//
+// \param rhs The right-hand side bit vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The bitwise XOR is performed word-parallel by means of SIMD operations.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::operator^=( const BitVector& rhs )
+{
+   if( rhs.size_ != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   wordwiseAssign( v_, rhs.v_, paddedBitWords( size_ ), Bitxor() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the vector.
+//
+// \return The size of the vector.
+*/
+template< bool TF >  // Transpose flag
+inline size_t BitVector<TF>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimum capacity of the vector.
+//
+// \return The minimum capacity of the vector.
+//
+// This function returns the minimum capacity of the vector, which corresponds to the current
+// size plus padding, i.e. the number of bits stored in the allocated words.
+*/
+template< bool TF >  // Transpose flag
+inline size_t BitVector<TF>::spacing() const noexcept
+{
+   return paddedBitWords( size_ ) * BITS_PER_WORD;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the vector.
+//
+// \return The maximum capacity of the vector.
+*/
+template< bool TF >  // Transpose flag
+inline size_t BitVector<TF>::capacity() const noexcept
+{
+   return capacity_ * BITS_PER_WORD;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the vector.
+//
+// \return The number of set bits in the vector.
+*/
+template< bool TF >  // Transpose flag
+inline size_t BitVector<TF>::nonZeros() const noexcept
+{
+   return count();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< bool TF >  // Transpose flag
+inline void BitVector<TF>::reset() noexcept
+{
+   std::fill( v_, v_+capacity_, uint64_t(0) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the vector.
+//
+// \return void
+//
+// After the clear() function, the size of the vector is 0.
+*/
+template< bool TF >  // Transpose flag
+inline void BitVector<TF>::clear() noexcept
+{
+   reset();
+   size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the vector.
+//
+// \param n The new size of the vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the vector using the given size to \a n. In case the vector is
+// enlarged, the new bits are initialized to \a false. In case \a preserve is \a false, all
+// bits are reset.
+*/
+template< bool TF >  // Transpose flag
+inline void BitVector<TF>::resize( size_t n, bool preserve )
+{
+   const size_t nwords( paddedBitWords( n ) );
+
+   if( nwords > capacity_ )
+   {
+      uint64_t* tmp( allocate<uint64_t>( nwords ) );
+
+      if( preserve ) {
+         std::copy( v_, v_+capacity_, tmp );
+         std::fill( tmp+capacity_, tmp+nwords, uint64_t(0) );
+      }
+      else {
+         std::fill( tmp, tmp+nwords, uint64_t(0) );
+      }
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = nwords;
+   }
+   else if( !preserve ) {
+      reset();
+   }
+   else if( n < size_ ) {
+      const size_t last( bitWords( n ) );
+      std::fill( v_+last, v_+bitWords( size_ ), uint64_t(0) );
+      if( last > 0UL ) v_[last-1UL] &= tailMask( n );
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the vector.
+//
+// \param n Number of additional vector elements.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// This function increases the vector size by \a n elements. The new bits are initialized to
+// \a false.
+*/
+template< bool TF >  // Transpose flag
+inline void BitVector<TF>::extend( size_t n, bool preserve )
+{
+   resize( size_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the vector.
+//
+// \param n The new minimum capacity of the vector (in bits).
+// \return void
+//
+// This function increases the capacity of the vector to at least \a n elements. The current
+// values of the vector elements are preserved.
+*/
+template< bool TF >  // Transpose flag
+inline void BitVector<TF>::reserve( size_t n )
+{
+   const size_t nwords( paddedBitWords( n ) );
+
+   if( nwords > capacity_ )
+   {
+      uint64_t* tmp( allocate<uint64_t>( nwords ) );
+
+      std::copy( v_, v_+capacity_, tmp );
+      std::fill( tmp+capacity_, tmp+nwords, uint64_t(0) );
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = nwords;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vectors.
+//
+// \param v The vector to be swapped.
+// \return void
+*/
+template< bool TF >  // Transpose flag
+inline void BitVector<TF>::swap( BitVector& v ) noexcept
+{
+   using std::swap;
+
+   swap( size_, v.size_ );
+   swap( capacity_, v.capacity_ );
+   swap( v_, v.v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BIT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting a single bit of the vector.
+//
+// \param index The index of the bit. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::set( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   v_[index/BITS_PER_WORD] |= uint64_t(1) << ( index%BITS_PER_WORD );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting all bits of the vector.
+//
+// \return Reference to the vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::set() noexcept
+{
+   const size_t n( bitWords( size_ ) );
+
+   std::fill( v_, v_+n, ~uint64_t(0) );
+   if( n > 0UL ) v_[n-1UL] &= tailMask( size_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting a single bit of the vector.
+//
+// \param index The index of the bit. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::unset( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   v_[index/BITS_PER_WORD] &= ~( uint64_t(1) << ( index%BITS_PER_WORD ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Flipping a single bit of the vector.
+//
+// \param index The index of the bit. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::flip( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   v_[index/BITS_PER_WORD] ^= uint64_t(1) << ( index%BITS_PER_WORD );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Flipping all bits of the vector.
+//
+// \return Reference to the vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF>& BitVector<TF>::flip() noexcept
+{
+   wordwiseNegate( v_, size_ );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the value of a single bit of the vector.
+//
+// \param index The index of the bit. The index has to be in the range \f$[0..N-1]\f$.
+// \return \a true in case the bit is set, \a false if not.
+*/
+template< bool TF >  // Transpose flag
+inline bool BitVector<TF>::test( size_t index ) const noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return ( v_[index/BITS_PER_WORD] >> ( index%BITS_PER_WORD ) ) & uint64_t(1);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of set bits of the vector.
+//
+// \return The number of set bits.
+//
+// The number of set bits is computed word by word by means of the hardware population count.
+*/
+template< bool TF >  // Transpose flag
+inline size_t BitVector<TF>::count() const noexcept
+{
+   return popcount( v_, bitWords( size_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether at least one bit of the vector is set.
+//
+// \return \a true in case at least one bit is set, \a false if not.
+*/
+template< bool TF >  // Transpose flag
+inline bool BitVector<TF>::any() const noexcept
+{
+   const size_t n( bitWords( size_ ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( v_[i] ) return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether all bits of the vector are set.
+//
+// \return \a true in case all bits are set, \a false if not.
+*/
+template< bool TF >  // Transpose flag
+inline bool BitVector<TF>::all() const noexcept
+{
+   const size_t n( bitWords( size_ ) );
+
+   if( n == 0UL ) return true;
+
+   for( size_t i=0UL; i<n-1UL; ++i ) {
+      if( ~v_[i] ) return false;
+   }
+
+   return v_[n-1UL] == tailMask( size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether no bit of the vector is set.
+//
+// \return \a true in case no bit is set, \a false if at least one bit is set.
+*/
+template< bool TF >  // Transpose flag
+inline bool BitVector<TF>::none() const noexcept
+{
+   return !any();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< bool TF >         // Transpose flag
+template< typename Other >  // Data type of the foreign expression
+inline bool BitVector<TF>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< bool TF >         // Transpose flag
+template< typename Other >  // Data type of the foreign expression
+inline bool BitVector<TF>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is properly aligned in memory.
+//
+// \return \a true in case the vector is aligned, \a false if not.
+//
+// This function returns whether the vector is guaranteed to be properly aligned in memory.
+// Since the words of a bit vector are always allocated with SIMD alignment, the function
+// always returns \a true.
+*/
+template< bool TF >  // Transpose flag
+inline bool BitVector<TF>::isAligned() const noexcept
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// Since neighboring elements of a bit vector share a common word, a bit vector cannot be
+// assigned concurrently and the function always returns \a false.
+*/
+template< bool TF >  // Transpose flag
+inline bool BitVector<TF>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline void BitVector<TF>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( bitWords( size_ ) );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t ibegin( k*BITS_PER_WORD );
+      const size_t iend  ( ( ibegin+BITS_PER_WORD < size_ )?( ibegin+BITS_PER_WORD ):( size_ ) );
+
+      uint64_t word( 0UL );
+      for( size_t i=ibegin; i<iend; ++i ) {
+         if( !isDefault( (~rhs)[i] ) )
+            word |= uint64_t(1) << ( i-ibegin );
+      }
+      v_[k] = word;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void BitVector<TF>::assign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   reset();
+
+   for( auto element=(~rhs).begin(); element!=(~rhs).end(); ++element ) {
+      if( !isDefault( element->value() ) )
+         set( element->index() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BITVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BitVector operators */
+//@{
+template< bool TF >
+void reset( BitVector<TF>& v ) noexcept;
+
+template< bool TF >
+void clear( BitVector<TF>& v ) noexcept;
+
+template< bool RF, bool TF >
+bool isDefault( const BitVector<TF>& v ) noexcept;
+
+template< bool TF >
+bool isIntact( const BitVector<TF>& v ) noexcept;
+
+template< bool TF >
+void swap( BitVector<TF>& a, BitVector<TF>& b ) noexcept;
+
+template< bool TF >
+BitVector<TF> operator&( const BitVector<TF>& lhs, const BitVector<TF>& rhs );
+
+template< bool TF >
+BitVector<TF> operator|( const BitVector<TF>& lhs, const BitVector<TF>& rhs );
+
+template< bool TF >
+BitVector<TF> operator^( const BitVector<TF>& lhs, const BitVector<TF>& rhs );
+
+template< bool TF >
+BitVector<TF> operator~( const BitVector<TF>& v );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given bit vector.
+// \ingroup bit_vector
+//
+// \param v The bit vector to be resetted.
+// \return void
+*/
+template< bool TF >  // Transpose flag
+inline void reset( BitVector<TF>& v ) noexcept
+{
+   v.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given bit vector.
+// \ingroup bit_vector
+//
+// \param v The bit vector to be cleared.
+// \return void
+*/
+template< bool TF >  // Transpose flag
+inline void clear( BitVector<TF>& v ) noexcept
+{
+   v.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given bit vector is in default state.
+// \ingroup bit_vector
+//
+// \param v The bit vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+*/
+template< bool RF    // Relaxation flag
+        , bool TF >  // Transpose flag
+inline bool isDefault( const BitVector<TF>& v ) noexcept
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given bit vector are intact.
+// \ingroup bit_vector
+//
+// \param v The bit vector to be tested.
+// \return \a true in case the given vector's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the bit vector are intact, i.e. if its state
+// is valid. In case the invariants are intact, the function returns \a true, else it will
+// return \a false. The invariants require that all bits beyond the current size are zero.
+*/
+template< bool TF >  // Transpose flag
+inline bool isIntact( const BitVector<TF>& v ) noexcept
+{
+   if( v.size() > v.capacity() )
+      return false;
+
+   const size_t n( bitWords( v.size() ) );
+   const size_t m( v.capacity() / BITS_PER_WORD );
+
+   if( n > 0UL && ( v.words()[n-1UL] & ~tailMask( v.size() ) ) )
+      return false;
+
+   for( size_t i=n; i<m; ++i ) {
+      if( v.words()[i] ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two bit vectors.
+// \ingroup bit_vector
+//
+// \param a The first vector to be swapped.
+// \param b The second vector to be swapped.
+// \return void
+*/
+template< bool TF >  // Transpose flag
+inline void swap( BitVector<TF>& a, BitVector<TF>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise AND operator for two bit vectors (\f$ \vec{a}=\vec{b}\&\vec{c} \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side bit vector.
+// \param rhs The right-hand side bit vector.
+// \return The resulting bit vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In contrast to the bitwise AND of two general dense vectors, the bitwise AND of two bit
+// vectors is evaluated immediately and word-parallel by means of SIMD operations.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF> operator&( const BitVector<TF>& lhs, const BitVector<TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BitVector<TF> tmp( lhs );
+   tmp &= rhs;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise OR operator for two bit vectors (\f$ \vec{a}=\vec{b}|\vec{c} \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side bit vector.
+// \param rhs The right-hand side bit vector.
+// \return The resulting bit vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In contrast to the bitwise OR of two general dense vectors, the bitwise OR of two bit
+// vectors is evaluated immediately and word-parallel by means of SIMD operations.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF> operator|( const BitVector<TF>& lhs, const BitVector<TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BitVector<TF> tmp( lhs );
+   tmp |= rhs;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise XOR operator for two bit vectors (\f$ \vec{a}=\vec{b}\hat{}\vec{c} \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side bit vector.
+// \param rhs The right-hand side bit vector.
+// \return The resulting bit vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In contrast to the bitwise XOR of two general dense vectors, the bitwise XOR of two bit
+// vectors is evaluated immediately and word-parallel by means of SIMD operations.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF> operator^( const BitVector<TF>& lhs, const BitVector<TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BitVector<TF> tmp( lhs );
+   tmp ^= rhs;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise negation of a bit vector (\f$ \vec{a}=\sim\vec{b} \f$).
+// \ingroup bit_vector
+//
+// \param v The bit vector to be negated.
+// \return The negated bit vector.
+*/
+template< bool TF >  // Transpose flag
+inline BitVector<TF> operator~( const BitVector<TF>& v )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BitVector<TF> tmp( v );
+   tmp.flip();
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scalar product (inner product) of two bit vectors (\f$ s=(\vec{a},\vec{b}) \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side bit vector.
+// \param rhs The right-hand side bit vector.
+// \return The number of common set bits.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The inner product of two bit vectors corresponds to the population count of the bitwise
+// AND of both vectors, which is computed word by word without creating a temporary.
+*/
+template< bool TF1    // Transpose flag of the left-hand side bit vector
+        , bool TF2 >  // Transpose flag of the right-hand side bit vector
+inline size_t inner( const BitVector<TF1>& lhs, const BitVector<TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.size() != rhs.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return popcountAnd( lhs.words(), rhs.words(), bitWords( lhs.size() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar product (inner product) of a bit vector and a dense vector
+//        (\f$ s=(\vec{a},\vec{b}) \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side bit vector.
+// \param rhs The right-hand side dense vector.
+// \return The sum of all elements of the dense vector selected by the set bits.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The inner product is computed by scanning the set bits of the bit vector. Therefore the
+// cost of the operation is proportional to the number of set bits instead of the size of
+// the vectors.
+*/
+template< bool TF1       // Transpose flag of the left-hand side bit vector
+        , typename VT    // Type of the right-hand side dense vector
+        , bool TF2 >     // Transpose flag of the right-hand side dense vector
+inline decltype(auto) inner( const BitVector<TF1>& lhs, const DenseVector<VT,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   CompositeType_t<VT> x( ~rhs );
+   return maskedSum( lhs.words(), lhs.size(), x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar product (inner product) of a dense vector and a bit vector
+//        (\f$ s=(\vec{a},\vec{b}) \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side dense vector.
+// \param rhs The right-hand side bit vector.
+// \return The sum of all elements of the dense vector selected by the set bits.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , bool TF1       // Transpose flag of the left-hand side dense vector
+        , bool TF2 >     // Transpose flag of the right-hand side bit vector
+inline decltype(auto) inner( const DenseVector<VT,TF1>& lhs, const BitVector<TF2>& rhs )
+{
+   return inner( rhs, ~lhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the scalar product (inner product) of two bit vectors
+//        (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side bit row vector.
+// \param rhs The right-hand side bit column vector.
+// \return The number of common set bits.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+inline size_t operator*( const BitVector<true>& lhs, const BitVector<false>& rhs )
+{
+   return inner( lhs, rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the scalar product (inner product) of a bit vector and a
+//        dense vector (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side bit row vector.
+// \param rhs The right-hand side dense column vector.
+// \return The sum of all elements of the dense vector selected by the set bits.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT >  // Type of the right-hand side dense vector
+inline decltype(auto) operator*( const BitVector<true>& lhs, const DenseVector<VT,false>& rhs )
+{
+   return inner( lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the scalar product (inner product) of a dense vector and a
+//        bit vector (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup bit_vector
+//
+// \param lhs The left-hand side dense row vector.
+// \param rhs The right-hand side bit column vector.
+// \return The sum of all elements of the dense vector selected by the set bits.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT >  // Type of the left-hand side dense vector
+inline decltype(auto) operator*( const DenseVector<VT,true>& lhs, const BitVector<false>& rhs )
+{
+   return inner( rhs, ~lhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< bool TF >
+struct IsResizable< BitVector<TF> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
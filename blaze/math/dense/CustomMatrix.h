@@ -61,6 +61,8 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/smp/Transpose.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -800,6 +802,8 @@ inline CustomMatrix<Type,AF,PF,SO,RT>::CustomMatrix( Type* ptr, size_t m, size_t
 // In all failure cases a \a std::invalid_argument exception is thrown.
 //
 // \note The custom matrix does \b NOT take responsibility for the given array of elements!
+// In case of a padded matrix with const element type the padding elements cannot be reset
+// and are expected to be default values.
 */
 template< typename Type  // Data type of the matrix
         , bool AF        // Alignment flag
@@ -814,7 +818,7 @@ inline CustomMatrix<Type,AF,PF,SO,RT>::CustomMatrix( Type* ptr, size_t m, size_t
 {
    using blaze::clear;
 
-   using ClearFunctor = If_t< PF || !IsConst_v<Type>, Clear, Noop >;
+   using ClearFunctor = If_t< !IsConst_v<Type>, Clear, Noop >;
 
    if( ptr == nullptr ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
@@ -1883,15 +1887,11 @@ template< typename Type  // Data type of the matrix
         , typename RT >  // Result type
 inline CustomMatrix<Type,AF,PF,SO,RT>& CustomMatrix<Type,AF,PF,SO,RT>::transpose()
 {
-   using std::swap;
-
    if( m_ != n_ ) {
       BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
    }
 
-   for( size_t i=1UL; i<m_; ++i )
-      for( size_t j=0UL; j<i; ++j )
-         swap( v_[i*nn_+j], v_[j*nn_+i] );
+   smpTranspose( *this );
 
    return *this;
 }
@@ -1917,12 +1917,7 @@ inline CustomMatrix<Type,AF,PF,SO,RT>& CustomMatrix<Type,AF,PF,SO,RT>::ctranspos
       BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
    }
 
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( size_t j=0UL; j<i; ++j ) {
-         cswap( v_[i*nn_+j], v_[j*nn_+i] );
-      }
-      conjugate( v_[i*nn_+i] );
-   }
+   smpCTranspose( *this );
 
    return *this;
 }
@@ -2141,7 +2136,7 @@ template< typename Type  // Data type of the matrix
         , typename RT >  // Result type
 inline bool CustomMatrix<Type,AF,PF,SO,RT>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 //*************************************************************************************************
 
@@ -3679,6 +3674,8 @@ inline CustomMatrix<Type,AF,PF,true,RT>::CustomMatrix( Type* ptr, size_t m, size
 // In all failure cases a \a std::invalid_argument exception is thrown.
 //
 // \note The custom matrix does \b NOT take responsibility for the given array of elements!
+// In case of a padded matrix with const element type the padding elements cannot be reset
+// and are expected to be default values.
 */
 template< typename Type  // Data type of the matrix
         , bool AF        // Alignment flag
@@ -3692,7 +3689,7 @@ inline CustomMatrix<Type,AF,PF,true,RT>::CustomMatrix( Type* ptr, size_t m, size
 {
    using blaze::clear;
 
-   using ClearFunctor = If_t< PF || !IsConst_v<Type>, Clear, Noop >;
+   using ClearFunctor = If_t< !IsConst_v<Type>, Clear, Noop >;
 
    if( ptr == nullptr ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
@@ -4761,15 +4758,11 @@ template< typename Type  // Data type of the matrix
         , typename RT >  // Result type
 inline CustomMatrix<Type,AF,PF,true,RT>& CustomMatrix<Type,AF,PF,true,RT>::transpose()
 {
-   using std::swap;
-
    if( m_ != n_ ) {
       BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
    }
 
-   for( size_t j=1UL; j<n_; ++j )
-      for( size_t i=0UL; i<j; ++i )
-         swap( v_[i+j*mm_], v_[j+i*mm_] );
+   smpTranspose( *this );
 
    return *this;
 }
@@ -4796,12 +4789,7 @@ inline CustomMatrix<Type,AF,PF,true,RT>& CustomMatrix<Type,AF,PF,true,RT>::ctran
       BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
    }
 
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<j; ++i ) {
-         cswap( v_[i+j*mm_], v_[j+i*mm_] );
-      }
-      conjugate( v_[j+j*mm_] );
-   }
+   smpCTranspose( *this );
 
    return *this;
 }
@@ -5027,7 +5015,7 @@ template< typename Type  // Data type of the matrix
         , typename RT >  // Result type
 inline bool CustomMatrix<Type,AF,PF,true,RT>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
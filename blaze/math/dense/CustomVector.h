@@ -53,6 +53,8 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Forward.h>
+#include <blaze/math/functors/Clear.h>
+#include <blaze/math/functors/Noop.h>
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/PaddingFlag.h>
 #include <blaze/math/shims/Clear.h>
@@ -60,6 +62,7 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/DivTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -91,8 +94,10 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 #include <blaze/util/typetraits/RemoveConst.h>
@@ -1874,7 +1879,7 @@ template< typename Type  // Data type of the vector
         , typename RT >  // Result type
 inline bool CustomVector<Type,AF,PF,TF,RT>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 //*************************************************************************************************
 
@@ -3017,6 +3022,8 @@ inline CustomVector<Type,AF,padded,TF,RT>::CustomVector()
 // In all failure cases a \a std::invalid_argument exception is thrown.
 //
 // \note The custom vector does NOT take responsibility for the given array of elements!
+// In case of a const element type the padding elements cannot be reset and are expected to be
+// default values.
 */
 template< typename Type  // Data type of the vector
         , bool AF        // Alignment flag
@@ -3029,6 +3036,8 @@ inline CustomVector<Type,AF,padded,TF,RT>::CustomVector( Type* ptr, size_t n, si
 {
    using blaze::clear;
 
+   using ClearFunctor = If_t< !IsConst_v<Type>, Clear, Noop >;
+
    if( ptr == nullptr ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
    }
@@ -3042,6 +3051,7 @@ inline CustomVector<Type,AF,padded,TF,RT>::CustomVector( Type* ptr, size_t n, si
    }
 
    if( IsVectorizable_v<Type> ) {
+      ClearFunctor clear;
       for( size_t i=size_; i<capacity_; ++i )
          clear( v_[i] );
    }
@@ -4142,7 +4152,7 @@ template< typename Type  // Data type of the vector
         , typename RT >  // Result type
 inline bool CustomVector<Type,AF,padded,TF,RT>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
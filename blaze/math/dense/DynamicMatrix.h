@@ -41,15 +41,20 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/CustomMatrix.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transpose.h>
+#include <blaze/math/dense/UniformMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/FirstTouch.h>
 #include <blaze/math/Forward.h>
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/shims/Clear.h>
@@ -58,6 +63,10 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/smp/Transpose.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -69,6 +78,7 @@
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/DynamicAllocator.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -99,6 +109,8 @@
 #include <blaze/math/typetraits/MaxSize.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/math/typetraits/TemporaryType.h>
+#include <blaze/math/Uninitialized.h>
 #include <blaze/system/Blocking.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
@@ -110,18 +122,22 @@
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/SameType.h>
 #include <blaze/util/constraints/Vectorizable.h>
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/TemporaryAllocator.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
@@ -146,17 +162,21 @@ namespace blaze {
 //
 // The DynamicMatrix class template is the representation of an arbitrary sized matrix with
 // \f$ M \times N \f$ dynamically allocated elements of arbitrary type. The type of the elements
-// and the storage order of the matrix can be specified via the two template parameters:
+// and the storage order of the matrix as well as the allocator can be specified via the three
+// template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename Alloc >
    class DynamicMatrix;
    \endcode
 
-//  - Type: specifies the type of the matrix elements. DynamicMatrix can be used with any
-//          non-cv-qualified, non-reference, non-pointer element type.
-//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
-//          The default value is blaze::rowMajor.
+//  - Type : specifies the type of the matrix elements. DynamicMatrix can be used with any
+//           non-cv-qualified, non-reference, non-pointer element type.
+//  - SO   : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//           The default value is blaze::rowMajor.
+//  - Alloc: specifies the type of the allocator used for the matrix elements. The allocator
+//           must return memory that satisfies the alignment restrictions of the element type
+//           (see the AlignmentOf type trait). The default value is \a blaze::AlignedAllocator.
 //
 // Depending on the storage order, the matrix elements are either stored in a row-wise fashion
 // or in a column-wise fashion. Given the 2x3 matrix
@@ -217,21 +237,23 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the matrix
-        , bool SO = defaultStorageOrder >  // Storage order
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename Alloc >                 // Type of the allocator
 class DynamicMatrix
-   : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
+   : public DenseMatrix< DynamicMatrix<Type,SO,Alloc>, SO >
 {
  public:
    //**Type definitions****************************************************************************
-   using This          = DynamicMatrix<Type,SO>;    //!< Type of this DynamicMatrix instance.
-   using BaseType      = DenseMatrix<This,SO>;      //!< Base type of this DynamicMatrix instance.
-   using ResultType    = This;                      //!< Result type for expression template evaluations.
-   using OppositeType  = DynamicMatrix<Type,!SO>;   //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType = DynamicMatrix<Type,!SO>;   //!< Transpose type for expression template evaluations.
-   using ElementType   = Type;                      //!< Type of the matrix elements.
-   using SIMDType      = SIMDTrait_t<ElementType>;  //!< SIMD type of the matrix elements.
-   using ReturnType    = const Type&;               //!< Return type for expression template evaluations.
-   using CompositeType = const This&;               //!< Data type for composite expression templates.
+   using This          = DynamicMatrix<Type,SO,Alloc>;   //!< Type of this DynamicMatrix instance.
+   using BaseType      = DenseMatrix<This,SO>;           //!< Base type of this DynamicMatrix instance.
+   using ResultType    = This;                           //!< Result type for expression template evaluations.
+   using OppositeType  = DynamicMatrix<Type,!SO,Alloc>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = DynamicMatrix<Type,!SO,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                           //!< Type of the matrix elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;       //!< SIMD type of the matrix elements.
+   using ReturnType    = const Type&;                    //!< Return type for expression template evaluations.
+   using CompositeType = const This&;                    //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                          //!< Type of the allocator of the matrix elements.
 
    using Reference      = Type&;        //!< Reference to a non-constant matrix value.
    using ConstReference = const Type&;  //!< Reference to a constant matrix value.
@@ -247,7 +269,8 @@ class DynamicMatrix
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = DynamicMatrix<NewType,SO>;  //!< The type of the other DynamicMatrix.
+      using NewAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NewType>;  //!< Type of the rebound allocator.
+      using Other    = DynamicMatrix<NewType,SO,NewAlloc>;                                     //!< The type of the other DynamicMatrix.
    };
    //**********************************************************************************************
 
@@ -257,7 +280,7 @@ class DynamicMatrix
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = DynamicMatrix<Type,SO>;  //!< The type of the other DynamicMatrix.
+      using Other = DynamicMatrix<Type,SO,Alloc>;  //!< The type of the other DynamicMatrix.
    };
    //**********************************************************************************************
 
@@ -280,8 +303,12 @@ class DynamicMatrix
    /*!\name Constructors */
    //@{
    explicit inline DynamicMatrix() noexcept;
+   explicit inline DynamicMatrix( const Alloc& alloc ) noexcept;
    explicit inline DynamicMatrix( size_t m, size_t n );
+   explicit inline DynamicMatrix( size_t m, size_t n, const Alloc& alloc );
    explicit inline DynamicMatrix( size_t m, size_t n, const Type& init );
+   explicit inline DynamicMatrix( size_t m, size_t n, const Type& init, FirstTouch );
+   explicit inline DynamicMatrix( size_t m, size_t n, Uninitialized );
             inline DynamicMatrix( initializer_list< initializer_list<Type> > list );
 
    template< typename Other >
@@ -293,6 +320,7 @@ class DynamicMatrix
                                      inline DynamicMatrix( const DynamicMatrix& m );
                                      inline DynamicMatrix( DynamicMatrix&& m ) noexcept;
    template< typename MT, bool SO2 > inline DynamicMatrix( const Matrix<MT,SO2>& m );
+   template< typename MT, bool SO2 > inline DynamicMatrix( const Matrix<MT,SO2>& m, const Alloc& alloc );
    //@}
    //**********************************************************************************************
 
@@ -356,6 +384,7 @@ class DynamicMatrix
    inline void   reset( size_t i );
    inline void   clear();
           void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   resize ( size_t m, size_t n, bool preserve, Uninitialized );
    inline void   extend ( size_t m, size_t n, bool preserve=true );
    inline void   reserve( size_t elements );
    inline void   shrinkToFit();
@@ -501,12 +530,14 @@ class DynamicMatrix
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t value ) const noexcept;
+   inline void   initialize( const Type& init, bool parallel );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   Alloc alloc_;             //!< The allocator of the matrix elements.
    size_t m_;                //!< The current number of rows of the matrix.
    size_t n_;                //!< The current number of columns of the matrix.
    size_t nn_;               //!< The alignment adjusted number of columns.
@@ -530,6 +561,7 @@ class DynamicMatrix
    BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE         ( Type, typename std::allocator_traits<Alloc>::value_type );
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -547,10 +579,31 @@ class DynamicMatrix
 //*************************************************************************************************
 /*!\brief The default constructor for DynamicMatrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
-   : m_       ( 0UL )      // The current number of rows of the matrix
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix() noexcept
+   : alloc_   ()           // The allocator of the matrix elements
+   , m_       ( 0UL )      // The current number of rows of the matrix
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , nn_      ( 0UL )      // The alignment adjusted number of columns
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix with the given allocator.
+//
+// \param alloc The allocator of the matrix elements.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const Alloc& alloc ) noexcept
+   : alloc_   ( alloc )    // The allocator of the matrix elements
+   , m_       ( 0UL )      // The current number of rows of the matrix
    , n_       ( 0UL )      // The current number of columns of the matrix
    , nn_      ( 0UL )      // The alignment adjusted number of columns
    , capacity_( 0UL )      // The maximum capacity of the matrix
@@ -568,14 +621,36 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 // \note This constructor is only responsible to allocate the required dynamic memory. No
 // element initialization is performed!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n )
+   : DynamicMatrix( m, n, Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$ with the given allocator. No element
+//        initialization is performed!
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param alloc The allocator of the matrix elements.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n, const Alloc& alloc )
+   : alloc_   ( alloc )                          // The allocator of the matrix elements
+   , m_       ( m )                              // The current number of rows of the matrix
+   , n_       ( n )                              // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )                // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                         // The maximum capacity of the matrix
+   , v_       ( allocate( alloc_, capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable_v<Type> ) {
       for( size_t i=0UL; i<m_; ++i ) {
@@ -597,20 +672,82 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the parallel first-touch
+// initialization is enabled (see the BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements of large
+// matrices are initialized in parallel to place them on the NUMA nodes of the according threads.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n, const Type& init )
+   : alloc_   ()                                 // The allocator of the matrix elements
+   , m_       ( m )                              // The current number of rows of the matrix
+   , n_       ( n )                              // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )                // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                         // The maximum capacity of the matrix
+   , v_       ( allocate( alloc_, capacity_ ) )  // The matrix elements
+{
+   initialize( init, useNUMAFirstTouch );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!rief Constructor for a homogenous initialization of all \f$ m \times n \f$ matrix elements
+//        via parallel first-touch.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the matrix elements.
+//
+// All matrix elements are initialized with the specified value. Independent of the
+// BLAZE_USE_NUMA_FIRST_TOUCH switch, the elements of large matrices are initialized in parallel
+// to place them on the NUMA nodes of the according threads:
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL, 0.0, blaze::firstTouch );
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n, const Type& init, FirstTouch )
+   : alloc_   ()                                 // The allocator of the matrix elements
+   , m_       ( m )                              // The current number of rows of the matrix
+   , n_       ( n )                              // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )                // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                         // The maximum capacity of the matrix
+   , v_       ( allocate( alloc_, capacity_ ) )  // The matrix elements
+{
+   initialize( init, true );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Explicitly uninitialized construction of a \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// This constructor allocates a \f$ m \times n \f$ matrix without initializing its elements.
+// It is meant for matrices that are completely overwritten right after construction. In case
+// the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating point elements
+// are set to NaN in order to reveal accidental reads of uninitialized elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n, Uninitialized )
    : DynamicMatrix( m, n )
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j ) {
-         v_[i*nn_+j] = init;
-      }
+   for( size_t i=0UL; i<m_; ++i ) {
+      poison( v_+i*nn_, v_+i*nn_+n_ );
    }
-
-   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
 //*************************************************************************************************
 
@@ -635,9 +772,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
 // (copy) assigned the values of the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
    : DynamicMatrix( list.size(), determineColumns( list ) )
 {
    size_t i( 0UL );
@@ -676,9 +814,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( initializer_list< initializer_list
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* array )
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n, const Other* array )
    : DynamicMatrix( m, n )
 {
    for( size_t i=0UL; i<m; ++i ) {
@@ -713,12 +852,13 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* a
 // the given array. Missing values are initialized with default values (as e.g. the value 6 in
 // the example).
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Other  // Data type of the initialization array
-        , size_t Rows     // Number of rows of the initialization array
-        , size_t Cols >   // Number of columns of the initialization array
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[Rows][Cols] )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const Other (&array)[Rows][Cols] )
    : DynamicMatrix( Rows, Cols )
 {
    for( size_t i=0UL; i<Rows; ++i ) {
@@ -738,15 +878,31 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[Rows][Cols] )
 // \param m Matrix to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. The allocator of the new matrix is
+// obtained via the \c select_on_container_copy_construction() function of the allocator of
+// the given matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
-   : DynamicMatrix( m.m_, m.n_ )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const DynamicMatrix& m )
+   : alloc_   ( std::allocator_traits<Alloc>::select_on_container_copy_construction( m.alloc_ ) )
+   , m_       ( m.m_ )                           // The current number of rows of the matrix
+   , n_       ( m.n_ )                           // The current number of columns of the matrix
+   , nn_      ( addPadding( m.n_ ) )             // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                         // The maximum capacity of the matrix
+   , v_       ( allocate( alloc_, capacity_ ) )  // The matrix elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            v_[i*nn_+j] = Type();
+         }
+      }
+   }
+
    smpAssign( *this, m );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -758,15 +914,19 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
 /*!\brief The move constructor for DynamicMatrix.
 //
 // \param m The matrix to be move into this instance.
+//
+// The allocator of the given matrix is moved along with the matrix elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( DynamicMatrix&& m ) noexcept
-   : m_       ( m.m_        )  // The current number of rows of the matrix
-   , n_       ( m.n_        )  // The current number of columns of the matrix
-   , nn_      ( m.nn_       )  // The alignment adjusted number of columns
-   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
-   , v_       ( m.v_        )  // The matrix elements
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( DynamicMatrix&& m ) noexcept
+   : alloc_   ( std::move( m.alloc_ ) )  // The allocator of the matrix elements
+   , m_       ( m.m_ )                   // The current number of rows of the matrix
+   , n_       ( m.n_ )                   // The current number of columns of the matrix
+   , nn_      ( m.nn_ )                  // The alignment adjusted number of columns
+   , capacity_( m.capacity_ )            // The maximum capacity of the matrix
+   , v_       ( m.v_ )                   // The matrix elements
 {
    m.m_        = 0UL;
    m.n_        = 0UL;
@@ -782,13 +942,33 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( DynamicMatrix&& m ) noexcept
 //
 // \param m Matrix to be copied.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the foreign matrix
-        , bool SO2 >     // Storage order of the foreign matrix
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
-   : DynamicMatrix( (~m).rows(), (~m).columns() )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign matrix
+        , bool SO2 >        // Storage order of the foreign matrix
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const Matrix<MT,SO2>& m )
+   : DynamicMatrix( m, Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices with the given allocator.
+//
+// \param m Matrix to be copied.
+// \param alloc The allocator of the matrix elements.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign matrix
+        , bool SO2 >        // Storage order of the foreign matrix
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const Matrix<MT,SO2>& m, const Alloc& alloc )
+   : DynamicMatrix( (~m).rows(), (~m).columns(), alloc )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    if( IsSparseMatrix_v<MT> ) {
       reset();
    }
@@ -811,11 +991,12 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
 //*************************************************************************************************
 /*!\brief The destructor for DynamicMatrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::~DynamicMatrix()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::~DynamicMatrix()
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, capacity_ );
 }
 //*************************************************************************************************
 
@@ -838,13 +1019,16 @@ inline DynamicMatrix<Type,SO>::~DynamicMatrix()
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Reference
-   DynamicMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Reference
+   DynamicMatrix<Type,SO,Alloc>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
    return v_[i*nn_+j];
 }
 //*************************************************************************************************
@@ -860,13 +1044,15 @@ inline typename DynamicMatrix<Type,SO>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstReference
-   DynamicMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstReference
+   DynamicMatrix<Type,SO,Alloc>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
    return v_[i*nn_+j];
 }
 //*************************************************************************************************
@@ -883,10 +1069,11 @@ inline typename DynamicMatrix<Type,SO>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Reference
-   DynamicMatrix<Type,SO>::at( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Reference
+   DynamicMatrix<Type,SO,Alloc>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -910,10 +1097,11 @@ inline typename DynamicMatrix<Type,SO>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstReference
-   DynamicMatrix<Type,SO>::at( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstReference
+   DynamicMatrix<Type,SO,Alloc>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -938,11 +1126,14 @@ inline typename DynamicMatrix<Type,SO>::ConstReference
 // respectively, the total number of elements including padding is given by the \c spacing()
 // member function.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Pointer
-   DynamicMatrix<Type,SO>::data() noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Pointer
+   DynamicMatrix<Type,SO,Alloc>::data() noexcept
 {
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
    return v_;
 }
 //*************************************************************************************************
@@ -960,10 +1151,11 @@ inline typename DynamicMatrix<Type,SO>::Pointer
 // respectively, the total number of elements including padding is given by the \c spacing()
 // member function.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstPointer
-   DynamicMatrix<Type,SO>::data() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstPointer
+   DynamicMatrix<Type,SO,Alloc>::data() const noexcept
 {
    return v_;
 }
@@ -978,12 +1170,15 @@ inline typename DynamicMatrix<Type,SO>::ConstPointer
 //
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Pointer
-   DynamicMatrix<Type,SO>::data( size_t i ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Pointer
+   DynamicMatrix<Type,SO,Alloc>::data( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
    return v_ + i*nn_;
 }
 //*************************************************************************************************
@@ -997,10 +1192,11 @@ inline typename DynamicMatrix<Type,SO>::Pointer
 //
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstPointer
-   DynamicMatrix<Type,SO>::data( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstPointer
+   DynamicMatrix<Type,SO,Alloc>::data( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return v_ + i*nn_;
@@ -1019,10 +1215,11 @@ inline typename DynamicMatrix<Type,SO>::ConstPointer
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Iterator
-   DynamicMatrix<Type,SO>::begin( size_t i ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Iterator
+   DynamicMatrix<Type,SO,Alloc>::begin( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return Iterator( v_ + i*nn_ );
@@ -1041,10 +1238,11 @@ inline typename DynamicMatrix<Type,SO>::Iterator
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::begin( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstIterator
+   DynamicMatrix<Type,SO,Alloc>::begin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ );
@@ -1063,10 +1261,11 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstIterator
+   DynamicMatrix<Type,SO,Alloc>::cbegin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ );
@@ -1085,10 +1284,11 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Iterator
-   DynamicMatrix<Type,SO>::end( size_t i ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Iterator
+   DynamicMatrix<Type,SO,Alloc>::end( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return Iterator( v_ + i*nn_ + n_ );
@@ -1107,10 +1307,11 @@ inline typename DynamicMatrix<Type,SO>::Iterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::end( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstIterator
+   DynamicMatrix<Type,SO,Alloc>::end( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ + n_ );
@@ -1129,10 +1330,11 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::cend( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstIterator
+   DynamicMatrix<Type,SO,Alloc>::cend( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ + n_ );
@@ -1154,9 +1356,10 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // \param rhs Scalar value to be assigned to all matrix elements.
 // \return Reference to the assigned matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Type& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( const Type& rhs )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( size_t j=0UL; j<n_; ++j )
@@ -1188,12 +1391,13 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Type& rh
 // (copy) assigned the values from the given initializer list. Missing values are initialized
 // as default (as e.g. the value 6 in the example).
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>&
-   DynamicMatrix<Type,SO>::operator=( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>&
+   DynamicMatrix<Type,SO,Alloc>::operator=( initializer_list< initializer_list<Type> > list )
 {
-   resize( list.size(), determineColumns( list ), false );
+   resize( list.size(), determineColumns( list ), false, uninitialized );
 
    size_t i( 0UL );
 
@@ -1228,14 +1432,15 @@ inline DynamicMatrix<Type,SO>&
 // The matrix is resized according to the size of the array and assigned the values of the given
 // array. Missing values are initialized with default values (as e.g. the value 6 in the example).
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Other  // Data type of the initialization array
-        , size_t Rows     // Number of rows of the initialization array
-        , size_t Cols >   // Number of columns of the initialization array
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Other (&array)[Rows][Cols] )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( const Other (&array)[Rows][Cols] )
 {
-   resize( Rows, Cols, false );
+   resize( Rows, Cols, false, uninitialized );
 
    for( size_t i=0UL; i<Rows; ++i )
       for( size_t j=0UL; j<Cols; ++j )
@@ -1255,13 +1460,14 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Other (&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const DynamicMatrix& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( const DynamicMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
-   resize( rhs.m_, rhs.n_, false );
+   resize( rhs.m_, rhs.n_, false, uninitialized );
    smpAssign( *this, ~rhs );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -1276,13 +1482,17 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const DynamicM
 //
 // \param rhs The matrix to be moved into this instance.
 // \return Reference to the assigned matrix.
+//
+// The allocator of the given matrix is moved along with the matrix elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( DynamicMatrix&& rhs ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( DynamicMatrix&& rhs ) noexcept
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, capacity_ );
 
+   alloc_    = std::move( rhs.alloc_ );
    m_        = rhs.m_;
    n_        = rhs.n_;
    nn_       = rhs.nn_;
@@ -1309,11 +1519,12 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( DynamicMatrix&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( const Matrix<MT,SO2>& rhs )
 {
    using TT = decltype( trans( *this ) );
    using CT = decltype( ctrans( *this ) );
@@ -1326,11 +1537,11 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<M
       ctranspose();
    }
    else if( !IsSame_v<MT,IT> && (~rhs).canAlias( this ) ) {
-      DynamicMatrix tmp( ~rhs );
+      DynamicMatrix tmp( ~rhs, alloc_ );
       swap( tmp );
    }
    else {
-      resize( (~rhs).rows(), (~rhs).columns(), false );
+      resize( (~rhs).rows(), (~rhs).columns(), false, uninitialized );
       if( IsSparseMatrix_v<MT> )
          reset();
       smpAssign( *this, ~rhs );
@@ -1353,11 +1564,12 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<M
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator+=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -1388,11 +1600,12 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator+=( const Matrix<
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator-=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -1423,11 +1636,12 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator-=( const Matrix<
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator%=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator%=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -1461,9 +1675,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator%=( const Matrix<
 //
 // \return The number of rows of the matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::rows() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::rows() const noexcept
 {
    return m_;
 }
@@ -1475,9 +1690,10 @@ inline size_t DynamicMatrix<Type,SO>::rows() const noexcept
 //
 // \return The number of columns of the matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::columns() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::columns() const noexcept
 {
    return n_;
 }
@@ -1494,9 +1710,10 @@ inline size_t DynamicMatrix<Type,SO>::columns() const noexcept
 // the function returns the spacing between two rows, in case the storage flag is set to
 // \a columnMajor the function returns the spacing between two columns.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::spacing() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::spacing() const noexcept
 {
    return nn_;
 }
@@ -1508,9 +1725,10 @@ inline size_t DynamicMatrix<Type,SO>::spacing() const noexcept
 //
 // \return The capacity of the matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::capacity() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -1528,9 +1746,10 @@ inline size_t DynamicMatrix<Type,SO>::capacity() const noexcept
 // in case the storage flag is set to \a columnMajor the function returns the capacity
 // of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::capacity( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::capacity( size_t i ) const noexcept
 {
    MAYBE_UNUSED( i );
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
@@ -1544,9 +1763,10 @@ inline size_t DynamicMatrix<Type,SO>::capacity( size_t i ) const noexcept
 //
 // \return The number of non-zero elements in the dense matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::nonZeros() const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1571,9 +1791,10 @@ inline size_t DynamicMatrix<Type,SO>::nonZeros() const
 // elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
 // the number of non-zero elements in column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::nonZeros( size_t i ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1594,9 +1815,10 @@ inline size_t DynamicMatrix<Type,SO>::nonZeros( size_t i ) const
 //
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reset()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::reset()
 {
    using blaze::clear;
 
@@ -1618,9 +1840,10 @@ inline void DynamicMatrix<Type,SO>::reset()
 // the storage order is set to \a columnMajor the function resets the values in column \a i.
 // Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reset( size_t i )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::reset( size_t i )
 {
    using blaze::clear;
 
@@ -1638,9 +1861,10 @@ inline void DynamicMatrix<Type,SO>::reset( size_t i )
 //
 // After the clear() function, the size of the matrix is 0.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::clear()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::clear()
 {
    resize( 0UL, 0UL, false );
 }
@@ -1681,20 +1905,24 @@ inline void DynamicMatrix<Type,SO>::clear()
                               \end{array}\right)
                               \f]
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void DynamicMatrix<Type,SO,Alloc>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
    using blaze::min;
 
    if( m == m_ && n == n_ ) return;
 
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
    const size_t nn( addPadding( n ) );
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = allocate( alloc_, m*nn );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -1703,13 +1931,13 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       }
 
       swap( v_, v );
-      deallocate( v );
+      deallocate( alloc_, v, capacity_ );
       capacity_ = m*nn;
    }
    else if( m*nn > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = allocate( alloc_, m*nn );
       swap( v_, v );
-      deallocate( v );
+      deallocate( alloc_, v, capacity_ );
       capacity_ = m*nn;
    }
 
@@ -1726,6 +1954,44 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix without initializing new elements.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix to \f$ m \times n \f$ exactly like the default resize()
+// function, but explicitly states that the new matrix elements are not initialized. In case
+// the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all new floating point
+// elements are set to NaN.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::resize( size_t m, size_t n, bool preserve, Uninitialized )
+{
+   using blaze::min;
+
+   if( m == m_ && n == n_ ) return;
+
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
+   const size_t oldM( m_ );
+   const size_t oldN( n_ );
+
+   resize( m, n, preserve );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t jbegin( ( preserve && i < oldM )?( min( n_, oldN ) ):( 0UL ) );
+      poison( v_+i*nn_+jbegin, v_+i*nn_+n_ );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Extending the size of the matrix.
 //
@@ -1740,9 +2006,10 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // values, the \a preserve flag can be set to \a true. However, new matrix elements are not
 // initialized!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::extend( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::extend( size_t m, size_t n, bool preserve )
 {
    resize( m_+m, n_+n, preserve );
 }
@@ -1758,16 +2025,17 @@ inline void DynamicMatrix<Type,SO>::extend( size_t m, size_t n, bool preserve )
 // This function increases the capacity of the dense matrix to at least \a elements elements.
 // The current values of the matrix elements are preserved.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::reserve( size_t elements )
 {
    using std::swap;
 
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, elements );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -1779,7 +2047,7 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      deallocate( alloc_, tmp, capacity_ );
       capacity_ = elements;
    }
 }
@@ -1796,9 +2064,10 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 // Please also note that in case a reallocation occurs, all iterators (including end() iterators),
 // all pointers and references to elements of this matrix are invalidated.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::shrinkToFit()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::shrinkToFit()
 {
    if( ( m_ * nn_ ) < capacity_ ) {
       DynamicMatrix( *this ).swap( *this );
@@ -1812,13 +2081,17 @@ inline void DynamicMatrix<Type,SO>::shrinkToFit()
 //
 // \param m The matrix to be swapped.
 // \return void
+//
+// The allocators of the two matrices are swapped along with the matrix elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::swap( DynamicMatrix& m ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::swap( DynamicMatrix& m ) noexcept
 {
    using std::swap;
 
+   swap( alloc_, m.alloc_ );
    swap( m_ , m.m_  );
    swap( n_ , m.n_  );
    swap( nn_, m.nn_ );
@@ -1837,9 +2110,10 @@ inline void DynamicMatrix<Type,SO>::swap( DynamicMatrix& m ) noexcept
 // This function increments the given \a value by the necessary amount of padding based on the
 // vector's data type \a Type.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::addPadding( size_t value ) const noexcept
 {
    if( usePadding && IsVectorizable_v<Type> )
       return nextMultiple<size_t>( value, SIMDSIZE );
@@ -1848,6 +2122,49 @@ inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Homogeneous initialization of all matrix elements, including the padding elements.
+//
+// \param init The initial value of the matrix elements.
+// \param parallel \a true for a parallel first-touch initialization, \a false if not.
+// \return void
+//
+// In case of a parallel initialization the complete rows (including the padding elements) are
+// assigned via smpAssign(), which writes every memory page of the matrix for the first time from
+// the thread that works on it in all subsequent SMP assignments. Inside an active parallel
+// section the matrix is initialized serially.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::initialize( const Type& init, bool parallel )
+{
+   if( parallel && !isParallelSectionActive() ) {
+      CustomMatrix<Type,unaligned,unpadded,SO> tmp( v_, m_, nn_ );
+      smpAssign( tmp, UniformMatrix<Type,SO>( m_, nn_, init ) );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            for( size_t j=n_; j<nn_; ++j ) {
+               v_[i*nn_+j] = Type();
+            }
+         }
+      }
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            v_[i*nn_+j] = init;
+         }
+         for( size_t j=n_; j<nn_; ++j ) {
+            v_[i*nn_+j] = Type();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1861,31 +2178,28 @@ inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
+   waitForAsyncAssignments( *this, *this );
 
    if( m_ == n_ )
    {
-      for( size_t ii=0UL; ii<m_; ii+=block ) {
-         const size_t iend( min( ii+block, m_ ) );
-         for( size_t jj=0UL; jj<=ii; jj+=block ) {
-            for( size_t i=ii; i<iend; ++i ) {
-               const size_t jend( min( jj+block, n_, i ) );
-               for( size_t j=jj; j<jend; ++j ) {
-                  swap( v_[i*nn_+j], v_[j*nn_+i] );
-               }
-            }
-         }
-      }
+      smpTranspose( *this );
+   }
+   else if( nn_ == n_ && addPadding( m_ ) == m_ )
+   {
+      transposeCycleKernel<false>( v_, m_, n_ );
+      swap( m_, n_ );
+      nn_ = n_;
    }
    else
    {
-      DynamicMatrix tmp( trans(*this) );
+      DynamicMatrix tmp( trans(*this), alloc_ );
       this->swap( tmp );
    }
 
@@ -1899,36 +2213,29 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::ctranspose()
 {
-   constexpr size_t block( BLOCK_SIZE );
+   using std::swap;
+
+   waitForAsyncAssignments( *this, *this );
 
    if( m_ == n_ )
    {
-      for( size_t ii=0UL; ii<m_; ii+=block ) {
-         const size_t iend( min( ii+block, m_ ) );
-         for( size_t jj=0UL; jj<ii; jj+=block ) {
-            const size_t jend( min( jj+block, n_ ) );
-            for( size_t i=ii; i<iend; ++i ) {
-               for( size_t j=jj; j<jend; ++j ) {
-                  cswap( v_[i*nn_+j], v_[j*nn_+i] );
-               }
-            }
-         }
-         for( size_t i=ii; i<iend; ++i ) {
-            for( size_t j=ii; j<i; ++j ) {
-               cswap( v_[i*nn_+j], v_[j*nn_+i] );
-            }
-            conjugate( v_[i*nn_+i] );
-         }
-      }
+      smpCTranspose( *this );
+   }
+   else if( nn_ == n_ && addPadding( m_ ) == m_ )
+   {
+      transposeCycleKernel<true>( v_, m_, n_ );
+      swap( m_, n_ );
+      nn_ = n_;
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      swap( tmp );
+      DynamicMatrix tmp( ctrans(*this), alloc_ );
+      this->swap( tmp );
    }
 
    return *this;
@@ -1954,9 +2261,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
    \endcode
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::scale( const Other& scalar )
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( size_t j=0UL; j<n_; ++j )
@@ -1984,9 +2292,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::scale( const Other& scala
 // state is valid. In case the invariants are intact, the function returns \a true, else it
 // will return \a false.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool DynamicMatrix<Type,SO>::isIntact() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,SO,Alloc>::isIntact() const noexcept
 {
    if( m_ * n_ > capacity_ )
       return false;
@@ -2024,9 +2333,10 @@ inline bool DynamicMatrix<Type,SO>::isIntact() const noexcept
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+inline bool DynamicMatrix<Type,SO,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2044,9 +2354,10 @@ inline bool DynamicMatrix<Type,SO>::canAlias( const Other* alias ) const noexcep
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+inline bool DynamicMatrix<Type,SO,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2062,9 +2373,10 @@ inline bool DynamicMatrix<Type,SO>::isAliased( const Other* alias ) const noexce
 // whether the beginning and the end of each row/column of the matrix are guaranteed to conform
 // to the alignment restrictions of the element type \a Type.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool DynamicMatrix<Type,SO>::isAligned() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,SO,Alloc>::isAligned() const noexcept
 {
    return ( usePadding || columns() % SIMDSIZE == 0UL );
 }
@@ -2081,11 +2393,12 @@ inline bool DynamicMatrix<Type,SO>::isAligned() const noexcept
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool DynamicMatrix<Type,SO>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,SO,Alloc>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 //*************************************************************************************************
 
@@ -2105,10 +2418,11 @@ inline bool DynamicMatrix<Type,SO>::canSMPAssign() const noexcept
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
-   DynamicMatrix<Type,SO>::load( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO,Alloc>::SIMDType
+   DynamicMatrix<Type,SO,Alloc>::load( size_t i, size_t j ) const noexcept
 {
    if( usePadding )
       return loada( i, j );
@@ -2133,10 +2447,11 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
-   DynamicMatrix<Type,SO>::loada( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO,Alloc>::SIMDType
+   DynamicMatrix<Type,SO,Alloc>::loada( size_t i, size_t j ) const noexcept
 {
    using blaze::loada;
 
@@ -2168,10 +2483,11 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
-   DynamicMatrix<Type,SO>::loadu( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO,Alloc>::SIMDType
+   DynamicMatrix<Type,SO,Alloc>::loadu( size_t i, size_t j ) const noexcept
 {
    using blaze::loadu;
 
@@ -2202,10 +2518,11 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,SO,Alloc>::store( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    if( usePadding )
       storea( i, j, value );
@@ -2231,10 +2548,11 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,SO,Alloc>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storea;
 
@@ -2267,10 +2585,11 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,SO,Alloc>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storeu;
 
@@ -2302,10 +2621,11 @@ BLAZE_ALWAYS_INLINE void
 // templates. Calling this function explicitly might result in erroneous results and/or in
 // compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,SO,Alloc>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::stream;
 
@@ -2333,10 +2653,11 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO,Alloc>::assign( const DenseMatrix<MT,SO>& rhs )
    -> DisableIf_t< VectorizedAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2369,10 +2690,11 @@ inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO,Alloc>::assign( const DenseMatrix<MT,SO>& rhs )
    -> EnableIf_t< VectorizedAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2439,10 +2761,11 @@ inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,SO,Alloc>::assign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2477,10 +2800,11 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2503,10 +2827,11 @@ inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2531,10 +2856,11 @@ inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO,Alloc>::addAssign( const DenseMatrix<MT,SO>& rhs )
    -> DisableIf_t< VectorizedAddAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2582,10 +2908,11 @@ inline auto DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO,Alloc>::addAssign( const DenseMatrix<MT,SO>& rhs )
    -> EnableIf_t< VectorizedAddAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2641,10 +2968,11 @@ inline auto DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,SO,Alloc>::addAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2691,10 +3019,11 @@ inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2717,10 +3046,11 @@ inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::addAssign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2745,10 +3075,11 @@ inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO,Alloc>::subAssign( const DenseMatrix<MT,SO>& rhs )
    -> DisableIf_t< VectorizedSubAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2796,10 +3127,11 @@ inline auto DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO,Alloc>::subAssign( const DenseMatrix<MT,SO>& rhs )
    -> EnableIf_t< VectorizedSubAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2855,10 +3187,11 @@ inline auto DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,SO,Alloc>::subAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2905,10 +3238,11 @@ inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2931,10 +3265,11 @@ inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::subAssign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2959,10 +3294,11 @@ inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO,Alloc>::schurAssign( const DenseMatrix<MT,SO>& rhs )
    -> DisableIf_t< VectorizedSchurAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2995,10 +3331,11 @@ inline auto DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO,Alloc>::schurAssign( const DenseMatrix<MT,SO>& rhs )
    -> EnableIf_t< VectorizedSchurAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -3045,10 +3382,11 @@ inline auto DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,SO,Alloc>::schurAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -3083,10 +3421,11 @@ inline void DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,!SO>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::schurAssign( const SparseMatrix<MT,SO>& rhs )
 {
    using blaze::reset;
 
@@ -3123,10 +3462,11 @@ inline void DynamicMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,SO>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::schurAssign( const SparseMatrix<MT,!SO>& rhs )
 {
    using blaze::reset;
 
@@ -3174,21 +3514,23 @@ inline void DynamicMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,!SO>& rhs
 // This specialization of DynamicMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the matrix
-class DynamicMatrix<Type,true>
-   : public DenseMatrix< DynamicMatrix<Type,true>, true >
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+class DynamicMatrix<Type,true,Alloc>
+   : public DenseMatrix< DynamicMatrix<Type,true,Alloc>, true >
 {
  public:
    //**Type definitions****************************************************************************
-   using This          = DynamicMatrix<Type,true>;   //!< Type of this DynamicMatrix instance.
-   using BaseType      = DenseMatrix<This,true>;     //!< Base type of this DynamicMatrix instance.
-   using ResultType    = This;                       //!< Result type for expression template evaluations.
-   using OppositeType  = DynamicMatrix<Type,false>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType = DynamicMatrix<Type,false>;  //!< Transpose type for expression template evaluations.
-   using ElementType   = Type;                       //!< Type of the matrix elements.
-   using SIMDType      = SIMDTrait_t<ElementType>;   //!< SIMD type of the matrix elements.
-   using ReturnType    = const Type&;                //!< Return type for expression template evaluations.
-   using CompositeType = const This&;                //!< Data type for composite expression templates.
+   using This          = DynamicMatrix<Type,true,Alloc>;   //!< Type of this DynamicMatrix instance.
+   using BaseType      = DenseMatrix<This,true>;           //!< Base type of this DynamicMatrix instance.
+   using ResultType    = This;                             //!< Result type for expression template evaluations.
+   using OppositeType  = DynamicMatrix<Type,false,Alloc>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = DynamicMatrix<Type,false,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                             //!< Type of the matrix elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;         //!< SIMD type of the matrix elements.
+   using ReturnType    = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType = const This&;                      //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                            //!< Type of the allocator of the matrix elements.
 
    using Reference      = Type&;        //!< Reference to a non-constant matrix value.
    using ConstReference = const Type&;  //!< Reference to a constant matrix value.
@@ -3204,7 +3546,8 @@ class DynamicMatrix<Type,true>
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = DynamicMatrix<NewType,true>;  //!< The type of the other DynamicMatrix.
+      using NewAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NewType>;  //!< Type of the rebound allocator.
+      using Other    = DynamicMatrix<NewType,true,NewAlloc>;                                   //!< The type of the other DynamicMatrix.
    };
    //**********************************************************************************************
 
@@ -3214,7 +3557,7 @@ class DynamicMatrix<Type,true>
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = DynamicMatrix<Type,true>;  //!< The type of the other DynamicMatrix.
+      using Other = DynamicMatrix<Type,true,Alloc>;  //!< The type of the other DynamicMatrix.
    };
    //**********************************************************************************************
 
@@ -3237,8 +3580,12 @@ class DynamicMatrix<Type,true>
    /*!\name Constructors */
    //@{
    explicit inline DynamicMatrix() noexcept;
+   explicit inline DynamicMatrix( const Alloc& alloc ) noexcept;
    explicit inline DynamicMatrix( size_t m, size_t n );
+   explicit inline DynamicMatrix( size_t m, size_t n, const Alloc& alloc );
    explicit inline DynamicMatrix( size_t m, size_t n, const Type& init );
+   explicit inline DynamicMatrix( size_t m, size_t n, const Type& init, FirstTouch );
+   explicit inline DynamicMatrix( size_t m, size_t n, Uninitialized );
             inline DynamicMatrix( initializer_list< initializer_list<Type> > list );
 
    template< typename Other > explicit inline DynamicMatrix( size_t m, size_t n, const Other* array );
@@ -3249,6 +3596,7 @@ class DynamicMatrix<Type,true>
                                     inline DynamicMatrix( const DynamicMatrix& m );
                                     inline DynamicMatrix( DynamicMatrix&& m );
    template< typename MT, bool SO > inline DynamicMatrix( const Matrix<MT,SO>& m );
+   template< typename MT, bool SO > inline DynamicMatrix( const Matrix<MT,SO>& m, const Alloc& alloc );
    //@}
    //**********************************************************************************************
 
@@ -3312,6 +3660,7 @@ class DynamicMatrix<Type,true>
    inline void   reset( size_t j );
    inline void   clear();
           void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   resize ( size_t m, size_t n, bool preserve, Uninitialized );
    inline void   extend ( size_t m, size_t n, bool preserve=true );
    inline void   reserve( size_t elements );
    inline void   shrinkToFit();
@@ -3449,12 +3798,14 @@ class DynamicMatrix<Type,true>
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t minRows ) const noexcept;
+   inline void   initialize( const Type& init, bool parallel );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   Alloc alloc_;             //!< The allocator of the matrix elements.
    size_t m_;                //!< The current number of rows of the matrix.
    size_t mm_;               //!< The alignment adjusted number of rows.
    size_t n_;                //!< The current number of columns of the matrix.
@@ -3470,6 +3821,7 @@ class DynamicMatrix<Type,true>
    BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE         ( Type, typename std::allocator_traits<Alloc>::value_type );
    //**********************************************************************************************
 };
 /*! \endcond */
@@ -3488,13 +3840,54 @@ class DynamicMatrix<Type,true>
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for DynamicMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
-   : m_       ( 0UL )      // The current number of rows of the matrix
-   , mm_      ( 0UL )      // The alignment adjusted number of rows
-   , n_       ( 0UL )      // The current number of columns of the matrix
-   , capacity_( 0UL )      // The maximum capacity of the matrix
-   , v_       ( nullptr )  // The matrix elements
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix() noexcept
+   : alloc_   ()           // The allocator of the matrix elements
+   , m_       ( 0UL )      // The current number of rows of the matrix
+   , mm_      ( 0UL )      // The alignment adjusted number of rows
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an empty matrix with the given allocator.
+//
+// \param alloc The allocator of the matrix elements.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const Alloc& alloc ) noexcept
+   : alloc_   ( alloc )    // The allocator of the matrix elements
+   , m_       ( 0UL )      // The current number of rows of the matrix
+   , mm_      ( 0UL )      // The alignment adjusted number of rows
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$. No element initialization is performed!
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n )
+   : DynamicMatrix( m, n, Alloc() )
 {}
 /*! \endcond */
 //*************************************************************************************************
@@ -3502,21 +3895,25 @@ inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Constructor for a matrix of size \f$ m \times n \f$. No element initialization is performed!
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$ with the given allocator. No element
+//        initialization is performed!
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator of the matrix elements.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
 // element initialization is performed!
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n, const Alloc& alloc )
+   : alloc_   ( alloc )                          // The allocator of the matrix elements
+   , m_       ( m )                              // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )                // The alignment adjusted number of rows
+   , n_       ( n )                              // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                         // The maximum capacity of the matrix
+   , v_       ( allocate( alloc_, capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable_v<Type> ) {
       for( size_t j=0UL; j<n_; ++j ) {
@@ -3540,19 +3937,79 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the parallel first-touch
+// initialization is enabled (see the BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements of large
+// matrices are initialized in parallel to place them on the NUMA nodes of the according threads.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n, const Type& init )
+   : alloc_   ()                                 // The allocator of the matrix elements
+   , m_       ( m )                              // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )                // The alignment adjusted number of rows
+   , n_       ( n )                              // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                         // The maximum capacity of the matrix
+   , v_       ( allocate( alloc_, capacity_ ) )  // The matrix elements
+{
+   initialize( init, useNUMAFirstTouch );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a homogenous initialization of all \f$ m \times n \f$ matrix elements
+//        via parallel first-touch.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the matrix elements.
+//
+// All matrix elements are initialized with the specified value. Independent of the
+// BLAZE_USE_NUMA_FIRST_TOUCH switch, the elements of large matrices are initialized in parallel
+// to place them on the NUMA nodes of the according threads.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n, const Type& init, FirstTouch )
+   : alloc_   ()                                 // The allocator of the matrix elements
+   , m_       ( m )                              // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )                // The alignment adjusted number of rows
+   , n_       ( n )                              // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                         // The maximum capacity of the matrix
+   , v_       ( allocate( alloc_, capacity_ ) )  // The matrix elements
+{
+   initialize( init, true );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Explicitly uninitialized construction of a \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// This constructor allocates a \f$ m \times n \f$ matrix without initializing its elements.
+// It is meant for matrices that are completely overwritten right after construction. In case
+// the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating point elements
+// are set to NaN in order to reveal accidental reads of uninitialized elements.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n, Uninitialized )
    : DynamicMatrix( m, n )
 {
    for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         v_[i+j*mm_] = init;
-      }
+      poison( v_+j*mm_, v_+j*mm_+m_ );
    }
-
-   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3579,8 +4036,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
 // (copy) assigned the values of the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
    : DynamicMatrix( list.size(), determineColumns( list ) )
 {
    size_t i( 0UL );
@@ -3628,9 +4086,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( initializer_list< initializer_li
 // from the given array. Note that it is expected that the given \a array has at least \a m by
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other* array )
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n, const Other* array )
    : DynamicMatrix( m, n )
 {
    for( size_t j=0UL; j<n; ++j ) {
@@ -3667,11 +4126,12 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other*
 // the given array. Missing values are initialized with default values (as e.g. the value 6 in
 // the example).
 */
-template< typename Type >  // Data type of the matrix
-template< typename Other   // Data type of the initialization array
-        , size_t Rows      // Number of rows of the initialization array
-        , size_t Cols >    // Number of columns of the initialization array
-inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[Rows][Cols] )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const Other (&array)[Rows][Cols] )
    : DynamicMatrix( Rows, Cols )
 {
    for( size_t j=0UL; j<Cols; ++j ) {
@@ -3693,14 +4153,30 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[Rows][Cols]
 // \param m Matrix to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. The allocator of the new matrix is
+// obtained via the \c select_on_container_copy_construction() function of the allocator of
+// the given matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
-   : DynamicMatrix( m.m_, m.n_ )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const DynamicMatrix& m )
+   : alloc_   ( std::allocator_traits<Alloc>::select_on_container_copy_construction( m.alloc_ ) )
+   , m_       ( m.m_ )                           // The current number of rows of the matrix
+   , mm_      ( addPadding( m.m_ ) )             // The alignment adjusted number of rows
+   , n_       ( m.n_ )                           // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                         // The maximum capacity of the matrix
+   , v_       ( allocate( alloc_, capacity_ ) )  // The matrix elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
+   if( IsVectorizable_v<Type> ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=m_; i<mm_; ++i ) {
+            v_[i+j*mm_] = Type();
+         }
+      }
+   }
+
    smpAssign( *this, m );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -3714,14 +4190,18 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
 /*!\brief The move constructor for DynamicMatrix.
 //
 // \param m The matrix to be moved into this instance.
+//
+// The allocator of the given matrix is moved along with the matrix elements.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( DynamicMatrix&& m )
-   : m_       ( m.m_        )  // The current number of rows of the matrix
-   , mm_      ( m.mm_       )  // The alignment adjusted number of rows
-   , n_       ( m.n_        )  // The current number of columns of the matrix
-   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
-   , v_       ( m.v_        )  // The matrix elements
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( DynamicMatrix&& m )
+   : alloc_   ( std::move( m.alloc_ ) )  // The allocator of the matrix elements
+   , m_       ( m.m_ )                   // The current number of rows of the matrix
+   , mm_      ( m.mm_ )                  // The alignment adjusted number of rows
+   , n_       ( m.n_ )                   // The current number of columns of the matrix
+   , capacity_( m.capacity_ )            // The maximum capacity of the matrix
+   , v_       ( m.v_ )                   // The matrix elements
 {
    m.m_        = 0UL;
    m.mm_       = 0UL;
@@ -3739,12 +4219,33 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( DynamicMatrix&& m )
 //
 // \param m Matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the foreign matrix
-        , bool SO >        // Storage order of the foreign matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
-   : DynamicMatrix( (~m).rows(), (~m).columns() )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign matrix
+        , bool SO >         // Storage order of the foreign matrix
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const Matrix<MT,SO>& m )
+   : DynamicMatrix( m, Alloc() )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from different matrices with the given allocator.
+//
+// \param m Matrix to be copied.
+// \param alloc The allocator of the matrix elements.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign matrix
+        , bool SO >         // Storage order of the foreign matrix
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const Matrix<MT,SO>& m, const Alloc& alloc )
+   : DynamicMatrix( (~m).rows(), (~m).columns(), alloc )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    if( IsSparseMatrix_v<MT> ) {
       reset();
    }
@@ -3769,10 +4270,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for DynamicMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::~DynamicMatrix()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::~DynamicMatrix()
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, capacity_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3797,12 +4299,15 @@ inline DynamicMatrix<Type,true>::~DynamicMatrix()
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Reference
-   DynamicMatrix<Type,true>::operator()( size_t i, size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Reference
+   DynamicMatrix<Type,true,Alloc>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
    return v_[i+j*mm_];
 }
 /*! \endcond */
@@ -3820,12 +4325,14 @@ inline typename DynamicMatrix<Type,true>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstReference
-   DynamicMatrix<Type,true>::operator()( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstReference
+   DynamicMatrix<Type,true,Alloc>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
    return v_[i+j*mm_];
 }
 /*! \endcond */
@@ -3844,9 +4351,10 @@ inline typename DynamicMatrix<Type,true>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Reference
-   DynamicMatrix<Type,true>::at( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Reference
+   DynamicMatrix<Type,true,Alloc>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3872,9 +4380,10 @@ inline typename DynamicMatrix<Type,true>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstReference
-   DynamicMatrix<Type,true>::at( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstReference
+   DynamicMatrix<Type,true,Alloc>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3900,10 +4409,13 @@ inline typename DynamicMatrix<Type,true>::ConstReference
 // elements within a column are given by the \c columns() member functions, the total number
 // of elements including padding is given by the \c spacing() member function.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Pointer
-   DynamicMatrix<Type,true>::data() noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Pointer
+   DynamicMatrix<Type,true,Alloc>::data() noexcept
 {
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
    return v_;
 }
 /*! \endcond */
@@ -3922,9 +4434,10 @@ inline typename DynamicMatrix<Type,true>::Pointer
 // elements within a column are given by the \c columns() member functions, the total number
 // of elements including padding is given by the \c spacing() member function.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstPointer
-   DynamicMatrix<Type,true>::data() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstPointer
+   DynamicMatrix<Type,true,Alloc>::data() const noexcept
 {
    return v_;
 }
@@ -3941,11 +4454,14 @@ inline typename DynamicMatrix<Type,true>::ConstPointer
 //
 // This function returns a pointer to the internal storage for the elements in column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Pointer
-   DynamicMatrix<Type,true>::data( size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Pointer
+   DynamicMatrix<Type,true,Alloc>::data( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
    return v_ + j*mm_;
 }
 /*! \endcond */
@@ -3961,9 +4477,10 @@ inline typename DynamicMatrix<Type,true>::Pointer
 //
 // This function returns a pointer to the internal storage for the elements in column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstPointer
-   DynamicMatrix<Type,true>::data( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstPointer
+   DynamicMatrix<Type,true,Alloc>::data( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return v_ + j*mm_;
@@ -3979,9 +4496,10 @@ inline typename DynamicMatrix<Type,true>::ConstPointer
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Iterator
-   DynamicMatrix<Type,true>::begin( size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Iterator
+   DynamicMatrix<Type,true,Alloc>::begin( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return Iterator( v_ + j*mm_ );
@@ -3997,9 +4515,10 @@ inline typename DynamicMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::begin( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstIterator
+   DynamicMatrix<Type,true,Alloc>::begin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ );
@@ -4015,9 +4534,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::cbegin( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstIterator
+   DynamicMatrix<Type,true,Alloc>::cbegin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ );
@@ -4033,9 +4553,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Iterator
-   DynamicMatrix<Type,true>::end( size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Iterator
+   DynamicMatrix<Type,true,Alloc>::end( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return Iterator( v_ + j*mm_ + m_ );
@@ -4051,9 +4572,10 @@ inline typename DynamicMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::end( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstIterator
+   DynamicMatrix<Type,true,Alloc>::end( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ + m_ );
@@ -4069,9 +4591,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::cend( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstIterator
+   DynamicMatrix<Type,true,Alloc>::cend( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ + m_ );
@@ -4095,8 +4618,9 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param rhs Scalar value to be assigned to all matrix elements.
 // \return Reference to the assigned matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Type& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( const Type& rhs )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( size_t i=0UL; i<m_; ++i )
@@ -4130,11 +4654,12 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Type
 // (copy) assigned the values from the given initializer list. Missing values are initialized
 // as default (as e.g. the value 6 in the example).
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>&
-   DynamicMatrix<Type,true>::operator=( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>&
+   DynamicMatrix<Type,true,Alloc>::operator=( initializer_list< initializer_list<Type> > list )
 {
-   resize( list.size(), determineColumns( list ), false );
+   resize( list.size(), determineColumns( list ), false, uninitialized );
 
    size_t i( 0UL );
 
@@ -4178,13 +4703,14 @@ inline DynamicMatrix<Type,true>&
 // The matrix is resized according to the size of the array and assigned the values of the given
 // array. Missing values are initialized with default values (as e.g. the value 6 in the example).
 */
-template< typename Type >  // Data type of the matrix
-template< typename Other   // Data type of the initialization array
-        , size_t Rows      // Number of rows of the initialization array
-        , size_t Cols >    // Number of columns of the initialization array
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Other (&array)[Rows][Cols] )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( const Other (&array)[Rows][Cols] )
 {
-   resize( Rows, Cols, false );
+   resize( Rows, Cols, false, uninitialized );
 
    for( size_t j=0UL; j<Cols; ++j )
       for( size_t i=0UL; i<Rows; ++i )
@@ -4206,12 +4732,13 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Othe
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const DynamicMatrix& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( const DynamicMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
-   resize( rhs.m_, rhs.n_, false );
+   resize( rhs.m_, rhs.n_, false, uninitialized );
    smpAssign( *this, ~rhs );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -4228,12 +4755,16 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Dyna
 //
 // \param rhs The matrix to be moved into this instance.
 // \return Reference to the assigned matrix.
+//
+// The allocator of the given matrix is moved along with the matrix elements.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( DynamicMatrix&& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( DynamicMatrix&& rhs )
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, capacity_ );
 
+   alloc_    = std::move( rhs.alloc_ );
    m_        = rhs.m_;
    mm_       = rhs.mm_;
    n_        = rhs.n_;
@@ -4262,10 +4793,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( DynamicMat
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( const Matrix<MT,SO>& rhs )
 {
    using TT = decltype( trans( *this ) );
    using CT = decltype( ctrans( *this ) );
@@ -4278,11 +4810,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matr
       ctranspose();
    }
    else if( !IsSame_v<MT,IT> && (~rhs).canAlias( this ) ) {
-      DynamicMatrix tmp( ~rhs );
+      DynamicMatrix tmp( ~rhs, alloc_ );
       swap( tmp );
    }
    else {
-      resize( (~rhs).rows(), (~rhs).columns(), false );
+      resize( (~rhs).rows(), (~rhs).columns(), false, uninitialized );
       if( IsSparseMatrix_v<MT> )
          reset();
       smpAssign( *this, ~rhs );
@@ -4307,10 +4839,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matr
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator+=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -4343,10 +4876,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator+=( const Mat
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator-=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -4379,10 +4913,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator-=( const Mat
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator%=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator%=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -4418,8 +4953,9 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator%=( const Mat
 //
 // \return The number of rows of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::rows() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::rows() const noexcept
 {
    return m_;
 }
@@ -4433,8 +4969,9 @@ inline size_t DynamicMatrix<Type,true>::rows() const noexcept
 //
 // \return The number of columns of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::columns() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::columns() const noexcept
 {
    return n_;
 }
@@ -4451,8 +4988,9 @@ inline size_t DynamicMatrix<Type,true>::columns() const noexcept
 // This function returns the spacing between the beginning of two column, i.e. the total number
 // of elements of a column.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::spacing() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::spacing() const noexcept
 {
    return mm_;
 }
@@ -4466,8 +5004,9 @@ inline size_t DynamicMatrix<Type,true>::spacing() const noexcept
 //
 // \return The capacity of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::capacity() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -4482,8 +5021,9 @@ inline size_t DynamicMatrix<Type,true>::capacity() const noexcept
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::capacity( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::capacity( size_t j ) const noexcept
 {
    MAYBE_UNUSED( j );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -4499,8 +5039,9 @@ inline size_t DynamicMatrix<Type,true>::capacity( size_t j ) const noexcept
 //
 // \return The number of non-zero elements in the dense matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::nonZeros() const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -4522,8 +5063,9 @@ inline size_t DynamicMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -4546,8 +5088,9 @@ inline size_t DynamicMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::reset()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::reset()
 {
    using blaze::clear;
 
@@ -4569,8 +5112,9 @@ inline void DynamicMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::reset( size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::reset( size_t j )
 {
    using blaze::clear;
 
@@ -4590,8 +5134,9 @@ inline void DynamicMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the matrix is 0.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::clear()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::clear()
 {
    resize( 0UL, 0UL, false );
 }
@@ -4634,19 +5179,23 @@ inline void DynamicMatrix<Type,true>::clear()
                               \end{array}\right)
                               \f]
 */
-template< typename Type >  // Data type of the matrix
-void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+void DynamicMatrix<Type,true,Alloc>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
    using blaze::min;
 
    if( m == m_ && n == n_ ) return;
 
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
    const size_t mm( addPadding( m ) );
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = allocate( alloc_, mm*n );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -4655,13 +5204,13 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       }
 
       swap( v_, v );
-      deallocate( v );
+      deallocate( alloc_, v, capacity_ );
       capacity_ = mm*n;
    }
    else if( mm*n > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = allocate( alloc_, mm*n );
       swap( v_, v );
-      deallocate( v );
+      deallocate( alloc_, v, capacity_ );
       capacity_ = mm*n;
    }
 
@@ -4679,6 +5228,45 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changing the size of the matrix without initializing new elements.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix to \f$ m \times n \f$ exactly like the default resize()
+// function, but explicitly states that the new matrix elements are not initialized. In case
+// the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all new floating point
+// elements are set to NaN.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::resize( size_t m, size_t n, bool preserve, Uninitialized )
+{
+   using blaze::min;
+
+   if( m == m_ && n == n_ ) return;
+
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
+   const size_t oldM( m_ );
+   const size_t oldN( n_ );
+
+   resize( m, n, preserve );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      const size_t ibegin( ( preserve && j < oldN )?( min( m_, oldM ) ):( 0UL ) );
+      poison( v_+j*mm_+ibegin, v_+j*mm_+m_ );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Extending the size of the matrix.
@@ -4694,8 +5282,9 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // values, the \a preserve flag can be set to \a true. However, new matrix elements are not
 // initialized!
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::extend( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::extend( size_t m, size_t n, bool preserve )
 {
    resize( m_+m, n_+n, preserve );
 }
@@ -4713,15 +5302,16 @@ inline void DynamicMatrix<Type,true>::extend( size_t m, size_t n, bool preserve
 // This function increases the capacity of the dense matrix to at least \a elements elements.
 // The current values of the matrix elements are preserved.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::reserve( size_t elements )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::reserve( size_t elements )
 {
    using std::swap;
 
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, elements );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -4733,7 +5323,7 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      deallocate( alloc_, tmp, capacity_ );
       capacity_ = elements;
    }
 }
@@ -4752,8 +5342,9 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 // Please also note that in case a reallocation occurs, all iterators (including end() iterators),
 // all pointers and references to elements of this matrix are invalidated.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::shrinkToFit()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::shrinkToFit()
 {
    if( ( mm_ * n_ ) < capacity_ ) {
       DynamicMatrix( *this ).swap( *this );
@@ -4769,12 +5360,16 @@ inline void DynamicMatrix<Type,true>::shrinkToFit()
 //
 // \param m The matrix to be swapped.
 // \return void
+//
+// The allocators of the two matrices are swapped along with the matrix elements.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::swap( DynamicMatrix& m ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::swap( DynamicMatrix& m ) noexcept
 {
    using std::swap;
 
+   swap( alloc_, m.alloc_ );
    swap( m_ , m.m_  );
    swap( mm_, m.mm_ );
    swap( n_ , m.n_  );
@@ -4795,8 +5390,9 @@ inline void DynamicMatrix<Type,true>::swap( DynamicMatrix& m ) noexcept
 // This function increments the given \a value by the necessary amount of padding based on the
 // vector's data type \a Type.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::addPadding( size_t values ) const noexcept
 {
    if( usePadding && IsVectorizable_v<Type> )
       return nextMultiple<size_t>( values, SIMDSIZE );
@@ -4806,6 +5402,50 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Homogeneous initialization of all matrix elements, including the padding elements.
+//
+// \param init The initial value of the matrix elements.
+// \param parallel \a true for a parallel first-touch initialization, \a false if not.
+// \return void
+//
+// In case of a parallel initialization the complete columns (including the padding elements)
+// are assigned via smpAssign(), which writes every memory page of the matrix for the first time
+// from the thread that works on it in all subsequent SMP assignments. Inside an active parallel
+// section the matrix is initialized serially.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::initialize( const Type& init, bool parallel )
+{
+   if( parallel && !isParallelSectionActive() ) {
+      CustomMatrix<Type,unaligned,unpadded,true> tmp( v_, mm_, n_ );
+      smpAssign( tmp, UniformMatrix<Type,true>( mm_, n_, init ) );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            for( size_t i=m_; i<mm_; ++i ) {
+               v_[i+j*mm_] = Type();
+            }
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            v_[i+j*mm_] = init;
+         }
+         for( size_t i=m_; i<mm_; ++i ) {
+            v_[i+j*mm_] = Type();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -4820,30 +5460,27 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
+   waitForAsyncAssignments( *this, *this );
 
    if( m_ == n_ )
    {
-      for( size_t jj=0UL; jj<n_; jj+=block ) {
-         const size_t jend( min( jj+block, n_ ) );
-         for( size_t ii=0UL; ii<=jj; ii+=block ) {
-            for( size_t j=jj; j<jend; ++j ) {
-               const size_t iend( min( ii+block, m_, j ) );
-               for( size_t i=ii; i<iend; ++i ) {
-                  swap( v_[i+j*mm_], v_[j+i*mm_] );
-               }
-            }
-         }
-      }
+      smpTranspose( *this );
+   }
+   else if( mm_ == m_ && addPadding( n_ ) == n_ )
+   {
+      transposeCycleKernel<false>( v_, n_, m_ );
+      swap( m_, n_ );
+      mm_ = m_;
    }
    else
    {
-      DynamicMatrix tmp( trans(*this) );
+      DynamicMatrix tmp( trans(*this), alloc_ );
       this->swap( tmp );
    }
 
@@ -4859,34 +5496,27 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::ctranspose()
 {
-   constexpr size_t block( BLOCK_SIZE );
+   using std::swap;
+
+   waitForAsyncAssignments( *this, *this );
 
    if( m_ == n_ )
    {
-      for( size_t jj=0UL; jj<n_; jj+=block ) {
-         const size_t jend( min( jj+block, n_ ) );
-         for( size_t ii=0UL; ii<jj; ii+=block ) {
-            const size_t iend( min( ii+block, m_ ) );
-            for( size_t j=jj; j<jend; ++j ) {
-               for( size_t i=ii; i<iend; ++i ) {
-                  cswap( v_[i+j*mm_], v_[j+i*mm_] );
-               }
-            }
-         }
-         for( size_t j=jj; j<jend; ++j ) {
-            for( size_t i=jj; i<j; ++i ) {
-               cswap( v_[i+j*mm_], v_[j+i*mm_] );
-            }
-            conjugate( v_[j+j*mm_] );
-         }
-      }
+      smpCTranspose( *this );
+   }
+   else if( mm_ == m_ && addPadding( n_ ) == n_ )
+   {
+      transposeCycleKernel<true>( v_, n_, m_ );
+      swap( m_, n_ );
+      mm_ = m_;
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
+      DynamicMatrix tmp( ctrans(*this), alloc_ );
       this->swap( tmp );
    }
 
@@ -4914,9 +5544,10 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
    A.scale( 4 );  // Same effect as above
    \endcode
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::scale( const Other& scalar )
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( size_t i=0UL; i<m_; ++i )
@@ -4946,8 +5577,9 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::scale( const Other& s
 // state is valid. In case the invariants are intact, the function returns \a true, else it
 // will return \a false.
 */
-template< typename Type >  // Data type of the matrix
-inline bool DynamicMatrix<Type,true>::isIntact() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,true,Alloc>::isIntact() const noexcept
 {
    if( m_ * n_ > capacity_ )
       return false;
@@ -4986,9 +5618,10 @@ inline bool DynamicMatrix<Type,true>::isIntact() const noexcept
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,true>::canAlias( const Other* alias ) const noexcept
+inline bool DynamicMatrix<Type,true,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5007,9 +5640,10 @@ inline bool DynamicMatrix<Type,true>::canAlias( const Other* alias ) const noexc
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,true>::isAliased( const Other* alias ) const noexcept
+inline bool DynamicMatrix<Type,true,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5027,8 +5661,9 @@ inline bool DynamicMatrix<Type,true>::isAliased( const Other* alias ) const noex
 // whether the beginning and the end of each column of the matrix are guaranteed to conform to
 // the alignment restrictions of the element type \a Type.
 */
-template< typename Type >  // Data type of the matrix
-inline bool DynamicMatrix<Type,true>::isAligned() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,true,Alloc>::isAligned() const noexcept
 {
    return ( usePadding || rows() % SIMDSIZE == 0UL );
 }
@@ -5047,10 +5682,11 @@ inline bool DynamicMatrix<Type,true>::isAligned() const noexcept
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the matrix
-inline bool DynamicMatrix<Type,true>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,true,Alloc>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5071,9 +5707,10 @@ inline bool DynamicMatrix<Type,true>::canSMPAssign() const noexcept
 // for the performance optimized evaluation of expression templates. Calling this function
 // explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
-   DynamicMatrix<Type,true>::load( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true,Alloc>::SIMDType
+   DynamicMatrix<Type,true,Alloc>::load( size_t i, size_t j ) const noexcept
 {
    if( usePadding )
       return loada( i, j );
@@ -5099,9 +5736,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
-   DynamicMatrix<Type,true>::loada( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true,Alloc>::SIMDType
+   DynamicMatrix<Type,true,Alloc>::loada( size_t i, size_t j ) const noexcept
 {
    using blaze::loada;
 
@@ -5134,9 +5772,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
-   DynamicMatrix<Type,true>::loadu( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true,Alloc>::SIMDType
+   DynamicMatrix<Type,true,Alloc>::loadu( size_t i, size_t j ) const noexcept
 {
    using blaze::loadu;
 
@@ -5168,9 +5807,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,true,Alloc>::store( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    if( usePadding )
       storea( i, j, value );
@@ -5197,9 +5837,10 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,true,Alloc>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storea;
 
@@ -5233,9 +5874,10 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,true,Alloc>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storeu;
 
@@ -5268,9 +5910,10 @@ BLAZE_ALWAYS_INLINE void
 // templates. Calling this function explicitly might result in erroneous results and/or in
 // compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,true,Alloc>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::stream;
 
@@ -5300,9 +5943,10 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true,Alloc>::assign( const DenseMatrix<MT,true>& rhs )
    -> DisableIf_t< VectorizedAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -5337,9 +5981,10 @@ inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true,Alloc>::assign( const DenseMatrix<MT,true>& rhs )
    -> EnableIf_t< VectorizedAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -5408,9 +6053,10 @@ inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,true,Alloc>::assign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5447,9 +6093,10 @@ inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5474,9 +6121,10 @@ inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5503,9 +6151,10 @@ inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true,Alloc>::addAssign( const DenseMatrix<MT,true>& rhs )
    -> DisableIf_t< VectorizedAddAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -5555,9 +6204,10 @@ inline auto DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,true>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true,Alloc>::addAssign( const DenseMatrix<MT,true>& rhs )
    -> EnableIf_t< VectorizedAddAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -5615,9 +6265,10 @@ inline auto DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,true>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,true,Alloc>::addAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5666,9 +6317,10 @@ inline void DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::addAssign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5693,9 +6345,10 @@ inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::addAssign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5722,9 +6375,10 @@ inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true,Alloc>::subAssign( const DenseMatrix<MT,true>& rhs )
    -> DisableIf_t< VectorizedSubAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -5774,9 +6428,10 @@ inline auto DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,true>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true,Alloc>::subAssign( const DenseMatrix<MT,true>& rhs )
    -> EnableIf_t< VectorizedSubAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -5834,9 +6489,10 @@ inline auto DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,true>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,true,Alloc>::subAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5885,9 +6541,10 @@ inline void DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::subAssign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5912,9 +6569,10 @@ inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::subAssign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5941,9 +6599,10 @@ inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true,Alloc>::schurAssign( const DenseMatrix<MT,true>& rhs )
    -> DisableIf_t< VectorizedSchurAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -5978,9 +6637,10 @@ inline auto DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,true>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline auto DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true,Alloc>::schurAssign( const DenseMatrix<MT,true>& rhs )
    -> EnableIf_t< VectorizedSchurAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -6029,9 +6689,10 @@ inline auto DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,true>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,true,Alloc>::schurAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -6068,9 +6729,10 @@ inline void DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,false>&
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::schurAssign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::schurAssign( const SparseMatrix<MT,true>& rhs )
 {
    using blaze::reset;
 
@@ -6109,9 +6771,10 @@ inline void DynamicMatrix<Type,true>::schurAssign( const SparseMatrix<MT,true>&
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::schurAssign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::schurAssign( const SparseMatrix<MT,false>& rhs )
 {
    using blaze::reset;
 
@@ -6155,23 +6818,23 @@ inline void DynamicMatrix<Type,true>::schurAssign( const SparseMatrix<MT,false>&
 //*************************************************************************************************
 /*!\name DynamicMatrix operators */
 //@{
-template< typename Type, bool SO >
-void reset( DynamicMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Alloc >
+void reset( DynamicMatrix<Type,SO,Alloc>& m );
 
-template< typename Type, bool SO >
-void reset( DynamicMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename Alloc >
+void reset( DynamicMatrix<Type,SO,Alloc>& m, size_t i );
 
-template< typename Type, bool SO >
-void clear( DynamicMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Alloc >
+void clear( DynamicMatrix<Type,SO,Alloc>& m );
 
-template< bool RF, typename Type, bool SO >
-bool isDefault( const DynamicMatrix<Type,SO>& m );
+template< bool RF, typename Type, bool SO, typename Alloc >
+bool isDefault( const DynamicMatrix<Type,SO,Alloc>& m );
 
-template< typename Type, bool SO >
-bool isIntact( const DynamicMatrix<Type,SO>& m ) noexcept;
+template< typename Type, bool SO, typename Alloc >
+bool isIntact( const DynamicMatrix<Type,SO,Alloc>& m ) noexcept;
 
-template< typename Type, bool SO >
-void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcept;
+template< typename Type, bool SO, typename Alloc >
+void swap( DynamicMatrix<Type,SO,Alloc>& a, DynamicMatrix<Type,SO,Alloc>& b ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -6183,9 +6846,10 @@ void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcept;
 // \param m The matrix to be resetted.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( DynamicMatrix<Type,SO>& m )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicMatrix<Type,SO,Alloc>& m )
 {
    m.reset();
 }
@@ -6205,9 +6869,10 @@ inline void reset( DynamicMatrix<Type,SO>& m )
 // values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( DynamicMatrix<Type,SO>& m, size_t i )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicMatrix<Type,SO,Alloc>& m, size_t i )
 {
    m.reset( i );
 }
@@ -6221,9 +6886,10 @@ inline void reset( DynamicMatrix<Type,SO>& m, size_t i )
 // \param m The matrix to be cleared.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void clear( DynamicMatrix<Type,SO>& m )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void clear( DynamicMatrix<Type,SO,Alloc>& m )
 {
    m.clear();
 }
@@ -6255,10 +6921,11 @@ inline void clear( DynamicMatrix<Type,SO>& m )
    if( isDefault<relaxed>( A ) ) { ... }
    \endcode
 */
-template< bool RF        // Relaxation flag
-        , typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const DynamicMatrix<Type,SO>& m )
+template< bool RF           // Relaxation flag
+        , typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool isDefault( const DynamicMatrix<Type,SO,Alloc>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -6283,9 +6950,10 @@ inline bool isDefault( const DynamicMatrix<Type,SO>& m )
    if( isIntact( A ) ) { ... }
    \endcode
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isIntact( const DynamicMatrix<Type,SO>& m ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const DynamicMatrix<Type,SO,Alloc>& m ) noexcept
 {
    return m.isIntact();
 }
@@ -6300,9 +6968,10 @@ inline bool isIntact( const DynamicMatrix<Type,SO>& m ) noexcept
 // \param b The second matrix to be swapped.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void swap( DynamicMatrix<Type,SO,Alloc>& a, DynamicMatrix<Type,SO,Alloc>& b ) noexcept
 {
    a.swap( b );
 }
@@ -6319,8 +6988,8 @@ inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcep
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct HasConstDataAccess< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct HasConstDataAccess< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6337,8 +7006,8 @@ struct HasConstDataAccess< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct HasMutableDataAccess< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct HasMutableDataAccess< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6355,8 +7024,8 @@ struct HasMutableDataAccess< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsAligned< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsAligned< DynamicMatrix<T,SO,A> >
    : public BoolConstant<usePadding>
 {};
 /*! \endcond */
@@ -6373,8 +7042,8 @@ struct IsAligned< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsContiguous< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsContiguous< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6391,8 +7060,8 @@ struct IsContiguous< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsPadded< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsPadded< DynamicMatrix<T,SO,A> >
    : public BoolConstant<usePadding>
 {};
 /*! \endcond */
@@ -6409,8 +7078,8 @@ struct IsPadded< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsResizable< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6427,8 +7096,8 @@ struct IsResizable< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsShrinkable< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsShrinkable< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6437,6 +7106,25 @@ struct IsShrinkable< DynamicMatrix<T,SO> >
 
 
 
+//=================================================================================================
+//
+//  TEMPORARYTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename A >
+struct TemporaryType< DynamicMatrix<T,SO,A> >
+{
+   using Type = DynamicMatrix< T, SO, TemporaryAllocator<T> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ADDTRAIT SPECIALIZATIONS
@@ -6475,7 +7163,9 @@ struct AddTraitEval2< T1, T2
                                     ? SO1
                                     : SO2 ) );
 
-   using Type = DynamicMatrix< AddTrait_t<ET1,ET2>, SO >;
+   using ET = AddTrait_t<ET1,ET2>;
+
+   using Type = DynamicMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6521,7 +7211,9 @@ struct SubTraitEval2< T1, T2
                                     ? SO1
                                     : SO2 ) );
 
-   using Type = DynamicMatrix< SubTrait_t<ET1,ET2>, SO >;
+   using ET = SubTrait_t<ET1,ET2>;
+
+   using Type = DynamicMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6562,7 +7254,9 @@ struct SchurTraitEval2< T1, T2
                                     : SO1 )
                                 : SO1 && SO2 );
 
-   using Type = DynamicMatrix< MultTrait_t<ET1,ET2>, SO >;
+   using ET = MultTrait_t<ET1,ET2>;
+
+   using Type = DynamicMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6588,8 +7282,9 @@ struct MultTraitEval2< T1, T2
                                    ( MaxSize_v<T1,1UL> == DefaultMaxSize_v ) > >
 {
    using ET1 = ElementType_t<T1>;
+   using ET  = MultTrait_t<ET1,T2>;
 
-   using Type = DynamicMatrix< MultTrait_t<ET1,T2>, StorageOrder_v<T1> >;
+   using Type = DynamicMatrix< ET, StorageOrder_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -6602,8 +7297,9 @@ struct MultTraitEval2< T1, T2
                                    ( MaxSize_v<T2,1UL> == DefaultMaxSize_v ) > >
 {
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<T1,ET2>;
 
-   using Type = DynamicMatrix< MultTrait_t<T1,ET2>, StorageOrder_v<T2> >;
+   using Type = DynamicMatrix< ET, StorageOrder_v<T2>, DynamicAllocator_t<ET,T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -6619,8 +7315,9 @@ struct MultTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<ET1,ET2>;
 
-   using Type = DynamicMatrix< MultTrait_t<ET1,ET2>, false >;
+   using Type = DynamicMatrix< ET, false, DynamicAllocator_t<ET,T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -6642,7 +7339,9 @@ struct MultTraitEval2< T1, T2
 
    static constexpr bool SO = ( IsSparseMatrix_v<T1> ? StorageOrder_v<T2> : StorageOrder_v<T1> );
 
-   using Type = DynamicMatrix< MultTrait_t<ET1,ET2>, SO >;
+   using ET = MultTrait_t<ET1,ET2>;
+
+   using Type = DynamicMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6673,8 +7372,9 @@ struct KronTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<ET1,ET2>;
 
-   using Type = DynamicMatrix< MultTrait_t<ET1,ET2>, StorageOrder_v<T2> >;
+   using Type = DynamicMatrix< ET, StorageOrder_v<T2>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6700,8 +7400,9 @@ struct DivTraitEval2< T1, T2
                                   ( MaxSize_v<T1,1UL> == DefaultMaxSize_v ) > >
 {
    using ET1 = ElementType_t<T1>;
+   using ET  = DivTrait_t<ET1,T2>;
 
-   using Type = DynamicMatrix< DivTrait_t<ET1,T2>, StorageOrder_v<T1> >;
+   using Type = DynamicMatrix< ET, StorageOrder_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6726,8 +7427,9 @@ struct UnaryMapTraitEval2< T, OP
                                          MaxSize_v<T,1UL> == DefaultMaxSize_v ) > >
 {
    using ET = ElementType_t<T>;
+   using RT = MapTrait_t<ET,OP>;
 
-   using Type = DynamicMatrix< MapTrait_t<ET,OP>, StorageOrder_v<T> >;
+   using Type = DynamicMatrix< RT, StorageOrder_v<T>, DynamicAllocator_t<RT,T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6764,7 +7466,9 @@ struct BinaryMapTraitEval2< T1, T2, OP
                                     ? SO1
                                     : SO2 ) );
 
-   using Type = DynamicMatrix< MapTrait_t<ET1,ET2,OP>, SO >;
+   using ET = MapTrait_t<ET1,ET2,OP>;
+
+   using Type = DynamicMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6790,7 +7494,9 @@ struct ExpandTraitEval2< T, E
 {
    static constexpr bool TF = ( IsColumnVector_v<T> ? columnMajor : rowMajor );
 
-   using Type = DynamicMatrix< ElementType_t<T>, TF >;
+   using ET = RemoveConst_t< ElementType_t<T> >;
+
+   using Type = DynamicMatrix< ET, TF, DynamicAllocator_t<ET,T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6806,10 +7512,12 @@ struct ExpandTraitEval2< T, E
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct HighType< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct HighType< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
-   using Type = DynamicMatrix< typename HighType<T1,T2>::Type, SO >;
+   using ET = typename HighType<T1,T2>::Type;
+
+   using Type = DynamicMatrix< ET, SO, typename std::allocator_traits<A1>::template rebind_alloc<ET> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6825,10 +7533,12 @@ struct HighType< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct LowType< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct LowType< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
-   using Type = DynamicMatrix< typename LowType<T1,T2>::Type, SO >;
+   using ET = typename LowType<T1,T2>::Type;
+
+   using Type = DynamicMatrix< ET, SO, typename std::allocator_traits<A1>::template rebind_alloc<ET> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6852,7 +7562,9 @@ struct SubmatrixTraitEval2< MT, inf, inf, inf, inf
                                         ( MaxSize_v<MT,0UL> == DefaultMaxSize_v ||
                                           MaxSize_v<MT,1UL> == DefaultMaxSize_v ) > >
 {
-   using Type = DynamicMatrix< RemoveConst_t< ElementType_t<MT> >, StorageOrder_v<MT> >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = DynamicMatrix< ET, StorageOrder_v<MT>, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6874,7 +7586,9 @@ struct RowsTraitEval2< MT, M
                                    ( M == 0UL || Size_v<MT,1UL> == DefaultSize_v ) &&
                                    ( M == 0UL || MaxSize_v<MT,1UL> == DefaultMaxSize_v ) > >
 {
-   using Type = DynamicMatrix< RemoveConst_t< ElementType_t<MT> >, false >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = DynamicMatrix< ET, false, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6896,7 +7610,9 @@ struct ColumnsTraitEval2< MT, N
                                       ( N == 0UL || Size_v<MT,0UL> == DefaultSize_v ) &&
                                       ( N == 0UL || MaxSize_v<MT,0UL> == DefaultMaxSize_v ) > >
 {
-   using Type = DynamicMatrix< RemoveConst_t< ElementType_t<MT> >, true >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = DynamicMatrix< ET, true, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -41,16 +41,20 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dense/CustomVector.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/UniformVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/FirstTouch.h>
 #include <blaze/math/Forward.h>
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/shims/Clear.h>
@@ -58,6 +62,9 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/BandTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -71,6 +78,7 @@
 #include <blaze/math/traits/RowTrait.h>
 #include <blaze/math/traits/SubTrait.h>
 #include <blaze/math/traits/SubvectorTrait.h>
+#include <blaze/math/typetraits/DynamicAllocator.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -96,25 +104,31 @@
 #include <blaze/math/typetraits/LowType.h>
 #include <blaze/math/typetraits/MaxSize.h>
 #include <blaze/math/typetraits/Size.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/typetraits/TransposeFlag.h>
+#include <blaze/math/Uninitialized.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/algorithms/Transfer.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/SameType.h>
 #include <blaze/util/constraints/Vectorizable.h>
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/TemporaryAllocator.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -138,17 +152,20 @@ namespace blaze {
 //
 // The DynamicVector class template is the representation of an arbitrary sized vector with
 // dynamically allocated elements of arbitrary type. The type of the elements and the transpose
-// flag of the vector can be specified via the two template parameters:
+// flag of the vector as well as the allocator can be specified via the three template parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename Alloc >
    class DynamicVector;
    \endcode
 
-//  - Type: specifies the type of the vector elements. DynamicVector can be used with any
-//          non-cv-qualified, non-reference, non-pointer element type.
-//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
-//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - Type : specifies the type of the vector elements. DynamicVector can be used with any
+//           non-cv-qualified, non-reference, non-pointer element type.
+//  - TF   : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//           vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - Alloc: specifies the type of the allocator used for the vector elements. The allocator
+//           must return memory that satisfies the alignment restrictions of the element type
+//           (see the AlignmentOf type trait). The default value is \a blaze::AlignedAllocator.
 //
 // These contiguously stored elements can be directly accessed with the subscript operator. The
 // numbering of the vector elements is
@@ -194,20 +211,22 @@ namespace blaze {
    \endcode
 */
 template< typename Type                     // Data type of the vector
-        , bool TF = defaultTransposeFlag >  // Transpose flag
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename Alloc >                  // Type of the allocator
 class DynamicVector
-   : public DenseVector< DynamicVector<Type,TF>, TF >
+   : public DenseVector< DynamicVector<Type,TF,Alloc>, TF >
 {
  public:
    //**Type definitions****************************************************************************
-   using This          = DynamicVector<Type,TF>;    //!< Type of this DynamicVector instance.
-   using BaseType      = DenseVector<This,TF>;      //!< Base type of this DynamicVector instance.
-   using ResultType    = This;                      //!< Result type for expression template evaluations.
-   using TransposeType = DynamicVector<Type,!TF>;   //!< Transpose type for expression template evaluations.
-   using ElementType   = Type;                      //!< Type of the vector elements.
-   using SIMDType      = SIMDTrait_t<ElementType>;  //!< SIMD type of the vector elements.
-   using ReturnType    = const Type&;               //!< Return type for expression template evaluations
-   using CompositeType = const DynamicVector&;      //!< Data type for composite expression templates.
+   using This          = DynamicVector<Type,TF,Alloc>;   //!< Type of this DynamicVector instance.
+   using BaseType      = DenseVector<This,TF>;           //!< Base type of this DynamicVector instance.
+   using ResultType    = This;                           //!< Result type for expression template evaluations.
+   using TransposeType = DynamicVector<Type,!TF,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                           //!< Type of the vector elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;       //!< SIMD type of the vector elements.
+   using ReturnType    = const Type&;                    //!< Return type for expression template evaluations
+   using CompositeType = const DynamicVector&;           //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                          //!< Type of the allocator of the vector elements.
 
    using Reference      = Type&;        //!< Reference to a non-constant vector value.
    using ConstReference = const Type&;  //!< Reference to a constant vector value.
@@ -223,7 +242,8 @@ class DynamicVector
    */
    template< typename NewType >  // Data type of the other vector
    struct Rebind {
-      using Other = DynamicVector<NewType,TF>;  //!< The type of the other DynamicVector.
+      using NewAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NewType>;  //!< Type of the rebound allocator.
+      using Other    = DynamicVector<NewType,TF,NewAlloc>;                                      //!< The type of the other DynamicVector.
    };
    //**********************************************************************************************
 
@@ -232,7 +252,7 @@ class DynamicVector
    */
    template< size_t NewN >  // Number of elements of the other vector
    struct Resize {
-      using Other = DynamicVector<Type,TF>;  //!< The type of the other DynamicVector.
+      using Other = DynamicVector<Type,TF,Alloc>;  //!< The type of the other DynamicVector.
    };
    //**********************************************************************************************
 
@@ -255,8 +275,12 @@ class DynamicVector
    /*!\name Constructors */
    //@{
    explicit inline DynamicVector() noexcept;
+   explicit inline DynamicVector( const Alloc& alloc ) noexcept;
    explicit inline DynamicVector( size_t n );
+   explicit inline DynamicVector( size_t n, const Alloc& alloc );
    explicit inline DynamicVector( size_t n, const Type& init );
+   explicit inline DynamicVector( size_t n, const Type& init, FirstTouch );
+   explicit inline DynamicVector( size_t n, Uninitialized );
             inline DynamicVector( initializer_list<Type> list );
 
    template< typename Other >
@@ -268,6 +292,7 @@ class DynamicVector
                            inline DynamicVector( const DynamicVector& v );
                            inline DynamicVector( DynamicVector&& v ) noexcept;
    template< typename VT > inline DynamicVector( const Vector<VT,TF>& v );
+   template< typename VT > inline DynamicVector( const Vector<VT,TF>& v, const Alloc& alloc );
    //@}
    //**********************************************************************************************
 
@@ -327,6 +352,7 @@ class DynamicVector
    inline void   reset();
    inline void   clear();
    inline void   resize( size_t n, bool preserve=true );
+   inline void   resize( size_t n, bool preserve, Uninitialized );
    inline void   extend( size_t n, bool preserve=true );
    inline void   reserve( size_t n );
    inline void   shrinkToFit();
@@ -477,12 +503,14 @@ class DynamicVector
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t value ) const noexcept;
+   inline void   initialize( const Type& init, bool parallel );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   Alloc alloc_;             //!< The allocator of the vector elements.
    size_t size_;             //!< The current size/dimension of the vector.
    size_t capacity_;         //!< The maximum capacity of the vector.
    Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated vector elements.
@@ -500,6 +528,7 @@ class DynamicVector
    BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE         ( Type, typename std::allocator_traits<Alloc>::value_type );
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -517,10 +546,29 @@ class DynamicVector
 //*************************************************************************************************
 /*!\brief The default constructor for DynamicVector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector() noexcept
-   : size_    ( 0UL )      // The current size/dimension of the vector
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector() noexcept
+   : alloc_   ()           // The allocator of the vector elements
+   , size_    ( 0UL )      // The current size/dimension of the vector
+   , capacity_( 0UL )      // The maximum capacity of the vector
+   , v_       ( nullptr )  // The vector elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty vector with the given allocator.
+//
+// \param alloc The allocator of the vector elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const Alloc& alloc ) noexcept
+   : alloc_   ( alloc )    // The allocator of the vector elements
+   , size_    ( 0UL )      // The current size/dimension of the vector
    , capacity_( 0UL )      // The maximum capacity of the vector
    , v_       ( nullptr )  // The vector elements
 {}
@@ -535,12 +583,33 @@ inline DynamicVector<Type,TF>::DynamicVector() noexcept
 // \note This constructor is only responsible to allocate the required dynamic memory. No
 // element initialization is performed!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( size_t n )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( addPadding( n ) )              // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n )
+   : DynamicVector( n, Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a vector of size \a n with the given allocator. No element initialization
+//        is performed!
+//
+// \param n The size of the vector.
+// \param alloc The allocator of the vector elements.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n, const Alloc& alloc )
+   : alloc_   ( alloc )                          // The allocator of the vector elements
+   , size_    ( n )                              // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )                // The maximum capacity of the vector
+   , v_       ( allocate( alloc_, capacity_ ) )  // The vector elements
 {
    if( IsVectorizable_v<Type> ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -558,21 +627,84 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 // \param n The size of the vector.
 // \param init The initial value of the vector elements.
 //
-// All vector elements are initialized with the specified value.
+// All vector elements are initialized with the specified value. In case the parallel first-touch
+// initialization is enabled (see the BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements of large
+// vectors are initialized in parallel to place them on the NUMA nodes of the according threads.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
-   : DynamicVector( n )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n, const Type& init )
+   : alloc_   ()                                 // The allocator of the vector elements
+   , size_    ( n )                              // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )                // The maximum capacity of the vector
+   , v_       ( allocate( alloc_, capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   initialize( init, useNUMAFirstTouch );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all \a n vector elements via parallel
+//        first-touch.
+//
+// \param n The size of the vector.
+// \param init The initial value of the vector elements.
+//
+// All vector elements are initialized with the specified value. Independent of the
+// BLAZE_USE_NUMA_FIRST_TOUCH switch, the elements of large vectors are initialized in parallel
+// to place them on the NUMA nodes of the according threads:
+
+   \code
+   blaze::DynamicVector<double> a( 100000000UL, 0.0, blaze::firstTouch );
+   \endcode
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n, const Type& init, FirstTouch )
+   : alloc_   ()                                 // The allocator of the vector elements
+   , size_    ( n )                              // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )                // The maximum capacity of the vector
+   , v_       ( allocate( alloc_, capacity_ ) )  // The vector elements
+{
+   initialize( init, true );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Explicitly uninitialized construction of a vector of size \a n.
+//
+// \param n The size of the vector.
+//
+// This constructor allocates a vector of size \a n without initializing its elements. It is
+// meant for vectors that are completely overwritten right after construction:
+
+   \code
+   blaze::DynamicVector<double> y( 1000UL, blaze::uninitialized );
+   y = A * x;
+   \endcode
+
+// In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating point
+// elements are set to NaN in order to reveal accidental reads of uninitialized elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n, Uninitialized )
+   : DynamicVector( n )
+{
+   poison( v_, v_+size_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief List initialization of all vector elements.
 //
@@ -588,9 +720,10 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
 // The vector is sized according to the size of the initializer list and all its elements are
 // (copy) assigned the elements of the given initializer list.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( initializer_list<Type> list )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( initializer_list<Type> list )
    : DynamicVector( list.size() )
 {
    std::fill( std::copy( list.begin(), list.end(), begin() ), end(), Type() );
@@ -621,9 +754,10 @@ inline DynamicVector<Type,TF>::DynamicVector( initializer_list<Type> list )
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n, const Other* array )
    : DynamicVector( n )
 {
    for( size_t i=0UL; i<n; ++i )
@@ -651,11 +785,12 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
 // given array. Missing values are initialized with default values (as e.g. the fourth element in
 // the example).
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Other  // Data type of the initialization array
-        , size_t Dim >    // Dimension of the initialization array
-inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[Dim] )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Dim >      // Dimension of the initialization array
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const Other (&array)[Dim] )
    : DynamicVector( Dim )
 {
    for( size_t i=0UL; i<Dim; ++i )
@@ -672,15 +807,26 @@ inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[Dim] )
 // \param v Vector to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. The allocator of the new vector is
+// obtained via the \c select_on_container_copy_construction() function of the allocator of
+// the given vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
-   : DynamicVector( v.size_ )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const DynamicVector& v )
+   : alloc_   ( std::allocator_traits<Alloc>::select_on_container_copy_construction( v.alloc_ ) )
+   , size_    ( v.size_ )                        // The current size/dimension of the vector
+   , capacity_( addPadding( v.size_ ) )          // The maximum capacity of the vector
+   , v_       ( allocate( alloc_, capacity_ ) )  // The vector elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
 
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = Type();
+   }
+
    smpAssign( *this, ~v );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -692,13 +838,17 @@ inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
 /*!\brief The move constructor for DynamicVector.
 //
 // \param v The vector to be moved into this instance.
+//
+// The allocator of the given vector is moved along with the vector elements.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( DynamicVector&& v ) noexcept
-   : size_    ( v.size_     )  // The current size/dimension of the vector
-   , capacity_( v.capacity_ )  // The maximum capacity of the vector
-   , v_       ( v.v_        )  // The vector elements
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( DynamicVector&& v ) noexcept
+   : alloc_   ( std::move( v.alloc_ ) )  // The allocator of the vector elements
+   , size_    ( v.size_ )                // The current size/dimension of the vector
+   , capacity_( v.capacity_ )            // The maximum capacity of the vector
+   , v_       ( v.v_ )                   // The vector elements
 {
    v.size_     = 0UL;
    v.capacity_ = 0UL;
@@ -712,12 +862,31 @@ inline DynamicVector<Type,TF>::DynamicVector( DynamicVector&& v ) noexcept
 //
 // \param v Vector to be copied.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the foreign vector
-inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
-   : DynamicVector( (~v).size() )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the foreign vector
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const Vector<VT,TF>& v )
+   : DynamicVector( v, Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different vectors with the given allocator.
+//
+// \param v Vector to be copied.
+// \param alloc The allocator of the vector elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the foreign vector
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const Vector<VT,TF>& v, const Alloc& alloc )
+   : DynamicVector( (~v).size(), alloc )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    if( IsSparseVector_v<VT> ) {
       for( size_t i=0UL; i<size_; ++i ) {
          v_[i] = Type();
@@ -742,11 +911,12 @@ inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
 //*************************************************************************************************
 /*!\brief The destructor for DynamicVector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::~DynamicVector()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::~DynamicVector()
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, capacity_ );
 }
 //*************************************************************************************************
 
@@ -768,12 +938,15 @@ inline DynamicVector<Type,TF>::~DynamicVector()
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Reference
-   DynamicVector<Type,TF>::operator[]( size_t index ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Reference
+   DynamicVector<Type,TF,Alloc>::operator[]( size_t index ) noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
    return v_[index];
 }
 //*************************************************************************************************
@@ -788,12 +961,14 @@ inline typename DynamicVector<Type,TF>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstReference
-   DynamicVector<Type,TF>::operator[]( size_t index ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstReference
+   DynamicVector<Type,TF,Alloc>::operator[]( size_t index ) const noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
    return v_[index];
 }
 //*************************************************************************************************
@@ -809,10 +984,11 @@ inline typename DynamicVector<Type,TF>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Reference
-   DynamicVector<Type,TF>::at( size_t index )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Reference
+   DynamicVector<Type,TF,Alloc>::at( size_t index )
 {
    if( index >= size_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
@@ -832,10 +1008,11 @@ inline typename DynamicVector<Type,TF>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstReference
-   DynamicVector<Type,TF>::at( size_t index ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstReference
+   DynamicVector<Type,TF,Alloc>::at( size_t index ) const
 {
    if( index >= size_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
@@ -852,10 +1029,13 @@ inline typename DynamicVector<Type,TF>::ConstReference
 //
 // This function returns a pointer to the internal storage of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Pointer DynamicVector<Type,TF>::data() noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Pointer DynamicVector<Type,TF,Alloc>::data() noexcept
 {
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
    return v_;
 }
 //*************************************************************************************************
@@ -868,9 +1048,10 @@ inline typename DynamicVector<Type,TF>::Pointer DynamicVector<Type,TF>::data() n
 //
 // This function returns a pointer to the internal storage of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstPointer DynamicVector<Type,TF>::data() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstPointer DynamicVector<Type,TF,Alloc>::data() const noexcept
 {
    return v_;
 }
@@ -882,9 +1063,10 @@ inline typename DynamicVector<Type,TF>::ConstPointer DynamicVector<Type,TF>::dat
 //
 // \return Iterator to the first element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::begin() noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Iterator DynamicVector<Type,TF,Alloc>::begin() noexcept
 {
    return Iterator( v_ );
 }
@@ -896,9 +1078,10 @@ inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::begin()
 //
 // \return Iterator to the first element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::begin() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstIterator DynamicVector<Type,TF,Alloc>::begin() const noexcept
 {
    return ConstIterator( v_ );
 }
@@ -910,9 +1093,10 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::be
 //
 // \return Iterator to the first element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cbegin() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstIterator DynamicVector<Type,TF,Alloc>::cbegin() const noexcept
 {
    return ConstIterator( v_ );
 }
@@ -924,9 +1108,10 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cb
 //
 // \return Iterator just past the last element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::end() noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Iterator DynamicVector<Type,TF,Alloc>::end() noexcept
 {
    return Iterator( v_ + size_ );
 }
@@ -938,9 +1123,10 @@ inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::end() n
 //
 // \return Iterator just past the last element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::end() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstIterator DynamicVector<Type,TF,Alloc>::end() const noexcept
 {
    return ConstIterator( v_ + size_ );
 }
@@ -952,9 +1138,10 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::en
 //
 // \return Iterator just past the last element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cend() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstIterator DynamicVector<Type,TF,Alloc>::cend() const noexcept
 {
    return ConstIterator( v_ + size_ );
 }
@@ -975,9 +1162,10 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::ce
 // \param rhs Scalar value to be assigned to all vector elements.
 // \return Reference to the assigned vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Type& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( const Type& rhs )
 {
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = rhs;
@@ -1002,11 +1190,12 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Type& rh
 // The vector is resized according to the size of the initializer list and all its elements are
 // (copy) assigned the values from the given initializer list.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( initializer_list<Type> list )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( initializer_list<Type> list )
 {
-   resize( list.size(), false );
+   resize( list.size(), false, uninitialized );
    std::copy( list.begin(), list.end(), v_ );
 
    return *this;
@@ -1032,13 +1221,14 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( initializer_li
 // array. Missing values are initialized with default values (as e.g. the fourth element in the
 // example).
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Other  // Data type of the initialization array
-        , size_t Dim >    // Dimension of the initialization array
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Other (&array)[Dim] )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Dim >      // Dimension of the initialization array
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( const Other (&array)[Dim] )
 {
-   resize( Dim, false );
+   resize( Dim, false, uninitialized );
 
    for( size_t i=0UL; i<Dim; ++i )
       v_[i] = array[i];
@@ -1057,13 +1247,14 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Other (&
 // The vector is resized according to the given N-dimensional vector and initialized as a
 // copy of this vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const DynamicVector& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( const DynamicVector& rhs )
 {
    if( &rhs == this ) return *this;
 
-   resize( rhs.size_, false );
+   resize( rhs.size_, false, uninitialized );
    smpAssign( *this, ~rhs );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -1078,13 +1269,17 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const DynamicV
 //
 // \param rhs The vector to be moved into this instance.
 // \return Reference to the assigned vector.
+//
+// The allocator of the given vector is moved along with the vector elements.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( DynamicVector&& rhs ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( DynamicVector&& rhs ) noexcept
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, capacity_ );
 
+   alloc_    = std::move( rhs.alloc_ );
    size_     = rhs.size_;
    capacity_ = rhs.capacity_;
    v_        = rhs.v_;
@@ -1106,17 +1301,18 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( DynamicVector&
 //
 // The vector is resized according to the given vector and initialized as a copy of this vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).canAlias( this ) ) {
-      DynamicVector tmp( ~rhs );
+      DynamicVector tmp( ~rhs, alloc_ );
       swap( tmp );
    }
    else {
-      resize( (~rhs).size(), false );
+      resize( (~rhs).size(), false, uninitialized );
       if( IsSparseVector_v<VT> )
          reset();
       smpAssign( *this, ~rhs );
@@ -1139,10 +1335,11 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Vector<V
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator+=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
@@ -1174,10 +1371,11 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator+=( const Vector<
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator-=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
@@ -1209,17 +1407,18 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator-=( const Vector<
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator*=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator*=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
    if( IsSparseVector_v<VT> || (~rhs).canAlias( this ) ) {
-      DynamicVector<Type,TF> tmp( *this * (~rhs) );
+      DynamicVector<Type,TF,Alloc> tmp( *this * (~rhs), alloc_ );
       swap( tmp );
    }
    else {
@@ -1243,17 +1442,18 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator*=( const Vector<
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator/=( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator/=( const DenseVector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
    if( (~rhs).canAlias( this ) ) {
-      DynamicVector<Type,TF> tmp( *this / (~rhs) );
+      DynamicVector<Type,TF,Alloc> tmp( *this / (~rhs), alloc_ );
       swap( tmp );
    }
    else {
@@ -1278,10 +1478,11 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator/=( const DenseVe
 // In case the current size of any of the two vectors is not equal to 3, a \a std::invalid_argument
 // exception is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator%=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator%=( const Vector<VT,TF>& rhs )
 {
    using blaze::assign;
 
@@ -1321,9 +1522,10 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator%=( const Vector<
 //
 // \return The size of the vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::size() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::size() const noexcept
 {
    return size_;
 }
@@ -1338,9 +1540,10 @@ inline size_t DynamicVector<Type,TF>::size() const noexcept
 // This function returns the minimum capacity of the vector, which corresponds to the current
 // size plus padding.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::spacing() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::spacing() const noexcept
 {
    return addPadding( size_ );
 }
@@ -1352,9 +1555,10 @@ inline size_t DynamicVector<Type,TF>::spacing() const noexcept
 //
 // \return The maximum capacity of the vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::capacity() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -1369,9 +1573,10 @@ inline size_t DynamicVector<Type,TF>::capacity() const noexcept
 // Note that the number of non-zero elements is always less than or equal to the current size
 // of the vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::nonZeros() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0 );
 
@@ -1390,9 +1595,10 @@ inline size_t DynamicVector<Type,TF>::nonZeros() const
 //
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::reset()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::reset()
 {
    using blaze::clear;
    for( size_t i=0UL; i<size_; ++i )
@@ -1408,9 +1614,10 @@ inline void DynamicVector<Type,TF>::reset()
 //
 // After the clear() function, the size of the vector is 0.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::clear()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::clear()
 {
    resize( 0UL, false );
 }
@@ -1446,17 +1653,23 @@ inline void DynamicVector<Type,TF>::clear()
                               \end{array}\right)
                               \f]
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::resize( size_t n, bool preserve )
 {
    using std::swap;
 
+   if( n == size_ ) return;
+
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
    if( n > capacity_ )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, newCapacity );
 
       // Initializing the new array
       if( preserve ) {
@@ -1470,7 +1683,7 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 
       // Replacing the old array
       swap( v_, tmp );
-      deallocate( tmp );
+      deallocate( alloc_, tmp, capacity_ );
       capacity_ = newCapacity;
    }
    else if( IsVectorizable_v<Type> && n < size_ )
@@ -1484,6 +1697,71 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Changing the size of the vector without initializing new elements.
+//
+// \param n The new size of the vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the vector to \a n elements. In contrast to the default resize()
+// function, no element beyond the preserved elements is touched except for the padding
+// elements, which avoids an additional pass over the memory in case the vector is completely
+// overwritten afterwards. In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE
+// switch), all new floating point elements are set to NaN.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::resize( size_t n, bool preserve, Uninitialized )
+{
+   using std::swap;
+
+   if( n == size_ ) return;
+
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
+   if( n > capacity_ )
+   {
+      // Allocating a new array
+      const size_t newCapacity( addPadding( n ) );
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, newCapacity );
+
+      // Initializing the new array
+      if( preserve ) {
+         transfer( v_, v_+size_, tmp );
+      }
+
+      poison( tmp+( preserve ? size_ : 0UL ), tmp+n );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=n; i<newCapacity; ++i )
+            tmp[i] = Type();
+      }
+
+      // Replacing the old array
+      swap( v_, tmp );
+      deallocate( alloc_, tmp, capacity_ );
+      capacity_ = newCapacity;
+   }
+   else if( n < size_ )
+   {
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=n; i<size_; ++i )
+            v_[i] = Type();
+      }
+   }
+   else
+   {
+      poison( v_+size_, v_+n );
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Extending the size of the vector.
 //
@@ -1496,9 +1774,10 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 // function potentially changes all vector elements. In order to preserve the old vector values,
 // the \a preserve flag can be set to \a true. However, new vector elements are not initialized!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::extend( size_t n, bool preserve )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::extend( size_t n, bool preserve )
 {
    resize( size_+n, preserve );
 }
@@ -1514,9 +1793,10 @@ inline void DynamicVector<Type,TF>::extend( size_t n, bool preserve )
 // This function increases the capacity of the vector to at least \a n elements. The current
 // values of the vector elements are preserved.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::reserve( size_t n )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::reserve( size_t n )
 {
    using std::swap;
 
@@ -1524,7 +1804,7 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, newCapacity );
 
       // Initializing the new array
       transfer( v_, v_+size_, tmp );
@@ -1536,7 +1816,7 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      deallocate( alloc_, tmp, capacity_ );
       capacity_ = newCapacity;
    }
 }
@@ -1553,9 +1833,10 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
 // that in case a reallocation occurs, all iterators (including end() iterators), all pointers
 // and references to elements of this vector are invalidated.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::shrinkToFit()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::shrinkToFit()
 {
    if( spacing() < capacity_ ) {
       DynamicVector( *this ).swap( *this );
@@ -1569,13 +1850,17 @@ inline void DynamicVector<Type,TF>::shrinkToFit()
 //
 // \param v The vector to be swapped.
 // \return void
+//
+// The allocators of the two vectors are swapped along with the vector elements.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::swap( DynamicVector& v ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::swap( DynamicVector& v ) noexcept
 {
    using std::swap;
 
+   swap( alloc_, v.alloc_ );
    swap( size_, v.size_ );
    swap( capacity_, v.capacity_ );
    swap( v_, v.v_ );
@@ -1592,9 +1877,10 @@ inline void DynamicVector<Type,TF>::swap( DynamicVector& v ) noexcept
 // This function increments the given \a value by the necessary amount of padding based on the
 // vector's data type \a Type.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::addPadding( size_t value ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::addPadding( size_t value ) const noexcept
 {
    if( usePadding && IsVectorizable_v<Type> )
       return nextMultiple<size_t>( value, SIMDSIZE );
@@ -1603,6 +1889,40 @@ inline size_t DynamicVector<Type,TF>::addPadding( size_t value ) const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Homogeneous initialization of all vector elements, including the padding elements.
+//
+// \param init The initial value of the vector elements.
+// \param parallel \a true for a parallel first-touch initialization, \a false if not.
+// \return void
+//
+// In case of a parallel initialization the complete capacity of the vector (including the
+// padding elements) is assigned via smpAssign(), which writes every memory page of the vector
+// for the first time from the thread that works on it in all subsequent SMP assignments. Inside
+// an active parallel section the vector is initialized serially.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::initialize( const Type& init, bool parallel )
+{
+   if( parallel && !isParallelSectionActive() ) {
+      CustomVector<Type,unaligned,unpadded,TF> tmp( v_, capacity_ );
+      smpAssign( tmp, UniformVector<Type,TF>( capacity_, init ) );
+
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = Type();
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = Type();
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1629,9 +1949,10 @@ inline size_t DynamicVector<Type,TF>::addPadding( size_t value ) const noexcept
    \endcode
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::scale( const Other& scalar )
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<size_; ++i )
       v_[i] *= scalar;
@@ -1657,9 +1978,10 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::scale( const Other& scala
 // state is valid. In case the invariants are intact, the function returns \a true, else it
 // will return \a false.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool DynamicVector<Type,TF>::isIntact() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicVector<Type,TF,Alloc>::isIntact() const noexcept
 {
    if( size_ > capacity_ )
       return false;
@@ -1695,9 +2017,10 @@ inline bool DynamicVector<Type,TF>::isIntact() const noexcept
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicVector<Type,TF>::canAlias( const Other* alias ) const noexcept
+inline bool DynamicVector<Type,TF,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1715,9 +2038,10 @@ inline bool DynamicVector<Type,TF>::canAlias( const Other* alias ) const noexcep
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicVector<Type,TF>::isAliased( const Other* alias ) const noexcept
+inline bool DynamicVector<Type,TF,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1733,9 +2057,10 @@ inline bool DynamicVector<Type,TF>::isAliased( const Other* alias ) const noexce
 // whether the beginning and the end of the vector are guaranteed to conform to the alignment
 // restrictions of the element type \a Type.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool DynamicVector<Type,TF>::isAligned() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicVector<Type,TF,Alloc>::isAligned() const noexcept
 {
    return true;
 }
@@ -1752,11 +2077,12 @@ inline bool DynamicVector<Type,TF>::isAligned() const noexcept
 // function additionally provides runtime information (as for instance the current size of the
 // vector).
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool DynamicVector<Type,TF>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicVector<Type,TF,Alloc>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 //*************************************************************************************************
 
@@ -1773,10 +2099,11 @@ inline bool DynamicVector<Type,TF>::canSMPAssign() const noexcept
 // used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
-   DynamicVector<Type,TF>::load( size_t index ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF,Alloc>::SIMDType
+   DynamicVector<Type,TF,Alloc>::load( size_t index ) const noexcept
 {
    return loada( index );
 }
@@ -1796,10 +2123,11 @@ BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
 // Calling this function explicitly might result in erroneous results and/or in compilation
 // errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
-   DynamicVector<Type,TF>::loada( size_t index ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF,Alloc>::SIMDType
+   DynamicVector<Type,TF,Alloc>::loada( size_t index ) const noexcept
 {
    using blaze::loada;
 
@@ -1828,10 +2156,11 @@ BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
 // Calling this function explicitly might result in erroneous results and/or in compilation
 // errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
-   DynamicVector<Type,TF>::loadu( size_t index ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF,Alloc>::SIMDType
+   DynamicVector<Type,TF,Alloc>::loadu( size_t index ) const noexcept
 {
    using blaze::loadu;
 
@@ -1858,10 +2187,11 @@ BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
 // used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicVector<Type,TF>::store( size_t index, const SIMDType& value ) noexcept
+   DynamicVector<Type,TF,Alloc>::store( size_t index, const SIMDType& value ) noexcept
 {
    storea( index, value );
 }
@@ -1881,10 +2211,11 @@ BLAZE_ALWAYS_INLINE void
 // is used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicVector<Type,TF>::storea( size_t index, const SIMDType& value ) noexcept
+   DynamicVector<Type,TF,Alloc>::storea( size_t index, const SIMDType& value ) noexcept
 {
    using blaze::storea;
 
@@ -1913,10 +2244,11 @@ BLAZE_ALWAYS_INLINE void
 // is used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicVector<Type,TF>::storeu( size_t index, const SIMDType& value ) noexcept
+   DynamicVector<Type,TF,Alloc>::storeu( size_t index, const SIMDType& value ) noexcept
 {
    using blaze::storeu;
 
@@ -1944,10 +2276,11 @@ BLAZE_ALWAYS_INLINE void
 // expression templates. Calling this function explicitly might result in erroneous results
 // and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicVector<Type,TF>::stream( size_t index, const SIMDType& value ) noexcept
+   DynamicVector<Type,TF,Alloc>::stream( size_t index, const SIMDType& value ) noexcept
 {
    using blaze::stream;
 
@@ -1974,10 +2307,11 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::assign( const DenseVector<VT,TF>& rhs )
    -> DisableIf_t< VectorizedAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
@@ -2006,10 +2340,11 @@ inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::assign( const DenseVector<VT,TF>& rhs )
    -> EnableIf_t< VectorizedAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2064,10 +2399,11 @@ inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void DynamicVector<Type,TF,Alloc>::assign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2088,10 +2424,11 @@ inline void DynamicVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::addAssign( const DenseVector<VT,TF>& rhs )
    -> DisableIf_t< VectorizedAddAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
@@ -2120,10 +2457,11 @@ inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::addAssign( const DenseVector<VT,TF>& rhs )
    -> EnableIf_t< VectorizedAddAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2166,10 +2504,11 @@ inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void DynamicVector<Type,TF,Alloc>::addAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2190,10 +2529,11 @@ inline void DynamicVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::subAssign( const DenseVector<VT,TF>& rhs )
    -> DisableIf_t< VectorizedSubAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
@@ -2222,10 +2562,11 @@ inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::subAssign( const DenseVector<VT,TF>& rhs )
    -> EnableIf_t< VectorizedSubAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2268,10 +2609,11 @@ inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void DynamicVector<Type,TF,Alloc>::subAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2292,10 +2634,11 @@ inline void DynamicVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::multAssign( const DenseVector<VT,TF>& rhs )
    -> DisableIf_t< VectorizedMultAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
@@ -2324,10 +2667,11 @@ inline auto DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::multAssign( const DenseVector<VT,TF>& rhs )
    -> EnableIf_t< VectorizedMultAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2370,10 +2714,11 @@ inline auto DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::multAssign( const SparseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void DynamicVector<Type,TF,Alloc>::multAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2398,10 +2743,11 @@ inline void DynamicVector<Type,TF>::multAssign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::divAssign( const DenseVector<VT,TF>& rhs )
    -> DisableIf_t< VectorizedDivAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
@@ -2430,10 +2776,11 @@ inline auto DynamicVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline auto DynamicVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc>::divAssign( const DenseVector<VT,TF>& rhs )
    -> EnableIf_t< VectorizedDivAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2474,20 +2821,20 @@ inline auto DynamicVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs )
 //*************************************************************************************************
 /*!\name DynamicVector operators */
 //@{
-template< typename Type, bool TF >
-void reset( DynamicVector<Type,TF>& v );
+template< typename Type, bool TF, typename Alloc >
+void reset( DynamicVector<Type,TF,Alloc>& v );
 
-template< typename Type, bool TF >
-void clear( DynamicVector<Type,TF>& v );
+template< typename Type, bool TF, typename Alloc >
+void clear( DynamicVector<Type,TF,Alloc>& v );
 
-template< bool RF, typename Type, bool TF >
-bool isDefault( const DynamicVector<Type,TF>& v );
+template< bool RF, typename Type, bool TF, typename Alloc >
+bool isDefault( const DynamicVector<Type,TF,Alloc>& v );
 
-template< typename Type, bool TF >
-bool isIntact( const DynamicVector<Type,TF>& v ) noexcept;
+template< typename Type, bool TF, typename Alloc >
+bool isIntact( const DynamicVector<Type,TF,Alloc>& v ) noexcept;
 
-template< typename Type, bool TF >
-void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcept;
+template< typename Type, bool TF, typename Alloc >
+void swap( DynamicVector<Type,TF,Alloc>& a, DynamicVector<Type,TF,Alloc>& b ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -2499,9 +2846,10 @@ void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcept;
 // \param v The dynamic vector to be resetted.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void reset( DynamicVector<Type,TF>& v )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicVector<Type,TF,Alloc>& v )
 {
    v.reset();
 }
@@ -2515,9 +2863,10 @@ inline void reset( DynamicVector<Type,TF>& v )
 // \param v The dynamic vector to be cleared.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void clear( DynamicVector<Type,TF>& v )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void clear( DynamicVector<Type,TF,Alloc>& v )
 {
    v.clear();
 }
@@ -2548,10 +2897,11 @@ inline void clear( DynamicVector<Type,TF>& v )
    if( isDefault<relaxed>( a ) ) { ... }
    \endcode
 */
-template< bool RF        // Relaxation flag
-        , typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isDefault( const DynamicVector<Type,TF>& v )
+template< bool RF           // Relaxation flag
+        , typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool isDefault( const DynamicVector<Type,TF,Alloc>& v )
 {
    return ( v.size() == 0UL );
 }
@@ -2576,9 +2926,10 @@ inline bool isDefault( const DynamicVector<Type,TF>& v )
    if( isIntact( a ) ) { ... }
    \endcode
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isIntact( const DynamicVector<Type,TF>& v ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const DynamicVector<Type,TF,Alloc>& v ) noexcept
 {
    return v.isIntact();
 }
@@ -2593,9 +2944,10 @@ inline bool isIntact( const DynamicVector<Type,TF>& v ) noexcept
 // \param b The second vector to be swapped.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void swap( DynamicVector<Type,TF,Alloc>& a, DynamicVector<Type,TF,Alloc>& b ) noexcept
 {
    a.swap( b );
 }
@@ -2612,8 +2964,8 @@ inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcep
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct HasConstDataAccess< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct HasConstDataAccess< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2630,8 +2982,8 @@ struct HasConstDataAccess< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct HasMutableDataAccess< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct HasMutableDataAccess< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2648,8 +3000,8 @@ struct HasMutableDataAccess< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsAligned< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct IsAligned< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2666,8 +3018,8 @@ struct IsAligned< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsContiguous< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct IsContiguous< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2684,8 +3036,8 @@ struct IsContiguous< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsPadded< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct IsPadded< DynamicVector<T,TF,A> >
    : public BoolConstant<usePadding>
 {};
 /*! \endcond */
@@ -2702,8 +3054,8 @@ struct IsPadded< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsResizable< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct IsResizable< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2720,8 +3072,8 @@ struct IsResizable< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsShrinkable< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct IsShrinkable< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2730,6 +3082,25 @@ struct IsShrinkable< DynamicVector<T,TF> >
 
 
 
+//=================================================================================================
+//
+//  TEMPORARYTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename A >
+struct TemporaryType< DynamicVector<T,TF,A> >
+{
+   using Type = DynamicVector< T, TF, TemporaryAllocator<T> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ADDTRAIT SPECIALIZATIONS
@@ -2750,8 +3121,9 @@ struct AddTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = AddTrait_t<ET1,ET2>;
 
-   using Type = DynamicVector< AddTrait_t<ET1,ET2>, TransposeFlag_v<T1> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2779,8 +3151,9 @@ struct SubTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = SubTrait_t<ET1,ET2>;
 
-   using Type = DynamicVector< SubTrait_t<ET1,ET2>, TransposeFlag_v<T1> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2804,8 +3177,9 @@ struct MultTraitEval2< T1, T2
                                    ( MaxSize_v<T1,0UL> == DefaultMaxSize_v ) > >
 {
    using ET1 = ElementType_t<T1>;
+   using ET  = MultTrait_t<ET1,T2>;
 
-   using Type = DynamicVector< MultTrait_t<ET1,T2>, TransposeFlag_v<T1> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T1>, DynamicAllocator_t<ET,T1> >;
 };
 
 template< typename T1, typename T2 >
@@ -2816,8 +3190,9 @@ struct MultTraitEval2< T1, T2
                                    ( MaxSize_v<T2,0UL> == DefaultMaxSize_v ) > >
 {
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<T1,ET2>;
 
-   using Type = DynamicVector< MultTrait_t<T1,ET2>, TransposeFlag_v<T2> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T2>, DynamicAllocator_t<ET,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -2833,8 +3208,9 @@ struct MultTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<ET1,ET2>;
 
-   using Type = DynamicVector< MultTrait_t<ET1,ET2>, TransposeFlag_v<T1> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -2849,8 +3225,9 @@ struct MultTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<ET1,ET2>;
 
-   using Type = DynamicVector< MultTrait_t<ET1,ET2>, false >;
+   using Type = DynamicVector< ET, false, DynamicAllocator_t<ET,T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -2865,8 +3242,9 @@ struct MultTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<ET1,ET2>;
 
-   using Type = DynamicVector< MultTrait_t<ET1,ET2>, true >;
+   using Type = DynamicVector< ET, true, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2893,8 +3271,9 @@ struct KronTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<ET1,ET2>;
 
-   using Type = DynamicVector< MultTrait_t<ET1,ET2>, TransposeFlag_v<T2> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T2>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2918,8 +3297,9 @@ struct DivTraitEval2< T1, T2
                                   ( MaxSize_v<T1,0UL> == DefaultMaxSize_v ) > >
 {
    using ET1 = ElementType_t<T1>;
+   using ET  = DivTrait_t<ET1,T2>;
 
-   using Type = DynamicVector< DivTrait_t<ET1,T2>, TransposeFlag_v<T1> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T1>, DynamicAllocator_t<ET,T1> >;
 };
 
 template< typename T1, typename T2 >
@@ -2933,8 +3313,9 @@ struct DivTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = DivTrait_t<ET1,ET2>;
 
-   using Type = DynamicVector< DivTrait_t<ET1,ET2>, TransposeFlag_v<T1> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2957,8 +3338,9 @@ struct UnaryMapTraitEval2< T, OP
                                        MaxSize_v<T,0UL> == DefaultMaxSize_v > >
 {
    using ET = ElementType_t<T>;
+   using RT = MapTrait_t<ET,OP>;
 
-   using Type = DynamicVector< MapTrait_t<ET,OP>, TransposeFlag_v<T> >;
+   using Type = DynamicVector< RT, TransposeFlag_v<T>, DynamicAllocator_t<RT,T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2977,8 +3359,9 @@ struct BinaryMapTraitEval2< T1, T2, OP
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = MapTrait_t<ET1,ET2,OP>;
 
-   using Type = DynamicVector< MapTrait_t<ET1,ET2,OP>, TransposeFlag_v<T1> >;
+   using Type = DynamicVector< ET, TransposeFlag_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -3007,7 +3390,7 @@ struct PartialReduceTraitEval2< T, OP, RF
 
    static constexpr bool TF = ( RF == 0UL );
 
-   using Type = DynamicVector<RT,TF>;
+   using Type = DynamicVector< RT, TF, DynamicAllocator_t<RT,T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -3023,10 +3406,12 @@ struct PartialReduceTraitEval2< T, OP, RF
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct HighType< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct HighType< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
-   using Type = DynamicVector< typename HighType<T1,T2>::Type, TF >;
+   using ET = typename HighType<T1,T2>::Type;
+
+   using Type = DynamicVector< ET, TF, typename std::allocator_traits<A1>::template rebind_alloc<ET> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -3042,10 +3427,12 @@ struct HighType< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct LowType< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct LowType< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
-   using Type = DynamicVector< typename LowType<T1,T2>::Type, TF >;
+   using ET = typename LowType<T1,T2>::Type;
+
+   using Type = DynamicVector< ET, TF, typename std::allocator_traits<A1>::template rebind_alloc<ET> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -3067,7 +3454,9 @@ struct SubvectorTraitEval2< VT, inf, inf
                                         Size_v<VT,0UL> == DefaultSize_v &&
                                         MaxSize_v<VT,0UL> == DefaultMaxSize_v > >
 {
-   using Type = DynamicVector< RemoveConst_t< ElementType_t<VT> >, TransposeFlag_v<VT> >;
+   using ET = RemoveConst_t< ElementType_t<VT> >;
+
+   using Type = DynamicVector< ET, TransposeFlag_v<VT>, DynamicAllocator_t<ET,VT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -3089,7 +3478,9 @@ struct ElementsTraitEval2< VT, 0UL
                                        Size_v<VT,0UL> == DefaultSize_v &&
                                        MaxSize_v<VT,0UL> == DefaultMaxSize_v > >
 {
-   using Type = DynamicVector< RemoveConst_t< ElementType_t<VT> >, TransposeFlag_v<VT> >;
+   using ET = RemoveConst_t< ElementType_t<VT> >;
+
+   using Type = DynamicVector< ET, TransposeFlag_v<VT>, DynamicAllocator_t<ET,VT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -3111,7 +3502,9 @@ struct RowTraitEval2< MT, I
                                   Size_v<MT,1UL> == DefaultSize_v &&
                                   MaxSize_v<MT,1UL> == DefaultMaxSize_v > >
 {
-   using Type = DynamicVector< RemoveConst_t< ElementType_t<MT> >, true >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = DynamicVector< ET, true, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -3133,7 +3526,9 @@ struct ColumnTraitEval2< MT, I
                                      Size_v<MT,0UL> == DefaultSize_v &&
                                      MaxSize_v<MT,0UL> == DefaultMaxSize_v > >
 {
-   using Type = DynamicVector< RemoveConst_t< ElementType_t<MT> >, false >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = DynamicVector< ET, false, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -3157,7 +3552,9 @@ struct BandTraitEval2< MT, I
                                    ( MaxSize_v<MT,0UL> == DefaultMaxSize_v ||
                                      MaxSize_v<MT,1UL> == DefaultMaxSize_v ) > >
 {
-   using Type = DynamicVector< RemoveConst_t< ElementType_t<MT> >, defaultTransposeFlag >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = DynamicVector< ET, defaultTransposeFlag, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/PackingFlag.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Types.h>
 
 
@@ -51,12 +53,19 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< bool > class BitMatrix;
+template< bool > class BitVector;
 template< typename, bool, bool, bool, typename > class CustomMatrix;
 template< typename, bool, bool, bool, typename > class CustomVector;
-template< typename, bool > class DynamicVector;
-template< typename, bool > class DynamicMatrix;
+template< typename Type, bool, typename = AlignedAllocator<Type> > class DynamicVector;
+template< typename Type, bool, typename = AlignedAllocator<Type> > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename, bool > class MappedMatrix;
+template< typename, bool > class MappedVector;
+template< typename, PackingFlag, bool > class PackedMatrix;
+template< typename Type, size_t, size_t, bool, typename = AlignedAllocator<Type> > class SmallMatrix;
+template< typename Type, size_t, bool, typename = AlignedAllocator<Type> > class SmallVector;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
 template< typename, bool > class UniformMatrix;
@@ -98,6 +98,7 @@
 #include <blaze/math/typetraits/MaxSize.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/math/Uninitialized.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/StorageOrder.h>
@@ -115,6 +116,7 @@
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Memory.h>
@@ -301,6 +303,7 @@ class HybridMatrix
    explicit inline HybridMatrix();
    explicit inline HybridMatrix( size_t m, size_t n );
    explicit inline HybridMatrix( size_t m, size_t n, const Type& init );
+   explicit inline HybridMatrix( size_t m, size_t n, Uninitialized );
             inline HybridMatrix( initializer_list< initializer_list<Type> > list );
 
    template< typename Other >
@@ -691,6 +694,60 @@ inline HybridMatrix<Type,M,N,SO>::HybridMatrix( size_t m, size_t n, const Type&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Explicitly uninitialized construction of a \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid number of rows for hybrid matrix.
+// \exception std::invalid_argument Invalid number of columns for hybrid matrix.
+//
+// This constructor creates a hybrid matrix of size \f$ m \times n \f$ without initializing the
+// \f$ m \times n \f$ matrix elements. Only the remaining elements of the static array are reset.
+// In case \a m is larger than the maximum allowed number of rows (i.e. \a m > M) or \a n is
+// larger than the maximum allowed number of columns a \a std::invalid_argument exception is
+// thrown. In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating
+// point elements are set to NaN.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+inline HybridMatrix<Type,M,N,SO>::HybridMatrix( size_t m, size_t n, Uninitialized )
+   : v_()     // The statically allocated matrix elements
+   , m_( m )  // The current number of rows of the matrix
+   , n_( n )  // The current number of columns of the matrix
+{
+   BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || NN == N );
+
+   if( m > M ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of rows for hybrid matrix" );
+   }
+
+   if( n > N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns for hybrid matrix" );
+   }
+
+   for( size_t i=0UL; i<m; ++i ) {
+      poison( v_.data()+i*NN, v_.data()+i*NN+n );
+
+      if( IsNumeric_v<Type> ) {
+         for( size_t j=n; j<NN; ++j )
+            v_[i*NN+j] = Type();
+      }
+   }
+
+   if( IsNumeric_v<Type> ) {
+      for( size_t i=m; i<M; ++i )
+         for( size_t j=0UL; j<NN; ++j )
+            v_[i*NN+j] = Type();
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief List initialization of all matrix elements.
 //
@@ -935,6 +992,8 @@ inline HybridMatrix<Type,M,N,SO>::HybridMatrix( const Matrix<MT,SO2>& m )
    , m_( (~m).rows() )     // The current number of rows of the matrix
    , n_( (~m).columns() )  // The current number of columns of the matrix
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || NN == N );
@@ -3363,6 +3422,7 @@ class HybridMatrix<Type,M,N,true>
    explicit inline HybridMatrix();
    explicit inline HybridMatrix( size_t m, size_t n );
    explicit inline HybridMatrix( size_t m, size_t n, const Type& init );
+   explicit inline HybridMatrix( size_t m, size_t n, Uninitialized );
             inline HybridMatrix( initializer_list< initializer_list<Type> > list );
 
    template< typename Other >
@@ -3739,6 +3799,61 @@ inline HybridMatrix<Type,M,N,true>::HybridMatrix( size_t m, size_t n, const Type
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Explicitly uninitialized construction of a \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid number of rows for hybrid matrix.
+// \exception std::invalid_argument Invalid number of columns for hybrid matrix.
+//
+// This constructor creates a hybrid matrix of size \f$ m \times n \f$ without initializing the
+// \f$ m \times n \f$ matrix elements. Only the remaining elements of the static array are reset.
+// In case \a m is larger than the maximum allowed number of rows (i.e. \a m > M) or \a n is
+// larger than the maximum allowed number of columns a \a std::invalid_argument exception is
+// thrown. In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating
+// point elements are set to NaN.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline HybridMatrix<Type,M,N,true>::HybridMatrix( size_t m, size_t n, Uninitialized )
+   : v_()     // The statically allocated matrix elements
+   , m_( m )  // The current number of rows of the matrix
+   , n_( n )  // The current number of columns of the matrix
+{
+   BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || MM == M );
+
+   if( m > M ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of rows for hybrid matrix" );
+   }
+
+   if( n > N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns for hybrid matrix" );
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      poison( v_.data()+j*MM, v_.data()+j*MM+m );
+
+      if( IsNumeric_v<Type> ) {
+         for( size_t i=m; i<MM; ++i )
+            v_[i+j*MM] = Type();
+      }
+   }
+
+   if( IsNumeric_v<Type> ) {
+      for( size_t j=n; j<N; ++j )
+         for( size_t i=0UL; i<MM; ++i )
+            v_[i+j*MM] = Type();
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief List initialization of all matrix elements.
@@ -4000,6 +4115,8 @@ inline HybridMatrix<Type,M,N,true>::HybridMatrix( const Matrix<MT,SO2>& m )
    , m_( (~m).rows() )     // The current number of rows of the matrix
    , n_( (~m).columns() )  // The current number of columns of the matrix
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || MM == M );
@@ -86,6 +86,7 @@
 #include <blaze/math/typetraits/MaxSize.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/typetraits/TransposeFlag.h>
+#include <blaze/math/Uninitialized.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/TransposeFlag.h>
@@ -101,6 +102,7 @@
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Memory.h>
@@ -267,6 +269,7 @@ class HybridVector
    explicit inline HybridVector();
    explicit inline HybridVector( size_t n );
    explicit inline HybridVector( size_t n, const Type& init );
+   explicit inline HybridVector( size_t n, Uninitialized );
             inline HybridVector( initializer_list<Type> list );
 
    template< typename Other >
@@ -625,6 +628,43 @@ inline HybridVector<Type,N,TF>::HybridVector( size_t n, const Type& init )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Explicitly uninitialized construction of a vector of size \a n.
+//
+// \param n The size of the vector.
+// \exception std::invalid_argument Invalid size for hybrid vector.
+//
+// This constructor creates a hybrid vector of size \a n without initializing the \a n vector
+// elements. Only the remaining elements of the static array are reset. In case \a n is larger
+// than the maximum allowed number of elements (i.e. \a n > N) a \a std::invalid_argument
+// exception is thrown. In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch),
+// all floating point elements are set to NaN.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N       // Number of elements
+        , bool TF >      // Transpose flag
+inline HybridVector<Type,N,TF>::HybridVector( size_t n, Uninitialized )
+   : v_   ()     // The statically allocated vector elements
+   , size_( n )  // The current size/dimension of the vector
+{
+   BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || NN == N );
+
+   if( n > N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size for hybrid vector" );
+   }
+
+   poison( v_.data(), v_.data()+n );
+
+   if( IsNumeric_v<Type> ) {
+      for( size_t i=n; i<NN; ++i )
+         v_[i] = Type();
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief List initialization of all vector elements.
 //
@@ -803,6 +843,8 @@ inline HybridVector<Type,N,TF>::HybridVector( const Vector<VT,TF>& v )
    : v_   ()               // The statically allocated vector elements
    , size_( (~v).size() )  // The current size/dimension of the vector
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || NN == N );
@@ -70,8 +70,10 @@
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/TemporaryAllocator.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/RemoveConst.h>
 
 
 namespace blaze {
@@ -105,8 +107,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
    using SIMDType = SIMDTrait_t<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
@@ -139,8 +141,8 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
+   DynamicMatrix< ET2, false, TemporaryAllocator<ET2> > A2( M, KBLOCK );
+   DynamicMatrix< ET3, true, TemporaryAllocator<ET3> >  B2( KBLOCK, JBLOCK );
 
    if( isDefault( beta ) ) {
       reset( ~C );
@@ -605,8 +607,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
    using SIMDType = SIMDTrait_t<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT1 );
@@ -639,8 +641,8 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
+   DynamicMatrix< ET2, false, TemporaryAllocator<ET2> > A2( IBLOCK, KBLOCK );
+   DynamicMatrix< ET3, true, TemporaryAllocator<ET3> >  B2( KBLOCK, N );
 
    if( isDefault( beta ) ) {
       reset( ~C );
@@ -1086,8 +1088,8 @@ template< typename MT1, typename MT2, typename MT3 >
 inline void mmm( MT1& C, const MT2& A, const MT3& B )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
@@ -1129,8 +1131,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
    using SIMDType = SIMDTrait_t<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
@@ -1167,8 +1169,8 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
+   DynamicMatrix< ET2, false, TemporaryAllocator<ET2> > A2( M, KBLOCK );
+   DynamicMatrix< ET3, true, TemporaryAllocator<ET3> >  B2( KBLOCK, JBLOCK );
 
    decltype(auto) c( derestrict( ~C ) );
 
@@ -1655,8 +1657,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
    using SIMDType = SIMDTrait_t<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
@@ -1693,8 +1695,8 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
+   DynamicMatrix< ET2, false, TemporaryAllocator<ET2> > A2( IBLOCK, KBLOCK );
+   DynamicMatrix< ET3, true, TemporaryAllocator<ET3> >  B2( KBLOCK, N );
 
    decltype(auto) c( derestrict( ~C ) );
 
@@ -2156,8 +2158,8 @@ template< typename MT1, typename MT2, typename MT3 >
 inline void lmmm( MT1& C, const MT2& A, const MT3& B )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
@@ -2199,8 +2201,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
    using SIMDType = SIMDTrait_t<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
@@ -2237,8 +2239,8 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
+   DynamicMatrix< ET2, false, TemporaryAllocator<ET2> > A2( M, KBLOCK );
+   DynamicMatrix< ET3, true, TemporaryAllocator<ET3> >  B2( KBLOCK, JBLOCK );
 
    decltype(auto) c( derestrict( ~C ) );
 
@@ -2717,8 +2719,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
    using SIMDType = SIMDTrait_t<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
@@ -2755,8 +2757,8 @@ void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
+   DynamicMatrix< ET2, false, TemporaryAllocator<ET2> > A2( IBLOCK, KBLOCK );
+   DynamicMatrix< ET3, true, TemporaryAllocator<ET3> >  B2( KBLOCK, N );
 
    decltype(auto) c( derestrict( ~C ) );
 
@@ -3224,8 +3226,8 @@ template< typename MT1, typename MT2, typename MT3 >
 inline void ummm( MT1& C, const MT2& A, const MT3& B )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
@@ -3266,8 +3268,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void smmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT1 );
@@ -3336,8 +3338,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void smmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT1 );
@@ -3404,8 +3406,8 @@ template< typename MT1, typename MT2, typename MT3 >
 inline void smmm( MT1& C, const MT2& A, const MT3& B )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
@@ -3446,8 +3448,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void hmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT1 );
@@ -3516,8 +3518,8 @@ template< typename MT1, typename MT2, typename MT3, typename ST >
 void hmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT1 );
@@ -3584,8 +3586,8 @@ template< typename MT1, typename MT2, typename MT3 >
 inline void hmmm( MT1& C, const MT2& A, const MT3& B )
 {
    using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
+   using ET2 = RemoveConst_t< ElementType_t<MT2> >;
+   using ET3 = RemoveConst_t< ElementType_t<MT3> >;
 
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
@@ -0,0 +1,286 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedHeader.h
+//  \brief Header file for the file header of memory mapped vectors and matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDHEADER_H_
+#define _BLAZE_MATH_DENSE_MAPPEDHEADER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <string>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MemoryMapping.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief File header of memory mapped vectors and matrices.
+// \ingroup math
+//
+// The MappedHeader represents the header at the beginning of each file that is used by the
+// MappedVector and MappedMatrix class templates. The header is followed by the elements of the
+// vector or matrix, which start at byte \a offset of the file. Each row (in case of a row-major
+// matrix) or column (in case of a column-major matrix) occupies \a spacing elements, i.e. it is
+// padded with zeros to a multiple of 64 bytes. Since the offset is a multiple of the page size,
+// this layout guarantees that the elements are properly aligned and padded for all SIMD
+// instruction sets up to a register width of 64 bytes (AVX-512), independent of the instruction
+// set that was used to write the file. Note that all values are stored in native byte order.
+*/
+struct MappedHeader
+{
+   //**Constants***********************************************************************************
+   static constexpr size_t alignment = 64UL;    //!< Alignment of all rows/columns in bytes.
+   static constexpr size_t offset    = 4096UL;  //!< Offset of the first element in bytes.
+   //**********************************************************************************************
+
+   //**Object types********************************************************************************
+   enum ObjectType : uint32_t {
+      vector            = 0U,  //!< Object type of a vector.
+      rowMajorMatrix    = 1U,  //!< Object type of a row-major matrix.
+      columnMajorMatrix = 2U   //!< Object type of a column-major matrix.
+   };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   char     signature[8];  //!< The file signature ("BLAZEMAP").
+   uint32_t version;       //!< The version of the file layout.
+   uint32_t type;          //!< The type of the stored vector or matrix.
+   uint32_t elementType;   //!< The type of the elements (see TypeValueMapping).
+   uint32_t elementSize;   //!< The size of a single element in bytes.
+   uint64_t rows;          //!< The number of rows of the matrix (or the size of the vector).
+   uint64_t columns;       //!< The number of columns of the matrix (1 in case of a vector).
+   uint64_t spacing;       //!< The number of elements between two rows/columns.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculation of the padded number of elements of a row/column of a mapped file.
+// \ingroup math
+//
+// \param n The number of elements of the row/column.
+// \return The padded number of elements.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t mappedSpacing( size_t n ) noexcept
+{
+   constexpr size_t factor( MappedHeader::alignment % sizeof( Type ) == 0UL
+                            ? MappedHeader::alignment / sizeof( Type )
+                            : 1UL );
+
+   return nextMultiple( n, factor );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creation of a new mapped file for a vector or matrix.
+// \ingroup math
+//
+// \param file The name of the file to be created.
+// \param type The type of the vector or matrix.
+// \param m The number of rows of the matrix (or the size of the vector).
+// \param n The number of columns of the matrix (1 in case of a vector).
+// \param pattern The expected access pattern to the mapped memory.
+// \return The read-write mapping of the new file.
+// \exception std::runtime_error File could not be created.
+//
+// This function creates a new file for a vector or matrix of the given size, writes the file
+// header and maps the file read-write into memory. All elements are initialized to zero.
+*/
+template< typename Type >  // Data type of the elements
+MemoryMapping createMappedFile( const std::string& file, MappedHeader::ObjectType type,
+                                size_t m, size_t n, AccessPattern pattern )
+{
+   using ET = RemoveConst_t<Type>;
+
+   BLAZE_STATIC_ASSERT_MSG( AlignmentOf_v<ET> <= MappedHeader::alignment,
+                            "Unsupported element alignment detected" );
+
+   const size_t mm( type == MappedHeader::rowMajorMatrix ? m : n );
+   const size_t nn( mappedSpacing<ET>( type == MappedHeader::rowMajorMatrix ? n : m ) );
+
+   MemoryMapping mapping( file, MappedHeader::offset + mm*nn*sizeof( ET ), pattern );
+
+   MappedHeader header{};
+   std::memcpy( header.signature, "BLAZEMAP", 8UL );
+   header.version     = 1U;
+   header.type        = type;
+   header.elementType = TypeValueMapping<ET>::value;
+   header.elementSize = sizeof( ET );
+   header.rows        = m;
+   header.columns     = n;
+   header.spacing     = nn;
+
+   std::memcpy( mapping.address(), &header, sizeof( MappedHeader ) );
+
+   return mapping;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mapping of an existing mapped file of a vector or matrix.
+// \ingroup math
+//
+// \param file The name of the file to be mapped.
+// \param type The expected type of the vector or matrix.
+// \param pattern The expected access pattern to the mapped memory.
+// \return The mapping of the file.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid file header detected.
+//
+// This function maps the given file into memory and checks its header. In case \a Type is a
+// const-qualified type, the file is mapped read-only, else it is mapped read-write. In case the
+// file header doesn't match the given type of vector or matrix or the given element type or in
+// case the file is too small, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the elements
+MemoryMapping openMappedFile( const std::string& file, MappedHeader::ObjectType type,
+                              AccessPattern pattern )
+{
+   using ET = RemoveConst_t<Type>;
+
+   MemoryMapping mapping( file, !IsConst_v<Type>, pattern );
+
+   if( mapping.bytes() < MappedHeader::offset ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt mapped file detected" );
+   }
+
+   MappedHeader header;
+   std::memcpy( &header, mapping.address(), sizeof( MappedHeader ) );
+
+   if( std::memcmp( header.signature, "BLAZEMAP", 8UL ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file signature detected" );
+   }
+   else if( header.version != 1U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( header.type != type ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid vector/matrix type detected" );
+   }
+   else if( header.elementType != static_cast<uint32_t>( TypeValueMapping<ET>::value ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( header.elementSize != sizeof( ET ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+
+   const size_t mm( type == MappedHeader::columnMajorMatrix ? header.columns : header.rows );
+   const size_t n ( type == MappedHeader::columnMajorMatrix ? header.rows : header.columns );
+
+   if( header.spacing != mappedSpacing<ET>( type == MappedHeader::vector ? mm : n ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid spacing detected" );
+   }
+   else if( mapping.bytes() < MappedHeader::offset + ( type == MappedHeader::vector ? 1UL : mm )
+                                                     * header.spacing * sizeof( ET ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt mapped file detected" );
+   }
+
+   return mapping;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the file header of the given mapping.
+// \ingroup math
+//
+// \param mapping The mapping of a vector or matrix file.
+// \return The file header.
+*/
+inline MappedHeader mappedHeader( const MemoryMapping& mapping ) noexcept
+{
+   MappedHeader header;
+   std::memcpy( &header, mapping.address(), sizeof( MappedHeader ) );
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the first element of the given mapping.
+// \ingroup math
+//
+// \param mapping The mapping of a vector or matrix file.
+// \return Pointer to the first element.
+*/
+template< typename Type >  // Data type of the elements
+Type* mappedElements( const MemoryMapping& mapping ) noexcept
+{
+   return reinterpret_cast<Type*>( static_cast<char*>( mapping.address() ) + MappedHeader::offset );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,618 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedMatrix.h
+//  \brief Header file for the implementation of a memory mapped dense matrix
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_MAPPEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <utility>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/MappedHeader.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsCustom.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MemoryMapping.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_matrix MappedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a dense matrix backed by a memory mapped file.
+// \ingroup mapped_matrix
+//
+// The MappedMatrix class template is a CustomMatrix<Type,aligned,padded,SO> that adapts the
+// elements of a memory mapped file. The type of the elements and the storage order of the
+// matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class MappedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedMatrix can be used with any
+//          non-reference, non-pointer element type that is supported by the serialization
+//          of matrices. In case \a Type is const-qualified, the file is mapped read-only,
+//          else the file is mapped read-write and all modifications of the matrix are
+//          written back to the file.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// Since a MappedMatrix is a CustomMatrix, it can be used in all operations in place of a
+// CustomMatrix. Mapping a file is a constant time operation, the elements of the file are only
+// read on demand. Therefore even very large matrices can be used immediately, without the need
+// to deserialize them first:
+
+   \code
+   using blaze::MappedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   // Writing the matrix to a new file
+   {
+      MappedMatrix<double> B( "A.blaze", 1000UL, 1000UL );
+      B = A;
+   }
+
+   // Mapping the matrix read-only in preparation of a row-wise traversal
+   const MappedMatrix<const double> C( "A.blaze", blaze::sequentialAccess );
+
+   DynamicVector<double> x( 1000UL, 1.0 );
+   DynamicVector<double> y( C * x );
+   \endcode
+
+// The file consists of a header and the elements of the matrix. Each row (in case of a row-major
+// matrix) or column (in case of a column-major matrix) is aligned and padded for all supported
+// SIMD instruction sets (see MappedHeader). Note that in case the matrix is mapped read-write,
+// the padding elements are reset on construction, which touches each row/column of the file
+// once. Also note that the functions of the CustomMatrix class template that rebind a custom
+// matrix to a different array (as for instance \c clear() or \c swap()) must not be used on a
+// MappedMatrix.
+*/
+template< typename Type                     // Data type of the matrix
+        , bool SO = defaultStorageOrder >   // Storage order
+class MappedMatrix
+   : public CustomMatrix<Type,aligned,padded,SO>
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = MappedMatrix<Type,SO>;                 //!< Type of this MappedMatrix instance.
+   using BaseType = CustomMatrix<Type,aligned,padded,SO>;  //!< Base type of this instance.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedMatrix( const std::string& file, AccessPattern pattern = normalAccess );
+   explicit inline MappedMatrix( const std::string& file, size_t m, size_t n,
+                                 AccessPattern pattern = normalAccess );
+
+   MappedMatrix( const MappedMatrix& ) = delete;
+   MappedMatrix( MappedMatrix&& ) noexcept = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   using BaseType::operator=;
+
+   inline MappedMatrix& operator=( const MappedMatrix& rhs );
+   inline MappedMatrix& operator=( BaseType&& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void reset();
+   inline void reset   ( size_t i );
+   inline void advise  ( AccessPattern pattern ) const;
+   inline void prefetch( size_t i, size_t n ) const;
+   inline void sync    () const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedMatrix( MemoryMapping&& mapping );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   using BaseType::clear;
+   using BaseType::swap;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MemoryMapping mapping_;  //!< The mapping of the file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mapping of an existing matrix file.
+//
+// \param file The name of the file to be mapped.
+// \param pattern The expected access pattern to the elements of the matrix.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid file header detected.
+//
+// This constructor maps the given file, which has to be created by a MappedMatrix with the
+// same element type and storage order. In case the file cannot be mapped or the file header
+// does not match the matrix, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::MappedMatrix( const std::string& file, AccessPattern pattern )
+   : MappedMatrix( openMappedFile<Type>( file, SO ? MappedHeader::columnMajorMatrix
+                                                  : MappedHeader::rowMajorMatrix, pattern ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a new matrix file.
+//
+// \param file The name of the file to be created.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param pattern The expected access pattern to the elements of the matrix.
+// \exception std::runtime_error File could not be created.
+//
+// This constructor creates a new file for a \f$ M \times N \f$ matrix and maps it read-write.
+// All matrix elements are initialized to 0. Note that this constructor is not available for
+// matrices with const-qualified element type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::MappedMatrix( const std::string& file, size_t m, size_t n,
+                                            AccessPattern pattern )
+   : MappedMatrix( createMappedFile<Type>( file, SO ? MappedHeader::columnMajorMatrix
+                                                    : MappedHeader::rowMajorMatrix,
+                                           m, n, pattern ) )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adaption of the given mapping.
+//
+// \param mapping The mapping of a valid matrix file.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::MappedMatrix( MemoryMapping&& mapping )
+   : BaseType( mappedElements<Type>( mapping ), mappedHeader( mapping ).rows,
+               mappedHeader( mapping ).columns, mappedHeader( mapping ).spacing )
+   , mapping_( std::move( mapping ) )  // The mapping of the file
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MappedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The elements of the given matrix are copied into the mapped file. In case the sizes of the
+// two matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>& MappedMatrix<Type,SO>::operator=( const MappedMatrix& rhs )
+{
+   BaseType::operator=( static_cast<const BaseType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of a temporary custom matrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In contrast to the move assignment of a CustomMatrix, this assignment operator copies the
+// elements of the given matrix into the mapped file. In case the sizes of the two matrices don't
+// match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>& MappedMatrix<Type,SO>::operator=( BaseType&& rhs )
+{
+   BaseType::operator=( static_cast<const BaseType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::reset()
+{
+   BaseType::reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to reset.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::reset( size_t i )
+{
+   BaseType::reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the expected access pattern to the matrix elements.
+//
+// \param pattern The expected access pattern to the matrix elements.
+// \return void
+//
+// This function should be used to announce the access pattern of the following operations,
+// as for instance \a blaze::sequentialAccess before a row-wise traversal of a row-major matrix
+// or \a blaze::randomAccess before accessing individual elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::advise( AccessPattern pattern ) const
+{
+   mapping_.advise( pattern );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the asynchronous read-ahead of a range of rows/columns.
+//
+// \param i The index of the first row/column of the range.
+// \param n The number of rows/columns of the range.
+// \return void
+//
+// This function triggers the asynchronous read-ahead of the rows \f$ [i..i+n) \f$ (in case of
+// a row-major matrix) or columns \f$ [i..i+n) \f$ (in case of a column-major matrix) from the
+// file.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::prefetch( size_t i, size_t n ) const
+{
+   const size_t bytes( this->spacing() * sizeof( Type ) );
+   mapping_.prefetch( MappedHeader::offset + i*bytes, n*bytes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing all modifications of the matrix back to the file.
+//
+// \return void
+// \exception std::runtime_error File could not be synchronized.
+//
+// This function blocks until all modifications of the matrix have been written to the file. In
+// case of a read-only matrix the function has no effect.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::sync() const
+{
+   mapping_.sync();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MappedMatrix operators */
+//@{
+template< typename Type, bool SO >
+void reset( MappedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+void reset( MappedMatrix<Type,SO>& m, size_t i );
+
+template< bool RF, typename Type, bool SO >
+bool isDefault( const MappedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+bool isIntact( const MappedMatrix<Type,SO>& m );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given mapped matrix.
+// \ingroup mapped_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( MappedMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given mapped matrix.
+// \ingroup mapped_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( MappedMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given mapped matrix is in default state.
+// \ingroup mapped_matrix
+//
+// \param m The mapped matrix to be tested for its default state.
+// \return \a true in case the given matrix is empty, \a false otherwise.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const MappedMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given mapped matrix are intact.
+// \ingroup mapped_matrix
+//
+// \param m The mapped matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const MappedMatrix<Type,SO>& m )
+{
+   return ( m.rows() * m.columns() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASCONSTDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct HasConstDataAccess< MappedMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASMUTABLEDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct HasMutableDataAccess< MappedMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCUSTOM SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsCustom< MappedMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsAligned< MappedMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCONTIGUOUS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsContiguous< MappedMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsPadded< MappedMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
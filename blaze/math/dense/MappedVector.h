@@ -0,0 +1,560 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedVector.h
+//  \brief Header file for the implementation of a memory mapped dense vector
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDVECTOR_H_
+#define _BLAZE_MATH_DENSE_MAPPEDVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <utility>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/MappedHeader.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsCustom.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MemoryMapping.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_vector MappedVector
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a dense vector backed by a memory mapped file.
+// \ingroup mapped_vector
+//
+// The MappedVector class template is a CustomVector<Type,aligned,padded,TF> that adapts the
+// elements of a memory mapped file. The type of the elements and the transpose flag of the
+// vector can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool TF >
+   class MappedVector;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. MappedVector can be used with any
+//          non-reference, non-pointer element type that is supported by the serialization
+//          of vectors. In case \a Type is const-qualified, the file is mapped read-only,
+//          else the file is mapped read-write and all modifications of the vector are
+//          written back to the file.
+//  - TF  : specifies whether the vector is a row vector (\c blaze::rowVector) or a column
+//          vector (\c blaze::columnVector). The default value is \c blaze::columnVector.
+//
+// Since a MappedVector is a CustomVector, it can be used in all operations in place of a
+// CustomVector. Mapping a file is a constant time operation, the elements of the file are
+// only read on demand:
+
+   \code
+   using blaze::MappedVector;
+   using blaze::DynamicVector;
+
+   // Creating a new file for a vector of size 1000 (all elements are initialized to 0)
+   MappedVector<double> a( "a.blaze", 1000UL );
+   a[0] = 1.0;
+
+   // Mapping the existing file read-only
+   const MappedVector<const double> b( "a.blaze" );
+   DynamicVector<double> c( 2.0 * b );
+   \endcode
+
+// The file consists of a header and the elements of the vector, which are aligned and padded
+// for all supported SIMD instruction sets (see MappedHeader). Note that the functions of the
+// CustomVector class template that rebind a custom vector to a different array (as for instance
+// \c clear() or \c swap()) must not be used on a MappedVector.
+*/
+template< typename Type                     // Data type of the vector
+        , bool TF = defaultTransposeFlag >  // Transpose flag
+class MappedVector
+   : public CustomVector<Type,aligned,padded,TF>
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = MappedVector<Type,TF>;                 //!< Type of this MappedVector instance.
+   using BaseType = CustomVector<Type,aligned,padded,TF>;  //!< Base type of this instance.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedVector( const std::string& file, AccessPattern pattern = normalAccess );
+   explicit inline MappedVector( const std::string& file, size_t n,
+                                 AccessPattern pattern = normalAccess );
+
+   MappedVector( const MappedVector& ) = delete;
+   MappedVector( MappedVector&& ) noexcept = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   using BaseType::operator=;
+
+   inline MappedVector& operator=( const MappedVector& rhs );
+   inline MappedVector& operator=( BaseType&& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void reset();
+   inline void advise  ( AccessPattern pattern ) const;
+   inline void prefetch( size_t index, size_t n ) const;
+   inline void sync    () const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedVector( MemoryMapping&& mapping );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   using BaseType::clear;
+   using BaseType::swap;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MemoryMapping mapping_;  //!< The mapping of the file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mapping of an existing vector file.
+//
+// \param file The name of the file to be mapped.
+// \param pattern The expected access pattern to the elements of the vector.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid file header detected.
+//
+// This constructor maps the given file, which has to be created by a MappedVector with the
+// same element type. In case the file cannot be mapped or the file header does not match the
+// vector, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappedVector<Type,TF>::MappedVector( const std::string& file, AccessPattern pattern )
+   : MappedVector( openMappedFile<Type>( file, MappedHeader::vector, pattern ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a new vector file.
+//
+// \param file The name of the file to be created.
+// \param n The size of the vector.
+// \param pattern The expected access pattern to the elements of the vector.
+// \exception std::runtime_error File could not be created.
+//
+// This constructor creates a new file for a vector of size \a n and maps it read-write. All
+// vector elements are initialized to 0. Note that this constructor is not available for vectors
+// with const-qualified element type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappedVector<Type,TF>::MappedVector( const std::string& file, size_t n,
+                                            AccessPattern pattern )
+   : MappedVector( createMappedFile<Type>( file, MappedHeader::vector, n, 1UL, pattern ) )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adaption of the given mapping.
+//
+// \param mapping The mapping of a valid vector file.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappedVector<Type,TF>::MappedVector( MemoryMapping&& mapping )
+   : BaseType( mappedElements<Type>( mapping ), mappedHeader( mapping ).rows,
+               mappedHeader( mapping ).spacing )
+   , mapping_( std::move( mapping ) )  // The mapping of the file
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MappedVector.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The elements of the given vector are copied into the mapped file. In case the sizes of the
+// two vectors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappedVector<Type,TF>& MappedVector<Type,TF>::operator=( const MappedVector& rhs )
+{
+   BaseType::operator=( static_cast<const BaseType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of a temporary custom vector.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In contrast to the move assignment of a CustomVector, this assignment operator copies the
+// elements of the given vector into the mapped file. In case the sizes of the two vectors don't
+// match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappedVector<Type,TF>& MappedVector<Type,TF>::operator=( BaseType&& rhs )
+{
+   BaseType::operator=( static_cast<const BaseType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void MappedVector<Type,TF>::reset()
+{
+   BaseType::reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the expected access pattern to the vector elements.
+//
+// \param pattern The expected access pattern to the vector elements.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void MappedVector<Type,TF>::advise( AccessPattern pattern ) const
+{
+   mapping_.advise( pattern );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the asynchronous read-ahead of a range of vector elements.
+//
+// \param index The index of the first element of the range.
+// \param n The number of elements of the range.
+// \return void
+//
+// This function triggers the asynchronous read-ahead of the elements \f$ [index..index+n) \f$
+// from the file.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void MappedVector<Type,TF>::prefetch( size_t index, size_t n ) const
+{
+   mapping_.prefetch( MappedHeader::offset + index*sizeof( Type ), n*sizeof( Type ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing all modifications of the vector back to the file.
+//
+// \return void
+// \exception std::runtime_error File could not be synchronized.
+//
+// This function blocks until all modifications of the vector have been written to the file. In
+// case of a read-only vector the function has no effect.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void MappedVector<Type,TF>::sync() const
+{
+   mapping_.sync();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MappedVector operators */
+//@{
+template< typename Type, bool TF >
+void reset( MappedVector<Type,TF>& v );
+
+template< bool RF, typename Type, bool TF >
+bool isDefault( const MappedVector<Type,TF>& v );
+
+template< typename Type, bool TF >
+bool isIntact( const MappedVector<Type,TF>& v ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given mapped vector.
+// \ingroup mapped_vector
+//
+// \param v The vector to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void reset( MappedVector<Type,TF>& v )
+{
+   v.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given mapped vector is in default state.
+// \ingroup mapped_vector
+//
+// \param v The mapped vector to be tested for its default state.
+// \return \a true in case the given vector is empty, \a false otherwise.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline bool isDefault( const MappedVector<Type,TF>& v )
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given mapped vector are intact.
+// \ingroup mapped_vector
+//
+// \param v The mapped vector to be tested.
+// \return \a true in case the given vector's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline bool isIntact( const MappedVector<Type,TF>& v ) noexcept
+{
+   return ( v.size() <= v.capacity() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASCONSTDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF >
+struct HasConstDataAccess< MappedVector<T,TF> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASMUTABLEDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF >
+struct HasMutableDataAccess< MappedVector<T,TF> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCUSTOM SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF >
+struct IsCustom< MappedVector<T,TF> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF >
+struct IsAligned< MappedVector<T,TF> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCONTIGUOUS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF >
+struct IsContiguous< MappedVector<T,TF> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF >
+struct IsPadded< MappedVector<T,TF> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,192 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/NUMA.h
+//  \brief Header file for the NUMA placement of dense vectors and matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_NUMA_H_
+#define _BLAZE_MATH_DENSE_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Contiguous.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/util/NUMA.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NUMA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NUMA functions */
+//@{
+template< typename VT, bool TF >
+bool interleave( DenseVector<VT,TF>& dv ) noexcept;
+
+template< typename VT, bool TF >
+bool bindToNode( DenseVector<VT,TF>& dv, size_t node ) noexcept;
+
+template< typename MT, bool SO >
+bool interleave( DenseMatrix<MT,SO>& dm ) noexcept;
+
+template< typename MT, bool SO >
+bool bindToNode( DenseMatrix<MT,SO>& dm, size_t node ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Interleaves the elements of the given dense vector across all NUMA nodes.
+// \ingroup dense_vector
+//
+// \param dv The given contiguous dense vector.
+// \return \a true in case the elements were successfully interleaved, \a false if not.
+//
+// This function distributes the memory pages of the given dense vector round-robin across all
+// NUMA nodes. Elements that have already been initialized are moved accordingly, but keep their
+// values:
+
+   \code
+   blaze::DynamicVector<double> a( 100000000UL, 0.0 );
+   blaze::DynamicVector<double> b( 100000000UL, 1.0 );
+
+   interleave( a );
+   interleave( b );
+
+   a += b;  // Every thread accesses all NUMA nodes uniformly
+   \endcode
+
+// Only memory pages that are completely occupied by the vector are affected. NUMA placement
+// is only supported on Linux systems. On all other systems the function has no effect and
+// returns \a false.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+bool interleave( DenseVector<VT,TF>& dv ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( VT );
+
+   return interleaveMemory( (~dv).data(), (~dv).size()*sizeof( ElementType_t<VT> ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the elements of the given dense vector to the given NUMA node.
+// \ingroup dense_vector
+//
+// \param dv The given contiguous dense vector.
+// \param node The index of the NUMA node.
+// \return \a true in case the elements were successfully bound, \a false if not.
+//
+// This function places the memory pages of the given dense vector on the given NUMA node.
+// Elements that have already been initialized are moved accordingly, but keep their values.
+// Only memory pages that are completely occupied by the vector are affected. NUMA placement
+// is only supported on Linux systems. On all other systems the function has no effect and
+// returns \a false.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+bool bindToNode( DenseVector<VT,TF>& dv, size_t node ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( VT );
+
+   return bindMemory( (~dv).data(), (~dv).size()*sizeof( ElementType_t<VT> ), node );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Interleaves the elements of the given dense matrix across all NUMA nodes.
+// \ingroup dense_matrix
+//
+// \param dm The given contiguous dense matrix.
+// \return \a true in case the elements were successfully interleaved, \a false if not.
+//
+// This function distributes the memory pages of the given dense matrix round-robin across all
+// NUMA nodes. Elements that have already been initialized are moved accordingly, but keep their
+// values. Only memory pages that are completely occupied by the matrix are affected. NUMA
+// placement is only supported on Linux systems. On all other systems the function has no
+// effect and returns \a false.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+bool interleave( DenseMatrix<MT,SO>& dm ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+
+   const size_t n( SO ? (~dm).columns() : (~dm).rows() );
+
+   return interleaveMemory( (~dm).data(), n*(~dm).spacing()*sizeof( ElementType_t<MT> ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the elements of the given dense matrix to the given NUMA node.
+// \ingroup dense_matrix
+//
+// \param dm The given contiguous dense matrix.
+// \param node The index of the NUMA node.
+// \return \a true in case the elements were successfully bound, \a false if not.
+//
+// This function places the memory pages of the given dense matrix on the given NUMA node.
+// Elements that have already been initialized are moved accordingly, but keep their values.
+// Only memory pages that are completely occupied by the matrix are affected. NUMA placement
+// is only supported on Linux systems. On all other systems the function has no effect and
+// returns \a false.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+bool bindToNode( DenseMatrix<MT,SO>& dm, size_t node ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+
+   const size_t n( SO ? (~dm).columns() : (~dm).rows() );
+
+   return bindMemory( (~dm).data(), n*(~dm).spacing()*sizeof( ElementType_t<MT> ), node );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,348 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedIterator.h
+//  \brief Header file for the PackedIterator class template
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDITERATOR_H_
+#define _BLAZE_MATH_DENSE_PACKEDITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <utility>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of an iterator over a single row/column of a packed matrix.
+// \ingroup dense
+//
+// The PackedIterator class template represents a random access iterator over all elements of a
+// single row (in case of a row-major matrix) or column (in case of a column-major matrix) of a
+// packed matrix, including the elements of the unstored triangle. Since these elements are not
+// part of the packed storage, the iterator does not refer to contiguous memory, but accesses the
+// elements by means of the function call operator of the matrix. In case \a MT is a const type,
+// the iterator provides read-only access to the elements.
+*/
+template< typename MT  // Type of the packed matrix
+        , bool SO >    // Storage order of the packed matrix
+class PackedIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using IteratorCategory = std::random_access_iterator_tag;                     //!< The iterator category.
+   using ValueType        = typename RemoveConst_t<MT>::ElementType;             //!< Type of the underlying elements.
+   using PointerType      = void;                                                //!< Pointer return type.
+   using ReferenceType    = decltype( std::declval<MT&>()( size_t(), size_t() ) );//!< Reference return type.
+   using DifferenceType   = ptrdiff_t;                                           //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Default constructor for the PackedIterator class.
+   */
+   inline constexpr PackedIterator() noexcept
+      : matrix_( nullptr )  // Pointer to the packed matrix
+      , line_  ( 0UL )      // Index of the row/column
+      , index_ ( 0UL )      // Index of the current element within the row/column
+   {}
+
+   /*!\brief Constructor for the PackedIterator class.
+   //
+   // \param matrix The packed matrix.
+   // \param line The index of the row/column.
+   // \param index The index of the initial element within the row/column.
+   */
+   inline constexpr PackedIterator( MT& matrix, size_t line, size_t index ) noexcept
+      : matrix_( &matrix )  // Pointer to the packed matrix
+      , line_  ( line    )  // Index of the row/column
+      , index_ ( index   )  // Index of the current element within the row/column
+   {}
+
+   /*!\brief Conversion constructor from a modifiable PackedIterator.
+   //
+   // \param it The iterator to be copied.
+   */
+   template< typename MT2, typename = EnableIf_t< IsConst_v<MT> && !IsConst_v<MT2> > >
+   inline constexpr PackedIterator( const PackedIterator<MT2,SO>& it ) noexcept
+      : matrix_( it.matrix() )  // Pointer to the packed matrix
+      , line_  ( it.line()   )  // Index of the row/column
+      , index_ ( it.index()  )  // Index of the current element within the row/column
+   {}
+
+   PackedIterator( const PackedIterator& ) = default;
+   PackedIterator& operator=( const PackedIterator& ) = default;
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return Reference to the incremented iterator.
+   */
+   inline constexpr PackedIterator& operator+=( ptrdiff_t inc ) noexcept {
+      index_ += inc;
+      return *this;
+   }
+
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return Reference to the decremented iterator.
+   */
+   inline constexpr PackedIterator& operator-=( ptrdiff_t dec ) noexcept {
+      index_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline constexpr PackedIterator& operator++() noexcept {
+      ++index_;
+      return *this;
+   }
+
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline constexpr const PackedIterator operator++( int ) noexcept {
+      return PackedIterator( *matrix_, line_, index_++ );
+   }
+
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline constexpr PackedIterator& operator--() noexcept {
+      --index_;
+      return *this;
+   }
+
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline constexpr const PackedIterator operator--( int ) noexcept {
+      return PackedIterator( *matrix_, line_, index_-- );
+   }
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\brief Direct access to the element at the current iterator position.
+   //
+   // \return The current element.
+   */
+   inline ReferenceType operator*() const {
+      return access( index_ );
+   }
+
+   /*!\brief Direct access to an element relative to the current iterator position.
+   //
+   // \param index Offset of the accessed element.
+   // \return The accessed element.
+   */
+   inline ReferenceType operator[]( size_t index ) const {
+      return access( index_ + index );
+   }
+   //**********************************************************************************************
+
+   //**Comparison operators************************************************************************
+   /*!\brief Equality comparison between two PackedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   inline constexpr bool operator==( const PackedIterator& rhs ) const noexcept {
+      return index_ == rhs.index_ && line_ == rhs.line_ && matrix_ == rhs.matrix_;
+   }
+
+   /*!\brief Inequality comparison between two PackedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   inline constexpr bool operator!=( const PackedIterator& rhs ) const noexcept {
+      return !( *this == rhs );
+   }
+
+   /*!\brief Less-than comparison between two PackedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   inline constexpr bool operator<( const PackedIterator& rhs ) const noexcept {
+      return index_ < rhs.index_;
+   }
+
+   /*!\brief Greater-than comparison between two PackedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   inline constexpr bool operator>( const PackedIterator& rhs ) const noexcept {
+      return index_ > rhs.index_;
+   }
+
+   /*!\brief Less-or-equal-than comparison between two PackedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   inline constexpr bool operator<=( const PackedIterator& rhs ) const noexcept {
+      return index_ <= rhs.index_;
+   }
+
+   /*!\brief Greater-or-equal-than comparison between two PackedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   inline constexpr bool operator>=( const PackedIterator& rhs ) const noexcept {
+      return index_ >= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Arithmetic operators************************************************************************
+   /*!\brief Addition between a PackedIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline constexpr const PackedIterator operator+( const PackedIterator& it, ptrdiff_t inc ) noexcept {
+      return PackedIterator( *it.matrix_, it.line_, it.index_ + inc );
+   }
+
+   /*!\brief Addition between an integral value and a PackedIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline constexpr const PackedIterator operator+( ptrdiff_t inc, const PackedIterator& it ) noexcept {
+      return PackedIterator( *it.matrix_, it.line_, it.index_ + inc );
+   }
+
+   /*!\brief Subtraction between a PackedIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline constexpr const PackedIterator operator-( const PackedIterator& it, ptrdiff_t dec ) noexcept {
+      return PackedIterator( *it.matrix_, it.line_, it.index_ - dec );
+   }
+
+   /*!\brief Calculating the number of elements between two PackedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   inline constexpr DifferenceType operator-( const PackedIterator& rhs ) const noexcept {
+      return static_cast<DifferenceType>( index_ ) - static_cast<DifferenceType>( rhs.index_ );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Access to the underlying packed matrix.
+   //
+   // \return Pointer to the packed matrix.
+   */
+   inline constexpr MT* matrix() const noexcept {
+      return matrix_;
+   }
+
+   /*!\brief Access to the index of the row/column of the iterator.
+   //
+   // \return The index of the row/column.
+   */
+   inline constexpr size_t line() const noexcept {
+      return line_;
+   }
+
+   /*!\brief Access to the index of the current element within the row/column.
+   //
+   // \return The index of the current element.
+   */
+   inline constexpr size_t index() const noexcept {
+      return index_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Access function*****************************************************************************
+   /*!\brief Access to the element with the given index within the row/column.
+   //
+   // \param index The index of the accessed element.
+   // \return The accessed element.
+   */
+   inline ReferenceType access( size_t index ) const {
+      return ( SO )?( (*matrix_)( index, line_ ) ):( (*matrix_)( line_, index ) );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT*    matrix_;  //!< Pointer to the packed matrix.
+   size_t line_;    //!< Index of the row/column.
+   size_t index_;   //!< Index of the current element within the row/column.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
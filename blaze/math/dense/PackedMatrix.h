@@ -0,0 +1,2218 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Header file for the implementation of a packed dense matrix
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedIterator.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/PackingFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a square matrix in packed storage format.
+// \ingroup packed_matrix
+//
+// The PackedMatrix class template is the representation of an arbitrary sized, square matrix
+// with a symmetric, Hermitian, lower or upper triangular, or diagonal structure, which stores
+// only the \f$ N(N+1)/2 \f$ elements of a single triangle (or the \f$ N \f$ diagonal elements)
+// in one contiguous array (the packed storage format of BLAS and LAPACK). The type of the elements, the structure and the storage order
+// of the matrix can be specified via the three template parameters:
+
+   \code
+   template< typename Type, PackingFlag PF, bool SO >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - PF  : specifies the structure of the matrix (blaze::packedSymmetric, blaze::packedHermitian,
+//          blaze::packedLower, blaze::packedUpper, or blaze::packedDiagonal). The default value
+//          is blaze::packedSymmetric.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// Symmetric and Hermitian matrices store the lower triangle row by row (in case of a row-major
+// matrix) or the upper triangle column by column (in case of a column-major matrix). Triangular
+// matrices store their non-zero triangle row by row or column by column, respectively. Thus
+// in all cases the stored part of each row/column is contiguous in memory. All elements of the
+// unstored triangle are implied by the structure of the matrix: The elements of a symmetric
+// matrix are mirrored, the elements of a Hermitian matrix are mirrored and conjugated, and the
+// elements of a triangular matrix are zero. Diagonal matrices store only the \f$ N \f$ diagonal
+// elements, all off-diagonal elements are zero.
+//
+// A PackedMatrix is primarily meant to be used as the underlying matrix of a SymmetricMatrix,
+// HermitianMatrix, LowerMatrix, UpperMatrix or DiagonalMatrix adaptor, which guarantees the
+// structure of the matrix. In comparison to a DynamicMatrix the memory requirement is reduced
+// by (almost) a factor of 2 (and by a factor of \f$ N \f$ in case of a diagonal matrix):
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::SymmetricMatrix;
+   using blaze::DynamicVector;
+   using blaze::packedSymmetric;
+
+   SymmetricMatrix< PackedMatrix<double,packedSymmetric> > A( 1000UL );
+   A(2,3) = 4.0;  // Also sets A(3,2)
+
+   DynamicVector<double> x( 1000UL, 1.0 );
+   DynamicVector<double> y = A * x;  // Packed matrix/vector multiplication
+   \endcode
+
+// Note that the PackedMatrix itself does not check the structure of the matrices assigned to
+// it. As in case of the packed BLAS and LAPACK functions, only the elements of the stored
+// triangle are referenced. Also note that any modification of an element of the unstored
+// triangle via a non-const reference has no effect.
+*/
+template< typename Type                     // Data type of the matrix
+        , PackingFlag PF = packedSymmetric  // Structure of the matrix
+        , bool SO = defaultStorageOrder >   // Storage order
+class PackedMatrix
+   : public DenseMatrix< PackedMatrix<Type,PF,SO>, SO >
+{
+ private:
+   //**********************************************************************************************
+   //! Structure of the transpose matrix.
+   static constexpr PackingFlag TF = ( PF == packedLower ? packedUpper
+                                     : PF == packedUpper ? packedLower : PF );
+
+   //! Compile time flag for the storage of the trailing part of each row/column.
+   /*! In case the flag is set to \a true, row/column \a i stores the elements \f$[i..N-1]\f$,
+       otherwise the elements \f$[0..i]\f$. */
+   static constexpr bool trailing = ( PF == packedLower && SO ) || ( PF == packedUpper && !SO );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = PackedMatrix<Type,PF,SO>;   //!< Type of this PackedMatrix instance.
+   using BaseType       = DenseMatrix<This,SO>;       //!< Base type of this PackedMatrix instance.
+   using ResultType     = This;                       //!< Result type for expression template evaluations.
+   using OppositeType   = PackedMatrix<Type,PF,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = PackedMatrix<Type,TF,!SO>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                       //!< Type of the matrix elements.
+   using SIMDType       = SIMDTrait_t<ElementType>;   //!< SIMD type of the matrix elements.
+   using ReturnType     = Type;                       //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                //!< Data type for composite expression templates.
+
+   using Reference      = Type&;        //!< Reference to a non-constant matrix value.
+   using ConstReference = Type;         //!< Reference to a constant matrix value.
+   using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+   using Iterator      = PackedIterator<This,SO>;        //!< Iterator over non-constant elements.
+   using ConstIterator = PackedIterator<const This,SO>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = PackedMatrix<NewType,PF,SO>;  //!< The type of the other matrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a matrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = DynamicMatrix<Type,SO>;  //!< The type of the other matrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the rows/columns of a packed matrix don't
+       have a uniform length, SIMD operations are only applied by the dedicated packed kernels. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedMatrix() noexcept;
+   explicit inline PackedMatrix( size_t m, size_t n );
+   explicit inline PackedMatrix( size_t m, size_t n, const Type& init );
+   explicit inline PackedMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline PackedMatrix( const PackedMatrix& m );
+   inline PackedMatrix( PackedMatrix&& m ) noexcept;
+
+   template< typename MT, bool SO2 >
+   inline PackedMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PackedMatrix& operator=( const Type& rhs );
+   inline PackedMatrix& operator=( initializer_list< initializer_list<Type> > list );
+   inline PackedMatrix& operator=( const PackedMatrix& rhs );
+   inline PackedMatrix& operator=( PackedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline PackedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator%=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t storedBegin( size_t i ) const noexcept;
+   inline size_t storedEnd( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+          void   reserve( size_t elements );
+   inline void   shrinkToFit();
+   inline void   swap( PackedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline PackedMatrix& transpose();
+   inline PackedMatrix& ctranspose();
+
+   template< typename Other > inline PackedMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void assign     ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t packedSize( size_t n ) noexcept;
+   static inline size_t offset( size_t k, size_t l, size_t n ) noexcept;
+
+   inline bool   isStored( size_t k, size_t l ) const noexcept;
+   inline size_t offset  ( size_t k, size_t l ) const noexcept;
+   inline Type   implied ( size_t k, size_t l ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;         //!< The current number of rows/columns of the matrix.
+   size_t capacity_;  //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The packed matrix elements.
+                             /*!< Access to the matrix element (i,j) of the stored triangle is
+                                  given by the offset of row/column \a i plus the distance of
+                                  \a j from the first stored element of row/column \a i. */
+   Type scratch_;     //!< Target of non-const references to elements of the unstored triangle.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix() noexcept
+   : n_       ( 0UL )      // The current number of rows/columns of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The packed matrix elements
+   , scratch_ ()           // Target of references to the unstored triangle
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a square matrix of size \f$ n \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid non-square packed matrix.
+//
+// All elements of the stored triangle are default initialized.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( size_t m, size_t n )
+   : PackedMatrix( m, n, Type() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a square matrix of size \f$ n \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the elements of the stored triangle.
+// \exception std::invalid_argument Invalid non-square packed matrix.
+//
+// All elements of the stored triangle are initialized with the specified value.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( size_t m, size_t n, const Type& init )
+   : n_       ( n )                  // The current number of rows/columns of the matrix
+   , capacity_( packedSize( n ) )    // The maximum capacity of the matrix
+   , v_       ( nullptr )            // The packed matrix elements
+   , scratch_ ()                     // Target of references to the unstored triangle
+{
+   if( m != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square packed matrix" );
+   }
+
+   v_ = allocate<Type>( capacity_ );
+   std::fill( v_, v_+capacity_, init );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid non-square packed matrix.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   blaze::PackedMatrix<int,blaze::packedSymmetric> A{ { 1, 2, 3 },
+                                                      { 2, 4 },
+                                                      { 3, 0, 6 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list. The elements of the
+// stored triangle are (copy) assigned the values of the given initializer list, all other
+// values are ignored. Missing values are initialized as default.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( initializer_list< initializer_list<Type> > list )
+   : PackedMatrix( list.size(), determineColumns( list ) )
+{
+   *this = list;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( const PackedMatrix& m )
+   : n_       ( m.n_ )                     // The current number of rows/columns of the matrix
+   , capacity_( packedSize( m.n_ ) )       // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The packed matrix elements
+   , scratch_ ()                           // Target of references to the unstored triangle
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for PackedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( PackedMatrix&& m ) noexcept
+   : n_       ( m.n_ )         // The current number of rows/columns of the matrix
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_ )         // The packed matrix elements
+   , scratch_ ()               // Target of references to the unstored triangle
+{
+   m.n_        = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid non-square packed matrix.
+//
+// Only the elements of the stored triangle of the given matrix are copied, all other elements
+// are ignored.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the foreign matrix
+        , bool SO2 >      // Storage order of the foreign matrix
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( const Matrix<MT,SO2>& m )
+   : PackedMatrix( (~m).rows(), (~m).columns() )
+{
+   blaze::assign( *this, ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices. Note that in
+// case the element lies within the unstored triangle, the function returns a reference to a
+// temporary copy of the element, whose modification has no effect on the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Reference
+   PackedMatrix<Type,PF,SO>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   if( isStored( k, l ) )
+      return v_[offset( k, l )];
+
+   scratch_ = implied( k, l );
+   return scratch_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstReference
+   PackedMatrix<Type,PF,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   return ( isStored( k, l ) )?( v_[offset( k, l )] ):( implied( k, l ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Reference
+   PackedMatrix<Type,PF,SO>::at( size_t i, size_t j )
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstReference
+   PackedMatrix<Type,PF,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix, which holds
+// the \f$ N(N+1)/2 \f$ elements of the stored triangle in the packed storage format of BLAS
+// and LAPACK (or the \f$ N \f$ diagonal elements in case of a diagonal matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Pointer
+   PackedMatrix<Type,PF,SO>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix, which holds
+// the \f$ N(N+1)/2 \f$ elements of the stored triangle in the packed storage format of BLAS
+// and LAPACK (or the \f$ N \f$ diagonal elements in case of a diagonal matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstPointer
+   PackedMatrix<Type,PF,SO>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// This function returns a pointer to the first stored element of row \a i (in case of a
+// row-major matrix) or column \a i (in case of a column-major matrix). The stored elements
+// of the row/column are contiguous in memory and correspond to the column/row indices in the
+// range \f$[storedBegin(i)..storedEnd(i))\f$.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Pointer
+   PackedMatrix<Type,PF,SO>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return v_ + offset( i, storedBegin( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// This function returns a pointer to the first stored element of row \a i (in case of a
+// row-major matrix) or column \a i (in case of a column-major matrix). The stored elements
+// of the row/column are contiguous in memory and correspond to the column/row indices in the
+// range \f$[storedBegin(i)..storedEnd(i))\f$.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstPointer
+   PackedMatrix<Type,PF,SO>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return v_ + offset( i, storedBegin( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Iterator
+   PackedMatrix<Type,PF,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstIterator
+   PackedMatrix<Type,PF,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstIterator
+   PackedMatrix<Type,PF,SO>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Iterator
+   PackedMatrix<Type,PF,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstIterator
+   PackedMatrix<Type,PF,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstIterator
+   PackedMatrix<Type,PF,SO>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all elements of the stored triangle.
+//
+// \param rhs Scalar value to be assigned to all elements of the stored triangle.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator=( const Type& rhs )
+{
+   std::fill( v_, v_+packedSize( n_ ), rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid non-square packed matrix.
+//
+// The matrix is resized according to the given initializer list. The elements of the stored
+// triangle are (copy) assigned the values from the given initializer list, all other values
+// are ignored. Missing values are initialized as default.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>&
+   PackedMatrix<Type,PF,SO>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   resize( list.size(), determineColumns( list ), false );
+
+   size_t i( 0UL );
+
+   for( const auto& rowList : list ) {
+      size_t j( 0UL );
+      for( const auto& element : rowList ) {
+         const size_t k( SO ? j : i );
+         const size_t l( SO ? i : j );
+         if( isStored( k, l ) )
+            v_[offset( k, l )] = element;
+         ++j;
+      }
+      ++i;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+packedSize( n_ ), v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for PackedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator=( PackedMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid non-square packed matrix.
+//
+// The matrix is resized according to the given matrix. Only the elements of the stored triangle
+// of the given matrix are copied, all other elements are ignored.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).canAlias( this ) ) {
+      PackedMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      blaze::assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      blaze::addAssign( *this, tmp );
+   }
+   else {
+      blaze::addAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      blaze::subAssign( *this, tmp );
+   }
+   else {
+      blaze::subAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator%=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      blaze::schurAssign( *this, tmp );
+   }
+   else {
+      blaze::schurAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// Since the rows/columns of a packed matrix have different lengths, the spacing of a packed
+// matrix corresponds to its number of rows/columns.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::spacing() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of stored elements of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+   return storedEnd( i ) - storedBegin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+//
+// The non-zero elements of the stored triangle of a symmetric or Hermitian matrix are counted
+// twice in case they don't reside on the diagonal.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( storedEnd( k ) );
+      const Type* element( data( k ) );
+      for( size_t l=storedBegin( k ); l<lend; ++l, ++element ) {
+         if( !isDefault( *element ) )
+            nonzeros += ( ( PF == packedSymmetric || PF == packedHermitian ) && l != k )?( 2UL ):( 1UL );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      if( !isDefault( isStored( i, l ) ? v_[offset( i, l )] : implied( i, l ) ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first stored element of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The column/row index of the first stored element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::storedBegin( size_t i ) const noexcept
+{
+   return ( trailing || PF == packedDiagonal )?( i ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last stored element of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The column/row index one past the last stored element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::storedEnd( size_t i ) const noexcept
+{
+   return ( trailing )?( n_ ):( i+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void PackedMatrix<Type,PF,SO>::reset()
+{
+   using blaze::clear;
+
+   for( size_t k=0UL; k<packedSize( n_ ); ++k )
+      clear( v_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// of a symmetric or Hermitian matrix this includes the elements of the unstored triangle, i.e.
+// the corresponding column/row is reset as well.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void PackedMatrix<Type,PF,SO>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      if( isStored( i, l ) )
+         clear( v_[offset( i, l )] );
+      else if( PF == packedSymmetric || PF == packedHermitian )
+         clear( v_[offset( l, i )] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void PackedMatrix<Type,PF,SO>::clear()
+{
+   resize( 0UL, 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid non-square packed matrix.
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. New elements are default initialized.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+void PackedMatrix<Type,PF,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   using std::swap;
+
+   if( m != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square packed matrix" );
+   }
+
+   if( n == n_ ) {
+      if( !preserve ) reset();
+      return;
+   }
+
+   const size_t nn( packedSize( n ) );
+
+   if( preserve && ( trailing || nn > capacity_ ) )
+   {
+      Type* BLAZE_RESTRICT tmp( allocate<Type>( nn ) );
+      std::fill( tmp, tmp+nn, Type() );
+
+      const size_t kmax( n_ < n ? n_ : n );
+
+      for( size_t k=0UL; k<kmax; ++k ) {
+         const size_t lbegin( trailing || PF == packedDiagonal ? k : 0UL );
+         const size_t lend  ( trailing ? kmax : k+1UL );
+         std::copy( v_+offset( k, lbegin, n_ ), v_+offset( k, lbegin, n_ )+( lend-lbegin ),
+                    tmp+offset( k, lbegin, n ) );
+      }
+
+      swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = nn;
+   }
+   else if( preserve )
+   {
+      if( n > n_ ) {
+         std::fill( v_+packedSize( n_ ), v_+nn, Type() );
+      }
+   }
+   else if( nn > capacity_ )
+   {
+      Type* BLAZE_RESTRICT tmp( allocate<Type>( nn ) );
+      std::fill( tmp, tmp+nn, Type() );
+
+      swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = nn;
+   }
+   else
+   {
+      std::fill( v_, v_+nn, Type() );
+   }
+
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the packed matrix.
+// \return void
+//
+// This function increases the capacity of the packed matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+void PackedMatrix<Type,PF,SO>::reserve( size_t elements )
+{
+   using std::swap;
+
+   if( elements > capacity_ )
+   {
+      Type* BLAZE_RESTRICT tmp( allocate<Type>( elements ) );
+      std::copy( v_, v_+packedSize( n_ ), tmp );
+
+      swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. Please note
+// that in case a reallocation occurs, all iterators (including end() iterators), all pointers
+// and references to elements of this matrix are invalidated.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void PackedMatrix<Type,PF,SO>::shrinkToFit()
+{
+   if( capacity_ > packedSize( n_ ) ) {
+      PackedMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void PackedMatrix<Type,PF,SO>::swap( PackedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( n_ , m.n_  );
+   swap( capacity_, m.capacity_ );
+   swap( v_ , m.v_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of stored elements of an \f$ N \times N \f$ matrix.
+//
+// \param n The number of rows/columns of the matrix.
+// \return The number of stored elements.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::packedSize( size_t n ) noexcept
+{
+   return ( PF == packedDiagonal )?( n ):( ( n * ( n+1UL ) ) / 2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the offset of a stored element of an \f$ N \times N \f$ matrix.
+//
+// \param k The index of the row (row-major) or column (column-major) of the element.
+// \param l The index of the column (row-major) or row (column-major) of the element.
+// \param n The number of rows/columns of the matrix.
+// \return The offset of the element within the packed storage.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::offset( size_t k, size_t l, size_t n ) noexcept
+{
+   return ( PF == packedDiagonal )?( k )
+                                  :( ( trailing )?( ( k * ( 2UL*n-k+1UL ) ) / 2UL + ( l-k ) )
+                                                 :( ( k * ( k+1UL ) ) / 2UL + l ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the specified element is part of the stored triangle.
+//
+// \param k The index of the row (row-major) or column (column-major) of the element.
+// \param l The index of the column (row-major) or row (column-major) of the element.
+// \return \a true in case the element is stored, \a false if not.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline bool PackedMatrix<Type,PF,SO>::isStored( size_t k, size_t l ) const noexcept
+{
+   return ( PF == packedDiagonal )?( l == k ):( ( trailing )?( l >= k ):( l <= k ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the offset of a stored element of the matrix.
+//
+// \param k The index of the row (row-major) or column (column-major) of the element.
+// \param l The index of the column (row-major) or row (column-major) of the element.
+// \return The offset of the element within the packed storage.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::offset( size_t k, size_t l ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( isStored( k, l ), "Invalid access to unstored element" );
+   return offset( k, l, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the value of an element of the unstored triangle.
+//
+// \param k The index of the row (row-major) or column (column-major) of the element.
+// \param l The index of the column (row-major) or row (column-major) of the element.
+// \return The value of the element as implied by the structure of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline Type PackedMatrix<Type,PF,SO>::implied( size_t k, size_t l ) const
+{
+   BLAZE_INTERNAL_ASSERT( !isStored( k, l ), "Invalid access to stored element" );
+
+   if( PF == packedSymmetric )
+      return v_[offset( l, k )];
+   else if( PF == packedHermitian )
+      return conj( v_[offset( l, k )] );
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::logic_error Invalid transpose of a triangular packed matrix.
+//
+// The transpose of a symmetric matrix is the matrix itself, the transpose of a Hermitian matrix
+// is its complex conjugate, and the transpose of a diagonal matrix is the matrix itself. Since
+// the transpose of a lower (upper) triangular matrix is upper (lower) triangular, triangular
+// packed matrices cannot be transposed in-place.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::transpose()
+{
+   if( PF == packedLower || PF == packedUpper ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid transpose of a triangular packed matrix" );
+   }
+
+   if( PF == packedHermitian ) {
+      for( size_t k=0UL; k<packedSize( n_ ); ++k )
+         conjugate( v_[k] );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::logic_error Invalid transpose of a triangular packed matrix.
+//
+// The conjugate transpose of a Hermitian matrix is the matrix itself, the conjugate transpose
+// of a symmetric or diagonal matrix is its complex conjugate. Since the conjugate transpose of
+// a lower (upper) triangular matrix is upper (lower) triangular, triangular packed matrices
+// cannot be transposed in-place.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::ctranspose()
+{
+   if( PF == packedLower || PF == packedUpper ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid transpose of a triangular packed matrix" );
+   }
+
+   if( PF == packedSymmetric || PF == packedDiagonal ) {
+      for( size_t k=0UL; k<packedSize( n_ ); ++k )
+         conjugate( v_[k] );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackingFlag PF    // Structure of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::scale( const Other& scalar )
+{
+   for( size_t k=0UL; k<packedSize( n_ ); ++k )
+      v_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the packed matrix are intact.
+//
+// \return \a true in case the packed matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the packed matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline bool PackedMatrix<Type,PF,SO>::isIntact() const noexcept
+{
+   return ( packedSize( n_ ) <= capacity_ ) && ( capacity_ == 0UL || v_ != nullptr );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , PackingFlag PF    // Structure of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,PF,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , PackingFlag PF    // Structure of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,PF,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// Since the rows/columns of a packed matrix start at arbitrary offsets, a packed matrix is
+// never considered to be aligned.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline bool PackedMatrix<Type,PF,SO>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline bool PackedMatrix<Type,PF,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PF,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( storedEnd( k ) );
+      Type* element( data( k ) );
+      for( size_t l=storedBegin( k ); l<lend; ++l, ++element ) {
+         *element = ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PF,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   reset();
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( SO == SO2 ? i : element->index() );
+         const size_t l( SO == SO2 ? element->index() : i );
+         if( isStored( k, l ) )
+            v_[offset( k, l )] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PF,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( storedEnd( k ) );
+      Type* element( data( k ) );
+      for( size_t l=storedBegin( k ); l<lend; ++l, ++element ) {
+         *element += ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PF,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( SO == SO2 ? i : element->index() );
+         const size_t l( SO == SO2 ? element->index() : i );
+         if( isStored( k, l ) )
+            v_[offset( k, l )] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PF,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( storedEnd( k ) );
+      Type* element( data( k ) );
+      for( size_t l=storedBegin( k ); l<lend; ++l, ++element ) {
+         *element -= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PF,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( SO == SO2 ? i : element->index() );
+         const size_t l( SO == SO2 ? element->index() : i );
+         if( isStored( k, l ) )
+            v_[offset( k, l )] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PF,SO>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( storedEnd( k ) );
+      Type* element( data( k ) );
+      for( size_t l=storedBegin( k ); l<lend; ++l, ++element ) {
+         *element *= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PF,SO>::schurAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   PackedMatrix tmp( n_, n_ );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( SO == SO2 ? i : element->index() );
+         const size_t l( SO == SO2 ? element->index() : i );
+         if( isStored( k, l ) )
+            tmp.v_[offset( k, l )] = v_[offset( k, l )] * element->value();
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, PackingFlag PF, bool SO >
+void reset( PackedMatrix<Type,PF,SO>& m );
+
+template< typename Type, PackingFlag PF, bool SO >
+void reset( PackedMatrix<Type,PF,SO>& m, size_t i );
+
+template< typename Type, PackingFlag PF, bool SO >
+void clear( PackedMatrix<Type,PF,SO>& m );
+
+template< bool RF, typename Type, PackingFlag PF, bool SO >
+bool isDefault( const PackedMatrix<Type,PF,SO>& m );
+
+template< typename Type, PackingFlag PF, bool SO >
+bool isIntact( const PackedMatrix<Type,PF,SO>& m ) noexcept;
+
+template< typename Type, PackingFlag PF, bool SO >
+void swap( PackedMatrix<Type,PF,SO>& a, PackedMatrix<Type,PF,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void reset( PackedMatrix<Type,PF,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the specified row/column of the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void reset( PackedMatrix<Type,PF,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void clear( PackedMatrix<Type,PF,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< bool RF         // Relaxation flag
+        , typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline bool isDefault( const PackedMatrix<Type,PF,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given packed matrix are intact.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline bool isIntact( const PackedMatrix<Type,PF,SO>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order
+inline void swap( PackedMatrix<Type,PF,SO>& a, PackedMatrix<Type,PF,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackingFlag PF, bool SO >
+struct IsResizable< PackedMatrix<T,PF,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackingFlag PF, bool SO >
+struct IsShrinkable< PackedMatrix<T,PF,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
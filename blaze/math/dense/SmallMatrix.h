@@ -0,0 +1,7855 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SmallMatrix.h
+//  \brief Header file for the implementation of a dynamic matrix with small buffer optimization
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SMALLMATRIX_H_
+#define _BLAZE_MATH_DENSE_SMALLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Diagonal.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transpose.h>
+#include <blaze/math/dense/UniformMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/smp/Transpose.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/Uninitialized.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/algorithms/Destroy.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/algorithms/UninitializedDefaultConstruct.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/smallarray/SmallArrayData.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsAssignable.h>
+#include <blaze/util/typetraits/IsConstructible.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup small_matrix SmallMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of an arbitrary sized matrix with small buffer optimization.
+// \ingroup small_matrix
+//
+// The SmallMatrix class template is the representation of an arbitrary sized matrix with
+// elements of arbitrary type, which provides in-place storage for up to \f$ M \times N \f$
+// elements and transparently switches to dynamically allocated memory in case the matrix grows
+// beyond this size. The type of the elements, the number of preallocated rows and columns, the
+// storage order of the matrix, and the allocator can be specified via the five template
+// parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N, bool SO, typename Alloc >
+   class SmallMatrix;
+   \endcode
+
+//  - Type : specifies the type of the matrix elements. SmallMatrix can be used with any
+//           non-cv-qualified, non-reference, non-pointer element type.
+//  - M    : specifies the number of preallocated rows.
+//  - N    : specifies the number of preallocated columns. Note that in case padding is enabled
+//           the in-place storage is rounded up to a multiple of the SIMD width per row (in
+//           case of row-major matrices) or per column (in case of column-major matrices).
+//  - SO   : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//           The default value is blaze::rowMajor.
+//  - Alloc: specifies the type of the allocator used for matrices that exceed the in-place
+//           storage. The allocator must return memory that satisfies the alignment restrictions
+//           of the element type (see the AlignmentOf type trait). The default value is
+//           \a blaze::AlignedAllocator.
+//
+// SmallMatrix has the same semantics as DynamicMatrix: It can be resized arbitrarily, all its
+// elements are stored in a row-wise or column-wise fashion, and it can be used in all operations
+// in place of a DynamicMatrix. However, as long as the number of elements (including padding)
+// doesn't exceed the in-place storage, no dynamic memory is allocated. Note that the in-place
+// storage is not bound to the dimensions \a M and \a N: A \f$ 4 \times 4 \f$ small matrix can
+// for instance also hold a \f$ 2 \times 8 \f$ matrix without dynamic memory. Note also that in
+// case a SmallMatrix is allocated dynamically, the alignment is only guaranteed for the \c new
+// operator of the SmallMatrix class itself and for allocators that respect the alignment of the
+// SmallMatrix type.
+//
+// The following example gives an impression of the use of SmallMatrix:
+
+   \code
+   using blaze::SmallMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   SmallMatrix<double,4UL,4UL,rowMajor> A( 2, 3 );  // Non-initialized, row-major 2x3 matrix (no allocation)
+   A(0,0) = 1.0; A(0,1) = 2.0; A(0,2) = 3.0;        // Initialization of the first row
+   A(1,0) = 4.0; A(1,1) = 5.0; A(1,2) = 6.0;        // Initialization of the second row
+
+   SmallMatrix<float,4UL,4UL,columnMajor> B( 2, 3 );  // Non-initialized column-major single precision 2x3 matrix
+   B(0,0) = 1.0; B(0,1) = 3.0; B(0,2) = 5.0;          // Initialization of the first row
+   B(1,0) = 2.0; B(1,1) = 4.0; B(1,2) = 6.0;          // Initialization of the second row
+
+   CompressedMatrix<float>     C( 2, 3 );        // Empty row-major sparse single precision matrix
+   SmallMatrix<float,4UL,4UL>  D( 3, 2, 4.0F );  // Directly, homogeneously initialized single precision 3x2 matrix
+
+   SmallMatrix<double,4UL,4UL,rowMajor>    E( A );  // Creation of a new row-major matrix as a copy of A
+   SmallMatrix<double,4UL,4UL,columnMajor> F;       // Creation of a default column-major matrix
+
+   E = A + B;     // Matrix addition and assignment to a row-major matrix
+   F = A - C;     // Matrix subtraction and assignment to a column-major matrix
+   F = A * D;     // Matrix multiplication between two matrices of different element types
+
+   A *= 2.0;      // In-place scaling of matrix A
+   E  = 2.0 * B;  // Scaling of matrix B
+   F  = D * 2.0;  // Scaling of matrix D
+
+   E += A - B;    // Addition assignment
+   E -= A + C;    // Subtraction assignment
+   F *= A * D;    // Multiplication assignment
+
+   E.resize( 100UL, 100UL );  // Switching to dynamically allocated memory
+   \endcode
+
+// Note that the result type of operations involving small matrices (as for instance additions,
+// subtractions, and multiplications) is determined by the same rules as for any other resizable
+// matrix, i.e. intermediate temporaries are of type DynamicMatrix. In order to avoid dynamic
+// memory allocations, the results should therefore be directly assigned to small matrices.
+*/
+template< typename Type                    // Data type of the matrix
+        , size_t M                         // Number of preallocated rows
+        , size_t N                         // Number of preallocated columns
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename Alloc >                 // Type of the allocator
+class SmallMatrix
+   : public DenseMatrix< SmallMatrix<Type,M,N,SO,Alloc>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = SmallMatrix<Type,M,N,SO,Alloc>;   //!< Type of this SmallMatrix instance.
+   using BaseType      = DenseMatrix<This,SO>;             //!< Base type of this SmallMatrix instance.
+   using ResultType    = This;                             //!< Result type for expression template evaluations.
+   using OppositeType  = SmallMatrix<Type,M,N,!SO,Alloc>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = SmallMatrix<Type,N,M,!SO,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                             //!< Type of the matrix elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;         //!< SIMD type of the matrix elements.
+   using ReturnType    = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType = const This&;                      //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                            //!< Type of the allocator of the matrix elements.
+
+   using Reference      = Type&;        //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+   using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+   using Iterator      = DenseIterator<Type,usePadding>;        //!< Iterator over non-constant elements.
+   using ConstIterator = DenseIterator<const Type,usePadding>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SmallMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using NewAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NewType>;  //!< Type of the rebound allocator.
+      using Other    = SmallMatrix<NewType,M,N,SO,NewAlloc>;                                   //!< The type of the other SmallMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SmallMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = SmallMatrix<Type,M,N,SO,Alloc>;  //!< The type of the other SmallMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. In case the element type of the matrix is a
+       vectorizable data type, the \a simdEnabled compilation flag is set to \a true, otherwise
+       it is set to \a false. */
+   static constexpr bool simdEnabled = IsVectorizable_v<Type>;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SmallMatrix();
+   explicit inline SmallMatrix( size_t m, size_t n );
+   explicit inline SmallMatrix( size_t m, size_t n, const Type& init );
+   explicit inline SmallMatrix( size_t m, size_t n, Uninitialized );
+            inline SmallMatrix( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other >
+   explicit inline SmallMatrix( size_t m, size_t n, const Other* array );
+
+   template< typename Other, size_t Rows, size_t Cols >
+   explicit inline SmallMatrix( const Other (&array)[Rows][Cols] );
+
+                                     inline SmallMatrix( const SmallMatrix& m );
+                                     inline SmallMatrix( SmallMatrix&& m ) noexcept( nothrowMovable );
+   template< typename MT, bool SO2 > inline SmallMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SmallMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SmallMatrix& operator=( const Type& rhs );
+   inline SmallMatrix& operator=( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other, size_t Rows, size_t Cols >
+   inline SmallMatrix& operator=( const Other (&array)[Rows][Cols] );
+
+   inline SmallMatrix& operator=( const SmallMatrix& rhs );
+   inline SmallMatrix& operator=( SmallMatrix&& rhs ) noexcept( nothrowMovable );
+
+   template< typename MT, bool SO2 > inline SmallMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SmallMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SmallMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SmallMatrix& operator%=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   resize ( size_t m, size_t n, bool preserve, Uninitialized );
+   inline void   extend ( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t elements );
+   inline void   shrinkToFit();
+   inline void   swap( SmallMatrix& m ) noexcept( nothrowMovable );
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline SmallMatrix& transpose();
+   inline SmallMatrix& ctranspose();
+
+   template< typename Other > inline SmallMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Memory functions****************************************************************************
+   /*!\name Memory functions */
+   //@{
+   static inline void* operator new  ( std::size_t size );
+   static inline void* operator new[]( std::size_t size );
+   static inline void* operator new  ( std::size_t size, const std::nothrow_t& ) noexcept;
+   static inline void* operator new[]( std::size_t size, const std::nothrow_t& ) noexcept;
+
+   static inline void operator delete  ( void* ptr ) noexcept;
+   static inline void operator delete[]( void* ptr ) noexcept;
+   static inline void operator delete  ( void* ptr, const std::nothrow_t& ) noexcept;
+   static inline void operator delete[]( void* ptr, const std::nothrow_t& ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<MT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedAddAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<MT> > &&
+        HasSIMDAdd_v< Type, ElementType_t<MT> > &&
+        !IsDiagonal_v<MT> );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedSubAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<MT> > &&
+        HasSIMDSub_v< Type, ElementType_t<MT> > &&
+        !IsDiagonal_v<MT> );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<MT> > &&
+        HasSIMDMult_v< Type, ElementType_t<MT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+
+   //! The number of preallocated elements including padding.
+   static constexpr size_t NN = M * ( usePadding ? nextMultiple( N, SIMDSIZE ) : N );
+
+   //! Compilation flag for the exception safety of the move operations and the swap operation.
+   static constexpr bool nothrowMovable = ( IsNothrowDefaultConstructible_v<Type> &&
+                                            IsNothrowMoveConstructible_v<Type> &&
+                                            IsNothrowMoveAssignable_v<Type> );
+   //**********************************************************************************************
+
+ public:
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,SO>& rhs ) -> DisableIf_t< VectorizedAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,SO>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
+
+   template< typename MT > inline void assign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline auto addAssign( const DenseMatrix<MT,SO>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto addAssign( const DenseMatrix<MT,SO>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT> >;
+
+   template< typename MT > inline void addAssign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT > inline void addAssign( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT > inline void addAssign( const SparseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline auto subAssign( const DenseMatrix<MT,SO>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto subAssign( const DenseMatrix<MT,SO>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT> >;
+
+   template< typename MT > inline void subAssign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT > inline void subAssign( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT > inline void subAssign( const SparseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline auto schurAssign( const DenseMatrix<MT,SO>& rhs ) -> DisableIf_t< VectorizedSchurAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto schurAssign( const DenseMatrix<MT,SO>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT> >;
+
+   template< typename MT > inline void schurAssign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT > inline void schurAssign( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT > inline void schurAssign( const SparseMatrix<MT,!SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SmallMatrix( const Alloc& alloc );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   isDynamic() const noexcept;
+   inline void   resetPreallocated() noexcept;
+   inline size_t addPadding( size_t value ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SmallArrayData<Type,NN> array_;  //!< The preallocated storage for up to NN matrix elements.
+   Alloc alloc_;                    //!< The allocator of the matrix elements.
+   size_t m_;                       //!< The current number of rows of the matrix.
+   size_t n_;                       //!< The current number of columns of the matrix.
+   size_t nn_;                      //!< The alignment adjusted number of columns.
+   size_t capacity_;                //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;         //!< The matrix elements.
+                                    /*!< Access to the matrix elements is gained via the function
+                                         call operator. The elements are either stored in the
+                                         preallocated storage or in dynamically allocated memory.
+                                         In case of row-major order the memory layout of the
+                                         elements is
+                                         \f[\left(\begin{array}{*{5}{c}}
+                                         0            & 1             & 2             & \cdots & N-1         \\
+                                         N            & N+1           & N+2           & \cdots & 2 \cdot N-1 \\
+                                         \vdots       & \vdots        & \vdots        & \ddots & \vdots      \\
+                                         M \cdot N-N  & M \cdot N-N+1 & M \cdot N-N+2 & \cdots & M \cdot N-1 \\
+                                         \end{array}\right)\f]. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE         ( Type, typename std::allocator_traits<Alloc>::value_type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SmallMatrix.
+//
+// The default constructed matrix has a size of \f$ 0 \times 0 \f$ and uses the preallocated
+// storage.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix()
+   : SmallMatrix( Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$. No element initialization is performed!
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory in case
+// the size of the matrix exceeds the preallocated storage. No element initialization is
+// performed!
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( size_t m, size_t n )
+   : SmallMatrix( Alloc() )
+{
+   resize( m, n, false );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all \f$ m \times n \f$ matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the matrix elements.
+//
+// All matrix elements are initialized with the specified value. In case the parallel first-touch
+// initialization is enabled (see the BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements of large
+// matrices are initialized in parallel to place them on the NUMA nodes of the according threads.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( size_t m, size_t n, const Type& init )
+   : SmallMatrix( m, n )
+{
+   if( useNUMAFirstTouch && !isParallelSectionActive() ) {
+      smpAssign( *this, UniformMatrix<Type,SO>( m, n, init ) );
+   }
+   else {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            v_[i*nn_+j] = init;
+         }
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Explicitly uninitialized construction of a \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// This constructor allocates a \f$ m \times n \f$ matrix without initializing its elements.
+// It is meant for matrices that are completely overwritten right after construction. In case
+// the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating point elements
+// are set to NaN in order to reveal accidental reads of uninitialized elements.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( size_t m, size_t n, Uninitialized )
+   : SmallMatrix( m, n )
+{
+   for( size_t i=0UL; i<m_; ++i ) {
+      poison( v_+i*nn_, v_+i*nn_+n_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::SmallMatrix<int,4UL,4UL,rowMajor> A{ { 1, 2, 3 },
+                                         { 4, 5 },
+                                         { 7, 8, 9 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// (copy) assigned the values of the given initializer list. Missing values are initialized as
+// default (as e.g. the value 6 in the example).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( initializer_list< initializer_list<Type> > list )
+   : SmallMatrix( list.size(), determineColumns( list ) )
+{
+   size_t i( 0UL );
+
+   for( const auto& rowList : list ) {
+      std::fill( std::copy( rowList.begin(), rowList.end(), begin(i) ), end(i), Type() );
+      ++i;
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array initialization of all matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param array Dynamic array for the initialization.
+//
+// This constructor offers the option to directly initialize the elements of the matrix with
+// a dynamic array:
+
+   \code
+   using blaze::rowMajor;
+
+   int* array = new int[20];
+   // ... Initialization of the dynamic array
+   blaze::SmallMatrix<int,4UL,4UL,rowMajor> v( 4UL, 5UL, array );
+   delete[] array;
+   \endcode
+
+// The matrix is sized according to the given size of the array and initialized with the values
+// from the given array. Note that it is expected that the given \a array has at least \a m by
+// \a n elements. Providing an array with less elements results in undefined behavior!
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the initialization array
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( size_t m, size_t n, const Other* array )
+   : SmallMatrix( m, n )
+{
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         v_[i*nn_+j] = array[i*n+j];
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array initialization of all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the initialization.
+//
+// This constructor offers the option to directly initialize the elements of the matrix with
+// a static array:
+
+   \code
+   using blaze::rowMajor;
+
+   const int init[3][3] = { { 1, 2, 3 },
+                            { 4, 5 },
+                            { 7, 8, 9 } };
+   blaze::SmallMatrix<int,4UL,4UL,rowMajor> A( init );
+   \endcode
+
+// The matrix is sized according to the size of the array and initialized with the values from
+// the given array. Missing values are initialized with default values (as e.g. the value 6 in
+// the example).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( const Other (&array)[Rows][Cols] )
+   : SmallMatrix( Rows, Cols )
+{
+   for( size_t i=0UL; i<Rows; ++i ) {
+      for( size_t j=0UL; j<Cols; ++j ) {
+         v_[i*nn_+j] = array[i][j];
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SmallMatrix.
+//
+// \param m Matrix to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization. The copy only allocates dynamic memory
+// in case the size of the given matrix exceeds the preallocated storage. The allocator of the
+// new matrix is obtained via the \c select_on_container_copy_construction() function of the
+// allocator of the given matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( const SmallMatrix& m )
+   : SmallMatrix( std::allocator_traits<Alloc>::select_on_container_copy_construction( m.alloc_ ) )
+{
+   resize( m.m_, m.n_, false );
+
+   smpAssign( *this, m );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SmallMatrix.
+//
+// \param m The matrix to be moved into this instance.
+//
+// In case the given matrix uses dynamically allocated memory, the memory is moved into this
+// instance along with the allocator. Else the elements of the given matrix are moved into the
+// preallocated storage of this instance. In both cases the given matrix is empty afterwards.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( SmallMatrix&& m ) noexcept( nothrowMovable )
+   : SmallMatrix( m.alloc_ )
+{
+   if( m.isDynamic() ) {
+      capacity_ = m.capacity_;
+      v_        = m.v_;
+   }
+   else {
+      transfer( m.v_, m.v_+m.m_*m.nn_, v_ );
+   }
+
+   m_  = m.m_;
+   n_  = m.n_;
+   nn_ = m.nn_;
+
+   m.resetPreallocated();
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign matrix
+        , bool SO2 >        // Storage order of the foreign matrix
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( const Matrix<MT,SO2>& m )
+   : SmallMatrix( (~m).rows(), (~m).columns() )
+{
+   BLAZE_INSTRUMENT_TEMPORARY;
+
+   if( IsSparseMatrix_v<MT> ) {
+      reset();
+   }
+
+   smpAssign( *this, ~m );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix with the given allocator.
+//
+// \param alloc The allocator for the dynamically allocated matrix elements.
+//
+// This constructor default constructs the preallocated matrix elements. All other constructors
+// delegate to this constructor such that the preallocated elements are properly destroyed in
+// case of an exception.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::SmallMatrix( const Alloc& alloc )
+   : array_   ()                  // The preallocated storage
+   , alloc_   ( alloc )           // The allocator of the matrix elements
+   , m_       ( 0UL )             // The current number of rows of the matrix
+   , n_       ( 0UL )             // The current number of columns of the matrix
+   , nn_      ( 0UL )             // The alignment adjusted number of columns
+   , capacity_( NN )              // The maximum capacity of the matrix
+   , v_       ( array_.array() )  // The matrix elements
+{
+   blaze::uninitialized_default_construct( v_, v_+NN );
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SmallMatrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>::~SmallMatrix()
+{
+   if( isDynamic() ) {
+      deallocate( alloc_, v_, capacity_ );
+   }
+
+   blaze::destroy( array_.array(), array_.array()+NN );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::Reference
+   SmallMatrix<Type,M,N,SO,Alloc>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::ConstReference
+   SmallMatrix<Type,M,N,SO,Alloc>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::Reference
+   SmallMatrix<Type,M,N,SO,Alloc>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::ConstReference
+   SmallMatrix<Type,M,N,SO,Alloc>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the small matrix. Note that you
+// can NOT assume that all matrix elements lie adjacent to each other! The small matrix may
+// use techniques such as padding to improve the alignment of the data. Whereas the number of
+// elements within a row/column are given by the \c rows() and \c columns() member functions,
+// respectively, the total number of elements including padding is given by the \c spacing()
+// member function.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::Pointer
+   SmallMatrix<Type,M,N,SO,Alloc>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the small matrix. Note that you
+// can NOT assume that all matrix elements lie adjacent to each other! The small matrix may
+// use techniques such as padding to improve the alignment of the data. Whereas the number of
+// elements within a row/column are given by the \c rows() and \c columns() member functions,
+// respectively, the total number of elements including padding is given by the \c spacing()
+// member function.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::ConstPointer
+   SmallMatrix<Type,M,N,SO,Alloc>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage for the elements in row/column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::Pointer
+   SmallMatrix<Type,M,N,SO,Alloc>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return v_ + i*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage for the elements in row/column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::ConstPointer
+   SmallMatrix<Type,M,N,SO,Alloc>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return v_ + i*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::Iterator
+   SmallMatrix<Type,M,N,SO,Alloc>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return Iterator( v_ + i*nn_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::ConstIterator
+   SmallMatrix<Type,M,N,SO,Alloc>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( v_ + i*nn_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::ConstIterator
+   SmallMatrix<Type,M,N,SO,Alloc>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( v_ + i*nn_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::Iterator
+   SmallMatrix<Type,M,N,SO,Alloc>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return Iterator( v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::ConstIterator
+   SmallMatrix<Type,M,N,SO,Alloc>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,SO,Alloc>::ConstIterator
+   SmallMatrix<Type,M,N,SO,Alloc>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all matrix elements.
+//
+// \param rhs Scalar value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::operator=( const Type& rhs )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         v_[i*nn_+j] = rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::SmallMatrix<int,4UL,4UL,rowMajor> A;
+   A = { { 1, 2, 3 },
+         { 4, 5 },
+         { 7, 8, 9 } };
+   \endcode
+
+// The matrix is resized according to the given initializer list and all its elements are
+// (copy) assigned the values from the given initializer list. Missing values are initialized
+// as default (as e.g. the value 6 in the example).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>&
+   SmallMatrix<Type,M,N,SO,Alloc>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   resize( list.size(), determineColumns( list ), false, uninitialized );
+
+   size_t i( 0UL );
+
+   for( const auto& rowList : list ) {
+      std::fill( std::copy( rowList.begin(), rowList.end(), v_+i*nn_ ), v_+(i+1UL)*nn_, Type() );
+      ++i;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array assignment to all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the assignment.
+// \return Reference to the assigned matrix.
+//
+// This assignment operator offers the option to directly set all elements of the matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   const int init[3][3] = { { 1, 2, 3 },
+                            { 4, 5 },
+                            { 7, 8, 9 } };
+   blaze::SmallMatrix<int,4UL,4UL,rowMajor> A;
+   A = init;
+   \endcode
+
+// The matrix is resized according to the size of the array and assigned the values of the given
+// array. Missing values are initialized with default values (as e.g. the value 6 in the example).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::operator=( const Other (&array)[Rows][Cols] )
+{
+   resize( Rows, Cols, false, uninitialized );
+
+   for( size_t i=0UL; i<Rows; ++i )
+      for( size_t j=0UL; j<Cols; ++j )
+         v_[i*nn_+j] = array[i][j];
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SmallMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::operator=( const SmallMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.m_, rhs.n_, false, uninitialized );
+   smpAssign( *this, ~rhs );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SmallMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+//
+// In case the given matrix uses dynamically allocated memory, the memory is moved into this
+// instance along with the allocator. Else the elements of the given matrix are moved into the
+// preallocated storage of this instance. In both cases the given matrix is empty afterwards.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>&
+   SmallMatrix<Type,M,N,SO,Alloc>::operator=( SmallMatrix&& rhs ) noexcept( nothrowMovable )
+{
+   if( isDynamic() ) {
+      deallocate( alloc_, v_, capacity_ );
+      resetPreallocated();
+   }
+
+   if( rhs.isDynamic() ) {
+      alloc_    = std::move( rhs.alloc_ );
+      capacity_ = rhs.capacity_;
+      v_        = rhs.v_;
+   }
+   else {
+      transfer( rhs.v_, rhs.v_+rhs.m_*rhs.nn_, v_ );
+   }
+
+   m_  = rhs.m_;
+   n_  = rhs.n_;
+   nn_ = rhs.nn_;
+
+   rhs.resetPreallocated();
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   using TT = decltype( trans( *this ) );
+   using CT = decltype( ctrans( *this ) );
+   using IT = decltype( inv( *this ) );
+
+   if( IsSame_v<MT,TT> && (~rhs).isAliased( this ) ) {
+      transpose();
+   }
+   else if( IsSame_v<MT,CT> && (~rhs).isAliased( this ) ) {
+      ctranspose();
+   }
+   else if( !IsSame_v<MT,IT> && (~rhs).canAlias( this ) ) {
+      SmallMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false, uninitialized );
+      if( IsSparseMatrix_v<MT> )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::operator%=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      smpSchurAssign( *this, tmp );
+   }
+   else {
+      smpSchurAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,SO,Alloc>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,SO,Alloc>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// This function returns the spacing between the beginning of two rows/columns, i.e. the
+// total number of elements of a row/column. In case the storage order is set to \a rowMajor
+// the function returns the spacing between two rows, in case the storage flag is set to
+// \a columnMajor the function returns the spacing between two columns.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,SO,Alloc>::spacing() const noexcept
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,SO,Alloc>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,SO,Alloc>::capacity( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the dense matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,SO,Alloc>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         if( !isDefault( v_[i*nn_+j] ) )
+            ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,SO,Alloc>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t jend( i*nn_ + n_ );
+   size_t nonzeros( 0UL );
+
+   for( size_t j=i*nn_; j<jend; ++j )
+      if( !isDefault( v_[j] ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::reset()
+{
+   using blaze::clear;
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         clear( v_[i*nn_+j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   for( size_t j=0UL; j<n_; ++j )
+      clear( v_[i*nn_+j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::clear()
+{
+   resize( 0UL, 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. However, new matrix elements are not initialized!
+//
+// The following example illustrates the resize operation of a \f$ 2 \times 4 \f$ matrix to a
+// \f$ 4 \times 2 \f$ matrix. The new, uninitialized elements are marked with \a x:
+
+                              \f[
+                              \left(\begin{array}{*{4}{c}}
+                              1 & 2 & 3 & 4 \\
+                              5 & 6 & 7 & 8 \\
+                              \end{array}\right)
+
+                              \Longrightarrow
+
+                              \left(\begin{array}{*{2}{c}}
+                              1 & 2 \\
+                              5 & 6 \\
+                              x & x \\
+                              x & x \\
+                              \end{array}\right)
+                              \f]
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void SmallMatrix<Type,M,N,SO,Alloc>::resize( size_t m, size_t n, bool preserve )
+{
+   using blaze::min;
+
+   if( m == m_ && n == n_ ) return;
+
+   const size_t nn( addPadding( n ) );
+
+   if( preserve )
+   {
+      SmallMatrix tmp( alloc_ );
+      tmp.resize( m, n, false );
+
+      const size_t min_m( min( m, m_ ) );
+      const size_t min_n( min( n, n_ ) );
+
+      for( size_t i=0UL; i<min_m; ++i ) {
+         transfer( v_+i*nn_, v_+i*nn_+min_n, tmp.v_+i*nn );
+      }
+
+      swap( tmp );
+      return;
+   }
+   else if( m*nn > capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate( alloc_, m*nn );
+      if( isDynamic() ) {
+         deallocate( alloc_, v_, capacity_ );
+      }
+      v_ = v;
+      capacity_ = m*nn;
+   }
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=n; j<nn; ++j )
+            v_[i*nn+j] = Type();
+   }
+
+   m_  = m;
+   n_  = n;
+   nn_ = nn;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix without initializing new elements.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix to \f$ m \times n \f$ exactly like the default resize()
+// function, but explicitly states that the new matrix elements are not initialized. In case
+// the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all new floating point
+// elements are set to NaN.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::resize( size_t m, size_t n, bool preserve, Uninitialized )
+{
+   using blaze::min;
+
+   if( m == m_ && n == n_ ) return;
+
+   const size_t oldM( m_ );
+   const size_t oldN( n_ );
+
+   resize( m, n, preserve );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t jbegin( ( preserve && i < oldM )?( min( n_, oldN ) ):( 0UL ) );
+      poison( v_+i*nn_+jbegin, v_+i*nn_+n_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the matrix.
+//
+// \param m Number of additional rows.
+// \param n Number of additional columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function increases the matrix size by \a m rows and \a n columns. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. Therefore
+// this function potentially changes all matrix elements. In order to preserve the old matrix
+// values, the \a preserve flag can be set to \a true. However, new matrix elements are not
+// initialized!
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::extend( size_t m, size_t n, bool preserve )
+{
+   resize( m_+m, n_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the dense matrix.
+// \return void
+//
+// This function increases the capacity of the dense matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::reserve( size_t elements )
+{
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, elements );
+
+      // Initializing the new array
+      transfer( v_, v_+m_*nn_, tmp );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=m_*nn_; i<elements; ++i )
+            tmp[i] = Type();
+      }
+
+      // Replacing the old array
+      if( isDynamic() ) {
+         deallocate( alloc_, v_, capacity_ );
+      }
+
+      v_        = tmp;
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. In case the
+// elements fit into the preallocated storage, the dynamic memory is released and the elements
+// are moved back into the preallocated storage. Please note that due to padding the capacity
+// might not be reduced exactly to rows() times columns(). Please also note that in case a
+// reallocation occurs, all iterators (including end() iterators), all pointers and references
+// to elements of this matrix are invalidated.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::shrinkToFit()
+{
+   if( !isDynamic() ) return;
+
+   if( m_*nn_ <= NN )
+   {
+      Type* BLAZE_RESTRICT tmp = array_.array();
+
+      transfer( v_, v_+m_*nn_, tmp );
+
+      deallocate( alloc_, v_, capacity_ );
+
+      v_        = tmp;
+      capacity_ = NN;
+   }
+   else if( m_*nn_ < capacity_ )
+   {
+      SmallMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+//
+// The allocators of the two matrices are swapped along with the matrix elements. In case both
+// matrices use dynamic memory, the swap operation is a constant time operation. Otherwise the
+// elements stored in the preallocated storage are moved between the two matrices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::swap( SmallMatrix& m ) noexcept( nothrowMovable )
+{
+   using std::swap;
+
+   if( isDynamic() && m.isDynamic() )
+   {
+      swap( m_ , m.m_ );
+      swap( n_ , m.n_ );
+      swap( nn_, m.nn_ );
+      swap( capacity_, m.capacity_ );
+      swap( v_, m.v_ );
+   }
+   else if( !isDynamic() && !m.isDynamic() )
+   {
+      std::swap_ranges( v_, v_+std::max( m_*nn_, m.m_*m.nn_ ), m.v_ );
+      swap( m_ , m.m_ );
+      swap( n_ , m.n_ );
+      swap( nn_, m.nn_ );
+   }
+   else
+   {
+      SmallMatrix& dyn( isDynamic() ? *this : m );
+      SmallMatrix& pre( isDynamic() ? m : *this );
+
+      Type* const  dynV       ( dyn.v_ );
+      const size_t dynM       ( dyn.m_ );
+      const size_t dynN       ( dyn.n_ );
+      const size_t dynNN      ( dyn.nn_ );
+      const size_t dynCapacity( dyn.capacity_ );
+
+      dyn.v_        = dyn.array_.array();
+      dyn.capacity_ = NN;
+
+      transfer( pre.v_, pre.v_+pre.m_*pre.nn_, dyn.v_ );
+
+      dyn.m_  = pre.m_;
+      dyn.n_  = pre.n_;
+      dyn.nn_ = pre.nn_;
+
+      pre.v_        = dynV;
+      pre.m_        = dynM;
+      pre.n_        = dynN;
+      pre.nn_       = dynNN;
+      pre.capacity_ = dynCapacity;
+   }
+
+   swap( alloc_, m.alloc_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix elements are stored in dynamically allocated memory.
+//
+// \return \a true in case the elements are stored in dynamic memory, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool SmallMatrix<Type,M,N,SO,Alloc>::isDynamic() const noexcept
+{
+   return v_ != array_.array();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the matrix to an empty matrix using the preallocated storage.
+//
+// \return void
+//
+// This function switches the matrix back to the preallocated storage without releasing any
+// dynamic memory. It is used after the ownership of the dynamic memory has been transferred
+// to another matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::resetPreallocated() noexcept
+{
+   v_        = array_.array();
+   m_        = 0UL;
+   n_        = 0UL;
+   nn_       = 0UL;
+   capacity_ = NN;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Add the necessary amount of padding to the given value.
+//
+// \param value The value to be padded.
+// \return The padded value.
+//
+// This function increments the given \a value by the necessary amount of padding based on the
+// vector's data type \a Type.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,SO,Alloc>::addPadding( size_t value ) const noexcept
+{
+   if( usePadding && IsVectorizable_v<Type> )
+      return nextMultiple<size_t>( value, SIMDSIZE );
+   else return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::transpose()
+{
+   using std::swap;
+
+   if( m_ == n_ )
+   {
+      smpTranspose( *this );
+   }
+   else if( nn_ == n_ && addPadding( m_ ) == m_ )
+   {
+      transposeCycleKernel<false>( v_, m_, n_ );
+      swap( m_, n_ );
+      nn_ = n_;
+   }
+   else
+   {
+      SmallMatrix tmp( trans(*this) );
+      this->swap( tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::ctranspose()
+{
+   using std::swap;
+
+   if( m_ == n_ )
+   {
+      smpCTranspose( *this );
+   }
+   else if( nn_ == n_ && addPadding( m_ ) == m_ )
+   {
+      transposeCycleKernel<true>( v_, m_, n_ );
+      swap( m_, n_ );
+      nn_ = n_;
+   }
+   else
+   {
+      SmallMatrix tmp( ctrans(*this) );
+      this->swap( tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+//
+// This function scales the matrix by applying the given scalar value \a scalar to each element
+// of the matrix. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator:
+
+   \code
+   blaze::SmallMatrix<int,4UL,4UL> A;
+   // ... Resizing and initialization
+   A *= 4;        // Scaling of the matrix
+   A.scale( 4 );  // Same effect as above
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the scalar value
+inline SmallMatrix<Type,M,N,SO,Alloc>& SmallMatrix<Type,M,N,SO,Alloc>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         v_[i*nn_+j] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of operator new.
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallMatrix class template.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void* SmallMatrix<Type,M,N,SO,Alloc>::operator new( std::size_t size )
+{
+   MAYBE_UNUSED( size );
+
+   BLAZE_INTERNAL_ASSERT( size == sizeof( SmallMatrix ), "Invalid number of bytes detected" );
+
+   return allocate_backend( sizeof( SmallMatrix ), alignof( SmallMatrix ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of operator new[].
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallMatrix class template.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void* SmallMatrix<Type,M,N,SO,Alloc>::operator new[]( std::size_t size )
+{
+   BLAZE_INTERNAL_ASSERT( size >= sizeof( SmallMatrix )       , "Invalid number of bytes detected" );
+   BLAZE_INTERNAL_ASSERT( size %  sizeof( SmallMatrix ) == 0UL, "Invalid number of bytes detected" );
+
+   return allocate_backend( size, alignof( SmallMatrix ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of the no-throw operator new.
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory (\c nullptr in case the allocation failed).
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallMatrix class template.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void* SmallMatrix<Type,M,N,SO,Alloc>::operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+   MAYBE_UNUSED( size );
+
+   BLAZE_INTERNAL_ASSERT( size == sizeof( SmallMatrix ), "Invalid number of bytes detected" );
+
+   try {
+      return allocate_backend( sizeof( SmallMatrix ), alignof( SmallMatrix ) );
+   }
+   catch( ... ) {
+      return nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of the no-throw operator new[].
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory (\c nullptr in case the allocation failed).
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallMatrix class template.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void* SmallMatrix<Type,M,N,SO,Alloc>::operator new[]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( size >= sizeof( SmallMatrix )       , "Invalid number of bytes detected" );
+   BLAZE_INTERNAL_ASSERT( size %  sizeof( SmallMatrix ) == 0UL, "Invalid number of bytes detected" );
+
+   try {
+      return allocate_backend( size, alignof( SmallMatrix ) );
+   }
+   catch( ... ) {
+      return nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of operator delete.
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::operator delete( void* ptr ) noexcept
+{
+   deallocate_backend( ptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of operator delete[].
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::operator delete[]( void* ptr ) noexcept
+{
+   deallocate_backend( ptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of no-throw operator delete.
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::operator delete( void* ptr, const std::nothrow_t& ) noexcept
+{
+   deallocate_backend( ptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of no-throw operator delete[].
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,SO,Alloc>::operator delete[]( void* ptr, const std::nothrow_t& ) noexcept
+{
+   deallocate_backend( ptr );
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the small matrix are intact.
+//
+// \return \a true in case the small matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the small matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool SmallMatrix<Type,M,N,SO,Alloc>::isIntact() const noexcept
+{
+   if( m_ * n_ > capacity_ )
+      return false;
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            if( v_[i*nn_+j] != Type() )
+               return false;
+         }
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the foreign expression
+inline bool SmallMatrix<Type,M,N,SO,Alloc>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the foreign expression
+inline bool SmallMatrix<Type,M,N,SO,Alloc>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// This function returns whether the matrix is guaranteed to be properly aligned in memory, i.e.
+// whether the beginning and the end of each row/column of the matrix are guaranteed to conform
+// to the alignment restrictions of the element type \a Type.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool SmallMatrix<Type,M,N,SO,Alloc>::isAligned() const noexcept
+{
+   return ( usePadding || columns() % SIMDSIZE == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool SmallMatrix<Type,M,N,SO,Alloc>::canSMPAssign() const noexcept
+{
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the dense matrix. The row index
+// must be smaller than the number of rows and the column index must be smaller then the number
+// of columns. Additionally, the column index (in case of a row-major matrix) or the row index
+// (in case of a column-major matrix) must be a multiple of the number of values inside the
+// SIMD element. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallMatrix<Type,M,N,SO,Alloc>::SIMDType
+   SmallMatrix<Type,M,N,SO,Alloc>::load( size_t i, size_t j ) const noexcept
+{
+   if( usePadding )
+      return loada( i, j );
+   else
+      return loadu( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned load of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the SIMD element. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallMatrix<Type,M,N,SO,Alloc>::SIMDType
+   SmallMatrix<Type,M,N,SO,Alloc>::loada( size_t i, size_t j ) const noexcept
+{
+   using blaze::loada;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= nn_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( !usePadding || j % SIMDSIZE == 0UL, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i*nn_+j ), "Invalid alignment detected" );
+
+   return loada( v_+i*nn_+j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the SIMD element. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallMatrix<Type,M,N,SO,Alloc>::SIMDType
+   SmallMatrix<Type,M,N,SO,Alloc>::loadu( size_t i, size_t j ) const noexcept
+{
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= nn_, "Invalid column access index" );
+
+   return loadu( v_+i*nn_+j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Store of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the dense matrix. The row index
+// must be smaller than the number of rows and the column index must be smaller than the number
+// of columns. Additionally, the column index (in case of a row-major matrix) or the row index
+// (in case of a column-major matrix) must be a multiple of the number of values inside the
+// SIMD element. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallMatrix<Type,M,N,SO,Alloc>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   if( usePadding )
+      storea( i, j, value );
+   else
+      storeu( i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned store of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the SIMD element. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallMatrix<Type,M,N,SO,Alloc>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   using blaze::storea;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= nn_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( !usePadding || j % SIMDSIZE == 0UL, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i*nn_+j ), "Invalid alignment detected" );
+
+   storea( v_+i*nn_+j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the SIMD element. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallMatrix<Type,M,N,SO,Alloc>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   using blaze::storeu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= nn_, "Invalid column access index" );
+
+   storeu( v_+i*nn_+j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific SIMD element of the
+// dense matrix. The row index must be smaller than the number of rows and the column index
+// must be smaller than the number of columns. Additionally, the column index (in case of a
+// row-major matrix) or the row index (in case of a column-major matrix) must be a multiple
+// of the number of values inside the SIMD element. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallMatrix<Type,M,N,SO,Alloc>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   using blaze::stream;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= nn_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( !usePadding || j % SIMDSIZE == 0UL, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i*nn_+j ), "Invalid alignment detected" );
+
+   stream( v_+i*nn_+j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,SO,Alloc>::assign( const DenseMatrix<MT,SO>& rhs )
+   -> DisableIf_t< VectorizedAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jpos( n_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % 2UL ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<jpos; j+=2UL ) {
+         v_[i*nn_+j    ] = (~rhs)(i,j    );
+         v_[i*nn_+j+1UL] = (~rhs)(i,j+1UL);
+      }
+      if( jpos < n_ ) {
+         v_[i*nn_+jpos] = (~rhs)(i,jpos);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,SO,Alloc>::assign( const DenseMatrix<MT,SO>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( n_ & size_t(-SIMDSIZE) ):( n_ ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( n_ - ( n_ % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   if( usePadding && useStreaming &&
+       ( m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
+   {
+      for( size_t i=0UL; i<m_; ++i )
+      {
+         size_t j( 0UL );
+         Iterator left( begin(i) );
+         ConstIterator_t<MT> right( (~rhs).begin(i) );
+
+         for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE, right+=SIMDSIZE ) {
+            left.stream( right.load() );
+         }
+         for( ; remainder && j<n_; ++j, ++left, ++right ) {
+            *left = *right;
+         }
+      }
+   }
+   else
+   {
+      for( size_t i=0UL; i<m_; ++i )
+      {
+         size_t j( 0UL );
+         Iterator left( begin(i) );
+         ConstIterator_t<MT> right( (~rhs).begin(i) );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            left.store( right.load() ); left+=SIMDSIZE, right+=SIMDSIZE;
+         }
+         for( ; remainder && j<n_; ++j ) {
+            *left = *right; ++left; ++right;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::assign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t ii=0UL; ii<m_; ii+=block ) {
+      const size_t iend( min( m_, ii+block ) );
+      for( size_t jj=0UL; jj<n_; jj+=block ) {
+         const size_t jend( min( n_, jj+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               v_[i*nn_+j] = (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i*nn_+element->index()] = element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()*nn_+j] = element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,SO,Alloc>::addAssign( const DenseMatrix<MT,SO>& rhs )
+   -> DisableIf_t< VectorizedAddAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      if( IsDiagonal_v<MT> )
+      {
+         v_[i*nn_+i] += (~rhs)(i,i);
+      }
+      else
+      {
+         const size_t jbegin( ( IsUpper_v<MT> )
+                              ?( IsStrictlyUpper_v<MT> ? i+1UL : i )
+                              :( 0UL ) );
+         const size_t jend  ( ( IsLower_v<MT> )
+                              ?( IsStrictlyLower_v<MT> ? i : i+1UL )
+                              :( n_ ) );
+         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+
+         size_t j( jbegin );
+
+         for( ; (j+2UL) <= jend; j+=2UL ) {
+            v_[i*nn_+j    ] += (~rhs)(i,j    );
+            v_[i*nn_+j+1UL] += (~rhs)(i,j+1UL);
+         }
+         if( j < jend ) {
+            v_[i*nn_+j] += (~rhs)(i,j);
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,SO,Alloc>::addAssign( const DenseMatrix<MT,SO>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t jbegin( ( IsUpper_v<MT> )
+                           ?( ( IsStrictlyUpper_v<MT> ? i+1UL : i ) & size_t(-SIMDSIZE) )
+                           :( 0UL ) );
+      const size_t jend  ( ( IsLower_v<MT> )
+                           ?( IsStrictlyLower_v<MT> ? i : i+1UL )
+                           :( n_ ) );
+      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+
+      const size_t jpos( ( remainder )?( jend & size_t(-SIMDSIZE) ):( jend ) );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+      size_t j( jbegin );
+      Iterator left( begin(i) + jbegin );
+      ConstIterator_t<MT> right( (~rhs).begin(i) + jbegin );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && j<jend; ++j ) {
+         *left += *right; ++left; ++right;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t ii=0UL; ii<m_; ii+=block ) {
+      const size_t iend( min( m_, ii+block ) );
+      for( size_t jj=0UL; jj<n_; jj+=block )
+      {
+         if( IsLower_v<MT> && ii < jj ) break;
+         if( IsUpper_v<MT> && ii > jj ) continue;
+
+         for( size_t i=ii; i<iend; ++i )
+         {
+            const size_t jbegin( ( IsUpper_v<MT> )
+                                 ?( max( ( IsStrictlyUpper_v<MT> ? i+1UL : i ), jj ) )
+                                 :( jj ) );
+            const size_t jend  ( ( IsLower_v<MT> )
+                                 ?( min( ( IsStrictlyLower_v<MT> ? i : i+1UL ), n_, jj+block ) )
+                                 :( min( n_, jj+block ) ) );
+            BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+
+            for( size_t j=jbegin; j<jend; ++j ) {
+               v_[i*nn_+j] += (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::addAssign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i*nn_+element->index()] += element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::addAssign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()*nn_+j] += element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,SO,Alloc>::subAssign( const DenseMatrix<MT,SO>& rhs )
+   -> DisableIf_t< VectorizedSubAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      if( IsDiagonal_v<MT> )
+      {
+         v_[i*nn_+i] -= (~rhs)(i,i);
+      }
+      else
+      {
+         const size_t jbegin( ( IsUpper_v<MT> )
+                              ?( IsStrictlyUpper_v<MT> ? i+1UL : i )
+                              :( 0UL ) );
+         const size_t jend  ( ( IsLower_v<MT> )
+                              ?( IsStrictlyLower_v<MT> ? i : i+1UL )
+                              :( n_ ) );
+         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+
+         size_t j( jbegin );
+
+         for( ; (j+2UL) <= jend; j+=2UL ) {
+            v_[i*nn_+j    ] -= (~rhs)(i,j    );
+            v_[i*nn_+j+1UL] -= (~rhs)(i,j+1UL);
+         }
+         if( j < jend ) {
+            v_[i*nn_+j] -= (~rhs)(i,j);
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,SO,Alloc>::subAssign( const DenseMatrix<MT,SO>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t jbegin( ( IsUpper_v<MT> )
+                           ?( ( IsStrictlyUpper_v<MT> ? i+1UL : i ) & size_t(-SIMDSIZE) )
+                           :( 0UL ) );
+      const size_t jend  ( ( IsLower_v<MT> )
+                           ?( IsStrictlyLower_v<MT> ? i : i+1UL )
+                           :( n_ ) );
+      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+
+      const size_t jpos( ( remainder )?( jend & size_t(-SIMDSIZE) ):( jend ) );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+      size_t j( jbegin );
+      Iterator left( begin(i) + jbegin );
+      ConstIterator_t<MT> right( (~rhs).begin(i) + jbegin );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && j<jend; ++j ) {
+         *left -= *right; ++left; ++right;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t ii=0UL; ii<m_; ii+=block ) {
+      const size_t iend( min( m_, ii+block ) );
+      for( size_t jj=0UL; jj<n_; jj+=block )
+      {
+         if( IsLower_v<MT> && ii < jj ) break;
+         if( IsUpper_v<MT> && ii > jj ) continue;
+
+         for( size_t i=ii; i<iend; ++i )
+         {
+            const size_t jbegin( ( IsUpper_v<MT> )
+                                 ?( max( ( IsStrictlyUpper_v<MT> ? i+1UL : i ), jj ) )
+                                 :( jj ) );
+            const size_t jend  ( ( IsLower_v<MT> )
+                                 ?( min( ( IsStrictlyLower_v<MT> ? i : i+1UL ), n_, jj+block ) )
+                                 :( min( n_, jj+block ) ) );
+            BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+
+            for( size_t j=jbegin; j<jend; ++j ) {
+               v_[i*nn_+j] -= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::subAssign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i*nn_+element->index()] -= element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::subAssign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()*nn_+j] -= element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,SO,Alloc>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+   -> DisableIf_t< VectorizedSchurAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jpos( n_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % 2UL ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<jpos; j+=2UL ) {
+         v_[i*nn_+j    ] *= (~rhs)(i,j    );
+         v_[i*nn_+j+1UL] *= (~rhs)(i,j+1UL);
+      }
+      if( jpos < n_ ) {
+         v_[i*nn_+jpos] *= (~rhs)(i,jpos);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the Schur product assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,SO,Alloc>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t jpos( ( remainder )?( n_ & size_t(-SIMDSIZE) ):( n_ ) );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( n_ - ( n_ % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+      size_t j( 0UL );
+      Iterator left( begin(i) );
+      ConstIterator_t<MT> right( (~rhs).begin(i) );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && j<n_; ++j ) {
+         *left *= *right; ++left; ++right;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::schurAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t ii=0UL; ii<m_; ii+=block ) {
+      const size_t iend( min( m_, ii+block ) );
+      for( size_t jj=0UL; jj<n_; jj+=block ) {
+         const size_t jend( min( n_, jj+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               v_[i*nn_+j] *= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::schurAssign( const SparseMatrix<MT,SO>& rhs )
+{
+   using blaze::reset;
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      size_t j( 0UL );
+
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         for( ; j<element->index(); ++j )
+            reset( v_[i*nn_+j] );
+         v_[i*nn_+j] *= element->value();
+         ++j;
+      }
+
+      for( ; j<n_; ++j ) {
+         reset( v_[i*nn_+j] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,SO,Alloc>::schurAssign( const SparseMatrix<MT,!SO>& rhs )
+{
+   using blaze::reset;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      size_t i( 0UL );
+
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+         for( ; i<element->index(); ++i )
+            reset( v_[i*nn_+j] );
+         v_[i*nn_+j] *= element->value();
+         ++i;
+      }
+
+      for( ; i<m_; ++i ) {
+         reset( v_[i*nn_+j] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR COLUMN-MAJOR MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of SmallMatrix for column-major matrices.
+// \ingroup small_matrix
+//
+// This specialization of SmallMatrix adapts the class template to the requirements of
+// column-major matrices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+class SmallMatrix<Type,M,N,true,Alloc>
+   : public DenseMatrix< SmallMatrix<Type,M,N,true,Alloc>, true >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = SmallMatrix<Type,M,N,true,Alloc>;   //!< Type of this SmallMatrix instance.
+   using BaseType      = DenseMatrix<This,true>;             //!< Base type of this SmallMatrix instance.
+   using ResultType    = This;                               //!< Result type for expression template evaluations.
+   using OppositeType  = SmallMatrix<Type,M,N,false,Alloc>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = SmallMatrix<Type,N,M,false,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                               //!< Type of the matrix elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;           //!< SIMD type of the matrix elements.
+   using ReturnType    = const Type&;                        //!< Return type for expression template evaluations.
+   using CompositeType = const This&;                        //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                              //!< Type of the allocator of the matrix elements.
+
+   using Reference      = Type&;        //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+   using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+   using Iterator      = DenseIterator<Type,usePadding>;        //!< Iterator over non-constant elements.
+   using ConstIterator = DenseIterator<const Type,usePadding>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SmallMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using NewAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NewType>;  //!< Type of the rebound allocator.
+      using Other    = SmallMatrix<NewType,M,N,true,NewAlloc>;                                 //!< The type of the other SmallMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SmallMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = SmallMatrix<Type,M,N,true,Alloc>;  //!< The type of the other SmallMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. In case the element type of the matrix is a
+       vectorizable data type, the \a simdEnabled compilation flag is set to \a true, otherwise
+       it is set to \a false. */
+   static constexpr bool simdEnabled = IsVectorizable_v<Type>;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SmallMatrix();
+   explicit inline SmallMatrix( size_t m, size_t n );
+   explicit inline SmallMatrix( size_t m, size_t n, const Type& init );
+   explicit inline SmallMatrix( size_t m, size_t n, Uninitialized );
+            inline SmallMatrix( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other > explicit inline SmallMatrix( size_t m, size_t n, const Other* array );
+
+   template< typename Other, size_t Rows, size_t Cols >
+   explicit inline SmallMatrix( const Other (&array)[Rows][Cols] );
+
+                                    inline SmallMatrix( const SmallMatrix& m );
+                                    inline SmallMatrix( SmallMatrix&& m ) noexcept( nothrowMovable );
+   template< typename MT, bool SO > inline SmallMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SmallMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t j ) noexcept;
+   inline ConstPointer   data  ( size_t j ) const noexcept;
+   inline Iterator       begin ( size_t j ) noexcept;
+   inline ConstIterator  begin ( size_t j ) const noexcept;
+   inline ConstIterator  cbegin( size_t j ) const noexcept;
+   inline Iterator       end   ( size_t j ) noexcept;
+   inline ConstIterator  end   ( size_t j ) const noexcept;
+   inline ConstIterator  cend  ( size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SmallMatrix& operator=( const Type& rhs );
+   inline SmallMatrix& operator=( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other, size_t Rows, size_t Cols >
+   inline SmallMatrix& operator=( const Other (&array)[Rows][Cols] );
+
+   inline SmallMatrix& operator=( const SmallMatrix& rhs );
+   inline SmallMatrix& operator=( SmallMatrix&& rhs ) noexcept( nothrowMovable );
+
+   template< typename MT, bool SO > inline SmallMatrix& operator= ( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SmallMatrix& operator+=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SmallMatrix& operator-=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SmallMatrix& operator%=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t j ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t j ) const;
+   inline void   reset();
+   inline void   reset( size_t j );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   resize ( size_t m, size_t n, bool preserve, Uninitialized );
+   inline void   extend ( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t elements );
+   inline void   shrinkToFit();
+   inline void   swap( SmallMatrix& m ) noexcept( nothrowMovable );
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline SmallMatrix& transpose();
+   inline SmallMatrix& ctranspose();
+
+   template< typename Other > inline SmallMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Memory functions****************************************************************************
+   /*!\name Memory functions */
+   //@{
+   static inline void* operator new  ( std::size_t size );
+   static inline void* operator new[]( std::size_t size );
+   static inline void* operator new  ( std::size_t size, const std::nothrow_t& ) noexcept;
+   static inline void* operator new[]( std::size_t size, const std::nothrow_t& ) noexcept;
+
+   static inline void operator delete  ( void* ptr ) noexcept;
+   static inline void operator delete[]( void* ptr ) noexcept;
+   static inline void operator delete  ( void* ptr, const std::nothrow_t& ) noexcept;
+   static inline void operator delete[]( void* ptr, const std::nothrow_t& ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<MT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedAddAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<MT> > &&
+        HasSIMDAdd_v< Type, ElementType_t<MT> > &&
+        !IsDiagonal_v<MT> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedSubAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<MT> > &&
+        HasSIMDSub_v< Type, ElementType_t<MT> > &&
+        !IsDiagonal_v<MT> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<MT> > &&
+        HasSIMDMult_v< Type, ElementType_t<MT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+
+   //! The number of preallocated elements including padding.
+   static constexpr size_t NN = ( usePadding ? nextMultiple( M, SIMDSIZE ) : M ) * N;
+
+   //! Compilation flag for the exception safety of the move operations and the swap operation.
+   static constexpr bool nothrowMovable = ( IsNothrowDefaultConstructible_v<Type> &&
+                                            IsNothrowMoveConstructible_v<Type> &&
+                                            IsNothrowMoveAssignable_v<Type> );
+   //**********************************************************************************************
+
+ public:
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,true>& rhs ) -> DisableIf_t< VectorizedAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
+
+   template< typename MT > inline void assign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline auto addAssign( const DenseMatrix<MT,true>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto addAssign( const DenseMatrix<MT,true>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT> >;
+
+   template< typename MT > inline void addAssign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT > inline void addAssign( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT > inline void addAssign( const SparseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline auto subAssign ( const DenseMatrix<MT,true>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto subAssign ( const DenseMatrix<MT,true>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT> >;
+
+   template< typename MT > inline void subAssign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT > inline void subAssign( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT > inline void subAssign( const SparseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline auto schurAssign ( const DenseMatrix<MT,true>& rhs ) -> DisableIf_t< VectorizedSchurAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto schurAssign ( const DenseMatrix<MT,true>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT> >;
+
+   template< typename MT > inline void schurAssign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT > inline void schurAssign( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT > inline void schurAssign( const SparseMatrix<MT,false>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SmallMatrix( const Alloc& alloc );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   isDynamic() const noexcept;
+   inline void   resetPreallocated() noexcept;
+   inline size_t addPadding( size_t minRows ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SmallArrayData<Type,NN> array_;  //!< The preallocated storage for up to NN matrix elements.
+   Alloc alloc_;                    //!< The allocator of the matrix elements.
+   size_t m_;                       //!< The current number of rows of the matrix.
+   size_t mm_;                      //!< The alignment adjusted number of rows.
+   size_t n_;                       //!< The current number of columns of the matrix.
+   size_t capacity_;                //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;         //!< The matrix elements.
+                                    /*!< Access to the matrix elements is gained via the function
+                                         call operator. The elements are either stored in the
+                                         preallocated storage or in dynamically allocated memory. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE         ( Type, typename std::allocator_traits<Alloc>::value_type );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for SmallMatrix.
+//
+// The default constructed matrix has a size of \f$ 0 \times 0 \f$ and uses the preallocated
+// storage.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix()
+   : SmallMatrix( Alloc() )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$. No element initialization is performed!
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory in case
+// the size of the matrix exceeds the preallocated storage. No element initialization is
+// performed!
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( size_t m, size_t n )
+   : SmallMatrix( Alloc() )
+{
+   resize( m, n, false );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a homogenous initialization of all \f$ m \times n \f$ matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the matrix elements.
+//
+// All matrix elements are initialized with the specified value. In case the parallel first-touch
+// initialization is enabled (see the BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements of large
+// matrices are initialized in parallel to place them on the NUMA nodes of the according threads.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( size_t m, size_t n, const Type& init )
+   : SmallMatrix( m, n )
+{
+   if( useNUMAFirstTouch && !isParallelSectionActive() ) {
+      smpAssign( *this, UniformMatrix<Type,true>( m, n, init ) );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            v_[i+j*mm_] = init;
+         }
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Explicitly uninitialized construction of a \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// This constructor allocates a \f$ m \times n \f$ matrix without initializing its elements.
+// It is meant for matrices that are completely overwritten right after construction. In case
+// the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating point elements
+// are set to NaN in order to reveal accidental reads of uninitialized elements.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( size_t m, size_t n, Uninitialized )
+   : SmallMatrix( m, n )
+{
+   for( size_t j=0UL; j<n_; ++j ) {
+      poison( v_+j*mm_, v_+j*mm_+m_ );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::columnMajor;
+
+   blaze::SmallMatrix<int,4UL,4UL,columnMajor> A{ { 1, 2, 3 },
+                                            { 4, 5 },
+                                            { 7, 8, 9 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// (copy) assigned the values of the given initializer list. Missing values are initialized as
+// default (as e.g. the value 6 in the example).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( initializer_list< initializer_list<Type> > list )
+   : SmallMatrix( list.size(), determineColumns( list ) )
+{
+   size_t i( 0UL );
+
+   for( const auto& rowList : list ) {
+      size_t j( 0UL );
+      for( const auto& element : rowList ) {
+         v_[i+j*mm_] = element;
+         ++j;
+      }
+      for( ; j<n_; ++j ) {
+         v_[i+j*mm_] = Type();
+      }
+      ++i;
+   }
+
+   BLAZE_INTERNAL_ASSERT( i == m_, "Invalid number of elements detected" );
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Array initialization of all matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param array Dynamic array for the initialization.
+//
+// This constructor offers the option to directly initialize the elements of the matrix with
+// a dynamic array:
+
+   \code
+   using blaze::columnMajor;
+
+   int* array = new int[20];
+   // ... Initialization of the dynamic array
+   blaze::SmallMatrix<int,4UL,4UL,columnMajor> v( array, 5UL, 4UL );
+   delete[] array;
+   \endcode
+
+// The matrix is sized according to the given size of the array and initialized with the values
+// from the given array. Note that it is expected that the given \a array has at least \a m by
+// \a n elements. Providing an array with less elements results in undefined behavior!
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the initialization array
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( size_t m, size_t n, const Other* array )
+   : SmallMatrix( m, n )
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         v_[i+j*mm_] = array[i+j*m];
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Array initialization of all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the initialization.
+//
+// This constructor offers the option to directly initialize the elements of the matrix with
+// a static array:
+
+   \code
+   using blaze::columnMajor;
+
+   const int init[3][3] = { { 1, 2, 3 },
+                            { 4, 5 },
+                            { 7, 8, 9 } };
+   blaze::SmallMatrix<int,4UL,4UL,columnMajor> A( init );
+   \endcode
+
+// The matrix is sized according to the size of the array and initialized with the values from
+// the given array. Missing values are initialized with default values (as e.g. the value 6 in
+// the example).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( const Other (&array)[Rows][Cols] )
+   : SmallMatrix( Rows, Cols )
+{
+   for( size_t j=0UL; j<Cols; ++j ) {
+      for( size_t i=0UL; i<Rows; ++i ) {
+         v_[i+j*mm_] = array[i][j];
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The copy constructor for SmallMatrix.
+//
+// \param m Matrix to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization. The copy only allocates dynamic memory
+// in case the size of the given matrix exceeds the preallocated storage. The allocator of the
+// new matrix is obtained via the \c select_on_container_copy_construction() function of the
+// allocator of the given matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( const SmallMatrix& m )
+   : SmallMatrix( std::allocator_traits<Alloc>::select_on_container_copy_construction( m.alloc_ ) )
+{
+   resize( m.m_, m.n_, false );
+
+   smpAssign( *this, m );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The move constructor for SmallMatrix.
+//
+// \param m The matrix to be moved into this instance.
+//
+// In case the given matrix uses dynamically allocated memory, the memory is moved into this
+// instance along with the allocator. Else the elements of the given matrix are moved into the
+// preallocated storage of this instance. In both cases the given matrix is empty afterwards.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( SmallMatrix&& m ) noexcept( nothrowMovable )
+   : SmallMatrix( m.alloc_ )
+{
+   if( m.isDynamic() ) {
+      capacity_ = m.capacity_;
+      v_        = m.v_;
+   }
+   else {
+      transfer( m.v_, m.v_+m.mm_*m.n_, v_ );
+   }
+
+   m_  = m.m_;
+   mm_ = m.mm_;
+   n_  = m.n_;
+
+   m.resetPreallocated();
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign matrix
+        , bool SO >         // Storage order of the foreign matrix
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( const Matrix<MT,SO>& m )
+   : SmallMatrix( (~m).rows(), (~m).columns() )
+{
+   BLAZE_INSTRUMENT_TEMPORARY;
+
+   if( IsSparseMatrix_v<MT> ) {
+      reset();
+   }
+
+   smpAssign( *this, ~m );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an empty matrix with the given allocator.
+//
+// \param alloc The allocator for the dynamically allocated matrix elements.
+//
+// This constructor default constructs the preallocated matrix elements. All other constructors
+// delegate to this constructor such that the preallocated elements are properly destroyed in
+// case of an exception.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::SmallMatrix( const Alloc& alloc )
+   : array_   ()                  // The preallocated storage
+   , alloc_   ( alloc )           // The allocator of the matrix elements
+   , m_       ( 0UL )             // The current number of rows of the matrix
+   , mm_      ( 0UL )             // The alignment adjusted number of rows
+   , n_       ( 0UL )             // The current number of columns of the matrix
+   , capacity_( NN )              // The maximum capacity of the matrix
+   , v_       ( array_.array() )  // The matrix elements
+{
+   blaze::uninitialized_default_construct( v_, v_+NN );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The destructor for SmallMatrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>::~SmallMatrix()
+{
+   if( isDynamic() ) {
+      deallocate( alloc_, v_, capacity_ );
+   }
+
+   blaze::destroy( array_.array(), array_.array()+NN );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::Reference
+   SmallMatrix<Type,M,N,true,Alloc>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i+j*mm_];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::ConstReference
+   SmallMatrix<Type,M,N,true,Alloc>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i+j*mm_];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::Reference
+   SmallMatrix<Type,M,N,true,Alloc>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::ConstReference
+   SmallMatrix<Type,M,N,true,Alloc>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the small matrix. Note that you
+// can NOT assume that all matrix elements lie adjacent to each other! The small matrix may
+// use techniques such as padding to improve the alignment of the data. Whereas the number of
+// elements within a column are given by the \c columns() member functions, the total number
+// of elements including padding is given by the \c spacing() member function.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::Pointer
+   SmallMatrix<Type,M,N,true,Alloc>::data() noexcept
+{
+   return v_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the small matrix. Note that you
+// can NOT assume that all matrix elements lie adjacent to each other! The small matrix may
+// use techniques such as padding to improve the alignment of the data. Whereas the number of
+// elements within a column are given by the \c columns() member functions, the total number
+// of elements including padding is given by the \c spacing() member function.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::ConstPointer
+   SmallMatrix<Type,M,N,true,Alloc>::data() const noexcept
+{
+   return v_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the matrix elements of column \a j.
+//
+// \param j The column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage for the elements in column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::Pointer
+   SmallMatrix<Type,M,N,true,Alloc>::data( size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   return v_ + j*mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the matrix elements of column \a j.
+//
+// \param j The column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage for the elements in column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::ConstPointer
+   SmallMatrix<Type,M,N,true,Alloc>::data( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   return v_ + j*mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first element of column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::Iterator
+   SmallMatrix<Type,M,N,true,Alloc>::begin( size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   return Iterator( v_ + j*mm_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first element of column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::ConstIterator
+   SmallMatrix<Type,M,N,true,Alloc>::begin( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   return ConstIterator( v_ + j*mm_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first element of column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::ConstIterator
+   SmallMatrix<Type,M,N,true,Alloc>::cbegin( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   return ConstIterator( v_ + j*mm_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last element of column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::Iterator
+   SmallMatrix<Type,M,N,true,Alloc>::end( size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   return Iterator( v_ + j*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last element of column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::ConstIterator
+   SmallMatrix<Type,M,N,true,Alloc>::end( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   return ConstIterator( v_ + j*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last element of column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline typename SmallMatrix<Type,M,N,true,Alloc>::ConstIterator
+   SmallMatrix<Type,M,N,true,Alloc>::cend( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
+   return ConstIterator( v_ + j*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Homogenous assignment to all matrix elements.
+//
+// \param rhs Scalar value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::operator=( const Type& rhs )
+{
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t i=0UL; i<m_; ++i )
+         v_[i+j*mm_] = rhs;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list:
+
+   \code
+   using blaze::columnMajor;
+
+   blaze::SmallMatrix<int,4UL,4UL,columnMajor> A;
+   A = { { 1, 2, 3 },
+         { 4, 5 },
+         { 7, 8, 9 } };
+   \endcode
+
+// The matrix is resized according to the given initializer list and all its elements are
+// (copy) assigned the values from the given initializer list. Missing values are initialized
+// as default (as e.g. the value 6 in the example).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>&
+   SmallMatrix<Type,M,N,true,Alloc>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   resize( list.size(), determineColumns( list ), false, uninitialized );
+
+   size_t i( 0UL );
+
+   for( const auto& rowList : list ) {
+      size_t j( 0UL );
+      for( const auto& element : rowList ) {
+         v_[i+j*mm_] = element;
+         ++j;
+      }
+      for( ; j<n_; ++j ) {
+         v_[i+j*mm_] = Type();
+      }
+      ++i;
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Array assignment to all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the assignment.
+// \return Reference to the assigned matrix.
+//
+// This assignment operator offers the option to directly set all elements of the matrix:
+
+   \code
+   using blaze::columnMajor;
+
+   const int init[3][3] = { { 1, 2, 3 },
+                            { 4, 5 },
+                            { 7, 8, 9 } };
+   blaze::SmallMatrix<int,4UL,4UL,columnMajor> A;
+   A = init;
+   \endcode
+
+// The matrix is resized according to the size of the array and assigned the values of the given
+// array. Missing values are initialized with default values (as e.g. the value 6 in the example).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::operator=( const Other (&array)[Rows][Cols] )
+{
+   resize( Rows, Cols, false, uninitialized );
+
+   for( size_t j=0UL; j<Cols; ++j )
+      for( size_t i=0UL; i<Rows; ++i )
+         v_[i+j*mm_] = array[i][j];
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for SmallMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::operator=( const SmallMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.m_, rhs.n_, false, uninitialized );
+   smpAssign( *this, ~rhs );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Move assignment operator for SmallMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+//
+// In case the given matrix uses dynamically allocated memory, the memory is moved into this
+// instance along with the allocator. Else the elements of the given matrix are moved into the
+// preallocated storage of this instance. In both cases the given matrix is empty afterwards.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>&
+   SmallMatrix<Type,M,N,true,Alloc>::operator=( SmallMatrix&& rhs ) noexcept( nothrowMovable )
+{
+   if( isDynamic() ) {
+      deallocate( alloc_, v_, capacity_ );
+      resetPreallocated();
+   }
+
+   if( rhs.isDynamic() ) {
+      alloc_    = std::move( rhs.alloc_ );
+      capacity_ = rhs.capacity_;
+      v_        = rhs.v_;
+   }
+   else {
+      transfer( rhs.v_, rhs.v_+rhs.mm_*rhs.n_, v_ );
+   }
+
+   m_  = rhs.m_;
+   mm_ = rhs.mm_;
+   n_  = rhs.n_;
+
+   rhs.resetPreallocated();
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::operator=( const Matrix<MT,SO>& rhs )
+{
+   using TT = decltype( trans( *this ) );
+   using CT = decltype( ctrans( *this ) );
+   using IT = decltype( inv( *this ) );
+
+   if( IsSame_v<MT,TT> && (~rhs).isAliased( this ) ) {
+      transpose();
+   }
+   else if( IsSame_v<MT,CT> && (~rhs).isAliased( this ) ) {
+      ctranspose();
+   }
+   else if( !IsSame_v<MT,IT> && (~rhs).canAlias( this ) ) {
+      SmallMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false, uninitialized );
+      if( IsSparseMatrix_v<MT> )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::operator+=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::operator-=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::operator%=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      smpSchurAssign( *this, tmp );
+   }
+   else {
+      smpSchurAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,true,Alloc>::rows() const noexcept
+{
+   return m_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,true,Alloc>::columns() const noexcept
+{
+   return n_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the spacing between the beginning of two columns.
+//
+// \return The spacing between the beginning of two columns.
+//
+// This function returns the spacing between the beginning of two column, i.e. the total number
+// of elements of a column.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,true,Alloc>::spacing() const noexcept
+{
+   return mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,true,Alloc>::capacity() const noexcept
+{
+   return capacity_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current capacity of the specified column.
+//
+// \param j The index of the column.
+// \return The current capacity of column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,true,Alloc>::capacity( size_t j ) const noexcept
+{
+   MAYBE_UNUSED( j );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the dense matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,true,Alloc>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t i=0UL; i<m_; ++i )
+         if( !isDefault( v_[i+j*mm_] ) )
+            ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified column.
+//
+// \param j The index of the column.
+// \return The number of non-zero elements of column \a j.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,true,Alloc>::nonZeros( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t iend( j*mm_ + m_ );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=j*mm_; i<iend; ++i )
+      if( !isDefault( v_[i] ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::reset()
+{
+   using blaze::clear;
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t i=0UL; i<m_; ++i )
+         clear( v_[i+j*mm_] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset the specified column to the default initial values.
+//
+// \param j The index of the column.
+// \return void
+//
+// This function reset the values in the specified column to their default value. Note that
+// the capacity of the column remains unchanged.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::reset( size_t j )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   for( size_t i=0UL; i<m_; ++i )
+      clear( v_[i+j*mm_] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::clear()
+{
+   resize( 0UL, 0UL, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. However, new matrix elements are not initialized!
+//
+// The following example illustrates the resize operation of a \f$ 2 \times 4 \f$ matrix to a
+// \f$ 4 \times 2 \f$ matrix. The new, uninitialized elements are marked with \a x:
+
+                              \f[
+                              \left(\begin{array}{*{4}{c}}
+                              1 & 2 & 3 & 4 \\
+                              5 & 6 & 7 & 8 \\
+                              \end{array}\right)
+
+                              \Longrightarrow
+
+                              \left(\begin{array}{*{2}{c}}
+                              1 & 2 \\
+                              5 & 6 \\
+                              x & x \\
+                              x & x \\
+                              \end{array}\right)
+                              \f]
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+void SmallMatrix<Type,M,N,true,Alloc>::resize( size_t m, size_t n, bool preserve )
+{
+   using blaze::min;
+
+   if( m == m_ && n == n_ ) return;
+
+   const size_t mm( addPadding( m ) );
+
+   if( preserve )
+   {
+      SmallMatrix tmp( alloc_ );
+      tmp.resize( m, n, false );
+
+      const size_t min_m( min( m, m_ ) );
+      const size_t min_n( min( n, n_ ) );
+
+      for( size_t j=0UL; j<min_n; ++j ) {
+         transfer( v_+j*mm_, v_+min_m+j*mm_, tmp.v_+j*mm );
+      }
+
+      swap( tmp );
+      return;
+   }
+   else if( mm*n > capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate( alloc_, mm*n );
+      if( isDynamic() ) {
+         deallocate( alloc_, v_, capacity_ );
+      }
+      v_ = v;
+      capacity_ = mm*n;
+   }
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t j=0UL; j<n; ++j )
+         for( size_t i=m; i<mm; ++i )
+            v_[i+j*mm] = Type();
+   }
+
+   m_  = m;
+   mm_ = mm;
+   n_  = n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changing the size of the matrix without initializing new elements.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix to \f$ m \times n \f$ exactly like the default resize()
+// function, but explicitly states that the new matrix elements are not initialized. In case
+// the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all new floating point
+// elements are set to NaN.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::resize( size_t m, size_t n, bool preserve, Uninitialized )
+{
+   using blaze::min;
+
+   if( m == m_ && n == n_ ) return;
+
+   const size_t oldM( m_ );
+   const size_t oldN( n_ );
+
+   resize( m, n, preserve );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      const size_t ibegin( ( preserve && j < oldN )?( min( m_, oldM ) ):( 0UL ) );
+      poison( v_+j*mm_+ibegin, v_+j*mm_+m_ );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extending the size of the matrix.
+//
+// \param m Number of additional rows.
+// \param n Number of additional columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function increases the matrix size by \a m rows and \a n columns. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. Therefore
+// this function potentially changes all matrix elements. In order to preserve the old matrix
+// values, the \a preserve flag can be set to \a true. However, new matrix elements are not
+// initialized!
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::extend( size_t m, size_t n, bool preserve )
+{
+   resize( m_+m, n_+n, preserve );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the dense matrix.
+// \return void
+//
+// This function increases the capacity of the dense matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::reserve( size_t elements )
+{
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, elements );
+
+      // Initializing the new array
+      transfer( v_, v_+mm_*n_, tmp );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=mm_*n_; i<elements; ++i )
+            tmp[i] = Type();
+      }
+
+      // Replacing the old array
+      if( isDynamic() ) {
+         deallocate( alloc_, v_, capacity_ );
+      }
+
+      v_        = tmp;
+      capacity_ = elements;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. In case the
+// elements fit into the preallocated storage, the dynamic memory is released and the elements
+// are moved back into the preallocated storage. Please note that due to padding the capacity
+// might not be reduced exactly to rows() times columns(). Please also note that in case a
+// reallocation occurs, all iterators (including end() iterators), all pointers and references
+// to elements of this matrix are invalidated.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::shrinkToFit()
+{
+   if( !isDynamic() ) return;
+
+   if( mm_*n_ <= NN )
+   {
+      Type* BLAZE_RESTRICT tmp = array_.array();
+
+      transfer( v_, v_+mm_*n_, tmp );
+
+      deallocate( alloc_, v_, capacity_ );
+
+      v_        = tmp;
+      capacity_ = NN;
+   }
+   else if( mm_*n_ < capacity_ )
+   {
+      SmallMatrix( *this ).swap( *this );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+//
+// The allocators of the two matrices are swapped along with the matrix elements. In case both
+// matrices use dynamic memory, the swap operation is a constant time operation. Otherwise the
+// elements stored in the preallocated storage are moved between the two matrices.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::swap( SmallMatrix& m ) noexcept( nothrowMovable )
+{
+   using std::swap;
+
+   if( isDynamic() && m.isDynamic() )
+   {
+      swap( m_ , m.m_ );
+      swap( mm_, m.mm_ );
+      swap( n_ , m.n_ );
+      swap( capacity_, m.capacity_ );
+      swap( v_, m.v_ );
+   }
+   else if( !isDynamic() && !m.isDynamic() )
+   {
+      std::swap_ranges( v_, v_+std::max( mm_*n_, m.mm_*m.n_ ), m.v_ );
+      swap( m_ , m.m_ );
+      swap( mm_, m.mm_ );
+      swap( n_ , m.n_ );
+   }
+   else
+   {
+      SmallMatrix& dyn( isDynamic() ? *this : m );
+      SmallMatrix& pre( isDynamic() ? m : *this );
+
+      Type* const  dynV       ( dyn.v_ );
+      const size_t dynM       ( dyn.m_ );
+      const size_t dynMM      ( dyn.mm_ );
+      const size_t dynN       ( dyn.n_ );
+      const size_t dynCapacity( dyn.capacity_ );
+
+      dyn.v_        = dyn.array_.array();
+      dyn.capacity_ = NN;
+
+      transfer( pre.v_, pre.v_+pre.mm_*pre.n_, dyn.v_ );
+
+      dyn.m_  = pre.m_;
+      dyn.mm_ = pre.mm_;
+      dyn.n_  = pre.n_;
+
+      pre.v_        = dynV;
+      pre.m_        = dynM;
+      pre.mm_       = dynMM;
+      pre.n_        = dynN;
+      pre.capacity_ = dynCapacity;
+   }
+
+   swap( alloc_, m.alloc_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix elements are stored in dynamically allocated memory.
+//
+// \return \a true in case the elements are stored in dynamic memory, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline bool SmallMatrix<Type,M,N,true,Alloc>::isDynamic() const noexcept
+{
+   return v_ != array_.array();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resets the matrix to an empty matrix using the preallocated storage.
+//
+// \return void
+//
+// This function switches the matrix back to the preallocated storage without releasing any
+// dynamic memory. It is used after the ownership of the dynamic memory has been transferred
+// to another matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::resetPreallocated() noexcept
+{
+   v_        = array_.array();
+   m_        = 0UL;
+   mm_       = 0UL;
+   n_        = 0UL;
+   capacity_ = NN;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Add the necessary amount of padding to the given value.
+//
+// \param value The value to be padded.
+// \return The padded value.
+//
+// This function increments the given \a value by the necessary amount of padding based on the
+// vector's data type \a Type.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallMatrix<Type,M,N,true,Alloc>::addPadding( size_t values ) const noexcept
+{
+   if( usePadding && IsVectorizable_v<Type> )
+      return nextMultiple<size_t>( values, SIMDSIZE );
+   else return values;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::transpose()
+{
+   using std::swap;
+
+   if( m_ == n_ )
+   {
+      smpTranspose( *this );
+   }
+   else if( mm_ == m_ && addPadding( n_ ) == n_ )
+   {
+      transposeCycleKernel<false>( v_, n_, m_ );
+      swap( m_, n_ );
+      mm_ = m_;
+   }
+   else
+   {
+      SmallMatrix tmp( trans(*this) );
+      this->swap( tmp );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::ctranspose()
+{
+   using std::swap;
+
+   if( m_ == n_ )
+   {
+      smpCTranspose( *this );
+   }
+   else if( mm_ == m_ && addPadding( n_ ) == n_ )
+   {
+      transposeCycleKernel<true>( v_, n_, m_ );
+      swap( m_, n_ );
+      mm_ = m_;
+   }
+   else
+   {
+      SmallMatrix tmp( ctrans(*this) );
+      this->swap( tmp );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+//
+// This function scales the matrix by applying the given scalar value \a scalar to each element
+// of the matrix. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator:
+
+   \code
+   blaze::SmallMatrix<int,4UL,4UL> A;
+   // ... Resizing and initialization
+   A *= 4;        // Scaling of the matrix
+   A.scale( 4 );  // Same effect as above
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the scalar value
+inline SmallMatrix<Type,M,N,true,Alloc>& SmallMatrix<Type,M,N,true,Alloc>::scale( const Other& scalar )
+{
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t i=0UL; i<m_; ++i )
+         v_[i+j*mm_] *= scalar;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Class specific implementation of operator new.
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallMatrix class template.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void* SmallMatrix<Type,M,N,true,Alloc>::operator new( std::size_t size )
+{
+   MAYBE_UNUSED( size );
+
+   BLAZE_INTERNAL_ASSERT( size == sizeof( SmallMatrix ), "Invalid number of bytes detected" );
+
+   return allocate_backend( sizeof( SmallMatrix ), alignof( SmallMatrix ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Class specific implementation of operator new[].
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallMatrix class template.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void* SmallMatrix<Type,M,N,true,Alloc>::operator new[]( std::size_t size )
+{
+   BLAZE_INTERNAL_ASSERT( size >= sizeof( SmallMatrix )       , "Invalid number of bytes detected" );
+   BLAZE_INTERNAL_ASSERT( size %  sizeof( SmallMatrix ) == 0UL, "Invalid number of bytes detected" );
+
+   return allocate_backend( size, alignof( SmallMatrix ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Class specific implementation of the no-throw operator new.
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory (\c nullptr in case the allocation failed).
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallMatrix class template.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void* SmallMatrix<Type,M,N,true,Alloc>::operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+   MAYBE_UNUSED( size );
+
+   BLAZE_INTERNAL_ASSERT( size == sizeof( SmallMatrix ), "Invalid number of bytes detected" );
+
+   try {
+      return allocate_backend( sizeof( SmallMatrix ), alignof( SmallMatrix ) );
+   }
+   catch( ... ) {
+      return nullptr;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Class specific implementation of the no-throw operator new[].
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory (\c nullptr in case the allocation failed).
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallMatrix class template.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void* SmallMatrix<Type,M,N,true,Alloc>::operator new[]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( size >= sizeof( SmallMatrix )       , "Invalid number of bytes detected" );
+   BLAZE_INTERNAL_ASSERT( size %  sizeof( SmallMatrix ) == 0UL, "Invalid number of bytes detected" );
+
+   try {
+      return allocate_backend( size, alignof( SmallMatrix ) );
+   }
+   catch( ... ) {
+      return nullptr;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Class specific implementation of operator delete.
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::operator delete( void* ptr ) noexcept
+{
+   deallocate_backend( ptr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Class specific implementation of operator delete[].
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::operator delete[]( void* ptr ) noexcept
+{
+   deallocate_backend( ptr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Class specific implementation of no-throw operator delete.
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::operator delete( void* ptr, const std::nothrow_t& ) noexcept
+{
+   deallocate_backend( ptr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Class specific implementation of no-throw operator delete[].
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline void SmallMatrix<Type,M,N,true,Alloc>::operator delete[]( void* ptr, const std::nothrow_t& ) noexcept
+{
+   deallocate_backend( ptr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the invariants of the small matrix are intact.
+//
+// \return \a true in case the small matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the small matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline bool SmallMatrix<Type,M,N,true,Alloc>::isIntact() const noexcept
+{
+   if( m_ * n_ > capacity_ )
+      return false;
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=m_; i<mm_; ++i ) {
+            if( v_[i+j*mm_] != Type() )
+               return false;
+         }
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the foreign expression
+inline bool SmallMatrix<Type,M,N,true,Alloc>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the foreign expression
+inline bool SmallMatrix<Type,M,N,true,Alloc>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// This function returns whether the matrix is guaranteed to be properly aligned in memory, i.e.
+// whether the beginning and the end of each column of the matrix are guaranteed to conform to
+// the alignment restrictions of the element type \a Type.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline bool SmallMatrix<Type,M,N,true,Alloc>::isAligned() const noexcept
+{
+   return ( usePadding || rows() % SIMDSIZE == 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+inline bool SmallMatrix<Type,M,N,true,Alloc>::canSMPAssign() const noexcept
+{
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the dense matrix. The row index
+// must be smaller than the number of rows and the column index must be smaller than the number
+// of columns. Additionally, the row index must be a multiple of the number of values inside
+// the SIMD element. This function must \b NOT be called explicitly! It is used internally
+// for the performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallMatrix<Type,M,N,true,Alloc>::SIMDType
+   SmallMatrix<Type,M,N,true,Alloc>::load( size_t i, size_t j ) const noexcept
+{
+   if( usePadding )
+      return loada( i, j );
+   else
+      return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the row index must be a multiple of the number of
+// values inside the SIMD element. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallMatrix<Type,M,N,true,Alloc>::SIMDType
+   SmallMatrix<Type,M,N,true,Alloc>::loada( size_t i, size_t j ) const noexcept
+{
+   using blaze::loada;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= mm_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( !usePadding || i % SIMDSIZE == 0UL, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i+j*mm_ ), "Invalid alignment detected" );
+
+   return loada( v_+i+j*mm_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the row index must be a multiple of the number of
+// values inside the SIMD element. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallMatrix<Type,M,N,true,Alloc>::SIMDType
+   SmallMatrix<Type,M,N,true,Alloc>::loadu( size_t i, size_t j ) const noexcept
+{
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= mm_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+
+   return loadu( v_+i+j*mm_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the dense matrix. The row index
+// must be smaller than the number of rows and the column index must be smaller then the number
+// of columns. Additionally, the row index must be a multiple of the number of values inside the
+// SIMD element. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallMatrix<Type,M,N,true,Alloc>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   if( usePadding )
+      storea( i, j, value );
+   else
+      storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the row index must be a multiple of the number of
+// values inside the SIMD element. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallMatrix<Type,M,N,true,Alloc>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   using blaze::storea;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= mm_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( !usePadding || i % SIMDSIZE == 0UL, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i+j*mm_ ), "Invalid alignment detected" );
+
+   storea( v_+i+j*mm_, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the row index must be a multiple of the number of
+// values inside the SIMD element. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallMatrix<Type,M,N,true,Alloc>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   using blaze::storeu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= mm_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+
+   storeu( v_+i+j*mm_, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific SIMD element of the
+// dense matrix. The row index must be smaller than the number of rows and the column index
+// must be smaller than the number of columns. Additionally, the row index must be a multiple
+// of the number of values inside the SIMD element. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallMatrix<Type,M,N,true,Alloc>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   using blaze::stream;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= mm_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( !usePadding || i % SIMDSIZE == 0UL, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i+j*mm_ ), "Invalid alignment detected" );
+
+   stream( v_+i+j*mm_, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,true,Alloc>::assign( const DenseMatrix<MT,true>& rhs )
+   -> DisableIf_t< VectorizedAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( m_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( size_t i=0UL; i<ipos; i+=2UL ) {
+         v_[i    +j*mm_] = (~rhs)(i    ,j);
+         v_[i+1UL+j*mm_] = (~rhs)(i+1UL,j);
+      }
+      if( ipos < m_ ) {
+         v_[ipos+j*mm_] = (~rhs)(ipos,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,true,Alloc>::assign( const DenseMatrix<MT,true>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   const size_t ipos( ( remainder )?( m_ & size_t(-SIMDSIZE) ):( m_ ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( m_ - ( m_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   if( usePadding && useStreaming &&
+       ( m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
+   {
+      for( size_t j=0UL; j<n_; ++j )
+      {
+         size_t i( 0UL );
+         Iterator left( begin(j) );
+         ConstIterator_t<MT> right( (~rhs).begin(j) );
+
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; remainder && i<m_; ++i ) {
+            *left = *right; ++left; ++right;
+         }
+      }
+   }
+   else
+   {
+      for( size_t j=0UL; j<n_; ++j )
+      {
+         size_t i( 0UL );
+         Iterator left( begin(j) );
+         ConstIterator_t<MT> right( (~rhs).begin(j) );
+
+         for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; remainder && i<m_; ++i ) {
+            *left = *right; ++left; ++right;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::assign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t jj=0UL; jj<n_; jj+=block ) {
+      const size_t jend( min( n_, jj+block ) );
+      for( size_t ii=0UL; ii<m_; ii+=block ) {
+         const size_t iend( min( m_, ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               v_[i+j*mm_] = (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::assign( const SparseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<(~rhs).columns(); ++j )
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()+j*mm_] = element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::assign( const SparseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<(~rhs).rows(); ++i )
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i+element->index()*mm_] = element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,true,Alloc>::addAssign( const DenseMatrix<MT,true>& rhs )
+   -> DisableIf_t< VectorizedAddAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      if( IsDiagonal_v<MT> )
+      {
+         v_[j+j*mm_] += (~rhs)(j,j);
+      }
+      else
+      {
+         const size_t ibegin( ( IsLower_v<MT> )
+                              ?( IsStrictlyLower_v<MT> ? j+1UL : j )
+                              :( 0UL ) );
+         const size_t iend  ( ( IsUpper_v<MT> )
+                              ?( IsStrictlyUpper_v<MT> ? j : j+1UL )
+                              :( m_ ) );
+         BLAZE_INTERNAL_ASSERT( ibegin <= iend, "Invalid loop indices detected" );
+
+         size_t i( ibegin );
+
+         for( ; (i+2UL) <= iend; i+=2UL ) {
+            v_[i    +j*mm_] += (~rhs)(i    ,j);
+            v_[i+1UL+j*mm_] += (~rhs)(i+1UL,j);
+         }
+         if( i < iend ) {
+            v_[i+j*mm_] += (~rhs)(i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,true,Alloc>::addAssign( const DenseMatrix<MT,true>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      const size_t ibegin( ( IsLower_v<MT> )
+                           ?( ( IsStrictlyLower_v<MT> ? j+1UL : j ) & size_t(-SIMDSIZE) )
+                           :( 0UL ) );
+      const size_t iend  ( ( IsUpper_v<MT> )
+                           ?( IsStrictlyUpper_v<MT> ? j : j+1UL )
+                           :( m_ ) );
+      BLAZE_INTERNAL_ASSERT( ibegin <= iend, "Invalid loop indices detected" );
+
+      const size_t ipos( ( remainder )?( iend & size_t(-SIMDSIZE) ):( iend ) );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( iend - ( iend % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+      size_t i( ibegin );
+      Iterator left( begin(j) + ibegin );
+      ConstIterator_t<MT> right( (~rhs).begin(j) + ibegin );
+
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && i<iend; ++i ) {
+         *left += *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::addAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t jj=0UL; jj<n_; jj+=block ) {
+      const size_t jend( min( n_, jj+block ) );
+      for( size_t ii=0UL; ii<m_; ii+=block )
+      {
+         if( IsLower_v<MT> && ii < jj ) continue;
+         if( IsUpper_v<MT> && ii > jj ) break;
+
+         for( size_t j=jj; j<jend; ++j )
+         {
+            const size_t ibegin( ( IsLower_v<MT> )
+                                 ?( max( ( IsStrictlyLower_v<MT> ? j+1UL : j ), ii ) )
+                                 :( ii ) );
+            const size_t iend  ( ( IsUpper_v<MT> )
+                                 ?( min( ( IsStrictlyUpper_v<MT> ? j : j+1UL ), m_, ii+block ) )
+                                 :( min( m_, ii+block ) ) );
+            BLAZE_INTERNAL_ASSERT( ibegin <= iend, "Invalid loop indices detected" );
+
+            for( size_t i=ibegin; i<iend; ++i ) {
+               v_[i+j*mm_] += (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::addAssign( const SparseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<(~rhs).columns(); ++j )
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()+j*mm_] += element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::addAssign( const SparseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<(~rhs).rows(); ++i )
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i+element->index()*mm_] += element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,true,Alloc>::subAssign( const DenseMatrix<MT,true>& rhs )
+   -> DisableIf_t< VectorizedSubAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      if( IsDiagonal_v<MT> )
+      {
+         v_[j+j*mm_] -= (~rhs)(j,j);
+      }
+      else
+      {
+         const size_t ibegin( ( IsLower_v<MT> )
+                              ?( IsStrictlyLower_v<MT> ? j+1UL : j )
+                              :( 0UL ) );
+         const size_t iend  ( ( IsUpper_v<MT> )
+                              ?( IsStrictlyUpper_v<MT> ? j : j+1UL )
+                              :( m_ ) );
+         BLAZE_INTERNAL_ASSERT( ibegin <= iend, "Invalid loop indices detected" );
+
+         size_t i( ibegin );
+
+         for( ; (i+2UL) <= iend; i+=2UL ) {
+            v_[i  +j*mm_] -= (~rhs)(i  ,j);
+            v_[i+1+j*mm_] -= (~rhs)(i+1,j);
+         }
+         if( i < iend ) {
+            v_[i+j*mm_] -= (~rhs)(i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,true,Alloc>::subAssign( const DenseMatrix<MT,true>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      const size_t ibegin( ( IsLower_v<MT> )
+                           ?( ( IsStrictlyLower_v<MT> ? j+1UL : j ) & size_t(-SIMDSIZE) )
+                           :( 0UL ) );
+      const size_t iend  ( ( IsUpper_v<MT> )
+                           ?( IsStrictlyUpper_v<MT> ? j : j+1UL )
+                           :( m_ ) );
+      BLAZE_INTERNAL_ASSERT( ibegin <= iend, "Invalid loop indices detected" );
+
+      const size_t ipos( ( remainder )?( iend & size_t(-SIMDSIZE) ):( iend ) );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( iend - ( iend % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+      size_t i( ibegin );
+      Iterator left( begin(j) + ibegin );
+      ConstIterator_t<MT> right( (~rhs).begin(j) + ibegin );
+
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && i<iend; ++i ) {
+         *left -= *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::subAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t jj=0UL; jj<n_; jj+=block ) {
+      const size_t jend( min( n_, jj+block ) );
+      for( size_t ii=0UL; ii<m_; ii+=block )
+      {
+         if( IsLower_v<MT> && ii < jj ) continue;
+         if( IsUpper_v<MT> && ii > jj ) break;
+
+         for( size_t j=jj; j<jend; ++j )
+         {
+            const size_t ibegin( ( IsLower_v<MT> )
+                                 ?( max( ( IsStrictlyLower_v<MT> ? j+1UL : j ), ii ) )
+                                 :( ii ) );
+            const size_t iend  ( ( IsUpper_v<MT> )
+                                 ?( min( ( IsStrictlyUpper_v<MT> ? j : j+1UL ), m_, ii+block ) )
+                                 :( min( m_, ii+block ) ) );
+            BLAZE_INTERNAL_ASSERT( ibegin <= iend, "Invalid loop indices detected" );
+
+            for( size_t i=ibegin; i<iend; ++i ) {
+               v_[i+j*mm_] -= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::subAssign( const SparseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<(~rhs).columns(); ++j )
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()+j*mm_] -= element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::subAssign( const SparseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<(~rhs).rows(); ++i )
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i+element->index()*mm_] -= element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the Schur product assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,true,Alloc>::schurAssign( const DenseMatrix<MT,true>& rhs )
+   -> DisableIf_t< VectorizedSchurAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( m_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( size_t i=0UL; (i+2UL) <= ipos; i+=2UL ) {
+         v_[i  +j*mm_] *= (~rhs)(i  ,j);
+         v_[i+1+j*mm_] *= (~rhs)(i+1,j);
+      }
+      if( ipos < m_ ) {
+         v_[ipos+j*mm_] *= (~rhs)(ipos,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline auto SmallMatrix<Type,M,N,true,Alloc>::schurAssign( const DenseMatrix<MT,true>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      const size_t ipos( ( remainder )?( m_ & size_t(-SIMDSIZE) ):( m_ ) );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( m_ - ( m_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT> right( (~rhs).begin(j) );
+
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && i<m_; ++i ) {
+         *left *= *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the Schur product assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::schurAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t jj=0UL; jj<n_; jj+=block ) {
+      const size_t jend( min( n_, jj+block ) );
+      for( size_t ii=0UL; ii<m_; ii+=block ) {
+         const size_t iend( min( m_, ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               v_[i+j*mm_] *= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the Schur product assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::schurAssign( const SparseMatrix<MT,true>& rhs )
+{
+   using blaze::reset;
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      size_t i( 0UL );
+
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+         for( ; i<element->index(); ++i )
+            reset( v_[i+j*mm_] );
+         v_[i+j*mm_] *= element->value();
+         ++i;
+      }
+
+      for( ; i<m_; ++i ) {
+         reset( v_[i+j*mm_] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the Schur product assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void SmallMatrix<Type,M,N,true,Alloc>::schurAssign( const SparseMatrix<MT,false>& rhs )
+{
+   using blaze::reset;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      size_t j( 0UL );
+
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         for( ; j<element->index(); ++j )
+            reset( v_[i+j*mm_] );
+         v_[i+j*mm_] *= element->value();
+         ++j;
+      }
+
+      for( ; j<n_; ++j ) {
+         reset( v_[i+j*mm_] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  SMALLMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SmallMatrix operators */
+//@{
+template< typename Type, size_t M, size_t N, bool SO, typename Alloc >
+void reset( SmallMatrix<Type,M,N,SO,Alloc>& m );
+
+template< typename Type, size_t M, size_t N, bool SO, typename Alloc >
+void reset( SmallMatrix<Type,M,N,SO,Alloc>& m, size_t i );
+
+template< typename Type, size_t M, size_t N, bool SO, typename Alloc >
+void clear( SmallMatrix<Type,M,N,SO,Alloc>& m );
+
+template< bool RF, typename Type, size_t M, size_t N, bool SO, typename Alloc >
+bool isDefault( const SmallMatrix<Type,M,N,SO,Alloc>& m );
+
+template< typename Type, size_t M, size_t N, bool SO, typename Alloc >
+bool isIntact( const SmallMatrix<Type,M,N,SO,Alloc>& m ) noexcept;
+
+template< typename Type, size_t M, size_t N, bool SO, typename Alloc >
+void swap( SmallMatrix<Type,M,N,SO,Alloc>& a, SmallMatrix<Type,M,N,SO,Alloc>& b )
+   noexcept( noexcept( a.swap( b ) ) );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given small matrix.
+// \ingroup small_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void reset( SmallMatrix<Type,M,N,SO,Alloc>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given small matrix.
+// \ingroup small_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given small matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void reset( SmallMatrix<Type,M,N,SO,Alloc>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given small matrix.
+// \ingroup small_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void clear( SmallMatrix<Type,M,N,SO,Alloc>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given small matrix is in default state.
+// \ingroup small_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the small matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::SmallMatrix<int,4UL,4UL> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( A ) ) { ... }
+   \endcode
+*/
+template< bool RF           // Relaxation flag
+        , typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool isDefault( const SmallMatrix<Type,M,N,SO,Alloc>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given small matrix are intact.
+// \ingroup small_matrix
+//
+// \param m The small matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the small matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::SmallMatrix<int,4UL,4UL> A;
+   // ... Resizing and initialization
+   if( isIntact( A ) ) { ... }
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const SmallMatrix<Type,M,N,SO,Alloc>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two small matrices.
+// \ingroup small_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of preallocated rows
+        , size_t N          // Number of preallocated columns
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void swap( SmallMatrix<Type,M,N,SO,Alloc>& a, SmallMatrix<Type,M,N,SO,Alloc>& b )
+   noexcept( noexcept( a.swap( b ) ) )
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASCONSTDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t M, size_t N, bool SO, typename A >
+struct HasConstDataAccess< SmallMatrix<T,M,N,SO,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASMUTABLEDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t M, size_t N, bool SO, typename A >
+struct HasMutableDataAccess< SmallMatrix<T,M,N,SO,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t M, size_t N, bool SO, typename A >
+struct IsAligned< SmallMatrix<T,M,N,SO,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCONTIGUOUS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t M, size_t N, bool SO, typename A >
+struct IsContiguous< SmallMatrix<T,M,N,SO,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t M, size_t N, bool SO, typename A >
+struct IsPadded< SmallMatrix<T,M,N,SO,A> >
+   : public BoolConstant<usePadding>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t M, size_t N, bool SO, typename A >
+struct IsResizable< SmallMatrix<T,M,N,SO,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t M, size_t N, bool SO, typename A >
+struct IsShrinkable< SmallMatrix<T,M,N,SO,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
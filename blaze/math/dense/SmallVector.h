@@ -0,0 +1,3394 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SmallVector.h
+//  \brief Header file for the implementation of a dynamic vector with small buffer optimization
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SMALLVECTOR_H_
+#define _BLAZE_MATH_DENSE_SMALLVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/UniformVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/typetraits/IsVector.h>
+#include <blaze/math/typetraits/TransposeFlag.h>
+#include <blaze/math/Uninitialized.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/algorithms/Destroy.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/algorithms/UninitializedDefaultConstruct.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/smallarray/SmallArrayData.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsAssignable.h>
+#include <blaze/util/typetraits/IsConstructible.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup small_vector SmallVector
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of an arbitrary sized vector with small buffer optimization.
+// \ingroup small_vector
+//
+// The SmallVector class template is the representation of an arbitrary sized vector with
+// elements of arbitrary type, which provides in-place storage for up to \a N elements and
+// transparently switches to dynamically allocated memory in case the vector grows beyond this
+// size. The type of the elements, the number of preallocated elements, the transpose flag of the
+// vector, and the allocator can be specified via the four template parameters:
+
+   \code
+   template< typename Type, size_t N, bool TF, typename Alloc >
+   class SmallVector;
+   \endcode
+
+//  - Type : specifies the type of the vector elements. SmallVector can be used with any
+//           non-cv-qualified, non-reference, non-pointer element type.
+//  - N    : specifies the number of preallocated elements. Note that in case padding is
+//           enabled the in-place storage is rounded up to a multiple of the SIMD width.
+//  - TF   : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//           vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - Alloc: specifies the type of the allocator used for vectors with more than \a N elements.
+//           The allocator must return memory that satisfies the alignment restrictions of the
+//           element type (see the AlignmentOf type trait). The default value is
+//           \a blaze::AlignedAllocator.
+//
+// SmallVector has the same semantics as DynamicVector: It can be resized arbitrarily, all its
+// elements are stored contiguously, and it can be used in all operations in place of a
+// DynamicVector. However, as long as its size (plus padding) doesn't exceed \a N, no dynamic
+// memory is allocated, which makes the SmallVector the ideal choice for a large number of
+// vectors that are usually, but not necessarily, small. The in-place storage is aligned for
+// the according SIMD instruction set. Note however that in case a SmallVector is allocated
+// dynamically, the alignment is only guaranteed for the \c new operator of the SmallVector
+// class itself and for allocators that respect the alignment of the SmallVector type.
+//
+// The following example gives an impression of the use of SmallVector:
+
+   \code
+   using blaze::SmallVector;
+   using blaze::CompressedVector;
+   using blaze::DynamicMatrix;
+
+   SmallVector<double,8UL> a( 2 );  // Non-initialized 2D vector of size 2 (no allocation)
+   a[0] = 1.0;                      // Initialization of the first element
+   a[1] = 2.0;                      // Initialization of the second element
+
+   SmallVector<double,8UL> b( 2, 2.0  );  // Directly, homogeneously initialized 2D vector
+   CompressedVector<float> c( 2 );        // Empty sparse single precision vector
+   SmallVector<double,8UL> d;             // Default constructed small vector
+   DynamicMatrix<double>   A;             // Default constructed row-major matrix
+
+   d = a + b;  // Vector addition between vectors of equal element type
+   d = a - c;  // Vector subtraction between a dense and sparse vector with different element types
+   d = a * b;  // Component-wise vector multiplication
+
+   a *= 2.0;      // In-place scaling of vector
+   d  = a * 2.0;  // Scaling of vector a
+   d  = 2.0 * a;  // Scaling of vector a
+
+   d += a - b;  // Addition assignment
+   d -= a + c;  // Subtraction assignment
+   d *= a * b;  // Multiplication assignment
+
+   double scalar = trans( a ) * b;  // Scalar/dot/inner product between two vectors
+
+   A = a * trans( b );  // Outer product between two vectors
+
+   d.resize( 100UL );  // Switching to dynamically allocated memory
+   \endcode
+
+// Note that the result type of operations involving small vectors (as for instance additions,
+// subtractions, and scalings) is determined by the same rules as for any other resizable vector,
+// i.e. intermediate temporaries are of type DynamicVector. In order to avoid dynamic memory
+// allocations, the results should therefore be directly assigned to small vectors.
+*/
+template< typename Type                     // Data type of the vector
+        , size_t N                          // Number of preallocated elements
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename Alloc >                  // Type of the allocator
+class SmallVector
+   : public DenseVector< SmallVector<Type,N,TF,Alloc>, TF >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = SmallVector<Type,N,TF,Alloc>;   //!< Type of this SmallVector instance.
+   using BaseType      = DenseVector<This,TF>;           //!< Base type of this SmallVector instance.
+   using ResultType    = This;                           //!< Result type for expression template evaluations.
+   using TransposeType = SmallVector<Type,N,!TF,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                           //!< Type of the vector elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;       //!< SIMD type of the vector elements.
+   using ReturnType    = const Type&;                    //!< Return type for expression template evaluations
+   using CompositeType = const SmallVector&;             //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                          //!< Type of the allocator of the vector elements.
+
+   using Reference      = Type&;        //!< Reference to a non-constant vector value.
+   using ConstReference = const Type&;  //!< Reference to a constant vector value.
+   using Pointer        = Type*;        //!< Pointer to a non-constant vector value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant vector value.
+
+   using Iterator      = DenseIterator<Type,aligned>;        //!< Iterator over non-constant elements.
+   using ConstIterator = DenseIterator<const Type,aligned>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SmallVector with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other vector
+   struct Rebind {
+      using NewAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NewType>;  //!< Type of the rebound allocator.
+      using Other    = SmallVector<NewType,N,TF,NewAlloc>;                                     //!< The type of the other SmallVector.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SmallVector with a different fixed number of elements.
+   */
+   template< size_t NewN >  // Number of elements of the other vector
+   struct Resize {
+      using Other = SmallVector<Type,N,TF,Alloc>;  //!< The type of the other SmallVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the vector is involved
+       in can be optimized via SIMD operationss. In case the element type of the vector is a
+       vectorizable data type, the \a simdEnabled compilation flag is set to \a true, otherwise
+       it is set to \a false. */
+   static constexpr bool simdEnabled = IsVectorizable_v<Type>;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SmallVector();
+   explicit inline SmallVector( size_t n );
+   explicit inline SmallVector( size_t n, const Type& init );
+   explicit inline SmallVector( size_t n, Uninitialized );
+            inline SmallVector( initializer_list<Type> list );
+
+   template< typename Other >
+   explicit inline SmallVector( size_t n, const Other* array );
+
+   template< typename Other, size_t Dim >
+   explicit inline SmallVector( const Other (&array)[Dim] );
+
+                           inline SmallVector( const SmallVector& v );
+                           inline SmallVector( SmallVector&& v ) noexcept( nothrowMovable );
+   template< typename VT > inline SmallVector( const Vector<VT,TF>& v );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SmallVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index ) noexcept;
+   inline ConstReference operator[]( size_t index ) const noexcept;
+   inline Reference      at( size_t index );
+   inline ConstReference at( size_t index ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Iterator       begin () noexcept;
+   inline ConstIterator  begin () const noexcept;
+   inline ConstIterator  cbegin() const noexcept;
+   inline Iterator       end   () noexcept;
+   inline ConstIterator  end   () const noexcept;
+   inline ConstIterator  cend  () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SmallVector& operator=( const Type& rhs );
+   inline SmallVector& operator=( initializer_list<Type> list );
+
+   template< typename Other, size_t Dim >
+   inline SmallVector& operator=( const Other (&array)[Dim] );
+
+   inline SmallVector& operator=( const SmallVector& rhs );
+   inline SmallVector& operator=( SmallVector&& rhs ) noexcept( nothrowMovable );
+
+   template< typename VT > inline SmallVector& operator= ( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SmallVector& operator+=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SmallVector& operator-=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SmallVector& operator*=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SmallVector& operator/=( const DenseVector<VT,TF>& rhs );
+   template< typename VT > inline SmallVector& operator%=( const Vector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   resize( size_t n, bool preserve, Uninitialized );
+   inline void   extend( size_t n, bool preserve=true );
+   inline void   reserve( size_t n );
+   inline void   shrinkToFit();
+   inline void   swap( SmallVector& v ) noexcept( nothrowMovable );
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Other > inline SmallVector& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Memory functions****************************************************************************
+   /*!\name Memory functions */
+   //@{
+   static inline void* operator new  ( std::size_t size );
+   static inline void* operator new[]( std::size_t size );
+   static inline void* operator new  ( std::size_t size, const std::nothrow_t& ) noexcept;
+   static inline void* operator new[]( std::size_t size, const std::nothrow_t& ) noexcept;
+
+   static inline void operator delete  ( void* ptr ) noexcept;
+   static inline void operator delete[]( void* ptr ) noexcept;
+   static inline void operator delete  ( void* ptr, const std::nothrow_t& ) noexcept;
+   static inline void operator delete[]( void* ptr, const std::nothrow_t& ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<VT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedAddAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<VT> > &&
+        HasSIMDAdd_v< Type, ElementType_t<VT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedSubAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<VT> > &&
+        HasSIMDSub_v< Type, ElementType_t<VT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedMultAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<VT> > &&
+        HasSIMDMult_v< Type, ElementType_t<VT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedDivAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT::simdEnabled &&
+        IsSIMDCombinable_v< Type, ElementType_t<VT> > &&
+        HasSIMDDiv_v< Type, ElementType_t<VT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+
+   //! The number of preallocated elements including padding.
+   static constexpr size_t NN = ( usePadding ? nextMultiple( N, SIMDSIZE ) : N );
+
+   //! Compilation flag for the exception safety of the move operations and the swap operation.
+   static constexpr bool nothrowMovable = ( IsNothrowDefaultConstructible_v<Type> &&
+                                            IsNothrowMoveConstructible_v<Type> &&
+                                            IsNothrowMoveAssignable_v<Type> );
+   //**********************************************************************************************
+
+ public:
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t index ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t index, const SIMDType& value ) noexcept;
+
+   template< typename VT >
+   inline auto assign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto assign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedAssign_v<VT> >;
+
+   template< typename VT > inline void assign( const SparseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline auto addAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto addAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<VT> >;
+
+   template< typename VT > inline void addAssign( const SparseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline auto subAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto subAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<VT> >;
+
+   template< typename VT > inline void subAssign( const SparseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline auto multAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedMultAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto multAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedMultAssign_v<VT> >;
+
+   template< typename VT > inline void multAssign( const SparseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline auto divAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedDivAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto divAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedDivAssign_v<VT> >;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SmallVector( const Alloc& alloc );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   isDynamic() const noexcept;
+   inline void   resetPreallocated() noexcept;
+   inline size_t addPadding( size_t value ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SmallArrayData<Type,NN> array_;  //!< The preallocated storage for up to NN vector elements.
+   Alloc alloc_;                    //!< The allocator of the vector elements.
+   size_t size_;                    //!< The current size/dimension of the vector.
+   size_t capacity_;                //!< The maximum capacity of the vector.
+   Type* BLAZE_RESTRICT v_;         //!< The vector elements.
+                                    /*!< Access to the vector elements is gained via the subscript
+                                         operator. The elements are either stored in the
+                                         preallocated storage or in dynamically allocated memory.
+                                         The order of the elements is
+                                         \f[\left(\begin{array}{*{5}{c}}
+                                         0 & 1 & 2 & \cdots & N-1 \\
+                                         \end{array}\right)\f] */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE         ( Type, typename std::allocator_traits<Alloc>::value_type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SmallVector.
+//
+// The default constructed vector has a size of 0 and uses the preallocated storage.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::SmallVector()
+   : SmallVector( Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a vector of size \a n. No element initialization is performed!
+//
+// \param n The size of the vector.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory in case
+// the size of the vector exceeds the preallocated storage. No element initialization is
+// performed!
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( size_t n )
+   : SmallVector( Alloc() )
+{
+   resize( n, false );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all \a n vector elements.
+//
+// \param n The size of the vector.
+// \param init The initial value of the vector elements.
+//
+// All vector elements are initialized with the specified value. In case the parallel first-touch
+// initialization is enabled (see the BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements of large
+// vectors are initialized in parallel to place them on the NUMA nodes of the according threads.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( size_t n, const Type& init )
+   : SmallVector( n )
+{
+   if( useNUMAFirstTouch && !isParallelSectionActive() ) {
+      smpAssign( *this, UniformVector<Type,TF>( n, init ) );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Explicitly uninitialized construction of a vector of size \a n.
+//
+// \param n The size of the vector.
+//
+// This constructor allocates a vector of size \a n without initializing its elements. It is
+// meant for vectors that are completely overwritten right after construction:
+
+   \code
+   blaze::SmallVector<double,8UL> y( 1000UL, blaze::uninitialized );
+   y = A * x;
+   \endcode
+
+// In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating point
+// elements are set to NaN in order to reveal accidental reads of uninitialized elements.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( size_t n, Uninitialized )
+   : SmallVector( n )
+{
+   poison( v_, v_+size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all vector elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the vector
+// within a constructor call:
+
+   \code
+   blaze::SmallVector<double,8UL> v1{ 4.2, 6.3, -1.2 };
+   \endcode
+
+// The vector is sized according to the size of the initializer list and all its elements are
+// (copy) assigned the elements of the given initializer list.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( initializer_list<Type> list )
+   : SmallVector( list.size() )
+{
+   std::fill( std::copy( list.begin(), list.end(), begin() ), end(), Type() );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array initialization of all vector elements.
+//
+// \param n The size of the vector.
+// \param array Dynamic array for the initialization.
+//
+// This constructor offers the option to directly initialize the elements of the vector with a
+// dynamic array:
+
+   \code
+   double* array = new double[4];
+   // ... Initialization of the dynamic array
+   blaze::SmallVector<double,8UL> v( array, 4UL );
+   delete[] array;
+   \endcode
+
+// The vector is sized according to the specified size of the array and initialized with the
+// values from the given array. Note that it is expected that the given \a array has at least
+// \a n elements. Providing an array with less elements results in undefined behavior!
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the initialization array
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( size_t n, const Other* array )
+   : SmallVector( n )
+{
+   for( size_t i=0UL; i<n; ++i )
+      v_[i] = array[i];
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array initialization of all vector elements.
+//
+// \param array N-dimensional array for the initialization.
+//
+// This constructor offers the option to directly initialize the elements of the vector with a
+// static array:
+
+   \code
+   const int init[4] = { 1, 2, 3 };
+   blaze::SmallVector<int,8UL> v( init );
+   \endcode
+
+// The vector is sized according to the size of the array and initialized with the values from the
+// given array. Missing values are initialized with default values (as e.g. the fourth element in
+// the example).
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Dim >      // Dimension of the initialization array
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( const Other (&array)[Dim] )
+   : SmallVector( Dim )
+{
+   for( size_t i=0UL; i<Dim; ++i )
+      v_[i] = array[i];
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SmallVector.
+//
+// \param v Vector to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization. The copy only allocates dynamic memory
+// in case the size of the given vector exceeds the preallocated storage. The allocator of the
+// new vector is obtained via the \c select_on_container_copy_construction() function of the
+// allocator of the given vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( const SmallVector& v )
+   : SmallVector( std::allocator_traits<Alloc>::select_on_container_copy_construction( v.alloc_ ) )
+{
+   resize( v.size_, false, uninitialized );
+
+   BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
+
+   smpAssign( *this, ~v );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SmallVector.
+//
+// \param v The vector to be moved into this instance.
+//
+// In case the given vector uses dynamically allocated memory, the memory is moved into this
+// instance along with the allocator. Else the elements of the given vector are moved into the
+// preallocated storage of this instance. In both cases the given vector is empty afterwards.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( SmallVector&& v ) noexcept( nothrowMovable )
+   : SmallVector( v.alloc_ )
+{
+   if( v.isDynamic() ) {
+      size_     = v.size_;
+      capacity_ = v.capacity_;
+      v_        = v.v_;
+   }
+   else {
+      transfer( v.v_, v.v_+v.size_, v_ );
+      size_ = v.size_;
+   }
+
+   v.resetPreallocated();
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different vectors.
+//
+// \param v Vector to be copied.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the foreign vector
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( const Vector<VT,TF>& v )
+   : SmallVector( (~v).size() )
+{
+   BLAZE_INSTRUMENT_TEMPORARY;
+
+   if( IsSparseVector_v<VT> ) {
+      for( size_t i=0UL; i<size_; ++i ) {
+         v_[i] = Type();
+      }
+   }
+
+   smpAssign( *this, ~v );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty vector with the given allocator.
+//
+// \param alloc The allocator for the dynamically allocated vector elements.
+//
+// This constructor default constructs the preallocated vector elements. All other constructors
+// delegate to this constructor such that the preallocated elements are properly destroyed in
+// case of an exception.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::SmallVector( const Alloc& alloc )
+   : array_   ()                  // The preallocated storage
+   , alloc_   ( alloc )           // The allocator of the vector elements
+   , size_    ( 0UL )             // The current size/dimension of the vector
+   , capacity_( NN )              // The maximum capacity of the vector
+   , v_       ( array_.array() )  // The vector elements
+{
+   blaze::uninitialized_default_construct( v_, v_+NN );
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=0UL; i<NN; ++i )
+         v_[i] = Type();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SmallVector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>::~SmallVector()
+{
+   if( isDynamic() ) {
+      deallocate( alloc_, v_, capacity_ );
+   }
+
+   blaze::destroy( array_.array(), array_.array()+NN );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::Reference
+   SmallVector<Type,N,TF,Alloc>::operator[]( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return v_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::ConstReference
+   SmallVector<Type,N,TF,Alloc>::operator[]( size_t index ) const noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return v_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid vector access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::Reference
+   SmallVector<Type,N,TF,Alloc>::at( size_t index )
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid vector access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::ConstReference
+   SmallVector<Type,N,TF,Alloc>::at( size_t index ) const
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the vector elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the small vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::Pointer SmallVector<Type,N,TF,Alloc>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the vector elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the small vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::ConstPointer SmallVector<Type,N,TF,Alloc>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the small vector.
+//
+// \return Iterator to the first element of the small vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::Iterator SmallVector<Type,N,TF,Alloc>::begin() noexcept
+{
+   return Iterator( v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the small vector.
+//
+// \return Iterator to the first element of the small vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::ConstIterator SmallVector<Type,N,TF,Alloc>::begin() const noexcept
+{
+   return ConstIterator( v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the small vector.
+//
+// \return Iterator to the first element of the small vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::ConstIterator SmallVector<Type,N,TF,Alloc>::cbegin() const noexcept
+{
+   return ConstIterator( v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the small vector.
+//
+// \return Iterator just past the last element of the small vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::Iterator SmallVector<Type,N,TF,Alloc>::end() noexcept
+{
+   return Iterator( v_ + size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the small vector.
+//
+// \return Iterator just past the last element of the small vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::ConstIterator SmallVector<Type,N,TF,Alloc>::end() const noexcept
+{
+   return ConstIterator( v_ + size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the small vector.
+//
+// \return Iterator just past the last element of the small vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename SmallVector<Type,N,TF,Alloc>::ConstIterator SmallVector<Type,N,TF,Alloc>::cend() const noexcept
+{
+   return ConstIterator( v_ + size_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all vector elements.
+//
+// \param rhs Scalar value to be assigned to all vector elements.
+// \return Reference to the assigned vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator=( const Type& rhs )
+{
+   for( size_t i=0UL; i<size_; ++i )
+      v_[i] = rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all vector elements.
+//
+// \param list The initializer list.
+//
+// This assignment operator offers the option to directly assign to all elements of the vector
+// by means of an initializer list:
+
+   \code
+   blaze::SmallVector<double,8UL> v;
+   v = { 4.2, 6.3, -1.2 };
+   \endcode
+
+// The vector is resized according to the size of the initializer list and all its elements are
+// (copy) assigned the values from the given initializer list.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator=( initializer_list<Type> list )
+{
+   resize( list.size(), false, uninitialized );
+   std::copy( list.begin(), list.end(), v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array assignment to all vector elements.
+//
+// \param array N-dimensional array for the assignment.
+// \return Reference to the assigned vector.
+//
+// This assignment operator offers the option to directly set all elements of the vector:
+
+   \code
+   const int init[4] = { 1, 2, 3 };
+   blaze::SmallVector<int,8UL> v;
+   v = init;
+   \endcode
+
+// The vector is resized according to the size of the array and assigned the values from the given
+// array. Missing values are initialized with default values (as e.g. the fourth element in the
+// example).
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Dim >      // Dimension of the initialization array
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator=( const Other (&array)[Dim] )
+{
+   resize( Dim, false, uninitialized );
+
+   for( size_t i=0UL; i<Dim; ++i )
+      v_[i] = array[i];
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SmallVector.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+//
+// The vector is resized according to the given N-dimensional vector and initialized as a
+// copy of this vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator=( const SmallVector& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.size_, false, uninitialized );
+   smpAssign( *this, ~rhs );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SmallVector.
+//
+// \param rhs The vector to be moved into this instance.
+// \return Reference to the assigned vector.
+//
+// In case the given vector uses dynamically allocated memory, the memory is moved into this
+// instance along with the allocator. Else the elements of the given vector are moved into the
+// preallocated storage of this instance. In both cases the given vector is empty afterwards.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline SmallVector<Type,N,TF,Alloc>&
+   SmallVector<Type,N,TF,Alloc>::operator=( SmallVector&& rhs ) noexcept( nothrowMovable )
+{
+   if( isDynamic() ) {
+      deallocate( alloc_, v_, capacity_ );
+      resetPreallocated();
+   }
+
+   if( rhs.isDynamic() ) {
+      alloc_    = std::move( rhs.alloc_ );
+      size_     = rhs.size_;
+      capacity_ = rhs.capacity_;
+      v_        = rhs.v_;
+   }
+   else {
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=rhs.size_; i<size_; ++i )
+            v_[i] = Type();
+      }
+
+      transfer( rhs.v_, rhs.v_+rhs.size_, v_ );
+      size_ = rhs.size_;
+   }
+
+   rhs.resetPreallocated();
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different vectors.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+//
+// The vector is resized according to the given vector and initialized as a copy of this vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).canAlias( this ) ) {
+      SmallVector tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).size(), false, uninitialized );
+      if( IsSparseVector_v<VT> )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator+=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<VT> tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector
+//        (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator-=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<VT> tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator*=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( IsSparseVector_v<VT> || (~rhs).canAlias( this ) ) {
+      SmallVector<Type,N,TF,Alloc> tmp( *this * (~rhs) );
+      swap( tmp );
+   }
+   else {
+      smpMultAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a dense vector (\f$ \vec{a}/=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator/=( const DenseVector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      SmallVector<Type,N,TF,Alloc> tmp( *this / (~rhs) );
+      swap( tmp );
+   }
+   else {
+      smpDivAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cross product assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}\times=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector for the cross product.
+// \return Reference to the vector.
+// \exception std::invalid_argument Invalid vector size for cross product.
+//
+// In case the current size of any of the two vectors is not equal to 3, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::operator%=( const Vector<VT,TF>& rhs )
+{
+   using blaze::assign;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType_t<VT>, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_t<VT> );
+
+   using CrossType = CrossTrait_t< This, ResultType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( CrossType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( CrossType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( CrossType );
+
+   if( size_ != 3UL || (~rhs).size() != 3UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size for cross product" );
+   }
+
+   const CrossType tmp( *this % (~rhs) );
+   assign( *this, tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the vector.
+//
+// \return The size of the vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallVector<Type,N,TF,Alloc>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimum capacity of the vector.
+//
+// \return The minimum capacity of the vector.
+//
+// This function returns the minimum capacity of the vector, which corresponds to the current
+// size plus padding.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallVector<Type,N,TF,Alloc>::spacing() const noexcept
+{
+   return addPadding( size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the vector.
+//
+// \return The maximum capacity of the vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallVector<Type,N,TF,Alloc>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the vector.
+//
+// \return The number of non-zero elements in the vector.
+//
+// Note that the number of non-zero elements is always less than or equal to the current size
+// of the vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallVector<Type,N,TF,Alloc>::nonZeros() const
+{
+   size_t nonzeros( 0 );
+
+   for( size_t i=0UL; i<size_; ++i ) {
+      if( !isDefault( v_[i] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::reset()
+{
+   using blaze::clear;
+   for( size_t i=0UL; i<size_; ++i )
+      clear( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the vector.
+//
+// \return void
+//
+// After the clear() function, the size of the vector is 0.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::clear()
+{
+   resize( 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the vector.
+//
+// \param n The new size of the vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the vector using the given size to \a n. During this operation, new
+// dynamic memory may be allocated in case the capacity of the vector is too small. Note that
+// this function may invalidate all existing views (subvectors, ...) on the vector if it is
+// used to shrink the vector. Additionally, the resize operation potentially changes all vector
+// elements. In order to preserve the old vector values, the \a preserve flag can be set to
+// \a true. However, new vector elements are not initialized!
+//
+// The following example illustrates the resize operation of a vector of size 2 to a vector of
+// size 4. The new, uninitialized elements are marked with \a x:
+
+                              \f[
+                              \left(\begin{array}{*{2}{c}}
+                              1 & 2 \\
+                              \end{array}\right)
+
+                              \Longrightarrow
+
+                              \left(\begin{array}{*{4}{c}}
+                              1 & 2 & x & x \\
+                              \end{array}\right)
+                              \f]
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::resize( size_t n, bool preserve )
+{
+   if( n == size_ ) return;
+
+   if( n > capacity_ )
+   {
+      // Allocating a new array
+      const size_t newCapacity( addPadding( n ) );
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, newCapacity );
+
+      // Initializing the new array
+      if( preserve ) {
+         transfer( v_, v_+size_, tmp );
+      }
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=size_; i<newCapacity; ++i )
+            tmp[i] = Type();
+      }
+
+      // Replacing the old array
+      if( isDynamic() ) {
+         deallocate( alloc_, v_, capacity_ );
+      }
+
+      v_        = tmp;
+      capacity_ = newCapacity;
+   }
+   else if( IsVectorizable_v<Type> && n < size_ )
+   {
+      for( size_t i=n; i<size_; ++i )
+         v_[i] = Type();
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the vector without initializing new elements.
+//
+// \param n The new size of the vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the vector to \a n elements. In contrast to the default resize()
+// function, no element beyond the preserved elements is touched except for the padding
+// elements, which avoids an additional pass over the memory in case the vector is completely
+// overwritten afterwards. In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE
+// switch), all new floating point elements are set to NaN.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::resize( size_t n, bool preserve, Uninitialized )
+{
+   if( n == size_ ) return;
+
+   if( n > capacity_ )
+   {
+      // Allocating a new array
+      const size_t newCapacity( addPadding( n ) );
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, newCapacity );
+
+      // Initializing the new array
+      if( preserve ) {
+         transfer( v_, v_+size_, tmp );
+      }
+
+      poison( tmp+( preserve ? size_ : 0UL ), tmp+n );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=n; i<newCapacity; ++i )
+            tmp[i] = Type();
+      }
+
+      // Replacing the old array
+      if( isDynamic() ) {
+         deallocate( alloc_, v_, capacity_ );
+      }
+
+      v_        = tmp;
+      capacity_ = newCapacity;
+   }
+   else if( n < size_ )
+   {
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=n; i<size_; ++i )
+            v_[i] = Type();
+      }
+   }
+   else
+   {
+      poison( v_+size_, v_+n );
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the vector.
+//
+// \param n Number of additional vector elements.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// This function increases the vector size by \a n elements. During this operation, new dynamic
+// memory may be allocated in case the capacity of the vector is too small. Therefore this
+// function potentially changes all vector elements. In order to preserve the old vector values,
+// the \a preserve flag can be set to \a true. However, new vector elements are not initialized!
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::extend( size_t n, bool preserve )
+{
+   resize( size_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the vector.
+//
+// \param n The new minimum capacity of the vector.
+// \return void
+//
+// This function increases the capacity of the vector to at least \a n elements. The current
+// values of the vector elements are preserved.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::reserve( size_t n )
+{
+   if( n > capacity_ )
+   {
+      // Allocating a new array
+      const size_t newCapacity( addPadding( n ) );
+      Type* BLAZE_RESTRICT tmp = allocate( alloc_, newCapacity );
+
+      // Initializing the new array
+      transfer( v_, v_+size_, tmp );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=size_; i<newCapacity; ++i )
+            tmp[i] = Type();
+      }
+
+      // Replacing the old array
+      if( isDynamic() ) {
+         deallocate( alloc_, v_, capacity_ );
+      }
+
+      v_        = tmp;
+      capacity_ = newCapacity;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the vector by removing unused capacity. In case the
+// elements fit into the preallocated storage, the dynamic memory is released and the elements
+// are moved back into the preallocated storage. Please note that due to padding the capacity
+// might not be reduced exactly to size(). Please also note that in case a reallocation occurs,
+// all iterators (including end() iterators), all pointers and references to elements of this
+// vector are invalidated.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::shrinkToFit()
+{
+   if( !isDynamic() ) return;
+
+   if( spacing() <= NN )
+   {
+      Type* BLAZE_RESTRICT tmp = array_.array();
+
+      transfer( v_, v_+size_, tmp );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=size_; i<NN; ++i )
+            tmp[i] = Type();
+      }
+
+      deallocate( alloc_, v_, capacity_ );
+
+      v_        = tmp;
+      capacity_ = NN;
+   }
+   else if( spacing() < capacity_ )
+   {
+      SmallVector( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vectors.
+//
+// \param v The vector to be swapped.
+// \return void
+//
+// The allocators of the two vectors are swapped along with the vector elements. In case both
+// vectors use dynamic memory, the swap operation is a constant time operation. Otherwise the
+// elements stored in the preallocated storage are moved between the two vectors.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::swap( SmallVector& v ) noexcept( nothrowMovable )
+{
+   using std::swap;
+
+   if( isDynamic() && v.isDynamic() )
+   {
+      swap( size_, v.size_ );
+      swap( capacity_, v.capacity_ );
+      swap( v_, v.v_ );
+   }
+   else if( !isDynamic() && !v.isDynamic() )
+   {
+      std::swap_ranges( v_, v_+std::max( size_, v.size_ ), v.v_ );
+      swap( size_, v.size_ );
+   }
+   else
+   {
+      SmallVector& dyn( isDynamic() ? *this : v );
+      SmallVector& pre( isDynamic() ? v : *this );
+
+      Type* const ptr     ( dyn.v_ );
+      const size_t size    ( dyn.size_ );
+      const size_t capacity( dyn.capacity_ );
+
+      dyn.v_        = dyn.array_.array();
+      dyn.capacity_ = NN;
+
+      transfer( pre.v_, pre.v_+pre.size_, dyn.v_ );
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=pre.size_; i<NN; ++i )
+            dyn.v_[i] = Type();
+      }
+
+      dyn.size_ = pre.size_;
+
+      pre.v_        = ptr;
+      pre.size_     = size;
+      pre.capacity_ = capacity;
+   }
+
+   swap( alloc_, v.alloc_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector elements are stored in dynamically allocated memory.
+//
+// \return \a true in case the elements are stored in dynamic memory, \a false if not.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool SmallVector<Type,N,TF,Alloc>::isDynamic() const noexcept
+{
+   return v_ != array_.array();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the vector to an empty vector using the preallocated storage.
+//
+// \return void
+//
+// This function switches the vector back to the preallocated storage without releasing any
+// dynamic memory. It is used after the ownership of the dynamic memory has been transferred
+// to another vector.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::resetPreallocated() noexcept
+{
+   v_        = array_.array();
+   size_     = 0UL;
+   capacity_ = NN;
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=0UL; i<NN; ++i )
+         v_[i] = Type();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Add the necessary amount of padding to the given value.
+//
+// \param value The value to be padded.
+// \return The padded value.
+//
+// This function increments the given \a value by the necessary amount of padding based on the
+// vector's data type \a Type.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t SmallVector<Type,N,TF,Alloc>::addPadding( size_t value ) const noexcept
+{
+   if( usePadding && IsVectorizable_v<Type> )
+      return nextMultiple<size_t>( value, SIMDSIZE );
+   else return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scaling of the vector by the scalar value \a scalar (\f$ \vec{a}=\vec{b}*s \f$).
+//
+// \param scalar The scalar value for the vector scaling.
+// \return Reference to the vector.
+//
+// This function scales the vector by applying the given scalar value \a scalar to each element
+// of the vector. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator:
+
+   \code
+   blaze::SmallVector<int,8UL> a;
+   // ... Initialization
+   a *= 4;        // Scaling of the vector
+   a.scale( 4 );  // Same effect as above
+   \endcode
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the scalar value
+inline SmallVector<Type,N,TF,Alloc>& SmallVector<Type,N,TF,Alloc>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<size_; ++i )
+      v_[i] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of operator new.
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallVector class template.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void* SmallVector<Type,N,TF,Alloc>::operator new( std::size_t size )
+{
+   MAYBE_UNUSED( size );
+
+   BLAZE_INTERNAL_ASSERT( size == sizeof( SmallVector ), "Invalid number of bytes detected" );
+
+   return allocate_backend( sizeof( SmallVector ), alignof( SmallVector ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of operator new[].
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallVector class template.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void* SmallVector<Type,N,TF,Alloc>::operator new[]( std::size_t size )
+{
+   BLAZE_INTERNAL_ASSERT( size >= sizeof( SmallVector )       , "Invalid number of bytes detected" );
+   BLAZE_INTERNAL_ASSERT( size %  sizeof( SmallVector ) == 0UL, "Invalid number of bytes detected" );
+
+   return allocate_backend( size, alignof( SmallVector ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of the no-throw operator new.
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory (\c nullptr in case the allocation failed).
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallVector class template.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void* SmallVector<Type,N,TF,Alloc>::operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+   MAYBE_UNUSED( size );
+
+   BLAZE_INTERNAL_ASSERT( size == sizeof( SmallVector ), "Invalid number of bytes detected" );
+
+   try {
+      return allocate_backend( sizeof( SmallVector ), alignof( SmallVector ) );
+   }
+   catch( ... ) {
+      return nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of the no-throw operator new[].
+//
+// \param size The total number of bytes to be allocated.
+// \return Pointer to the newly allocated memory (\c nullptr in case the allocation failed).
+//
+// This class-specific implementation of operator new provides the functionality to allocate
+// dynamic memory based on the alignment restrictions of the SmallVector class template.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void* SmallVector<Type,N,TF,Alloc>::operator new[]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( size >= sizeof( SmallVector )       , "Invalid number of bytes detected" );
+   BLAZE_INTERNAL_ASSERT( size %  sizeof( SmallVector ) == 0UL, "Invalid number of bytes detected" );
+
+   try {
+      return allocate_backend( size, alignof( SmallVector ) );
+   }
+   catch( ... ) {
+      return nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of operator delete.
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::operator delete( void* ptr ) noexcept
+{
+   deallocate_backend( ptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of operator delete[].
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::operator delete[]( void* ptr ) noexcept
+{
+   deallocate_backend( ptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of no-throw operator delete.
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::operator delete( void* ptr, const std::nothrow_t& ) noexcept
+{
+   deallocate_backend( ptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Class specific implementation of no-throw operator delete[].
+//
+// \param ptr The memory to be deallocated.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void SmallVector<Type,N,TF,Alloc>::operator delete[]( void* ptr, const std::nothrow_t& ) noexcept
+{
+   deallocate_backend( ptr );
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the small vector are intact.
+//
+// \return \a true in case the small vector's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the small vector are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool SmallVector<Type,N,TF,Alloc>::isIntact() const noexcept
+{
+   if( size_ > capacity_ )
+      return false;
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=size_; i<capacity_; ++i ) {
+         if( v_[i] != Type() )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the foreign expression
+inline bool SmallVector<Type,N,TF,Alloc>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other >  // Data type of the foreign expression
+inline bool SmallVector<Type,N,TF,Alloc>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is properly aligned in memory.
+//
+// \return \a true in case the vector is aligned, \a false if not.
+//
+// This function returns whether the vector is guaranteed to be properly aligned in memory, i.e.
+// whether the beginning and the end of the vector are guaranteed to conform to the alignment
+// restrictions of the element type \a Type.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool SmallVector<Type,N,TF,Alloc>::isAligned() const noexcept
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the vector can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current size of the
+// vector).
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool SmallVector<Type,N,TF,Alloc>::canSMPAssign() const noexcept
+{
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of a SIMD element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the dense vector. The index
+// must be smaller than the number of vector elements and it must be a multiple of the number
+// of values inside the SIMD element. This function must \b NOT be called explicitly! It is
+// used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallVector<Type,N,TF,Alloc>::SIMDType
+   SmallVector<Type,N,TF,Alloc>::load( size_t index ) const noexcept
+{
+   return loada( index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned load of a SIMD element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the dense vector. The
+// index must be smaller than the number of vector elements and it must be a multiple of the
+// number of values inside the SIMD element. This function must \b NOT be called explicitly!
+// It is used internally for the performance optimized evaluation of expression templates.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallVector<Type,N,TF,Alloc>::SIMDType
+   SmallVector<Type,N,TF,Alloc>::loada( size_t index ) const noexcept
+{
+   using blaze::loada;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= capacity_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index % SIMDSIZE == 0UL, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+index ), "Invalid alignment detected" );
+
+   return loada( v_+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of a SIMD element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the dense vector. The
+// index must be smaller than the number of vector elements and it must be a multiple of the
+// number of values inside the SIMD element. This function must \b NOT be called explicitly!
+// It is used internally for the performance optimized evaluation of expression templates.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename SmallVector<Type,N,TF,Alloc>::SIMDType
+   SmallVector<Type,N,TF,Alloc>::loadu( size_t index ) const noexcept
+{
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= capacity_, "Invalid vector access index" );
+
+   return loadu( v_+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Store of a SIMD element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the dense vector. The index
+// must be smaller than the number of vector elements and it must be a multiple of the number
+// of values inside the SIMD element. This function must \b NOT be called explicitly! It is
+// used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallVector<Type,N,TF,Alloc>::store( size_t index, const SIMDType& value ) noexcept
+{
+   storea( index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned store of a SIMD element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the dense vector. The
+// index must be smaller than the number of vector elements and it must be a multiple of the
+// number of values inside the SIMD element. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallVector<Type,N,TF,Alloc>::storea( size_t index, const SIMDType& value ) noexcept
+{
+   using blaze::storea;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= capacity_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index % SIMDSIZE == 0UL, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+index ), "Invalid alignment detected" );
+
+   storea( v_+index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of a SIMD element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the dense vector.
+// The index must be smaller than the number of vector elements and it must be a multiple of the
+// number of values inside the SIMD element. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallVector<Type,N,TF,Alloc>::storeu( size_t index, const SIMDType& value ) noexcept
+{
+   using blaze::storeu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= capacity_, "Invalid vector access index" );
+
+   storeu( v_+index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of a SIMD element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific SIMD element of the
+// dense vector. The index must be smaller than the number of vector elements and it must be
+// a multiple of the number of values inside the SIMD element. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void
+   SmallVector<Type,N,TF,Alloc>::stream( size_t index, const SIMDType& value ) noexcept
+{
+   using blaze::stream;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= capacity_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index % SIMDSIZE == 0UL, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+index ), "Invalid alignment detected" );
+
+   stream( v_+index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::assign( const DenseVector<VT,TF>& rhs )
+   -> DisableIf_t< VectorizedAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] = (~rhs)[i    ];
+      v_[i+1UL] = (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] = (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::assign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+
+   const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i=0UL;
+   Iterator left( begin() );
+   ConstIterator_t<VT> right( (~rhs).begin() );
+
+   if( useStreaming && size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   {
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && i<size_; ++i ) {
+         *left = *right; ++left; ++right;
+      }
+   }
+   else
+   {
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && i<size_; ++i ) {
+         *left = *right; ++left; ++right;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void SmallVector<Type,N,TF,Alloc>::assign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   for( auto element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      v_[element->index()] = element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::addAssign( const DenseVector<VT,TF>& rhs )
+   -> DisableIf_t< VectorizedAddAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] += (~rhs)[i    ];
+      v_[i+1UL] += (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] += (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::addAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+
+   const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; remainder && i<size_; ++i ) {
+      *left += *right; ++left; ++right;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void SmallVector<Type,N,TF,Alloc>::addAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   for( auto element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      v_[element->index()] += element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::subAssign( const DenseVector<VT,TF>& rhs )
+   -> DisableIf_t< VectorizedSubAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] -= (~rhs)[i    ];
+      v_[i+1UL] -= (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] -= (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::subAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+
+   const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; remainder && i<size_; ++i ) {
+      *left -= *right; ++left; ++right;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void SmallVector<Type,N,TF,Alloc>::subAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   for( auto element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      v_[element->index()] -= element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::multAssign( const DenseVector<VT,TF>& rhs )
+   -> DisableIf_t< VectorizedMultAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] *= (~rhs)[i    ];
+      v_[i+1UL] *= (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] *= (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::multAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< VectorizedMultAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+
+   const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; remainder && i<size_; ++i ) {
+      *left *= *right; ++left; ++right;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void SmallVector<Type,N,TF,Alloc>::multAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const SmallVector tmp( serial( *this ) );
+
+   reset();
+
+   for( auto element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      v_[element->index()] = tmp[element->index()] * element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisior.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::divAssign( const DenseVector<VT,TF>& rhs )
+   -> DisableIf_t< VectorizedDivAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] /= (~rhs)[i    ];
+      v_[i+1UL] /= (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] /= (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto SmallVector<Type,N,TF,Alloc>::divAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< VectorizedDivAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<size_; ++i ) {
+      *left /= *right; ++left; ++right;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMALLVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SmallVector operators */
+//@{
+template< typename Type, size_t N, bool TF, typename Alloc >
+void reset( SmallVector<Type,N,TF,Alloc>& v );
+
+template< typename Type, size_t N, bool TF, typename Alloc >
+void clear( SmallVector<Type,N,TF,Alloc>& v );
+
+template< bool RF, typename Type, size_t N, bool TF, typename Alloc >
+bool isDefault( const SmallVector<Type,N,TF,Alloc>& v );
+
+template< typename Type, size_t N, bool TF, typename Alloc >
+bool isIntact( const SmallVector<Type,N,TF,Alloc>& v ) noexcept;
+
+template< typename Type, size_t N, bool TF, typename Alloc >
+void swap( SmallVector<Type,N,TF,Alloc>& a, SmallVector<Type,N,TF,Alloc>& b )
+   noexcept( noexcept( a.swap( b ) ) );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given small vector.
+// \ingroup small_vector
+//
+// \param v The small vector to be resetted.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void reset( SmallVector<Type,N,TF,Alloc>& v )
+{
+   v.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given small vector.
+// \ingroup small_vector
+//
+// \param v The small vector to be cleared.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void clear( SmallVector<Type,N,TF,Alloc>& v )
+{
+   v.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given small vector is in default state.
+// \ingroup small_vector
+//
+// \param v The small vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+//
+// This function checks whether the small vector is in default (constructed) state, i.e. if
+// it's size is 0. In case it is in default state, the function returns \a true, else it will
+// return \a false. The following example demonstrates the use of the \a isDefault() function:
+
+   \code
+   blaze::SmallVector<int,8UL> a;
+   // ... Resizing and initialization
+   if( isDefault( a ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( a ) ) { ... }
+   \endcode
+*/
+template< bool RF           // Relaxation flag
+        , typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool isDefault( const SmallVector<Type,N,TF,Alloc>& v )
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given small vector are intact.
+// \ingroup small_vector
+//
+// \param v The small vector to be tested.
+// \return \a true in case the given vector's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the small vector are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::SmallVector<int,8UL> a;
+   // ... Resizing and initialization
+   if( isIntact( a ) ) { ... }
+   \endcode
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const SmallVector<Type,N,TF,Alloc>& v ) noexcept
+{
+   return v.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vectors.
+// \ingroup small_vector
+//
+// \param a The first vector to be swapped.
+// \param b The second vector to be swapped.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , size_t N          // Number of preallocated elements
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void swap( SmallVector<Type,N,TF,Alloc>& a, SmallVector<Type,N,TF,Alloc>& b )
+   noexcept( noexcept( a.swap( b ) ) )
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASCONSTDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t N, bool TF, typename A >
+struct HasConstDataAccess< SmallVector<T,N,TF,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASMUTABLEDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t N, bool TF, typename A >
+struct HasMutableDataAccess< SmallVector<T,N,TF,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t N, bool TF, typename A >
+struct IsAligned< SmallVector<T,N,TF,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCONTIGUOUS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t N, bool TF, typename A >
+struct IsContiguous< SmallVector<T,N,TF,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t N, bool TF, typename A >
+struct IsPadded< SmallVector<T,N,TF,A> >
+   : public BoolConstant<usePadding>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t N, bool TF, typename A >
+struct IsResizable< SmallVector<T,N,TF,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t N, bool TF, typename A >
+struct IsShrinkable< SmallVector<T,N,TF,A> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
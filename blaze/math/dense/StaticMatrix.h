@@ -97,6 +97,7 @@
 #include <blaze/math/typetraits/MaxSize.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/math/Uninitialized.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/StorageOrder.h>
@@ -114,6 +115,7 @@
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Memory.h>
@@ -295,6 +297,7 @@ class StaticMatrix
    //@{
    explicit inline           StaticMatrix();
    explicit inline           StaticMatrix( const Type& init );
+   explicit inline           StaticMatrix( Uninitialized );
             inline constexpr StaticMatrix( initializer_list< initializer_list<Type> > list );
 
    template< typename Other >
@@ -615,6 +618,37 @@ inline StaticMatrix<Type,M,N,SO>::StaticMatrix()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Explicitly uninitialized construction of a matrix.
+//
+// This constructor skips the initialization of the matrix elements independent of the
+// \a BLAZE_USE_DEFAULT_INITIALIZATION configuration switch. Only the padding elements are
+// reset. In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating
+// point elements are set to NaN in order to reveal accidental reads of uninitialized elements.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+inline StaticMatrix<Type,M,N,SO>::StaticMatrix( Uninitialized )
+   : v_()  // The statically allocated matrix elements
+{
+   BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || NN == N );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      poison( v_.data()+i*NN, v_.data()+i*NN+N );
+
+      if( IsNumeric_v<Type> && usePadding ) {
+         for( size_t j=N; j<NN; ++j )
+            v_[i*NN+j] = Type();
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Constructor for a homogenous initialization of all elements.
 //
@@ -871,6 +905,8 @@ template< typename MT    // Type of the foreign matrix
 inline StaticMatrix<Type,M,N,SO>::StaticMatrix( const Matrix<MT,SO2>& m )
    : v_()  // The statically allocated matrix elements
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || NN == N );
@@ -3219,6 +3255,7 @@ class StaticMatrix<Type,M,N,true>
    //@{
    explicit inline           StaticMatrix();
    explicit inline           StaticMatrix( const Type& init );
+   explicit inline           StaticMatrix( Uninitialized );
             inline constexpr StaticMatrix( initializer_list< initializer_list<Type> > list );
 
    template< typename Other >
@@ -3521,6 +3558,38 @@ inline StaticMatrix<Type,M,N,true>::StaticMatrix()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Explicitly uninitialized construction of a matrix.
+//
+// This constructor skips the initialization of the matrix elements independent of the
+// \a BLAZE_USE_DEFAULT_INITIALIZATION configuration switch. Only the padding elements are
+// reset. In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating
+// point elements are set to NaN in order to reveal accidental reads of uninitialized elements.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline StaticMatrix<Type,M,N,true>::StaticMatrix( Uninitialized )
+   : v_()  // The statically allocated matrix elements
+{
+   BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || MM == M );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      poison( v_.data()+j*MM, v_.data()+j*MM+M );
+
+      if( IsNumeric_v<Type> && usePadding ) {
+         for( size_t i=M; i<MM; ++i )
+            v_[i+j*MM] = Type();
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Constructor for a homogenous initialization of all elements.
@@ -3782,6 +3851,8 @@ template< typename MT    // Type of the foreign matrix
 inline StaticMatrix<Type,M,N,true>::StaticMatrix( const Matrix<MT,SO>& m )
    : v_()  // The statically allocated matrix elements
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || MM == M );
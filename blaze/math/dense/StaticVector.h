@@ -94,6 +94,7 @@
 #include <blaze/math/typetraits/MaxSize.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/typetraits/TransposeFlag.h>
+#include <blaze/math/Uninitialized.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/TransposeFlag.h>
@@ -109,6 +110,7 @@
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Memory.h>
@@ -270,6 +272,7 @@ class StaticVector
    //@{
    explicit inline           StaticVector();
    explicit inline           StaticVector( const Type& init );
+   explicit inline           StaticVector( Uninitialized );
             inline constexpr StaticVector( initializer_list<Type> list );
 
    template< typename Other >
@@ -576,6 +579,34 @@ inline StaticVector<Type,N,TF>::StaticVector()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Explicitly uninitialized construction of a vector.
+//
+// This constructor skips the initialization of the vector elements independent of the
+// \a BLAZE_USE_DEFAULT_INITIALIZATION configuration switch. Only the padding elements are
+// reset. In case the debug mode is active (see the BLAZE_USE_DEBUG_MODE switch), all floating
+// point elements are set to NaN in order to reveal accidental reads of uninitialized elements.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N       // Number of elements
+        , bool TF >      // Transpose flag
+inline StaticVector<Type,N,TF>::StaticVector( Uninitialized )
+   : v_()  // The statically allocated vector elements
+{
+   BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || NN == N );
+
+   poison( v_.data(), v_.data()+N );
+
+   if( IsNumeric_v<Type> && usePadding ) {
+      for( size_t i=N; i<NN; ++i )
+         v_[i] = Type();
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Constructor for a homogenous initialization of all elements.
 //
@@ -789,6 +820,8 @@ template< typename VT >  // Type of the foreign vector
 inline StaticVector<Type,N,TF>::StaticVector( const Vector<VT,TF>& v )
    : v_()  // The statically allocated vector elements
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    BLAZE_STATIC_ASSERT( IsVectorizable_v<Type> || NN == N );
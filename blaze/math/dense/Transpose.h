@@ -0,0 +1,716 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Transpose.h
+//  \brief Header file for the cache-oblivious dense matrix transposition kernels
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRANSPOSE_H_
+#define _BLAZE_MATH_DENSE_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TRANSPOSITION MICRO KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Edge length of the micro tiles of the transposition kernels.
+// \ingroup dense_matrix
+//
+// This variable template specifies the edge length of the square micro tiles, which are
+// transposed within registers by the dense transposition kernels. For numeric data types of
+// 4 or 8 bytes the edge length corresponds to the number of elements per AVX or SSE register.
+// For all other data types the edge length is 1, i.e. all elements are transposed individually.
+*/
+template< typename T >  // Data type of the elements
+constexpr size_t TransposeTileSize_v =
+   ( !IsNumeric_v<T> ? 1UL
+   : sizeof(T) == 8UL ? ( BLAZE_AVX_MODE ? 4UL : BLAZE_SSE2_MODE ? 2UL : 1UL )
+   : sizeof(T) == 4UL ? ( BLAZE_AVX_MODE ? 8UL : BLAZE_SSE_MODE  ? 4UL : 1UL )
+   : 1UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a single element (\f$ dst = src^T \f$).
+// \ingroup dense_matrix
+//
+// \param src Pointer to the source element.
+// \param ss The spacing between two rows of the source matrix.
+// \param dst Pointer to the target element.
+// \param ds The spacing between two rows of the target matrix.
+// \return void
+*/
+template< typename T >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTile( const T* src, size_t ss, T* dst, size_t ds )
+   -> EnableIf_t< TransposeTileSize_v<T> == 1UL >
+{
+   MAYBE_UNUSED( ss, ds );
+
+   *dst = *src;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_AVX_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX transposition of a 4x4 tile of 8-byte elements (\f$ dst = src^T \f$).
+// \ingroup dense_matrix
+//
+// \param src Pointer to the first element of the source tile.
+// \param ss The spacing between two rows of the source matrix.
+// \param dst Pointer to the first element of the target tile.
+// \param ds The spacing between two rows of the target matrix.
+// \return void
+*/
+template< typename T >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTile( const T* src, size_t ss, T* dst, size_t ds )
+   -> EnableIf_t< TransposeTileSize_v<T> == 4UL && sizeof(T) == 8UL >
+{
+   const double* s( reinterpret_cast<const double*>( src ) );
+   double*       d( reinterpret_cast<double*>( dst ) );
+
+   const __m256d r0( _mm256_loadu_pd( s         ) );
+   const __m256d r1( _mm256_loadu_pd( s +     ss ) );
+   const __m256d r2( _mm256_loadu_pd( s + 2UL*ss ) );
+   const __m256d r3( _mm256_loadu_pd( s + 3UL*ss ) );
+
+   const __m256d t0( _mm256_unpacklo_pd( r0, r1 ) );
+   const __m256d t1( _mm256_unpackhi_pd( r0, r1 ) );
+   const __m256d t2( _mm256_unpacklo_pd( r2, r3 ) );
+   const __m256d t3( _mm256_unpackhi_pd( r2, r3 ) );
+
+   _mm256_storeu_pd( d         , _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+   _mm256_storeu_pd( d +     ds, _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+   _mm256_storeu_pd( d + 2UL*ds, _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+   _mm256_storeu_pd( d + 3UL*ds, _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX transposition of an 8x8 tile of 4-byte elements (\f$ dst = src^T \f$).
+// \ingroup dense_matrix
+//
+// \param src Pointer to the first element of the source tile.
+// \param ss The spacing between two rows of the source matrix.
+// \param dst Pointer to the first element of the target tile.
+// \param ds The spacing between two rows of the target matrix.
+// \return void
+*/
+template< typename T >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTile( const T* src, size_t ss, T* dst, size_t ds )
+   -> EnableIf_t< TransposeTileSize_v<T> == 8UL && sizeof(T) == 4UL >
+{
+   const float* s( reinterpret_cast<const float*>( src ) );
+   float*       d( reinterpret_cast<float*>( dst ) );
+
+   const __m256 r0( _mm256_loadu_ps( s         ) );
+   const __m256 r1( _mm256_loadu_ps( s +     ss ) );
+   const __m256 r2( _mm256_loadu_ps( s + 2UL*ss ) );
+   const __m256 r3( _mm256_loadu_ps( s + 3UL*ss ) );
+   const __m256 r4( _mm256_loadu_ps( s + 4UL*ss ) );
+   const __m256 r5( _mm256_loadu_ps( s + 5UL*ss ) );
+   const __m256 r6( _mm256_loadu_ps( s + 6UL*ss ) );
+   const __m256 r7( _mm256_loadu_ps( s + 7UL*ss ) );
+
+   const __m256 t0( _mm256_unpacklo_ps( r0, r1 ) );
+   const __m256 t1( _mm256_unpackhi_ps( r0, r1 ) );
+   const __m256 t2( _mm256_unpacklo_ps( r2, r3 ) );
+   const __m256 t3( _mm256_unpackhi_ps( r2, r3 ) );
+   const __m256 t4( _mm256_unpacklo_ps( r4, r5 ) );
+   const __m256 t5( _mm256_unpackhi_ps( r4, r5 ) );
+   const __m256 t6( _mm256_unpacklo_ps( r6, r7 ) );
+   const __m256 t7( _mm256_unpackhi_ps( r6, r7 ) );
+
+   const __m256 u0( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 u1( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 u2( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 u3( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 u4( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 u5( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 u6( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 u7( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+
+   _mm256_storeu_ps( d         , _mm256_permute2f128_ps( u0, u4, 0x20 ) );
+   _mm256_storeu_ps( d +     ds, _mm256_permute2f128_ps( u1, u5, 0x20 ) );
+   _mm256_storeu_ps( d + 2UL*ds, _mm256_permute2f128_ps( u2, u6, 0x20 ) );
+   _mm256_storeu_ps( d + 3UL*ds, _mm256_permute2f128_ps( u3, u7, 0x20 ) );
+   _mm256_storeu_ps( d + 4UL*ds, _mm256_permute2f128_ps( u0, u4, 0x31 ) );
+   _mm256_storeu_ps( d + 5UL*ds, _mm256_permute2f128_ps( u1, u5, 0x31 ) );
+   _mm256_storeu_ps( d + 6UL*ds, _mm256_permute2f128_ps( u2, u6, 0x31 ) );
+   _mm256_storeu_ps( d + 7UL*ds, _mm256_permute2f128_ps( u3, u7, 0x31 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+#elif BLAZE_SSE2_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SSE2 transposition of a 2x2 tile of 8-byte elements (\f$ dst = src^T \f$).
+// \ingroup dense_matrix
+//
+// \param src Pointer to the first element of the source tile.
+// \param ss The spacing between two rows of the source matrix.
+// \param dst Pointer to the first element of the target tile.
+// \param ds The spacing between two rows of the target matrix.
+// \return void
+*/
+template< typename T >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTile( const T* src, size_t ss, T* dst, size_t ds )
+   -> EnableIf_t< TransposeTileSize_v<T> == 2UL && sizeof(T) == 8UL >
+{
+   const double* s( reinterpret_cast<const double*>( src ) );
+   double*       d( reinterpret_cast<double*>( dst ) );
+
+   const __m128d r0( _mm_loadu_pd( s      ) );
+   const __m128d r1( _mm_loadu_pd( s + ss ) );
+
+   _mm_storeu_pd( d     , _mm_unpacklo_pd( r0, r1 ) );
+   _mm_storeu_pd( d + ds, _mm_unpackhi_pd( r0, r1 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SSE transposition of a 4x4 tile of 4-byte elements (\f$ dst = src^T \f$).
+// \ingroup dense_matrix
+//
+// \param src Pointer to the first element of the source tile.
+// \param ss The spacing between two rows of the source matrix.
+// \param dst Pointer to the first element of the target tile.
+// \param ds The spacing between two rows of the target matrix.
+// \return void
+*/
+template< typename T >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTile( const T* src, size_t ss, T* dst, size_t ds )
+   -> EnableIf_t< TransposeTileSize_v<T> == 4UL && sizeof(T) == 4UL >
+{
+   const float* s( reinterpret_cast<const float*>( src ) );
+   float*       d( reinterpret_cast<float*>( dst ) );
+
+   __m128 r0( _mm_loadu_ps( s         ) );
+   __m128 r1( _mm_loadu_ps( s +     ss ) );
+   __m128 r2( _mm_loadu_ps( s + 2UL*ss ) );
+   __m128 r3( _mm_loadu_ps( s + 3UL*ss ) );
+
+   _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+   _mm_storeu_ps( d         , r0 );
+   _mm_storeu_ps( d +     ds, r1 );
+   _mm_storeu_ps( d + 2UL*ds, r2 );
+   _mm_storeu_ps( d + 3UL*ds, r3 );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swap of two elements in the context of a transposition.
+// \ingroup dense_matrix
+//
+// \param a The first element to be swapped.
+// \param b The second element to be swapped.
+// \return void
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeSwap( T& a, T& b )
+   -> DisableIf_t< Conj >
+{
+   using std::swap;
+
+   swap( a, b );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swap and conjugation of two elements in the context of a conjugate transposition.
+// \ingroup dense_matrix
+//
+// \param a The first element to be swapped and conjugated.
+// \param b The second element to be swapped and conjugated.
+// \return void
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeSwap( T& a, T& b )
+   -> EnableIf_t< Conj >
+{
+   cswap( a, b );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Treatment of a diagonal element in the context of a transposition.
+// \ingroup dense_matrix
+//
+// \param a The diagonal element.
+// \return void
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeDiagonal( T& a )
+   -> DisableIf_t< Conj >
+{
+   MAYBE_UNUSED( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Treatment of a diagonal element in the context of a conjugate transposition.
+// \ingroup dense_matrix
+//
+// \param a The diagonal element to be conjugated.
+// \return void
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeDiagonal( T& a )
+   -> EnableIf_t< Conj >
+{
+   conjugate( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swap of two micro tiles in the context of an in-place transposition (\f$ a \leftrightarrow b^T \f$).
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the first tile.
+// \param b Pointer to the first element of the second tile.
+// \param s The spacing between two rows of the matrix.
+// \return void
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTileSwap( T* a, T* b, size_t s )
+   -> EnableIf_t< TransposeTileSize_v<T> == 1UL >
+{
+   MAYBE_UNUSED( s );
+
+   transposeSwap<Conj>( *a, *b );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swap of two micro tiles in the context of an in-place transposition (\f$ a \leftrightarrow b^T \f$).
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the first tile.
+// \param b Pointer to the first element of the second tile.
+// \param s The spacing between two rows of the matrix.
+// \return void
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTileSwap( T* a, T* b, size_t s )
+   -> EnableIf_t< ( TransposeTileSize_v<T> > 1UL ) >
+{
+   constexpr size_t TILE( TransposeTileSize_v<T> );
+
+   T tmp[TILE*TILE];
+
+   transposeTile( b, s, tmp, TILE );
+   transposeTile( a, s, b, s );
+
+   for( size_t i=0UL; i<TILE; ++i ) {
+      for( size_t j=0UL; j<TILE; ++j ) {
+         a[i*s+j] = tmp[i*TILE+j];
+         transposeDiagonal<Conj>( a[i*s+j] );
+         transposeDiagonal<Conj>( b[i*s+j] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a single micro tile on the diagonal (\f$ a = a^T \f$).
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the tile.
+// \param s The spacing between two rows of the matrix.
+// \return void
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTileInplace( T* a, size_t s )
+   -> EnableIf_t< TransposeTileSize_v<T> == 1UL >
+{
+   MAYBE_UNUSED( s );
+
+   transposeDiagonal<Conj>( *a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a single micro tile on the diagonal (\f$ a = a^T \f$).
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the tile.
+// \param s The spacing between two rows of the matrix.
+// \return void
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+BLAZE_ALWAYS_INLINE auto transposeTileInplace( T* a, size_t s )
+   -> EnableIf_t< ( TransposeTileSize_v<T> > 1UL ) >
+{
+   constexpr size_t TILE( TransposeTileSize_v<T> );
+
+   T tmp[TILE*TILE];
+
+   transposeTile( a, s, tmp, TILE );
+
+   for( size_t i=0UL; i<TILE; ++i ) {
+      for( size_t j=0UL; j<TILE; ++j ) {
+         a[i*s+j] = tmp[i*TILE+j];
+         transposeDiagonal<Conj>( a[i*s+j] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CACHE-OBLIVIOUS TRANSPOSITION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the split point of a recursive transposition kernel.
+// \ingroup dense_matrix
+//
+// \param n The extent of the dimension to be split.
+// \return The extent of the first part of the split dimension.
+//
+// This function splits the given extent into two halves, where the first half is rounded up
+// to a multiple of the edge length of the micro tiles. The given extent is required to be
+// larger than the edge length of the micro tiles.
+*/
+template< size_t TILE >  // Edge length of the micro tiles
+constexpr size_t transposeSplit( size_t n ) noexcept
+{
+   return ( ( n/2UL + TILE - 1UL ) / TILE ) * TILE;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-oblivious out-of-place transposition of a dense block (\f$ dst = src^T \f$).
+// \ingroup dense_matrix
+//
+// \param src Pointer to the first element of the \f$ n \times m \f$ source block.
+// \param ss The spacing between two rows of the source block.
+// \param dst Pointer to the first element of the \f$ m \times n \f$ target block.
+// \param ds The spacing between two rows of the target block.
+// \param m The number of rows of the target block.
+// \param n The number of columns of the target block.
+// \return void
+//
+// This function recursively halves the larger dimension of the given block until the block
+// fits into a single cache block (see the TRANSPOSE_BLOCK_SIZE setting) and subsequently
+// transposes the block tile by tile by means of the SIMD micro kernels. Due to the recursive
+// subdivision the kernel runs close to the memory bandwidth for all cache levels without the
+// need to tune any blocking factor. The source and the target block must not overlap. Both
+// blocks can be interpreted as column-major blocks with swapped roles of rows and columns.
+*/
+template< typename T >  // Data type of the elements
+void transposeKernel( const T* src, size_t ss, T* dst, size_t ds, size_t m, size_t n )
+{
+   constexpr size_t TILE ( TransposeTileSize_v<T> );
+   constexpr size_t BLOCK( TRANSPOSE_BLOCK_SIZE );
+
+   if( m > BLOCK || n > BLOCK )
+   {
+      if( m >= n ) {
+         const size_t m1( transposeSplit<TILE>( m ) );
+         transposeKernel( src, ss, dst, ds, m1, n );
+         transposeKernel( src+m1, ss, dst+m1*ds, ds, m-m1, n );
+      }
+      else {
+         const size_t n1( transposeSplit<TILE>( n ) );
+         transposeKernel( src, ss, dst, ds, m, n1 );
+         transposeKernel( src+n1*ss, ss, dst+n1, ds, m, n-n1 );
+      }
+      return;
+   }
+
+   const size_t ipos( m - m % TILE );
+   const size_t jpos( n - n % TILE );
+
+   for( size_t i=0UL; i<ipos; i+=TILE ) {
+      for( size_t j=0UL; j<jpos; j+=TILE ) {
+         transposeTile( src+j*ss+i, ss, dst+i*ds+j, ds );
+      }
+      for( size_t k=i; k<i+TILE; ++k ) {
+         for( size_t j=jpos; j<n; ++j ) {
+            dst[k*ds+j] = src[j*ss+k];
+         }
+      }
+   }
+
+   for( size_t i=ipos; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         dst[i*ds+j] = src[j*ss+i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-oblivious transposed swap of two dense blocks (\f$ a \leftrightarrow b^T \f$).
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the \f$ m \times n \f$ block.
+// \param b Pointer to the first element of the \f$ n \times m \f$ block.
+// \param s The spacing between two rows of both blocks.
+// \return void
+//
+// This function swaps the first block with the transpose of the second block (and conjugates
+// all swapped elements in case \a Conj is set to \a true). The two blocks must not overlap.
+// This kernel represents the building block of all in-place transpositions of square matrices.
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+void transposeSwapKernel( T* a, T* b, size_t s, size_t m, size_t n )
+{
+   constexpr size_t TILE ( TransposeTileSize_v<T> );
+   constexpr size_t BLOCK( TRANSPOSE_BLOCK_SIZE );
+
+   if( m > BLOCK || n > BLOCK )
+   {
+      if( m >= n ) {
+         const size_t m1( transposeSplit<TILE>( m ) );
+         transposeSwapKernel<Conj>( a, b, s, m1, n );
+         transposeSwapKernel<Conj>( a+m1*s, b+m1, s, m-m1, n );
+      }
+      else {
+         const size_t n1( transposeSplit<TILE>( n ) );
+         transposeSwapKernel<Conj>( a, b, s, m, n1 );
+         transposeSwapKernel<Conj>( a+n1, b+n1*s, s, m, n-n1 );
+      }
+      return;
+   }
+
+   const size_t ipos( m - m % TILE );
+   const size_t jpos( n - n % TILE );
+
+   for( size_t i=0UL; i<ipos; i+=TILE ) {
+      for( size_t j=0UL; j<jpos; j+=TILE ) {
+         transposeTileSwap<Conj>( a+i*s+j, b+j*s+i, s );
+      }
+      for( size_t k=i; k<i+TILE; ++k ) {
+         for( size_t j=jpos; j<n; ++j ) {
+            transposeSwap<Conj>( a[k*s+j], b[j*s+k] );
+         }
+      }
+   }
+
+   for( size_t i=ipos; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         transposeSwap<Conj>( a[i*s+j], b[j*s+i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-oblivious in-place transposition of a square dense block (\f$ a = a^T \f$).
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the \f$ n \times n \f$ block.
+// \param s The spacing between two rows of the block.
+// \param n The number of rows and columns of the block.
+// \return void
+//
+// This function transposes the given square block in-place (and conjugates all elements in
+// case \a Conj is set to \a true). The block is recursively split into two diagonal blocks,
+// which are transposed in-place, and two off-diagonal blocks, which are swapped by means of
+// the transposeSwapKernel() function.
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+void transposeSquareKernel( T* a, size_t s, size_t n )
+{
+   constexpr size_t TILE ( TransposeTileSize_v<T> );
+   constexpr size_t BLOCK( TRANSPOSE_BLOCK_SIZE );
+
+   if( n > BLOCK )
+   {
+      const size_t n1( transposeSplit<TILE>( n ) );
+      transposeSquareKernel<Conj>( a, s, n1 );
+      transposeSquareKernel<Conj>( a+n1*s+n1, s, n-n1 );
+      transposeSwapKernel<Conj>( a+n1*s, a+n1, s, n-n1, n1 );
+      return;
+   }
+
+   const size_t ipos( n - n % TILE );
+
+   for( size_t i=0UL; i<ipos; i+=TILE ) {
+      for( size_t j=0UL; j<i; j+=TILE ) {
+         transposeTileSwap<Conj>( a+i*s+j, a+j*s+i, s );
+      }
+      transposeTileInplace<Conj>( a+i*s+i, s );
+   }
+
+   for( size_t i=ipos; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         transposeSwap<Conj>( a[i*s+j], a[j*s+i] );
+      }
+      transposeDiagonal<Conj>( a[i*s+i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a rectangular dense block without padding (\f$ a = a^T \f$).
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the \f$ m \times n \f$ block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \return void
+//
+// This function transposes the given contiguously stored \f$ m \times n \f$ block in-place into
+// a contiguously stored \f$ n \times m \f$ block (and conjugates all elements in case \a Conj is
+// set to \a true). The elements are moved along the cycles of the transposition permutation,
+// which requires a single bit of additional memory per element instead of a second block. Note
+// that this bitmap is allocated on every call and that the cycles are followed single-threaded.
+*/
+template< bool Conj       // Conjugation flag
+        , typename T >    // Data type of the elements
+void transposeCycleKernel( T* a, size_t m, size_t n )
+{
+   const size_t size( m*n );
+
+   std::vector<bool> visited( size, false );
+
+   for( size_t start=1UL; start+1UL<size; ++start )
+   {
+      if( visited[start] )
+         continue;
+
+      T tmp( std::move( a[start] ) );
+      size_t current( start );
+      size_t next( ( start % m ) * n + start / m );
+
+      while( next != start ) {
+         a[current] = std::move( a[next] );
+         visited[current] = true;
+         current = next;
+         next = ( current % m ) * n + current / m;
+      }
+
+      a[current] = std::move( tmp );
+      visited[current] = true;
+   }
+
+   if( Conj ) {
+      for( size_t i=0UL; i<size; ++i ) {
+         transposeDiagonal<Conj>( a[i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
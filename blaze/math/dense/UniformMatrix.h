@@ -53,6 +53,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -1304,7 +1305,7 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline bool UniformMatrix<Type,SO>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 //*************************************************************************************************
 
@@ -50,6 +50,7 @@
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/BandTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -1072,7 +1073,7 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline bool UniformVector<Type,TF>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 //*************************************************************************************************
 
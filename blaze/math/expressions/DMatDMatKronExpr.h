@@ -62,6 +62,7 @@
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/MaybeUnused.h>
@@ -449,7 +450,7 @@ class DMatDMatKronExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
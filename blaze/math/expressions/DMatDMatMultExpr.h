@@ -69,6 +69,7 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/DeclDiagTrait.h>
 #include <blaze/math/traits/DeclHermTrait.h>
 #include <blaze/math/traits/DeclLowTrait.h>
@@ -99,6 +100,7 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Blocking.h>
@@ -298,10 +300,10 @@ class DMatDMatMultExpr
    using RightOperand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = If_t< evaluateLeft, const RT1, CT1 >;
+   using LT = If_t< evaluateLeft, const TemporaryType_t<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   using RT = If_t< evaluateRight, const TemporaryType_t<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -487,7 +489,7 @@ class DMatDMatMultExpr
                !BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( rows() * columns() < DMATDMATMULT_THRESHOLD ) ) &&
-             ( rows() * columns() >= SMP_DMATDMATMULT_THRESHOLD ) &&
+             ( rows() * columns() >= smpThreshold( SMP_DMATDMATMULT ) ) &&
              !IsDiagonal_v<MT1> && !IsDiagonal_v<MT2>;
    }
    //**********************************************************************************************
@@ -1729,7 +1731,7 @@ class DMatDMatMultExpr
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, fwd( tmp ) );
    }
    /*! \endcond */
@@ -4231,7 +4233,7 @@ class DMatDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -4333,7 +4335,7 @@ class DMatDMatMultExpr
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( rhs );
+      const TemporaryType_t<TmpType> tmp( rhs );
       smpAssign( ~lhs, fwd( tmp ) );
    }
    /*! \endcond */
@@ -4577,7 +4579,7 @@ class DMatDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -4777,10 +4779,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    using RightOperand = ST;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = If_t< evaluateLeft, const RT1, CT1 >;
+   using LT = If_t< evaluateLeft, const TemporaryType_t<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   using RT = If_t< evaluateRight, const TemporaryType_t<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -4931,7 +4933,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
                !BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( rows() * columns() < DMATDMATMULT_THRESHOLD ) ) &&
-             ( rows() * columns() >= SMP_DMATDMATMULT_THRESHOLD );
+             ( rows() * columns() >= smpThreshold( SMP_DMATDMATMULT ) );
    }
    //**********************************************************************************************
 
@@ -6195,7 +6197,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, fwd( tmp ) );
    }
    //**********************************************************************************************
@@ -6329,7 +6331,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< !IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      const ResultType tmp( serial( A * B * scalar ) );
+      const TemporaryType_t<ResultType> tmp( serial( A * B * scalar ) );
       addAssign( C, tmp );
    }
    //**********************************************************************************************
@@ -7442,7 +7444,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< !IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      const ResultType tmp( serial( A * B * scalar ) );
+      const TemporaryType_t<ResultType> tmp( serial( A * B * scalar ) );
       subAssign( C, tmp );
    }
    //**********************************************************************************************
@@ -8490,7 +8492,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -8593,7 +8595,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( rhs );
+      const TemporaryType_t<TmpType> tmp( rhs );
       smpAssign( ~lhs, fwd( tmp ) );
    }
    //**********************************************************************************************
@@ -8840,7 +8842,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -56,6 +56,7 @@
 #include <blaze/math/expressions/SchurExpr.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/sparse/Forward.h>
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
@@ -72,6 +73,7 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/system/HostDevice.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Thresholds.h>
@@ -618,7 +620,7 @@ class DMatDMatSchurExpr
    */
    inline bool canSMPAssign() const noexcept {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( rows() * columns() >= SMP_DMATDMATSCHUR_THRESHOLD );
+             ( rows() * columns() >= smpThreshold( SMP_DMATDMATSCHUR ) );
    }
    //**********************************************************************************************
 
@@ -740,7 +742,7 @@ class DMatDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -774,7 +776,7 @@ class DMatDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -812,7 +814,7 @@ class DMatDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -851,7 +853,7 @@ class DMatDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1019,7 +1021,7 @@ class DMatDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( rhs );
+      const TemporaryType_t<TmpType> tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1053,7 +1055,7 @@ class DMatDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpAddAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1092,7 +1094,7 @@ class DMatDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSubAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1131,7 +1133,7 @@ class DMatDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
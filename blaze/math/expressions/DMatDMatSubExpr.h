@@ -54,6 +54,7 @@
 #include <blaze/math/expressions/MatMatSubExpr.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/SubTrait.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsAligned.h>
@@ -62,6 +63,7 @@
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/system/HostDevice.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Thresholds.h>
@@ -606,7 +608,7 @@ class DMatDMatSubExpr
    */
    inline bool canSMPAssign() const noexcept {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( rows() * columns() >= SMP_DMATDMATSUB_THRESHOLD );
+             ( rows() * columns() >= smpThreshold( SMP_DMATDMATSUB ) );
    }
    //**********************************************************************************************
 
@@ -689,7 +691,7 @@ class DMatDMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -803,7 +805,7 @@ class DMatDMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -894,7 +896,7 @@ class DMatDMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( rhs );
+      const TemporaryType_t<TmpType> tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1009,7 +1011,7 @@ class DMatDMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -60,6 +60,7 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
@@ -79,6 +80,7 @@
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Optimizations.h>
@@ -213,10 +215,10 @@ class DMatDVecMultExpr
    using RightOperand = If_t< IsExpression_v<VT>, const VT, const VT& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = If_t< evaluateMatrix, const MRT, MCT >;
+   using LT = If_t< evaluateMatrix, const TemporaryType_t<MRT>, MCT >;
 
    //! Type for the assignment of the right-hand side dense vector operand.
-   using RT = If_t< evaluateVector, const VRT, VCT >;
+   using RT = If_t< evaluateVector, const TemporaryType_t<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -374,7 +376,7 @@ class DMatDVecMultExpr
                !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation_v<MT> && !evaluateMatrix ) ||
                ( mat_.rows() * mat_.columns() < DMATDVECMULT_THRESHOLD ) ) &&
-             ( size() > SMP_DMATDVECMULT_THRESHOLD );
+             ( size() > smpThreshold( SMP_DMATDVECMULT ) );
    }
    //**********************************************************************************************
 
@@ -1065,7 +1067,7 @@ class DMatDVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -2407,7 +2409,7 @@ class DMatDVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -2441,7 +2443,7 @@ class DMatDVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -2522,7 +2524,7 @@ class DMatDVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -2643,7 +2645,7 @@ class DMatDVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -2680,7 +2682,7 @@ class DMatDVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpDivAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -2815,10 +2817,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    using RightOperand = ST;
 
    //! Type for the assignment of the dense matrix operand of the left-hand side expression.
-   using LT = If_t< evaluateMatrix, const MRT, MCT >;
+   using LT = If_t< evaluateMatrix, const TemporaryType_t<MRT>, MCT >;
 
    //! Type for the assignment of the dense vector operand of the left-hand side expression.
-   using RT = If_t< evaluateVector, const VRT, VCT >;
+   using RT = If_t< evaluateVector, const TemporaryType_t<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -2955,7 +2957,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
                !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation_v<MT> && !evaluateMatrix ) ||
                ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) &&
-             ( size() > SMP_DMATDVECMULT_THRESHOLD );
+             ( size() > smpThreshold( SMP_DMATDVECMULT ) );
    }
    //**********************************************************************************************
 
@@ -3666,7 +3668,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -5008,7 +5010,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -5040,7 +5042,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -5120,7 +5122,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -5241,7 +5243,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -5276,7 +5278,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpDivAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
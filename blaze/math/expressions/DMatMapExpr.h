@@ -67,6 +67,7 @@
 #include <blaze/math/typetraits/IsPaddingEnabled.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/typetraits/UnderlyingNumeric.h>
 #include <blaze/system/HostDevice.h>
@@ -659,7 +660,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );
       assign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -698,7 +699,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( serial( rhs.dm_ ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs.dm_ ) );
       assign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -732,7 +733,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );
       addAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -770,7 +771,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );
       subAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -808,7 +809,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );
       schurAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -888,7 +889,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );
+      const TemporaryType_t<RT> tmp( rhs.dm_ );
       smpAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -927,7 +928,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( rhs.dm_ );
+      const TemporaryType_t<TmpType> tmp( rhs.dm_ );
       smpAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -961,7 +962,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );
+      const TemporaryType_t<RT> tmp( rhs.dm_ );
       smpAddAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -999,7 +1000,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );
+      const TemporaryType_t<RT> tmp( rhs.dm_ );
       smpSubAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1037,7 +1038,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );
+      const TemporaryType_t<RT> tmp( rhs.dm_ );
       smpSchurAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -62,6 +63,8 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -69,6 +72,7 @@
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
@@ -78,6 +82,7 @@
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -435,6 +440,10 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
    // ... Resizing and initialization
    const double l2 = norm( A, blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the number of elements of the dense matrix is larger or equal to the
+// BLAZE_SMP_DMATNORM_THRESHOLD, the norm is computed in parallel. The partial sums of all
+// threads are combined in a fixed order before the root operation is applied.
 */
 template< typename MT      // Type of the dense matrix
         , bool SO          // Storage order
@@ -443,7 +452,22 @@ template< typename MT      // Type of the dense matrix
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseMatrix<MT,SO>& dm, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dm, abs, power, root, Bool_t< DMatNormHelper<MT,Abs,Power>::value >() );
+   waitForAsyncAssignments( ~dm );
+
+   using CT = CompositeType_t<MT>;
+
+   if( (~dm).rows() * (~dm).columns() < smpThreshold( SMP_DMATNORM ) )
+      return norm_backend( ~dm, abs, power, root, Bool_t< DMatNormHelper<MT,Abs,Power>::value >() );
+
+   CT tmp( ~dm );
+
+   const auto norm = smpReduce( tmp, [abs,power]( const auto& block ) {
+      using BlockType = RemoveCV_t< RemoveReference_t< decltype( block ) > >;
+      return norm_backend( block, abs, power, Noop(),
+                           Bool_t< DMatNormHelper<BlockType,Abs,Power>::value >() );
+   }, Add() );
+
+   return evaluate( root( norm ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -62,6 +62,8 @@
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -69,6 +71,7 @@
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/IsUniform.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/HostDevice.h>
 #include <blaze/system/Thresholds.h>
@@ -81,6 +84,7 @@
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -282,7 +286,7 @@ class DMatReduceExpr<MT,OP,columnwise>
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return dm_.canSMPAssign() || ( size() > SMP_DMATREDUCE_THRESHOLD );
+      return dm_.canSMPAssign() || ( size() > smpThreshold( SMP_DMATREDUCE ) );
    }
    //**********************************************************************************************
 
@@ -351,7 +355,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -388,7 +392,7 @@ class DMatReduceExpr<MT,OP,columnwise>
          }
       }
       else {
-         const ResultType tmp( serial( rhs ) );
+         const TemporaryType_t<ResultType> tmp( serial( rhs ) );
          addAssign( ~lhs, tmp );
       }
    }
@@ -419,7 +423,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -456,7 +460,7 @@ class DMatReduceExpr<MT,OP,columnwise>
          }
       }
       else {
-         const ResultType tmp( serial( rhs ) );
+         const TemporaryType_t<ResultType> tmp( serial( rhs ) );
          subAssign( ~lhs, tmp );
       }
    }
@@ -487,7 +491,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -524,7 +528,7 @@ class DMatReduceExpr<MT,OP,columnwise>
          }
       }
       else {
-         const ResultType tmp( serial( rhs ) );
+         const TemporaryType_t<ResultType> tmp( serial( rhs ) );
          multAssign( ~lhs, tmp );
       }
    }
@@ -555,7 +559,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -585,7 +589,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -613,7 +617,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -642,7 +646,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpAddAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -671,7 +675,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpSubAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -700,7 +704,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpMultAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -729,7 +733,7 @@ class DMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpDivAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1191,7 +1195,7 @@ class DMatReduceExpr<MT,OP,rowwise>
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return dm_.canSMPAssign() || ( size() > SMP_DMATREDUCE_THRESHOLD );
+      return dm_.canSMPAssign() || ( size() > smpThreshold( SMP_DMATREDUCE ) );
    }
    //**********************************************************************************************
 
@@ -1223,7 +1227,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
       assign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1251,7 +1255,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
       addAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1280,7 +1284,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
       subAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1309,7 +1313,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
       multAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1337,7 +1341,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
       divAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1365,7 +1369,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1394,7 +1398,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpAddAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1423,7 +1427,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpSubAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1452,7 +1456,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpMultAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1481,7 +1485,7 @@ class DMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      const TemporaryType_t<RT> tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
       smpDivAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1519,7 +1523,7 @@ struct DMatReduceExprHelper
    using CT = RemoveReference_t< CompositeType_t<MT> >;
 
    //! Element type of the dense matrix expression.
-   using ET = ElementType_t<CT>;
+   using ET = RemoveCV_t< ElementType_t<CT> >;
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -1559,7 +1563,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
    -> DisableIf_t< DMatReduceExprHelper<MT,OP>::value, ElementType_t<MT> >
 {
    using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
+   using ET = RemoveCV_t< ElementType_t<MT> >;
 
    const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
@@ -1634,7 +1638,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
    -> EnableIf_t< DMatReduceExprHelper<MT,OP>::value, ElementType_t<MT> >
 {
    using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
+   using ET = RemoveCV_t< ElementType_t<MT> >;
 
    const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
@@ -1815,7 +1819,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
    -> EnableIf_t< DMatReduceExprHelper<MT,Add>::value, ElementType_t<MT> >
 {
    using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
+   using ET = RemoveCV_t< ElementType_t<MT> >;
 
    const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
@@ -2010,6 +2014,11 @@ inline ElementType_t<MT> dmatreduce( const DenseMatrix<MT,true>& dm, OP op )
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
+//
+// In case the number of elements of the dense matrix is larger or equal to the
+// BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD, the reduction is executed in parallel (see
+// \ref shared_memory_parallelization). The partial results of all threads are combined in a
+// fixed order and therefore the result is deterministic for a given number of threads.
 */
 template< typename MT    // Type of the dense matrix
         , bool SO        // Storage order
@@ -2018,7 +2027,16 @@ inline decltype(auto) reduce( const DenseMatrix<MT,SO>& dm, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dmatreduce( ~dm, op );
+   waitForAsyncAssignments( ~dm );
+
+   using CT = CompositeType_t<MT>;
+
+   if( IsUniform_v<MT> || (~dm).rows() * (~dm).columns() < smpThreshold( SMP_DMATTOTALREDUCE ) )
+      return dmatreduce( ~dm, op );
+
+   CT tmp( ~dm );
+
+   return smpReduce( tmp, [op]( const auto& block ) { return dmatreduce( block, op ); }, op );
 }
 //*************************************************************************************************
 
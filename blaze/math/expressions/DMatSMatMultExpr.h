@@ -65,6 +65,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/DeclDiagTrait.h>
 #include <blaze/math/traits/DeclHermTrait.h>
 #include <blaze/math/traits/DeclLowTrait.h>
@@ -86,6 +87,7 @@
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
@@ -253,10 +255,10 @@ class DMatSMatMultExpr
    using RightOperand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = If_t< evaluateLeft, const RT1, CT1 >;
+   using LT = If_t< evaluateLeft, const TemporaryType_t<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side sparse matrix operand.
-   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   using RT = If_t< evaluateRight, const TemporaryType_t<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -429,7 +431,7 @@ class DMatSMatMultExpr
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( rows() * columns() >= SMP_DMATSMATMULT_THRESHOLD ) && !IsDiagonal_v<MT1>;
+      return ( rows() * columns() >= smpThreshold( SMP_DMATSMATMULT ) ) && !IsDiagonal_v<MT1>;
    }
    //**********************************************************************************************
 
@@ -753,7 +755,7 @@ class DMatSMatMultExpr
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, fwd( tmp ) );
    }
    /*! \endcond */
@@ -1218,7 +1220,7 @@ class DMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1312,7 +1314,7 @@ class DMatSMatMultExpr
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( rhs );
+      const TemporaryType_t<TmpType> tmp( rhs );
       smpAssign( ~lhs, fwd( tmp ) );
    }
    /*! \endcond */
@@ -1550,7 +1552,7 @@ class DMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -60,6 +60,7 @@
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -72,6 +73,7 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -171,10 +173,10 @@ class DMatSVecMultExpr
    using RightOperand = If_t< IsExpression_v<VT>, const VT, const VT& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = If_t< evaluateMatrix, const MRT, MCT >;
+   using LT = If_t< evaluateMatrix, const TemporaryType_t<MRT>, MCT >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = If_t< evaluateVector, const VRT, VCT >;
+   using RT = If_t< evaluateVector, const TemporaryType_t<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -318,7 +320,7 @@ class DMatSVecMultExpr
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( size() > SMP_DMATSVECMULT_THRESHOLD );
+      return ( size() > smpThreshold( SMP_DMATSVECMULT ) );
    }
    //**********************************************************************************************
 
@@ -402,7 +404,7 @@ class DMatSVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -530,7 +532,7 @@ class DMatSVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -568,7 +570,7 @@ class DMatSVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -650,7 +652,7 @@ class DMatSVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -775,7 +777,7 @@ class DMatSVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -812,7 +814,7 @@ class DMatSVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpDivAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -48,6 +48,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatSerialExpr.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/util/Assert.h>
@@ -518,6 +519,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -544,6 +547,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -571,6 +576,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -598,6 +605,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -625,6 +634,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -652,6 +663,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -679,6 +692,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -706,6 +721,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -733,6 +750,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -760,6 +779,8 @@ class DMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
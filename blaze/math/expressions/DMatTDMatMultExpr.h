@@ -66,6 +66,7 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/DeclDiagTrait.h>
 #include <blaze/math/traits/DeclHermTrait.h>
 #include <blaze/math/traits/DeclLowTrait.h>
@@ -93,6 +94,7 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Blocking.h>
@@ -276,10 +278,10 @@ class DMatTDMatMultExpr
    using RightOperand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = If_t< evaluateLeft, const RT1, CT1 >;
+   using LT = If_t< evaluateLeft, const TemporaryType_t<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   using RT = If_t< evaluateRight, const TemporaryType_t<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -465,7 +467,7 @@ class DMatTDMatMultExpr
                !BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( rows() * columns() < DMATTDMATMULT_THRESHOLD ) ) &&
-             ( rows() * columns() >= SMP_DMATTDMATMULT_THRESHOLD ) &&
+             ( rows() * columns() >= smpThreshold( SMP_DMATTDMATMULT ) ) &&
              !IsDiagonal_v<MT1> && !IsDiagonal_v<MT2>;
    }
    //**********************************************************************************************
@@ -1772,7 +1774,7 @@ class DMatTDMatMultExpr
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, fwd( tmp ) );
    }
    /*! \endcond */
@@ -4050,7 +4052,7 @@ class DMatTDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -4152,7 +4154,7 @@ class DMatTDMatMultExpr
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( rhs );
+      const TemporaryType_t<TmpType> tmp( rhs );
       smpAssign( ~lhs, fwd( tmp ) );
    }
    /*! \endcond */
@@ -4282,7 +4284,7 @@ class DMatTDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -4470,10 +4472,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    using RightOperand = ST;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = If_t< evaluateLeft, const RT1, CT1 >;
+   using LT = If_t< evaluateLeft, const TemporaryType_t<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   using RT = If_t< evaluateRight, const TemporaryType_t<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -4624,7 +4626,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
                !BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( rows() * columns() < DMATTDMATMULT_THRESHOLD ) ) &&
-             ( rows() * columns() >= SMP_DMATTDMATMULT_THRESHOLD );
+             ( rows() * columns() >= smpThreshold( SMP_DMATTDMATMULT ) );
    }
    //**********************************************************************************************
 
@@ -5915,7 +5917,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, fwd( tmp ) );
    }
    //**********************************************************************************************
@@ -6008,7 +6010,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< !IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      const ResultType tmp( serial( A * B * scalar ) );
+      const TemporaryType_t<ResultType> tmp( serial( A * B * scalar ) );
       addAssign( C, tmp );
    }
    //**********************************************************************************************
@@ -6978,7 +6980,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< !IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      const ResultType tmp( serial( A * B * scalar ) );
+      const TemporaryType_t<ResultType> tmp( serial( A * B * scalar ) );
       subAssign( C, tmp );
    }
    //**********************************************************************************************
@@ -7888,7 +7890,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -7991,7 +7993,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 
       const ForwardFunctor fwd;
 
-      const TmpType tmp( rhs );
+      const TemporaryType_t<TmpType> tmp( rhs );
       smpAssign( ~lhs, fwd( tmp ) );
    }
    //**********************************************************************************************
@@ -8121,7 +8123,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -54,12 +55,16 @@
 #include <blaze/math/expressions/Transformation.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/StorageOrder.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/system/Inline.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -68,6 +73,7 @@
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/GetMemberType.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -117,6 +123,24 @@ class DMatTransExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Kernel evaluation strategy******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the kernel evaluation strategy.
+       In case both the dense matrix operand and the target matrix provide direct access to
+       their strided elements and both have the same element type, the variable is set to 1
+       and the transposition is performed by the cache-oblivious transposition kernel.
+       Otherwise the variable is set to 0 and the expression is evaluated via the subscript
+       operator. */
+   template< typename MT2 >
+   static constexpr bool UseKernel_v =
+      ( !useAssign &&
+        HasConstDataAccess_v<MT> && IsContiguous_v<MT> &&
+        HasMutableDataAccess_v<MT2> && IsContiguous_v<MT2> &&
+        IsSame_v< ElementType_t<MT2>, ElementType_t<MT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Parallel evaluation strategy****************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -394,6 +418,43 @@ class DMatTransExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Optimized assignment to dense matrices******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized assignment of a dense matrix transposition expression to a dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // transposition expression to a dense matrix with the same storage order as the dense
+   // matrix operand by means of the cache-oblivious transposition kernel. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case both matrices provide direct access to their elements.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline auto assign( DenseMatrix<MT2,SO2>& lhs, const DMatTransExpr& rhs )
+      -> EnableIf_t< UseKernel_v<MT2> && SO2 != SO >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( SO2 == rowMajor ) {
+         transposeKernel( rhs.dm_.data(), rhs.dm_.spacing(), (~lhs).data(), (~lhs).spacing(),
+                          (~lhs).rows(), (~lhs).columns() );
+      }
+      else {
+         transposeKernel( rhs.dm_.data(), rhs.dm_.spacing(), (~lhs).data(), (~lhs).spacing(),
+                          (~lhs).columns(), (~lhs).rows() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix transposition expression to a sparse matrix.
@@ -427,7 +488,7 @@ class DMatTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( serial( rhs ) );
+      const TemporaryType_t<TmpType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -606,7 +667,7 @@ class DMatTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const TmpType tmp( rhs );
+      const TemporaryType_t<TmpType> tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -54,6 +54,7 @@
 #include <blaze/math/expressions/VecVecDivExpr.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/DivTrait.h>
 #include <blaze/math/typetraits/HasSIMDDiv.h>
 #include <blaze/math/typetraits/IsAligned.h>
@@ -61,6 +62,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/system/HostDevice.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Thresholds.h>
@@ -583,7 +585,7 @@ class DVecDVecDivExpr
    */
    inline bool canSMPAssign() const noexcept {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( size() > SMP_DVECDVECDIV_THRESHOLD );
+             ( size() > smpThreshold( SMP_DVECDVECDIV ) );
    }
    //**********************************************************************************************
 
@@ -629,7 +631,7 @@ class DVecDVecDivExpr
          divAssign( ~lhs, rhs.rhs_ );
       }
       else {
-         const ResultType tmp( serial( rhs ) );
+         const TemporaryType_t<ResultType> tmp( serial( rhs ) );
          assign( ~lhs, tmp );
       }
    }
@@ -662,7 +664,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -694,7 +696,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -730,7 +732,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -766,7 +768,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -802,7 +804,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -848,7 +850,7 @@ class DVecDVecDivExpr
          smpDivAssign( ~lhs, rhs.rhs_ );
       }
       else {
-         const ResultType tmp( rhs );
+         const TemporaryType_t<ResultType> tmp( rhs );
          smpAssign( ~lhs, tmp );
       }
    }
@@ -881,7 +883,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -913,7 +915,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpAddAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -949,7 +951,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSubAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -985,7 +987,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1021,7 +1023,7 @@ class DVecDVecDivExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpDivAssign( ~lhs, tmp );
    }
    /*! \endcond */
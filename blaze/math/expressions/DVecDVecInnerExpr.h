@@ -43,13 +43,17 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -257,7 +261,9 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 // and \a VT2 as well as the two element types \a VT1::ElementType and \a VT2::ElementType
 // have to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// is thrown. In case the size of the two vectors is larger or equal to the
+// BLAZE_SMP_DVECDVECINNER_THRESHOLD, the scalar product is computed in parallel. The partial
+// results of all threads are combined in a fixed order.
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
@@ -266,11 +272,26 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs );
+   waitForAsyncAssignments( ~rhs );
+
+   using CT1 = CompositeType_t<VT1>;
+   using CT2 = CompositeType_t<VT2>;
+   using RT  = decltype( dvecdvecinner( ~lhs, ~rhs ) );
+
    if( (~lhs).size() != (~rhs).size() ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
-   return dvecdvecinner( ~lhs, ~rhs );
+   if( (~lhs).size() < smpThreshold( SMP_DVECDVECINNER ) )
+      return dvecdvecinner( ~lhs, ~rhs );
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   return RT( smpReduce( left, right, []( const auto& a, const auto& b ) {
+      return dvecdvecinner( a, b );
+   }, Add() ) );
 }
 //*************************************************************************************************
 
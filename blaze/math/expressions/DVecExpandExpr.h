@@ -58,6 +58,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/system/Inline.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -373,7 +374,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.dv_ ) );
 
       assign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -406,7 +407,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.dv_ ) );
 
       addAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -439,7 +440,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.dv_ ) );
 
       subAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -472,7 +473,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.dv_ ) );
 
       schurAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -505,7 +506,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.dv_ ) );
 
       multAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -538,7 +539,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.dv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.dv_ );
 
       smpAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -571,7 +572,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.dv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.dv_ );
 
       smpAddAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -604,7 +605,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.dv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.dv_ );
 
       smpSubAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -637,7 +638,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.dv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.dv_ );
 
       smpSchurAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -670,7 +671,7 @@ class DVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.dv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.dv_ );
 
       smpMultAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
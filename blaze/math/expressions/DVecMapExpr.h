@@ -67,6 +67,7 @@
 #include <blaze/math/typetraits/IsPaddingEnabled.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/typetraits/UnderlyingNumeric.h>
 #include <blaze/system/HostDevice.h>
@@ -631,7 +632,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dv_ ) );
       assign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -663,7 +664,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dv_ ) );
       assign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -695,7 +696,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dv_ ) );
       addAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -731,7 +732,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dv_ ) );
       subAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -767,7 +768,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dv_ ) );
       multAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -803,7 +804,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.dv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.dv_ ) );
       divAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -871,7 +872,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dv_ );
+      const TemporaryType_t<RT> tmp( rhs.dv_ );
       smpAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -903,7 +904,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dv_ );
+      const TemporaryType_t<RT> tmp( rhs.dv_ );
       smpAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -935,7 +936,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dv_ );
+      const TemporaryType_t<RT> tmp( rhs.dv_ );
       smpAddAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -971,7 +972,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dv_ );
+      const TemporaryType_t<RT> tmp( rhs.dv_ );
       smpSubAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1007,7 +1008,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dv_ );
+      const TemporaryType_t<RT> tmp( rhs.dv_ );
       smpMultAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1043,7 +1044,7 @@ class DVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.dv_ );
+      const TemporaryType_t<RT> tmp( rhs.dv_ );
       smpDivAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
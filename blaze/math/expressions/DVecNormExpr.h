@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -62,6 +63,8 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -69,6 +72,7 @@
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
@@ -79,6 +83,7 @@
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -270,6 +275,10 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
    // ... Resizing and initialization
    const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the number of elements of the dense vector is larger or equal to the
+// BLAZE_SMP_DVECNORM_THRESHOLD, the norm is computed in parallel. The partial sums of all
+// threads are combined in a fixed order before the root operation is applied.
 */
 template< typename VT      // Type of the dense vector
         , bool TF          // Transpose flag
@@ -278,7 +287,22 @@ template< typename VT      // Type of the dense vector
         , typename Root >  // Type of the root operation
 inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dv, abs, power, root, Bool_t< DVecNormHelper<VT,Abs,Power>::value >() );
+   waitForAsyncAssignments( ~dv );
+
+   using CT = CompositeType_t<VT>;
+
+   if( (~dv).size() < smpThreshold( SMP_DVECNORM ) )
+      return norm_backend( ~dv, abs, power, root, Bool_t< DVecNormHelper<VT,Abs,Power>::value >() );
+
+   CT tmp( ~dv );
+
+   const auto norm = smpReduce( tmp, [abs,power]( const auto& chunk ) {
+      using ChunkType = RemoveCV_t< RemoveReference_t< decltype( chunk ) > >;
+      return norm_backend( chunk, abs, power, Noop(),
+                           Bool_t< DVecNormHelper<ChunkType,Abs,Power>::value >() );
+   }, Add() );
+
+   return evaluate( root( norm ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -47,17 +47,21 @@
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/IsUniform.h>
 #include <blaze/system/Compiler.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -83,7 +87,7 @@ struct DVecReduceExprHelper
    using CT = RemoveReference_t< CompositeType_t<VT> >;
 
    //! Element type of the dense vector expression.
-   using ET = ElementType_t<CT>;
+   using ET = RemoveCV_t< ElementType_t<CT> >;
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -124,7 +128,7 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
    -> DisableIf_t< DVecReduceExprHelper<VT,OP>::value, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
-   using ET = ElementType_t<VT>;
+   using ET = RemoveCV_t< ElementType_t<VT> >;
 
    const size_t N( (~dv).size() );
 
@@ -177,7 +181,7 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
    -> EnableIf_t< DVecReduceExprHelper<VT,OP>::value, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
-   using ET = ElementType_t<VT>;
+   using ET = RemoveCV_t< ElementType_t<VT> >;
 
    const size_t N( (~dv).size() );
 
@@ -251,7 +255,7 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
    -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
-   using ET = ElementType_t<VT>;
+   using ET = RemoveCV_t< ElementType_t<VT> >;
 
    const size_t N( (~dv).size() );
 
@@ -395,6 +399,11 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Max /*op*/ )
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
+//
+// In case the number of elements of the dense vector is larger or equal to the
+// BLAZE_SMP_DVECREDUCE_THRESHOLD, the reduction is executed in parallel (see
+// \ref shared_memory_parallelization). The partial results of all threads are combined in a
+// fixed order and therefore the result is deterministic for a given number of threads.
 */
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
@@ -403,7 +412,16 @@ inline decltype(auto) reduce( const DenseVector<VT,TF>& dv, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dvecreduce( ~dv, op );
+   waitForAsyncAssignments( ~dv );
+
+   using CT = CompositeType_t<VT>;
+
+   if( IsUniform_v<VT> || (~dv).size() < smpThreshold( SMP_DVECREDUCE ) )
+      return dvecreduce( ~dv, op );
+
+   CT tmp( ~dv );
+
+   return smpReduce( tmp, [op]( const auto& chunk ) { return dvecreduce( chunk, op ); }, op );
 }
 //*************************************************************************************************
 
@@ -48,6 +48,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/VecSerialExpr.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/util/Assert.h>
@@ -478,6 +479,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       assign( ~lhs, rhs.dv_ );
@@ -502,6 +505,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       assign( ~lhs, rhs.dv_ );
@@ -527,6 +532,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       addAssign( ~lhs, rhs.dv_ );
@@ -552,6 +559,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       addAssign( ~lhs, rhs.dv_ );
@@ -577,6 +586,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       subAssign( ~lhs, rhs.dv_ );
@@ -602,6 +613,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       subAssign( ~lhs, rhs.dv_ );
@@ -627,6 +640,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       multAssign( ~lhs, rhs.dv_ );
@@ -652,6 +667,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       multAssign( ~lhs, rhs.dv_ );
@@ -677,6 +694,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       divAssign( ~lhs, rhs.dv_ );
@@ -702,6 +721,8 @@ class DVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       divAssign( ~lhs, rhs.dv_ );
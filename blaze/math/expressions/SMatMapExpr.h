@@ -59,6 +59,7 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/typetraits/UnderlyingNumeric.h>
 #include <blaze/util/Assert.h>
@@ -525,7 +526,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );
       assign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -639,7 +640,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );
       (~lhs).reserve( tmp.nonZeros() );
       assign( ~lhs, map( tmp, rhs.op_ ) );
    }
@@ -674,7 +675,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );
       addAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -712,7 +713,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );
       subAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -750,7 +751,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );
       schurAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -796,7 +797,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.sm_ );
+      const TemporaryType_t<RT> tmp( rhs.sm_ );
       smpAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -834,7 +835,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.sm_ );
+      const TemporaryType_t<RT> tmp( rhs.sm_ );
       smpAddAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -872,7 +873,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.sm_ );
+      const TemporaryType_t<RT> tmp( rhs.sm_ );
       smpSubAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -910,7 +911,7 @@ class SMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.sm_ );
+      const TemporaryType_t<RT> tmp( rhs.sm_ );
       smpSchurAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
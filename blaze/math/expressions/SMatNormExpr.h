@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -62,10 +63,13 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsZero.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
@@ -83,7 +87,7 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the norm of a sparse matrix.
+/*!\brief Serial backend implementation of the norm of a sparse matrix.
 // \ingroup sparse_matrix
 //
 // \param sm The given sparse matrix for the norm computation.
@@ -92,16 +96,15 @@ namespace blaze {
 // \param root The functor for the root operation.
 // \return The norm of the given matrix.
 //
-// This function implements the performance optimized norm of a sparse matrix. Due to the
-// explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization cannot be applied.
+// This function implements the serial computation of the norm of the non-zero elements of a
+// sparse matrix.
 */
 template< typename MT      // Type of the sparse matrix
         , bool SO          // Storage order
         , typename Abs     // Type of the abs operation
         , typename Power   // Type of the power operation
         , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const SparseMatrix<MT,SO>& sm, Abs abs, Power power, Root root )
+inline decltype(auto) smatnorm( const SparseMatrix<MT,SO>& sm, Abs abs, Power power, Root root )
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
@@ -132,6 +135,48 @@ inline decltype(auto) norm_backend( const SparseMatrix<MT,SO>& sm, Abs abs, Powe
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the norm of a sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given sparse matrix.
+//
+// This function computes the norm of the given sparse matrix. In case the number of non-zero
+// elements of the sparse matrix is larger or equal to the BLAZE_SMP_SMATTOTALREDUCE_THRESHOLD,
+// the norm is computed in parallel. The partial sums of all threads are combined in a fixed
+// order before the root operation is applied.
+*/
+template< typename MT      // Type of the sparse matrix
+        , bool SO          // Storage order
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto) norm_backend( const SparseMatrix<MT,SO>& sm, Abs abs, Power power, Root root )
+{
+   waitForAsyncAssignments( ~sm );
+
+   using CT = CompositeType_t<MT>;
+
+   if( (~sm).nonZeros() < smpThreshold( SMP_SMATTOTALREDUCE ) )
+      return smatnorm( ~sm, abs, power, root );
+
+   CT tmp( ~sm );
+
+   const auto norm = smpReduce( tmp, [abs,power]( const auto& block ) {
+      return smatnorm( block, abs, power, Noop() );
+   }, Add() );
+
+   return evaluate( root( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Computes the L2 norm for the given sparse matrix.
 // \ingroup sparse_matrix
@@ -61,9 +61,12 @@
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -274,7 +277,7 @@ class SMatReduceExpr<MT,OP,columnwise>
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return sm_.canSMPAssign() || ( size() > SMP_SMATREDUCE_THRESHOLD );
+      return sm_.canSMPAssign() || ( size() > smpThreshold( SMP_SMATREDUCE ) );
    }
    //**********************************************************************************************
 
@@ -307,7 +310,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       assign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -337,7 +340,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -367,7 +370,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       addAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -397,7 +400,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -427,7 +430,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       subAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -457,7 +460,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -487,7 +490,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       multAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -517,7 +520,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -547,7 +550,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       divAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -577,7 +580,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -605,7 +608,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -634,7 +637,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpAddAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -663,7 +666,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpSubAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -692,7 +695,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpMultAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -721,7 +724,7 @@ class SMatReduceExpr<MT,OP,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpDivAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1183,7 +1186,7 @@ class SMatReduceExpr<MT,OP,rowwise>
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return sm_.canSMPAssign() || ( size() > SMP_SMATREDUCE_THRESHOLD );
+      return sm_.canSMPAssign() || ( size() > smpThreshold( SMP_SMATREDUCE ) );
    }
    //**********************************************************************************************
 
@@ -1215,7 +1218,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       assign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1243,7 +1246,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       addAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1272,7 +1275,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       subAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1301,7 +1304,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       multAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1329,7 +1332,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       divAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1357,7 +1360,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1386,7 +1389,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpAddAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1415,7 +1418,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpSubAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1444,7 +1447,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpMultAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1473,7 +1476,7 @@ class SMatReduceExpr<MT,OP,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
       smpDivAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -1498,39 +1501,21 @@ class SMatReduceExpr<MT,OP,rowwise>
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Performs a custom reduction operation on the given sparse matrix.
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the total reduction of a sparse matrix.
 // \ingroup sparse_matrix
 //
 // \param sm The given sparse matrix for the reduction computation.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function reduces the non-zero elements of the given sparse matrix \a sm by means of the
-// given reduction operation \a op:
-
-   \code
-   blaze::CompressedMatrix<double> A;
-   // ... Resizing and initialization
-
-   const double totalsum1 = reduce( A, blaze::Add() );
-   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
-   \endcode
-
-// As demonstrated in the example it is possible to pass any binary callable as custom reduction
-// operation. See \ref custom_operations for a detailed overview of the possibilities of custom
-// operations.
-
-// Please note that the evaluation order of the reduction operation is unspecified. Thus the
-// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
-// operation is undefined if the given reduction operation modifies the values.
+// This function implements the serial reduction of the non-zero elements of a sparse matrix.
 */
 template< typename MT    // Type of the sparse matrix
         , bool SO        // Storage order
         , typename OP >  // Type of the reduction operation
-inline decltype(auto) reduce( const SparseMatrix<MT,SO>& sm, OP op )
+inline ElementType_t<MT> smatreduce( const SparseMatrix<MT,SO>& sm, OP op )
 {
-   BLAZE_FUNCTION_TRACE;
-
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
@@ -1568,6 +1553,59 @@ inline decltype(auto) reduce( const SparseMatrix<MT,SO>& sm, OP op )
 
    return redux0;
 }
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the given sparse matrix \a sm by means of the
+// given reduction operation \a op:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( A, blaze::Add() );
+   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// As demonstrated in the example it is possible to pass any binary callable as custom reduction
+// operation. See \ref custom_operations for a detailed overview of the possibilities of custom
+// operations.
+
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values.
+//
+// In case the number of non-zero elements of the sparse matrix is larger or equal to the
+// BLAZE_SMP_SMATTOTALREDUCE_THRESHOLD, the reduction is executed in parallel. The partial
+// results of all threads are combined in a fixed order.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline decltype(auto) reduce( const SparseMatrix<MT,SO>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   waitForAsyncAssignments( ~sm );
+
+   using CT = CompositeType_t<MT>;
+
+   if( (~sm).nonZeros() < smpThreshold( SMP_SMATTOTALREDUCE ) )
+      return smatreduce( ~sm, op );
+
+   CT tmp( ~sm );
+
+   return smpReduce( tmp, [op]( const auto& block ) { return smatreduce( block, op ); }, op );
+}
 //*************************************************************************************************
 
 
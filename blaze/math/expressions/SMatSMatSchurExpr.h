@@ -54,7 +54,9 @@
 #include <blaze/math/expressions/SchurExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/MergeKernels.h>
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -70,6 +72,7 @@
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -161,7 +164,7 @@ class SMatSMatSchurExpr
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template assignment strategy.
-   static constexpr bool smpAssignable = false;
+   static constexpr bool smpAssignable = ( MT1::smpAssignable && MT2::smpAssignable );
    //**********************************************************************************************
 
    //**Constructor*********************************************************************************
@@ -297,6 +300,16 @@ class SMatSMatSchurExpr
    }
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( lhs_.nonZeros() + rhs_.nonZeros() >= smpThreshold( SMP_SMATSMATSCHUR ) );
+   }
+   //**********************************************************************************************
+
  private:
    //**Member variables****************************************************************************
    LeftOperand  lhs_;  //!< Left-hand side sparse matrix of the Schur product expression.
@@ -337,20 +350,8 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) = l->value() * r->value();
-               ++r;
-            }
-         }
+         mergeIntersection( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l, const auto& r ){ (~lhs)(i,l->index()) = l->value() * r->value(); } );
       }
    }
    /*! \endcond */
@@ -392,20 +393,8 @@ class SMatSMatSchurExpr
       // Performing the Schur product
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( i, l->index(), l->value() * r->value() );
-               ++r;
-            }
-         }
+         mergeIntersection( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l, const auto& r ){ (~lhs).append( i, l->index(), l->value() * r->value() ); } );
 
          (~lhs).finalize( i );
       }
@@ -454,20 +443,8 @@ class SMatSMatSchurExpr
       std::vector<size_t> nonzeros( n, 0UL );
       for( size_t i=0UL; i<m; ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               ++nonzeros[l->index()];
-               ++r;
-            }
-         }
+         mergeIntersection( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l, const auto& r ){ ++nonzeros[l->index()]; } );
       }
 
       // Resizing the left-hand side sparse matrix
@@ -478,20 +455,8 @@ class SMatSMatSchurExpr
       // Performing the Schur product
       for( size_t i=0UL; i<m; ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( i, l->index(), l->value() * r->value() );
-               ++r;
-            }
-         }
+         mergeIntersection( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l, const auto& r ){ (~lhs).append( i, l->index(), l->value() * r->value() ); } );
       }
    }
    /*! \endcond */
@@ -560,20 +525,8 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) += l->value() * r->value();
-               ++r;
-            }
-         }
+         mergeIntersection( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l, const auto& r ){ (~lhs)(i,l->index()) += l->value() * r->value(); } );
       }
    }
    /*! \endcond */
@@ -647,20 +600,8 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) -= l->value() * r->value();
-               ++r;
-            }
-         }
+         mergeIntersection( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l, const auto& r ){ (~lhs)(i,l->index()) -= l->value() * r->value(); } );
       }
    }
    /*! \endcond */
@@ -734,25 +675,15 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
          size_t j( 0UL );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
+         mergeIntersection( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l, const auto& r ){
                for( ; j<l->index(); ++j )
                   reset( (~lhs)(i,j) );
-               (~lhs)(i,l->index()) *= l->value() * r->value();
-               ++r;
+               (~lhs)(i,j) *= l->value() * r->value();
                ++j;
-            }
-         }
+            } );
 
          for( ; j<(~lhs).columns(); ++j )
             reset( (~lhs)(i,j) );
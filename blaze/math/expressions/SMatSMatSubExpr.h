@@ -55,6 +55,8 @@
 #include <blaze/math/expressions/MatMatSubExpr.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/sparse/MergeKernels.h>
 #include <blaze/math/traits/SubTrait.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -63,6 +65,8 @@
 #include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/IsZero.h>
+#include <blaze/math/typetraits/TemporaryType.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -169,7 +173,7 @@ class SMatSMatSubExpr
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template assignment strategy.
-   static constexpr bool smpAssignable = false;
+   static constexpr bool smpAssignable = ( MT1::smpAssignable && MT2::smpAssignable );
    //**********************************************************************************************
 
    //**Constructor*********************************************************************************
@@ -305,6 +309,16 @@ class SMatSMatSubExpr
    }
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( lhs_.nonZeros() + rhs_.nonZeros() >= smpThreshold( SMP_SMATSMATSUB ) );
+   }
+   //**********************************************************************************************
+
  private:
    //**Member variables****************************************************************************
    LeftOperand  lhs_;  //!< Left-hand side sparse matrix of the subtraction expression.
@@ -396,38 +410,10 @@ class SMatSMatSubExpr
       // Performing the matrix subtraction
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         while( l != lend && r != rend )
-         {
-            if( l->index() < r->index() ) {
-               (~lhs).append( i, l->index(), l->value() );
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
-               (~lhs).append( i, r->index(), -r->value() );
-               ++r;
-            }
-            else {
-               (~lhs).append( i, l->index(), l->value() - r->value() );
-               ++l;
-               ++r;
-            }
-         }
-
-         while( l != lend ) {
-            (~lhs).append( i, l->index(), l->value() );
-            ++l;
-         }
-
-         while( r != rend ) {
-            (~lhs).append( i, r->index(), -r->value() );
-            ++r;
-         }
+         mergeUnion( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l ){ (~lhs).append( i, l->index(), l->value() ); },
+            [&]( const auto& r ){ (~lhs).append( i, r->index(), -r->value() ); },
+            [&]( const auto& l, const auto& r ){ (~lhs).append( i, l->index(), l->value() - r->value() ); } );
 
          (~lhs).finalize( i );
       }
@@ -475,38 +461,10 @@ class SMatSMatSubExpr
       std::vector<size_t> nonzeros( n, 0UL );
       for( size_t i=0UL; i<m; ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         while( l != lend && r != rend )
-         {
-            if( l->index() < r->index() ) {
-               ++nonzeros[l->index()];
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
-               ++nonzeros[r->index()];
-               ++r;
-            }
-            else {
-               ++nonzeros[l->index()];
-               ++l;
-               ++r;
-            }
-         }
-
-         while( l != lend ) {
-            ++nonzeros[l->index()];
-            ++l;
-         }
-
-         while( r != rend ) {
-            ++nonzeros[r->index()];
-            ++r;
-         }
+         mergeUnion( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l ){ ++nonzeros[l->index()]; },
+            [&]( const auto& r ){ ++nonzeros[r->index()]; },
+            [&]( const auto& l, const auto& r ){ ++nonzeros[l->index()]; } );
       }
 
       // Resizing the left-hand side sparse matrix
@@ -517,38 +475,10 @@ class SMatSMatSubExpr
       // Performing the matrix subtraction
       for( size_t i=0UL; i<m; ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         while( l != lend && r != rend )
-         {
-            if( l->index() < r->index() ) {
-               (~lhs).append( i, l->index(), l->value() );
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
-               (~lhs).append( i, r->index(), -r->value() );
-               ++r;
-            }
-            else {
-               (~lhs).append( i, l->index(), l->value() - r->value() );
-               ++l;
-               ++r;
-            }
-         }
-
-         while( l != lend ) {
-            (~lhs).append( i, l->index(), l->value() );
-            ++l;
-         }
-
-         while( r != rend ) {
-            (~lhs).append( i, r->index(), -r->value() );
-            ++r;
-         }
+         mergeUnion( A.begin(i), A.end(i), B.begin(i), B.end(i),
+            [&]( const auto& l ){ (~lhs).append( i, l->index(), l->value() ); },
+            [&]( const auto& r ){ (~lhs).append( i, r->index(), -r->value() ); },
+            [&]( const auto& l, const auto& r ){ (~lhs).append( i, l->index(), l->value() - r->value() ); } );
       }
    }
    /*! \endcond */
@@ -670,7 +600,7 @@ class SMatSMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -794,7 +724,7 @@ class SMatSMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -58,6 +58,8 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/sparse/MergeKernels.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -65,6 +67,7 @@
 #include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -145,10 +148,10 @@ class SMatSVecMultExpr
    using RightOperand = If_t< IsExpression_v<VT>, const VT, const VT& >;
 
    //! Type for the assignment of the left-hand side sparse matrix operand.
-   using LT = If_t< evaluateMatrix, const MRT, MCT >;
+   using LT = If_t< evaluateMatrix, const TemporaryType_t<MRT>, MCT >;
 
    //! Type for the assignment of the right-hand side sparse vector operand.
-   using RT = If_t< evaluateVector, const VRT, VCT >;
+   using RT = If_t< evaluateVector, const TemporaryType_t<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -268,7 +271,7 @@ class SMatSVecMultExpr
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( size() > SMP_SMATSVECMULT_THRESHOLD );
+      return ( size() > smpThreshold( SMP_SMATSVECMULT ) );
    }
    //**********************************************************************************************
 
@@ -338,54 +341,14 @@ class SMatSVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      const auto vend( x.end() );
-
-      for( size_t i=0UL; i<y.size(); ++i )
-      {
-         const auto mend ( A.end(i)   );
-         auto       melem( A.begin(i) );
-
-         if( melem == mend ) continue;
-
-         auto velem( x.begin() );
-
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else {
-               y[i] = melem->value() * velem->value();
-               ++melem;
-               ++velem;
-               break;
-            }
-         }
-
-         if( melem != mend && velem != vend )
-         {
-            while( true ) {
-               if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else {
-                  y[i] += melem->value() * velem->value();
-                  ++melem;
-                  if( melem == mend ) break;
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-            }
-         }
+      // Using an index bitmap of x in case it has more non-zeros than an average row of A
+      const bool bitmap( useIntersectionBitmap( x.nonZeros(), x.size(), A.rows(), A.nonZeros() ) );
+      const auto probe( makeIntersectionProbe( x.begin(), x.end(), x.size(), bitmap ) );
+
+      for( size_t i=0UL; i<y.size(); ++i ) {
+         probe.intersect( A.begin(i), A.end(i), [&]( const auto& m, const auto& v ){
+            y[i] += m->value() * v->value();
+         } );
       }
    }
    /*! \endcond */
@@ -421,56 +384,25 @@ class SMatSVecMultExpr
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
       ElementType accu;
-      const auto vend( x.end() );
+      // Using an index bitmap of x in case it has more non-zeros than an average row of A
+      const bool bitmap( useIntersectionBitmap( x.nonZeros(), x.size(), A.rows(), A.nonZeros() ) );
+      const auto probe( makeIntersectionProbe( x.begin(), x.end(), x.size(), bitmap ) );
 
       for( size_t i=0UL; i<(~lhs).size(); ++i )
       {
-         const auto mend ( A.end(i)   );
-         auto       melem( A.begin(i) );
-
-         if( melem == mend ) continue;
-
-         auto velem( x.begin() );
+         bool empty( true );
 
          reset( accu );
 
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
+         probe.intersect( A.begin(i), A.end(i), [&]( const auto& m, const auto& v ){
+            if( empty ) {
+               accu = m->value() * v->value();
+               empty = false;
             }
             else {
-               accu = melem->value() * velem->value();
-               ++melem;
-               ++velem;
-               break;
-            }
-         }
-
-         if( melem != mend && velem != vend )
-         {
-            while( true ) {
-               if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else {
-                  accu += melem->value() * velem->value();
-                  ++melem;
-                  if( melem == mend ) break;
-                  ++velem;
-                  if( velem == vend ) break;
-               }
+               accu += m->value() * v->value();
             }
-         }
+         } );
 
          if( !isDefault( accu ) )
             (~lhs).insert( i, accu );
@@ -536,34 +468,14 @@ class SMatSVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      const auto vend( x.end() );
-
-      for( size_t i=0UL; i<y.size(); ++i )
-      {
-         const auto mend ( A.end(i)   );
-         auto       melem( A.begin(i) );
-
-         if( melem == mend ) continue;
-
-         auto velem( x.begin() );
-
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else {
-               y[i] += melem->value() * velem->value();
-               ++melem;
-               if( melem == mend ) break;
-               ++velem;
-               if( velem == vend ) break;
-            }
-         }
+      // Using an index bitmap of x in case it has more non-zeros than an average row of A
+      const bool bitmap( useIntersectionBitmap( x.nonZeros(), x.size(), A.rows(), A.nonZeros() ) );
+      const auto probe( makeIntersectionProbe( x.begin(), x.end(), x.size(), bitmap ) );
+
+      for( size_t i=0UL; i<y.size(); ++i ) {
+         probe.intersect( A.begin(i), A.end(i), [&]( const auto& m, const auto& v ){
+            y[i] += m->value() * v->value();
+         } );
       }
    }
    /*! \endcond */
@@ -630,34 +542,14 @@ class SMatSVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      const auto vend( x.end() );
-
-      for( size_t i=0UL; i<y.size(); ++i )
-      {
-         const auto mend ( A.end(i)   );
-         auto       melem( A.begin(i) );
-
-         if( melem == mend ) continue;
-
-         auto velem( x.begin() );
-
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else {
-               y[i] -= melem->value() * velem->value();
-               ++melem;
-               if( melem == mend ) break;
-               ++velem;
-               if( velem == vend ) break;
-            }
-         }
+      // Using an index bitmap of x in case it has more non-zeros than an average row of A
+      const bool bitmap( useIntersectionBitmap( x.nonZeros(), x.size(), A.rows(), A.nonZeros() ) );
+      const auto probe( makeIntersectionProbe( x.begin(), x.end(), x.size(), bitmap ) );
+
+      for( size_t i=0UL; i<y.size(); ++i ) {
+         probe.intersect( A.begin(i), A.end(i), [&]( const auto& m, const auto& v ){
+            y[i] -= m->value() * v->value();
+         } );
       }
    }
    /*! \endcond */
@@ -690,7 +582,7 @@ class SMatSVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -867,7 +759,7 @@ class SMatSVecMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    /*! \endcond */
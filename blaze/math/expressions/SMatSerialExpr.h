@@ -48,6 +48,7 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatSerialExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
@@ -525,6 +526,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -551,6 +554,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -578,6 +583,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -605,6 +612,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -632,6 +641,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -659,6 +670,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -686,6 +699,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -713,6 +728,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -740,6 +757,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -767,6 +786,8 @@ class SMatSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
@@ -59,6 +59,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/util/Assert.h>
@@ -261,7 +262,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       assign( ~lhs, var<columnwise>( tmp ) );
    }
    /*! \endcond */
@@ -291,7 +292,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -321,7 +322,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       addAssign( ~lhs, var<columnwise>( tmp ) );
    }
    /*! \endcond */
@@ -351,7 +352,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -381,7 +382,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       subAssign( ~lhs, var<columnwise>( tmp ) );
    }
    /*! \endcond */
@@ -411,7 +412,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -441,7 +442,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       multAssign( ~lhs, var<columnwise>( tmp ) );
    }
    /*! \endcond */
@@ -471,7 +472,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -501,7 +502,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const OT tmp( serial( rhs.sm_ ) );
+      const TemporaryType_t<OT> tmp( serial( rhs.sm_ ) );
       divAssign( ~lhs, var<columnwise>( tmp ) );
    }
    /*! \endcond */
@@ -531,7 +532,7 @@ class SMatVarExpr<MT,columnwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -981,7 +982,7 @@ class SMatVarExpr<MT,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       assign( ~lhs, var<rowwise>( tmp ) );
    }
    /*! \endcond */
@@ -1009,7 +1010,7 @@ class SMatVarExpr<MT,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       addAssign( ~lhs, var<rowwise>( tmp ) );
    }
    /*! \endcond */
@@ -1038,7 +1039,7 @@ class SMatVarExpr<MT,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       subAssign( ~lhs, var<rowwise>( tmp ) );
    }
    /*! \endcond */
@@ -1067,7 +1068,7 @@ class SMatVarExpr<MT,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       multAssign( ~lhs, var<rowwise>( tmp ) );
    }
    /*! \endcond */
@@ -1095,7 +1096,7 @@ class SMatVarExpr<MT,rowwise>
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+      const TemporaryType_t<RT> tmp( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
       divAssign( ~lhs, var<rowwise>( tmp ) );
    }
    /*! \endcond */
@@ -56,6 +56,7 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/system/Inline.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -392,7 +393,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.sv_ ) );
 
       assign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -425,7 +426,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.sv_ ) );
 
       addAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -458,7 +459,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.sv_ ) );
 
       subAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -491,7 +492,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.sv_ ) );
 
       schurAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -524,7 +525,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( ~rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( ~rhs.sv_ ) );
 
       multAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -557,7 +558,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.sv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.sv_ );
 
       smpAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -590,7 +591,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.sv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.sv_ );
 
       smpAddAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -623,7 +624,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.sv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.sv_ );
 
       smpSubAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -656,7 +657,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.sv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.sv_ );
 
       smpSchurAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
@@ -689,7 +690,7 @@ class SVecExpandExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( ~rhs.sv_ );
+      const TemporaryType_t<RT> tmp( ~rhs.sv_ );
 
       smpMultAssign( ~lhs, expand<CEAs...>( tmp, rhs.expansion() ) );
    }
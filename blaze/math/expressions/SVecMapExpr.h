@@ -59,6 +59,7 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/typetraits/UnderlyingNumeric.h>
 #include <blaze/util/Assert.h>
@@ -488,7 +489,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sv_ ) );
       assign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -556,7 +557,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sv_ ) );
       (~lhs).reserve( tmp.nonZeros() );
       assign( ~lhs, map( tmp, rhs.op_ ) );
    }
@@ -589,7 +590,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sv_ ) );
       addAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -625,7 +626,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sv_ ) );
       subAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -661,7 +662,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( serial( rhs.sv_ ) );
+      const TemporaryType_t<RT> tmp( serial( rhs.sv_ ) );
       multAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -697,7 +698,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sv_ );
+      const TemporaryType_t<RT> tmp( rhs.sv_ );
       smpAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -733,7 +734,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sv_ );
+      const TemporaryType_t<RT> tmp( rhs.sv_ );
       smpAddAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -769,7 +770,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sv_ );
+      const TemporaryType_t<RT> tmp( rhs.sv_ );
       smpSubAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
@@ -805,7 +806,7 @@ class SVecMapExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const RT tmp( rhs.sv_ );
+      const TemporaryType_t<RT> tmp( rhs.sv_ );
       smpMultAssign( ~lhs, map( tmp, rhs.op_ ) );
    }
    /*! \endcond */
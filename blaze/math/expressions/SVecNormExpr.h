@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -61,8 +62,11 @@
 #include <blaze/math/shims/Evaluate.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
@@ -79,7 +83,7 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Computes a custom norm for the given sparse vector.
+/*!\brief Serial backend implementation of the norm of a sparse vector.
 // \ingroup sparse_vector
 //
 // \param sv The given sparse vector for the norm computation.
@@ -88,22 +92,15 @@ namespace blaze {
 // \param root The functor for the root operation.
 // \return The norm of the given sparse vector.
 //
-// This function computes a custom norm of the given sparse vector by means of the given functors.
-// The following example demonstrates the computation of the L2 norm by means of the blaze::Noop,
-// blaze::Pow2 and blaze::Sqrt functors:
-
-   \code
-   blaze::CompressedVector<double> a;
-   // ... Resizing and initialization
-   const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
-   \endcode
+// This function implements the serial computation of the norm of the non-zero elements of a
+// sparse vector.
 */
 template< typename VT      // Type of the sparse vector
         , bool TF          // Transpose flag
         , typename Abs     // Type of the abs operation
         , typename Power   // Type of the power operation
         , typename Root >  // Type of the root operation
-decltype(auto) norm_backend( const SparseVector<VT,TF>& sv, Abs abs, Power power, Root root )
+decltype(auto) svecnorm( const SparseVector<VT,TF>& sv, Abs abs, Power power, Root root )
 {
    using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
@@ -131,6 +128,57 @@ decltype(auto) norm_backend( const SparseVector<VT,TF>& sv, Abs abs, Power power
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a custom norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given sparse vector.
+//
+// This function computes a custom norm of the given sparse vector by means of the given functors.
+// The following example demonstrates the computation of the L2 norm by means of the blaze::Noop,
+// blaze::Pow2 and blaze::Sqrt functors:
+
+   \code
+   blaze::CompressedVector<double> a;
+   // ... Resizing and initialization
+   const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
+   \endcode
+
+// In case the number of non-zero elements of the sparse vector is larger or equal to the
+// BLAZE_SMP_SVECREDUCE_THRESHOLD, the norm is computed in parallel. The partial sums of all
+// threads are combined in a fixed order before the root operation is applied.
+*/
+template< typename VT      // Type of the sparse vector
+        , bool TF          // Transpose flag
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto) norm_backend( const SparseVector<VT,TF>& sv, Abs abs, Power power, Root root )
+{
+   waitForAsyncAssignments( ~sv );
+
+   using CT = CompositeType_t<VT>;
+
+   if( (~sv).nonZeros() < smpThreshold( SMP_SVECREDUCE ) )
+      return svecnorm( ~sv, abs, power, root );
+
+   CT tmp( ~sv );
+
+   const auto norm = smpReduce( tmp, [abs,power]( const auto& chunk ) {
+      return svecnorm( chunk, abs, power, Noop() );
+   }, Add() );
+
+   return evaluate( root( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Computes the L2 norm for the given sparse vector.
 // \ingroup sparse_vector
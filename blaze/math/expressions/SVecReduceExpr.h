@@ -46,6 +46,9 @@
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
@@ -59,6 +62,49 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial reduction of the non-zero elements of a sparse vector.
+*/
+template< typename VT    // Type of the sparse vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<VT> svecreduce( const SparseVector<VT,TF>& sv, OP op )
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   if( (~sv).size() == 0UL ) return ET{};
+
+   CT tmp( ~sv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == (~sv).size(), "Invalid vector size" );
+
+   const auto end( tmp.end() );
+   auto element( tmp.begin() );
+
+   if( element == end ) return ET{};
+
+   ET redux( element->value() );
+   ++element;
+
+   for( ; element!=end; ++element ) {
+      redux = op( redux, element->value() );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Performs a custom reduction operation on the given sparse vector.
 // \ingroup sparse_vector
@@ -85,6 +131,10 @@ namespace blaze {
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
+//
+// In case the number of non-zero elements of the sparse vector is larger or equal to the
+// BLAZE_SMP_SVECREDUCE_THRESHOLD, the reduction is executed in parallel. The partial results
+// of all threads are combined in a fixed order.
 */
 template< typename VT    // Type of the sparse vector
         , bool TF        // Transpose flag
@@ -93,28 +143,16 @@ inline decltype(auto) reduce( const SparseVector<VT,TF>& sv, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~sv );
+
    using CT = CompositeType_t<VT>;
-   using ET = ElementType_t<VT>;
 
-   if( (~sv).size() == 0UL ) return ET{};
+   if( (~sv).nonZeros() < smpThreshold( SMP_SVECREDUCE ) )
+      return svecreduce( ~sv, op );
 
    CT tmp( ~sv );
 
-   BLAZE_INTERNAL_ASSERT( tmp.size() == (~sv).size(), "Invalid vector size" );
-
-   const auto end( tmp.end() );
-   auto element( tmp.begin() );
-
-   if( element == end ) return ET{};
-
-   ET redux( element->value() );
-   ++element;
-
-   for( ; element!=end; ++element ) {
-      redux = op( redux, element->value() );
-   }
-
-   return redux;
+   return smpReduce( tmp, [op]( const auto& chunk ) { return svecreduce( chunk, op ); }, op );
 }
 //*************************************************************************************************
 
@@ -54,12 +54,14 @@
 #include <blaze/math/expressions/VecVecAddExpr.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/MergeKernels.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/IsZero.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
@@ -379,38 +381,10 @@ class SVecSVecAddExpr
       (~lhs).reserve( min( x.size(), x.nonZeros() + y.nonZeros() ) );
 
       // Performing the vector addition
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin() );
-      auto r( y.begin() );
-
-      while( l != lend && r != rend )
-      {
-         if( l->index() < r->index() ) {
-            (~lhs).append( l->index(), l->value() );
-            ++l;
-         }
-         else if( l->index() > r->index() ) {
-            (~lhs).append( r->index(), r->value() );
-            ++r;
-         }
-         else {
-            (~lhs).append( l->index(), l->value() + r->value() );
-            ++l;
-            ++r;
-         }
-      }
-
-      while( l != lend ) {
-         (~lhs).append( l->index(), l->value() );
-         ++l;
-      }
-
-      while( r != rend ) {
-         (~lhs).append( r->index(), r->value() );
-         ++r;
-      }
+      mergeUnion( x.begin(), x.end(), y.begin(), y.end(),
+         [&]( const auto& l ){ (~lhs).append( l->index(), l->value() ); },
+         [&]( const auto& r ){ (~lhs).append( r->index(), r->value() ); },
+         [&]( const auto& l, const auto& r ){ (~lhs).append( l->index(), l->value() + r->value() ); } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -496,7 +470,7 @@ class SVecSVecAddExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -605,7 +579,7 @@ class SVecSVecAddExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/SparseVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/sparse/MergeKernels.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsOpposedView.h>
 #include <blaze/util/FunctionTrace.h>
@@ -158,50 +159,18 @@ inline decltype(auto)
    }
    else
    {
-      const auto lend( left.end()  );
-      const auto rend( right.end() );
-      auto l( left.begin()  );
-      auto r( right.begin() );
+      bool first( true );
 
-      if( l == lend || r == rend ) return sp;
-
-      while( true ) {
-         if( l->index() < r->index() ) {
-            ++l;
-            if( l == lend ) break;
-         }
-         else if( r->index() < l->index() ) {
-            ++r;
-            if( r == rend ) break;
-         }
-         else {
-            sp = l->value() * r->value();
-            ++l;
-            ++r;
-            break;
-         }
-      }
-
-      if( l != lend && r != rend )
-      {
-         while( true ) {
-            if( l->index() < r->index() ) {
-               ++l;
-               if( l == lend ) break;
-            }
-            else if( r->index() < l->index() ) {
-               ++r;
-               if( r == rend ) break;
+      mergeIntersection( left.begin(), left.end(), right.begin(), right.end(),
+         [&]( const auto& l, const auto& r ){
+            if( first ) {
+               sp = l->value() * r->value();
+               first = false;
             }
             else {
                sp += l->value() * r->value();
-               ++l;
-               if( l == lend ) break;
-               ++r;
-               if( r == rend ) break;
             }
-         }
-      }
+         } );
    }
 
    return sp;
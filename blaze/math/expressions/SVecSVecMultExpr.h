@@ -53,6 +53,7 @@
 #include <blaze/math/expressions/VecVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/MergeKernels.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -273,20 +274,8 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin()  );
-      auto r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] = l->value() * r->value();
-            ++r;
-         }
-      }
+      mergeIntersection( x.begin(), x.end(), y.begin(), y.end(),
+         [&]( const auto& l, const auto& r ){ (~lhs)[l->index()] = l->value() * r->value(); } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -321,20 +310,8 @@ class SVecSVecMultExpr
       (~lhs).reserve( min( x.nonZeros(), y.nonZeros() ) );
 
       // Performing the vector multiplication
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin()  );
-      auto r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs).append( l->index(), l->value() * r->value() );
-            ++r;
-         }
-      }
+      mergeIntersection( x.begin(), x.end(), y.begin(), y.end(),
+         [&]( const auto& l, const auto& r ){ (~lhs).append( l->index(), l->value() * r->value() ); } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -365,20 +342,8 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin() );
-      auto r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] += l->value() * r->value();
-            ++r;
-         }
-      }
+      mergeIntersection( x.begin(), x.end(), y.begin(), y.end(),
+         [&]( const auto& l, const auto& r ){ (~lhs)[l->index()] += l->value() * r->value(); } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -413,20 +378,8 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin()  );
-      auto r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] -= l->value() * r->value();
-            ++r;
-         }
-      }
+      mergeIntersection( x.begin(), x.end(), y.begin(), y.end(),
+         [&]( const auto& l, const auto& r ){ (~lhs)[l->index()] -= l->value() * r->value(); } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -461,25 +414,15 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin()  );
-      auto r( y.begin() );
-
       size_t i( 0UL );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            for( ; i<r->index(); ++i )
+      mergeIntersection( x.begin(), x.end(), y.begin(), y.end(),
+         [&]( const auto& l, const auto& r ){
+            for( ; i<l->index(); ++i )
                reset( (~lhs)[i] );
-            (~lhs)[l->index()] *= l->value() * r->value();
-            ++r;
+            (~lhs)[i] *= l->value() * r->value();
             ++i;
-         }
-      }
+         } );
 
       for( ; i<rhs.size(); ++i )
          reset( (~lhs)[i] );
@@ -48,6 +48,7 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/VecSerialExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/util/Assert.h>
@@ -427,6 +428,8 @@ class SVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       assign( ~lhs, rhs.sv_ );
@@ -451,6 +454,8 @@ class SVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       assign( ~lhs, rhs.sv_ );
@@ -476,6 +481,8 @@ class SVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       addAssign( ~lhs, rhs.sv_ );
@@ -501,6 +508,8 @@ class SVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       addAssign( ~lhs, rhs.sv_ );
@@ -526,6 +535,8 @@ class SVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       subAssign( ~lhs, rhs.sv_ );
@@ -551,6 +562,8 @@ class SVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       subAssign( ~lhs, rhs.sv_ );
@@ -576,6 +589,8 @@ class SVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       multAssign( ~lhs, rhs.sv_ );
@@ -601,6 +616,8 @@ class SVecSerialExpr
    {
       BLAZE_FUNCTION_TRACE;
 
+      waitForAsyncAssignments( ~lhs, rhs );
+
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       multAssign( ~lhs, rhs.sv_ );
@@ -58,6 +58,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -72,6 +73,7 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -150,10 +152,10 @@ class TDVecSMatMultExpr
    using RightOperand = If_t< IsExpression_v<MT>, const MT, const MT& >;
 
    //! Composite type of the left-hand side dense vector expression.
-   using LT = If_t< evaluateVector, const VRT, VCT >;
+   using LT = If_t< evaluateVector, const TemporaryType_t<VRT>, VCT >;
 
    //! Composite type of the right-hand side sparse matrix expression.
-   using RT = If_t< evaluateMatrix, const MRT, MCT >;
+   using RT = If_t< evaluateMatrix, const TemporaryType_t<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -294,7 +296,7 @@ class TDVecSMatMultExpr
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( size() > SMP_TDVECSMATMULT_THRESHOLD );
+      return ( size() > smpThreshold( SMP_TDVECSMATMULT ) );
    }
    //**********************************************************************************************
 
@@ -398,7 +400,7 @@ class TDVecSMatMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -568,7 +570,7 @@ class TDVecSMatMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -600,7 +602,7 @@ class TDVecSMatMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -673,7 +675,7 @@ class TDVecSMatMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -788,7 +790,7 @@ class TDVecSMatMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -823,7 +825,7 @@ class TDVecSMatMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpDivAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -58,6 +58,8 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/sparse/MergeKernels.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -65,6 +67,7 @@
 #include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/TemporaryType.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -143,10 +146,10 @@ class TSVecTSMatMultExpr
    using RightOperand = If_t< IsExpression_v<MT>, const MT, const MT& >;
 
    //! Type for the assignment of the left-hand side sparse vector operand.
-   using LT = If_t< evaluateVector, const VRT, VCT >;
+   using LT = If_t< evaluateVector, const TemporaryType_t<VRT>, VCT >;
 
    //! Type for the assignment of the right-hand side sparse matrix operand.
-   using RT = If_t< evaluateMatrix, const MRT, MCT >;
+   using RT = If_t< evaluateMatrix, const TemporaryType_t<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -266,7 +269,7 @@ class TSVecTSMatMultExpr
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( size() > SMP_TSVECSMATMULT_THRESHOLD );
+      return ( size() > smpThreshold( SMP_TSVECSMATMULT ) );
    }
    //**********************************************************************************************
 
@@ -337,54 +340,14 @@ class TSVecTSMatMultExpr
            , typename MT1 >  // Type of the right-hand side matrix operand
    static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      const auto vend( x.end() );
-
-      for( size_t j=0UL; j<A.columns(); ++j )
-      {
-         const auto mend ( A.end(j)   );
-         auto       melem( A.begin(j) );
-
-         if( melem == mend ) continue;
-
-         auto velem( x.begin() );
-
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else {
-               y[j] = velem->value() * melem->value();
-               ++velem;
-               ++melem;
-               break;
-            }
-         }
-
-         if( velem != vend && melem != mend )
-         {
-            while( true ) {
-               if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else {
-                  y[j] += velem->value() * melem->value();
-                  ++velem;
-                  if( velem == vend ) break;
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-            }
-         }
+      // Using an index bitmap of x in case it has more non-zeros than an average column of A
+      const bool bitmap( useIntersectionBitmap( x.nonZeros(), x.size(), A.columns(), A.nonZeros() ) );
+      const auto probe( makeIntersectionProbe( x.begin(), x.end(), x.size(), bitmap ) );
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         probe.intersect( A.begin(j), A.end(j), [&]( const auto& m, const auto& v ){
+            y[j] += v->value() * m->value();
+         } );
       }
    }
    /*! \endcond */
@@ -425,56 +388,25 @@ class TSVecTSMatMultExpr
 
       // Performing the sparse vector-sparse matrix multiplication
       ElementType accu;
-      const auto vend( x.end() );
+      // Using an index bitmap of x in case it has more non-zeros than an average column of A
+      const bool bitmap( useIntersectionBitmap( x.nonZeros(), x.size(), A.columns(), A.nonZeros() ) );
+      const auto probe( makeIntersectionProbe( x.begin(), x.end(), x.size(), bitmap ) );
 
-      for( size_t j=0UL; j<A.columns(); ++j )
+      for( size_t j=0UL; j<(~lhs).size(); ++j )
       {
-         const auto mend ( A.end(j)   );
-         auto       melem( A.begin(j) );
-
-         if( melem == mend ) continue;
-
-         auto velem( x.begin() );
+         bool empty( true );
 
          reset( accu );
 
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
+         probe.intersect( A.begin(j), A.end(j), [&]( const auto& m, const auto& v ){
+            if( empty ) {
+               accu = v->value() * m->value();
+               empty = false;
             }
             else {
-               accu = velem->value() * melem->value();
-               ++velem;
-               ++melem;
-               break;
-            }
-         }
-
-         if( velem != vend && melem != mend )
-         {
-            while( true ) {
-               if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else {
-                  accu += velem->value() * melem->value();
-                  ++velem;
-                  if( velem == vend ) break;
-                  ++melem;
-                  if( melem == mend ) break;
-               }
+               accu += v->value() * m->value();
             }
-         }
+         } );
 
          if( !isDefault( accu ) )
             (~lhs).insert( j, accu );
@@ -541,34 +473,14 @@ class TSVecTSMatMultExpr
            , typename MT1 >  // Type of the right-hand side matrix operand
    static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      const auto vend( x.end() );
-
-      for( size_t j=0UL; j<A.columns(); ++j )
-      {
-         const auto mend ( A.end(j)   );
-         auto       melem( A.begin(j) );
-
-         if( melem == mend ) continue;
-
-         auto velem( x.begin() );
-
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else {
-               y[j] += velem->value() * melem->value();
-               ++velem;
-               if( velem == vend ) break;
-               ++melem;
-               if( melem == mend ) break;
-            }
-         }
+      // Using an index bitmap of x in case it has more non-zeros than an average column of A
+      const bool bitmap( useIntersectionBitmap( x.nonZeros(), x.size(), A.columns(), A.nonZeros() ) );
+      const auto probe( makeIntersectionProbe( x.begin(), x.end(), x.size(), bitmap ) );
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         probe.intersect( A.begin(j), A.end(j), [&]( const auto& m, const auto& v ){
+            y[j] += v->value() * m->value();
+         } );
       }
    }
    /*! \endcond */
@@ -636,34 +548,14 @@ class TSVecTSMatMultExpr
            , typename MT1 >  // Type of the right-hand side matrix operand
    static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      const auto vend( x.end() );
-
-      for( size_t j=0UL; j<A.columns(); ++j )
-      {
-         const auto mend ( A.end(j)   );
-         auto       melem( A.begin(j) );
-
-         if( melem == mend ) continue;
-
-         auto velem( x.begin() );
-
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else {
-               y[j] -= velem->value() * melem->value();
-               ++velem;
-               if( velem == vend ) break;
-               ++melem;
-               if( melem == mend ) break;
-            }
-         }
+      // Using an index bitmap of x in case it has more non-zeros than an average column of A
+      const bool bitmap( useIntersectionBitmap( x.nonZeros(), x.size(), A.columns(), A.nonZeros() ) );
+      const auto probe( makeIntersectionProbe( x.begin(), x.end(), x.size(), bitmap ) );
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         probe.intersect( A.begin(j), A.end(j), [&]( const auto& m, const auto& v ){
+            y[j] -= v->value() * m->value();
+         } );
       }
    }
    /*! \endcond */
@@ -697,7 +589,7 @@ class TSVecTSMatMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryType_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -875,7 +767,7 @@ class TSVecTSMatMultExpr
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
-      const ResultType tmp( rhs );
+      const TemporaryType_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    /*! \endcond */
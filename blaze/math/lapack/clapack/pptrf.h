@@ -0,0 +1,293 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/pptrf.h
+//  \brief Header file for the CLAPACK pptrf wrapper functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_PPTRF_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_PPTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(INTEL_MKL_VERSION)
+extern "C" {
+
+void spptrf_( char* uplo, int* n, float* A, int* info, blaze::fortran_charlen_t nuplo );
+void dpptrf_( char* uplo, int* n, double* A, int* info, blaze::fortran_charlen_t nuplo );
+void cpptrf_( char* uplo, int* n, float* A, int* info, blaze::fortran_charlen_t nuplo );
+void zpptrf_( char* uplo, int* n, double* A, int* info, blaze::fortran_charlen_t nuplo );
+
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK PACKED LLH (CHOLESKY) DECOMPOSITION FUNCTIONS (PPTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK packed LLH (Cholesky) decomposition functions (pptrf) */
+//@{
+void pptrf( char uplo, int n, float* A, int* info );
+
+void pptrf( char uplo, int n, double* A, int* info );
+
+void pptrf( char uplo, int n, complex<float>* A, int* info );
+
+void pptrf( char uplo, int n, complex<double>* A, int* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given positive definite single
+//        precision
+//        matrix in packed storage format.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' if the lower part of the matrix is stored, \c 'U' if the upper part is stored.
+// \param n The number of rows/columns of the matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision packed matrix.
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the Cholesky decomposition of a symmetric positive definite single
+// precision matrix in packed column-major storage format based on the LAPACK spptrf() function. The
+// decomposition has the form
+
+                      \f[ A = U^{T} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{T} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular matrix and \c L is a lower triangular matrix. The resulting
+// decomposition is stored within \a A in the same packed storage format.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite.
+//
+// For more information on the spptrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pptrf( char uplo, int n, float* A, int* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+#endif
+
+   spptrf_( &uplo, &n, A, info, blaze::fortran_charlen_t(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given positive definite double
+//        precision
+//        matrix in packed storage format.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' if the lower part of the matrix is stored, \c 'U' if the upper part is stored.
+// \param n The number of rows/columns of the matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision packed matrix.
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the Cholesky decomposition of a symmetric positive definite double
+// precision matrix in packed column-major storage format based on the LAPACK dpptrf() function. The
+// decomposition has the form
+
+                      \f[ A = U^{T} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{T} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular matrix and \c L is a lower triangular matrix. The resulting
+// decomposition is stored within \a A in the same packed storage format.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite.
+//
+// For more information on the dpptrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pptrf( char uplo, int n, double* A, int* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+#endif
+
+   dpptrf_( &uplo, &n, A, info, blaze::fortran_charlen_t(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given positive definite single
+//        precision complex
+//        matrix in packed storage format.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' if the lower part of the matrix is stored, \c 'U' if the upper part is stored.
+// \param n The number of rows/columns of the matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision complex packed matrix.
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the Cholesky decomposition of a Hermitian positive definite single
+// precision complex matrix in packed column-major storage format based on the LAPACK cpptrf()
+// function. The decomposition has the form
+
+                      \f[ A = U^{H} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{H} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular matrix and \c L is a lower triangular matrix. The resulting
+// decomposition is stored within \a A in the same packed storage format.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite.
+//
+// For more information on the cpptrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pptrf( char uplo, int n, complex<float>* A, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+   using ET = MKL_Complex8;
+#else
+   using ET = float;
+#endif
+
+   cpptrf_( &uplo, &n, reinterpret_cast<ET*>( A ), info, blaze::fortran_charlen_t(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given positive definite double
+//        precision complex
+//        matrix in packed storage format.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' if the lower part of the matrix is stored, \c 'U' if the upper part is stored.
+// \param n The number of rows/columns of the matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision complex packed matrix.
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the Cholesky decomposition of a Hermitian positive definite double
+// precision complex matrix in packed column-major storage format based on the LAPACK zpptrf()
+// function. The decomposition has the form
+
+                      \f[ A = U^{H} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{H} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular matrix and \c L is a lower triangular matrix. The resulting
+// decomposition is stored within \a A in the same packed storage format.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite.
+//
+// For more information on the zpptrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pptrf( char uplo, int n, complex<double>* A, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+   using ET = MKL_Complex16;
+#else
+   using ET = double;
+#endif
+
+   zpptrf_( &uplo, &n, reinterpret_cast<ET*>( A ), info, blaze::fortran_charlen_t(1) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,291 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/pptrs.h
+//  \brief Header file for the CLAPACK pptrs wrapper functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_PPTRS_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_PPTRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(INTEL_MKL_VERSION)
+extern "C" {
+
+void spptrs_( char* uplo, int* n, int* nrhs, float* A, float* B, int* ldb, int* info,
+              blaze::fortran_charlen_t nuplo );
+void dpptrs_( char* uplo, int* n, int* nrhs, double* A, double* B, int* ldb, int* info,
+              blaze::fortran_charlen_t nuplo );
+void cpptrs_( char* uplo, int* n, int* nrhs, float* A, float* B, int* ldb, int* info,
+              blaze::fortran_charlen_t nuplo );
+void zpptrs_( char* uplo, int* n, int* nrhs, double* A, double* B, int* ldb, int* info,
+              blaze::fortran_charlen_t nuplo );
+
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK PACKED LLH-BASED SUBSTITUTION FUNCTIONS (PPTRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK packed LLH-based substitution functions (pptrs) */
+//@{
+void pptrs( char uplo, int n, int nrhs, const float* A, float* B, int ldb, int* info );
+
+void pptrs( char uplo, int n, int nrhs, const double* A, double* B, int ldb, int* info );
+
+void pptrs( char uplo, int n, int nrhs, const complex<float>* A,
+            complex<float>* B, int ldb, int* info );
+
+void pptrs( char uplo, int n, int nrhs, const complex<double>* A,
+            complex<double>* B, int ldb, int* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a positive definite single precision
+//        linear system of equations (\f$ A*X=B \f$) with a system matrix in packed storage format.
+// \ingroup lapack_substitution
+//
+// \param uplo \c 'L' if the lower part of the matrix is stored, \c 'U' if the upper part is stored.
+// \param n The number of rows/columns of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision packed matrix.
+// \param B Pointer to the first element of the single precision column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK spptrs() function to perform the substitution step to compute
+// the solution to the positive definite system of linear equations \f$ A*X=B \f$, where \a A is
+// a \a n-by-\a n packed matrix that has already been factorized by the spptrf() function and
+// \a X and \a B are column-major \a n-by-\a nrhs matrices.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the spptrs() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pptrs( char uplo, int n, int nrhs, const float* A, float* B, int ldb, int* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+#endif
+
+   spptrs_( &uplo, &n, &nrhs, const_cast<float*>( A ), B, &ldb, info,
+            blaze::fortran_charlen_t(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a positive definite double precision
+//        linear system of equations (\f$ A*X=B \f$) with a system matrix in packed storage format.
+// \ingroup lapack_substitution
+//
+// \param uplo \c 'L' if the lower part of the matrix is stored, \c 'U' if the upper part is stored.
+// \param n The number of rows/columns of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision packed matrix.
+// \param B Pointer to the first element of the double precision column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK dpptrs() function to perform the substitution step to compute
+// the solution to the positive definite system of linear equations \f$ A*X=B \f$, where \a A is
+// a \a n-by-\a n packed matrix that has already been factorized by the dpptrf() function and
+// \a X and \a B are column-major \a n-by-\a nrhs matrices.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the dpptrs() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pptrs( char uplo, int n, int nrhs, const double* A, double* B, int ldb, int* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+#endif
+
+   dpptrs_( &uplo, &n, &nrhs, const_cast<double*>( A ), B, &ldb, info,
+            blaze::fortran_charlen_t(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a positive definite single precision
+//        complex linear system of equations (\f$ A*X=B \f$) with a system matrix in packed
+//        storage format.
+// \ingroup lapack_substitution
+//
+// \param uplo \c 'L' if the lower part of the matrix is stored, \c 'U' if the upper part is stored.
+// \param n The number of rows/columns of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision complex packed matrix.
+// \param B Pointer to the first element of the single precision complex column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK cpptrs() function to perform the substitution step to compute
+// the solution to the positive definite system of linear equations \f$ A*X=B \f$, where \a A is
+// a \a n-by-\a n packed matrix that has already been factorized by the cpptrf() function and
+// \a X and \a B are column-major \a n-by-\a nrhs matrices.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the cpptrs() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pptrs( char uplo, int n, int nrhs, const complex<float>* A,
+                   complex<float>* B, int ldb, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+   using ET = MKL_Complex8;
+#else
+   using ET = float;
+#endif
+
+   cpptrs_( &uplo, &n, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ),
+            reinterpret_cast<ET*>( B ), &ldb, info, blaze::fortran_charlen_t(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a positive definite double precision
+//        complex linear system of equations (\f$ A*X=B \f$) with a system matrix in packed
+//        storage format.
+// \ingroup lapack_substitution
+//
+// \param uplo \c 'L' if the lower part of the matrix is stored, \c 'U' if the upper part is stored.
+// \param n The number of rows/columns of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision complex packed matrix.
+// \param B Pointer to the first element of the double precision complex column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK zpptrs() function to perform the substitution step to compute
+// the solution to the positive definite system of linear equations \f$ A*X=B \f$, where \a A is
+// a \a n-by-\a n packed matrix that has already been factorized by the zpptrf() function and
+// \a X and \a B are column-major \a n-by-\a nrhs matrices.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the zpptrs() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pptrs( char uplo, int n, int nrhs, const complex<double>* A,
+                   complex<double>* B, int ldb, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+   using ET = MKL_Complex16;
+#else
+   using ET = double;
+#endif
+
+   zpptrs_( &uplo, &n, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ),
+            reinterpret_cast<ET*>( B ), &ldb, info, blaze::fortran_charlen_t(1) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
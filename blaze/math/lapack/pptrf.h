@@ -0,0 +1,147 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/pptrf.h
+//  \brief Header file for the LAPACK packed Cholesky decomposition functions (pptrf)
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_PPTRF_H_
+#define _BLAZE_MATH_LAPACK_PPTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/lapack/clapack/pptrf.h>
+#include <blaze/math/PackingFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK PACKED LLH (CHOLESKY) DECOMPOSITION FUNCTIONS (PPTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK packed LLH (Cholesky) decomposition functions (pptrf) */
+//@{
+template< typename Type, PackingFlag PF, bool SO >
+void pptrf( PackedMatrix<Type,PF,SO>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given positive definite packed
+//        matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the Cholesky decomposition of a symmetric (real) or Hermitian positive
+// definite matrix in packed storage format based on the LAPACK pptrf() functions. The
+// decomposition has the form
+
+                      \f[ A = U^{H} U, \f]
+
+// where \c U is an upper triangular matrix (\f$ A^T = U^{H} U \f$ in case of a row-major
+// matrix). The resulting decomposition is stored within \a A in the same packed storage format
+// and can be used as input for the pptrs() and pptri() functions. Note that the function only
+// works for matrices with \c float, \c double, \c complex<float>, or \c complex<double> element
+// type and that complex matrices have to be Hermitian. The attempt to call the function with
+// matrices of any other element type or structure results in a compile time error!
+//
+// The function uses the fact that the stored triangle of a symmetric or Hermitian PackedMatrix
+// corresponds to the upper part of a column-major matrix in the packed storage format of LAPACK
+// (in case of a row-major matrix to the upper part of its transpose).
+//
+// The function fails if the given matrix is not positive definite. In this case a
+// \a std::runtime_error exception is thrown.
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+
+   PackedMatrix<double,packedSymmetric> A( 4UL, 4UL );
+   // ... Initialization
+
+   pptrf( A );
+   \endcode
+
+// For more information on the pptrf() functions (i.e. spptrf(), dpptrf(), cpptrf(), and zpptrf())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order of the matrix
+inline void pptrf( PackedMatrix<Type,PF,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   BLAZE_STATIC_ASSERT( PF == packedHermitian || ( PF == packedSymmetric && !IsComplex_v<Type> ) );
+
+   int n   ( numeric_cast<int>( A.rows() ) );
+   int info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   pptrf( 'U', n, A.data(), &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for Cholesky decomposition" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,138 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/pptri.h
+//  \brief Header file for the LAPACK packed matrix Cholesky-based inversion functions (pptri)
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_PPTRI_H_
+#define _BLAZE_MATH_LAPACK_PPTRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/lapack/clapack/pptri.h>
+#include <blaze/math/PackingFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK PACKED LLH-BASED INVERSION FUNCTIONS (PPTRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK packed LLH-based inversion functions (pptri) */
+//@{
+template< typename Type, PackingFlag PF, bool SO >
+void pptri( PackedMatrix<Type,PF,SO>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the inversion of the given positive definite packed matrix.
+// \ingroup lapack_inversion
+//
+// \param A The matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function performs the inversion of a symmetric (real) or Hermitian positive definite
+// matrix in packed storage format based on the LAPACK pptri() functions. The matrix \a A has to
+// be already factorized by the pptrf() functions. The resulting symmetric or Hermitian inverse
+// is stored within \a A in the same packed storage format. Note that the function only works for
+// matrices with \c float, \c double, \c complex<float>, or \c complex<double> element type and
+// that complex matrices have to be Hermitian. The attempt to call the function with matrices of
+// any other element type or structure results in a compile time error!
+//
+// The function fails if the given matrix is singular. In this case a \a std::runtime_error
+// exception is thrown.
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+
+   PackedMatrix<double,packedSymmetric> A( 4UL, 4UL );
+   // ... Initialization
+
+   pptrf( A );
+   pptri( A );
+   \endcode
+
+// For more information on the pptri() functions (i.e. spptri(), dpptri(), cpptri(), and zpptri())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename Type   // Data type of the matrix
+        , PackingFlag PF  // Structure of the matrix
+        , bool SO >       // Storage order of the matrix
+inline void pptri( PackedMatrix<Type,PF,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   BLAZE_STATIC_ASSERT( PF == packedHermitian || ( PF == packedSymmetric && !IsComplex_v<Type> ) );
+
+   int n   ( numeric_cast<int>( A.rows() ) );
+   int info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   pptri( 'U', n, A.data(), &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix inversion" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,248 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/pptrs.h
+//  \brief Header file for the LAPACK packed positive definite backward substitution functions (pptrs)
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_PPTRS_H_
+#define _BLAZE_MATH_LAPACK_PPTRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/Contiguous.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/lapack/clapack/pptrs.h>
+#include <blaze/math/PackingFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK PACKED LLH-BASED SUBSTITUTION FUNCTIONS (PPTRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK packed LLH-based substitution functions (pptrs) */
+//@{
+template< typename Type, PackingFlag PF, bool SO, typename VT, bool TF >
+void pptrs( const PackedMatrix<Type,PF,SO>& A, DenseVector<VT,TF>& b );
+
+template< typename Type, PackingFlag PF, bool SO, typename MT, bool SO2 >
+void pptrs( const PackedMatrix<Type,PF,SO>& A, DenseMatrix<MT,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a positive definite linear system
+//        of equations (\f$ A*x=b \f$) with a packed system matrix.
+// \ingroup lapack_substitution
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function uses the LAPACK pptrs() functions to perform the substitution step to compute
+// the solution to the system of positive definite linear equations:
+//
+//  - \f$ A  *x=b \f$ if \a A is column-major
+//  - \f$ A^T*x=b \f$ if \a A is row-major
+//
+// In this context the positive definite system matrix \a A is a \a n-by-\a n packed matrix that
+// has already been factorized by the pptrf() functions and \a x and \a b are n-dimensional
+// vectors. Note that the function only works for matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type and that complex matrices have to be
+// Hermitian. The attempt to call the function with matrices of any other element type or
+// structure results in a compile time error!
+//
+// If the function exits successfully, the vector \a b contains the solution of the linear system
+// of equations. The function fails if the size of the given vector does not match the size of
+// the system matrix. In this case a \a std::invalid_argument exception is thrown.
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::DynamicVector;
+   using blaze::packedSymmetric;
+   using blaze::columnMajor;
+
+   PackedMatrix<double,packedSymmetric,columnMajor> A( 4UL, 4UL );  // The system matrix A
+   DynamicVector<double> b( 4UL );                                  // The right-hand side vector b
+   // ... Initialization
+
+   PackedMatrix<double,packedSymmetric,columnMajor> D( A );  // Temporary matrix to be decomposed
+   DynamicVector<double> x( b );                             // Temporary vector for the solution
+
+   pptrf( D );
+   pptrs( D, x );
+
+   assert( A * x == b );
+   \endcode
+
+// For more information on the pptrs() functions (i.e. spptrs(), dpptrs(), cpptrs(), and zpptrs()),
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename Type   // Data type of the system matrix
+        , PackingFlag PF  // Structure of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT     // Type of the right-hand side vector
+        , bool TF >       // Transpose flag of the right-hand side vector
+inline void pptrs( const PackedMatrix<Type,PF,SO>& A, DenseVector<VT,TF>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   BLAZE_STATIC_ASSERT( PF == packedHermitian || ( PF == packedSymmetric && !IsComplex_v<Type> ) );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT> );
+
+   if( (~b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   int n   ( numeric_cast<int>( A.rows() ) );
+   int nrhs( 1 );
+   int ldb ( numeric_cast<int>( (~b).size() ) );
+   int info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   pptrs( 'U', n, nrhs, A.data(), (~b).data(), ldb, &info );
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid function argument" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a positive definite linear system
+//        of equations (\f$ A*X=B \f$) with a packed system matrix.
+// \ingroup lapack_substitution
+//
+// \param A The system matrix.
+// \param B The matrix of right-hand sides.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// This function uses the LAPACK pptrs() functions to perform the substitution step to compute
+// the solution to a system of positive definite linear equations:
+//
+//  - \f$ A  *X  =B   \f$ if both \a A and \a B are column-major
+//  - \f$ A^T*X  =B   \f$ if \a A is row-major and \a B is column-major
+//  - \f$ A  *X^T=B^T \f$ if \a A is column-major and \a B is row-major
+//  - \f$ A^T*X^T=B^T \f$ if both \a A and \a B are row-major
+//
+// In this context the positive definite system matrix \a A is a \a n-by-\a n packed matrix that
+// has already been factorized by the pptrf() functions and \a X and \a B are either row-major
+// \a m-by-\a n matrices or column-major \a n-by-\a m matrices. Note that the function only
+// works for matrices with \c float, \c double, \c complex<float>, or \c complex<double>
+// element type and that complex matrices have to be Hermitian. The attempt to call the function
+// with matrices of any other element type or structure results in a compile time error!
+//
+// If the function exits successfully, the matrix \a B contains the solution of the linear system
+// of equations. The function fails if the sizes of the two given matrices do not match. In this
+// case a \a std::invalid_argument exception is thrown.
+//
+// For more information on the pptrs() functions (i.e. spptrs(), dpptrs(), cpptrs(), and zpptrs()),
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename Type   // Data type of the system matrix
+        , PackingFlag PF  // Structure of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline void pptrs( const PackedMatrix<Type,PF,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   BLAZE_STATIC_ASSERT( PF == packedHermitian || ( PF == packedSymmetric && !IsComplex_v<Type> ) );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT> );
+
+   int n   ( numeric_cast<int>( A.rows() ) );
+   int mrhs( numeric_cast<int>( SO2 ? (~B).rows() : (~B).columns() ) );
+   int nrhs( numeric_cast<int>( SO2 ? (~B).columns() : (~B).rows() ) );
+   int ldb ( numeric_cast<int>( (~B).spacing() ) );
+   int info( 0 );
+
+   if( n != mrhs ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( n == 0 ) {
+      return;
+   }
+
+   pptrs( 'U', n, nrhs, A.data(), (~B).data(), ldb, &info );
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid function argument" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,610 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/AssignmentGroup.h
+//  \brief Header file for the AssignmentGroup class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_ASSIGNMENTGROUP_H_
+#define _BLAZE_MATH_SMP_ASSIGNMENTGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/math/typetraits/IsSerialExpr.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_HPX_PARALLEL_MODE
+#  include <hpx/include/parallel_for_loop.hpp>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Group of independent assignments that are evaluated concurrently.
+// \ingroup smp
+//
+// The AssignmentGroup class collects several independent assignments and evaluates them within
+// a single parallel section. Assignments that are too small to be parallelized on their own
+// (i.e. that fall below the according SMP threshold) are executed as whole tasks concurrently
+// to each other, whereas large assignments are partitioned among all threads as usual:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x1, x2, y1, y2, u, v, z;
+   // ... Resizing and initialization
+
+   blaze::AssignmentGroup group;
+   group.add( y1, A * x1 );
+   group.add( y2, B * x2 );
+   group.add( z, u + v );
+   group.run();  // Evaluates all three assignments concurrently
+   \endcode
+
+// The run() function is semantically equivalent to performing all assignments one after another.
+// However, all assignments of a group have to be independent, i.e. the target of an assignment
+// must not be an operand of any other assignment of the same group. Additionally, all targets
+// and operands have to be kept alive until the run() function returns.
+//
+// Assignments to sparse or restricted targets (as for instance symmetric matrices), assignments
+// whose target is an operand of the right-hand side expression, and assignments that require the
+// evaluation of intermediate results are not evaluated concurrently, but are performed one after
+// another before the concurrent evaluation of the remaining assignments. In case no shared-memory
+// parallelization is active or in case a serial section is active, all assignments are performed
+// one after another.
+//
+// In case of the C++11 and Boost thread parallelization, all assignments are joined by a single
+// wait. In case of the OpenMP parallelization, all assignments are evaluated within a single
+// parallel region. In case of the HPX parallelization, the small assignments are executed via
+// a single parallel loop, followed by the large assignments.
+*/
+class AssignmentGroup
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline AssignmentGroup();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT1, typename VT2, bool TF >
+   void add( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void add( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   inline size_t size() const noexcept;
+   inline void   run ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class Entry*************************************************************************
+   /*!\brief Base class of all assignments of a group.
+   */
+   struct Entry
+   {
+      virtual ~Entry() = default;
+      virtual bool prepare  () = 0;
+      virtual bool isLarge  () const = 0;
+      virtual void execute  () = 0;
+      virtual void partition() = 0;
+   };
+   //**********************************************************************************************
+
+   //**Private class Assignment********************************************************************
+   /*!\brief Assignment of a source operand to a target operand within a group.
+   //
+   // The Assignment class template represents an assignment that can be evaluated concurrently
+   // to other assignments, i.e. an assignment to a non-restricted dense target whose operands
+   // are SMP-assignable.
+   */
+   template< typename Target    // Type of the target operand
+           , typename Source    // Type of the source operand
+           , bool Concurrent >  // Flag for concurrent evaluation
+   struct Assignment : public Entry
+   {
+      //**Type definitions*************************************************************************
+      //! Composite type of the source operand.
+      using Operand = If_t< IsExpression_v<Source>, const Source, const Source& >;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Assignment class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be assigned to the target.
+      */
+      explicit inline Assignment( Target& target, const Source& source )
+         : target_( target )  // The target operand
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Prepare function*************************************************************************
+      /*!\brief Prepares the target for the concurrent evaluation of the assignment.
+      //
+      // \return \a true in case the assignment has to be evaluated, \a false if not.
+      // \exception std::invalid_argument Invalid assignment.
+      //
+      // Before the target is accessed, all pending asynchronous assignments conflicting with the
+      // assignment are completed (see the async_assign() functions). In case the target is an
+      // operand of the source, the assignment is performed immediately. Otherwise the target is
+      // resized (and reset in case of a sparse source).
+      */
+      bool prepare() override {
+         waitForAsyncAssignments( target_, source_ );
+
+         if( source_.isAliased( &target_ ) ) {
+            target_ = source_;
+            return false;
+         }
+
+         fit( target_, source_ );
+
+         if( IsSparseVector_v<Source> || IsSparseMatrix_v<Source> ) {
+            reset( target_ );
+         }
+
+         return true;
+      }
+      //*******************************************************************************************
+
+      //**IsLarge function*************************************************************************
+      /*!\brief Returns whether the assignment is large enough to be partitioned.
+      //
+      // \return \a true in case the assignment should be partitioned, \a false if not.
+      */
+      bool isLarge() const override {
+         return !IsSerialExpr_v<Source> && source_.canSMPAssign();
+      }
+      //*******************************************************************************************
+
+      //**Execute function*************************************************************************
+      /*!\brief Performs the complete assignment in the calling thread.
+      //
+      // \return void
+      */
+      void execute() override {
+         assign( target_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Partition function***********************************************************************
+      /*!\brief Performs the assignment partitioned among all threads.
+      //
+      // \return void
+      */
+      void partition() override {
+#if BLAZE_HPX_PARALLEL_MODE
+         hpxAssign( target_, source_, []( auto& a, const auto& b ){ assign( a, b ); } );
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+         threadAssign( target_, source_, []( auto& a, const auto& b ){ assign( a, b ); } );
+#elif BLAZE_OPENMP_PARALLEL_MODE
+         openmpAssign( target_, source_, []( auto& a, const auto& b ){ assign( a, b ); } );
+#else
+         assign( target_, source_ );
+#endif
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target& target_;  //!< The target operand.
+      Operand source_;  //!< The source operand.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Assignment********************************************************************
+   /*!\brief Assignment of a source operand to a target operand within a group.
+   //
+   // This specialization of the Assignment class template represents an assignment that cannot
+   // be evaluated concurrently to other assignments. It is performed immediately by the prepare()
+   // function.
+   */
+   template< typename Target    // Type of the target operand
+           , typename Source >  // Type of the source operand
+   struct Assignment<Target,Source,false> : public Entry
+   {
+      //**Type definitions*************************************************************************
+      //! Composite type of the source operand.
+      using Operand = If_t< IsExpression_v<Source>, const Source, const Source& >;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Assignment class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be assigned to the target.
+      */
+      explicit inline Assignment( Target& target, const Source& source )
+         : target_( target )  // The target operand
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Performs the assignment.
+      //
+      // \return \a false.
+      */
+      bool prepare() override {
+         target_ = source_;
+         return false;
+      }
+
+      bool isLarge() const override { return false; }
+      void execute() override {}
+      void partition() override {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target& target_;  //!< The target operand.
+      Operand source_;  //!< The source operand.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Entries = std::vector< std::unique_ptr<Entry> >;  //!< Container for the assignments.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT1, typename VT2, bool TF >
+   static void fit( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   static void fit( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   static inline void evaluate( const std::vector<Entry*>& entries );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Entries entries_;  //!< The assignments of the group.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the AssignmentGroup class.
+*/
+inline AssignmentGroup::AssignmentGroup()
+   : entries_()  // The assignments of the group
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adds a vector assignment to the group.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function adds the assignment of the given right-hand side vector (or vector expression)
+// to the given left-hand side vector to the group. The assignment is performed by the next call
+// to the run() function.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of both vectors
+void AssignmentGroup::add( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr bool concurrent( IsDenseVector_v<VT1> && !IsRestricted_v<VT1> &&
+                              IsSMPAssignable_v<VT1> && IsSMPAssignable_v<VT2> &&
+                              !IsSMPAssignable_v< ElementType_t<VT1> > &&
+                              !IsSMPAssignable_v< ElementType_t<VT2> > );
+
+   entries_.push_back( std::make_unique< Assignment<VT1,VT2,concurrent> >( ~lhs, ~rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds a matrix assignment to the group.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function adds the assignment of the given right-hand side matrix (or matrix expression)
+// to the given left-hand side matrix to the group. The assignment is performed by the next call
+// to the run() function.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void AssignmentGroup::add( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr bool concurrent( IsDenseMatrix_v<MT1> && !IsRestricted_v<MT1> &&
+                              IsSMPAssignable_v<MT1> && IsSMPAssignable_v<MT2> &&
+                              !IsSMPAssignable_v< ElementType_t<MT1> > &&
+                              !IsSMPAssignable_v< ElementType_t<MT2> > );
+
+   entries_.push_back( std::make_unique< Assignment<MT1,MT2,concurrent> >( ~lhs, ~rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of pending assignments of the group.
+//
+// \return The number of pending assignments.
+*/
+inline size_t AssignmentGroup::size() const noexcept
+{
+   return entries_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs all pending assignments of the group.
+//
+// \return void
+// \exception std::invalid_argument Invalid assignment.
+//
+// This function performs all assignments that have been added to the group since the last call
+// to the run() function. Afterwards the group is empty and can be reused. In case the size of
+// a target does not match the size of the according source and the target cannot be resized,
+// a \a std::invalid_argument exception is thrown. In this case all remaining assignments of the
+// group are discarded.
+*/
+inline void AssignmentGroup::run()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   Entries entries( std::move( entries_ ) );
+   entries_.clear();
+
+   std::vector<Entry*> pending;
+   pending.reserve( entries.size() );
+
+   for( const auto& entry : entries ) {
+      if( entry->prepare() )
+         pending.push_back( entry.get() );
+   }
+
+   if( pending.empty() )
+      return;
+
+   if( isSerialSectionActive() ) {
+      for( Entry* entry : pending )
+         entry->execute();
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      evaluate( pending );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the target vector to the size of the source vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of both vectors
+void AssignmentGroup::fit( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   resize( ~lhs, (~rhs).size(), false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the target matrix to the size of the source matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Matrix cannot be resized.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void AssignmentGroup::fit( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   resize( ~lhs, (~rhs).rows(), (~rhs).columns(), false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Concurrent evaluation of the given assignments within the active parallel section.
+//
+// \param entries The prepared assignments.
+// \return void
+*/
+inline void AssignmentGroup::evaluate( const std::vector<Entry*>& entries )
+{
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+#if BLAZE_HPX_PARALLEL_MODE
+
+   using hpx::parallel::for_loop;
+   using hpx::parallel::execution::par;
+
+   std::vector<Entry*> small;
+
+   for( Entry* entry : entries ) {
+      if( !entry->isLarge() )
+         small.push_back( entry );
+   }
+
+   for_loop( par, size_t(0), small.size(), [&](int i)
+   {
+      small[i]->execute();
+   } );
+
+   for( Entry* entry : entries ) {
+      if( entry->isLarge() )
+         entry->partition();
+   }
+
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   size_t position( 0UL );
+
+   TheThreadBackend::defer( true );
+
+   try {
+      for( Entry* entry : entries ) {
+         if( entry->isLarge() )
+            entry->partition();
+         else
+            TheThreadBackend::schedule( position++, [entry](){ entry->execute(); } );
+      }
+   }
+   catch( ... ) {
+      TheThreadBackend::defer( false );
+      TheThreadBackend::join();
+      throw;
+   }
+
+   TheThreadBackend::defer( false );
+   TheThreadBackend::join();
+
+#elif BLAZE_OPENMP_PARALLEL_MODE
+
+   std::vector<Entry*> small, large;
+
+   for( Entry* entry : entries ) {
+      if( entry->isLarge() )
+         large.push_back( entry );
+      else
+         small.push_back( entry );
+   }
+
+   const int n( static_cast<int>( small.size() ) );
+
+#pragma omp parallel shared( small, large )
+   {
+#pragma omp for schedule(dynamic,1) nowait
+      for( int i=0; i<n; ++i )
+         small[i]->execute();
+
+      for( Entry* entry : large )
+         entry->partition();
+   }
+
+#else
+
+   for( Entry* entry : entries )
+      entry->execute();
+
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
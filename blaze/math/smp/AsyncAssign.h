@@ -0,0 +1,785 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/AsyncAssign.h
+//  \brief Header file for the asynchronous assignment functionality
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_ASYNCASSIGN_H_
+#define _BLAZE_MATH_SMP_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/ExecutionPolicy.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+
+#if BLAZE_HPX_PARALLEL_MODE
+#  include <hpx/include/lcos.hpp>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for an asynchronous assignment.
+// \ingroup smp
+//
+// The AsyncAssignment class represents a handle for an asynchronous assignment started via the
+// async_assign() function. It provides the functionality to query the state of the assignment
+// and to wait for its completion:
+
+   \code
+   blaze::DynamicMatrix<double> A( 5000UL, 5000UL );
+   blaze::DynamicVector<double> x( 5000UL ), y;
+   // ... Initialization of A and x
+
+   blaze::AsyncAssignment f = blaze::async_assign( y, A * x );
+
+   // ... Communication or I/O not involving A, x, or y
+
+   f.wait();  // Waiting for the completion of the assignment
+   \endcode
+
+// In case the assignment fails (as for instance due to non-matching sizes), the exception is
+// rethrown by the wait() function. The destructor of an AsyncAssignment waits for the completion
+// of the assignment, but discards a potential exception.
+//
+// In case the HPX-based parallelization is active, the handle additionally provides access to
+// the HPX future of the assignment via the future() function. This future can be used to attach
+// application tasks to the completion of the assignment (e.g. via \c hpx::dataflow()) or to let
+// a subsequent asynchronous assignment depend on an application task (see async_assign()).
+*/
+class AsyncAssignment
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline AsyncAssignment() noexcept;
+   explicit inline AsyncAssignment( AsyncExecutor::StatePtr state ) noexcept;
+   inline AsyncAssignment( AsyncAssignment&& f ) noexcept;
+   AsyncAssignment( const AsyncAssignment& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~AsyncAssignment();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline AsyncAssignment& operator=( AsyncAssignment&& f ) noexcept;
+   AsyncAssignment& operator=( const AsyncAssignment& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isValid() const noexcept;
+   inline bool isReady() const;
+   inline void wait();
+
+#if BLAZE_HPX_PARALLEL_MODE
+   inline hpx::shared_future<void> future() const;
+#endif
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void complete() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   AsyncExecutor::StatePtr state_;  //!< The completion state of the assignment.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the AsyncAssignment class.
+//
+// The default constructor creates a handle that is not associated with any assignment.
+*/
+inline AsyncAssignment::AsyncAssignment() noexcept
+   : state_()  // The completion state of the assignment
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the AsyncAssignment class.
+//
+// \param state The completion state of the assignment.
+*/
+inline AsyncAssignment::AsyncAssignment( AsyncExecutor::StatePtr state ) noexcept
+   : state_( std::move( state ) )  // The completion state of the assignment
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor of the AsyncAssignment class.
+//
+// \param f The handle to be moved into this instance.
+*/
+inline AsyncAssignment::AsyncAssignment( AsyncAssignment&& f ) noexcept
+   : state_( std::move( f.state_ ) )  // The completion state of the assignment
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the AsyncAssignment class.
+//
+// The destructor waits for the completion of the associated assignment (if any). A potential
+// exception thrown by the assignment is discarded.
+*/
+inline AsyncAssignment::~AsyncAssignment()
+{
+   complete();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for AsyncAssignment.
+//
+// \param f The handle to be moved into this instance.
+// \return Reference to the assigned handle.
+//
+// Before taking over the given assignment, the function waits for the completion of the
+// currently associated assignment (if any).
+*/
+inline AsyncAssignment& AsyncAssignment::operator=( AsyncAssignment&& f ) noexcept
+{
+   if( &f != this ) {
+      complete();
+      state_ = std::move( f.state_ );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the handle is associated with an assignment.
+//
+// \return \a true in case the handle is associated with an assignment, \a false if not.
+*/
+inline bool AsyncAssignment::isValid() const noexcept
+{
+   return state_ != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the associated assignment has been completed.
+//
+// \return \a true in case the assignment has been completed, \a false if not.
+//
+// In case the handle is not associated with any assignment, the function returns \a true.
+*/
+inline bool AsyncAssignment::isReady() const
+{
+   if( state_ == nullptr )
+      return true;
+
+   std::unique_lock<std::mutex> lock( state_->mutex );
+   return state_->done;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of the associated assignment.
+//
+// \return void
+//
+// This function blocks until the associated assignment has been completed. Afterwards the handle
+// is not associated with the assignment anymore. In case the assignment has thrown an exception,
+// the exception is rethrown. In case the handle is not associated with any assignment, the
+// function returns immediately.
+*/
+inline void AsyncAssignment::wait()
+{
+   if( state_ == nullptr )
+      return;
+
+#if BLAZE_HPX_PARALLEL_MODE
+   state_->future.wait();
+#endif
+
+   std::exception_ptr error;
+
+   {
+      std::unique_lock<std::mutex> lock( state_->mutex );
+      while( !state_->done ) {
+         state_->completed.wait( lock );
+      }
+      error = state_->error;
+   }
+
+   state_.reset();
+
+   if( error ) {
+      std::rethrow_exception( error );
+   }
+}
+//*************************************************************************************************
+
+
+#if BLAZE_HPX_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Returns the HPX future of the associated assignment.
+//
+// \return The HPX future of the assignment.
+//
+// This function returns a shared future that becomes ready as soon as the associated assignment
+// has been completed. Note that the future does not convey a potential exception thrown by the
+// assignment; the exception is only rethrown by the wait() function. In case the handle is not
+// associated with any assignment, the function returns a ready future.
+*/
+inline hpx::shared_future<void> AsyncAssignment::future() const
+{
+   if( state_ == nullptr )
+      return hpx::make_ready_future();
+
+   return state_->future;
+}
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of the associated assignment and discards any exception.
+//
+// \return void
+*/
+inline void AsyncAssignment::complete() noexcept
+{
+   try {
+      wait();
+   }
+   catch( ... ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCASSIGNTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single asynchronous assignment.
+// \ingroup smp
+//
+// The AsyncAssignTask class represents a single assignment started via the async_assign()
+// function. It refers to the target of the assignment and stores the right-hand side operand
+// either by reference (in case \a Source is a reference type) or by value. Additionally it
+// stores the execution policy that is active at the time the assignment is started.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only.
+*/
+template< typename Target    // Type of the target
+        , typename Source >  // Type of the stored right-hand side operand
+class AsyncAssignTask
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssignTask class.
+   //
+   // \param target The target of the assignment.
+   // \param source The right-hand side operand to be assigned.
+   */
+   inline AsyncAssignTask( Target& target, Source source )
+      : target_( target )                          // The target of the assignment
+      , source_( std::forward<Source>( source ) )  // The right-hand side operand
+      , policy_( getExecutionPolicy() )            // The execution policy of the assignment
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment with the stored execution policy.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      ExecutionScope scope( policy_ );
+      target_ = source_;
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns whether the given object is an operand of the assignment.
+   //
+   // \param object The address of the object to be checked.
+   // \return \a true in case the object is an operand of the assignment, \a false if not.
+   */
+   inline bool isOperand( const void* object ) const {
+      return source_.isAliased( object );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Target&         target_;  //!< The target of the assignment.
+   Source          source_;  //!< The right-hand side operand.
+   ExecutionPolicy policy_;  //!< The execution policy of the assignment.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+AsyncAssignment async_assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+AsyncAssignment async_assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>&& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment async_assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment async_assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>&& rhs );
+
+#if BLAZE_HPX_PARALLEL_MODE
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+AsyncAssignment async_assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs, hpx::shared_future<void> after );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+AsyncAssignment async_assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>&& rhs, hpx::shared_future<void> after );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment async_assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs, hpx::shared_future<void> after );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment async_assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>&& rhs, hpx::shared_future<void> after );
+#endif
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return Handle for the asynchronous assignment.
+//
+// This function starts the assignment of the given right-hand side vector (or vector expression)
+// to the given left-hand side vector and returns immediately. The assignment is performed by
+// means of the active shared-memory parallelization and is semantically equivalent to
+
+   \code
+   lhs = rhs;
+   \endcode
+
+// An asynchronous assignment is executed after the completion of all previously started
+// asynchronous assignments that write to one of its operands or that read or write its target,
+// whereas independent asynchronous assignments are executed concurrently. Therefore an
+// asynchronous assignment can safely depend on the result of a previous asynchronous assignment.
+// Additionally, every assignment, addition assignment, subtraction assignment, multiplication
+// assignment, division assignment, reduction, in-place transposition, and permutation started by
+// any other thread (including serial operations and operations on serial() expressions) waits for
+// the completion of all previously started asynchronous assignments that write to one of its
+// operands or that read or write its target. Operations that are independent of all pending
+// asynchronous assignments are not blocked.
+//
+// The right-hand side vector is not copied. Instead, the assignment refers to the given vector
+// (or to the operands of the given vector expression). Thus the target and all operands have to
+// outlive the assignment and all other accesses to them, including element access, require an
+// explicit wait for the completion of the assignment. In case the \c BLAZE_USER_ASSERT() macro
+// is active, an element access to the target and a modifying access (i.e. a non-const element
+// access, a call to data() or a resize()) to an operand by the thread that started the assignment
+// before its completion results in an assertion. Since the creation of an expression queries
+// the sizes of its operands, the target of a pending asynchronous assignment may only be used
+// as operand in case it already has its final size:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x, y1( 1000UL ), y2;
+   // ... Resizing and initialization of A, B, and x
+
+   blaze::AsyncAssignment f1 = blaze::async_assign( y1, A * x );
+   blaze::AsyncAssignment f2 = blaze::async_assign( y2, B * y1 );  // Executed after f1
+
+   // ... Communication or I/O not involving A, B, x, y1, or y2
+
+   f2.wait();
+   std::cout << y2[0] << "\n";  // Element access requires an explicit wait
+   \endcode
+
+// The assignment is executed with the execution policy that is active for the calling thread
+// at the time the assignment is started (see the ExecutionPolicy class). In case the HPX-based
+// parallelization is active, the assignment is attached as HPX continuation to the previously
+// started assignments it depends on and the calling thread is never blocked. In case no parallelization is
+// active, the assignment is performed immediately and the returned handle is ready.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+AsyncAssignment async_assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Task = AsyncAssignTask<VT1,const VT2&>;
+
+   const auto task( std::make_shared<Task>( ~lhs, ~rhs ) );
+
+   return AsyncAssignment( AsyncExecutor::instance().submit( task, AsyncExecutor::address( ~lhs ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a temporary vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The temporary right-hand side vector to be assigned.
+// \return Handle for the asynchronous assignment.
+//
+// This function starts the assignment of the given temporary right-hand side vector (or vector
+// expression) to the given left-hand side vector and returns immediately. In contrast to the
+// assignment of an lvalue, the temporary vector is copied into the assignment. In case of a
+// vector expression this only copies the expression object itself, which still refers to its
+// operands. For all further details see the lvalue overload of the async_assign() function.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+AsyncAssignment async_assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>&& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Task = AsyncAssignTask<VT1,VT2>;
+
+   const auto task( std::make_shared<Task>( ~lhs, ~rhs ) );
+
+   return AsyncAssignment( AsyncExecutor::instance().submit( task, AsyncExecutor::address( ~lhs ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return Handle for the asynchronous assignment.
+//
+// This function starts the assignment of the given right-hand side matrix (or matrix expression)
+// to the given left-hand side matrix and returns immediately. The assignment is performed by
+// means of the active shared-memory parallelization and is semantically equivalent to
+
+   \code
+   lhs = rhs;
+   \endcode
+
+// For the details about the ordering and the synchronization of asynchronous assignments see
+// the vector overload of the async_assign() function.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+AsyncAssignment async_assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Task = AsyncAssignTask<MT1,const MT2&>;
+
+   const auto task( std::make_shared<Task>( ~lhs, ~rhs ) );
+
+   return AsyncAssignment( AsyncExecutor::instance().submit( task, AsyncExecutor::address( ~lhs ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a temporary matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The temporary right-hand side matrix to be assigned.
+// \return Handle for the asynchronous assignment.
+//
+// This function starts the assignment of the given temporary right-hand side matrix (or matrix
+// expression) to the given left-hand side matrix and returns immediately. The temporary matrix
+// is copied into the assignment. For all further details see the vector overloads of the
+// async_assign() function.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+AsyncAssignment async_assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>&& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Task = AsyncAssignTask<MT1,MT2>;
+
+   const auto task( std::make_shared<Task>( ~lhs, ~rhs ) );
+
+   return AsyncAssignment( AsyncExecutor::instance().submit( task, AsyncExecutor::address( ~lhs ) ) );
+}
+//*************************************************************************************************
+
+#if BLAZE_HPX_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector after the completion of an HPX future.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \param after The HPX future the assignment depends on.
+// \return Handle for the asynchronous assignment.
+//
+// This function is only available in case the HPX-based parallelization is active. It starts the
+// assignment of the given right-hand side vector (or vector expression) to the given left-hand
+// side vector as soon as both the previously started asynchronous assignments it depends on and
+// the given HPX future have become ready. This allows to embed Blaze assignments into the dataflow graph of an
+// HPX application and to overlap them with other HPX tasks:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x, y( 1000UL ), z( 1000UL );
+   // ... Resizing and initialization of A
+
+   hpx::shared_future<void> input = hpx::async( [&x]() { readInput( x ); } );
+
+   blaze::AsyncAssignment f1 = blaze::async_assign( y, A * x, input );  // Executed after input
+   blaze::AsyncAssignment f2 = blaze::async_assign( z, A * y );         // Executed after f1
+
+   hpx::future<void> output = f2.future().then( [&z]( auto&& ) { writeOutput( z ); } );
+   \endcode
+
+// Note that the right-hand side vector (or vector expression) is created by the calling thread.
+// Therefore the sizes of all operands must already be final at the time the assignment is
+// started. Also note that the given future must not depend on a shared-memory parallel Blaze
+// operation of the calling thread, since every such operation waits for the completion of the
+// previously started asynchronous assignments it conflicts with. For all further details see the
+// two-argument overload of the async_assign() function.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+AsyncAssignment async_assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs, hpx::shared_future<void> after )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Task = AsyncAssignTask<VT1,const VT2&>;
+
+   const auto task( std::make_shared<Task>( ~lhs, ~rhs ) );
+
+   return AsyncAssignment( AsyncExecutor::instance().submit( task, AsyncExecutor::address( ~lhs ), std::move( after ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a temporary vector to a vector after the completion of an HPX future.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The temporary right-hand side vector to be assigned.
+// \param after The HPX future the assignment depends on.
+// \return Handle for the asynchronous assignment.
+//
+// This function is only available in case the HPX-based parallelization is active. The temporary
+// vector is copied into the assignment. For the details see the lvalue overload of this function.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+AsyncAssignment async_assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>&& rhs, hpx::shared_future<void> after )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Task = AsyncAssignTask<VT1,VT2>;
+
+   const auto task( std::make_shared<Task>( ~lhs, ~rhs ) );
+
+   return AsyncAssignment( AsyncExecutor::instance().submit( task, AsyncExecutor::address( ~lhs ), std::move( after ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix after the completion of an HPX future.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param after The HPX future the assignment depends on.
+// \return Handle for the asynchronous assignment.
+//
+// This function is only available in case the HPX-based parallelization is active. It starts the
+// assignment of the given right-hand side matrix (or matrix expression) to the given left-hand
+// side matrix as soon as both the previously started asynchronous assignments it depends on and
+// the given HPX future have become ready. For the details see the vector overload of this function.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+AsyncAssignment async_assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs, hpx::shared_future<void> after )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Task = AsyncAssignTask<MT1,const MT2&>;
+
+   const auto task( std::make_shared<Task>( ~lhs, ~rhs ) );
+
+   return AsyncAssignment( AsyncExecutor::instance().submit( task, AsyncExecutor::address( ~lhs ), std::move( after ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a temporary matrix to a matrix after the completion of an HPX future.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The temporary right-hand side matrix to be assigned.
+// \param after The HPX future the assignment depends on.
+// \return Handle for the asynchronous assignment.
+//
+// This function is only available in case the HPX-based parallelization is active. The temporary
+// matrix is copied into the assignment. For the details see the vector overloads of this function.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+AsyncAssignment async_assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>&& rhs, hpx::shared_future<void> after )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Task = AsyncAssignTask<MT1,MT2>;
+
+   const auto task( std::make_shared<Task>( ~lhs, ~rhs ) );
+
+   return AsyncAssignment( AsyncExecutor::instance().submit( task, AsyncExecutor::address( ~lhs ), std::move( after ) ) );
+}
+//*************************************************************************************************
+#endif
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,926 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/AsyncExecutor.h
+//  \brief Header file for the executor of asynchronous assignments
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_ASYNCEXECUTOR_H_
+#define _BLAZE_MATH_SMP_ASYNCEXECUTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <blaze/math/smp/ExecutionPolicy.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_HPX_PARALLEL_MODE
+#  include <hpx/include/lcos.hpp>
+#  include <hpx/include/threads.hpp>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executor for asynchronous assignments.
+// \ingroup smp
+//
+// The AsyncExecutor class executes every asynchronous assignment (see the async_assign() function)
+// as a separate task. In case of the OpenMP, C++11, or Boost thread parallelization, every
+// assignment is executed by its own thread. Since every assignment is executed by means of the
+// active shared-memory parallelization, this thread only coordinates the execution and the actual
+// work is performed by the threads of the parallelization. In case the HPX-based parallelization
+// is active, every assignment is an HPX task that is attached as continuation to the futures of
+// the assignments it depends on (and optionally to an additional future provided by the
+// application), such that successive assignments form a dataflow graph that is executed by the
+// HPX runtime without any global barrier. In case no parallelization is active, all assignments
+// are executed immediately within the submitting thread.\n
+// For every pending assignment the executor records the target of the assignment, a check for
+// its operands and the submitting thread. A new assignment is executed after the completion of
+// all previously submitted assignments that write to one of its operands or that access its
+// target, whereas independent assignments are executed concurrently. Likewise, any assignment or
+// reduction started by any other thread only waits for those pending assignments that write to
+// one of its operands or that access its target (see the waitForAsyncAssignments() functions).
+// Additionally, this enables the detection of accesses to the target or to the operands of a
+// pending assignment by the submitting thread (see the isPendingTarget() and isPendingOperand()
+// functions).\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only.
+*/
+class AsyncExecutor
+   : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Completion state of a single asynchronous assignment.
+   struct State
+   {
+      std::mutex              mutex;         //!< Synchronization mutex.
+      std::condition_variable completed;     //!< Wait condition for the completion.
+      std::atomic<bool>       done{ false }; //!< Completion flag.
+      std::exception_ptr      error;         //!< The exception thrown by the assignment (if any).
+#if BLAZE_HPX_PARALLEL_MODE
+      hpx::shared_future<void> future;       //!< The future of the assignment.
+      hpx::thread::id          executing;    //!< The HPX thread executing the assignment.
+#endif
+   };
+
+   using StatePtr = std::shared_ptr<State>;                //!< Shared handle to a completion state.
+   using Task     = std::function<void()>;                 //!< Type of a single asynchronous assignment.
+   using Operands = std::function<bool( const void* )>;    //!< Check for the operands of an assignment.
+   using Counter  = std::shared_ptr< std::atomic<size_t> >; //!< Number of pending assignments of a thread.
+
+#if BLAZE_HPX_PARALLEL_MODE
+   using ThreadID = hpx::thread::id;            //!< Type of the identifier of a thread.
+#else
+   using ThreadID = std::thread::id;            //!< Type of the identifier of a thread.
+#endif
+
+   //! Accesses of a single pending assignment.
+   struct Access
+   {
+      StatePtr    state;     //!< The completion state of the assignment.
+      const void* target;    //!< The target of the assignment.
+      Operands    operands;  //!< Check whether a given object is an operand of the assignment.
+      ThreadID    thread;    //!< The submitting thread.
+      Counter     submitted; //!< The number of pending assignments of the submitting thread.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline AsyncExecutor& instance();
+   static inline bool           isPending() noexcept;
+   static inline bool           isPendingTarget ( const void* object );
+   static inline bool           isPendingOperand( const void* object );
+
+   template< typename T >
+   static inline auto address( const T& object ) noexcept -> EnableIf_t< !IsView_v<T>, const void* >;
+
+   template< typename T >
+   static inline auto address( const T& object ) noexcept -> EnableIf_t< IsView_v<T>, const void* >;
+
+   template< typename T >
+   inline StatePtr submit( std::shared_ptr<T> task, const void* target );
+
+   inline StatePtr submit( Task task, const void* target, Operands operands );
+
+   template< typename Reads >
+   inline void wait( const void* target, const Reads& reads );
+
+   inline void wait();
+
+#if BLAZE_HPX_PARALLEL_MODE
+   template< typename T >
+   inline StatePtr submit( std::shared_ptr<T> task, const void* target, hpx::shared_future<void> after );
+
+   inline StatePtr submit( Task task, const void* target, Operands operands, hpx::shared_future<void> after );
+#endif
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline AsyncExecutor();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~AsyncExecutor();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+          inline void                 run( const StatePtr& state, Task& task,
+                                           const std::vector<StatePtr>& dependencies );
+          inline void                 release( const State* state ) noexcept;
+          inline std::vector<Access>  accesses();
+
+   static inline void                 await( State& state );
+   static inline std::exception_ptr   execute( Task& task ) noexcept;
+   static inline void                 complete( State& state, std::exception_ptr error ) noexcept;
+   static inline std::atomic<size_t>& pending() noexcept;
+   static inline const Counter&       submitted();
+   static inline bool&                isExecutorThread() noexcept;
+   static inline ThreadID             threadID() noexcept;
+
+   template< typename Reads >
+   static inline bool isConflicting( const Access& access, const void* target, const Reads& reads );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::mutex mutex_;               //!< Synchronization mutex.
+   std::condition_variable idle_;   //!< Wait condition for the completion of assignments.
+   std::vector<Access> accesses_;   //!< The accesses of all pending assignments.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the AsyncExecutor class.
+*/
+inline AsyncExecutor::AsyncExecutor()
+   : mutex_   ()  // Synchronization mutex
+   , idle_    ()  // Wait condition for the completion of assignments
+   , accesses_()  // The accesses of all pending assignments
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the AsyncExecutor class.
+//
+// The destructor waits for the completion of all submitted assignments. In case of the HPX
+// parallelization, the pending assignments are owned by the HPX runtime.
+*/
+inline AsyncExecutor::~AsyncExecutor()
+{
+#if !BLAZE_HPX_PARALLEL_MODE
+   wait();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the executor for asynchronous assignments.
+//
+// \return Reference to the executor for asynchronous assignments.
+*/
+inline AsyncExecutor& AsyncExecutor::instance()
+{
+   static AsyncExecutor executor;
+   return executor;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the calling thread has to wait for asynchronous assignments.
+//
+// \return \a true in case asynchronous assignments are pending, \a false if not.
+//
+// This function returns \a true in case any asynchronous assignment has not been completed yet
+// and the function is not called from within an asynchronous assignment. Otherwise it returns
+// \a false. Since HPX threads may be resumed on a different worker thread, in case of the HPX
+// parallelization the calling HPX thread is compared to the HPX threads executing the pending
+// assignments.
+*/
+inline bool AsyncExecutor::isPending() noexcept
+{
+#if BLAZE_HPX_PARALLEL_MODE
+   if( pending().load( std::memory_order_acquire ) == 0UL )
+      return false;
+
+   AsyncExecutor& executor( instance() );
+   const ThreadID id( threadID() );
+
+   std::unique_lock<std::mutex> lock( executor.mutex_ );
+   return std::none_of( executor.accesses_.begin(), executor.accesses_.end(),
+                        [id]( const Access& access ) { return access.state->executing == id; } );
+#else
+   return pending().load( std::memory_order_acquire ) > 0UL && !isExecutorThread();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given object is the target of a pending assignment of the calling thread.
+//
+// \param object The address of the object to be checked.
+// \return \a true in case the object is the target of a pending assignment, \a false if not.
+//
+// This function returns \a true in case the given object is the target of an asynchronous
+// assignment that has been submitted by the calling thread and that has not been completed yet.
+// Since the assignment itself is executed by other threads, any access to the target by the
+// calling thread before the completion of the assignment results in a data race. In case the
+// calling thread executes a task on behalf of a parallel operation (see the ParallelTask class),
+// the function returns \a false. The mutex of the executor is only acquired in case the calling
+// thread has submitted pending assignments.
+*/
+inline bool AsyncExecutor::isPendingTarget( const void* object )
+{
+   if( pending().load( std::memory_order_acquire ) == 0UL || isParallelTaskActive() )
+      return false;
+
+#if !BLAZE_HPX_PARALLEL_MODE
+   if( submitted()->load( std::memory_order_acquire ) == 0UL )
+      return false;
+#endif
+
+   AsyncExecutor& executor( instance() );
+   const ThreadID id( threadID() );
+
+   std::unique_lock<std::mutex> lock( executor.mutex_ );
+
+   for( const Access& access : executor.accesses_ ) {
+      if( access.target == object && access.thread == id )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given object is an operand of a pending assignment of the calling thread.
+//
+// \param object The address of the object to be checked.
+// \return \a true in case the object is an operand of a pending assignment, \a false if not.
+//
+// This function returns \a true in case the given object is an operand of an asynchronous
+// assignment that has been submitted by the calling thread and that has not been completed yet.
+// Since the operands are read by other threads until the completion of the assignment, any
+// modification of an operand by the calling thread before the completion of the assignment
+// results in a data race. In case the calling thread executes a task on behalf of a parallel
+// operation (see the ParallelTask class), the function returns \a false. The mutex of the
+// executor is only acquired in case the calling thread has submitted pending assignments, and
+// the operands are checked after releasing the mutex.
+*/
+inline bool AsyncExecutor::isPendingOperand( const void* object )
+{
+   if( pending().load( std::memory_order_acquire ) == 0UL || isParallelTaskActive() )
+      return false;
+
+#if !BLAZE_HPX_PARALLEL_MODE
+   if( submitted()->load( std::memory_order_acquire ) == 0UL )
+      return false;
+#endif
+
+   const ThreadID id( threadID() );
+
+   for( const Access& access : instance().accesses() ) {
+      if( access.thread == id && !access.state->done && access.operands( object ) )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the given object.
+//
+// \param object The given object.
+// \return The address of the given object.
+*/
+template< typename T >  // Type of the object
+inline auto AsyncExecutor::address( const T& object ) noexcept
+   -> EnableIf_t< !IsView_v<T>, const void* >
+{
+   return &object;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the object underlying the given view.
+//
+// \param object The given view.
+// \return The address of the underlying object.
+//
+// Since views forward all accesses to the underlying vector or matrix, the accesses to a view are
+// recorded as accesses to the underlying object.
+*/
+template< typename T >  // Type of the view
+inline auto AsyncExecutor::address( const T& object ) noexcept
+   -> EnableIf_t< IsView_v<T>, const void* >
+{
+   return address( object.operand() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Submits the given assignment for asynchronous execution.
+//
+// \param task The assignment to be executed.
+// \param target The target of the assignment.
+// \return The completion state of the assignment.
+//
+// This function submits the given assignment for asynchronous execution. The operands of the
+// assignment are determined via the \a isOperand() member function of the
+// given task, which is shared with the operand check until the assignment has been completed.
+*/
+template< typename T >  // Type of the assignment
+inline AsyncExecutor::StatePtr AsyncExecutor::submit( std::shared_ptr<T> task, const void* target )
+{
+   Operands operands( [task]( const void* object ) { return task->isOperand( object ); } );
+   return submit( [task]() { (*task)(); }, target, std::move( operands ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Submits the given assignment for asynchronous execution.
+//
+// \param task The assignment to be executed.
+// \param target The target of the assignment.
+// \param operands The check for the operands of the assignment.
+// \return The completion state of the assignment.
+//
+// This function starts a new thread for the execution of the given assignment. The thread first
+// waits for the completion of all pending assignments that write to one of the operands of the
+// given assignment or that access its target, whereas it runs concurrently to all independent
+// assignments. In case the HPX-based parallelization is active, the assignment is attached as
+// continuation to these assignments. In case no parallelization is active, the assignment is
+// executed immediately.
+*/
+inline AsyncExecutor::StatePtr AsyncExecutor::submit( Task task, const void* target, Operands operands )
+{
+#if BLAZE_HPX_PARALLEL_MODE
+   return submit( std::move( task ), target, std::move( operands ), hpx::make_ready_future() );
+#else
+   StatePtr state( std::make_shared<State>() );
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   std::vector<StatePtr> dependencies;
+
+   std::unique_lock<std::mutex> lock( mutex_ );
+
+   for( const Access& access : accesses_ ) {
+      if( isConflicting( access, target, operands ) ) {
+         dependencies.push_back( access.state );
+      }
+   }
+
+   const Counter& counter( submitted() );
+
+   ++pending();
+   ++*counter;
+   accesses_.push_back( Access{ state, target, std::move( operands ), threadID(), counter } );
+
+   lock.unlock();
+
+   try {
+      std::thread( [this, state, task=std::move( task ), dependencies=std::move( dependencies )]() mutable {
+         run( state, task, dependencies );
+      } ).detach();
+   }
+   catch( ... ) {
+      lock.lock();
+      release( state.get() );
+      --pending();
+      idle_.notify_all();
+      throw;
+   }
+#else
+   MAYBE_UNUSED( target, operands );
+   complete( *state, execute( task ) );
+#endif
+
+   return state;
+#endif
+}
+//*************************************************************************************************
+
+
+#if BLAZE_HPX_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Submits the given assignment for asynchronous execution after the given future.
+//
+// \param task The assignment to be executed.
+// \param target The target of the assignment.
+// \param after The future the assignment depends on.
+// \return The completion state of the assignment.
+*/
+template< typename T >  // Type of the assignment
+inline AsyncExecutor::StatePtr
+   AsyncExecutor::submit( std::shared_ptr<T> task, const void* target, hpx::shared_future<void> after )
+{
+   Operands operands( [task]( const void* object ) { return task->isOperand( object ); } );
+   return submit( [task]() { (*task)(); }, target, std::move( operands ), std::move( after ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Submits the given assignment for asynchronous execution after the given future.
+//
+// \param task The assignment to be executed.
+// \param target The target of the assignment.
+// \param operands The check for the operands of the assignment.
+// \param after The future the assignment depends on.
+// \return The completion state of the assignment.
+//
+// This function attaches the given assignment as continuation to the given future and to all
+// pending assignments that write to one of the operands of the given assignment or that access
+// its target. Thus the assignment is executed by the HPX runtime as soon as all of them have
+// become ready, without blocking the submitting thread and concurrently to all independent
+// assignments.
+*/
+inline AsyncExecutor::StatePtr
+   AsyncExecutor::submit( Task task, const void* target, Operands operands, hpx::shared_future<void> after )
+{
+   StatePtr state( std::make_shared<State>() );
+   std::vector< hpx::shared_future<void> > dependencies;
+
+   std::unique_lock<std::mutex> lock( mutex_ );
+
+   for( const Access& access : accesses_ ) {
+      if( isConflicting( access, target, operands ) ) {
+         dependencies.push_back( access.state->future );
+      }
+   }
+
+   dependencies.push_back( std::move( after ) );
+
+   ++pending();
+
+   state->future = hpx::when_all( dependencies ).then( hpx::launch::async,
+      [this, state, task=std::move( task )]( auto&& ) mutable
+      {
+         {
+            std::unique_lock<std::mutex> lock( mutex_ );
+            state->executing = hpx::this_thread::get_id();
+         }
+
+         std::exception_ptr error( execute( task ) );
+
+         std::unique_lock<std::mutex> lock( mutex_ );
+         state->executing = hpx::thread::id();
+
+         // Completing and releasing the assignment atomically with respect to all waiting threads
+         complete( *state, error );
+         release( state.get() );
+         --pending();
+         idle_.notify_all();
+      } );
+
+   ++*submitted();
+   accesses_.push_back( Access{ state, target, std::move( operands ), threadID(), submitted() } );
+
+   return state;
+}
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*!\brief Waits until all submitted assignments accessing the given operands have been completed.
+//
+// \param target The target of the new operation (\a nullptr in case of a reduction).
+// \param reads The check whether a given object is read by the new operation.
+// \return void
+//
+// This function blocks until all submitted assignments that write to an object read by the new
+// operation or that access the target of the new operation have been completed. Assignments
+// that are independent of the new operation may still be pending after the function returns.
+// The conflicts are determined for a copy of the pending accesses after releasing the mutex of
+// the executor, i.e. the operand checks are executed without blocking other threads.
+*/
+template< typename Reads >  // Type of the check for the objects read by the new operation
+inline void AsyncExecutor::wait( const void* target, const Reads& reads )
+{
+   for( const Access& access : accesses() )
+   {
+      if( access.state->done || !isConflicting( access, target, reads ) )
+         continue;
+
+#if BLAZE_HPX_PARALLEL_MODE
+      access.state->future.wait();
+#endif
+      await( *access.state );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits until all submitted assignments have been completed.
+//
+// \return void
+*/
+inline void AsyncExecutor::wait()
+{
+#if BLAZE_HPX_PARALLEL_MODE
+   std::vector< hpx::shared_future<void> > futures;
+
+   {
+      std::unique_lock<std::mutex> lock( mutex_ );
+      for( const Access& access : accesses_ ) {
+         futures.push_back( access.state->future );
+      }
+   }
+
+   for( const hpx::shared_future<void>& future : futures ) {
+      future.wait();
+   }
+#else
+   std::unique_lock<std::mutex> lock( mutex_ );
+
+   while( pending().load( std::memory_order_acquire ) > 0UL ) {
+      idle_.wait( lock );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given assignment after the completion of the given assignments.
+//
+// \param state The completion state of the assignment.
+// \param task The assignment to be executed.
+// \param dependencies The completion states of the assignments to be completed before.
+// \return void
+*/
+inline void AsyncExecutor::run( const StatePtr& state, Task& task, const std::vector<StatePtr>& dependencies )
+{
+   isExecutorThread() = true;
+
+   for( const StatePtr& dependency : dependencies ) {
+      await( *dependency );
+   }
+
+   std::exception_ptr error( execute( task ) );
+   task = nullptr;
+
+   std::unique_lock<std::mutex> lock( mutex_ );
+
+   // Completing and releasing the assignment atomically with respect to all waiting threads
+   complete( *state, error );
+   release( state.get() );
+   --pending();
+   idle_.notify_all();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the accesses of a completed assignment from the pending accesses.
+//
+// \param state The completion state of the completed assignment.
+// \return void
+//
+// This function must be called with the mutex of the executor being locked.
+*/
+inline void AsyncExecutor::release( const State* state ) noexcept
+{
+   for( auto it=accesses_.begin(); it!=accesses_.end(); ++it ) {
+      if( it->state.get() == state ) {
+         --*it->submitted;
+         accesses_.erase( it );
+         return;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!rief Returns a copy of the accesses of all pending assignments.
+//
+// \return The accesses of all pending assignments.
+//
+// The copy enables to check the accesses (and in particular to call the operand checks) without
+// holding the mutex of the executor. Since the copy shares the completion states, assignments
+// that have been completed in the meantime can be skipped.
+*/
+inline std::vector<AsyncExecutor::Access> AsyncExecutor::accesses()
+{
+   std::unique_lock<std::mutex> lock( mutex_ );
+   return accesses_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given pending assignment conflicts with the given operation.
+//
+// \param access The accesses of the pending assignment.
+// \param target The target of the operation (\a nullptr in case of a reduction).
+// \param reads The check whether a given object is read by the operation.
+// \return \a true in case the pending assignment conflicts with the operation, \a false if not.
+//
+// A pending assignment conflicts with an operation in case it writes to an object read by the
+// operation, or in case it reads or writes the target of the operation.
+*/
+template< typename Reads >  // Type of the check for the objects read by the operation
+inline bool AsyncExecutor::isConflicting( const Access& access, const void* target, const Reads& reads )
+{
+   return ( target != nullptr && ( access.target == target || access.operands( target ) ) ) ||
+          reads( access.target );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of the given assignment.
+//
+// \param state The completion state of the assignment.
+// \return void
+*/
+inline void AsyncExecutor::await( State& state )
+{
+   std::unique_lock<std::mutex> lock( state.mutex );
+
+   while( !state.done ) {
+      state.completed.wait( lock );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given assignment.
+//
+// \param task The assignment to be executed.
+// \return The exception thrown by the assignment (if any).
+*/
+inline std::exception_ptr AsyncExecutor::execute( Task& task ) noexcept
+{
+   try {
+      task();
+   }
+   catch( ... ) {
+      return std::current_exception();
+   }
+
+   return std::exception_ptr();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks the given assignment as completed.
+//
+// \param state The completion state of the assignment.
+// \param error The exception thrown by the assignment (if any).
+// \return void
+//
+// In case of an asynchronous execution, this function must be called with the mutex of the
+// executor being locked, right before the accesses of the assignment are released. Thus any
+// thread waiting for the assignment itself as well as any thread waiting for conflicting
+// assignments observes both the completion and the release of the assignment at once.
+*/
+inline void AsyncExecutor::complete( State& state, std::exception_ptr error ) noexcept
+{
+   std::unique_lock<std::mutex> lock( state.mutex );
+   state.error = error;
+   state.done  = true;
+   state.completed.notify_all();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of pending asynchronous assignments.
+//
+// \return Reference to the number of pending asynchronous assignments.
+*/
+inline std::atomic<size_t>& AsyncExecutor::pending() noexcept
+{
+   static std::atomic<size_t> pending( 0UL );
+   return pending;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of pending assignments submitted by the calling thread.
+//
+// \return Reference to the shared counter of the calling thread.
+//
+// The counter is shared with the accesses of all pending assignments of the calling thread, such
+// that it remains valid until the completion of the assignments, even if the thread terminates
+// before. Since HPX threads may be resumed on a different worker thread, the counter is not used
+// in case of the HPX parallelization.
+*/
+inline const AsyncExecutor::Counter& AsyncExecutor::submitted()
+{
+   thread_local const Counter counter( std::make_shared< std::atomic<size_t> >( 0UL ) );
+   return counter;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the calling thread executes an asynchronous assignment.
+//
+// \return Reference to the thread-local flag of the calling thread.
+*/
+inline bool& AsyncExecutor::isExecutorThread() noexcept
+{
+   thread_local bool flag( false );
+   return flag;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the identifier of the calling thread.
+//
+// \return The identifier of the calling thread.
+//
+// In case of the HPX parallelization the identifier of the calling HPX thread is returned, since
+// HPX threads may be resumed on a different worker thread.
+*/
+inline AsyncExecutor::ThreadID AsyncExecutor::threadID() noexcept
+{
+#if BLAZE_HPX_PARALLEL_MODE
+   return hpx::this_thread::get_id();
+#else
+   return std::this_thread::get_id();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waits for all pending asynchronous assignments conflicting with the given assignment.
+// \ingroup smp
+//
+// \param lhs The target of the assignment.
+// \param rhs The right-hand side operand of the assignment.
+// \return void
+//
+// This function blocks the calling thread until all previously submitted asynchronous assignments
+// that write to an operand of the given right-hand side operand, or that read or write the given
+// target have been completed. Independent asynchronous assignments may still be pending after the
+// function returns. In case it is called from within an asynchronous assignment or from within
+// a task executed on behalf of a parallel operation (see the isParallelTaskActive() function), it
+// returns immediately.
+*/
+template< typename T1    // Type of the target
+        , typename T2 >  // Type of the right-hand side operand
+inline void waitForAsyncAssignments( const T1& lhs, const T2& rhs )
+{
+   if( !isParallelTaskActive() && AsyncExecutor::isPending() ) {
+      AsyncExecutor::instance().wait( AsyncExecutor::address( lhs ), [&rhs]( const void* target ) {
+         return rhs.isAliased( target );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waits for all pending asynchronous assignments writing to the given operand.
+// \ingroup smp
+//
+// \param operand The operand read by a reduction.
+// \return void
+//
+// This function blocks the calling thread until all previously submitted asynchronous assignments
+// that write to an operand of the given vector or matrix have been completed. In case it is called
+// from within an asynchronous assignment or from within a task executed on behalf of a parallel
+// operation (see the isParallelTaskActive() function), it returns immediately.
+*/
+template< typename T >  // Type of the operand
+inline void waitForAsyncAssignments( const T& operand )
+{
+   if( !isParallelTaskActive() && AsyncExecutor::isPending() ) {
+      AsyncExecutor::instance().wait( nullptr, [&operand]( const void* target ) {
+         return operand.isAliased( target );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
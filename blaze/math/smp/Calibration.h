@@ -0,0 +1,687 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Calibration.h
+//  \brief Header file for the runtime calibration of the SMP thresholds
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_CALIBRATION_H_
+#define _BLAZE_MATH_SMP_CALIBRATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Debugging.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP threshold functions */
+//@{
+inline void loadSMPThresholds( const std::string& file );
+inline void saveSMPThresholds( const std::string& file );
+
+template< typename Benchmark >
+size_t calibrateSMPThreshold( SMPThresholdID id, Benchmark benchmark, size_t minSize, size_t maxSize );
+
+inline void calibrateSMPThresholds();
+inline void calibrateSMPThresholds( const std::string& file );
+inline void calibrateSMPThresholds( const std::string& file, const std::vector<size_t>& threads );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Owning handle of an opened SMP threshold file.
+// \ingroup smp
+*/
+using SMPThresholdFile = std::unique_ptr< std::FILE, int(*)( std::FILE* ) >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Opens the given SMP threshold file.
+// \ingroup smp
+//
+// \param file The name of the SMP threshold file.
+// \param mode The mode of the file (see the \c std::fopen() function).
+// \return The handle of the opened file (\c nullptr in case the file could not be opened).
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline SMPThresholdFile openSMPThresholdFile( const std::string& file, const char* mode )
+{
+   return SMPThresholdFile( std::fopen( file.c_str(), mode ), &std::fclose );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads the SMP thresholds from the given SMP threshold file.
+// \ingroup smp
+//
+// \param file The name of the SMP threshold file.
+// \return void
+// \exception std::runtime_error Unable to open SMP threshold file.
+// \exception std::runtime_error Invalid SMP threshold file.
+//
+// This function resets all SMP thresholds to their compile time default values and afterwards
+// applies the values stored in the given SMP threshold file (see saveSMPThresholds()) for the
+// current number of threads. In case the file does not contain values for the current number of
+// threads, the values for the next smaller number of threads are used. In case the given file
+// cannot be opened or is malformed, a \a std::runtime_error exception is thrown and the SMP
+// thresholds remain unchanged.\n
+// Note that the SMP threshold file named by the \c BLAZE_SMP_THRESHOLDS environment variable is
+// applied automatically whenever the number of threads is established or changed (except in
+// debug mode). Thus a later call of the setNumThreads() function replaces the values loaded by
+// this function by the values of that file.
+*/
+inline void loadSMPThresholds( const std::string& file )
+{
+   const SMPThresholdFile in( openSMPThresholdFile( file, "r" ) );
+
+   if( !in ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open SMP threshold file" );
+   }
+
+   SMPThresholdSections sections;
+
+   if( !parseSMPThresholds( in.get(), sections ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid SMP threshold file" );
+   }
+
+   resetSMPThresholds();
+   applySMPThresholds( sections, getNumThreads() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the current SMP thresholds in the given SMP threshold file.
+// \ingroup smp
+//
+// \param file The name of the SMP threshold file.
+// \return void
+// \exception std::runtime_error Invalid SMP threshold file.
+// \exception std::runtime_error Unable to write SMP threshold file.
+//
+// This function stores the current values of all SMP thresholds in the section for the current
+// number of threads of the given SMP threshold file. In case the file already exists, all other
+// sections are preserved. This enables to store the result of several calibrations for different
+// numbers of threads in a single file (see also the calibrateSMPThresholds() function):
+
+   \code
+   for( size_t threads : { 2UL, 4UL, 8UL } ) {
+      blaze::setNumThreads( threads );
+      blaze::calibrateSMPThresholds();
+      blaze::saveSMPThresholds( "blaze_smp_thresholds.txt" );
+   }
+   \endcode
+
+// The file can be loaded via the loadSMPThresholds() function or automatically by means of the
+// \c BLAZE_SMP_THRESHOLDS environment variable. In case an existing file is malformed or the
+// file cannot be written, a \a std::runtime_error exception is thrown.
+*/
+inline void saveSMPThresholds( const std::string& file )
+{
+   SMPThresholdSections sections;
+
+   {
+      const SMPThresholdFile in( openSMPThresholdFile( file, "r" ) );
+
+      if( in && !parseSMPThresholds( in.get(), sections ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid SMP threshold file" );
+      }
+   }
+
+   SMPThresholdSection& section( smpThresholdSection( sections, getNumThreads() ) );
+
+   section.values.clear();
+   for( size_t i=0UL; i<SMP_THRESHOLD_COUNT; ++i ) {
+      section.values.emplace_back( SMPThresholdID( i ), smpThreshold( SMPThresholdID( i ) ) );
+   }
+
+   std::sort( sections.begin(), sections.end(),
+              []( const SMPThresholdSection& a, const SMPThresholdSection& b ) {
+                 return a.threads < b.threads;
+              } );
+
+   const SMPThresholdFile out( openSMPThresholdFile( file, "w" ) );
+   bool written( out && std::fputs( "# Blaze SMP thresholds\n", out.get() ) >= 0 );
+
+   for( const SMPThresholdSection& s : sections )
+   {
+      if( written && s.threads != 0UL )
+         written = std::fprintf( out.get(), "\nthreads %lu\n", static_cast<unsigned long>( s.threads ) ) >= 0;
+
+      for( const auto& entry : s.values ) {
+         if( written )
+            written = std::fprintf( out.get(), "%s %lu\n", SMP_THRESHOLD_NAMES[entry.first],
+                                    static_cast<unsigned long>( entry.second ) ) >= 0;
+      }
+   }
+
+   if( !written || std::fflush( out.get() ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write SMP threshold file" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLD CALIBRATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Measures the minimum runtime of the given operation.
+// \ingroup smp
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution of the operation (in seconds).
+//
+// This function repeats the given operation until a single measurement takes at least one
+// millisecond and returns the minimum runtime of a single execution of three measurements.
+*/
+template< typename OP >  // Type of the operation
+double measureSMPOperation( OP& op )
+{
+   timing::WcTimer timer;
+   size_t reps( 1UL );
+
+   op();
+
+   while( true ) {
+      timer.start();
+      for( size_t rep=0UL; rep<reps; ++rep ) {
+         op();
+      }
+      timer.end();
+      if( timer.last() >= 1E-3 || reps >= 1048576UL ) break;
+      reps *= 2UL;
+   }
+
+   double runtime( timer.last() );
+
+   for( size_t round=1UL; round<3UL; ++round ) {
+      timer.start();
+      for( size_t rep=0UL; rep<reps; ++rep ) {
+         op();
+      }
+      timer.end();
+      runtime = std::min( runtime, timer.last() );
+   }
+
+   return runtime / reps;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibrates the given SMP threshold.
+// \ingroup smp
+//
+// \param id The identifier of the SMP threshold to be calibrated.
+// \param benchmark The factory for the operation to be measured.
+// \param minSize The smallest problem size to be measured.
+// \param maxSize The largest problem size to be measured.
+// \return The calibrated value of the SMP threshold.
+//
+// This function determines the crossover between the serial and the parallel execution of an
+// operation for the current number of threads. For all problem sizes from \a minSize to
+// \a maxSize (doubling the size in every step) the given \a benchmark is called to create the
+// operation for the given problem size, which is then measured both serially and in parallel.
+// The problem size has to be expressed in the unit of the SMP threshold (i.e. the number of
+// elements of the target vector or matrix). The threshold is set to the smallest size for which
+// the parallel execution is faster for three consecutive sizes (or all remaining sizes). In case
+// the parallel execution is never faster, the threshold is set to twice the largest measured
+// size. Example:
+
+   \code
+   blaze::calibrateSMPThreshold( blaze::SMP_DVECDVECADD, []( size_t n ) {
+      return [a=blaze::DynamicVector<double>( n, 1.0 ),
+              b=blaze::DynamicVector<double>( n, 2.0 ),
+              c=blaze::DynamicVector<double>( n )]() mutable { c = a + b; };
+   }, 1024UL, 4194304UL );
+   \endcode
+
+// In case no shared memory parallelization is active, in case only a single thread is used, or
+// in case the function is called within a serial or parallel section, the threshold remains
+// unchanged. Note that the threshold is temporarily set to 0 during the calibration. Therefore
+// operations that are executed concurrently should be avoided, since they might both distort
+// the measurements and be executed in parallel independent of their size.
+*/
+template< typename Benchmark >  // Type of the benchmark factory
+size_t calibrateSMPThreshold( SMPThresholdID id, Benchmark benchmark, size_t minSize, size_t maxSize )
+{
+   BLAZE_FUNCTION_TRACE;
+
+#if BLAZE_HPX_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   if( getNumThreads() < 2UL || isSerialSectionActive() || isParallelSectionActive() || minSize == 0UL )
+      return smpThreshold( id );
+
+   size_t crossover( 0UL );
+   size_t wins( 0UL );
+   size_t size( minSize );
+
+   for( ; size<=maxSize && wins<3UL; size*=2UL )
+   {
+      auto op( benchmark( size ) );
+      double serial( 0.0 );
+
+      BLAZE_SERIAL_SECTION {
+         serial = measureSMPOperation( op );
+      }
+
+      setSMPThreshold( id, 0UL );
+      const double parallel( measureSMPOperation( op ) );
+
+      if( parallel < serial ) {
+         if( wins++ == 0UL ) crossover = size;
+      }
+      else wins = 0UL;
+   }
+
+   const size_t value( ( wins > 0UL )?( crossover ):( 2UL*maxSize ) );
+   setSMPThreshold( id, value );
+
+   return value;
+#else
+   MAYBE_UNUSED( benchmark, minSize, maxSize );
+
+   return smpThreshold( id );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits the given number of elements into the dimensions of a matrix.
+// \ingroup smp
+//
+// \param n The number of elements of the matrix.
+// \return The number of rows of the matrix.
+*/
+inline size_t calibrationRows( size_t n ) noexcept
+{
+   size_t m( 1UL );
+   while( m*m*4UL <= n ) m *= 2UL;
+   return m;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibrates the SMP thresholds of all dense vector and dense matrix operations.
+// \ingroup smp
+//
+// \return void
+//
+// This function calibrates the SMP thresholds of all dense vector and dense matrix operations
+// for the current number of threads by means of the calibrateSMPThreshold() function. The
+// operations are measured for double precision operands. The SMP thresholds of all sparse
+// operations depend on the sparsity pattern of the operands and are therefore not calibrated,
+// i.e. they keep their compile time default values (see <tt>./blaze/config/Thresholds.h</tt>)
+// unless they have been changed explicitly. They can be calibrated individually via the
+// calibrateSMPThreshold() function. The result of the calibration can be stored in an SMP
+// threshold file via saveSMPThresholds():
+
+   \code
+   blaze::calibrateSMPThresholds();
+   blaze::saveSMPThresholds( "blaze_smp_thresholds.txt" );
+   \endcode
+
+// In order to calibrate the SMP thresholds for several numbers of threads at once, the SMP
+// threshold file can be passed to calibrateSMPThresholds() directly. Note that the calibration
+// of all thresholds takes several seconds per number of threads. Also note that concurrently
+// executed operations should be avoided during the calibration (see calibrateSMPThreshold()).
+*/
+inline void calibrateSMPThresholds()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using VT  = DynamicVector<double,columnVector>;
+   using TVT = DynamicVector<double,rowVector>;
+   using MT  = DynamicMatrix<double,rowMajor>;
+   using TMT = DynamicMatrix<double,columnMajor>;
+
+   constexpr size_t vmin( 256UL ), vmax( 4194304UL );
+   constexpr size_t mmin( 1024UL ), mmax( 4194304UL );
+
+   volatile double sink( 0.0 );
+
+   //**Dense vector operations*********************************************************************
+   calibrateSMPThreshold( SMP_DVECASSIGN, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n )]() mutable { b = subvector( a, 0UL, a.size() ); };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECSCALARMULT, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n )]() mutable { b = a * 2.0; };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECDVECADD, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), c=VT( n )]() mutable { c = a + b; };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECDVECSUB, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), c=VT( n )]() mutable { c = a - b; };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECDVECMULT, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), c=VT( n )]() mutable { c = a * b; };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECDVECDIV, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), c=VT( n )]() mutable { c = a / b; };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECREDUCE, [&sink]( size_t n ) {
+      return [&sink, a=VT( n, 1.0 )]() { sink = sum( a ); };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECNORM, [&sink]( size_t n ) {
+      return [&sink, a=VT( n, 1.0 )]() { sink = norm( a ); };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECDVECINNER, [&sink]( size_t n ) {
+      return [&sink, a=VT( n, 1.0 ), b=VT( n, 2.0 )]() { sink = dot( a, b ); };
+   }, vmin, vmax );
+
+   calibrateSMPThreshold( SMP_DVECDVECOUTER, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [a=VT( m, 1.0 ), b=TVT( n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = a * b; };
+   }, mmin, mmax );
+   //**********************************************************************************************
+
+   //**Dense matrix operations*********************************************************************
+   calibrateSMPThreshold( SMP_DMATASSIGN, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, n/m, 1.0 ), B=MT( m, n/m )]() mutable {
+         B = submatrix( A, 0UL, 0UL, A.rows(), A.columns() );
+      };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATSCALARMULT, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, n/m, 1.0 ), B=MT( m, n/m )]() mutable { B = A * 2.0; };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATDMATADD, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, n/m, 1.0 ), B=MT( m, n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = A + B; };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATTDMATADD, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, n/m, 1.0 ), B=TMT( m, n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = A + B; };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATDMATSUB, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, n/m, 1.0 ), B=MT( m, n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = A - B; };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATTDMATSUB, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, n/m, 1.0 ), B=TMT( m, n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = A - B; };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATDMATSCHUR, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, n/m, 1.0 ), B=MT( m, n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = A % B; };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATTDMATSCHUR, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, n/m, 1.0 ), B=TMT( m, n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = A % B; };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATREDUCE, []( size_t n ) {
+      return [A=MT( n, 64UL, 1.0 ), v=VT( n )]() mutable { v = sum<rowwise>( A ); };
+   }, 16UL, 65536UL );
+
+   calibrateSMPThreshold( SMP_DMATTOTALREDUCE, [&sink]( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [&sink, A=MT( m, n/m, 1.0 )]() { sink = sum( A ); };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATNORM, [&sink]( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [&sink, A=MT( m, n/m, 1.0 )]() { sink = norm( A ); };
+   }, mmin, mmax );
+
+   calibrateSMPThreshold( SMP_DMATTRANSPOSE, []( size_t n ) {
+      const size_t m( static_cast<size_t>( std::sqrt( static_cast<double>( n ) ) ) );
+      return [A=MT( m, m, 1.0 )]() mutable { A.transpose(); };
+   }, mmin, mmax );
+   //**********************************************************************************************
+
+   //**Dense matrix/dense vector multiplications***************************************************
+   calibrateSMPThreshold( SMP_DMATDVECMULT, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), x=VT( n, 2.0 ), y=VT( n )]() mutable { y = A * x; };
+   }, 16UL, 2048UL );
+
+   calibrateSMPThreshold( SMP_TDMATDVECMULT, []( size_t n ) {
+      return [A=TMT( n, n, 1.0 ), x=VT( n, 2.0 ), y=VT( n )]() mutable { y = A * x; };
+   }, 16UL, 2048UL );
+
+   calibrateSMPThreshold( SMP_TDVECDMATMULT, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), x=TVT( n, 2.0 ), y=TVT( n )]() mutable { y = x * A; };
+   }, 16UL, 2048UL );
+
+   calibrateSMPThreshold( SMP_TDVECTDMATMULT, []( size_t n ) {
+      return [A=TMT( n, n, 1.0 ), x=TVT( n, 2.0 ), y=TVT( n )]() mutable { y = x * A; };
+   }, 16UL, 2048UL );
+   //**********************************************************************************************
+
+   //**Dense matrix/dense matrix multiplications***************************************************
+   calibrateSMPThreshold( SMP_DMATDMATMULT, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, m, 1.0 ), B=MT( m, n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = A * B; };
+   }, 64UL, 262144UL );
+
+   calibrateSMPThreshold( SMP_DMATTDMATMULT, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=MT( m, m, 1.0 ), B=TMT( m, n/m, 2.0 ), C=MT( m, n/m )]() mutable { C = A * B; };
+   }, 64UL, 262144UL );
+
+   calibrateSMPThreshold( SMP_TDMATDMATMULT, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=TMT( m, m, 1.0 ), B=MT( m, n/m, 2.0 ), C=TMT( m, n/m )]() mutable { C = A * B; };
+   }, 64UL, 262144UL );
+
+   calibrateSMPThreshold( SMP_TDMATTDMATMULT, []( size_t n ) {
+      const size_t m( calibrationRows( n ) );
+      return [A=TMT( m, m, 1.0 ), B=TMT( m, n/m, 2.0 ), C=TMT( m, n/m )]() mutable { C = A * B; };
+   }, 64UL, 262144UL );
+   //**********************************************************************************************
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibrates the SMP thresholds for the given numbers of threads.
+// \ingroup smp
+//
+// \param file The name of the SMP threshold file.
+// \param threads The numbers of threads to calibrate the SMP thresholds for.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+// \exception std::runtime_error Invalid SMP threshold file.
+// \exception std::runtime_error Unable to write SMP threshold file.
+//
+// This function calibrates the SMP thresholds of all dense vector and dense matrix operations
+// for each of the given numbers of threads and stores the result in the according \c threads
+// section of the given SMP threshold file (see the saveSMPThresholds() function):
+
+   \code
+   blaze::calibrateSMPThresholds( "blaze_smp_thresholds.txt", { 2UL, 4UL, 8UL } );
+   \endcode
+
+// Afterwards the number of threads is reset to its previous value and the SMP thresholds are
+// set to the values of the file for this number of threads (see the loadSMPThresholds()
+// function). As in case of calibrateSMPThresholds(), the SMP thresholds of all sparse operations
+// are not calibrated and are stored with their current values. In case any of the given numbers
+// of threads is 0, a \a std::invalid_argument exception is thrown. The same applies in case of
+// the HPX parallelization for any number of threads except for the current number of threads,
+// since HPX does not allow to change the number of threads at runtime. In case no number of
+// threads is given, the function has no effect.
+*/
+inline void calibrateSMPThresholds( const std::string& file, const std::vector<size_t>& threads )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t previous( getNumThreads() );
+
+   for( size_t number : threads ) {
+      if( number == 0UL || ( BLAZE_HPX_PARALLEL_MODE && number != previous ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+      }
+   }
+
+   if( threads.empty() )
+      return;
+
+#if !BLAZE_HPX_PARALLEL_MODE
+   try {
+      for( size_t number : threads ) {
+         setNumThreads( number );
+         calibrateSMPThresholds();
+         saveSMPThresholds( file );
+      }
+   }
+   catch( ... ) {
+      setNumThreads( previous );
+      throw;
+   }
+
+   setNumThreads( previous );
+#else
+   calibrateSMPThresholds();
+   saveSMPThresholds( file );
+#endif
+
+   loadSMPThresholds( file );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibrates the SMP thresholds for all powers of two up to the current number of threads.
+// \ingroup smp
+//
+// \param file The name of the SMP threshold file.
+// \return void
+// \exception std::runtime_error Invalid SMP threshold file.
+// \exception std::runtime_error Unable to write SMP threshold file.
+//
+// This function calibrates the SMP thresholds of all dense vector and dense matrix operations
+// for 2, 4, 8, ... threads up to the current number of threads (including the current number
+// of threads itself) and stores the result in the given SMP threshold file (see the
+// calibrateSMPThresholds( const std::string&, const std::vector<size_t>& ) function):
+
+   \code
+   blaze::setNumThreads( 16UL );
+   blaze::calibrateSMPThresholds( "blaze_smp_thresholds.txt" );  // 2, 4, 8, and 16 threads
+   \endcode
+
+// In case of the HPX parallelization, the SMP thresholds are calibrated for the current number
+// of threads only. As in case of calibrateSMPThresholds(), the SMP thresholds of all sparse
+// operations are not calibrated.
+*/
+inline void calibrateSMPThresholds( const std::string& file )
+{
+   const size_t current( getNumThreads() );
+   std::vector<size_t> threads;
+
+#if !BLAZE_HPX_PARALLEL_MODE
+   for( size_t number=2UL; number<current; number*=2UL ) {
+      threads.push_back( number );
+   }
+#endif
+
+   if( current > 1UL )
+      threads.push_back( current );
+
+   calibrateSMPThresholds( file, threads );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
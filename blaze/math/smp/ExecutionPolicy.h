@@ -0,0 +1,568 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ExecutionPolicy.h
+//  \brief Header file for the execution policy of the shared-memory parallelization
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_EXECUTIONPOLICY_H_
+#define _BLAZE_MATH_SMP_EXECUTIONPOLICY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <functional>
+#include <utility>
+#include <blaze/system/SMP.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Execution policy for the shared-memory parallel operations of the calling thread.
+// \ingroup smp
+//
+// The ExecutionPolicy class describes how the shared-memory parallel operations started by a
+// single thread are executed. It consists of the following three settings:
+//
+//  - the maximum number of threads used for a single parallel operation (see threads()). The
+//    default value 0 does not restrict the number of threads of the active parallelization;
+//  - whether operations started from within a parallel region may be executed in parallel
+//    (see nested()). A parallel region is either an OpenMP parallel region or a task that is
+//    executed on behalf of a parallel operation of \b Blaze. By default, such operations are
+//    executed serially;
+//  - the executor used to run the parallel tasks (see executor()). By default, the tasks are
+//    executed by the active parallelization (i.e. in case of the C++11 or Boost thread-based
+//    parallelization by the thread pool of \b Blaze).
+//
+// An execution policy is activated for the calling thread by means of an ExecutionScope. The
+// following example demonstrates how to restrict all operations within a scope to two threads:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+
+   // ... Resizing and initialization
+
+   {
+      blaze::ExecutionScope scope( blaze::ExecutionPolicy().threads( 2UL ) );
+
+      y = A * x;  // Executed by at most two threads
+   }
+   \endcode
+
+// An executor is a callable that receives the number of tasks \a n and a task function. It has
+// to call the task function exactly once for each index in the range \f$[0..n)\f$ and must not
+// return before all calls have been completed. This makes it possible to execute the parallel
+// operations of \b Blaze on the workers of an external task system:
+
+   \code
+   MyTaskSystem& tasks = ...;
+
+   blaze::ExecutionPolicy policy;
+   policy.threads( tasks.size() )
+         .nested( true )
+         .executor( [&tasks]( size_t n, const std::function<void(size_t)>& task ) {
+            tasks.parallel_for( 0UL, n, task );
+         } );
+   \endcode
+
+// Note that the executor is only used by the C++11 and Boost thread-based parallelization. The
+// OpenMP and HPX parallelizations always execute all tasks on their own runtime system.
+*/
+class ExecutionPolicy
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of an executor for parallel tasks.
+   using Executor = std::function< void( size_t, const std::function<void(size_t)>& ) >;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline ExecutionPolicy();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline ExecutionPolicy& threads ( size_t number );
+   inline ExecutionPolicy& nested  ( bool flag );
+   inline ExecutionPolicy& executor( Executor exec );
+
+   inline size_t          threads () const noexcept;
+   inline bool            nested  () const noexcept;
+   inline const Executor& executor() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t   threads_;   //!< The maximum number of threads (0 for no restriction).
+   bool     nested_;    //!< Flag for the parallel execution within parallel regions.
+   Executor executor_;  //!< The executor for parallel tasks (empty for the active parallelization).
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the ExecutionPolicy class.
+//
+// The default execution policy does not restrict the number of threads, executes all operations
+// within parallel regions serially and uses the active parallelization to execute all tasks.
+*/
+inline ExecutionPolicy::ExecutionPolicy()
+   : threads_ ( 0UL   )  // The maximum number of threads
+   , nested_  ( false )  // Flag for the parallel execution within parallel regions
+   , executor_()         // The executor for parallel tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the maximum number of threads for a single parallel operation.
+//
+// \param number The maximum number of threads (0 for no restriction).
+// \return Reference to the execution policy.
+//
+// In case an executor is specified, the given number of threads determines the number of tasks
+// per parallel operation. In case the number of threads is not restricted, the number of tasks
+// corresponds to the number of hardware threads.
+*/
+inline ExecutionPolicy& ExecutionPolicy::threads( size_t number )
+{
+   threads_ = number;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets whether operations within parallel regions may be executed in parallel.
+//
+// \param flag \a true to allow a parallel execution, \a false to enforce a serial execution.
+// \return Reference to the execution policy.
+//
+// Note that the thread pool of the C++11 and Boost thread-based parallelization never executes
+// operations in parallel that are started from within one of its own tasks. Thus in this case
+// the flag only takes effect in combination with an executor.
+*/
+inline ExecutionPolicy& ExecutionPolicy::nested( bool flag )
+{
+   nested_ = flag;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the executor for parallel tasks.
+//
+// \param exec The executor for parallel tasks (empty for the active parallelization).
+// \return Reference to the execution policy.
+*/
+inline ExecutionPolicy& ExecutionPolicy::executor( Executor exec )
+{
+   executor_ = std::move( exec );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of threads for a single parallel operation.
+//
+// \return The maximum number of threads (0 for no restriction).
+*/
+inline size_t ExecutionPolicy::threads() const noexcept
+{
+   return threads_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether operations within parallel regions may be executed in parallel.
+//
+// \return \a true in case a parallel execution is allowed, \a false if not.
+*/
+inline bool ExecutionPolicy::nested() const noexcept
+{
+   return nested_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the executor for parallel tasks.
+//
+// \return The executor for parallel tasks (empty for the active parallelization).
+*/
+inline const ExecutionPolicy::Executor& ExecutionPolicy::executor() const noexcept
+{
+   return executor_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the active execution policy of the calling thread.
+// \ingroup smp
+//
+// \return Reference to the active execution policy of the calling thread.
+*/
+inline ExecutionPolicy& activeExecutionPolicy() noexcept
+{
+   thread_local ExecutionPolicy policy;
+   return policy;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the active execution policy of the calling thread.
+// \ingroup smp
+//
+// \return The active execution policy of the calling thread.
+//
+// This function returns the execution policy of the innermost ExecutionScope of the calling
+// thread. In case no scope is active, the default execution policy is returned.
+*/
+inline const ExecutionPolicy& getExecutionPolicy() noexcept
+{
+   return activeExecutionPolicy();
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS EXECUTIONSCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope for the activation of an execution policy.
+// \ingroup smp
+//
+// The ExecutionScope class activates the given execution policy for the calling thread for the
+// lifetime of the scope. At the end of the scope the previously active policy is restored:
+
+   \code
+   blaze::ExecutionPolicy policy;
+   policy.threads( 4UL );
+
+   {
+      blaze::ExecutionScope scope( policy );
+
+      // ... All operations of this thread are executed by at most four threads
+   }
+   \endcode
+
+// Scopes can be nested. Note however that a scope can only further restrict the number of
+// threads of an enclosing scope. In case of the OpenMP parallelization, the scope adjusts the
+// number of threads of the calling thread (see the \c omp_set_num_threads() function) and
+// restores it at the end of the scope.
+*/
+class ExecutionScope
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ExecutionScope( const ExecutionPolicy& policy );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ExecutionScope();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ExecutionPolicy previous_;  //!< The previously active execution policy.
+#if BLAZE_OPENMP_PARALLEL_MODE
+   int threads_;               //!< The previous number of OpenMP threads.
+#endif
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ExecutionScope class.
+//
+// \param policy The execution policy to be activated.
+*/
+inline ExecutionScope::ExecutionScope( const ExecutionPolicy& policy )
+   : previous_( activeExecutionPolicy() )  // The previously active execution policy
+#if BLAZE_OPENMP_PARALLEL_MODE
+   , threads_ ( omp_get_max_threads()   )  // The previous number of OpenMP threads
+#endif
+{
+   ExecutionPolicy& active( activeExecutionPolicy() );
+   const size_t limit( previous_.threads() );
+
+   active = policy;
+
+   if( limit != 0UL && ( policy.threads() == 0UL || policy.threads() > limit ) ) {
+      active.threads( limit );
+   }
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+   if( active.threads() != 0UL && active.threads() < static_cast<size_t>( threads_ ) ) {
+      omp_set_num_threads( static_cast<int>( active.threads() ) );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor of the ExecutionScope class.
+//
+// The destructor restores the previously active execution policy.
+*/
+inline ExecutionScope::~ExecutionScope()
+{
+   activeExecutionPolicy() = std::move( previous_ );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+   omp_set_num_threads( threads_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS PARALLELTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Marker for the execution of a task on behalf of a parallel operation.
+// \ingroup smp
+//
+// The ParallelTask class marks the calling thread as executing a task on behalf of a parallel
+// operation of \b Blaze for the lifetime of the marker. This enables the detection of nested
+// parallel operations (see the isParallelTaskActive() function).\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only.
+*/
+class ParallelTask
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline ParallelTask() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ParallelTask();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t& depth() noexcept;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The constructor of the ParallelTask class.
+*/
+inline ParallelTask::ParallelTask() noexcept
+{
+   ++depth();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The destructor of the ParallelTask class.
+*/
+inline ParallelTask::~ParallelTask()
+{
+   --depth();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of nested parallel tasks executed by the calling thread.
+//
+// \return Reference to the nesting depth of the calling thread.
+*/
+inline size_t& ParallelTask::depth() noexcept
+{
+   thread_local size_t depth( 0UL );
+   return depth;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the calling thread executes within a parallel region.
+// \ingroup smp
+//
+// \return \a true in case the calling thread executes within a parallel region, \a false if not.
+//
+// This function returns \a true in case the calling thread executes a task on behalf of a parallel
+// operation of \b Blaze or, in case of the OpenMP parallelization, executes within an active
+// OpenMP parallel region.
+*/
+inline bool isParallelTaskActive() noexcept
+{
+#if BLAZE_OPENMP_PARALLEL_MODE
+   return ParallelTask::depth() > 0UL || omp_in_parallel();
+#else
+   return ParallelTask::depth() > 0UL;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the active execution policy enforces a serial execution.
+// \ingroup smp
+//
+// \return \a true in case a serial execution is enforced, \a false if not.
+//
+// This function returns \a true in case the active execution policy of the calling thread
+// restricts the number of threads to a single thread or in case the calling thread executes
+// within a parallel region and the policy does not allow a nested parallel execution.
+*/
+inline bool isSerialExecutionEnforced() noexcept
+{
+   const ExecutionPolicy& policy( getExecutionPolicy() );
+
+   if( policy.threads() == 1UL )
+      return true;
+
+   if( !isParallelTaskActive() )
+      return false;
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   return !policy.nested() || !policy.executor();
+#else
+   return !policy.nested();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,158 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ParallelFor.h
+//  \brief Header file for the SMP parallel loop functionality
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_HPX_PARALLEL_MODE
+#  include <hpx/include/parallel_for_loop.hpp>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP PARALLEL LOOPS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a parallel loop can be executed in parallel.
+// \ingroup smp
+//
+// \return \a true in case the loop can be executed in parallel, \a false if not.
+//
+// This function returns \a true in case a shared-memory parallelization is active, more than
+// a single thread is available, and the function is called neither from within a serial nor
+// from within a parallel section.
+*/
+inline bool canSMPFor()
+{
+#if BLAZE_HPX_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   return !isSerialSectionActive() && !isParallelSectionActive() && getNumThreads() > 1UL;
+#else
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel execution of the given loop body by means of the active parallelization.
+// \ingroup smp
+//
+// \param n The total number of iterations.
+// \param body The callable to be executed for each iteration \f$ k \in [0..n) \f$.
+// \return void
+//
+// This function executes the given loop body for all iterations in parallel by means of the
+// active shared-memory parallelization (HPX, C++11 threads, Boost threads, or OpenMP). Each
+// iteration is executed exactly once and the function returns after all iterations have been
+// completed. Thus the iterations must be independent of each other. In case a single iteration
+// is given, it is executed directly by the calling thread. The caller is responsible to check
+// whether a parallel execution is possible (see the canSMPFor() function). Since the objects
+// accessed by the loop body are unknown to this function, the caller is also responsible to
+// wait for all pending asynchronous assignments accessing these objects before (see the
+// waitForAsyncAssignments() functions).\n
+// This function must \b NOT be called explicitly! It is used internally for the parallelization
+// of operations that are not expressed in terms of the SMP assignment functions. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Body >  // Type of the loop body
+void smpFor( size_t n, Body body )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( n == 1UL ) {
+      body( size_t(0) );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#if BLAZE_HPX_PARALLEL_MODE
+      using hpx::parallel::for_loop;
+      using hpx::parallel::execution::par;
+
+      for_loop( par, size_t(0), n, [&]( size_t k )
+      {
+         ParallelTask marker;
+         body( k );
+      } );
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+      for( size_t k=0UL; k<n; ++k ) {
+         TheThreadBackend::schedule( k, [&body,k]() {
+            body( k );
+         } );
+      }
+
+      TheThreadBackend::wait();
+#elif BLAZE_OPENMP_PARALLEL_MODE
+      const int iterations( static_cast<int>( n ) );
+
+#pragma omp parallel for schedule(static,1)
+      for( int k=0; k<iterations; ++k ) {
+         body( static_cast<size_t>( k ) );
+      }
+#else
+      for( size_t k=0UL; k<n; ++k ) {
+         body( k );
+      }
+#endif
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/ExecutionPolicy.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -97,10 +99,18 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+#if BLAZE_HPX_PARALLEL_MODE
+   static bool active_;               //!< Activity flag for the parallel section.
+#else
+   static thread_local bool active_;  //!< Activity flag for the parallel section.
+#endif
+                                      /*!< In case a parallel section is active (i.e. the code
+                                           currently executed by the calling thread is inside
+                                           a parallel section), the flag is set to \a true,
+                                           otherwise it is \a false. In case of the HPX
+                                           parallelization the flag is shared by all threads. */
+
+   bool previous_;  //!< The previous activity flag of the calling thread.
    //@}
    //**********************************************************************************************
 
@@ -123,8 +133,13 @@ class ParallelSection
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_HPX_PARALLEL_MODE
 template< typename T >
 bool ParallelSection<T>::active_ = false;
+#else
+template< typename T >
+thread_local bool ParallelSection<T>::active_ = false;
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -142,11 +157,16 @@ bool ParallelSection<T>::active_ = false;
 //
 // \param activate Activation flag for the parallel section.
 // \exception std::runtime_error Nested parallel sections detected.
+//
+// In case the calling thread executes a task on behalf of a parallel operation (see the
+// ExecutionPolicy class), the parallel section is nested into the parallel section of the
+// enclosing operation.
 */
 template< typename T >
 inline ParallelSection<T>::ParallelSection( bool activate )
+   : previous_( active_ )  // The previous activity flag of the calling thread
 {
-   if( active_ ) {
+   if( !isParallelTaskActive() && active_ ) {
       BLAZE_THROW_RUNTIME_ERROR( "Nested parallel sections detected" );
    }
 
@@ -169,7 +189,7 @@ inline ParallelSection<T>::ParallelSection( bool activate )
 template< typename T >
 inline ParallelSection<T>::~ParallelSection()
 {
-   active_ = false;  // Resetting the activity flag
+   active_ = previous_;  // Resetting the activity flag
 }
 //*************************************************************************************************
 
@@ -217,10 +237,13 @@ inline bool isParallelSectionActive();
 // \ingroup smp
 //
 // \return \a true if a parallel section is active, \a false if not.
+//
+// This function returns \a true in case the calling thread is inside a parallel section or in
+// case it executes within a parallel region (see the ExecutionPolicy class).
 */
 inline bool isParallelSectionActive()
 {
-   return ParallelSection<int>::active_;
+   return ParallelSection<int>::active_ || isParallelTaskActive();
 }
 //*************************************************************************************************
 
@@ -0,0 +1,642 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Reduce.h
+//  \brief Header file for the SMP reduction functionality
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_REDUCE_H_
+#define _BLAZE_MATH_SMP_REDUCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a reduction can be executed in parallel.
+// \ingroup smp
+//
+// \return \a true in case the reduction can be executed in parallel, \a false if not.
+//
+// This function returns \a true in case a shared-memory parallelization is active, more than
+// a single thread is available, and the function is called neither from within a serial nor
+// from within a parallel section.
+*/
+inline bool canSMPReduce()
+{
+   return canSMPFor();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel evaluation of the given reduction chunks and fixed-order combination.
+// \ingroup smp
+//
+// \param chunks The total number of chunks.
+// \param chunk The callable computing the partial result of a single chunk.
+// \param op The reduction operation.
+// \return The combined result of all non-empty chunks.
+//
+// This function computes the partial results of all chunks in parallel and afterwards combines
+// the partial results of all non-empty chunks in ascending order of the chunks. Therefore the
+// result is deterministic for a given number of chunks. The given callable has to return
+// \a false for an empty chunk and \a true for a non-empty chunk. In case all chunks are empty,
+// a default constructed result is returned.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename RT       // Type of the result
+        , typename Chunk    // Type of the chunk callable
+        , typename OP >     // Type of the reduction operation
+RT smpReduceChunks( size_t chunks, Chunk chunk, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::vector<RT> partial( chunks );
+   std::unique_ptr<bool[]> valid( new bool[chunks] );
+
+   smpFor( chunks, [&]( size_t i ) {
+      valid[i] = chunk( i, partial[i] );
+   } );
+
+   size_t i( 0UL );
+
+   while( i < chunks && !valid[i] ) {
+      ++i;
+   }
+
+   if( i == chunks )
+      return RT();
+
+   RT redux( std::move( partial[i] ) );
+
+   for( ++i; i<chunks; ++i ) {
+      if( valid[i] )
+         redux = op( redux, partial[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of elements per chunk for a parallel reduction.
+// \ingroup smp
+//
+// \param size The total number of elements.
+// \param granularity The granularity of the chunks.
+// \return The number of elements per chunk.
+*/
+inline size_t smpReduceChunkSize( size_t size, size_t granularity )
+{
+   const size_t threads   ( getNumThreads() );
+   const size_t addon     ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( size / threads + addon );
+   const size_t rest      ( equalShare & ( granularity - 1UL ) );
+
+   return ( rest )?( equalShare - rest + granularity ):( equalShare );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP REDUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial reduction of a dense vector that cannot be split for a parallel reduction.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function implements the default reduction in case the dense vector cannot be split into
+// views for a parallel reduction (see the IsSMPAssignable type trait). The kernel is applied
+// to the complete vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT      // Type of the dense vector
+        , bool TF          // Transpose flag
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const DenseVector<VT,TF>& dv, Kernel kernel, OP op )
+   -> EnableIf_t< !IsSMPAssignable_v<VT>, decltype( kernel( ~dv ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MAYBE_UNUSED( op );
+
+   return kernel( ~dv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function splits the given dense vector into one chunk per thread, reduces all chunks in
+// parallel by means of the given serial \a kernel and combines the partial results in a fixed
+// order by means of the given operation \a op. In case the reduction cannot be executed in
+// parallel (see the canSMPReduce() function), the kernel is applied to the complete vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT      // Type of the dense vector
+        , bool TF          // Transpose flag
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const DenseVector<VT,TF>& dv, Kernel kernel, OP op )
+   -> EnableIf_t< IsSMPAssignable_v<VT>, decltype( kernel( ~dv ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = decltype( kernel( ~dv ) );
+
+   if( !canSMPReduce() || (~dv).size() == 0UL )
+      return kernel( ~dv );
+
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<VT> >::size );
+
+   const bool   simdAligned( VT::simdEnabled && (~dv).isAligned() );
+   const size_t N   ( (~dv).size() );
+   const size_t size( smpReduceChunkSize( N, ( VT::simdEnabled ? SIMDSIZE : 1UL ) ) );
+
+   return smpReduceChunks<RT>( ( N + size - 1UL ) / size, [&]( size_t i, RT& partial )
+   {
+      const size_t index( i*size );
+      const size_t n( min( size, N - index ) );
+
+      if( simdAligned )
+         partial = kernel( subvector<aligned>( ~dv, index, n, unchecked ) );
+      else
+         partial = kernel( subvector<unaligned>( ~dv, index, n, unchecked ) );
+
+      return true;
+   }, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial reduction of a pair of dense vectors that cannot be split for a parallel reduction.
+// \ingroup smp
+//
+// \param lhs The left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function implements the default reduction in case at least one of the two vectors cannot be split into
+// views for a parallel reduction (see the IsSMPAssignable type trait). The kernel is applied
+// to the complete vectors.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT1     // Type of the left-hand side dense vector
+        , bool TF1         // Transpose flag of the left-hand side dense vector
+        , typename VT2     // Type of the right-hand side dense vector
+        , bool TF2         // Transpose flag of the right-hand side dense vector
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, Kernel kernel, OP op )
+   -> EnableIf_t< ( !IsSMPAssignable_v<VT1> || !IsSMPAssignable_v<VT2> ), decltype( kernel( ~lhs, ~rhs ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MAYBE_UNUSED( op );
+
+   return kernel( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP reduction of a pair of dense vectors.
+// \ingroup smp
+//
+// \param lhs The left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function splits the given pair of dense vectors into one pair of chunks per thread,
+// reduces all pairs of chunks in parallel by means of the given serial \a kernel (as for
+// instance an inner product) and combines the partial results in a fixed order by means of
+// the given operation \a op.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT1     // Type of the left-hand side dense vector
+        , bool TF1         // Transpose flag of the left-hand side dense vector
+        , typename VT2     // Type of the right-hand side dense vector
+        , bool TF2         // Transpose flag of the right-hand side dense vector
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, Kernel kernel, OP op )
+   -> EnableIf_t< IsSMPAssignable_v<VT1> && IsSMPAssignable_v<VT2>, decltype( kernel( ~lhs, ~rhs ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   using RT = decltype( kernel( ~lhs, ~rhs ) );
+
+   if( !canSMPReduce() || (~lhs).size() == 0UL )
+      return kernel( ~lhs, ~rhs );
+
+   constexpr bool simdEnabled( VT1::simdEnabled && VT2::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<VT1> >::size );
+
+   const bool   simdAligned( simdEnabled && (~lhs).isAligned() && (~rhs).isAligned() );
+   const size_t N   ( (~lhs).size() );
+   const size_t size( smpReduceChunkSize( N, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
+
+   return smpReduceChunks<RT>( ( N + size - 1UL ) / size, [&]( size_t i, RT& partial )
+   {
+      const size_t index( i*size );
+      const size_t n( min( size, N - index ) );
+
+      if( simdAligned )
+         partial = kernel( subvector<aligned>( ~lhs, index, n, unchecked ),
+                           subvector<aligned>( ~rhs, index, n, unchecked ) );
+      else
+         partial = kernel( subvector<unaligned>( ~lhs, index, n, unchecked ),
+                           subvector<unaligned>( ~rhs, index, n, unchecked ) );
+
+      return true;
+   }, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial reduction of a dense matrix that cannot be split for a parallel reduction.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function implements the default reduction in case the dense matrix cannot be split into
+// views for a parallel reduction (see the IsSMPAssignable type trait). The kernel is applied
+// to the complete matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT      // Type of the dense matrix
+        , bool SO          // Storage order
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const DenseMatrix<MT,SO>& dm, Kernel kernel, OP op )
+   -> EnableIf_t< !IsSMPAssignable_v<MT>, decltype( kernel( ~dm ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MAYBE_UNUSED( op );
+
+   return kernel( ~dm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function splits the given dense matrix into one block of rows (in case of a row-major
+// matrix) or columns (in case of a column-major matrix) per thread, reduces all blocks in
+// parallel by means of the given serial \a kernel and combines the partial results in a fixed
+// order by means of the given operation \a op.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT      // Type of the dense matrix
+        , bool SO          // Storage order
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const DenseMatrix<MT,SO>& dm, Kernel kernel, OP op )
+   -> EnableIf_t< IsSMPAssignable_v<MT>, decltype( kernel( ~dm ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = decltype( kernel( ~dm ) );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( !canSMPReduce() || M == 0UL || N == 0UL )
+      return kernel( ~dm );
+
+   const bool   simdAligned( MT::simdEnabled && (~dm).isAligned() );
+   const size_t size( smpReduceChunkSize( ( SO ? N : M ), 1UL ) );
+
+   return smpReduceChunks<RT>( ( ( SO ? N : M ) + size - 1UL ) / size, [&]( size_t i, RT& partial )
+   {
+      const size_t index( i*size );
+
+      if( SO ) {
+         const size_t n( min( size, N - index ) );
+         if( simdAligned )
+            partial = kernel( submatrix<aligned>( ~dm, 0UL, index, M, n, unchecked ) );
+         else
+            partial = kernel( submatrix<unaligned>( ~dm, 0UL, index, M, n, unchecked ) );
+      }
+      else {
+         const size_t m( min( size, M - index ) );
+         if( simdAligned )
+            partial = kernel( submatrix<aligned>( ~dm, index, 0UL, m, N, unchecked ) );
+         else
+            partial = kernel( submatrix<unaligned>( ~dm, index, 0UL, m, N, unchecked ) );
+      }
+
+      return true;
+   }, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial reduction of a sparse vector that cannot be split for a parallel reduction.
+// \ingroup smp
+//
+// \param sv The sparse vector to be reduced.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function implements the default reduction in case the sparse vector cannot be split into
+// views for a parallel reduction (see the IsSMPAssignable type trait). The kernel is applied
+// to the complete vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT      // Type of the sparse vector
+        , bool TF          // Transpose flag
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const SparseVector<VT,TF>& sv, Kernel kernel, OP op )
+   -> EnableIf_t< !IsSMPAssignable_v<VT>, decltype( kernel( ~sv ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MAYBE_UNUSED( op );
+
+   return kernel( ~sv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP reduction of the non-zero elements of a sparse vector.
+// \ingroup smp
+//
+// \param sv The sparse vector to be reduced.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function splits the given sparse vector into one chunk per thread, reduces the non-zero
+// elements of all chunks in parallel by means of the given serial \a kernel and combines the
+// partial results of all chunks containing non-zero elements in a fixed order by means of the
+// given operation \a op.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT      // Type of the sparse vector
+        , bool TF          // Transpose flag
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const SparseVector<VT,TF>& sv, Kernel kernel, OP op )
+   -> EnableIf_t< IsSMPAssignable_v<VT>, decltype( kernel( ~sv ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = decltype( kernel( ~sv ) );
+
+   if( !canSMPReduce() || (~sv).size() == 0UL )
+      return kernel( ~sv );
+
+   const size_t N   ( (~sv).size() );
+   const size_t size( smpReduceChunkSize( N, 1UL ) );
+
+   return smpReduceChunks<RT>( ( N + size - 1UL ) / size, [&]( size_t i, RT& partial )
+   {
+      const size_t index( i*size );
+      const auto chunk( subvector( ~sv, index, min( size, N - index ), unchecked ) );
+
+      if( chunk.begin() == chunk.end() )
+         return false;
+
+      partial = kernel( chunk );
+      return true;
+   }, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial reduction of a sparse matrix that cannot be split for a parallel reduction.
+// \ingroup smp
+//
+// \param sm The sparse matrix to be reduced.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function implements the default reduction in case the sparse matrix cannot be split into
+// views for a parallel reduction (see the IsSMPAssignable type trait). The kernel is applied
+// to the complete matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT      // Type of the sparse matrix
+        , bool SO          // Storage order
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const SparseMatrix<MT,SO>& sm, Kernel kernel, OP op )
+   -> EnableIf_t< !IsSMPAssignable_v<MT>, decltype( kernel( ~sm ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MAYBE_UNUSED( op );
+
+   return kernel( ~sm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP reduction of the non-zero elements of a sparse matrix.
+// \ingroup smp
+//
+// \param sm The sparse matrix to be reduced.
+// \param kernel The serial reduction kernel.
+// \param op The operation to combine the partial results.
+// \return The result of the reduction.
+//
+// This function splits the given sparse matrix into one block of rows (in case of a row-major
+// matrix) or columns (in case of a column-major matrix) per thread, reduces the non-zero
+// elements of all blocks in parallel by means of the given serial \a kernel and combines the
+// partial results of all blocks containing non-zero elements in a fixed order by means of the
+// given operation \a op.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT      // Type of the sparse matrix
+        , bool SO          // Storage order
+        , typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( const SparseMatrix<MT,SO>& sm, Kernel kernel, OP op )
+   -> EnableIf_t< IsSMPAssignable_v<MT>, decltype( kernel( ~sm ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = decltype( kernel( ~sm ) );
+
+   const size_t M( (~sm).rows()    );
+   const size_t N( (~sm).columns() );
+
+   if( !canSMPReduce() || M == 0UL || N == 0UL )
+      return kernel( ~sm );
+
+   const size_t size( smpReduceChunkSize( ( SO ? N : M ), 1UL ) );
+
+   return smpReduceChunks<RT>( ( ( SO ? N : M ) + size - 1UL ) / size, [&]( size_t i, RT& partial )
+   {
+      const size_t index( i*size );
+      const size_t n( min( size, ( SO ? N : M ) - index ) );
+
+      const auto block( SO ? submatrix( ~sm, 0UL, index, M, n, unchecked )
+                           : submatrix( ~sm, index, 0UL, n, N, unchecked ) );
+
+      if( block.nonZeros() == 0UL )
+         return false;
+
+      partial = kernel( block );
+      return true;
+   }, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
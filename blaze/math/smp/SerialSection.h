@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/ExecutionPolicy.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +91,16 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the serial section.
-                         /*!< In case a serial section is active (i.e. the currently executed
-                              code is inside a serial section), the flag is set to \a true,
-                              otherwise it is \a false. */
+#if BLAZE_HPX_PARALLEL_MODE
+   static bool active_;               //!< Activity flag for the serial section.
+#else
+   static thread_local bool active_;  //!< Activity flag for the serial section.
+#endif
+                                      /*!< In case a serial section is active (i.e. the code
+                                           currently executed by the calling thread is inside
+                                           a serial section), the flag is set to \a true,
+                                           otherwise it is \a false. In case of the HPX
+                                           parallelization the flag is shared by all threads. */
    //@}
    //**********************************************************************************************
 
@@ -115,8 +123,13 @@ class SerialSection
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_HPX_PARALLEL_MODE
 template< typename T >
 bool SerialSection<T>::active_ = false;
+#else
+template< typename T >
+thread_local bool SerialSection<T>::active_ = false;
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -209,10 +222,14 @@ inline bool isSerialSectionActive();
 // \ingroup smp
 //
 // \return \a true if a serial section is active, \a false if not.
+//
+// This function returns \a true in case the calling thread is inside a serial section or in case
+// the active execution policy of the calling thread enforces a serial execution (see the
+// ExecutionPolicy class).
 */
 inline bool isSerialSectionActive()
 {
-   return SerialSection<int>::active_;
+   return SerialSection<int>::active_ || isSerialExecutionEnforced();
 }
 //*************************************************************************************************
 
@@ -114,6 +114,47 @@ ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maps a tile of a 2D mapping of threads to a linear thread position.
+// \ingroup smp
+//
+// \param i The row index of the tile \f$[0..threads.first-1]\f$.
+// \param j The column index of the tile \f$[0..threads.second-1]\f$.
+// \param threads The 2D mapping of threads.
+// \param group The number of consecutive thread positions sharing a cache \f$[1..\infty)\f$.
+// \return The linear thread position of the tile.
+//
+// This function maps the tile \f$(i,j)\f$ of the given 2D mapping of threads to a linear thread
+// position such that neighboring tiles are mapped to the same group of \a group consecutive
+// positions, which are expected to share a cache. For that purpose the tiles are partitioned
+// into blocks of \f$ gm \times gn \f$ tiles (with \f$ gm \cdot gn = group \f$) that are as square
+// as possible. In case the 2D mapping cannot be partitioned into such blocks, the tiles are
+// mapped in row-major order.
+*/
+inline size_t mapTile( size_t i, size_t j, const ThreadMapping& threads, size_t group )
+{
+   size_t gm( 0UL );
+
+   for( size_t k=1UL; k<=group; ++k ) {
+      if( group % k == 0UL && threads.first % k == 0UL && threads.second % ( group / k ) == 0UL &&
+          ( gm == 0UL || max( k, group/k ) < max( gm, group/gm ) ) ) {
+         gm = k;
+      }
+   }
+
+   if( gm == 0UL )
+      return i*threads.second + j;
+
+   const size_t gn( group / gm );
+   const size_t block( ( i / gm ) * ( threads.second / gn ) + ( j / gn ) );
+
+   return block*group + ( i % gm )*gn + ( j % gn );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,814 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Thresholds.h
+//  \brief Header file for the runtime values of the SMP thresholds
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THRESHOLDS_H_
+#define _BLAZE_MATH_SMP_THRESHOLDS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/system/Debugging.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP THRESHOLD IDENTIFIERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identifiers of the SMP thresholds.
+// \ingroup smp
+//
+// Each SMP threshold is identified by the name of the according compile time threshold without
+// the \c _THRESHOLD suffix (as for instance \c SMP_DVECDVECADD for the SMP_DVECDVECADD_THRESHOLD).
+// The identifiers are used to query and to change the runtime value of an SMP threshold (see
+// the smpThreshold() and setSMPThreshold() functions).
+*/
+enum SMPThresholdID : size_t
+{
+   SMP_DVECASSIGN      =  0,  //!< Identifier of the SMP_DVECASSIGN_THRESHOLD.
+   SMP_DVECSCALARMULT  =  1,  //!< Identifier of the SMP_DVECSCALARMULT_THRESHOLD.
+   SMP_DVECDVECADD     =  2,  //!< Identifier of the SMP_DVECDVECADD_THRESHOLD.
+   SMP_DVECDVECSUB     =  3,  //!< Identifier of the SMP_DVECDVECSUB_THRESHOLD.
+   SMP_DVECDVECMULT    =  4,  //!< Identifier of the SMP_DVECDVECMULT_THRESHOLD.
+   SMP_DVECDVECDIV     =  5,  //!< Identifier of the SMP_DVECDVECDIV_THRESHOLD.
+   SMP_DVECDVECOUTER   =  6,  //!< Identifier of the SMP_DVECDVECOUTER_THRESHOLD.
+   SMP_DMATDVECMULT    =  7,  //!< Identifier of the SMP_DMATDVECMULT_THRESHOLD.
+   SMP_TDMATDVECMULT   =  8,  //!< Identifier of the SMP_TDMATDVECMULT_THRESHOLD.
+   SMP_TDVECDMATMULT   =  9,  //!< Identifier of the SMP_TDVECDMATMULT_THRESHOLD.
+   SMP_TDVECTDMATMULT  = 10,  //!< Identifier of the SMP_TDVECTDMATMULT_THRESHOLD.
+   SMP_DMATSVECMULT    = 11,  //!< Identifier of the SMP_DMATSVECMULT_THRESHOLD.
+   SMP_TDMATSVECMULT   = 12,  //!< Identifier of the SMP_TDMATSVECMULT_THRESHOLD.
+   SMP_TSVECDMATMULT   = 13,  //!< Identifier of the SMP_TSVECDMATMULT_THRESHOLD.
+   SMP_TSVECTDMATMULT  = 14,  //!< Identifier of the SMP_TSVECTDMATMULT_THRESHOLD.
+   SMP_SMATDVECMULT    = 15,  //!< Identifier of the SMP_SMATDVECMULT_THRESHOLD.
+   SMP_TSMATDVECMULT   = 16,  //!< Identifier of the SMP_TSMATDVECMULT_THRESHOLD.
+   SMP_TDVECSMATMULT   = 17,  //!< Identifier of the SMP_TDVECSMATMULT_THRESHOLD.
+   SMP_TDVECTSMATMULT  = 18,  //!< Identifier of the SMP_TDVECTSMATMULT_THRESHOLD.
+   SMP_SMATSVECMULT    = 19,  //!< Identifier of the SMP_SMATSVECMULT_THRESHOLD.
+   SMP_TSMATSVECMULT   = 20,  //!< Identifier of the SMP_TSMATSVECMULT_THRESHOLD.
+   SMP_TSVECSMATMULT   = 21,  //!< Identifier of the SMP_TSVECSMATMULT_THRESHOLD.
+   SMP_TSVECTSMATMULT  = 22,  //!< Identifier of the SMP_TSVECTSMATMULT_THRESHOLD.
+   SMP_DMATASSIGN      = 23,  //!< Identifier of the SMP_DMATASSIGN_THRESHOLD.
+   SMP_DMATSCALARMULT  = 24,  //!< Identifier of the SMP_DMATSCALARMULT_THRESHOLD.
+   SMP_DMATDMATADD     = 25,  //!< Identifier of the SMP_DMATDMATADD_THRESHOLD.
+   SMP_DMATTDMATADD    = 26,  //!< Identifier of the SMP_DMATTDMATADD_THRESHOLD.
+   SMP_DMATDMATSUB     = 27,  //!< Identifier of the SMP_DMATDMATSUB_THRESHOLD.
+   SMP_DMATTDMATSUB    = 28,  //!< Identifier of the SMP_DMATTDMATSUB_THRESHOLD.
+   SMP_DMATDMATSCHUR   = 29,  //!< Identifier of the SMP_DMATDMATSCHUR_THRESHOLD.
+   SMP_DMATTDMATSCHUR  = 30,  //!< Identifier of the SMP_DMATTDMATSCHUR_THRESHOLD.
+   SMP_SMATSMATADD     = 31,  //!< Identifier of the SMP_SMATSMATADD_THRESHOLD.
+   SMP_SMATSMATSUB     = 32,  //!< Identifier of the SMP_SMATSMATSUB_THRESHOLD.
+   SMP_SMATSMATSCHUR   = 33,  //!< Identifier of the SMP_SMATSMATSCHUR_THRESHOLD.
+   SMP_DMATDMATMULT    = 34,  //!< Identifier of the SMP_DMATDMATMULT_THRESHOLD.
+   SMP_DMATTDMATMULT   = 35,  //!< Identifier of the SMP_DMATTDMATMULT_THRESHOLD.
+   SMP_TDMATDMATMULT   = 36,  //!< Identifier of the SMP_TDMATDMATMULT_THRESHOLD.
+   SMP_TDMATTDMATMULT  = 37,  //!< Identifier of the SMP_TDMATTDMATMULT_THRESHOLD.
+   SMP_DMATSMATMULT    = 38,  //!< Identifier of the SMP_DMATSMATMULT_THRESHOLD.
+   SMP_DMATTSMATMULT   = 39,  //!< Identifier of the SMP_DMATTSMATMULT_THRESHOLD.
+   SMP_TDMATSMATMULT   = 40,  //!< Identifier of the SMP_TDMATSMATMULT_THRESHOLD.
+   SMP_TDMATTSMATMULT  = 41,  //!< Identifier of the SMP_TDMATTSMATMULT_THRESHOLD.
+   SMP_SMATDMATMULT    = 42,  //!< Identifier of the SMP_SMATDMATMULT_THRESHOLD.
+   SMP_SMATTDMATMULT   = 43,  //!< Identifier of the SMP_SMATTDMATMULT_THRESHOLD.
+   SMP_TSMATDMATMULT   = 44,  //!< Identifier of the SMP_TSMATDMATMULT_THRESHOLD.
+   SMP_TSMATTDMATMULT  = 45,  //!< Identifier of the SMP_TSMATTDMATMULT_THRESHOLD.
+   SMP_SMATSMATMULT    = 46,  //!< Identifier of the SMP_SMATSMATMULT_THRESHOLD.
+   SMP_SMATTSMATMULT   = 47,  //!< Identifier of the SMP_SMATTSMATMULT_THRESHOLD.
+   SMP_TSMATSMATMULT   = 48,  //!< Identifier of the SMP_TSMATSMATMULT_THRESHOLD.
+   SMP_TSMATTSMATMULT  = 49,  //!< Identifier of the SMP_TSMATTSMATMULT_THRESHOLD.
+   SMP_DMATREDUCE      = 50,  //!< Identifier of the SMP_DMATREDUCE_THRESHOLD.
+   SMP_SMATREDUCE      = 51,  //!< Identifier of the SMP_SMATREDUCE_THRESHOLD.
+   SMP_SMATPERMUTE     = 52,  //!< Identifier of the SMP_SMATPERMUTE_THRESHOLD.
+   SMP_SMATASSIGN      = 53,  //!< Identifier of the SMP_SMATASSIGN_THRESHOLD.
+   SMP_DVECREDUCE      = 54,  //!< Identifier of the SMP_DVECREDUCE_THRESHOLD.
+   SMP_DVECNORM        = 55,  //!< Identifier of the SMP_DVECNORM_THRESHOLD.
+   SMP_DVECDVECINNER   = 56,  //!< Identifier of the SMP_DVECDVECINNER_THRESHOLD.
+   SMP_DMATTOTALREDUCE = 57,  //!< Identifier of the SMP_DMATTOTALREDUCE_THRESHOLD.
+   SMP_DMATNORM        = 58,  //!< Identifier of the SMP_DMATNORM_THRESHOLD.
+   SMP_SVECREDUCE      = 59,  //!< Identifier of the SMP_SVECREDUCE_THRESHOLD.
+   SMP_SMATTOTALREDUCE = 60,  //!< Identifier of the SMP_SMATTOTALREDUCE_THRESHOLD.
+   SMP_DMATTRANSPOSE   = 61   //!< Identifier of the SMP_DMATTRANSPOSE_THRESHOLD.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The total number of SMP thresholds.
+// \ingroup smp
+*/
+constexpr size_t SMP_THRESHOLD_COUNT = 62UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The names of all SMP thresholds, as used in SMP threshold files.
+// \ingroup smp
+*/
+constexpr const char* SMP_THRESHOLD_NAMES[SMP_THRESHOLD_COUNT] =
+   { "DVECASSIGN"
+   , "DVECSCALARMULT"
+   , "DVECDVECADD"
+   , "DVECDVECSUB"
+   , "DVECDVECMULT"
+   , "DVECDVECDIV"
+   , "DVECDVECOUTER"
+   , "DMATDVECMULT"
+   , "TDMATDVECMULT"
+   , "TDVECDMATMULT"
+   , "TDVECTDMATMULT"
+   , "DMATSVECMULT"
+   , "TDMATSVECMULT"
+   , "TSVECDMATMULT"
+   , "TSVECTDMATMULT"
+   , "SMATDVECMULT"
+   , "TSMATDVECMULT"
+   , "TDVECSMATMULT"
+   , "TDVECTSMATMULT"
+   , "SMATSVECMULT"
+   , "TSMATSVECMULT"
+   , "TSVECSMATMULT"
+   , "TSVECTSMATMULT"
+   , "DMATASSIGN"
+   , "DMATSCALARMULT"
+   , "DMATDMATADD"
+   , "DMATTDMATADD"
+   , "DMATDMATSUB"
+   , "DMATTDMATSUB"
+   , "DMATDMATSCHUR"
+   , "DMATTDMATSCHUR"
+   , "SMATSMATADD"
+   , "SMATSMATSUB"
+   , "SMATSMATSCHUR"
+   , "DMATDMATMULT"
+   , "DMATTDMATMULT"
+   , "TDMATDMATMULT"
+   , "TDMATTDMATMULT"
+   , "DMATSMATMULT"
+   , "DMATTSMATMULT"
+   , "TDMATSMATMULT"
+   , "TDMATTSMATMULT"
+   , "SMATDMATMULT"
+   , "SMATTDMATMULT"
+   , "TSMATDMATMULT"
+   , "TSMATTDMATMULT"
+   , "SMATSMATMULT"
+   , "SMATTSMATMULT"
+   , "TSMATSMATMULT"
+   , "TSMATTSMATMULT"
+   , "DMATREDUCE"
+   , "SMATREDUCE"
+   , "SMATPERMUTE"
+   , "SMATASSIGN"
+   , "DVECREDUCE"
+   , "DVECNORM"
+   , "DVECDVECINNER"
+   , "DMATTOTALREDUCE"
+   , "DMATNORM"
+   , "SVECREDUCE"
+   , "SMATTOTALREDUCE"
+   , "DMATTRANSPOSE" };
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The compile time default values of all SMP thresholds.
+// \ingroup smp
+*/
+constexpr size_t SMP_THRESHOLD_DEFAULTS[SMP_THRESHOLD_COUNT] =
+   { SMP_DVECASSIGN_THRESHOLD
+   , SMP_DVECSCALARMULT_THRESHOLD
+   , SMP_DVECDVECADD_THRESHOLD
+   , SMP_DVECDVECSUB_THRESHOLD
+   , SMP_DVECDVECMULT_THRESHOLD
+   , SMP_DVECDVECDIV_THRESHOLD
+   , SMP_DVECDVECOUTER_THRESHOLD
+   , SMP_DMATDVECMULT_THRESHOLD
+   , SMP_TDMATDVECMULT_THRESHOLD
+   , SMP_TDVECDMATMULT_THRESHOLD
+   , SMP_TDVECTDMATMULT_THRESHOLD
+   , SMP_DMATSVECMULT_THRESHOLD
+   , SMP_TDMATSVECMULT_THRESHOLD
+   , SMP_TSVECDMATMULT_THRESHOLD
+   , SMP_TSVECTDMATMULT_THRESHOLD
+   , SMP_SMATDVECMULT_THRESHOLD
+   , SMP_TSMATDVECMULT_THRESHOLD
+   , SMP_TDVECSMATMULT_THRESHOLD
+   , SMP_TDVECTSMATMULT_THRESHOLD
+   , SMP_SMATSVECMULT_THRESHOLD
+   , SMP_TSMATSVECMULT_THRESHOLD
+   , SMP_TSVECSMATMULT_THRESHOLD
+   , SMP_TSVECTSMATMULT_THRESHOLD
+   , SMP_DMATASSIGN_THRESHOLD
+   , SMP_DMATSCALARMULT_THRESHOLD
+   , SMP_DMATDMATADD_THRESHOLD
+   , SMP_DMATTDMATADD_THRESHOLD
+   , SMP_DMATDMATSUB_THRESHOLD
+   , SMP_DMATTDMATSUB_THRESHOLD
+   , SMP_DMATDMATSCHUR_THRESHOLD
+   , SMP_DMATTDMATSCHUR_THRESHOLD
+   , SMP_SMATSMATADD_THRESHOLD
+   , SMP_SMATSMATSUB_THRESHOLD
+   , SMP_SMATSMATSCHUR_THRESHOLD
+   , SMP_DMATDMATMULT_THRESHOLD
+   , SMP_DMATTDMATMULT_THRESHOLD
+   , SMP_TDMATDMATMULT_THRESHOLD
+   , SMP_TDMATTDMATMULT_THRESHOLD
+   , SMP_DMATSMATMULT_THRESHOLD
+   , SMP_DMATTSMATMULT_THRESHOLD
+   , SMP_TDMATSMATMULT_THRESHOLD
+   , SMP_TDMATTSMATMULT_THRESHOLD
+   , SMP_SMATDMATMULT_THRESHOLD
+   , SMP_SMATTDMATMULT_THRESHOLD
+   , SMP_TSMATDMATMULT_THRESHOLD
+   , SMP_TSMATTDMATMULT_THRESHOLD
+   , SMP_SMATSMATMULT_THRESHOLD
+   , SMP_SMATTSMATMULT_THRESHOLD
+   , SMP_TSMATSMATMULT_THRESHOLD
+   , SMP_TSMATTSMATMULT_THRESHOLD
+   , SMP_DMATREDUCE_THRESHOLD
+   , SMP_SMATREDUCE_THRESHOLD
+   , SMP_SMATPERMUTE_THRESHOLD
+   , SMP_SMATASSIGN_THRESHOLD
+   , SMP_DVECREDUCE_THRESHOLD
+   , SMP_DVECNORM_THRESHOLD
+   , SMP_DVECDVECINNER_THRESHOLD
+   , SMP_DMATTOTALREDUCE_THRESHOLD
+   , SMP_DMATNORM_THRESHOLD
+   , SMP_SVECREDUCE_THRESHOLD
+   , SMP_SMATTOTALREDUCE_THRESHOLD
+   , SMP_DMATTRANSPOSE_THRESHOLD };
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLD TABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Process-wide table of the runtime values of all SMP thresholds.
+// \ingroup smp
+//
+// The table is constant initialized with the compile time default values of all SMP thresholds,
+// i.e. it is valid before any dynamic initialization takes place. Since all values are stored
+// atomically, the SMP thresholds can be changed at any time. Operations that are in progress at
+// the same time may observe either the previous or the new value, which only affects whether
+// they are executed in parallel, but never their result.
+*/
+template< typename T = void >
+struct SMPThresholdTable
+{
+   static std::atomic<size_t> values[SMP_THRESHOLD_COUNT];  //!< The runtime values of all SMP thresholds.
+   static const bool selected;                              //!< Selection flag of the initial values.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+std::atomic<size_t> SMPThresholdTable<T>::values[SMP_THRESHOLD_COUNT] =
+   { { SMP_DVECASSIGN_THRESHOLD }
+   , { SMP_DVECSCALARMULT_THRESHOLD }
+   , { SMP_DVECDVECADD_THRESHOLD }
+   , { SMP_DVECDVECSUB_THRESHOLD }
+   , { SMP_DVECDVECMULT_THRESHOLD }
+   , { SMP_DVECDVECDIV_THRESHOLD }
+   , { SMP_DVECDVECOUTER_THRESHOLD }
+   , { SMP_DMATDVECMULT_THRESHOLD }
+   , { SMP_TDMATDVECMULT_THRESHOLD }
+   , { SMP_TDVECDMATMULT_THRESHOLD }
+   , { SMP_TDVECTDMATMULT_THRESHOLD }
+   , { SMP_DMATSVECMULT_THRESHOLD }
+   , { SMP_TDMATSVECMULT_THRESHOLD }
+   , { SMP_TSVECDMATMULT_THRESHOLD }
+   , { SMP_TSVECTDMATMULT_THRESHOLD }
+   , { SMP_SMATDVECMULT_THRESHOLD }
+   , { SMP_TSMATDVECMULT_THRESHOLD }
+   , { SMP_TDVECSMATMULT_THRESHOLD }
+   , { SMP_TDVECTSMATMULT_THRESHOLD }
+   , { SMP_SMATSVECMULT_THRESHOLD }
+   , { SMP_TSMATSVECMULT_THRESHOLD }
+   , { SMP_TSVECSMATMULT_THRESHOLD }
+   , { SMP_TSVECTSMATMULT_THRESHOLD }
+   , { SMP_DMATASSIGN_THRESHOLD }
+   , { SMP_DMATSCALARMULT_THRESHOLD }
+   , { SMP_DMATDMATADD_THRESHOLD }
+   , { SMP_DMATTDMATADD_THRESHOLD }
+   , { SMP_DMATDMATSUB_THRESHOLD }
+   , { SMP_DMATTDMATSUB_THRESHOLD }
+   , { SMP_DMATDMATSCHUR_THRESHOLD }
+   , { SMP_DMATTDMATSCHUR_THRESHOLD }
+   , { SMP_SMATSMATADD_THRESHOLD }
+   , { SMP_SMATSMATSUB_THRESHOLD }
+   , { SMP_SMATSMATSCHUR_THRESHOLD }
+   , { SMP_DMATDMATMULT_THRESHOLD }
+   , { SMP_DMATTDMATMULT_THRESHOLD }
+   , { SMP_TDMATDMATMULT_THRESHOLD }
+   , { SMP_TDMATTDMATMULT_THRESHOLD }
+   , { SMP_DMATSMATMULT_THRESHOLD }
+   , { SMP_DMATTSMATMULT_THRESHOLD }
+   , { SMP_TDMATSMATMULT_THRESHOLD }
+   , { SMP_TDMATTSMATMULT_THRESHOLD }
+   , { SMP_SMATDMATMULT_THRESHOLD }
+   , { SMP_SMATTDMATMULT_THRESHOLD }
+   , { SMP_TSMATDMATMULT_THRESHOLD }
+   , { SMP_TSMATTDMATMULT_THRESHOLD }
+   , { SMP_SMATSMATMULT_THRESHOLD }
+   , { SMP_SMATTSMATMULT_THRESHOLD }
+   , { SMP_TSMATSMATMULT_THRESHOLD }
+   , { SMP_TSMATTSMATMULT_THRESHOLD }
+   , { SMP_DMATREDUCE_THRESHOLD }
+   , { SMP_SMATREDUCE_THRESHOLD }
+   , { SMP_SMATPERMUTE_THRESHOLD }
+   , { SMP_SMATASSIGN_THRESHOLD }
+   , { SMP_DVECREDUCE_THRESHOLD }
+   , { SMP_DVECNORM_THRESHOLD }
+   , { SMP_DVECDVECINNER_THRESHOLD }
+   , { SMP_DMATTOTALREDUCE_THRESHOLD }
+   , { SMP_DMATNORM_THRESHOLD }
+   , { SMP_SVECREDUCE_THRESHOLD }
+   , { SMP_SMATTOTALREDUCE_THRESHOLD }
+   , { SMP_DMATTRANSPOSE_THRESHOLD } };
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP threshold functions */
+//@{
+inline size_t smpThreshold( SMPThresholdID id ) noexcept;
+inline void setSMPThreshold( SMPThresholdID id, size_t value ) noexcept;
+inline void resetSMPThresholds() noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the runtime value of the given SMP threshold.
+// \ingroup smp
+//
+// \param id The identifier of the SMP threshold.
+// \return The runtime value of the SMP threshold.
+//
+// This function returns the current value of the given SMP threshold. Initially, all SMP
+// thresholds have their compile time default values (see <tt>./blaze/config/Thresholds.h</tt>),
+// which can be adapted at runtime via setSMPThreshold(), loadSMPThresholds(), the calibration
+// functions or the \c BLAZE_SMP_THRESHOLDS environment variable:
+
+   \code
+   bool canSMPAssign() const noexcept {
+      return ( size() > smpThreshold( SMP_DVECDVECADD ) );
+   }
+   \endcode
+*/
+inline size_t smpThreshold( SMPThresholdID id ) noexcept
+{
+   MAYBE_UNUSED( SMPThresholdTable<>::selected );
+
+   return SMPThresholdTable<>::values[id].load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the runtime value of the given SMP threshold.
+// \ingroup smp
+//
+// \param id The identifier of the SMP threshold.
+// \param value The new value of the SMP threshold.
+// \return void
+//
+// This function changes the value of the given SMP threshold for all subsequent operations:
+
+   \code
+   blaze::setSMPThreshold( blaze::SMP_DVECDVECADD, 50000UL );
+   \endcode
+
+// Note that the SMP thresholds can be changed at any time. Operations that are in progress at
+// the same time (for instance operations executed by another thread or asynchronous assignments)
+// may observe either the previous or the new value. This only affects whether they are executed
+// in parallel, but never their result.
+*/
+inline void setSMPThreshold( SMPThresholdID id, size_t value ) noexcept
+{
+   SMPThresholdTable<>::values[id].store( value, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all SMP thresholds to their compile time default values.
+// \ingroup smp
+//
+// \return void
+*/
+inline void resetSMPThresholds() noexcept
+{
+   for( size_t i=0UL; i<SMP_THRESHOLD_COUNT; ++i ) {
+      SMPThresholdTable<>::values[i].store( SMP_THRESHOLD_DEFAULTS[i], std::memory_order_relaxed );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLD FILES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Section of an SMP threshold file.
+// \ingroup smp
+//
+// A section contains the values of the SMP thresholds for a specific number of threads. The
+// values of section 0 apply to any number of threads.
+*/
+struct SMPThresholdSection
+{
+   size_t threads;  //!< The number of threads the section has been calibrated for.
+   std::vector< std::pair<SMPThresholdID,size_t> > values;  //!< The values of the section.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sections of an SMP threshold file.
+// \ingroup smp
+*/
+using SMPThresholdSections = std::vector<SMPThresholdSection>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the section for the given number of threads.
+// \ingroup smp
+//
+// \param sections The sections of an SMP threshold file.
+// \param threads The number of threads of the section.
+// \return Reference to the (possibly new) section for the given number of threads.
+*/
+inline SMPThresholdSection& smpThresholdSection( SMPThresholdSections& sections, size_t threads )
+{
+   for( SMPThresholdSection& section : sections ) {
+      if( section.threads == threads )
+         return section;
+   }
+
+   sections.push_back( SMPThresholdSection{ threads, {} } );
+   return sections.back();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses a single line of an SMP threshold file.
+// \ingroup smp
+//
+// \param line The line to be parsed.
+// \param name The parsed name.
+// \param value The parsed value.
+// \return 1 in case of an empty line, 2 in case of a valid line, 0 in case of a malformed line.
+*/
+inline int parseSMPThresholdLine( const std::string& line, std::string& name, size_t& value )
+{
+   const size_t end( line.find( '#' ) );
+   const size_t size( end == std::string::npos ? line.size() : end );
+   size_t pos( 0UL );
+
+   const auto skip = [&]() {
+      while( pos < size && std::isspace( static_cast<unsigned char>( line[pos] ) ) ) ++pos;
+   };
+
+   skip();
+
+   if( pos == size )
+      return 1;
+
+   const size_t first( pos );
+   while( pos < size && !std::isspace( static_cast<unsigned char>( line[pos] ) ) ) ++pos;
+   name.assign( line, first, pos-first );
+
+   skip();
+
+   if( pos == size || !std::isdigit( static_cast<unsigned char>( line[pos] ) ) )
+      return 0;
+
+   value = 0UL;
+   while( pos < size && std::isdigit( static_cast<unsigned char>( line[pos] ) ) ) {
+      const size_t digit( static_cast<size_t>( line[pos] - '0' ) );
+      if( value > ( size_t(-1) - digit ) / 10UL )
+         return 0;
+      value = value*10UL + digit;
+      ++pos;
+   }
+
+   skip();
+
+   return ( pos == size )?( 2 ):( 0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses the content of an SMP threshold file.
+// \ingroup smp
+//
+// \param file The SMP threshold file to be parsed.
+// \param sections The sections of the SMP threshold file.
+// \return \a true in case the file has been parsed successfully, \a false if not.
+//
+// This function parses the given file in the format written by the saveSMPThresholds() function.
+// Empty lines and everything following a '#' character are ignored. A line of the form
+// "threads <N>" starts the section for \a N threads, all other lines have to be of the form
+// "<NAME> <VALUE>", where \a NAME is the name of an SMP threshold (as for instance "DVECDVECADD"
+// for the SMP_DVECDVECADD_THRESHOLD). All values preceding the first "threads" line are stored
+// in section 0. Unknown threshold names are ignored.
+*/
+inline bool parseSMPThresholds( std::FILE* file, SMPThresholdSections& sections )
+{
+   std::string line, name;
+   size_t value( 0UL );
+   size_t threads( 0UL );
+   int c( 0 );
+
+   while( c != EOF )
+   {
+      line.clear();
+      while( ( c = std::getc( file ) ) != EOF && c != '\n' ) {
+         line += static_cast<char>( c );
+      }
+
+      const int result( parseSMPThresholdLine( line, name, value ) );
+
+      if( result == 0 )
+         return false;
+
+      if( result == 1 )
+         continue;
+
+      if( name == "threads" ) {
+         if( value == 0UL ) return false;
+         threads = value;
+         smpThresholdSection( sections, threads );
+         continue;
+      }
+
+      for( size_t i=0UL; i<SMP_THRESHOLD_COUNT; ++i ) {
+         if( name == SMP_THRESHOLD_NAMES[i] ) {
+            smpThresholdSection( sections, threads ).values.emplace_back( SMPThresholdID( i ), value );
+            break;
+         }
+      }
+   }
+
+   return !std::ferror( file );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the sections of an SMP threshold file for the given number of threads.
+// \ingroup smp
+//
+// \param sections The sections of the SMP threshold file.
+// \param threads The number of threads.
+// \return void
+//
+// This function first applies the values of section 0 and afterwards the values of the section
+// for the given number of threads. In case there is no section for the given number of threads,
+// the section for the next smaller number of threads is applied.
+*/
+inline void applySMPThresholds( const SMPThresholdSections& sections, size_t threads ) noexcept
+{
+   const SMPThresholdSection* common ( nullptr );
+   const SMPThresholdSection* specific( nullptr );
+
+   for( const SMPThresholdSection& section : sections ) {
+      if( section.threads == 0UL )
+         common = &section;
+      else if( section.threads <= threads && ( !specific || specific->threads < section.threads ) )
+         specific = &section;
+   }
+
+   for( const SMPThresholdSection* section : { common, specific } ) {
+      if( section == nullptr ) continue;
+      for( const auto& entry : section->values ) {
+         setSMPThreshold( entry.first, entry.second );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the sections of the SMP threshold file named by the \c BLAZE_SMP_THRESHOLDS
+//        environment variable.
+// \ingroup smp
+//
+// \return The sections of the SMP threshold file.
+//
+// The SMP threshold file is read once on the first call of the function. In case the Blaze debug
+// mode is active, the environment variable is not set, or the file cannot be read, no section
+// is returned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline const SMPThresholdSections& smpThresholdEnvironment() noexcept
+{
+   static const SMPThresholdSections sections( []() noexcept
+   {
+      SMPThresholdSections result;
+      const char* name( std::getenv( "BLAZE_SMP_THRESHOLDS" ) );
+
+      if( BLAZE_DEBUG_MODE || name == nullptr )
+         return result;
+
+      try {
+         std::FILE* file( std::fopen( name, "r" ) );
+
+         if( file != nullptr ) {
+            if( !parseSMPThresholds( file, result ) )
+               result.clear();
+            std::fclose( file );
+         }
+      }
+      catch( ... ) {
+         result.clear();
+      }
+
+      return result;
+   }() );
+
+   return sections;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selects the SMP thresholds of the \c BLAZE_SMP_THRESHOLDS file for the given number of
+//        threads.
+// \ingroup smp
+//
+// \param threads The number of threads.
+// \return void
+//
+// In case the \c BLAZE_SMP_THRESHOLDS environment variable names a readable SMP threshold file,
+// this function resets all SMP thresholds to their compile time default values and afterwards
+// applies the values of the file for the given number of threads. Otherwise the function has
+// no effect. The function is called by the shared memory parallelizations whenever the number
+// of threads is established or changed (as for instance by the setNumThreads() function).
+*/
+inline void selectSMPThresholds( size_t threads ) noexcept
+{
+   const SMPThresholdSections& sections( smpThresholdEnvironment() );
+
+   if( sections.empty() )
+      return;
+
+   resetSMPThresholds();
+   applySMPThresholds( sections, threads );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the initial values of the SMP thresholds.
+//
+// The initial values are selected once during the dynamic initialization of the program. Until
+// then all SMP thresholds have their compile time default values. In case of the C++11 and Boost
+// thread parallelizations, the initial values are selected by the thread backend as soon as the
+// initial number of threads is known (see the ThreadBackend class template). In case of the HPX
+// parallelization, the number of threads is not known before the start of the HPX runtime and
+// therefore the values for the current number of threads have to be loaded explicitly (see the
+// loadSMPThresholds() function).
+*/
+template< typename T >
+const bool SMPThresholdTable<T>::selected = []() noexcept
+{
+#if BLAZE_OPENMP_PARALLEL_MODE
+   selectSMPThresholds( static_cast<size_t>( omp_get_max_threads() ) );
+#elif !BLAZE_HPX_PARALLEL_MODE && !BLAZE_CPP_THREADS_PARALLEL_MODE && !BLAZE_BOOST_THREADS_PARALLEL_MODE
+   selectSMPThresholds( 1UL );
+#endif
+   return true;
+}();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTRANSPOSE + 1UL == blaze::SMP_THRESHOLD_COUNT );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
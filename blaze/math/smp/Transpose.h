@@ -0,0 +1,222 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Transpose.h
+//  \brief Header file for the SMP in-place transposition of dense matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TRANSPOSE_H_
+#define _BLAZE_MATH_SMP_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/Transpose.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP IN-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether an in-place transposition can be executed in parallel.
+// \ingroup smp
+//
+// \param size The total number of elements of the matrix to be transposed.
+// \return \a true in case the transposition can be executed in parallel, \a false if not.
+//
+// This function returns \a true in case a shared-memory parallelization is active, more than
+// a single thread is available, the given number of elements reaches the SMP dense matrix
+// transposition threshold, and the function is called neither from within a serial nor from
+// within a parallel section.
+*/
+inline bool canSMPTranspose( size_t size )
+{
+   return size >= smpThreshold( SMP_DMATTRANSPOSE ) && canSMPFor();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the SMP in-place transposition of a square dense matrix.
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function splits the given square dense matrix into square blocks (see the BLOCK_SIZE
+// setting) and distributes all pairs of blocks of the lower and the upper part of the matrix
+// evenly among the available threads. Each pair of off-diagonal blocks is swapped and each
+// block on the diagonal is transposed in-place by means of the cache-oblivious transposition
+// kernels. Since all pairs of blocks are disjoint, no synchronization between the threads is
+// required.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized in-place transposition of dense matrices. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< bool Conj    // Conjugation flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void smpTransposeBackend( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() == (~dm).columns(), "Non-square matrix detected" );
+
+   waitForAsyncAssignments( ~dm, ~dm );
+
+   ElementType_t<MT>* const a( (~dm).data() );
+   const size_t s( (~dm).spacing() );
+   const size_t n( (~dm).rows() );
+
+   if( !canSMPTranspose( n*n ) ) {
+      transposeSquareKernel<Conj>( a, s, n );
+      return;
+   }
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   const size_t blocks ( ( n + block - 1UL ) / block );
+   const size_t pairs  ( blocks * ( blocks + 1UL ) / 2UL );
+   const size_t threads( min( getNumThreads(), pairs ) );
+
+   auto chunk = [=]( size_t k )
+   {
+      const size_t begin( (  k       * pairs ) / threads );
+      const size_t end  ( ( (k+1UL) * pairs ) / threads );
+
+      size_t ib( 0UL );
+      size_t jb( begin );
+
+      while( jb > ib ) {
+         jb -= ++ib;
+      }
+
+      for( size_t p=begin; p<end; ++p )
+      {
+         const size_t i( ib*block );
+         const size_t j( jb*block );
+
+         if( ib == jb ) {
+            transposeSquareKernel<Conj>( a+i*s+i, s, min( block, n-i ) );
+            ++ib;
+            jb = 0UL;
+         }
+         else {
+            transposeSwapKernel<Conj>( a+i*s+j, a+j*s+i, s, min( block, n-i ), block );
+            ++jb;
+         }
+      }
+   };
+
+   smpFor( threads, chunk );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP in-place transposition of a square dense matrix (\f$ A = A^T \f$).
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function transposes the given square dense matrix in-place. In case the number of
+// elements of the matrix reaches the SMP dense matrix transposition threshold (see the
+// BLAZE_SMP_DMATTRANSPOSE_THRESHOLD setting), the transposition is executed in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized in-place transposition of dense matrices. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void smpTranspose( DenseMatrix<MT,SO>& dm )
+{
+   smpTransposeBackend<false>( ~dm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP in-place conjugate transposition of a square dense matrix (\f$ A = A^H \f$).
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function computes the conjugate transpose of the given square dense matrix in-place.
+// In case the number of elements of the matrix reaches the SMP dense matrix transposition
+// threshold (see the BLAZE_SMP_DMATTRANSPOSE_THRESHOLD setting), the conjugate transposition
+// is executed in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized in-place transposition of dense matrices. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void smpCTranspose( DenseMatrix<MT,SO>& dm )
+{
+   smpTransposeBackend<true>( ~dm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -46,6 +46,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/StaticAssert.h>
 
 
@@ -105,6 +106,7 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), false );
    assign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -136,6 +138,7 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    addAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -167,6 +170,7 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    subAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -199,6 +203,7 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), false );
    schurAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
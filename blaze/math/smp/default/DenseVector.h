@@ -46,6 +46,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/StaticAssert.h>
 
 
@@ -107,6 +108,7 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, false );
    assign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -136,6 +138,7 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, false );
    addAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -165,6 +168,7 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, false );
    subAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -194,6 +198,7 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, false );
    multAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -223,6 +228,7 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, false );
    divAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
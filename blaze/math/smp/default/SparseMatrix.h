@@ -41,10 +41,12 @@
 //*************************************************************************************************
 
 #include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 
 
 namespace blaze {
@@ -100,9 +102,12 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), false );
    assign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -131,9 +136,12 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    addAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -162,9 +170,12 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    subAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -194,9 +205,12 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), false );
    schurAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
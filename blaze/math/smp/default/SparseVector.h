@@ -41,10 +41,12 @@
 //*************************************************************************************************
 
 #include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 
 
 namespace blaze {
@@ -100,7 +102,10 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, false );
    assign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -129,7 +134,10 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, false );
    addAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -159,7 +167,10 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, false );
    subAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
@@ -189,7 +200,10 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, false );
    multAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
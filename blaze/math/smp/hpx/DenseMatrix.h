@@ -47,6 +47,8 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/ExecutionPolicy.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/Functions.h>
@@ -61,6 +63,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -126,6 +129,8 @@ void hpxAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP o
 
    for_loop( par, size_t(0), threads, [&](int i)
    {
+      ParallelTask marker;
+
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
       const size_t column( ( i % threadmap.second ) * colsPerThread );
 
@@ -201,6 +206,8 @@ void hpxAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs, OP
 
    for_loop( par, size_t(0), threads, [&](int i)
    {
+      ParallelTask marker;
+
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
       const size_t column( ( i % threadmap.second ) * colsPerThread );
 
@@ -255,9 +262,12 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), false );
    assign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -292,6 +302,8 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -299,9 +311,11 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), false );
       assign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
    }
 }
@@ -344,9 +358,12 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    addAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -381,6 +398,8 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -388,9 +407,11 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), false );
       addAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
    }
 }
@@ -433,9 +454,12 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    subAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -470,6 +494,8 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -477,9 +503,11 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), false );
       subAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
    }
 }
@@ -523,9 +551,12 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), false );
    schurAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -560,6 +591,8 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -567,9 +600,11 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), false );
       schurAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
    }
 }
@@ -611,9 +646,12 @@ inline auto smpMultAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).rows(), (~lhs).columns(), false );
    multAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -46,6 +46,8 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/ExecutionPolicy.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/Functions.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -57,6 +59,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -115,6 +118,8 @@ void hpxAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, OP o
 
    for_loop( par, size_t(0), threads, [&](int i)
    {
+      ParallelTask marker;
+
       const size_t index( i*sizePerThread );
 
       if( index >= (~lhs).size() )
@@ -183,6 +188,8 @@ void hpxAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs, OP
 
    for_loop( par, size_t(0), threads, [&](int i)
    {
+      ParallelTask marker;
+
       const size_t index( i*sizePerThread );
 
       if( index < (~lhs).size() )
@@ -233,8 +240,11 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, false );
    assign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -268,15 +278,19 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, false );
       assign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
    }
 }
@@ -319,8 +333,11 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, false );
    addAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -354,15 +371,19 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, false );
       addAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
    }
 }
@@ -405,8 +426,11 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, false );
    subAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -440,15 +464,19 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, false );
       subAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
    }
 }
@@ -491,8 +519,11 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, false );
    multAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -526,15 +557,19 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, false );
       multAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ multAssign( a, b ); } );
    }
 }
@@ -577,8 +612,11 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, false );
    divAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -612,15 +650,19 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, false );
       divAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, true );
       hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ divAssign( a, b ); } );
    }
 }
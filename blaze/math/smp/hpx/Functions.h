@@ -43,6 +43,7 @@
 #include <hpx/runtime/get_os_thread_count.hpp>
 
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/ExecutionPolicy.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
@@ -66,11 +67,15 @@ namespace blaze {
 //
 // Via this function the number of threads used for HPX parallel operations can be queried. The
 // function generally reflects the number of threads as set by the \c --hpx::threads environment
-// variable.
+// variable, restricted to the maximum number of threads of the active execution policy of the
+// calling thread (see the ExecutionPolicy class).
 */
 BLAZE_ALWAYS_INLINE size_t getNumThreads()
 {
-   return 4 * hpx::get_os_thread_count();
+   const size_t threads( 4 * hpx::get_os_thread_count() );
+   const size_t limit( getExecutionPolicy().threads() );
+
+   return ( limit != 0UL && limit < threads )?( limit ):( threads );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -47,6 +47,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
@@ -60,6 +61,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -253,9 +255,12 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), false );
    assign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -289,6 +294,8 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -298,9 +305,11 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), false );
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
@@ -345,9 +354,12 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    addAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -381,6 +393,8 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -390,9 +404,11 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), false );
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
@@ -437,9 +453,12 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    subAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -473,6 +492,8 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -482,9 +503,11 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), false );
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
@@ -529,9 +552,12 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), false );
    schurAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -565,6 +591,8 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -574,9 +602,11 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), false );
          schurAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
       }
@@ -619,9 +649,12 @@ inline auto smpMultAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).rows(), (~lhs).columns(), false );
    multAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -46,6 +46,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -57,6 +58,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -233,8 +235,11 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, false );
    assign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -268,6 +273,8 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -276,9 +283,11 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, false );
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
@@ -323,8 +332,11 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, false );
    addAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -358,6 +370,8 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -366,9 +380,11 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, false );
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
@@ -413,8 +429,11 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, false );
    subAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -448,6 +467,8 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -456,9 +477,11 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, false );
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
@@ -503,8 +526,11 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, false );
    multAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -538,6 +564,8 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -546,9 +574,11 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, false );
          multAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ multAssign( a, b ); } );
       }
@@ -593,8 +623,11 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, false );
    divAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -628,6 +661,8 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -636,9 +671,11 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, false );
          divAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, true );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ divAssign( a, b ); } );
       }
@@ -42,6 +42,7 @@
 
 #include <omp.h>
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
@@ -86,7 +87,9 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //
 // Via this function the maximum number of threads for OpenMP parallel operations can be specified.
 // Note that the given \a number must be in the range \f$[1..infty)\f$. In case an invalid
-// number of threads is specified, a \a std::invalid_argument exception is thrown.
+// number of threads is specified, a \a std::invalid_argument exception is thrown. Additionally,
+// the SMP thresholds for the given number of threads are selected from the file specified via
+// the \c BLAZE_SMP_THRESHOLDS environment variable.
 */
 BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
@@ -95,6 +98,7 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
    }
 
    omp_set_num_threads( static_cast<int>( number ) );
+   selectSMPThresholds( number );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -45,6 +45,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
@@ -59,6 +60,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -134,28 +136,30 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
          if( column >= (~rhs).columns() )
             continue;
 
+         const size_t position( mapTile( i, j, threads, TheThreadBackend::group() ) );
+
          const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
          const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( position, target, source, op );
          }
          else if( simdEnabled && lhsAligned ) {
             auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( position, target, source, op );
          }
          else if( simdEnabled && rhsAligned ) {
             auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( position, target, source, op );
          }
          else {
             auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( position, target, source, op );
          }
       }
    }
@@ -217,12 +221,14 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
          if( column >= (~lhs).columns() )
             continue;
 
+         const size_t position( mapTile( i, j, threads, TheThreadBackend::group() ) );
+
          const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
          const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
 
          auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
          const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( position, target, source, op );
       }
    }
 
@@ -267,9 +273,12 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), false );
    assign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -303,6 +312,8 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -312,9 +323,11 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), false );
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).rows(), (~lhs).columns(), true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
    }
@@ -359,9 +372,12 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    addAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -395,6 +411,8 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -404,9 +422,11 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), false );
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).rows(), (~lhs).columns(), true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
    }
@@ -451,9 +471,12 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), false );
    subAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -488,6 +511,8 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -497,9 +522,11 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), false );
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).rows(), (~lhs).columns(), true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
    }
@@ -544,9 +571,12 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), false );
    schurAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -581,6 +611,8 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
 
@@ -590,9 +622,11 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), false );
          schurAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( schurAssignment, (~lhs).rows(), (~lhs).columns(), true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
       }
    }
@@ -635,9 +669,12 @@ inline auto smpMultAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).rows(), (~lhs).columns(), false );
    multAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -45,6 +45,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
@@ -57,6 +58,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -125,22 +127,22 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( i, target, source, op );
       }
       else if( simdEnabled && lhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( i, target, source, op );
       }
       else if( simdEnabled && rhsAligned ) {
          auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( i, target, source, op );
       }
       else {
          auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( i, target, source, op );
       }
    }
 
@@ -193,7 +195,7 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
       const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-      TheThreadBackend::schedule( target, source, op );
+      TheThreadBackend::schedule( i, target, source, op );
    }
 
    TheThreadBackend::wait();
@@ -237,8 +239,11 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, false );
    assign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -272,6 +277,8 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -280,9 +287,11 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, false );
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( plainAssignment, (~lhs).size(), 1UL, true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
    }
@@ -327,8 +336,11 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, false );
    addAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -362,6 +374,8 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -370,9 +384,11 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, false );
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( additionAssignment, (~lhs).size(), 1UL, true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
    }
@@ -417,8 +433,11 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, false );
    subAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -453,6 +472,8 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -461,9 +482,11 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, false );
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( subtractionAssignment, (~lhs).size(), 1UL, true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
    }
@@ -508,8 +531,11 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, false );
    multAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -544,6 +570,8 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -552,9 +580,11 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, false );
          multAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( multiplicationAssignment, (~lhs).size(), 1UL, true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ multAssign( a, b ); } );
       }
    }
@@ -599,8 +629,11 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
+   BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, false );
    divAssign( ~lhs, ~rhs );
 }
 /*! \endcond */
@@ -634,6 +667,8 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
+   waitForAsyncAssignments( ~lhs, ~rhs );
+
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
 
@@ -642,9 +677,11 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, false );
          divAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_INSTRUMENT_ASSIGNMENT( divisionAssignment, (~lhs).size(), 1UL, true );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ divAssign( a, b ); } );
       }
    }
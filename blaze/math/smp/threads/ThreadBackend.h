@@ -50,13 +50,24 @@
 #  include <boost/thread/thread.hpp>
 #endif
 
+#include <algorithm>
 #include <cstdlib>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/smp/ExecutionPolicy.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -75,7 +86,13 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. Via the \c BLAZE_AFFINITY
+// environment variable the threads can be pinned to logical CPUs (see the createAffinity()
+// function for the available policies). In that case tasks that are scheduled for neighboring
+// thread positions are placed on threads that share the last-level cache. In case the active
+// execution policy of the calling thread specifies an executor (see the ExecutionPolicy class),
+// all tasks of the calling thread are collected and handed over to the executor as soon as the
+// calling thread waits for their completion.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -90,8 +107,11 @@ class ThreadBackend
    /*!\name Utility functions */
    //@{
    static inline size_t size  ();
+   static inline size_t group ();
    static inline void   resize( size_t n, bool block=false );
    static inline void   wait  ();
+   static inline void   defer ( bool flag );
+   static inline void   join  ();
    //@}
    //**********************************************************************************************
 
@@ -100,10 +120,36 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename Target, typename Source, typename OP >
+   static inline void schedule( size_t position, Target& target, const Source& source, OP op );
+
+   template< typename Callable >
+   static inline void schedule( size_t position, Callable task );
    //@}
    //**********************************************************************************************
 
  private:
+   //**Private class Pinning***********************************************************************
+   /*!\brief The logical CPUs the threads are pinned to.
+   */
+   struct Pinning
+   {
+      std::vector<size_t> cpus;     //!< The logical CPUs of the threads.
+      std::vector<size_t> domains;  //!< The last-level cache domains of the logical CPUs.
+   };
+   //**********************************************************************************************
+
+   //**Private class Placement*********************************************************************
+   /*!\brief The placement of thread positions on the threads of the pool.
+   */
+   struct Placement
+   {
+      std::vector<size_t> order;  //!< The thread for each thread position.
+      size_t              group;  //!< The number of consecutive positions sharing a cache.
+   };
+   //**********************************************************************************************
+
    //**Private class Assigner**********************************************************************
    /*!\brief Auxiliary functor for the threaded execution of a plain assignment.
    */
@@ -149,10 +195,64 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Task**************************************************************************
+   /*!\brief Auxiliary functor for the execution of a task by the threads of the pool.
+   */
+   template< typename Callable >  // Type of the task
+   struct Task
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Task class template.
+      //
+      // \param task The task to be executed.
+      */
+      explicit inline Task( Callable task )
+         : task_( std::move( task ) )  // The task to be executed
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the task on behalf of a parallel operation.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         ParallelTask marker;
+         task_();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Callable task_;  //!< The task to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Tasks        = std::vector< std::function<void()> >;  //!< Type of the tasks for an executor.
+   using PlacementPtr = std::shared_ptr<const Placement>;     //!< Type of a published placement.
+   //**********************************************************************************************
+
+   //**Thread execution functions******************************************************************
+   /*!\name Thread execution functions */
+   //@{
+   template< typename Callable >
+   static inline void submit( size_t position, Callable task );
+
+   static inline void   execute();
+   static inline Tasks& tasks() noexcept;
+   //@}
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t    initPool();
+   static inline Pinning   initPinning();
+   static inline Placement initPlacement( size_t n );
+   static inline const Pinning& pinning();
+   static inline PlacementPtr   placement();
+   static inline PlacementPtr&  thePlacement();
    //@}
    //**********************************************************************************************
 
@@ -165,6 +265,8 @@ class ThreadBackend
                                                      \c BLAZE_NUM_THREADS. However, it can be
                                                      explicitly resized to arbitrary numbers of
                                                      threads. */
+
+   static thread_local bool deferred_;  //!< Flag for the deferral of the wait() function.
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +285,10 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), pinning().cpus );
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local bool ThreadBackend<TT,MT,LT,CT>::deferred_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -198,9 +303,14 @@ ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Returns the total number of threads managed by the thread backend system.
+/*!\brief Returns the number of threads available to the calling thread.
+//
+// \return The number of threads available to the calling thread.
 //
-// \return The total number of threads of the thread backend system.
+// This function returns the total number of threads of the thread backend system, restricted
+// to the maximum number of threads of the active execution policy of the calling thread. In
+// case the policy specifies an executor, the function returns the maximum number of threads of
+// the policy or, in case the number of threads is not restricted, the number of hardware threads.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -208,7 +318,39 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 {
-   return threadpool_.size();
+   const ExecutionPolicy& policy( getExecutionPolicy() );
+
+   if( policy.executor() ) {
+      return ( policy.threads() != 0UL )
+             ?( policy.threads() )
+             :( max( size_t( TT::hardware_concurrency() ), 1UL ) );
+   }
+
+   const size_t threads( threadpool_.size() );
+
+   return ( policy.threads() != 0UL && policy.threads() < threads )?( policy.threads() ):( threads );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of consecutive thread positions that share a cache.
+//
+// \return The number of consecutive thread positions that share the last-level cache.
+//
+// This function returns the number of consecutive thread positions that are placed on threads
+// sharing the same last-level cache. In case the threads are not pinned or the threads are not
+// evenly distributed among the cache domains, the function returns 1.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::group()
+{
+   return placement()->group;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -228,7 +370,10 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // removed from the backend system, otherwise new threads are added to the backend system. In
 // case an invalid number of threads is specified, an \a std::invalid_argument exception is
 // thrown. Via the \a block flag it is possible to block the function until the desired
-// number of threads is available.
+// number of threads is available. The placement of the thread positions for the new number of
+// threads is published atomically, i.e. concurrently scheduled tasks either use the previous
+// or the new placement. Additionally, the SMP thresholds for the new number of threads are
+// selected from the file specified via the \c BLAZE_SMP_THRESHOLDS environment variable.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -236,7 +381,9 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 {
-   return threadpool_.resize( n, block );
+   threadpool_.resize( n, block );
+   std::atomic_store( &thePlacement(), std::make_shared<const Placement>( initPlacement( n ) ) );
+   selectSMPThresholds( n );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -256,7 +403,58 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   if( !deferred_ ) {
+      join();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deferring all calls to the wait() function.
+//
+// \param flag \a true to defer all calls to the wait() function, \a false to stop deferring.
+// \return void
+//
+// While the deferral is active, calls to the wait() function return immediately. This allows
+// to schedule several assignments before joining them by a single call to the join() function.
+// Note that all operands of the scheduled assignments have to be kept alive until the join.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::defer( bool flag )
+{
+   deferred_ = flag;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for all scheduled tasks to be completed, even if the wait is deferred.
+//
+// \return void
+//
+// In case the active execution policy of the calling thread specifies an executor, this function
+// hands all tasks scheduled by the calling thread over to the executor and blocks until they
+// have been completed. Otherwise it blocks until all tasks of the thread pool have been completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::join()
+{
+   execute();
+
+   if( !getExecutionPolicy().executor() ) {
+      threadpool_.wait();
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -291,7 +489,164 @@ template< typename Target  // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source& source, OP op )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source,OP>( target, source, op ) );
+
+   if( getExecutionPolicy().executor() ) {
+      tasks().emplace_back( Assigner<Target,Source,OP>( target, source, op ) );
+   }
+   else {
+      using TaskType = Task< Assigner<Target,Source,OP> >;
+      threadpool_.schedule( TaskType( Assigner<Target,Source,OP>( target, source, op ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an assignment of the given operands for execution at the given position.
+//
+// \param position The thread position of the assignment.
+// \param target The target operand to be assigned to.
+// \param source The source operand to be assigned to the target.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function schedules a (compound) assignment of the two given operands for execution on
+// the thread placed at the given position (modulo the number of threads). Consecutive groups
+// of positions (see the group() function) are placed on threads sharing the last-level cache.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Target  // Type of the target operand
+        , typename Source  // Type of the source operand
+        , typename OP >    // Type of the assignment operation
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( size_t position, Target& target, const Source& source, OP op )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+
+   submit( position, Assigner<Target,Source,OP>( target, source, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given task for execution at the given position.
+//
+// \param position The thread position of the task.
+// \param task The task to be executed.
+// \return void
+//
+// This function schedules the given task for execution on the thread placed at the given
+// position (modulo the number of threads).
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( size_t position, Callable task )
+{
+   submit( position, std::move( task ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Submitting the given task for execution at the given position.
+//
+// \param position The thread position of the task.
+// \param task The task to be executed.
+// \return void
+//
+// In case the active execution policy of the calling thread specifies an executor, the given
+// task is collected for the executor. Otherwise it is scheduled for execution on the thread
+// placed at the given position (modulo the number of threads).
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::submit( size_t position, Callable task )
+{
+   if( getExecutionPolicy().executor() ) {
+      tasks().emplace_back( std::move( task ) );
+   }
+   else {
+      const PlacementPtr current( placement() );
+      const std::vector<size_t>& order( current->order );
+      threadpool_.scheduleOn( order[position % order.size()], Task<Callable>( std::move( task ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executing all collected tasks of the calling thread by means of the executor.
+//
+// \return void
+//
+// This function hands all tasks collected for the calling thread over to the executor of the
+// active execution policy and blocks until all tasks have been completed. Every task is executed
+// with the execution policy of the calling thread. In case the active execution policy does not
+// specify an executor, all collected tasks are executed by the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::execute()
+{
+   if( tasks().empty() )
+      return;
+
+   Tasks batch( std::move( tasks() ) );
+   tasks().clear();
+
+   const ExecutionPolicy policy( getExecutionPolicy() );
+
+   if( !policy.executor() ) {
+      for( auto& task : batch ) {
+         ParallelTask marker;
+         task();
+      }
+      return;
+   }
+
+   policy.executor()( batch.size(), [&batch,&policy]( size_t i )
+   {
+      ExecutionScope scope( policy );
+      ParallelTask marker;
+      batch[i]();
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the tasks collected for the executor of the calling thread.
+//
+// \return Reference to the collected tasks of the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Tasks& ThreadBackend<TT,MT,LT,CT>::tasks() noexcept
+{
+   thread_local Tasks tasks;
+   return tasks;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -313,7 +668,9 @@ inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source&
 //
 // This function determines the initial number of threads based on the \c BLAZE_NUM_THREADS
 // environment variable. In case the environment variable is not defined or not set, the
-// function returns 1. Otherwise it returns the specified number of threads.
+// function returns 1. Otherwise it returns the specified number of threads. Additionally, the
+// SMP thresholds for the initial number of threads are selected from the file specified via
+// the \c BLAZE_SMP_THRESHOLDS environment variable.
 */
 #if (defined _MSC_VER)
 #  pragma warning(push)
@@ -327,9 +684,58 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 {
    const char* env = std::getenv( "BLAZE_NUM_THREADS" );
 
+   const size_t n( ( env == nullptr ) ? 1UL : max( 1, atoi( env ) ) );
+   selectSMPThresholds( n );
+   return n;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial pinning of the threads of the thread pool.
+//
+// \return The logical CPUs the threads are pinned to.
+//
+// This function determines the logical CPUs the threads are pinned to based on the
+// \c BLAZE_AFFINITY environment variable (see the createAffinity() function). In case the
+// environment variable is not defined or specifies an invalid affinity, the threads are not
+// pinned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Pinning ThreadBackend<TT,MT,LT,CT>::initPinning()
+{
+   Pinning pinning;
+
+   const char* env = std::getenv( "BLAZE_AFFINITY" );
+
    if( env == nullptr )
-      return 1UL;
-   else return max( 1, atoi( env ) );
+      return pinning;
+
+   try {
+      const threadpool::Topology topology;
+      pinning.cpus = threadpool::createAffinity( env, topology );
+
+      for( size_t cpu : pinning.cpus ) {
+         pinning.domains.push_back( topology.find( cpu )->cache );
+      }
+   }
+   catch( const std::exception& ) {
+      return Pinning();
+   }
+
+   return pinning;
 }
 #if (defined _MSC_VER)
 #  pragma warning(pop)
@@ -338,6 +744,119 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the placement of the thread positions for the given number of threads.
+//
+// \param n The number of threads.
+// \return The placement of the thread positions.
+//
+// This function places the thread positions on the threads of the pool such that consecutive
+// positions are placed on threads sharing the last-level cache. In case the threads are not
+// pinned, the thread positions are placed on the threads in order.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Placement ThreadBackend<TT,MT,LT,CT>::initPlacement( size_t n )
+{
+   Placement placement{ std::vector<size_t>( n ), 1UL };
+   std::iota( placement.order.begin(), placement.order.end(), 0UL );
+
+   const std::vector<size_t>& domains( pinning().domains );
+
+   if( domains.empty() || n == 0UL )
+      return placement;
+
+   const auto domain = [&domains]( size_t thread ) {
+      return domains[thread % domains.size()];
+   };
+
+   std::stable_sort( placement.order.begin(), placement.order.end(),
+                     [&domain]( size_t a, size_t b ) { return domain( a ) < domain( b ); } );
+
+   // Determining the number of threads per cache domain
+   size_t group( n );
+
+   for( size_t first=0UL, last=0UL; first<n; first=last ) {
+      while( last < n && domain( placement.order[last] ) == domain( placement.order[first] ) ) {
+         ++last;
+      }
+      if( first == 0UL ) group = last;
+      else if( last - first != group ) return Placement{ placement.order, 1UL };
+   }
+
+   placement.group = group;
+
+   return placement;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the pinning of the threads of the thread pool.
+//
+// \return Reference to the pinning of the threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline const typename ThreadBackend<TT,MT,LT,CT>::Pinning& ThreadBackend<TT,MT,LT,CT>::pinning()
+{
+   static const Pinning pinning( initPinning() );
+   return pinning;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current placement of the thread positions.
+//
+// \return The current placement of the thread positions.
+//
+// The current placement is loaded atomically and is kept alive by the returned pointer, even
+// if a new placement is published by a concurrent call of the resize() function.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::PlacementPtr ThreadBackend<TT,MT,LT,CT>::placement()
+{
+   return std::atomic_load( &thePlacement() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage of the published placement of the thread positions.
+//
+// \return Reference to the published placement of the thread positions.
+//
+// The published placement must only be accessed via \c std::atomic_load() and
+// \c std::atomic_store() (see the placement() and resize() functions).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::PlacementPtr& ThreadBackend<TT,MT,LT,CT>::thePlacement()
+{
+   static PlacementPtr placement( std::make_shared<const Placement>( initPlacement( threadpool_.size() ) ) );
+   return placement;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
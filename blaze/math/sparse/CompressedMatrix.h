@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include <vector>
 #include <blaze/math/Aliases.h>
@@ -53,6 +54,9 @@
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
@@ -66,6 +70,7 @@
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/DynamicAllocator.h>
 #include <blaze/math/typetraits/HighType.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsIdentity.h>
@@ -83,21 +88,27 @@
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/LowType.h>
 #include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/math/typetraits/TemporaryType.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
 #include <blaze/util/constraints/SameSize.h>
+#include <blaze/util/constraints/SameType.h>
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/TemporaryAllocator.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
@@ -121,18 +132,21 @@ namespace blaze {
 //
 // The CompressedMatrix class template is the representation of an arbitrary sized sparse
 // matrix with \f$ M \cdot N \f$ dynamically allocated elements of arbitrary type. The type
-// of the elements and the storage order of the matrix can be specified via the two template
-// parameters:
+// of the elements and the storage order of the matrix as well as the allocator can be specified
+// via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename Alloc >
    class CompressedMatrix;
    \endcode
 
-//  - Type: specifies the type of the matrix elements. CompressedMatrix can be used with
-//          any non-cv-qualified, non-reference, non-pointer element type.
-//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
-//          The default value is blaze::rowMajor.
+//  - Type : specifies the type of the matrix elements. CompressedMatrix can be used with
+//           any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO   : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//           The default value is blaze::rowMajor.
+//  - Alloc: specifies the type of the allocator for the matrix elements. The allocator is
+//           rebound to the internal element and index types of the matrix. The default value
+//           is \a blaze::AlignedAllocator.
 //
 // Inserting/accessing elements in a compressed matrix can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -223,9 +237,10 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the matrix
-        , bool SO = defaultStorageOrder >  // Storage order
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename Alloc >                 // Type of the allocator
 class CompressedMatrix
-   : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
+   : public SparseMatrix< CompressedMatrix<Type,SO,Alloc>, SO >
 {
  private:
    //**Type definitions****************************************************************************
@@ -312,20 +327,29 @@ class CompressedMatrix
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Type definitions****************************************************************************
+   //! Type of the allocator for the non-zero elements.
+   using ElementAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Element>;
+
+   //! Type of the allocator for the row/column pointers.
+   using IteratorAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Element*>;
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
-   using This           = CompressedMatrix<Type,SO>;   //!< Type of this CompressedMatrix instance.
-   using BaseType       = SparseMatrix<This,SO>;       //!< Base type of this CompressedMatrix instance.
-   using ResultType     = This;                        //!< Result type for expression template evaluations.
-   using OppositeType   = CompressedMatrix<Type,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType  = CompressedMatrix<Type,!SO>;  //!< Transpose type for expression template evaluations.
-   using ElementType    = Type;                        //!< Type of the compressed matrix elements.
-   using ReturnType     = const Type&;                 //!< Return type for expression template evaluations.
-   using CompositeType  = const This&;                 //!< Data type for composite expression templates.
-   using Reference      = MatrixAccessProxy<This>;     //!< Reference to a compressed matrix value.
-   using ConstReference = const Type&;                 //!< Reference to a constant compressed matrix value.
-   using Iterator       = Element*;                    //!< Iterator over non-constant elements.
-   using ConstIterator  = const Element*;              //!< Iterator over constant elements.
+   using This           = CompressedMatrix<Type,SO,Alloc>;   //!< Type of this CompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;             //!< Base type of this CompressedMatrix instance.
+   using ResultType     = This;                              //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,!SO,Alloc>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,!SO,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                              //!< Type of the compressed matrix elements.
+   using ReturnType     = const Type&;                       //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                       //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;           //!< Reference to a compressed matrix value.
+   using ConstReference = const Type&;                       //!< Reference to a constant compressed matrix value.
+   using Iterator       = Element*;                          //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;                    //!< Iterator over constant elements.
+   using AllocatorType  = Alloc;                             //!< Type of the allocator of the matrix elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -333,7 +357,8 @@ class CompressedMatrix
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = CompressedMatrix<NewType,SO>;  //!< The type of the other CompressedMatrix.
+      using NewAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NewType>;  //!< Type of the rebound allocator.
+      using Other    = CompressedMatrix<NewType,SO,NewAlloc>;                                  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -343,7 +368,7 @@ class CompressedMatrix
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = CompressedMatrix<Type,SO>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<Type,SO,Alloc>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -359,8 +384,11 @@ class CompressedMatrix
    /*!\name Constructors */
    //@{
    explicit inline CompressedMatrix();
+   explicit inline CompressedMatrix( const Alloc& alloc );
    explicit inline CompressedMatrix( size_t m, size_t n );
+   explicit inline CompressedMatrix( size_t m, size_t n, const Alloc& alloc );
    explicit inline CompressedMatrix( size_t m, size_t n, size_t nonzeros );
+   explicit inline CompressedMatrix( size_t m, size_t n, size_t nonzeros, const Alloc& alloc );
    explicit        CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
             inline CompressedMatrix( initializer_list< initializer_list<Type> > list );
 
@@ -368,7 +396,9 @@ class CompressedMatrix
    inline CompressedMatrix( CompressedMatrix&& sm ) noexcept;
 
    template< typename MT, bool SO2 > inline CompressedMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompressedMatrix( const DenseMatrix<MT,SO2>&  dm, const Alloc& alloc );
    template< typename MT, bool SO2 > inline CompressedMatrix( const SparseMatrix<MT,SO2>& sm );
+   template< typename MT, bool SO2 > inline CompressedMatrix( const SparseMatrix<MT,SO2>& sm, const Alloc& alloc );
    //@}
    //**********************************************************************************************
 
@@ -408,6 +438,9 @@ class CompressedMatrix
    template< typename MT, bool SO2 > inline CompressedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
    template< typename MT, bool SO2 > inline CompressedMatrix& operator%=( const DenseMatrix<MT,SO2>&  rhs );
    template< typename MT, bool SO2 > inline CompressedMatrix& operator%=( const SparseMatrix<MT,SO2>& rhs );
+
+   template< typename MT > inline CompressedMatrix& assignValues( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT > inline CompressedMatrix& assignValues( const SparseMatrix<MT,!SO>& rhs );
    //@}
    //**********************************************************************************************
 
@@ -503,7 +536,8 @@ class CompressedMatrix
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit inline CompressedMatrix( size_t m, size_t n, Uninitialized );
+   explicit inline CompressedMatrix( size_t m, size_t n, Uninitialized,
+                                     const ElementAllocator& alloc = ElementAllocator() );
    //@}
    //**********************************************************************************************
 
@@ -528,11 +562,13 @@ class CompressedMatrix
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   size_t m_;         //!< The current number of rows of the compressed matrix.
-   size_t n_;         //!< The current number of columns of the compressed matrix.
-   size_t capacity_;  //!< The current capacity of the pointer array.
-   Iterator* begin_;  //!< Pointers to the first non-zero element of each row.
-   Iterator* end_;    //!< Pointers one past the last non-zero element of each row.
+   ElementAllocator alloc_;      //!< The allocator of the non-zero elements.
+   IteratorAllocator ptrAlloc_;  //!< The allocator of the row/column pointers.
+   size_t m_;                    //!< The current number of rows of the compressed matrix.
+   size_t n_;                    //!< The current number of columns of the compressed matrix.
+   size_t capacity_;             //!< The current capacity of the pointer array.
+   Iterator* begin_;             //!< Pointers to the first non-zero element of each row.
+   Iterator* end_;               //!< Pointers one past the last non-zero element of each row.
 
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
@@ -545,6 +581,7 @@ class CompressedMatrix
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
    BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE       ( ElementBase, Element );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE         ( Type, typename std::allocator_traits<Alloc>::value_type );
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -559,8 +596,8 @@ class CompressedMatrix
 //
 //=================================================================================================
 
-template< typename Type, bool SO >
-const Type CompressedMatrix<Type,SO>::zero_{};
+template< typename Type, bool SO, typename Alloc >
+const Type CompressedMatrix<Type,SO,Alloc>::zero_{};
 
 
 
@@ -574,10 +611,33 @@ const Type CompressedMatrix<Type,SO>::zero_{};
 //*************************************************************************************************
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix()
-   : m_       ( 0UL )      // The current number of rows of the compressed matrix
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix()
+   : alloc_   ()           // The allocator of the non-zero elements
+   , ptrAlloc_()           // The allocator of the row/column pointers
+   , m_       ( 0UL )      // The current number of rows of the compressed matrix
+   , n_       ( 0UL )      // The current number of columns of the compressed matrix
+   , capacity_( 0UL )      // The current capacity of the pointer array
+   , begin_   ( nullptr )  // Pointers to the first non-zero element of each row
+   , end_     ( nullptr )  // Pointers one past the last non-zero element of each row
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix with the given allocator.
+//
+// \param alloc The allocator of the non-zero elements.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( const Alloc& alloc )
+   : alloc_   ( alloc )    // The allocator of the non-zero elements
+   , ptrAlloc_( alloc )    // The allocator of the row/column pointers
+   , m_       ( 0UL )      // The current number of rows of the compressed matrix
    , n_       ( 0UL )      // The current number of columns of the compressed matrix
    , capacity_( 0UL )      // The current capacity of the pointer array
    , begin_   ( nullptr )  // Pointers to the first non-zero element of each row
@@ -594,10 +654,29 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
-   : CompressedMatrix( m, n, Uninitialized() )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( size_t m, size_t n )
+   : CompressedMatrix( m, n, Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param alloc The allocator of the non-zero elements.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( size_t m, size_t n, const Alloc& alloc )
+   : CompressedMatrix( m, n, Uninitialized(), ElementAllocator( alloc ) )
 {
    for( size_t i=1UL; i<2UL*m_+2UL; ++i )
       begin_[i] = nullptr;
@@ -614,12 +693,32 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : CompressedMatrix( m, n, Uninitialized() )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : CompressedMatrix( m, n, nonzeros, Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \param alloc The allocator of the non-zero elements.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( size_t m, size_t n, size_t nonzeros, const Alloc& alloc )
+   : CompressedMatrix( m, n, Uninitialized(), ElementAllocator( alloc ) )
 {
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate( alloc_, nonzeros );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
       begin_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
@@ -638,9 +737,10 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 // row/column. Note that in case of a row-major matrix the given vector must have at least
 // \a m elements, in case of a column-major matrix at least \a n elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
@@ -649,7 +749,7 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
    for( auto it=nonzeros.begin(); it!=nonzeros.end(); ++it )
       newCapacity += *it;
 
-   begin_[0UL] = end_[0UL] = allocate<Element>( newCapacity );
+   begin_[0UL] = end_[0UL] = allocate( alloc_, newCapacity );
    for( size_t i=0UL; i<m_; ++i ) {
       begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
    }
@@ -677,9 +777,10 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 // initialized by the values of the given initializer list. Missing values are considered to
 // be default values.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
    : CompressedMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
 {
    size_t i( 0UL );
@@ -705,15 +806,20 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( initializer_list< initialize
 /*!\brief The copy constructor for CompressedMatrix.
 //
 // \param sm Sparse matrix to be copied.
+//
+// The allocator of the new matrix is obtained via the \c select_on_container_copy_construction()
+// function of the allocator of the given matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
-   : CompressedMatrix( sm.m_, sm.n_, Uninitialized() )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( const CompressedMatrix& sm )
+   : CompressedMatrix( sm.m_, sm.n_, Uninitialized()
+                     , std::allocator_traits<ElementAllocator>::select_on_container_copy_construction( sm.alloc_ ) )
 {
    const size_t nonzeros( sm.nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate( alloc_, nonzeros );
    for( size_t i=0UL; i<m_; ++i ) {
       end_[i] = castDown( std::copy( sm.begin(i), sm.end(i), castUp( begin_[i] ) ) );
       begin_[i+1UL] = end_[i];
@@ -727,15 +833,20 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
 /*!\brief The move constructor for CompressedMatrix.
 //
 // \param sm The compressed matrix to be moved into this instance.
+//
+// The allocator of the given matrix is moved along with the matrix elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
-   : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
-   , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
-   , capacity_( sm.capacity_ )  // The current capacity of the pointer array
-   , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each row
-   , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each row
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
+   : alloc_   ( std::move( sm.alloc_ ) )     // The allocator of the non-zero elements
+   , ptrAlloc_( std::move( sm.ptrAlloc_ ) )  // The allocator of the row/column pointers
+   , m_       ( sm.m_ )                      // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )                      // The current number of columns of the compressed matrix
+   , capacity_( sm.capacity_ )               // The current capacity of the pointer array
+   , begin_   ( sm.begin_ )                  // Pointers to the first non-zero element of each row
+   , end_     ( sm.end_ )                    // Pointers one past the last non-zero element of each row
 {
    sm.m_        = 0UL;
    sm.n_        = 0UL;
@@ -751,13 +862,33 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noex
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the foreign dense matrix
-        , bool SO2 >     // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
-   : CompressedMatrix( (~dm).rows(), (~dm).columns() )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign dense matrix
+        , bool SO2 >        // Storage order of the foreign dense matrix
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+   : CompressedMatrix( dm, Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices with the given allocator.
+//
+// \param dm Dense matrix to be copied.
+// \param alloc The allocator of the non-zero elements.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign dense matrix
+        , bool SO2 >        // Storage order of the foreign dense matrix
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm, const Alloc& alloc )
+   : CompressedMatrix( (~dm).rows(), (~dm).columns(), alloc )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    assign( *this, ~dm );
@@ -770,13 +901,33 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the foreign compressed matrix
-        , bool SO2 >     // Storage order of the foreign compressed matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
-   : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign compressed matrix
+        , bool SO2 >        // Storage order of the foreign compressed matrix
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+   : CompressedMatrix( sm, Alloc() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices with the given allocator.
+//
+// \param sm Sparse matrix to be copied.
+// \param alloc The allocator of the non-zero elements.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign compressed matrix
+        , bool SO2 >        // Storage order of the foreign compressed matrix
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm, const Alloc& alloc )
+   : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros(), alloc )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    assign( *this, ~sm );
@@ -789,15 +940,20 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator for the non-zero elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, Uninitialized )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::CompressedMatrix( size_t m, size_t n, Uninitialized,
+                                                          const ElementAllocator& alloc )
+   : alloc_   ( alloc )                             // The allocator of the non-zero elements
+   , ptrAlloc_( alloc )                             // The allocator of the row/column pointers
+   , m_       ( m )                                 // The current number of rows of the compressed matrix
+   , n_       ( n )                                 // The current number of columns of the compressed matrix
+   , capacity_( m )                                 // The current capacity of the pointer array
+   , begin_   ( allocate( ptrAlloc_, 2UL*m+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m+1UL) )                    // Pointers one past the last non-zero element of each row
 {
    begin_[0] = nullptr;
 }
@@ -815,13 +971,14 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, Uninitia
 //*************************************************************************************************
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::~CompressedMatrix()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>::~CompressedMatrix()
 {
    if( begin_ != nullptr ) {
-      deallocate( begin_[0UL] );
-      delete[] begin_;
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
    }
 }
 //*************************************************************************************************
@@ -848,13 +1005,16 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 // case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
 // check of the given access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Reference
+   CompressedMatrix<Type,SO,Alloc>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    return Reference( *this, i, j );
 }
@@ -871,13 +1031,15 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstReference
+   CompressedMatrix<Type,SO,Alloc>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
 
    const ConstIterator pos( lowerBound( i, j ) );
 
@@ -902,10 +1064,11 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // inserted into the compressed matrix. In contrast to the function call operator this function
 // always performs a check of the given access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::at( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Reference
+   CompressedMatrix<Type,SO,Alloc>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -929,10 +1092,11 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // In contrast to the function call operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::at( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstReference
+   CompressedMatrix<Type,SO,Alloc>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -956,10 +1120,11 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator to the first non-zero element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::begin( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -978,10 +1143,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator to the first non-zero element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstIterator
+   CompressedMatrix<Type,SO,Alloc>::begin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -1000,10 +1166,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator to the first non-zero element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstIterator
+   CompressedMatrix<Type,SO,Alloc>::cbegin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -1022,10 +1189,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::end( size_t i ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::end( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1044,10 +1212,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::end( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstIterator
+   CompressedMatrix<Type,SO,Alloc>::end( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1066,10 +1235,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cend( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstIterator
+   CompressedMatrix<Type,SO,Alloc>::cend( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1106,10 +1276,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // assigned the values from the given initializer list. Missing values are considered to
 // be default values.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::operator=( initializer_list< initializer_list<Type> > list )
 {
    using blaze::nonZeros;
 
@@ -1146,37 +1317,36 @@ inline CompressedMatrix<Type,SO>&
 // The compressed matrix is resized according to the given compressed matrix and initialized
 // as a copy of this matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const CompressedMatrix& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::operator=( const CompressedMatrix& rhs )
 {
-   using std::swap;
-
    if( &rhs == this ) return *this;
 
    const size_t nonzeros( rhs.nonZeros() );
 
    if( rhs.m_ > capacity_ || nonzeros > capacity() )
    {
-      Iterator* newBegin( new Iterator[2UL*rhs.m_+2UL] );
+      Iterator* newBegin( allocate( ptrAlloc_, 2UL*rhs.m_+2UL ) );
       Iterator* newEnd  ( newBegin+(rhs.m_+1UL) );
 
-      newBegin[0UL] = allocate<Element>( nonzeros );
+      newBegin[0UL] = allocate( alloc_, nonzeros );
       for( size_t i=0UL; i<rhs.m_; ++i ) {
          newEnd[i] = castDown( std::copy( rhs.begin_[i], rhs.end_[i], castUp( newBegin[i] ) ) );
          newBegin[i+1UL] = newEnd[i];
       }
       newEnd[rhs.m_] = newBegin[0UL]+nonzeros;
 
-      swap( begin_, newBegin );
+      if( begin_ != nullptr ) {
+         deallocate( alloc_, begin_[0UL], capacity() );
+         deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
+      }
+
+      begin_ = newBegin;
       end_ = newEnd;
       capacity_ = rhs.m_;
-
-      if( newBegin != nullptr ) {
-         deallocate( newBegin[0UL] );
-         delete[] newBegin;
-      }
    }
    else {
       for( size_t i=0UL; i<rhs.m_; ++i ) {
@@ -1198,17 +1368,22 @@ inline CompressedMatrix<Type,SO>&
 //
 // \param rhs The compressed matrix to be moved into this instance.
 // \return Reference to the assigned compressed matrix.
+//
+// The allocator of the given matrix is moved along with the matrix elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( CompressedMatrix&& rhs ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::operator=( CompressedMatrix&& rhs ) noexcept
 {
    if( begin_ != nullptr ) {
-      deallocate( begin_[0UL] );
-      delete[] begin_;
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
    }
 
+   alloc_    = std::move( rhs.alloc_ );
+   ptrAlloc_ = std::move( rhs.ptrAlloc_ );
    m_        = rhs.m_;
    n_        = rhs.n_;
    capacity_ = rhs.capacity_;
@@ -1235,17 +1410,18 @@ inline CompressedMatrix<Type,SO>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side dense matrix
-        , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
    if( (~rhs).canAlias( this ) ) {
-      CompressedMatrix tmp( ~rhs );
+      CompressedMatrix tmp( ~rhs, Alloc( alloc_ ) );
       swap( tmp );
    }
    else {
@@ -1267,19 +1443,20 @@ inline CompressedMatrix<Type,SO>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side compressed matrix
-        , bool SO2 >     // Storage order of the right-hand side compressed matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side compressed matrix
+        , bool SO2 >        // Storage order of the right-hand side compressed matrix
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
-      CompressedMatrix tmp( ~rhs );
+      CompressedMatrix tmp( ~rhs, Alloc( alloc_ ) );
       swap( tmp );
    }
    else {
@@ -1306,12 +1483,13 @@ inline CompressedMatrix<Type,SO>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::operator+=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::addAssign;
 
@@ -1338,11 +1516,12 @@ inline CompressedMatrix<Type,SO>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline CompressedMatrix<Type,SO,Alloc>& CompressedMatrix<Type,SO,Alloc>::operator-=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::subAssign;
 
@@ -1370,12 +1549,13 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const M
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side dense matrix
-        , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator%=( const DenseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::operator%=( const DenseMatrix<MT,SO2>& rhs )
 {
    using blaze::schurAssign;
 
@@ -1384,7 +1564,7 @@ inline CompressedMatrix<Type,SO>&
    }
 
    if( (~rhs).canAlias( this ) ) {
-      CompressedMatrix tmp( *this % (~rhs) );
+      CompressedMatrix tmp( *this % (~rhs), Alloc( alloc_ ) );
       swap( tmp );
    }
    else {
@@ -1408,19 +1588,20 @@ inline CompressedMatrix<Type,SO>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side sparse matrix
-        , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator%=( const SparseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::operator%=( const SparseMatrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
    if( !IsZero_v<MT> ) {
-      CompressedMatrix tmp( *this % (~rhs) );
+      CompressedMatrix tmp( *this % (~rhs), Alloc( alloc_ ) );
       swap( tmp );
    }
    else {
@@ -1432,6 +1613,175 @@ inline CompressedMatrix<Type,SO>&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pattern-preserving assignment of the values of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix providing the new values.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Sparsity pattern does not match.
+//
+// This function overwrites the values of all non-zero elements of the compressed matrix with
+// the values of the corresponding elements of the given sparse matrix. In contrast to the
+// assignment operator the sparsity pattern of the compressed matrix (i.e. the indices of all
+// non-zero elements and the capacity of all rows) remains unchanged: Elements of the sparsity
+// pattern without counterpart in the given matrix are reset to their default value and no
+// element is inserted or erased. Since only the values are written, this is considerably more
+// efficient than the assignment operator in case the sparsity pattern stays the same, as for
+// instance for coefficient matrices that are updated in every time step:
+
+   \code
+   blaze::CompressedMatrix<double> A, M, K;
+   // ... Resizing and initialization of M and K; A is initialized with the joint pattern of M and K
+
+   A.assignValues( M + dt*K );
+   \endcode
+
+// In case the sizes of the two matrices don't match or in case the given matrix contains a
+// non-default element outside the sparsity pattern of the compressed matrix, a
+// \a std::invalid_argument exception is thrown. In both cases the compressed matrix remains
+// unchanged. In case a shared-memory parallelization is active and the number of non-zero
+// elements is larger or equal to the BLAZE_SMP_SMATASSIGN_THRESHOLD, the rows of the matrix are
+// updated in parallel.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::assignValues( const SparseMatrix<MT,SO>& rhs )
+{
+   using CT = CompositeType_t<MT>;
+
+   waitForAsyncAssignments( *this, ~rhs );
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( m_ == 0UL ) return *this;
+
+   CT tmp( ~rhs );  // Evaluation of the right-hand side sparse matrix
+
+   // Merging the non-zero elements of the given matrix into the sparsity pattern of row i
+   const auto merge = [&]( size_t i, auto store ) -> bool
+   {
+      Iterator pos( begin_[i] );
+
+      for( auto element=tmp.begin(i); element!=tmp.end(i); ++element )
+      {
+         for( ; pos!=end_[i] && pos->index() < element->index(); ++pos ) {
+            store( pos, Type() );
+         }
+
+         if( pos == end_[i] || pos->index() != element->index() ) {
+            if( isDefault( element->value() ) ) continue;
+            return false;
+         }
+
+         store( pos, element->value() );
+         ++pos;
+      }
+
+      for( ; pos!=end_[i]; ++pos ) {
+         store( pos, Type() );
+      }
+
+      return true;
+   };
+
+   const size_t nonzeros( nonZeros() );
+   const size_t chunks( ( nonzeros >= smpThreshold( SMP_SMATASSIGN ) && canSMPFor() )
+                        ?( min( getNumThreads(), m_ ) )
+                        :( 1UL ) );
+
+   // Splitting the rows into chunks of roughly the same number of non-zero elements
+   const Iterator first( begin_[0UL] );
+   const size_t total( end_[m_-1UL] - first );
+
+   const auto bound = [&]( size_t k ) -> size_t
+   {
+      if( k == chunks ) return m_;
+      return std::lower_bound( begin_, begin_+m_, first+(k*total)/chunks ) - begin_;
+   };
+
+   // Merging all rows, in parallel in case the number of non-zero elements is large enough
+   const auto mergeAll = [&]( auto store ) -> bool
+   {
+      std::unique_ptr<bool[]> valid( new bool[chunks] );
+
+      smpFor( chunks, [&]( size_t k ) {
+         const size_t end( bound(k+1UL) );
+
+         valid[k] = true;
+         for( size_t i=bound(k); i<end && valid[k]; ++i ) {
+            valid[k] = merge( i, store );
+         }
+      } );
+
+      return std::all_of( valid.get(), valid.get()+chunks, []( bool v ){ return v; } );
+   };
+
+   if( !tmp.canAlias( this ) )
+   {
+      // Checking the sparsity pattern before writing any value to leave the matrix unchanged
+      if( !mergeAll( []( Iterator, const auto& ){} ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Sparsity pattern does not match" );
+      }
+
+      mergeAll( []( Iterator pos, const auto& value ){ pos->value() = value; } );
+   }
+   else
+   {
+      // Gathering the new values first in case the given matrix refers to this matrix
+      std::vector<Type> values( capacity() );
+
+      if( !mergeAll( [&]( Iterator pos, const auto& value ){ values[pos-first] = value; } ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Sparsity pattern does not match" );
+      }
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( Iterator pos=begin_[i]; pos!=end_[i]; ++pos ) {
+            pos->value() = values[pos-first];
+         }
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pattern-preserving assignment of the values of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix providing the new values.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Sparsity pattern does not match.
+//
+// This function overwrites the values of all non-zero elements of the compressed matrix with
+// the values of the corresponding elements of the given column-major sparse matrix. The given
+// matrix is first converted into a row-major matrix. For details see the assignValues()
+// function for row-major sparse matrices.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline CompressedMatrix<Type,SO,Alloc>&
+   CompressedMatrix<Type,SO,Alloc>::assignValues( const SparseMatrix<MT,!SO>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const CompressedMatrix tmp( ~rhs );
+   return assignValues( tmp );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1445,9 +1795,10 @@ inline CompressedMatrix<Type,SO>&
 //
 // \return The number of rows of the compressed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::rows() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,Alloc>::rows() const noexcept
 {
    return m_;
 }
@@ -1459,9 +1810,10 @@ inline size_t CompressedMatrix<Type,SO>::rows() const noexcept
 //
 // \return The number of columns of the compressed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::columns() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,Alloc>::columns() const noexcept
 {
    return n_;
 }
@@ -1473,9 +1825,10 @@ inline size_t CompressedMatrix<Type,SO>::columns() const noexcept
 //
 // \return The capacity of the compressed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,Alloc>::capacity() const noexcept
 {
    if( begin_ != nullptr )
       return end_[m_] - begin_[0UL];
@@ -1495,9 +1848,10 @@ inline size_t CompressedMatrix<Type,SO>::capacity() const noexcept
 // in case the storage flag is set to \a columnMajor the function returns the capacity
 // of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,Alloc>::capacity( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return begin_[i+1UL] - begin_[i];
@@ -1510,9 +1864,10 @@ inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
 //
 // \return The number of non-zero elements in the compressed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros() const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1535,9 +1890,10 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros() const
 // elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
 // the number of non-zero elements in column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,Alloc>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return end_[i] - begin_[i];
@@ -1550,9 +1906,10 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
 //
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::reset()
 {
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
@@ -1571,9 +1928,10 @@ inline void CompressedMatrix<Type,SO>::reset()
 // the storage order is set to \a columnMajor the function resets the values in column \a i.
 // Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset( size_t i )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    end_[i] = begin_[i];
@@ -1588,9 +1946,10 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 //
 // After the clear() function, the size of the compressed matrix is 0.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::clear()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::clear()
 {
    if( end_ != nullptr )
       end_[0UL] = end_[m_];
@@ -1615,20 +1974,22 @@ inline void CompressedMatrix<Type,SO>::clear()
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void CompressedMatrix<Type,SO,Alloc>::resize( size_t m, size_t n, bool preserve )
 {
-   using std::swap;
-
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
    if( m == m_ && n == n_ ) return;
 
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
    if( begin_ == nullptr )
    {
-      begin_ = new Iterator[2UL*m+2UL];
+      begin_ = allocate( ptrAlloc_, 2UL*m+2UL );
       end_   = begin_+m+1UL;
 
       for( size_t i=0UL; i<2UL*m+2UL; ++i ) {
@@ -1639,7 +2000,7 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    }
    else if( m > capacity_ )
    {
-      Iterator* newBegin( new Iterator[2UL*m+2UL] );
+      Iterator* newBegin( allocate( ptrAlloc_, 2UL*m+2UL ) );
       Iterator* newEnd  ( newBegin+m+1UL );
 
       newBegin[0UL] = begin_[0UL];
@@ -1661,8 +2022,8 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
       newEnd[m] = end_[m_];
 
-      swap( newBegin, begin_ );
-      delete[] newBegin;
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
+      begin_ = newBegin;
       end_ = newEnd;
       capacity_ = m;
    }
@@ -1712,9 +2073,10 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -1736,12 +2098,11 @@ inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 // In case the storage order is set to \a columnMajor, the function reserves capacity for column
 // \a i and the index has to be in the range \f$[0..N-1]\f$.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void CompressedMatrix<Type,SO,Alloc>::reserve( size_t i, size_t nonzeros )
 {
-   using std::swap;
-
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
@@ -1758,10 +2119,10 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
       const size_t newCapacity( begin_[m_] - begin_[0UL] + additional );
       BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
 
-      Iterator* newBegin( new Iterator[2UL*m_+2UL] );
+      Iterator* newBegin( allocate( ptrAlloc_, 2UL*m_+2UL ) );
       Iterator* newEnd  ( newBegin+m_+1UL );
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate( alloc_, newCapacity );
       newEnd  [m_ ] = newBegin[0UL]+newCapacity;
 
       for( size_t k=0UL; k<i; ++k ) {
@@ -1777,9 +2138,9 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 
       BLAZE_INTERNAL_ASSERT( newBegin[m_] == newEnd[m_], "Invalid pointer calculations" );
 
-      swap( newBegin, begin_ );
-      deallocate( newBegin[0UL] );
-      delete[] newBegin;
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
+      begin_ = newBegin;
       end_ = newEnd;
       capacity_ = m_;
    }
@@ -1808,9 +2169,10 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 // matrix) or columns (in case of a columnMajor matrix). Note that this function does not
 // remove the overall capacity but only reduces the capacity per row/column.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::trim()
 {
    for( size_t i=0UL; i<m_; ++i )
       trim( i );
@@ -1829,9 +2191,10 @@ inline void CompressedMatrix<Type,SO>::trim()
 // or column (in case of a columnMajor matrix). The excessive capacity is assigned to the
 // subsequent row/column.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim( size_t i )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1851,9 +2214,10 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 // that in case a reallocation occurs, all iterators (including end() iterators), all pointers
 // and references to elements of this matrix are invalidated.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::shrinkToFit()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::shrinkToFit()
 {
    if( nonZeros() < capacity() ) {
       CompressedMatrix( *this ).swap( *this );
@@ -1867,13 +2231,18 @@ inline void CompressedMatrix<Type,SO>::shrinkToFit()
 //
 // \param sm The compressed matrix to be swapped.
 // \return void
+//
+// The allocators of the two matrices are swapped along with the matrix elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::swap( CompressedMatrix& sm ) noexcept
 {
    using std::swap;
 
+   swap( alloc_, sm.alloc_ );
+   swap( ptrAlloc_, sm.ptrAlloc_ );
    swap( m_, sm.m_ );
    swap( n_, sm.n_ );
    swap( capacity_, sm.capacity_ );
@@ -1891,9 +2260,10 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::extendCapacity() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,Alloc>::extendCapacity() const noexcept
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL   );
@@ -1911,16 +2281,15 @@ inline size_t CompressedMatrix<Type,SO>::extendCapacity() const noexcept
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void CompressedMatrix<Type,SO,Alloc>::reserveElements( size_t nonzeros )
 {
-   using std::swap;
-
-   Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+   Iterator* newBegin = allocate( ptrAlloc_, 2UL*capacity_+2UL );
    Iterator* newEnd   = newBegin+capacity_+1UL;
 
-   newBegin[0UL] = allocate<Element>( nonzeros );
+   newBegin[0UL] = allocate( alloc_, nonzeros );
 
    for( size_t k=0UL; k<m_; ++k ) {
       BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row pointers" );
@@ -1930,13 +2299,13 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 
    newEnd[m_] = newBegin[0UL]+nonzeros;
 
-   swap( newBegin, begin_ );
-   end_ = newEnd;
-
-   if( newBegin != nullptr ) {
-      deallocate( newBegin[0UL] );
-      delete[] newBegin;
+   if( begin_ != nullptr ) {
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
    }
+
+   begin_ = newBegin;
+   end_ = newEnd;
 }
 //*************************************************************************************************
 
@@ -1949,10 +2318,11 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 // This function performs a down-cast of the given iterator to base elements to an iterator to
 // derived elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::castDown( IteratorBase it ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::castDown( IteratorBase it ) const noexcept
 {
    return static_cast<Iterator>( it );
 }
@@ -1967,10 +2337,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // This function performs an up-cast of the given iterator to derived elements to an iterator
 // to base elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::IteratorBase
-   CompressedMatrix<Type,SO>::castUp( Iterator it ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::IteratorBase
+   CompressedMatrix<Type,SO,Alloc>::castUp( Iterator it ) const noexcept
 {
    return static_cast<IteratorBase>( it );
 }
@@ -1997,13 +2368,16 @@ inline typename CompressedMatrix<Type,SO>::IteratorBase
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( lowerBound( i, j ) );
 
@@ -2029,13 +2403,16 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( lowerBound( i, j ) );
 
@@ -2058,13 +2435,12 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
-   using std::swap;
-
    if( begin_[i+1UL] - end_[i] != 0 ) {
       std::move_backward( pos, end_[i], castUp( end_[i]+1UL ) );
       pos->value_ = value;
@@ -2089,10 +2465,10 @@ typename CompressedMatrix<Type,SO>::Iterator
    else {
       size_t newCapacity( extendCapacity() );
 
-      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+      Iterator* newBegin = allocate( ptrAlloc_, 2UL*capacity_+2UL );
       Iterator* newEnd   = newBegin+capacity_+1UL;
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate( alloc_, newCapacity );
 
       for( size_t k=0UL; k<i; ++k ) {
          const size_t nonzeros( end_[k] - begin_[k] );
@@ -2116,10 +2492,10 @@ typename CompressedMatrix<Type,SO>::Iterator
       tmp->index_ = j;
       std::move( pos, end_[m_-1UL], castUp( tmp+1UL ) );
 
-      swap( newBegin, begin_ );
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
+      begin_ = newBegin;
       end_ = newEnd;
-      deallocate( newBegin[0UL] );
-      delete[] newBegin;
 
       return tmp;
    }
@@ -2180,9 +2556,10 @@ typename CompressedMatrix<Type,SO>::Iterator
 // \note Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -2212,9 +2589,10 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
 // \note Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::finalize( size_t i )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
@@ -2242,12 +2620,15 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 //
 // This function erases an element from the compressed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,Alloc>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( find( i, j ) );
    if( pos != end_[i] )
@@ -2267,10 +2648,11 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
 // to \a rowMajor the function erases an element from row \a i, in case the storage flag is set
 // to \a columnMajor the function erases an element from column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator pos )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::erase( size_t i, Iterator pos )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
@@ -2295,10 +2677,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // is set to \a rowMajor the function erases a range of elements from row \a i, in case the storage
 // flag is set to \a columnMajor the function erases a range of elements from column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::erase( size_t i, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -2334,10 +2717,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \note The predicate is required to be pure, i.e. to produce deterministic results for elements
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
-template< typename Type    // Data type of the matrix
-        , bool SO >        // Storage order
-template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,SO>::erase( Pred predicate )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Pred >   // Type of the unary predicate
+inline void CompressedMatrix<Type,SO,Alloc>::erase( Pred predicate )
 {
    for( size_t i=0UL; i<m_; ++i ) {
       end_[i] = castDown( std::remove_if( castUp( begin_[i] ), castUp( end_[i] ),
@@ -2376,10 +2760,11 @@ inline void CompressedMatrix<Type,SO>::erase( Pred predicate )
 // \note The predicate is required to be pure, i.e. to produce deterministic results for elements
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
-template< typename Type    // Data type of the matrix
-        , bool SO >        // Storage order
-template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Pred >   // Type of the unary predicate
+inline void CompressedMatrix<Type,SO,Alloc>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -2419,10 +2804,11 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator
 // to invalidation due to inserting operations via the function call operator, the set()
 // function or the insert() function!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -2444,10 +2830,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // to invalidation due to inserting operations via the function call operator, the set()
 // function or the insert() function!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstIterator
+   CompressedMatrix<Type,SO,Alloc>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[i] && pos->index_ == j )
@@ -2472,10 +2859,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // iterator is subject to invalidation due to inserting operations via the function call operator,
 // the set() function or the insert() function!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -2497,10 +2885,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // iterator is subject to invalidation due to inserting operations via the function call operator,
 // the set() function or the insert() function!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstIterator
+   CompressedMatrix<Type,SO,Alloc>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::lower_bound( begin_[i], end_[i], j,
@@ -2527,10 +2916,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // iterator is subject to invalidation due to inserting operations via the function call operator,
 // the set() function or or the insert() function!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::Iterator
+   CompressedMatrix<Type,SO,Alloc>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -2552,10 +2942,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // iterator is subject to invalidation due to inserting operations via the function call operator,
 // the set() function or the insert() function!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,Alloc>::ConstIterator
+   CompressedMatrix<Type,SO,Alloc>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::upper_bound( begin_[i], end_[i], j,
@@ -2580,11 +2971,14 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>& CompressedMatrix<Type,SO,Alloc>::transpose()
 {
-   CompressedMatrix tmp( trans( *this ) );
+   waitForAsyncAssignments( *this, *this );
+
+   CompressedMatrix tmp( trans( *this ), Alloc( alloc_ ) );
    swap( tmp );
    return *this;
 }
@@ -2596,11 +2990,14 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::ctranspose()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,SO,Alloc>& CompressedMatrix<Type,SO,Alloc>::ctranspose()
 {
-   CompressedMatrix tmp( ctrans( *this ) );
+   waitForAsyncAssignments( *this, *this );
+
+   CompressedMatrix tmp( ctrans( *this ), Alloc( alloc_ ) );
    swap( tmp );
    return *this;
 }
@@ -2625,9 +3022,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::ctranspose()
    \endcode
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other& scalar )
+inline CompressedMatrix<Type,SO,Alloc>& CompressedMatrix<Type,SO,Alloc>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( auto element=begin_[i]; element!=end_[i]; ++element )
@@ -2657,9 +3055,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other&
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,SO,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2677,9 +3076,10 @@ inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noex
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,SO,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2696,9 +3096,10 @@ inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noe
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool CompressedMatrix<Type,SO>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool CompressedMatrix<Type,SO,Alloc>::canSMPAssign() const noexcept
 {
    return false;
 }
@@ -2716,11 +3117,12 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const noexcept
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side dense matrix
-        , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,SO,Alloc>::assign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2778,10 +3180,11 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,SO,Alloc>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2810,10 +3213,11 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,SO,Alloc>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2854,16 +3258,17 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side dense matrix
-        , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,SO,Alloc>::addAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   CompressedMatrix tmp( serial( *this + (~rhs) ), Alloc( alloc_ ) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -2880,16 +3285,17 @@ inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side compressed matrix
-        , bool SO2 >     // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side compressed matrix
+        , bool SO2 >        // Storage order of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,SO,Alloc>::addAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   CompressedMatrix tmp( serial( *this + (~rhs) ), Alloc( alloc_ ) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -2906,16 +3312,17 @@ inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side dense matrix
-        , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,SO,Alloc>::subAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this - (~rhs) ) );
+   CompressedMatrix tmp( serial( *this - (~rhs) ), Alloc( alloc_ ) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -2932,16 +3339,17 @@ inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side compressed matrix
-        , bool SO2 >     // Storage order of the right-hand compressed matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side compressed matrix
+        , bool SO2 >        // Storage order of the right-hand compressed matrix
+inline void CompressedMatrix<Type,SO,Alloc>::subAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this - (~rhs) ) );
+   CompressedMatrix tmp( serial( *this - (~rhs) ), Alloc( alloc_ ) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -2958,11 +3366,12 @@ inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side dense matrix
-        , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,SO,Alloc>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2998,9 +3407,10 @@ inline void CompressedMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& r
 // This specialization of CompressedMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the matrix
-class CompressedMatrix<Type,true>
-   : public SparseMatrix< CompressedMatrix<Type,true>, true >
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+class CompressedMatrix<Type,true,Alloc>
+   : public SparseMatrix< CompressedMatrix<Type,true,Alloc>, true >
 {
  private:
    //**Type definitions****************************************************************************
@@ -3083,20 +3493,29 @@ class CompressedMatrix<Type,true>
    struct Uninitialized {};
    //**********************************************************************************************
 
+   //**Type definitions****************************************************************************
+   //! Type of the allocator for the non-zero elements.
+   using ElementAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Element>;
+
+   //! Type of the allocator for the row/column pointers.
+   using IteratorAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Element*>;
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
-   using This           = CompressedMatrix<Type,true>;   //!< Type of this CompressedMatrix instance.
-   using BaseType       = SparseMatrix<This,true>;       //!< Base type of this CompressedMatrix instance.
-   using ResultType     = This;                          //!< Result type for expression template evaluations.
-   using OppositeType   = CompressedMatrix<Type,false>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType  = CompressedMatrix<Type,false>;  //!< Transpose type for expression template evaluations.
-   using ElementType    = Type;                          //!< Type of the compressed matrix elements.
-   using ReturnType     = const Type&;                   //!< Return type for expression template evaluations.
-   using CompositeType  = const This&;                   //!< Data type for composite expression templates.
-   using Reference      = MatrixAccessProxy<This>;       //!< Reference to a non-constant matrix value.
-   using ConstReference = const Type&;                   //!< Reference to a constant matrix value.
-   using Iterator       = Element*;                      //!< Iterator over non-constant elements.
-   using ConstIterator  = const Element*;                //!< Iterator over constant elements.
+   using This           = CompressedMatrix<Type,true,Alloc>;   //!< Type of this CompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,true>;             //!< Base type of this CompressedMatrix instance.
+   using ResultType     = This;                                //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,false,Alloc>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,false,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                //!< Type of the compressed matrix elements.
+   using ReturnType     = const Type&;                         //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                         //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;             //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;                         //!< Reference to a constant matrix value.
+   using Iterator       = Element*;                            //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;                      //!< Iterator over constant elements.
+   using AllocatorType  = Alloc;                               //!< Type of the allocator of the matrix elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -3104,7 +3523,8 @@ class CompressedMatrix<Type,true>
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = CompressedMatrix<NewType,true>;  //!< The type of the other CompressedMatrix.
+      using NewAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NewType>;  //!< Type of the rebound allocator.
+      using Other    = CompressedMatrix<NewType,true,NewAlloc>;                                  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -3114,7 +3534,7 @@ class CompressedMatrix<Type,true>
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = CompressedMatrix<Type,true>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<Type,true,Alloc>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -3130,8 +3550,11 @@ class CompressedMatrix<Type,true>
    /*!\name Constructors */
    //@{
    explicit inline CompressedMatrix();
+   explicit inline CompressedMatrix( const Alloc& alloc );
    explicit inline CompressedMatrix( size_t m, size_t n );
+   explicit inline CompressedMatrix( size_t m, size_t n, const Alloc& alloc );
    explicit inline CompressedMatrix( size_t m, size_t n, size_t nonzeros );
+   explicit inline CompressedMatrix( size_t m, size_t n, size_t nonzeros, const Alloc& alloc );
    explicit        CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
             inline CompressedMatrix( initializer_list< initializer_list<Type> > list );
 
@@ -3139,7 +3562,9 @@ class CompressedMatrix<Type,true>
    inline CompressedMatrix( CompressedMatrix&& sm ) noexcept;
 
    template< typename MT, bool SO > inline CompressedMatrix( const DenseMatrix<MT,SO>&  dm );
+   template< typename MT, bool SO > inline CompressedMatrix( const DenseMatrix<MT,SO>&  dm, const Alloc& alloc );
    template< typename MT, bool SO > inline CompressedMatrix( const SparseMatrix<MT,SO>& sm );
+   template< typename MT, bool SO > inline CompressedMatrix( const SparseMatrix<MT,SO>& sm, const Alloc& alloc );
    //@}
    //**********************************************************************************************
 
@@ -3179,6 +3604,9 @@ class CompressedMatrix<Type,true>
    template< typename MT, bool SO > inline CompressedMatrix& operator-=( const Matrix<MT,SO>& rhs );
    template< typename MT, bool SO > inline CompressedMatrix& operator%=( const DenseMatrix<MT,SO>&  rhs );
    template< typename MT, bool SO > inline CompressedMatrix& operator%=( const SparseMatrix<MT,SO>& rhs );
+
+   template< typename MT > inline CompressedMatrix& assignValues( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT > inline CompressedMatrix& assignValues( const SparseMatrix<MT,false>& rhs );
    //@}
    //**********************************************************************************************
 
@@ -3274,7 +3702,8 @@ class CompressedMatrix<Type,true>
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit inline CompressedMatrix( size_t m, size_t n, Uninitialized );
+   explicit inline CompressedMatrix( size_t m, size_t n, Uninitialized,
+                                     const ElementAllocator& alloc = ElementAllocator() );
    //@}
    //**********************************************************************************************
 
@@ -3299,11 +3728,13 @@ class CompressedMatrix<Type,true>
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   size_t m_;         //!< The current number of rows of the compressed matrix.
-   size_t n_;         //!< The current number of columns of the compressed matrix.
-   size_t capacity_;  //!< The current capacity of the pointer array.
-   Iterator* begin_;  //!< Pointers to the first non-zero element of each column.
-   Iterator* end_;    //!< Pointers one past the last non-zero element of each column.
+   ElementAllocator alloc_;      //!< The allocator of the non-zero elements.
+   IteratorAllocator ptrAlloc_;  //!< The allocator of the row/column pointers.
+   size_t m_;                    //!< The current number of rows of the compressed matrix.
+   size_t n_;                    //!< The current number of columns of the compressed matrix.
+   size_t capacity_;             //!< The current capacity of the pointer array.
+   Iterator* begin_;             //!< Pointers to the first non-zero element of each column.
+   Iterator* end_;               //!< Pointers one past the last non-zero element of each column.
 
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
@@ -3315,6 +3746,7 @@ class CompressedMatrix<Type,true>
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
    BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE       ( ElementBase, Element );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE         ( Type, typename std::allocator_traits<Alloc>::value_type );
    //**********************************************************************************************
 };
 /*! \endcond */
@@ -3329,8 +3761,8 @@ class CompressedMatrix<Type,true>
 //
 //=================================================================================================
 
-template< typename Type >
-const Type CompressedMatrix<Type,true>::zero_{};
+template< typename Type, typename Alloc >
+const Type CompressedMatrix<Type,true,Alloc>::zero_{};
 
 
 
@@ -3345,9 +3777,33 @@ const Type CompressedMatrix<Type,true>::zero_{};
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix()
-   : m_       ( 0UL )      // The current number of rows of the compressed matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix()
+   : alloc_   ()           // The allocator of the non-zero elements
+   , ptrAlloc_()           // The allocator of the row/column pointers
+   , m_       ( 0UL )      // The current number of rows of the compressed matrix
+   , n_       ( 0UL )      // The current number of columns of the compressed matrix
+   , capacity_( 0UL )      // The current capacity of the pointer array
+   , begin_   ( nullptr )  // Pointers to the first non-zero element of each column
+   , end_     ( nullptr )  // Pointers one past the last non-zero element of each column
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an empty matrix with the given allocator.
+//
+// \param alloc The allocator of the non-zero elements.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( const Alloc& alloc )
+   : alloc_   ( alloc )    // The allocator of the non-zero elements
+   , ptrAlloc_( alloc )    // The allocator of the row/column pointers
+   , m_       ( 0UL )      // The current number of rows of the compressed matrix
    , n_       ( 0UL )      // The current number of columns of the compressed matrix
    , capacity_( 0UL )      // The current capacity of the pointer array
    , begin_   ( nullptr )  // Pointers to the first non-zero element of each column
@@ -3366,9 +3822,29 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
-   : CompressedMatrix( m, n, Uninitialized() )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( size_t m, size_t n )
+   : CompressedMatrix( m, n, Alloc() )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param alloc The allocator of the non-zero elements.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( size_t m, size_t n, const Alloc& alloc )
+   : CompressedMatrix( m, n, Uninitialized(), ElementAllocator( alloc ) )
 {
    for( size_t j=1UL; j<2UL*n_+2UL; ++j )
       begin_[j] = nullptr;
@@ -3387,11 +3863,32 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : CompressedMatrix( m, n, Uninitialized() )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : CompressedMatrix( m, n, nonzeros, Alloc() )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \param alloc The allocator of the non-zero elements.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( size_t m, size_t n, size_t nonzeros, const Alloc& alloc )
+   : CompressedMatrix( m, n, Uninitialized(), ElementAllocator( alloc ) )
 {
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate( alloc_, nonzeros );
    for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
       begin_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
@@ -3411,8 +3908,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // column. Note that the given vector must have at least \a n elements.
 */
-template< typename Type >  // Data type of the matrix
-CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+CompressedMatrix<Type,true,Alloc>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
@@ -3421,7 +3919,7 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
    for( auto it=nonzeros.begin(); it!=nonzeros.end(); ++it )
       newCapacity += *it;
 
-   begin_[0UL] = end_[0UL] = allocate<Element>( newCapacity );
+   begin_[0UL] = end_[0UL] = allocate( alloc_, newCapacity );
    for( size_t j=0UL; j<n_; ++j ) {
       begin_[j+1UL] = end_[j+1UL] = begin_[j] + nonzeros[j];
    }
@@ -3451,8 +3949,9 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 // initialized by the values of the given initializer list. Missing values are considered to
 // be default values.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
    : CompressedMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
 {
    for( size_t j=0UL; j<n_; ++j )
@@ -3485,14 +3984,19 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( initializer_list< initiali
 /*!\brief The copy constructor for CompressedMatrix.
 //
 // \param sm Sparse matrix to be copied.
+//
+// The allocator of the new matrix is obtained via the \c select_on_container_copy_construction()
+// function of the allocator of the given matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
-   : CompressedMatrix( sm.m_, sm.n_, Uninitialized() )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( const CompressedMatrix& sm )
+   : CompressedMatrix( sm.m_, sm.n_, Uninitialized()
+                     , std::allocator_traits<ElementAllocator>::select_on_container_copy_construction( sm.alloc_ ) )
 {
    const size_t nonzeros( sm.nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate( alloc_, nonzeros );
    for( size_t j=0UL; j<n_; ++j ) {
       end_[j] = castDown( std::copy( sm.begin(j), sm.end(j), castUp( begin_[j] ) ) );
       begin_[j+1UL] = end_[j];
@@ -3508,14 +4012,19 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
 /*!\brief The move constructor for CompressedMatrix.
 //
 // \param sm The compressed matrix to be moved into this instance.
+//
+// The allocator of the given matrix is moved along with the matrix elements.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
-   : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
-   , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
-   , capacity_( sm.capacity_ )  // The current capacity of the pointer array
-   , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each column
-   , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each column
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
+   : alloc_   ( std::move( sm.alloc_ ) )     // The allocator of the non-zero elements
+   , ptrAlloc_( std::move( sm.ptrAlloc_ ) )  // The allocator of the row/column pointers
+   , m_       ( sm.m_ )                      // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )                      // The current number of columns of the compressed matrix
+   , capacity_( sm.capacity_ )               // The current capacity of the pointer array
+   , begin_   ( sm.begin_ )                  // Pointers to the first non-zero element of each column
+   , end_     ( sm.end_ )                    // Pointers one past the last non-zero element of each column
 {
    sm.m_        = 0UL;
    sm.n_        = 0UL;
@@ -3533,12 +4042,33 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( CompressedMatrix&& sm ) no
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the foreign dense matrix
-        , bool SO >        // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
-   : CompressedMatrix( (~dm).rows(), (~dm).columns() )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign dense matrix
+        , bool SO >         // Storage order of the foreign dense matrix
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
+   : CompressedMatrix( dm, Alloc() )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from dense matrices with the given allocator.
+//
+// \param dm Dense matrix to be copied.
+// \param alloc The allocator of the non-zero elements.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign dense matrix
+        , bool SO >         // Storage order of the foreign dense matrix
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( const DenseMatrix<MT,SO>& dm, const Alloc& alloc )
+   : CompressedMatrix( (~dm).rows(), (~dm).columns(), alloc )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    assign( *this, ~dm );
@@ -3553,12 +4083,33 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the foreign compressed matrix
-        , bool SO >        // Storage order of the foreign compressed matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
-   : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign compressed matrix
+        , bool SO >         // Storage order of the foreign compressed matrix
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
+   : CompressedMatrix( sm, Alloc() )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from different sparse matrices with the given allocator.
+//
+// \param sm Sparse matrix to be copied.
+// \param alloc The allocator of the non-zero elements.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign compressed matrix
+        , bool SO >         // Storage order of the foreign compressed matrix
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( const SparseMatrix<MT,SO>& sm, const Alloc& alloc )
+   : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros(), alloc )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    assign( *this, ~sm );
@@ -3573,14 +4124,19 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator for the non-zero elements.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, Uninitialized )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::CompressedMatrix( size_t m, size_t n, Uninitialized,
+                                                            const ElementAllocator& alloc )
+   : alloc_   ( alloc )                             // The allocator of the non-zero elements
+   , ptrAlloc_( alloc )                             // The allocator of the row/column pointers
+   , m_       ( m )                                 // The current number of rows of the compressed matrix
+   , n_       ( n )                                 // The current number of columns of the compressed matrix
+   , capacity_( n )                                 // The current capacity of the pointer array
+   , begin_   ( allocate( ptrAlloc_, 2UL*n+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n+1UL) )                    // Pointers one past the last non-zero element of each column
 {
    begin_[0UL] = nullptr;
 }
@@ -3600,12 +4156,13 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, Uninit
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::~CompressedMatrix()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>::~CompressedMatrix()
 {
    if( begin_ != nullptr ) {
-      deallocate( begin_[0UL] );
-      delete[] begin_;
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
    }
 }
 /*! \endcond */
@@ -3634,12 +4191,15 @@ inline CompressedMatrix<Type,true>::~CompressedMatrix()
 // case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
 // check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Reference
+   CompressedMatrix<Type,true,Alloc>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    return Reference( *this, i, j );
 }
@@ -3658,12 +4218,14 @@ inline typename CompressedMatrix<Type,true>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstReference
+   CompressedMatrix<Type,true,Alloc>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
 
    const ConstIterator pos( lowerBound( i, j ) );
 
@@ -3690,9 +4252,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // inserted into the compressed matrix. In contrast to the subscript operator this function
 // always performs a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::at( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Reference
+   CompressedMatrix<Type,true,Alloc>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3718,9 +4281,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::at( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstReference
+   CompressedMatrix<Type,true,Alloc>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3741,9 +4305,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::begin( size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::begin( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3759,9 +4324,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::begin( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstIterator
+   CompressedMatrix<Type,true,Alloc>::begin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3777,9 +4343,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cbegin( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstIterator
+   CompressedMatrix<Type,true,Alloc>::cbegin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3795,9 +4362,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::end( size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::end( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3813,9 +4381,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::end( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstIterator
+   CompressedMatrix<Type,true,Alloc>::end( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3831,9 +4400,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cend( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstIterator
+   CompressedMatrix<Type,true,Alloc>::cend( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3872,9 +4442,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // assigned the values from the given initializer list. Missing values are considered to
 // be default values.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::operator=( initializer_list< initializer_list<Type> > list )
 {
    using blaze::nonZeros;
 
@@ -3918,36 +4489,35 @@ inline CompressedMatrix<Type,true>&
 // The compressed matrix is resized according to the given compressed matrix and initialized
 // as a copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const CompressedMatrix& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::operator=( const CompressedMatrix& rhs )
 {
-   using std::swap;
-
    if( &rhs == this ) return *this;
 
    const size_t nonzeros( rhs.nonZeros() );
 
    if( rhs.n_ > capacity_ || nonzeros > capacity() )
    {
-      Iterator* newBegin( new Iterator[2UL*rhs.n_+2UL] );
+      Iterator* newBegin( allocate( ptrAlloc_, 2UL*rhs.n_+2UL ) );
       Iterator* newEnd  ( newBegin+(rhs.n_+1UL) );
 
-      newBegin[0UL] = allocate<Element>( nonzeros );
+      newBegin[0UL] = allocate( alloc_, nonzeros );
       for( size_t j=0UL; j<rhs.n_; ++j ) {
          newEnd[j] = castDown( std::copy( rhs.begin_[j], rhs.end_[j], castUp( newBegin[j] ) ) );
          newBegin[j+1UL] = newEnd[j];
       }
       newEnd[rhs.n_] = newBegin[0UL]+nonzeros;
 
-      swap( begin_, newBegin );
+      if( begin_ != nullptr ) {
+         deallocate( alloc_, begin_[0UL], capacity() );
+         deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
+      }
+
+      begin_ = newBegin;
       end_ = newEnd;
       capacity_ = rhs.n_;
-
-      if( newBegin != nullptr ) {
-         deallocate( newBegin[0UL] );
-         delete[] newBegin;
-      }
    }
    else {
       for( size_t j=0UL; j<rhs.n_; ++j ) {
@@ -3971,16 +4541,21 @@ inline CompressedMatrix<Type,true>&
 //
 // \param rhs The compressed matrix to be moved into this instance.
 // \return Reference to the assigned compressed matrix.
+//
+// The allocator of the given matrix is moved along with the matrix elements.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( CompressedMatrix&& rhs ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::operator=( CompressedMatrix&& rhs ) noexcept
 {
    if( begin_ != nullptr ) {
-      deallocate( begin_[0UL] );
-      delete[] begin_;
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
    }
 
+   alloc_    = std::move( rhs.alloc_ );
+   ptrAlloc_ = std::move( rhs.ptrAlloc_ );
    m_        = rhs.m_;
    n_        = rhs.n_;
    capacity_ = rhs.capacity_;
@@ -4009,16 +4584,17 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side dense matrix
-        , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO >         // Storage order of the right-hand side dense matrix
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
    if( (~rhs).canAlias( this ) ) {
-      CompressedMatrix tmp( ~rhs );
+      CompressedMatrix tmp( ~rhs, Alloc( alloc_ ) );
       swap( tmp );
    }
    else {
@@ -4042,18 +4618,19 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side compressed matrix
-        , bool SO >        // Storage order of the right-hand side compressed matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side compressed matrix
+        , bool SO >         // Storage order of the right-hand side compressed matrix
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
-      CompressedMatrix tmp( ~rhs );
+      CompressedMatrix tmp( ~rhs, Alloc( alloc_ ) );
       swap( tmp );
    }
    else {
@@ -4082,10 +4659,11 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline CompressedMatrix<Type,true,Alloc>& CompressedMatrix<Type,true,Alloc>::operator+=( const Matrix<MT,SO>& rhs )
 {
    using blaze::addAssign;
 
@@ -4114,10 +4692,11 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline CompressedMatrix<Type,true,Alloc>& CompressedMatrix<Type,true,Alloc>::operator-=( const Matrix<MT,SO>& rhs )
 {
    using blaze::subAssign;
 
@@ -4147,11 +4726,12 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side dense matrix
-        , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator%=( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO >         // Storage order of the right-hand side dense matrix
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::operator%=( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::schurAssign;
 
@@ -4160,7 +4740,7 @@ inline CompressedMatrix<Type,true>&
    }
 
    if( (~rhs).canAlias( this ) ) {
-      CompressedMatrix tmp( *this % (~rhs) );
+      CompressedMatrix tmp( *this % (~rhs), Alloc( alloc_ ) );
       swap( tmp );
    }
    else {
@@ -4186,18 +4766,19 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side sparse matrix
-        , bool SO >        // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator%=( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO >         // Storage order of the right-hand side sparse matrix
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::operator%=( const SparseMatrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
    if( !IsZero_v<MT> ) {
-      CompressedMatrix tmp( *this % (~rhs) );
+      CompressedMatrix tmp( *this % (~rhs), Alloc( alloc_ ) );
       swap( tmp );
    }
    else {
@@ -4210,6 +4791,177 @@ inline CompressedMatrix<Type,true>&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pattern-preserving assignment of the values of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix providing the new values.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Sparsity pattern does not match.
+//
+// This function overwrites the values of all non-zero elements of the compressed matrix with
+// the values of the corresponding elements of the given sparse matrix. In contrast to the
+// assignment operator the sparsity pattern of the compressed matrix (i.e. the indices of all
+// non-zero elements and the capacity of all columns) remains unchanged: Elements of the sparsity
+// pattern without counterpart in the given matrix are reset to their default value and no
+// element is inserted or erased. Since only the values are written, this is considerably more
+// efficient than the assignment operator in case the sparsity pattern stays the same, as for
+// instance for coefficient matrices that are updated in every time step:
+
+   \code
+   blaze::CompressedMatrix<double> A, M, K;
+   // ... Resizing and initialization of M and K; A is initialized with the joint pattern of M and K
+
+   A.assignValues( M + dt*K );
+   \endcode
+
+// In case the sizes of the two matrices don't match or in case the given matrix contains a
+// non-default element outside the sparsity pattern of the compressed matrix, a
+// \a std::invalid_argument exception is thrown. In both cases the compressed matrix remains
+// unchanged. In case a shared-memory parallelization is active and the number of non-zero
+// elements is larger or equal to the BLAZE_SMP_SMATASSIGN_THRESHOLD, the columns of the matrix are
+// updated in parallel.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::assignValues( const SparseMatrix<MT,true>& rhs )
+{
+   using CT = CompositeType_t<MT>;
+
+   waitForAsyncAssignments( *this, ~rhs );
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( n_ == 0UL ) return *this;
+
+   CT tmp( ~rhs );  // Evaluation of the right-hand side sparse matrix
+
+   // Merging the non-zero elements of the given matrix into the sparsity pattern of column j
+   const auto merge = [&]( size_t j, auto store ) -> bool
+   {
+      Iterator pos( begin_[j] );
+
+      for( auto element=tmp.begin(j); element!=tmp.end(j); ++element )
+      {
+         for( ; pos!=end_[j] && pos->index() < element->index(); ++pos ) {
+            store( pos, Type() );
+         }
+
+         if( pos == end_[j] || pos->index() != element->index() ) {
+            if( isDefault( element->value() ) ) continue;
+            return false;
+         }
+
+         store( pos, element->value() );
+         ++pos;
+      }
+
+      for( ; pos!=end_[j]; ++pos ) {
+         store( pos, Type() );
+      }
+
+      return true;
+   };
+
+   const size_t nonzeros( nonZeros() );
+   const size_t chunks( ( nonzeros >= smpThreshold( SMP_SMATASSIGN ) && canSMPFor() )
+                        ?( min( getNumThreads(), n_ ) )
+                        :( 1UL ) );
+
+   // Splitting the columns into chunks of roughly the same number of non-zero elements
+   const Iterator first( begin_[0UL] );
+   const size_t total( end_[n_-1UL] - first );
+
+   const auto bound = [&]( size_t k ) -> size_t
+   {
+      if( k == chunks ) return n_;
+      return std::lower_bound( begin_, begin_+n_, first+(k*total)/chunks ) - begin_;
+   };
+
+   // Merging all columns, in parallel in case the number of non-zero elements is large enough
+   const auto mergeAll = [&]( auto store ) -> bool
+   {
+      std::unique_ptr<bool[]> valid( new bool[chunks] );
+
+      smpFor( chunks, [&]( size_t k ) {
+         const size_t end( bound(k+1UL) );
+
+         valid[k] = true;
+         for( size_t j=bound(k); j<end && valid[k]; ++j ) {
+            valid[k] = merge( j, store );
+         }
+      } );
+
+      return std::all_of( valid.get(), valid.get()+chunks, []( bool v ){ return v; } );
+   };
+
+   if( !tmp.canAlias( this ) )
+   {
+      // Checking the sparsity pattern before writing any value to leave the matrix unchanged
+      if( !mergeAll( []( Iterator, const auto& ){} ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Sparsity pattern does not match" );
+      }
+
+      mergeAll( []( Iterator pos, const auto& value ){ pos->value() = value; } );
+   }
+   else
+   {
+      // Gathering the new values first in case the given matrix refers to this matrix
+      std::vector<Type> values( capacity() );
+
+      if( !mergeAll( [&]( Iterator pos, const auto& value ){ values[pos-first] = value; } ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Sparsity pattern does not match" );
+      }
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( Iterator pos=begin_[j]; pos!=end_[j]; ++pos ) {
+            pos->value() = values[pos-first];
+         }
+      }
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pattern-preserving assignment of the values of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix providing the new values.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Sparsity pattern does not match.
+//
+// This function overwrites the values of all non-zero elements of the compressed matrix with
+// the values of the corresponding elements of the given row-major sparse matrix. The given
+// matrix is first converted into a column-major matrix. For details see the assignValues()
+// function for column-major sparse matrices.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline CompressedMatrix<Type,true,Alloc>&
+   CompressedMatrix<Type,true,Alloc>::assignValues( const SparseMatrix<MT,false>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const CompressedMatrix tmp( ~rhs );
+   return assignValues( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -4224,8 +4976,9 @@ inline CompressedMatrix<Type,true>&
 //
 // \return The number of rows of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::rows() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,true,Alloc>::rows() const noexcept
 {
    return m_;
 }
@@ -4239,8 +4992,9 @@ inline size_t CompressedMatrix<Type,true>::rows() const noexcept
 //
 // \return The number of columns of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::columns() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,true,Alloc>::columns() const noexcept
 {
    return n_;
 }
@@ -4254,8 +5008,9 @@ inline size_t CompressedMatrix<Type,true>::columns() const noexcept
 //
 // \return The capacity of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::capacity() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,true,Alloc>::capacity() const noexcept
 {
    if( begin_ != nullptr )
       return end_[n_] - begin_[0UL];
@@ -4272,8 +5027,9 @@ inline size_t CompressedMatrix<Type,true>::capacity() const noexcept
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,true,Alloc>::capacity( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return begin_[j+1UL] - begin_[j];
@@ -4288,8 +5044,9 @@ inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const noexcept
 //
 // \return The number of non-zero elements in the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros() const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,true,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -4309,8 +5066,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,true,Alloc>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return end_[j] - begin_[j];
@@ -4325,8 +5083,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reset()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::reset()
 {
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
@@ -4345,8 +5104,9 @@ inline void CompressedMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reset( size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    end_[j] = begin_[j];
@@ -4363,8 +5123,9 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the compressed matrix is 0.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::clear()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::clear()
 {
    if( end_ != nullptr )
       end_[0UL] = end_[n_];
@@ -4391,19 +5152,21 @@ inline void CompressedMatrix<Type,true>::clear()
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+void CompressedMatrix<Type,true,Alloc>::resize( size_t m, size_t n, bool preserve )
 {
-   using std::swap;
-
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
    if( m == m_ && n == n_ ) return;
 
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
    if( begin_ == nullptr )
    {
-      begin_ = new Iterator[2UL*n+2UL];
+      begin_ = allocate( ptrAlloc_, 2UL*n+2UL );
       end_   = begin_+n+1UL;
 
       for( size_t j=0UL; j<2UL*n+2UL; ++j ) {
@@ -4414,7 +5177,7 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    }
    else if( n > capacity_ )
    {
-      Iterator* newBegin( new Iterator[2UL*n+2UL] );
+      Iterator* newBegin( allocate( ptrAlloc_, 2UL*n+2UL ) );
       Iterator* newEnd  ( newBegin+n+1UL );
 
       newBegin[0UL] = begin_[0UL];
@@ -4436,8 +5199,8 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
       newEnd[n] = end_[n_];
 
-      swap( newBegin, begin_ );
-      delete[] newBegin;
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
+      begin_ = newBegin;
       end_ = newEnd;
       capacity_ = n;
    }
@@ -4489,8 +5252,9 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -4511,11 +5275,10 @@ inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
 // \a nonzeros elements. The current values of the compressed matrix and all other individual
 // column capacities are preserved.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+void CompressedMatrix<Type,true,Alloc>::reserve( size_t j, size_t nonzeros )
 {
-   using std::swap;
-
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
@@ -4532,10 +5295,10 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
       const size_t newCapacity( begin_[n_] - begin_[0UL] + additional );
       BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
 
-      Iterator* newBegin( new Iterator[2UL*n_+2UL] );
+      Iterator* newBegin( allocate( ptrAlloc_, 2UL*n_+2UL ) );
       Iterator* newEnd  ( newBegin+n_+1UL );
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate( alloc_, newCapacity );
       newEnd  [n_ ] = newBegin[0UL]+newCapacity;
 
       for( size_t k=0UL; k<j; ++k ) {
@@ -4551,9 +5314,9 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 
       BLAZE_INTERNAL_ASSERT( newBegin[n_] == newEnd[n_], "Invalid pointer calculations" );
 
-      swap( newBegin, begin_ );
-      deallocate( newBegin[0UL] );
-      delete[] newBegin;
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
+      begin_ = newBegin;
       end_ = newEnd;
       capacity_ = n_;
    }
@@ -4583,8 +5346,9 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 // It removes all excessive capacity from all columns. Note that this function does not remove
 // the overall capacity but only reduces the capacity per column.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::trim()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+void CompressedMatrix<Type,true,Alloc>::trim()
 {
    for( size_t j=0UL; j<n_; ++j )
       trim( j );
@@ -4604,8 +5368,9 @@ void CompressedMatrix<Type,true>::trim()
 // removes all excessive capacity from the specified column. The excessive capacity is assigned
 // to the subsequent column.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::trim( size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+void CompressedMatrix<Type,true,Alloc>::trim( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -4627,8 +5392,9 @@ void CompressedMatrix<Type,true>::trim( size_t j )
 // that in case a reallocation occurs, all iterators (including end() iterators), all pointers
 // and references to elements of this matrix are invalidated.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::shrinkToFit()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::shrinkToFit()
 {
    if( nonZeros() < capacity() ) {
       CompressedMatrix( *this ).swap( *this );
@@ -4644,12 +5410,17 @@ inline void CompressedMatrix<Type,true>::shrinkToFit()
 //
 // \param sm The compressed matrix to be swapped.
 // \return void
+//
+// The allocators of the two matrices are swapped along with the matrix elements.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::swap( CompressedMatrix& sm ) noexcept
 {
    using std::swap;
 
+   swap( alloc_, sm.alloc_ );
+   swap( ptrAlloc_, sm.ptrAlloc_ );
    swap( m_, sm.m_ );
    swap( n_, sm.n_ );
    swap( capacity_, sm.capacity_ );
@@ -4669,8 +5440,9 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::extendCapacity() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t CompressedMatrix<Type,true,Alloc>::extendCapacity() const noexcept
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL );
@@ -4690,15 +5462,14 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const noexcept
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+void CompressedMatrix<Type,true,Alloc>::reserveElements( size_t nonzeros )
 {
-   using std::swap;
-
-   Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+   Iterator* newBegin = allocate( ptrAlloc_, 2UL*capacity_+2UL );
    Iterator* newEnd   = newBegin+capacity_+1UL;
 
-   newBegin[0UL] = allocate<Element>( nonzeros );
+   newBegin[0UL] = allocate( alloc_, nonzeros );
 
    for( size_t k=0UL; k<n_; ++k ) {
       BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid column pointers" );
@@ -4708,13 +5479,13 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 
    newEnd[n_] = newBegin[0UL]+nonzeros;
 
-   swap( newBegin, begin_ );
-   end_ = newEnd;
-
-   if( newBegin != nullptr ) {
-      deallocate( newBegin[0UL] );
-      delete[] newBegin;
+   if( begin_ != nullptr ) {
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
    }
+
+   begin_ = newBegin;
+   end_ = newEnd;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4728,9 +5499,10 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 // This function performs a down-cast of the given iterator to base elements to an iterator to
 // derived elements.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::castDown( IteratorBase it ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::castDown( IteratorBase it ) const noexcept
 {
    return static_cast<Iterator>( it );
 }
@@ -4745,9 +5517,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // This function performs an up-cast of the given iterator to derived elements to an iterator
 // to base elements.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::IteratorBase
-   CompressedMatrix<Type,true>::castUp( Iterator it ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::IteratorBase
+   CompressedMatrix<Type,true,Alloc>::castUp( Iterator it ) const noexcept
 {
    return static_cast<IteratorBase>( it );
 }
@@ -4775,12 +5548,15 @@ inline typename CompressedMatrix<Type,true>::IteratorBase
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::set( size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( lowerBound( i, j ) );
 
@@ -4808,12 +5584,15 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( lowerBound( i, j ) );
 
@@ -4838,12 +5617,11 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type >  // Data type of the matrix
-typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
-   using std::swap;
-
    if( begin_[j+1UL] - end_[j] != 0 ) {
       std::move_backward( pos, end_[j], castUp( end_[j]+1UL ) );
       pos->value_ = value;
@@ -4868,10 +5646,10 @@ typename CompressedMatrix<Type,true>::Iterator
    else {
       size_t newCapacity( extendCapacity() );
 
-      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+      Iterator* newBegin = allocate( ptrAlloc_, 2UL*capacity_+2UL );
       Iterator* newEnd   = newBegin+capacity_+1UL;
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate( alloc_, newCapacity );
 
       for( size_t k=0UL; k<j; ++k ) {
          const size_t nonzeros( end_[k] - begin_[k] );
@@ -4895,10 +5673,10 @@ typename CompressedMatrix<Type,true>::Iterator
       tmp->index_ = i;
       std::move( pos, end_[n_-1UL], castUp( tmp+1UL ) );
 
-      swap( newBegin, begin_ );
+      deallocate( alloc_, begin_[0UL], capacity() );
+      deallocate( ptrAlloc_, begin_, 2UL*capacity_+2UL );
+      begin_ = newBegin;
       end_ = newEnd;
-      deallocate( newBegin[0UL] );
-      delete[] newBegin;
 
       return tmp;
    }
@@ -4960,8 +5738,9 @@ typename CompressedMatrix<Type,true>::Iterator
 // \note Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -4993,8 +5772,9 @@ inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type&
 // \note Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::finalize( size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
 
@@ -5024,11 +5804,14 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //
 // This function erases an element from the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void CompressedMatrix<Type,true,Alloc>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( find( i, j ) );
    if( pos != end_[j] )
@@ -5048,9 +5831,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
 //
 // This function erases an element from column \a j of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator pos )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::erase( size_t j, Iterator pos )
 {
    BLAZE_USER_ASSERT( j < columns()   , "Invalid column access index"    );
    BLAZE_USER_ASSERT( pos >= begin_[j] && pos <= end_[j], "Invalid compressed matrix iterator" );
@@ -5075,9 +5859,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases a range of elements from column \a j of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::erase( size_t j, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -5115,9 +5900,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \note The predicate is required to be pure, i.e. to produce deterministic results for elements
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
-template< typename Type >  // Data type of the matrix
-template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,true>::erase( Pred predicate )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename Pred >   // Type of the unary predicate
+inline void CompressedMatrix<Type,true,Alloc>::erase( Pred predicate )
 {
    for( size_t j=0UL; j<n_; ++j ) {
       end_[j] = castDown( std::remove_if( castUp( begin_[j] ), castUp( end_[j] ),
@@ -5155,9 +5941,10 @@ inline void CompressedMatrix<Type,true>::erase( Pred predicate )
 // \note The predicate is required to be pure, i.e. to produce deterministic results for elements
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
-template< typename Type >  // Data type of the matrix
-template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last, Pred predicate )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename Pred >   // Type of the unary predicate
+inline void CompressedMatrix<Type,true,Alloc>::erase( size_t j, Iterator first, Iterator last, Pred predicate )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -5198,9 +5985,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterat
 // Note that the returned compressed matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -5223,9 +6011,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // Note that the returned compressed matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstIterator
+   CompressedMatrix<Type,true,Alloc>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[j] && pos->index_ == i )
@@ -5250,9 +6039,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -5274,9 +6064,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstIterator
+   CompressedMatrix<Type,true,Alloc>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::lower_bound( begin_[j], end_[j], i,
@@ -5303,9 +6094,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::Iterator
+   CompressedMatrix<Type,true,Alloc>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -5327,9 +6119,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename CompressedMatrix<Type,true,Alloc>::ConstIterator
+   CompressedMatrix<Type,true,Alloc>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::upper_bound( begin_[j], end_[j], i,
@@ -5356,10 +6149,13 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>& CompressedMatrix<Type,true,Alloc>::transpose()
 {
-   CompressedMatrix tmp( trans( *this ) );
+   waitForAsyncAssignments( *this, *this );
+
+   CompressedMatrix tmp( trans( *this ), Alloc( alloc_ ) );
    swap( tmp );
    return *this;
 }
@@ -5373,10 +6169,13 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::ctranspose()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline CompressedMatrix<Type,true,Alloc>& CompressedMatrix<Type,true,Alloc>::ctranspose()
 {
-   CompressedMatrix tmp( ctrans( *this ) );
+   waitForAsyncAssignments( *this, *this );
+
+   CompressedMatrix tmp( ctrans( *this ), Alloc( alloc_ ) );
    swap( tmp );
    return *this;
 }
@@ -5402,9 +6201,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::ctranspose()
    A.scale( 4 );  // Same effect as above
    \endcode
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Other& scalar )
+inline CompressedMatrix<Type,true,Alloc>& CompressedMatrix<Type,true,Alloc>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( auto element=begin_[j]; element!=end_[j]; ++element )
@@ -5435,9 +6235,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Ot
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,true,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5456,9 +6257,10 @@ inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const no
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,true,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5477,8 +6279,9 @@ inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const n
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the matrix
-inline bool CompressedMatrix<Type,true>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline bool CompressedMatrix<Type,true,Alloc>::canSMPAssign() const noexcept
 {
    return false;
 }
@@ -5498,10 +6301,11 @@ inline bool CompressedMatrix<Type,true>::canSMPAssign() const noexcept
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side dense matrix
-        , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO >         // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,true,Alloc>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5561,9 +6365,10 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,true,Alloc>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5594,9 +6399,10 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,true,Alloc>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5639,15 +6445,16 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side dense matrix
-        , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO >         // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,true,Alloc>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   CompressedMatrix tmp( serial( *this + (~rhs) ), Alloc( alloc_ ) );
    swap( tmp );
 }
 /*! \endcond */
@@ -5666,15 +6473,16 @@ inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side compressed matrix
-        , bool SO >        // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side compressed matrix
+        , bool SO >         // Storage order of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,true,Alloc>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   CompressedMatrix tmp( serial( *this + (~rhs) ), Alloc( alloc_ ) );
    swap( tmp );
 }
 /*! \endcond */
@@ -5693,15 +6501,16 @@ inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side dense matrix
-        , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO >         // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,true,Alloc>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this - (~rhs) ) );
+   CompressedMatrix tmp( serial( *this - (~rhs) ), Alloc( alloc_ ) );
    swap( tmp );
 }
 /*! \endcond */
@@ -5720,15 +6529,16 @@ inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side compressed matrix
-        , bool SO >        // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side compressed matrix
+        , bool SO >         // Storage order of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,true,Alloc>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this - (~rhs) ) );
+   CompressedMatrix tmp( serial( *this - (~rhs) ), Alloc( alloc_ ) );
    swap( tmp );
 }
 /*! \endcond */
@@ -5747,10 +6557,11 @@ inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side dense matrix
-        , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO >         // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,true,Alloc>::schurAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5782,23 +6593,23 @@ inline void CompressedMatrix<Type,true>::schurAssign( const DenseMatrix<MT,SO>&
 //*************************************************************************************************
 /*!\name CompressedMatrix operators */
 //@{
-template< typename Type, bool SO >
-void reset( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Alloc >
+void reset( CompressedMatrix<Type,SO,Alloc>& m );
 
-template< typename Type, bool SO >
-void reset( CompressedMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename Alloc >
+void reset( CompressedMatrix<Type,SO,Alloc>& m, size_t i );
 
-template< typename Type, bool SO >
-void clear( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Alloc >
+void clear( CompressedMatrix<Type,SO,Alloc>& m );
 
-template< bool RF, typename Type, bool SO >
-bool isDefault( const CompressedMatrix<Type,SO>& m );
+template< bool RF, typename Type, bool SO, typename Alloc >
+bool isDefault( const CompressedMatrix<Type,SO,Alloc>& m );
 
-template< typename Type, bool SO >
-bool isIntact( const CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Alloc >
+bool isIntact( const CompressedMatrix<Type,SO,Alloc>& m );
 
-template< typename Type, bool SO >
-void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept;
+template< typename Type, bool SO, typename Alloc >
+void swap( CompressedMatrix<Type,SO,Alloc>& a, CompressedMatrix<Type,SO,Alloc>& b ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -5810,9 +6621,10 @@ void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept
 // \param m The matrix to be resetted.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void reset( CompressedMatrix<Type,SO,Alloc>& m )
 {
    m.reset();
 }
@@ -5832,9 +6644,10 @@ inline void reset( CompressedMatrix<Type,SO>& m )
 // values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void reset( CompressedMatrix<Type,SO,Alloc>& m, size_t i )
 {
    m.reset( i );
 }
@@ -5848,9 +6661,10 @@ inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
 // \param m The matrix to be cleared.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void clear( CompressedMatrix<Type,SO>& m )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void clear( CompressedMatrix<Type,SO,Alloc>& m )
 {
    m.clear();
 }
@@ -5882,10 +6696,11 @@ inline void clear( CompressedMatrix<Type,SO>& m )
    if( isDefault<relaxed>( A ) ) { ... }
    \endcode
 */
-template< bool RF        // Relaxation flag
-        , typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const CompressedMatrix<Type,SO>& m )
+template< bool RF           // Relaxation flag
+        , typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool isDefault( const CompressedMatrix<Type,SO,Alloc>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -5910,9 +6725,10 @@ inline bool isDefault( const CompressedMatrix<Type,SO>& m )
    if( isIntact( A ) ) { ... }
    \endcode
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isIntact( const CompressedMatrix<Type,SO>& m )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const CompressedMatrix<Type,SO,Alloc>& m )
 {
    return ( m.nonZeros() <= m.capacity() );
 }
@@ -5927,9 +6743,10 @@ inline bool isIntact( const CompressedMatrix<Type,SO>& m )
 // \param b The second matrix to be swapped.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void swap( CompressedMatrix<Type,SO,Alloc>& a, CompressedMatrix<Type,SO,Alloc>& b ) noexcept
 {
    a.swap( b );
 }
@@ -5946,8 +6763,8 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) n
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< CompressedMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsResizable< CompressedMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -5964,8 +6781,8 @@ struct IsResizable< CompressedMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsShrinkable< CompressedMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsShrinkable< CompressedMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -5974,6 +6791,25 @@ struct IsShrinkable< CompressedMatrix<T,SO> >
 
 
 
+//=================================================================================================
+//
+//  TEMPORARYTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename A >
+struct TemporaryType< CompressedMatrix<T,SO,A> >
+{
+   using Type = CompressedMatrix< T, SO, TemporaryAllocator<T> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ADDTRAIT SPECIALIZATIONS
@@ -5991,7 +6827,9 @@ struct AddTraitEval2< T1, T2
 
    static constexpr bool SO = ( StorageOrder_v<T1> && StorageOrder_v<T2> );
 
-   using Type = CompressedMatrix< AddTrait_t<ET1,ET2>, SO >;
+   using ET = AddTrait_t<ET1,ET2>;
+
+   using Type = CompressedMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6016,7 +6854,9 @@ struct SubTraitEval2< T1, T2
 
    static constexpr bool SO = ( StorageOrder_v<T1> && StorageOrder_v<T2> );
 
-   using Type = CompressedMatrix< SubTrait_t<ET1,ET2>, SO >;
+   using ET = SubTrait_t<ET1,ET2>;
+
+   using Type = CompressedMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6048,7 +6888,9 @@ struct SchurTraitEval2< T1, T2
                                     ? StorageOrder_v<T1>
                                     : StorageOrder_v<T2> ) );
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, SO >;
+   using ET = MultTrait_t<ET1,ET2>;
+
+   using Type = CompressedMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6069,8 +6911,9 @@ struct MultTraitEval2< T1, T2
                      , EnableIf_t< IsSparseMatrix_v<T1> && IsNumeric_v<T2> > >
 {
    using ET1 = ElementType_t<T1>;
+   using ET  = MultTrait_t<ET1,T2>;
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,T2>, StorageOrder_v<T1> >;
+   using Type = CompressedMatrix< ET, StorageOrder_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -6078,8 +6921,9 @@ struct MultTraitEval2< T1, T2
                      , EnableIf_t< IsNumeric_v<T1> && IsSparseMatrix_v<T2> > >
 {
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<T1,ET2>;
 
-   using Type = CompressedMatrix< MultTrait_t<T1,ET2>, StorageOrder_v<T2> >;
+   using Type = CompressedMatrix< ET, StorageOrder_v<T2>, DynamicAllocator_t<ET,T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -6094,7 +6938,9 @@ struct MultTraitEval2< T1, T2
 
    static constexpr bool SO = ( IsSparseVector_v<T2> ? rowMajor : columnMajor );
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, SO >;
+   using ET = MultTrait_t<ET1,ET2>;
+
+   using Type = CompressedMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -6105,8 +6951,9 @@ struct MultTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
+   using ET  = MultTrait_t<ET1,ET2>;
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, StorageOrder_v<T1> >;
+   using Type = CompressedMatrix< ET, StorageOrder_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6134,7 +6981,9 @@ struct KronTraitEval2< T1, T2
 
    static constexpr bool SO = ( IsDenseMatrix_v<T2> ? StorageOrder_v<T1> : StorageOrder_v<T2> );
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, SO >;
+   using ET = MultTrait_t<ET1,ET2>;
+
+   using Type = CompressedMatrix< ET, SO, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6155,8 +7004,9 @@ struct DivTraitEval2< T1, T2
                     , EnableIf_t< IsSparseMatrix_v<T1> && IsNumeric_v<T2> > >
 {
    using ET1 = ElementType_t<T1>;
+   using ET  = DivTrait_t<ET1,T2>;
 
-   using Type = CompressedMatrix< DivTrait_t<ET1,T2>, StorageOrder_v<T1> >;
+   using Type = CompressedMatrix< ET, StorageOrder_v<T1>, DynamicAllocator_t<ET,T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6177,8 +7027,9 @@ struct UnaryMapTraitEval2< T, OP
                          , EnableIf_t< IsSparseMatrix_v<T> > >
 {
    using ET = ElementType_t<T>;
+   using RT = MapTrait_t<ET,OP>;
 
-   using Type = CompressedMatrix< MapTrait_t<ET,OP>, StorageOrder_v<T> >;
+   using Type = CompressedMatrix< RT, StorageOrder_v<T>, DynamicAllocator_t<RT,T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6201,7 +7052,9 @@ struct ExpandTraitEval2< T, E
 {
    static constexpr bool TF = ( IsColumnVector_v<T> ? columnMajor : rowMajor );
 
-   using Type = CompressedMatrix< ElementType_t<T>, TF >;
+   using ET = ElementType_t<T>;
+
+   using Type = CompressedMatrix< ET, TF, DynamicAllocator_t<ET,T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6217,10 +7070,12 @@ struct ExpandTraitEval2< T, E
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct HighType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct HighType< CompressedMatrix<T1,SO,A1>, CompressedMatrix<T2,SO,A2> >
 {
-   using Type = CompressedMatrix< typename HighType<T1,T2>::Type, SO >;
+   using ET = typename HighType<T1,T2>::Type;
+
+   using Type = CompressedMatrix< ET, SO, typename std::allocator_traits<A1>::template rebind_alloc<ET> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6236,10 +7091,12 @@ struct HighType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct LowType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct LowType< CompressedMatrix<T1,SO,A1>, CompressedMatrix<T2,SO,A2> >
 {
-   using Type = CompressedMatrix< typename LowType<T1,T2>::Type, SO >;
+   using ET = typename LowType<T1,T2>::Type;
+
+   using Type = CompressedMatrix< ET, SO, typename std::allocator_traits<A1>::template rebind_alloc<ET> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6259,7 +7116,9 @@ template< typename MT, size_t I, size_t J, size_t M, size_t N >
 struct SubmatrixTraitEval2< MT, I, J, M, N
                           , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, StorageOrder_v<MT> >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedMatrix< ET, StorageOrder_v<MT>, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6279,7 +7138,9 @@ template< typename MT, size_t M >
 struct RowsTraitEval2< MT, M
                      , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, false >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedMatrix< ET, false, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6299,7 +7160,9 @@ template< typename MT, size_t N >
 struct ColumnsTraitEval2< MT, N
                         , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, true >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedMatrix< ET, true, DynamicAllocator_t<ET,MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -54,6 +54,7 @@
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/AsyncExecutor.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/sparse/VectorAccessProxy.h>
 #include <blaze/math/traits/AddTrait.h>
@@ -94,6 +95,7 @@
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Instrumentation.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/Types.h>
@@ -654,6 +656,8 @@ template< typename VT >  // Type of the foreign dense vector
 inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv )
    : CompressedVector( (~dv).size() )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    assign( *this, ~dv );
@@ -672,6 +676,8 @@ template< typename VT >  // Type of the foreign sparse vector
 inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
    : CompressedVector( (~sv).size(), (~sv).nonZeros() )
 {
+   BLAZE_INSTRUMENT_TEMPORARY;
+
    using blaze::assign;
 
    assign( *this, ~sv );
@@ -724,6 +730,8 @@ inline typename CompressedVector<Type,TF>::Reference
    CompressedVector<Type,TF>::operator[]( size_t index ) noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    return Reference( *this, index );
 }
@@ -742,6 +750,7 @@ inline typename CompressedVector<Type,TF>::ConstReference
    CompressedVector<Type,TF>::operator[]( size_t index ) const noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
 
    const ConstIterator pos( lowerBound( index ) );
 
@@ -1383,6 +1392,9 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
 {
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
+
    if( preserve ) {
       end_ = lowerBound( n );
    }
@@ -1553,6 +1565,8 @@ inline typename CompressedVector<Type,TF>::Iterator
    CompressedVector<Type,TF>::set( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( lowerBound( index ) );
 
@@ -1583,6 +1597,8 @@ typename CompressedVector<Type,TF>::Iterator
    CompressedVector<Type,TF>::insert( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( lowerBound( index ) );
 
@@ -1701,6 +1717,8 @@ template< typename Type  // Data type of the vector
 inline void CompressedVector<Type,TF>::erase( size_t index )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingTarget( this ), "Access to the target of a pending asynchronous assignment" );
+   BLAZE_USER_ASSERT( !AsyncExecutor::isPendingOperand( this ), "Modification of an operand of a pending asynchronous assignment" );
 
    const Iterator pos( find( index ) );
    if( pos != end_ )
@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/AlignedAllocator.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,9 +51,10 @@ namespace blaze {
 //
 //=================================================================================================
 
-template< typename, bool > class CompressedMatrix;
+template< typename Type, bool, typename = AlignedAllocator<Type> > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
 template< typename, bool > class IdentityMatrix;
+template< bool > class PatternMatrix;
 template< typename, bool > class ZeroMatrix;
 template< typename, bool > class ZeroVector;
 
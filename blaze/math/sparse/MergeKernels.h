@@ -0,0 +1,808 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MergeKernels.h
+//  \brief Header file for the merge kernels of sorted sparse index streams
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MERGEKERNELS_H_
+#define _BLAZE_MATH_SPARSE_MERGEKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Bits.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsPointer.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MERGE KERNELS FOR SORTED SPARSE INDEX STREAMS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default union of the sorted index streams of two sparse ranges (\f$ a \cup b \f$).
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side sparse range.
+// \param lend Iterator one past the last element of the left-hand side sparse range.
+// \param r Iterator to the first element of the right-hand side sparse range.
+// \param rend Iterator one past the last element of the right-hand side sparse range.
+// \param left Operation for elements that are only contained in the left-hand side range.
+// \param right Operation for elements that are only contained in the right-hand side range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+//
+// This kernel visits all elements of both ranges in the order of strictly increasing indices.
+// Instead of a three-way comparison per element, the kernel consumes complete runs of elements
+// from the same range in a tight inner loop, which is well predictable for the common case of
+// long runs of disjoint indices.
+*/
+template< typename IT1     // Type of the left-hand side iterator
+        , typename IT2     // Type of the right-hand side iterator
+        , typename OP1     // Type of the left-only operation
+        , typename OP2     // Type of the right-only operation
+        , typename OP3 >   // Type of the common operation
+inline void mergeUnionScalar( IT1 l, IT1 lend, IT2 r, IT2 rend, OP1& left, OP2& right, OP3& both )
+{
+   while( l != lend && r != rend )
+   {
+      const size_t li( l->index() );
+      const size_t ri( r->index() );
+
+      if( li < ri ) {
+         do {
+            left( l );
+            ++l;
+         } while( l != lend && l->index() < ri );
+      }
+      else if( ri < li ) {
+         do {
+            right( r );
+            ++r;
+         } while( r != rend && r->index() < li );
+      }
+      else {
+         both( l, r );
+         ++l;
+         ++r;
+      }
+   }
+
+   for( ; l!=lend; ++l ) {
+      left( l );
+   }
+
+   for( ; r!=rend; ++r ) {
+      right( r );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized consumption of a run of elements with an index less than the given index.
+// \ingroup sparse
+//
+// \param first Pointer to the first element of the contiguous sparse range.
+// \param last Pointer one past the last element of the contiguous sparse range.
+// \param index The index that terminates the run.
+// \param op Operation for all elements of the run.
+// \return Pointer to the first element with an index not less than \a index.
+//
+// This function compares blocks of 8 (AVX-512) or 4 (AVX2) indices against the given index by
+// a single SIMD comparison. Due to the sorted indices the resulting mask is a prefix mask, whose
+// population count yields the number of block elements that belong to the run. Therefore the
+// length of the run is determined with a single branch per block instead of per element. The
+// remaining elements are processed one by one.
+*/
+template< typename ET    // Type of the sparse elements
+        , typename OP >  // Type of the operation
+inline ET* mergeUnionRun( ET* first, ET* last, size_t index, OP& op )
+{
+#if BLAZE_AVX512F_MODE
+   const __m512i bound( _mm512_set1_epi64( index ) );
+
+   while( last - first >= 8L )
+   {
+      const __m512i a( _mm512_setr_epi64( first[0].index(), first[1].index(), first[2].index(), first[3].index(),
+                                          first[4].index(), first[5].index(), first[6].index(), first[7].index() ) );
+
+      const size_t k( popcount( _mm512_cmplt_epu64_mask( a, bound ) ) );
+
+      for( size_t j=0UL; j<k; ++j ) {
+         op( first+j );
+      }
+      first += k;
+
+      if( k < 8UL ) return first;
+   }
+#elif BLAZE_AVX2_MODE
+   const __m256i bound( _mm256_set1_epi64x( index ) );
+
+   while( last - first >= 4L )
+   {
+      const __m256i a( _mm256_setr_epi64x( first[0].index(), first[1].index(), first[2].index(), first[3].index() ) );
+
+      const size_t k( popcount( _mm256_movemask_pd( _mm256_castsi256_pd( _mm256_cmpgt_epi64( bound, a ) ) ) ) );
+
+      for( size_t j=0UL; j<k; ++j ) {
+         op( first+j );
+      }
+      first += k;
+
+      if( k < 4UL ) return first;
+   }
+#endif
+
+   for( ; first!=last && first->index()<index; ++first ) {
+      op( first );
+   }
+
+   return first;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized union of the sorted index streams of two contiguous sparse ranges.
+// \ingroup sparse
+//
+// \param l Pointer to the first element of the left-hand side sparse range.
+// \param lend Pointer one past the last element of the left-hand side sparse range.
+// \param r Pointer to the first element of the right-hand side sparse range.
+// \param rend Pointer one past the last element of the right-hand side sparse range.
+// \param left Operation for elements that are only contained in the left-hand side range.
+// \param right Operation for elements that are only contained in the right-hand side range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+//
+// This kernel visits all elements of both ranges in the order of strictly increasing indices.
+// The runs of elements from the same range are determined blockwise by means of SIMD comparisons
+// (see mergeUnionRun()).
+*/
+template< typename ET1     // Type of the left-hand side elements
+        , typename ET2     // Type of the right-hand side elements
+        , typename OP1     // Type of the left-only operation
+        , typename OP2     // Type of the right-only operation
+        , typename OP3 >   // Type of the common operation
+inline void mergeUnionSIMD( ET1* l, ET1* lend, ET2* r, ET2* rend, OP1& left, OP2& right, OP3& both )
+{
+   while( l != lend && r != rend )
+   {
+      const size_t li( l->index() );
+      const size_t ri( r->index() );
+
+      if( li < ri ) {
+         l = mergeUnionRun( l, lend, ri, left );
+      }
+      else if( ri < li ) {
+         r = mergeUnionRun( r, rend, li, right );
+      }
+      else {
+         both( l, r );
+         ++l;
+         ++r;
+      }
+   }
+
+   for( ; l!=lend; ++l ) {
+      left( l );
+   }
+
+   for( ; r!=rend; ++r ) {
+      right( r );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merges the sorted index streams of two sparse ranges (\f$ a \cup b \f$).
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side sparse range.
+// \param lend Iterator one past the last element of the left-hand side sparse range.
+// \param r Iterator to the first element of the right-hand side sparse range.
+// \param rend Iterator one past the last element of the right-hand side sparse range.
+// \param left Operation for elements that are only contained in the left-hand side range.
+// \param right Operation for elements that are only contained in the right-hand side range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+//
+// This kernel visits all elements of both ranges in the order of strictly increasing indices.
+// In case both ranges are given in terms of contiguous element storage (as for instance in case
+// of the CompressedVector and CompressedMatrix class templates), the vectorized union kernel is
+// used. Otherwise the scalar kernel is used.
+*/
+template< typename IT1     // Type of the left-hand side iterator
+        , typename IT2     // Type of the right-hand side iterator
+        , typename OP1     // Type of the left-only operation
+        , typename OP2     // Type of the right-only operation
+        , typename OP3 >   // Type of the common operation
+inline auto mergeUnion( IT1 l, IT1 lend, IT2 r, IT2 rend, OP1 left, OP2 right, OP3 both )
+   -> DisableIf_t< IsPointer_v<IT1> && IsPointer_v<IT2> >
+{
+   mergeUnionScalar( l, lend, r, rend, left, right, both );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merges the sorted index streams of two contiguous sparse ranges (\f$ a \cup b \f$).
+// \ingroup sparse
+//
+// \param l Pointer to the first element of the left-hand side sparse range.
+// \param lend Pointer one past the last element of the left-hand side sparse range.
+// \param r Pointer to the first element of the right-hand side sparse range.
+// \param rend Pointer one past the last element of the right-hand side sparse range.
+// \param left Operation for elements that are only contained in the left-hand side range.
+// \param right Operation for elements that are only contained in the right-hand side range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+*/
+template< typename IT1     // Type of the left-hand side iterator
+        , typename IT2     // Type of the right-hand side iterator
+        , typename OP1     // Type of the left-only operation
+        , typename OP2     // Type of the right-only operation
+        , typename OP3 >   // Type of the common operation
+inline auto mergeUnion( IT1 l, IT1 lend, IT2 r, IT2 rend, OP1 left, OP2 right, OP3 both )
+   -> EnableIf_t< IsPointer_v<IT1> && IsPointer_v<IT2> >
+{
+   mergeUnionSIMD( l, lend, r, rend, left, right, both );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default intersection of the sorted index streams of two sparse ranges (\f$ a \cap b \f$).
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side sparse range.
+// \param lend Iterator one past the last element of the left-hand side sparse range.
+// \param r Iterator to the first element of the right-hand side sparse range.
+// \param rend Iterator one past the last element of the right-hand side sparse range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+//
+// This kernel visits all pairs of elements with equal index in the order of strictly increasing
+// indices. Runs of non-matching indices of both ranges are skipped in tight inner loops.
+*/
+template< typename IT1    // Type of the left-hand side iterator
+        , typename IT2    // Type of the right-hand side iterator
+        , typename OP >   // Type of the common operation
+inline void mergeIntersectionScalar( IT1 l, IT1 lend, IT2 r, IT2 rend, OP& both )
+{
+   while( l != lend && r != rend )
+   {
+      const size_t li( l->index() );
+      const size_t ri( r->index() );
+
+      if( li < ri ) {
+         do { ++l; } while( l != lend && l->index() < ri );
+      }
+      else if( ri < li ) {
+         do { ++r; } while( r != rend && r->index() < li );
+      }
+      else {
+         both( l, r );
+         ++l;
+         ++r;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized block intersection of the sorted index streams of two sparse ranges.
+// \ingroup sparse
+//
+// \param l Pointer to the first element of the left-hand side sparse range.
+// \param lend Pointer one past the last element of the left-hand side sparse range.
+// \param r Pointer to the first element of the right-hand side sparse range.
+// \param rend Pointer one past the last element of the right-hand side sparse range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+//
+// This kernel compares blocks of 8 (AVX-512) or 4 (AVX2) indices of both ranges in an all-pairs
+// fashion by means of rotated SIMD comparisons. The resulting match masks of both blocks are
+// compressed via a count-trailing-zeros scan, which yields all matching pairs in increasing
+// order. Afterwards the block with the smaller maximum index is advanced (or both in case of
+// equal maxima). The remaining elements are processed by the scalar kernel.
+*/
+template< typename ET1    // Type of the left-hand side elements
+        , typename ET2    // Type of the right-hand side elements
+        , typename OP >   // Type of the common operation
+inline void mergeIntersectionSIMD( ET1* l, ET1* lend, ET2* r, ET2* rend, OP& both )
+{
+#if BLAZE_AVX512F_MODE
+   while( lend - l >= 8L && rend - r >= 8L )
+   {
+      const __m512i a( _mm512_setr_epi64( l[0].index(), l[1].index(), l[2].index(), l[3].index(),
+                                          l[4].index(), l[5].index(), l[6].index(), l[7].index() ) );
+      const __m512i b( _mm512_setr_epi64( r[0].index(), r[1].index(), r[2].index(), r[3].index(),
+                                          r[4].index(), r[5].index(), r[6].index(), r[7].index() ) );
+
+      const __m512i rot( _mm512_setr_epi64( 1, 2, 3, 4, 5, 6, 7, 0 ) );
+
+      __mmask8 lmask( _mm512_cmpeq_epi64_mask( a, b ) );
+      __mmask8 rmask( lmask );
+
+      __m512i ar( a ), br( b );
+
+      for( int k=1; k<8; ++k ) {
+         ar = _mm512_permutexvar_epi64( rot, ar );
+         br = _mm512_permutexvar_epi64( rot, br );
+         lmask |= _mm512_cmpeq_epi64_mask( a, br );
+         rmask |= _mm512_cmpeq_epi64_mask( b, ar );
+      }
+
+      uint64_t lbits( lmask ), rbits( rmask );
+      while( lbits ) {
+         both( l + ctz( lbits ), r + ctz( rbits ) );
+         lbits &= lbits - 1UL;
+         rbits &= rbits - 1UL;
+      }
+
+      const size_t lmax( l[7].index() );
+      const size_t rmax( r[7].index() );
+
+      if( lmax <= rmax ) l += 8L;
+      if( rmax <= lmax ) r += 8L;
+   }
+#elif BLAZE_AVX2_MODE
+   while( lend - l >= 4L && rend - r >= 4L )
+   {
+      const __m256i a( _mm256_setr_epi64x( l[0].index(), l[1].index(), l[2].index(), l[3].index() ) );
+      const __m256i b( _mm256_setr_epi64x( r[0].index(), r[1].index(), r[2].index(), r[3].index() ) );
+
+      const __m256i a1( _mm256_permute4x64_epi64( a, 0x39 ) );
+      const __m256i a2( _mm256_permute4x64_epi64( a, 0x4E ) );
+      const __m256i a3( _mm256_permute4x64_epi64( a, 0x93 ) );
+      const __m256i b1( _mm256_permute4x64_epi64( b, 0x39 ) );
+      const __m256i b2( _mm256_permute4x64_epi64( b, 0x4E ) );
+      const __m256i b3( _mm256_permute4x64_epi64( b, 0x93 ) );
+
+      const __m256i lcmp( _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi64( a, b  ), _mm256_cmpeq_epi64( a, b1 ) ),
+                                           _mm256_or_si256( _mm256_cmpeq_epi64( a, b2 ), _mm256_cmpeq_epi64( a, b3 ) ) ) );
+      const __m256i rcmp( _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi64( b, a  ), _mm256_cmpeq_epi64( b, a1 ) ),
+                                           _mm256_or_si256( _mm256_cmpeq_epi64( b, a2 ), _mm256_cmpeq_epi64( b, a3 ) ) ) );
+
+      uint64_t lbits( _mm256_movemask_pd( _mm256_castsi256_pd( lcmp ) ) );
+      uint64_t rbits( _mm256_movemask_pd( _mm256_castsi256_pd( rcmp ) ) );
+
+      while( lbits ) {
+         both( l + ctz( lbits ), r + ctz( rbits ) );
+         lbits &= lbits - 1UL;
+         rbits &= rbits - 1UL;
+      }
+
+      const size_t lmax( l[3].index() );
+      const size_t rmax( r[3].index() );
+
+      if( lmax <= rmax ) l += 4L;
+      if( rmax <= lmax ) r += 4L;
+   }
+#endif
+
+   mergeIntersectionScalar( l, lend, r, rend, both );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Length ratio between two sparse ranges from which on the galloping intersection is used.
+// \ingroup sparse
+//
+// In case the longer of two contiguous sparse ranges contains at least this many times more
+// elements than the shorter range, mergeIntersection() switches from the linear (vectorized)
+// merge to the galloping intersection kernel.
+*/
+constexpr size_t gallopingRatio = 16UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Exponential search for the first element with an index not less than \a index.
+// \ingroup sparse
+//
+// \param first Pointer to the first element of the sparse range.
+// \param last Pointer one past the last element of the sparse range.
+// \param index The index to be searched for.
+// \return Pointer to the first element with an index not less than \a index.
+//
+// This function probes the elements at the offsets 1, 2, 4, 8, ... until an element with an
+// index not less than \a index is found and afterwards performs a binary search within the
+// last interval. The search requires \f$ O(\log{d}) \f$ steps, where \f$ d \f$ is the distance
+// to the resulting element.
+*/
+template< typename ET >  // Type of the sparse elements
+inline ET* gallop( ET* first, ET* last, size_t index )
+{
+   if( first == last || first->index() >= index )
+      return first;
+
+   const size_t n( last - first );
+   size_t lo( 0UL );
+   size_t hi( 1UL );
+
+   while( hi < n && first[hi].index() < index ) {
+      lo = hi;
+      hi *= 2UL;
+   }
+
+   return std::lower_bound( first+lo+1UL, first+( hi < n ? hi : n ), index,
+                            []( const auto& element, size_t i ){ return element.index() < i; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Galloping intersection of the sorted index streams of two sparse ranges.
+// \ingroup sparse
+//
+// \param l Pointer to the first element of the left-hand side sparse range.
+// \param lend Pointer one past the last element of the left-hand side sparse range.
+// \param r Pointer to the first element of the right-hand side sparse range.
+// \param rend Pointer one past the last element of the right-hand side sparse range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+//
+// This kernel traverses the shorter of the two ranges and locates each of its indices in the
+// longer range via exponential search. For two ranges of length \f$ m \f$ and \f$ n \f$ with
+// \f$ m \ll n \f$ the complexity is \f$ O(m \log{(n/m)}) \f$ instead of \f$ O(m+n) \f$.
+*/
+template< typename ET1    // Type of the left-hand side elements
+        , typename ET2    // Type of the right-hand side elements
+        , typename OP >   // Type of the common operation
+inline void mergeIntersectionGalloping( ET1* l, ET1* lend, ET2* r, ET2* rend, OP& both )
+{
+   if( lend - l <= rend - r )
+   {
+      for( ; l!=lend; ++l ) {
+         r = gallop( r, rend, l->index() );
+         if( r == rend ) break;
+         if( r->index() == l->index() ) {
+            both( l, r );
+            ++r;
+         }
+      }
+   }
+   else
+   {
+      for( ; r!=rend; ++r ) {
+         l = gallop( l, lend, r->index() );
+         if( l == lend ) break;
+         if( l->index() == r->index() ) {
+            both( l, r );
+            ++l;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intersects the sorted index streams of two sparse ranges (\f$ a \cap b \f$).
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side sparse range.
+// \param lend Iterator one past the last element of the left-hand side sparse range.
+// \param r Iterator to the first element of the right-hand side sparse range.
+// \param rend Iterator one past the last element of the right-hand side sparse range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+//
+// This kernel visits all pairs of elements with equal index in the order of strictly increasing
+// indices. In case both ranges are given in terms of contiguous element storage (as for instance
+// in case of the CompressedVector and CompressedMatrix class templates), the kernel is selected
+// adaptively based on the length ratio of the two ranges (see the mergeIntersection() overload
+// for contiguous ranges). Otherwise the scalar kernel is used.
+*/
+template< typename IT1    // Type of the left-hand side iterator
+        , typename IT2    // Type of the right-hand side iterator
+        , typename OP >   // Type of the common operation
+inline auto mergeIntersection( IT1 l, IT1 lend, IT2 r, IT2 rend, OP both )
+   -> DisableIf_t< IsPointer_v<IT1> && IsPointer_v<IT2> >
+{
+   mergeIntersectionScalar( l, lend, r, rend, both );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intersects the sorted index streams of two contiguous sparse ranges (\f$ a \cap b \f$).
+// \ingroup sparse
+//
+// \param l Pointer to the first element of the left-hand side sparse range.
+// \param lend Pointer one past the last element of the left-hand side sparse range.
+// \param r Pointer to the first element of the right-hand side sparse range.
+// \param rend Pointer one past the last element of the right-hand side sparse range.
+// \param both Operation for elements that are contained in both ranges.
+// \return void
+//
+// In case the length of one range exceeds the length of the other range by at least the factor
+// \a gallopingRatio, the galloping intersection kernel is used. Otherwise the ranges are merged
+// linearly by means of the vectorized block intersection kernel.
+*/
+template< typename IT1    // Type of the left-hand side iterator
+        , typename IT2    // Type of the right-hand side iterator
+        , typename OP >   // Type of the common operation
+inline auto mergeIntersection( IT1 l, IT1 lend, IT2 r, IT2 rend, OP both )
+   -> EnableIf_t< IsPointer_v<IT1> && IsPointer_v<IT2> >
+{
+   const size_t m( lend - l );
+   const size_t n( rend - r );
+
+   if( m * gallopingRatio <= n || n * gallopingRatio <= m ) {
+      mergeIntersectionGalloping( l, lend, r, rend, both );
+   }
+   else {
+      mergeIntersectionSIMD( l, lend, r, rend, both );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS INTERSECTIONPROBE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intersection of many sparse ranges with a single, fixed sparse range.
+// \ingroup sparse
+//
+// The IntersectionProbe class template represents a sparse range (as for instance a sparse
+// vector) that is intersected with many other sparse ranges (as for instance all rows of a sparse
+// matrix). In case the fixed range is given in terms of contiguous element storage, its indices
+// can optionally be scattered into a bitmap of all possible indices, accompanied by the number
+// of set bits preceding each 64-bit word of the bitmap. In this case the membership of an index
+// is determined in constant time by a single bit test, and the rank of the bit (i.e. the word
+// prefix count plus the population count of the lower bits of the word) yields the offset of
+// the matching element within the storage of the fixed range. The fixed range is therefore not
+// traversed again for every intersection. Without bitmap, each intersection is computed by the
+// adaptive mergeIntersection() kernel.
+*/
+template< typename IT >  // Type of the sparse iterator of the fixed range
+class IntersectionProbe
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the IntersectionProbe class template.
+   //
+   // \param first Iterator to the first element of the fixed sparse range.
+   // \param last Iterator one past the last element of the fixed sparse range.
+   // \param size The total number of indices (i.e. the size of the sparse vector).
+   // \param bitmap \a true to create the index bitmap, \a false to use the merge kernels.
+   //
+   // The bitmap is only created in case the fixed range uses contiguous element storage.
+   */
+   explicit inline IntersectionProbe( IT first, IT last, size_t size, bool bitmap )
+      : first_( first )  // Iterator to the first element of the fixed range
+      , last_ ( last  )  // Iterator one past the last element of the fixed range
+      , bits_ ()         // The bitmap of all contained indices
+      , ranks_()         // The number of contained indices preceding each bitmap word
+   {
+      if( !bitmap || !IsPointer_v<IT> || size == 0UL ) return;
+
+      const size_t words( ( size + 63UL ) / 64UL );
+
+      bits_.resize( words, 0UL );
+      ranks_.resize( words );
+
+      for( ; first!=last; ++first ) {
+         const size_t index( first->index() );
+         BLAZE_INTERNAL_ASSERT( index < size, "Invalid sparse element index" );
+         bits_[index/64UL] |= ( uint64_t(1) << ( index % 64UL ) );
+      }
+
+      size_t rank( 0UL );
+      for( size_t i=0UL; i<words; ++i ) {
+         ranks_[i] = rank;
+         rank += popcount( bits_[i] );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Intersect function**************************************************************************
+   /*!\brief Intersects the given sparse range with the fixed sparse range.
+   //
+   // \param l Iterator to the first element of the probing sparse range.
+   // \param lend Iterator one past the last element of the probing sparse range.
+   // \param both Operation for elements that are contained in both ranges.
+   // \return void
+   //
+   // This function calls the given operation with the iterators to both elements (first the
+   // element of the probing range, second the element of the fixed range) for all matching
+   // indices in the order of strictly increasing indices.
+   */
+   template< typename IT2    // Type of the probing iterator
+           , typename OP >   // Type of the common operation
+   inline void intersect( IT2 l, IT2 lend, OP both ) const
+   {
+      if( bits_.empty() ) {
+         mergeIntersection( l, lend, first_, last_, both );
+         return;
+      }
+
+      for( ; l!=lend; ++l )
+      {
+         const size_t   index( l->index() );
+         const uint64_t word ( bits_[index/64UL] );
+         const uint64_t bit  ( uint64_t(1) << ( index % 64UL ) );
+
+         if( word & bit ) {
+            both( l, element( first_, ranks_[index/64UL] + popcount( word & ( bit - 1UL ) ) ) );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Element function****************************************************************************
+   /*!\brief Returns the element of a contiguous fixed range at the given offset.
+   //
+   // \param first Pointer to the first element of the fixed range.
+   // \param offset The offset of the element.
+   // \return Pointer to the element at the given offset.
+   */
+   template< typename IT2 >  // Type of the sparse iterator of the fixed range
+   static inline auto element( IT2 first, size_t offset ) -> EnableIf_t< IsPointer_v<IT2>, IT2 >
+   {
+      return first + offset;
+   }
+   //**********************************************************************************************
+
+   //**Element function****************************************************************************
+   /*!\brief Returns the element of a non-contiguous fixed range at the given offset.
+   //
+   // \param first Iterator to the first element of the fixed range.
+   // \param offset The offset of the element.
+   // \return Iterator to the element at the given offset.
+   //
+   // This function is never called since no bitmap is created for non-contiguous ranges.
+   */
+   template< typename IT2 >  // Type of the sparse iterator of the fixed range
+   static inline auto element( IT2 first, size_t offset ) -> DisableIf_t< IsPointer_v<IT2>, IT2 >
+   {
+      for( ; offset; --offset ) ++first;
+      return first;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   IT first_;                    //!< Iterator to the first element of the fixed range.
+   IT last_;                     //!< Iterator one past the last element of the fixed range.
+   std::vector<uint64_t> bits_;  //!< The bitmap of all contained indices.
+   std::vector<size_t> ranks_;   //!< The number of contained indices preceding each bitmap word.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTERSECTIONPROBE UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an intersection probe for the given fixed sparse range.
+// \ingroup sparse
+//
+// \param first Iterator to the first element of the fixed sparse range.
+// \param last Iterator one past the last element of the fixed sparse range.
+// \param size The total number of indices (i.e. the size of the sparse vector).
+// \param bitmap \a true to create the index bitmap, \a false to use the merge kernels.
+// \return The intersection probe for the given sparse range.
+*/
+template< typename IT >  // Type of the sparse iterator of the fixed range
+inline IntersectionProbe<IT> makeIntersectionProbe( IT first, IT last, size_t size, bool bitmap )
+{
+   return IntersectionProbe<IT>( first, last, size, bitmap );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decides whether an intersection probe should use an index bitmap.
+// \ingroup sparse
+//
+// \param nonZeros The number of elements of the fixed sparse range.
+// \param size The total number of indices (i.e. the size of the sparse vector).
+// \param ranges The number of sparse ranges intersected with the fixed range.
+// \param total The total number of elements of all intersected sparse ranges.
+// \return \a true in case the index bitmap should be used, \a false if not.
+//
+// The bitmap pays off in case the fixed range contains more elements than an average probing
+// range, since the merge kernels traverse (or gallop through) the fixed range for every single
+// intersection, whereas the bitmap only touches the elements of the probing range. Additionally
+// the setup of the bitmap, which is linear in the number of its words, must be amortized by the
+// traversal of the probing ranges.
+*/
+inline bool useIntersectionBitmap( size_t nonZeros, size_t size, size_t ranges, size_t total ) noexcept
+{
+   return nonZeros * ranges > total && size / 64UL <= total;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
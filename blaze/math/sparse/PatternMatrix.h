@@ -0,0 +1,1816 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/PatternMatrix.h
+//  \brief Header file for the implementation of a pattern-only sparse matrix
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_PATTERNMATRIX_H_
+#define _BLAZE_MATH_SPARSE_PATTERNMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup pattern_matrix PatternMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a pattern-only \f$ M \times N \f$ compressed matrix.
+// \ingroup pattern_matrix
+//
+// The PatternMatrix class template is the representation of an arbitrary sized sparse matrix
+// that only stores the positions of its non-zero elements, but no values. All stored elements
+// have the implicit value \a true, all other elements are \a false. The storage order of the
+// matrix can be specified via the template parameter:
+
+   \code
+   template< bool SO >
+   class PatternMatrix;
+   \endcode
+
+//  - SO: specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//        The default value is blaze::rowMajor.
+//
+// Internally, the PatternMatrix uses the compressed row storage (CRS) format (in case of a
+// row-major matrix) or the compressed column storage (CCS) format (in case of a column-major
+// matrix) without the value array. In comparison to a \c CompressedMatrix<bool>, which stores
+// a value/index pair per non-zero element, the memory requirement is thus reduced by roughly
+// a factor of two. PatternMatrix is ideally suited to represent the structure of graphs, masks,
+// and the non-zero patterns of other sparse matrices:
+
+   \code
+   using blaze::PatternMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 100UL, 100UL );
+   // ... Initialization
+
+   PatternMatrix<> P( A );  // Extracting the non-zero pattern of A
+
+   DynamicVector<double> x( 100UL, 1.0 );
+   DynamicVector<double> y = P * x;  // Multiplication without any value loads
+   \endcode
+
+// The efficient setup of a PatternMatrix follows the same rules as the setup of a
+// CompressedMatrix: The matrix should be initialized row by row (or column by column in case
+// of a column-major matrix) by means of the reserve(), append(), and finalize() functions.
+*/
+template< bool SO = defaultStorageOrder >  // Storage order
+class PatternMatrix
+   : public Expression< SparseMatrix< PatternMatrix<SO>, SO > >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = PatternMatrix<SO>;     //!< Type of this PatternMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;  //!< Base type of this PatternMatrix instance.
+   using ResultType     = This;                   //!< Result type for expression template evaluations.
+   using OppositeType   = PatternMatrix<!SO>;     //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = PatternMatrix<!SO>;     //!< Transpose type for expression template evaluations.
+   using ElementType    = bool;                   //!< Type of the pattern matrix elements.
+   using ReturnType     = bool;                   //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;            //!< Data type for composite expression templates.
+   using Reference      = bool;                   //!< Reference to a pattern matrix element.
+   using ConstReference = bool;                   //!< Reference to a constant pattern matrix element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a compressed matrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompressedMatrix<NewType,SO>;  //!< The type of the other matrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a PatternMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = PatternMatrix<SO>;  //!< The type of the other PatternMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the pattern matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the pattern matrix.
+      using Element = ValueIndexPair<bool>;
+
+      using IteratorCategory = std::bidirectional_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                          //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                       //!< Pointer return type.
+      using ReferenceType    = ValueType&;                       //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline constexpr ConstIterator() noexcept
+         : pos_( nullptr )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param pos Pointer to the index of the initial element.
+      */
+      inline constexpr ConstIterator( const size_t* pos ) noexcept
+         : pos_( pos )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline constexpr ConstIterator& operator++() noexcept {
+         ++pos_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline constexpr ConstIterator operator++( int ) noexcept {
+         ConstIterator tmp( *this );
+         ++pos_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline constexpr ConstIterator& operator--() noexcept {
+         --pos_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline constexpr ConstIterator operator--( int ) noexcept {
+         ConstIterator tmp( *this );
+         --pos_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline constexpr const Element operator*() const noexcept {
+         return Element( true, *pos_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline constexpr const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline constexpr bool value() const noexcept {
+         return true;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline constexpr size_t index() const noexcept {
+         return *pos_;
+      }
+      //*******************************************************************************************
+
+      //**Base function****************************************************************************
+      /*!\brief Access to the current position of the iterator within the index array.
+      //
+      // \return Pointer to the current index.
+      */
+      inline constexpr const size_t* base() const noexcept {
+         return pos_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline constexpr bool operator==( const ConstIterator& rhs ) const noexcept {
+         return pos_ == rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline constexpr bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return pos_ != rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline constexpr DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return pos_ - rhs.pos_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const size_t* pos_;  //!< Pointer to the index of the current pattern matrix element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PatternMatrix();
+   explicit inline PatternMatrix( size_t m, size_t n );
+   explicit inline PatternMatrix( size_t m, size_t n, size_t nonzeros );
+
+   inline PatternMatrix( const PatternMatrix& m );
+   inline PatternMatrix( PatternMatrix&& m ) noexcept;
+
+   template< typename MT, bool SO2 >
+   inline PatternMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PatternMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PatternMatrix& operator=( const PatternMatrix& rhs );
+   inline PatternMatrix& operator=( PatternMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline PatternMatrix& operator=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset() noexcept;
+   inline void   reset( size_t i ) noexcept;
+   inline void   clear() noexcept;
+   inline void   resize( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t nonzeros );
+   inline void   shrinkToFit();
+   inline void   swap( PatternMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline ConstIterator set     ( size_t i, size_t j );
+   inline ConstIterator insert  ( size_t i, size_t j );
+   inline void          append  ( size_t i, size_t j, bool value=true, bool check=false );
+   inline void          finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void erase( size_t i, size_t j );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT >           inline void assign( const SparseMatrix<MT,SO>& rhs );
+   template< typename MT >           inline void assign( const SparseMatrix<MT,!SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t majorSize() const noexcept;
+   inline size_t minorSize() const noexcept;
+   inline void   reserveElements( size_t nonzeros );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the pattern matrix.
+   size_t  n_;         //!< The current number of columns of the pattern matrix.
+   size_t  capacity_;  //!< The current capacity of the index array.
+   size_t* begin_;     //!< Offsets of the first element of each row/column (plus one sentinel).
+   size_t* index_;     //!< The sorted column (row-major) or row (column-major) indices.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PatternMatrix.
+*/
+template< bool SO >  // Storage order
+inline PatternMatrix<SO>::PatternMatrix()
+   : m_       ( 0UL )                      // The current number of rows of the pattern matrix
+   , n_       ( 0UL )                      // The current number of columns of the pattern matrix
+   , capacity_( 0UL )                      // The current capacity of the index array
+   , begin_   ( allocate<size_t>( 1UL ) )  // Offsets of the first element of each row/column
+   , index_   ( nullptr )                  // The sorted column/row indices
+{
+   begin_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a pattern matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+*/
+template< bool SO >  // Storage order
+inline PatternMatrix<SO>::PatternMatrix( size_t m, size_t n )
+   : PatternMatrix( m, n, 0UL )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a pattern matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+*/
+template< bool SO >  // Storage order
+inline PatternMatrix<SO>::PatternMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( m )                                          // The current number of rows of the pattern matrix
+   , n_       ( n )                                          // The current number of columns of the pattern matrix
+   , capacity_( nonzeros )                                   // The current capacity of the index array
+   , begin_   ( allocate<size_t>( ( SO ? n : m ) + 1UL ) )   // Offsets of the first element of each row/column
+   , index_   ( nonzeros ? allocate<size_t>( nonzeros ) : nullptr )  // The sorted column/row indices
+{
+   std::fill( begin_, begin_+majorSize()+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PatternMatrix.
+//
+// \param m Pattern matrix to be copied.
+*/
+template< bool SO >  // Storage order
+inline PatternMatrix<SO>::PatternMatrix( const PatternMatrix& m )
+   : PatternMatrix( m.m_, m.n_, m.nonZeros() )
+{
+   std::copy( m.begin_, m.begin_+majorSize()+1UL, begin_ );
+   std::copy( m.index_, m.index_+m.nonZeros(), index_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for PatternMatrix.
+//
+// \param m The pattern matrix to be moved into this instance.
+*/
+template< bool SO >  // Storage order
+inline PatternMatrix<SO>::PatternMatrix( PatternMatrix&& m ) noexcept
+   : m_       ( m.m_        )  // The current number of rows of the pattern matrix
+   , n_       ( m.n_        )  // The current number of columns of the pattern matrix
+   , capacity_( m.capacity_ )  // The current capacity of the index array
+   , begin_   ( m.begin_    )  // Offsets of the first element of each row/column
+   , index_   ( m.index_    )  // The sorted column/row indices
+{
+   m.m_        = 0UL;
+   m.n_        = 0UL;
+   m.capacity_ = 0UL;
+   m.begin_    = nullptr;
+   m.index_    = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+//
+// The resulting pattern matrix contains the positions of all non-default elements of the
+// given matrix.
+*/
+template< bool SO >     // Storage order
+template< typename MT   // Type of the foreign matrix
+        , bool SO2 >    // Storage order of the foreign matrix
+inline PatternMatrix<SO>::PatternMatrix( const Matrix<MT,SO2>& m )
+   : PatternMatrix( (~m).rows(), (~m).columns() )
+{
+   blaze::assign( *this, ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PatternMatrix.
+*/
+template< bool SO >  // Storage order
+inline PatternMatrix<SO>::~PatternMatrix()
+{
+   deallocate( begin_ );
+   deallocate( index_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the pattern matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return \a true in case the element is contained in the pattern, \a false if not.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstReference
+   PatternMatrix<SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return find( i, j ) != end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the pattern matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return \a true in case the element is contained in the pattern, \a false if not.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstReference
+   PatternMatrix<SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid pattern matrix row/column access index" );
+   return ConstIterator( index_ + begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid pattern matrix row/column access index" );
+   return ConstIterator( index_ + begin_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PatternMatrix.
+//
+// \param rhs Pattern matrix to be copied.
+// \return Reference to the assigned pattern matrix.
+*/
+template< bool SO >  // Storage order
+inline PatternMatrix<SO>& PatternMatrix<SO>::operator=( const PatternMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   PatternMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for PatternMatrix.
+//
+// \param rhs The pattern matrix to be moved into this instance.
+// \return Reference to the assigned pattern matrix.
+*/
+template< bool SO >  // Storage order
+inline PatternMatrix<SO>& PatternMatrix<SO>::operator=( PatternMatrix&& rhs ) noexcept
+{
+   deallocate( begin_ );
+   deallocate( index_ );
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   index_    = rhs.index_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = nullptr;
+   rhs.index_    = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned pattern matrix.
+//
+// The pattern matrix is resized according to the given matrix and afterwards contains the
+// positions of all non-default elements of the given matrix.
+*/
+template< bool SO >     // Storage order
+template< typename MT   // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline PatternMatrix<SO>& PatternMatrix<SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   PatternMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the pattern matrix.
+//
+// \return The number of rows of the pattern matrix.
+*/
+template< bool SO >  // Storage order
+inline size_t PatternMatrix<SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the pattern matrix.
+//
+// \return The number of columns of the pattern matrix.
+*/
+template< bool SO >  // Storage order
+inline size_t PatternMatrix<SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the pattern matrix.
+//
+// \return The capacity of the pattern matrix.
+*/
+template< bool SO >  // Storage order
+inline size_t PatternMatrix<SO>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// Since all rows/columns of a pattern matrix are stored without gaps, the capacity of a
+// row/column corresponds to its number of non-zero elements.
+*/
+template< bool SO >  // Storage order
+inline size_t PatternMatrix<SO>::capacity( size_t i ) const noexcept
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the pattern matrix
+//
+// \return The number of non-zero elements in the pattern matrix.
+*/
+template< bool SO >  // Storage order
+inline size_t PatternMatrix<SO>::nonZeros() const noexcept
+{
+   return begin_[majorSize()];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< bool SO >  // Storage order
+inline size_t PatternMatrix<SO>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all elements from the pattern matrix. The dimensions and the capacity
+// of the matrix remain unchanged.
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::reset() noexcept
+{
+   std::fill( begin_, begin_+majorSize()+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::reset( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+
+   const size_t count( nonZeros( i ) );
+
+   if( count == 0UL ) return;
+
+   std::copy( index_+begin_[i+1UL], index_+nonZeros(), index_+begin_[i] );
+
+   for( size_t k=i+1UL; k<=majorSize(); ++k ) {
+      begin_[k] -= count;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the pattern matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the pattern matrix is 0.
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::clear() noexcept
+{
+   m_ = 0UL;
+   n_ = 0UL;
+   begin_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the pattern matrix.
+//
+// \param m The new number of rows of the pattern matrix.
+// \param n The new number of columns of the pattern matrix.
+// \param preserve \a true if the old elements of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. In case the
+// matrix is shrunk, all elements outside of the new dimensions are removed.
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::resize( size_t m, size_t n, bool preserve )
+{
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+
+   size_t* tmp( allocate<size_t>( major+1UL ) );
+   tmp[0UL] = 0UL;
+
+   if( preserve )
+   {
+      const size_t kmax( major < majorSize() ? major : majorSize() );
+      size_t pos( 0UL );
+
+      for( size_t k=0UL; k<kmax; ++k ) {
+         for( size_t l=begin_[k]; l<begin_[k+1UL]; ++l ) {
+            if( index_[l] < minor )
+               index_[pos++] = index_[l];
+         }
+         tmp[k+1UL] = pos;
+      }
+      std::fill( tmp+kmax+1UL, tmp+major+1UL, pos );
+   }
+   else
+   {
+      std::fill( tmp, tmp+major+1UL, 0UL );
+   }
+
+   std::swap( begin_, tmp );
+   deallocate( tmp );
+
+   m_ = m;
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the pattern matrix.
+//
+// \param nonzeros The new minimum capacity of the pattern matrix.
+// \return void
+//
+// This function increases the capacity of the pattern matrix to at least \a nonzeros elements.
+// The current elements of the matrix are preserved.
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity_ )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::shrinkToFit()
+{
+   if( nonZeros() < capacity_ )
+      reserveElements( nonZeros() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two pattern matrices.
+//
+// \param m The pattern matrix to be swapped.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::swap( PatternMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_, m.m_ );
+   swap( n_, m.n_ );
+   swap( capacity_, m.capacity_ );
+   swap( begin_, m.begin_ );
+   swap( index_, m.index_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows/columns.
+*/
+template< bool SO >  // Storage order
+inline size_t PatternMatrix<SO>::majorSize() const noexcept
+{
+   return SO ? n_ : m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns (row-major) or rows (column-major) of the matrix.
+//
+// \return The number of columns/rows.
+*/
+template< bool SO >  // Storage order
+inline size_t PatternMatrix<SO>::minorSize() const noexcept
+{
+   return SO ? m_ : n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reallocation of the index array to the given capacity.
+//
+// \param nonzeros The new capacity of the index array.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::reserveElements( size_t nonzeros )
+{
+   BLAZE_INTERNAL_ASSERT( nonzeros >= nonZeros(), "Invalid capacity detected" );
+
+   size_t* tmp( nonzeros ? allocate<size_t>( nonzeros ) : nullptr );
+   std::copy( index_, index_+nonZeros(), tmp );
+
+   std::swap( index_, tmp );
+   deallocate( tmp );
+   capacity_ = nonzeros;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding an element to the pattern matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element.
+// \exception std::invalid_argument Invalid pattern matrix access index.
+//
+// This function adds the element \f$ (i,j) \f$ to the pattern matrix. In case the element is
+// already contained in the pattern, the function has no effect.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::set( size_t i, size_t j )
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) )
+      return pos;
+
+   return insert( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the pattern matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid pattern matrix access index.
+//
+// This function inserts the element \f$ (i,j) \f$ into the pattern matrix. Duplicate elements
+// are not allowed. In case the pattern matrix already contains the element, a
+// \a std::invalid_argument exception is thrown. Note that the insertion of an element requires
+// all subsequent elements to be shifted. For the efficient setup of a pattern matrix, the
+// append() function should be preferred.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::insert( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   const size_t* const first( index_+begin_[k]     );
+   const size_t* const last ( index_+begin_[k+1UL] );
+   const size_t pos( std::lower_bound( first, last, l ) - index_ );
+
+   if( pos != begin_[k+1UL] && index_[pos] == l ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   if( nonZeros() == capacity_ ) {
+      reserveElements( capacity_ ? 2UL*capacity_ : 4UL );
+   }
+
+   std::copy_backward( index_+pos, index_+nonZeros(), index_+nonZeros()+1UL );
+   index_[pos] = l;
+
+   for( size_t k2=k+1UL; k2<=majorSize(); ++k2 ) {
+      ++begin_[k2];
+   }
+
+   return ConstIterator( index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the pattern matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value \a true if the element should be appended, \a false if not.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a pattern matrix with elements. It
+// appends the element \f$ (i,j) \f$ to the end of row \a i (row-major) or column \a j
+// (column-major) without any memory allocation. Therefore it is strictly necessary to keep
+// the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the pattern matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! After the last element of
+// a row/column has been appended, the row/column has to be finalized via the finalize()
+// function. For compatibility with CompressedMatrix, the function additionally accepts a
+// value. In case the value is \a false the element is not appended.
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::append( size_t i, size_t j, bool value, bool check )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( nonZeros() < capacity(), "Not enough reserved capacity left" );
+
+   MAYBE_UNUSED( check );
+
+   const size_t k( SO ? j : i );
+
+   BLAZE_USER_ASSERT( begin_[k+1UL] == begin_[k] || ( SO ? i : j ) > index_[begin_[k+1UL]-1UL]
+                    , "Index is not strictly increasing" );
+
+   if( value ) {
+      index_[begin_[k+1UL]++] = ( SO ? i : j );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a pattern matrix with
+// elements. After completion of row/column \a i via the append() function, this function can
+// be called to finalize row/column \a i and prepare the next row/column for insertion.
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+
+   if( i+1UL < majorSize() )
+      begin_[i+2UL] = begin_[i+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the pattern matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void PatternMatrix<SO>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( k ) ) return;
+
+   const size_t offset( pos.base() - index_ );
+   std::copy( index_+offset+1UL, index_+nonZeros(), index_+offset );
+
+   for( size_t k2=k+1UL; k2<=majorSize(); ++k2 ) {
+      --begin_[k2];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the element in case
+// the element is found, in case of a column-major matrix it returns a column iterator. In case
+// the element is not found the function returns the end() iterator of the row/column.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+
+   BLAZE_USER_ASSERT( k < majorSize(), "Invalid row/column access index" );
+
+   return ConstIterator( std::lower_bound( index_+begin_[k], index_+begin_[k+1UL], SO ? i : j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< bool SO >  // Storage order
+inline typename PatternMatrix<SO>::ConstIterator
+   PatternMatrix<SO>::upperBound( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+
+   BLAZE_USER_ASSERT( k < majorSize(), "Invalid row/column access index" );
+
+   return ConstIterator( std::upper_bound( index_+begin_[k], index_+begin_[k+1UL], SO ? i : j ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PatternMatrix<SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PatternMatrix<SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< bool SO >  // Storage order
+inline bool PatternMatrix<SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< bool SO >     // Storage order
+template< typename MT   // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void PatternMatrix<SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t major( majorSize() );
+   const size_t minor( minorSize() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<major; ++k ) {
+      for( size_t l=0UL; l<minor; ++l ) {
+         if( !isDefault( SO ? (~rhs)(l,k) : (~rhs)(k,l) ) )
+            ++nonzeros;
+      }
+   }
+
+   reset();
+   reserve( nonzeros );
+
+   for( size_t k=0UL; k<major; ++k ) {
+      for( size_t l=0UL; l<minor; ++l ) {
+         if( !isDefault( SO ? (~rhs)(l,k) : (~rhs)(k,l) ) )
+            index_[begin_[k+1UL]++] = l;
+      }
+      finalize( k );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< bool SO >     // Storage order
+template< typename MT > // Type of the right-hand side sparse matrix
+inline void PatternMatrix<SO>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t major( majorSize() );
+
+   reset();
+   reserve( (~rhs).nonZeros() );
+
+   for( size_t k=0UL; k<major; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         if( !isDefault( element->value() ) )
+            index_[begin_[k+1UL]++] = element->index();
+      }
+      finalize( k );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< bool SO >     // Storage order
+template< typename MT > // Type of the right-hand side sparse matrix
+inline void PatternMatrix<SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t major( majorSize() );
+   const size_t minor( minorSize() );
+
+   reset();
+   reserve( (~rhs).nonZeros() );
+
+   // Counting the number of elements per row/column
+   for( size_t l=0UL; l<minor; ++l ) {
+      for( auto element=(~rhs).begin(l); element!=(~rhs).end(l); ++element ) {
+         if( !isDefault( element->value() ) )
+            ++begin_[element->index()+1UL];
+      }
+   }
+
+   for( size_t k=0UL; k<major; ++k ) {
+      begin_[k+1UL] += begin_[k];
+   }
+
+   // Scattering the indices (in increasing order due to the outer loop)
+   for( size_t l=0UL; l<minor; ++l ) {
+      for( auto element=(~rhs).begin(l); element!=(~rhs).end(l); ++element ) {
+         if( !isDefault( element->value() ) )
+            index_[begin_[element->index()]++] = l;
+      }
+   }
+
+   for( size_t k=major; k>0UL; --k ) {
+      begin_[k] = begin_[k-1UL];
+   }
+   begin_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PATTERNMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PatternMatrix operators */
+//@{
+template< bool SO >
+void reset( PatternMatrix<SO>& m ) noexcept;
+
+template< bool SO >
+void reset( PatternMatrix<SO>& m, size_t i ) noexcept;
+
+template< bool SO >
+void clear( PatternMatrix<SO>& m ) noexcept;
+
+template< bool RF, bool SO >
+bool isDefault( const PatternMatrix<SO>& m ) noexcept;
+
+template< bool SO >
+bool isIntact( const PatternMatrix<SO>& m ) noexcept;
+
+template< bool SO >
+void swap( PatternMatrix<SO>& a, PatternMatrix<SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given pattern matrix.
+// \ingroup pattern_matrix
+//
+// \param m The pattern matrix to be resetted.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void reset( PatternMatrix<SO>& m ) noexcept
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the specified row/column of the given pattern matrix.
+// \ingroup pattern_matrix
+//
+// \param m The pattern matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void reset( PatternMatrix<SO>& m, size_t i ) noexcept
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given pattern matrix.
+// \ingroup pattern_matrix
+//
+// \param m The pattern matrix to be cleared.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void clear( PatternMatrix<SO>& m ) noexcept
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given pattern matrix is in default state.
+// \ingroup pattern_matrix
+//
+// \param m The pattern matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< bool RF    // Relaxation flag
+        , bool SO >  // Storage order
+inline bool isDefault( const PatternMatrix<SO>& m ) noexcept
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given pattern matrix are intact.
+// \ingroup pattern_matrix
+//
+// \param m The pattern matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the pattern matrix are intact, i.e. if its
+// state is valid. The invariants require that the number of elements does not exceed the
+// capacity and that the indices of each row/column are strictly increasing and in range.
+*/
+template< bool SO >  // Storage order
+inline bool isIntact( const PatternMatrix<SO>& m ) noexcept
+{
+   if( m.nonZeros() > m.capacity() )
+      return false;
+
+   const size_t major( SO ? m.columns() : m.rows() );
+   const size_t minor( SO ? m.rows() : m.columns() );
+
+   for( size_t k=0UL; k<major; ++k )
+   {
+      size_t last( 0UL );
+      bool first( true );
+
+      for( auto element=m.begin(k); element!=m.end(k); ++element ) {
+         if( element->index() >= minor || ( !first && element->index() <= last ) )
+            return false;
+         last  = element->index();
+         first = false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two pattern matrices.
+// \ingroup pattern_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< bool SO >  // Storage order
+inline void swap( PatternMatrix<SO>& a, PatternMatrix<SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a pattern matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup pattern_matrix
+//
+// \param mat The left-hand side pattern matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// Since all elements of a pattern matrix have the implicit value 1, the multiplication is
+// evaluated immediately by a pure gather (row-major) or scatter (column-major) of the
+// elements of the dense vector without any multiplication.
+*/
+template< bool SO        // Storage order of the left-hand side pattern matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline DynamicVector< ElementType_t<VT>, false >
+   operator*( const PatternMatrix<SO>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   CompositeType_t<VT> x( ~vec );
+   DynamicVector< ElementType_t<VT>, false > y( mat.rows(), ElementType_t<VT>() );
+
+   if( SO == rowMajor ) {
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         ElementType_t<VT> sum{};
+         for( auto element=mat.begin(i); element!=mat.end(i); ++element ) {
+            sum += x[element->index()];
+         }
+         y[i] = sum;
+      }
+   }
+   else {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         for( auto element=mat.begin(j); element!=mat.end(j); ++element ) {
+            y[element->index()] += x[j];
+         }
+      }
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense vector and a pattern matrix
+//        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+// \ingroup pattern_matrix
+//
+// \param vec The left-hand side transpose dense vector for the multiplication.
+// \param mat The right-hand side pattern matrix for the multiplication.
+// \return The resulting transpose dense vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , bool SO >    // Storage order of the right-hand side pattern matrix
+inline DynamicVector< ElementType_t<VT>, true >
+   operator*( const DenseVector<VT,true>& vec, const PatternMatrix<SO>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~vec).size() != mat.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   CompositeType_t<VT> x( ~vec );
+   DynamicVector< ElementType_t<VT>, true > y( mat.columns(), ElementType_t<VT>() );
+
+   if( SO == columnMajor ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         ElementType_t<VT> sum{};
+         for( auto element=mat.begin(j); element!=mat.end(j); ++element ) {
+            sum += x[element->index()];
+         }
+         y[j] = sum;
+      }
+   }
+   else {
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( auto element=mat.begin(i); element!=mat.end(i); ++element ) {
+            y[element->index()] += x[i];
+         }
+      }
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< bool SO >
+struct IsResizable< PatternMatrix<SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,736 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Reordering.h
+//  \brief Header file for the sparse matrix reordering functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_REORDERING_H_
+#define _BLAZE_MATH_SPARSE_REORDERING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/AsyncExecutor.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/views/Elements.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE MATRIX REORDERING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse matrix reordering functions */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+void rcm( const SparseMatrix<MT,SO>& A, DenseVector<VT,TF>& p );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void nestedDissection( const SparseMatrix<MT,SO>& A, DenseVector<VT,TF>& p );
+
+template< typename MT, bool SO, typename VT, bool TF >
+CompressedMatrix< ElementType_t<MT>, SO >
+   permute( const SparseMatrix<MT,SO>& A, const DenseVector<VT,TF>& p );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+decltype(auto) permute( DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& p );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+decltype(auto) permute( const DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& p );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary data structure for the adjacency graph of a square sparse matrix.
+// \ingroup sparse_matrix
+//
+// This data structure represents the undirected adjacency graph of the sparsity pattern of
+// \f$ A + A^T \f$ in compressed form. The neighbors of vertex \a i are stored in the range
+// \f$ [xadj_i..xadj_{i+1}) \f$ of the \a adj array. Self loops are not part of the graph.
+*/
+struct ReorderingGraph
+{
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the degree of the given vertex.
+   //
+   // \param i The index of the vertex.
+   // \return The number of neighbors of the vertex.
+   */
+   inline size_t degree( size_t i ) const noexcept {
+      return xadj[i+1UL] - xadj[i];
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<size_t> xadj;  //!< Offsets of the adjacency lists.
+   std::vector<size_t> adj;   //!< The concatenated adjacency lists.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the setup of the adjacency graph of a square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square sparse matrix.
+// \param G The resulting adjacency graph of \f$ A + A^T \f$.
+// \return void
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+void buildReorderingGraph( const SparseMatrix<MT,SO>& A, ReorderingGraph& G )
+{
+   CompositeType_t<MT> a( ~A );  // Evaluation of the sparse matrix operand
+
+   const size_t n( a.rows() );
+
+   G.xadj.assign( n+1UL, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=a.begin(i); element!=a.end(i); ++element ) {
+         if( element->index() != i ) {
+            ++G.xadj[i+1UL];
+            ++G.xadj[element->index()+1UL];
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      G.xadj[i+1UL] += G.xadj[i];
+   }
+
+   G.adj.resize( G.xadj[n] );
+
+   std::vector<size_t> pos( G.xadj.begin(), G.xadj.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=a.begin(i); element!=a.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( j != i ) {
+            G.adj[pos[i]++] = j;
+            G.adj[pos[j]++] = i;
+         }
+      }
+   }
+
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t begin( G.xadj[i] );
+      const size_t end  ( G.xadj[i+1UL] );
+
+      std::sort( G.adj.begin()+begin, G.adj.begin()+end );
+      G.xadj[i] = k;
+
+      for( size_t l=begin; l<end; ++l ) {
+         if( k == G.xadj[i] || G.adj[k-1UL] != G.adj[l] )
+            G.adj[k++] = G.adj[l];
+      }
+   }
+
+   G.xadj[n] = k;
+   G.adj.resize( k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the computation of the level structure rooted at a given vertex.
+// \ingroup sparse_matrix
+//
+// \param G The adjacency graph.
+// \param root The root vertex of the level structure.
+// \param part The partition labels of all vertices.
+// \param stamp The visitation stamps of all vertices.
+// \param s The visitation stamp of the current traversal.
+// \param order The resulting breadth-first order of all reachable vertices.
+// \param levels The resulting offsets of all levels within \a order.
+// \return void
+//
+// This function performs a breadth-first traversal of the adjacency graph starting at the given
+// root vertex. Only vertices with the same partition label as the root vertex are visited. The
+// \f$ k \f$-th level of the resulting level structure is given by the range
+// \f$ [levels_k..levels_{k+1}) \f$ of \a order.
+*/
+inline void levelStructure( const ReorderingGraph& G, size_t root, const std::vector<size_t>& part,
+                            std::vector<size_t>& stamp, size_t s,
+                            std::vector<size_t>& order, std::vector<size_t>& levels )
+{
+   const size_t label( part[root] );
+
+   order.clear();
+   levels.clear();
+
+   order.push_back( root );
+   stamp[root] = s;
+   levels.push_back( 0UL );
+
+   while( levels.back() < order.size() )
+   {
+      const size_t begin( levels.back() );
+      const size_t end  ( order.size() );
+
+      levels.push_back( end );
+
+      for( size_t k=begin; k<end; ++k ) {
+         const size_t v( order[k] );
+         for( size_t l=G.xadj[v]; l<G.xadj[v+1UL]; ++l ) {
+            const size_t w( G.adj[l] );
+            if( part[w] == label && stamp[w] != s ) {
+               stamp[w] = s;
+               order.push_back( w );
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the search of a pseudo-peripheral vertex.
+// \ingroup sparse_matrix
+//
+// \param G The adjacency graph.
+// \param root The initial vertex of the search.
+// \param part The partition labels of all vertices.
+// \param stamp The visitation stamps of all vertices.
+// \param s The current visitation stamp, which is updated by the function.
+// \param order The breadth-first order of the level structure rooted at the resulting vertex.
+// \param levels The level offsets of the level structure rooted at the resulting vertex.
+// \return The pseudo-peripheral vertex.
+//
+// This function implements the algorithm by George and Liu to find a vertex of approximately
+// maximum eccentricity within the connected component of the given initial vertex. The level
+// structure rooted at the resulting vertex is returned via \a order and \a levels.
+*/
+inline size_t pseudoPeripheralVertex( const ReorderingGraph& G, size_t root,
+                                      const std::vector<size_t>& part, std::vector<size_t>& stamp,
+                                      size_t& s, std::vector<size_t>& order, std::vector<size_t>& levels )
+{
+   std::vector<size_t> candidateOrder, candidateLevels;
+
+   levelStructure( G, root, part, stamp, ++s, order, levels );
+
+   while( true )
+   {
+      const size_t depth( levels.size() - 1UL );
+
+      size_t candidate( order[levels[depth-1UL]] );
+      for( size_t k=levels[depth-1UL]+1UL; k<levels[depth]; ++k ) {
+         if( G.degree( order[k] ) < G.degree( candidate ) )
+            candidate = order[k];
+      }
+
+      levelStructure( G, candidate, part, stamp, ++s, candidateOrder, candidateLevels );
+
+      if( candidateLevels.size() <= levels.size() )
+         return root;
+
+      root = candidate;
+      std::swap( order, candidateOrder );
+      std::swap( levels, candidateLevels );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the reverse Cuthill-McKee ordering of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square sparse matrix.
+// \param p The resulting permutation vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the reverse Cuthill-McKee (RCM) ordering of the given square sparse
+// matrix, which reduces the bandwidth and the profile of the matrix. The ordering is based on
+// the sparsity pattern of \f$ A + A^T \f$, i.e. the function can be used for both symmetric and
+// unsymmetric matrices. Each connected component of the adjacency graph is traversed starting
+// at a pseudo-peripheral vertex.
+//
+// The resulting permutation vector \a p is resized to the number of rows of \a A and contains
+// the old index of every new index, i.e. row/column \a i of the reordered matrix corresponds to
+// row/column \f$ p_i \f$ of the original matrix. The permutation can be applied to the matrix
+// and to vectors via the permute() functions:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL ), y;
+   blaze::DynamicVector<size_t> p;
+   // ... Initialization
+
+   rcm( A, p );
+
+   const blaze::CompressedMatrix<double> B( permute( A, p ) );  // B = P * A * trans(P)
+   const blaze::DynamicVector<double> xp( permute( x, p ) );      // xp = P * x
+
+   y.resize( 1000UL );
+   permute( y, p ) = B * xp;  // Equivalent to y = A * x
+   \endcode
+
+// In case the given matrix is not a square matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO      // Storage order of the sparse matrix
+        , typename VT  // Type of the permutation vector
+        , bool TF >    // Transpose flag of the permutation vector
+void rcm( const SparseMatrix<MT,SO>& A, DenseVector<VT,TF>& p )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   ReorderingGraph G;
+   buildReorderingGraph( ~A, G );
+
+   const std::vector<size_t> part( n, 0UL );
+   std::vector<size_t> stamp( n, 0UL ), order, levels;
+   std::vector<bool> visited( n, false );
+   std::vector<size_t> cm;
+   size_t s( 0UL );
+
+   cm.reserve( n );
+
+   const auto byDegree = [&G]( size_t v, size_t w ) {
+      return G.degree( v ) < G.degree( w ) || ( G.degree( v ) == G.degree( w ) && v < w );
+   };
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      if( visited[i] ) continue;
+
+      const size_t root( pseudoPeripheralVertex( G, i, part, stamp, s, order, levels ) );
+
+      size_t pos( cm.size() );
+      cm.push_back( root );
+      visited[root] = true;
+
+      while( pos < cm.size() )
+      {
+         const size_t v( cm[pos++] );
+         const size_t first( cm.size() );
+
+         for( size_t l=G.xadj[v]; l<G.xadj[v+1UL]; ++l ) {
+            const size_t w( G.adj[l] );
+            if( !visited[w] ) {
+               visited[w] = true;
+               cm.push_back( w );
+            }
+         }
+
+         std::sort( cm.begin()+first, cm.end(), byDegree );
+      }
+   }
+
+   resize( ~p, n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      (~p)[i] = cm[n-i-1UL];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the recursive dissection of a set of vertices.
+// \ingroup sparse_matrix
+//
+// \param G The adjacency graph.
+// \param vertices The vertices to be ordered, which all share the same partition label.
+// \param part The partition labels of all vertices.
+// \param labels The number of partition labels in use.
+// \param stamp The visitation stamps of all vertices.
+// \param s The current visitation stamp.
+// \param result The resulting ordering of all vertices.
+// \return void
+//
+// This function splits the given set of vertices into its connected components. Components
+// below a fixed size are ordered in reverse breadth-first order. All other components are
+// bisected by the median level of the level structure rooted at a pseudo-peripheral vertex.
+// Both halves are ordered recursively, the separating level is ordered last.
+*/
+inline void dissect( const ReorderingGraph& G, const std::vector<size_t>& vertices,
+                     std::vector<size_t>& part, size_t& labels, std::vector<size_t>& stamp,
+                     size_t& s, std::vector<size_t>& result )
+{
+   constexpr size_t leafsize( 64UL );
+
+   const size_t base( labels );
+
+   std::vector<size_t> order, levels;
+
+   for( size_t v : vertices )
+   {
+      if( part[v] >= base ) continue;
+
+      pseudoPeripheralVertex( G, v, part, stamp, s, order, levels );
+
+      for( size_t w : order ) {
+         part[w] = labels;
+      }
+      ++labels;
+
+      const size_t size ( order.size() );
+      const size_t depth( levels.size() - 1UL );
+
+      if( size <= leafsize || depth < 3UL ) {
+         result.insert( result.end(), order.rbegin(), order.rend() );
+         continue;
+      }
+
+      size_t median( 1UL );
+      while( median < depth-2UL && levels[median+1UL] < size/2UL ) {
+         ++median;
+      }
+
+      const std::vector<size_t> first ( order.begin(), order.begin() + levels[median] );
+      const std::vector<size_t> second( order.begin() + levels[median+1UL], order.end() );
+
+      for( size_t w : first ) {
+         part[w] = labels;
+      }
+      ++labels;
+
+      for( size_t w : second ) {
+         part[w] = labels;
+      }
+      ++labels;
+
+      for( size_t k=levels[median]; k<levels[median+1UL]; ++k ) {
+         part[order[k]] = labels;
+      }
+      ++labels;
+
+      dissect( G, first , part, labels, stamp, s, result );
+      dissect( G, second, part, labels, stamp, s, result );
+
+      result.insert( result.end(), order.begin() + levels[median], order.begin() + levels[median+1UL] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a nested dissection ordering of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square sparse matrix.
+// \param p The resulting permutation vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a graph partitioning based ordering of the given square sparse matrix.
+// The adjacency graph of \f$ A + A^T \f$ is recursively bisected by means of level structures
+// rooted at pseudo-peripheral vertices: The median level separates the remaining vertices into
+// two halves, which are ordered first, followed by the vertices of the separator. Small parts
+// are ordered in reverse Cuthill-McKee fashion. In contrast to the rcm() function, the resulting
+// ordering groups geometrically close vertices into contiguous blocks of rows, which improves
+// the cache reuse of the right-hand side vector in sparse matrix/vector multiplications.
+//
+// The resulting permutation vector \a p is resized to the number of rows of \a A and contains
+// the old index of every new index (see the rcm() function). In case the given matrix is not a
+// square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO      // Storage order of the sparse matrix
+        , typename VT  // Type of the permutation vector
+        , bool TF >    // Transpose flag of the permutation vector
+void nestedDissection( const SparseMatrix<MT,SO>& A, DenseVector<VT,TF>& p )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   ReorderingGraph G;
+   buildReorderingGraph( ~A, G );
+
+   std::vector<size_t> vertices( n ), part( n, 0UL ), stamp( n, 0UL ), result;
+   size_t labels( 1UL ), s( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      vertices[i] = i;
+   }
+
+   result.reserve( n );
+   dissect( G, vertices, part, labels, stamp, s, result );
+
+   BLAZE_INTERNAL_ASSERT( result.size() == n, "Invalid number of ordered vertices detected" );
+
+   resize( ~p, n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      (~p)[i] = result[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of the given square sparse matrix (\f$ P A P^T \f$).
+// \ingroup sparse_matrix
+//
+// \param A The given square sparse matrix.
+// \param p The permutation vector.
+// \return The permuted sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function returns the symmetric permutation \f$ B = P A P^T \f$ of the given square sparse
+// matrix, i.e. \f$ B_{ij} = A_{p_i p_j} \f$. The permutation vector \a p is expected to contain
+// the old index of every new index, as for instance computed by the rcm() and nestedDissection()
+// functions. In case a shared-memory parallelization is active and the number of non-zero elements
+// is larger or equal to the BLAZE_SMP_SMATPERMUTE_THRESHOLD, the rows (or columns in case of a
+// column-major matrix) of the result are gathered and sorted in parallel.
+//
+// In case the given matrix is not a square matrix or in case \a p is not a valid permutation of
+// the row indices of \a A, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO      // Storage order of the sparse matrix
+        , typename VT  // Type of the permutation vector
+        , bool TF >    // Transpose flag of the permutation vector
+CompressedMatrix< ElementType_t<MT>, SO >
+   permute( const SparseMatrix<MT,SO>& A, const DenseVector<VT,TF>& p )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+
+   waitForAsyncAssignments( ~A );
+   waitForAsyncAssignments( ~p );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~p).size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+   }
+
+   CompositeType_t<MT> a( ~A );  // Evaluation of the sparse matrix operand
+   CompositeType_t<VT> q( ~p );  // Evaluation of the permutation vector
+
+   const size_t n( a.rows() );
+
+   std::unique_ptr<size_t[]> inv   ( new size_t[n]     );
+   std::unique_ptr<size_t[]> offset( new size_t[n+1UL] );
+
+   std::fill( inv.get(), inv.get()+n, n );
+
+   offset[0UL] = 0UL;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t j( q[i] );
+      if( j >= n || inv[j] != n ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+      }
+      inv[j] = i;
+      offset[i+1UL] = offset[i] + a.nonZeros( j );
+   }
+
+   const size_t nonzeros( offset[n] );
+
+   std::unique_ptr< std::pair<size_t,ET>[] > elements( new std::pair<size_t,ET>[nonzeros] );
+
+   const size_t chunks( ( nonzeros >= smpThreshold( SMP_SMATPERMUTE ) && canSMPFor() )
+                        ?( min( getNumThreads(), n ) )
+                        :( 1UL ) );
+
+   // Splitting the rows into chunks of roughly the same number of non-zero elements
+   const auto bound = [&]( size_t k ) -> size_t
+   {
+      if( k == chunks ) return n;
+      return std::lower_bound( offset.get(), offset.get()+n, (k*nonzeros)/chunks ) - offset.get();
+   };
+
+   smpFor( chunks, [&]( size_t k )
+   {
+      const size_t end( bound(k+1UL) );
+
+      for( size_t i=bound(k); i<end; ++i )
+      {
+         auto* const first( elements.get() + offset[i] );
+         auto* last( first );
+
+         for( auto element=a.begin( q[i] ); element!=a.end( q[i] ); ++element, ++last ) {
+            last->first  = inv[element->index()];
+            last->second = element->value();
+         }
+
+         std::sort( first, last, []( const std::pair<size_t,ET>& lhs, const std::pair<size_t,ET>& rhs ) {
+            return lhs.first < rhs.first;
+         } );
+      }
+   } );
+
+   CompressedMatrix<ET,SO> B( n, n );
+   B.reserve( nonzeros );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t k=offset[i]; k<offset[i+1UL]; ++k ) {
+         B.append( ( SO ? elements[k].first : i ), ( SO ? i : elements[k].first ), elements[k].second );
+      }
+      B.finalize( i );
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the given dense vector (\f$ P x \f$).
+// \ingroup dense_vector
+//
+// \param x The given dense vector.
+// \param p The permutation vector.
+// \return View on the permuted dense vector.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function returns a view on the permutation \f$ P x \f$ of the given dense vector, i.e.
+// element \a i of the view refers to element \f$ p_i \f$ of \a x. The permutation vector \a p is
+// expected to contain the old index of every new index, as for instance computed by the rcm() and
+// nestedDissection() functions. Since the view is an lvalue, assigning to it applies the inverse
+// permutation:
+
+   \code
+   blaze::DynamicVector<double> x, y, z;
+   blaze::DynamicVector<size_t> p;
+   // ... Initialization
+
+   y = permute( x, p );  // y = P * x
+   permute( z, p ) = y;  // z = trans(P) * y, i.e. z == x
+   \endcode
+
+// Both the gather and the scatter operations are executed by means of the assignment kernels
+// of the elements() view and are therefore parallelized by the active SMP backend. In case any
+// index of \a p exceeds the size of \a x, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the dense vector
+        , bool TF1      // Transpose flag of the dense vector
+        , typename VT2  // Type of the permutation vector
+        , bool TF2 >    // Transpose flag of the permutation vector
+inline decltype(auto) permute( DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& p )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_t<VT2> q( ~p );  // Evaluation of the permutation vector
+
+   if( q.size() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+   }
+
+   return elements( ~x, q.data(), q.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the given constant dense vector (\f$ P x \f$).
+// \ingroup dense_vector
+//
+// \param x The given constant dense vector.
+// \param p The permutation vector.
+// \return View on the permuted dense vector.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function returns a view on the permutation \f$ P x \f$ of the given constant dense vector,
+// i.e. element \a i of the view refers to element \f$ p_i \f$ of \a x. In case any index of \a p
+// exceeds the size of \a x, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the dense vector
+        , bool TF1      // Transpose flag of the dense vector
+        , typename VT2  // Type of the permutation vector
+        , bool TF2 >    // Transpose flag of the permutation vector
+inline decltype(auto) permute( const DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& p )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_t<VT2> q( ~p );  // Evaluation of the permutation vector
+
+   if( q.size() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+   }
+
+   return elements( ~x, q.data(), q.size() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
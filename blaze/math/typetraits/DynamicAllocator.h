@@ -0,0 +1,169 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/DynamicAllocator.h
+//  \brief Header file for the DynamicAllocator type trait
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_DYNAMICALLOCATOR_H_
+#define _BLAZE_MATH_TYPETRAITS_DYNAMICALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+#include <blaze/util/typetraits/Void.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename, typename... > struct DynamicAllocatorHelper1;
+template< typename, typename, typename = void > struct DynamicAllocatorHelper2;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluation of the allocator of a dynamically allocated result type.
+// \ingroup math_type_traits
+//
+// This type trait evaluates the allocator type for the elements of type \a T of a dynamically
+// allocated vector or matrix that is created as the result of an operation on the given operand
+// types \a Ts. In case any of the given operand types provides a nested \a AllocatorType, the
+// allocator of the first of these operands is rebound to the element type \a T and reported
+// via the nested type \a Type. Else the default AlignedAllocator for type \a T is reported.
+// This way evaluation temporaries of the dynamic vectors and matrices (see for instance the
+// DynamicVector, DynamicMatrix, and CompressedMatrix class templates) use the same allocator
+// as their operands. Examples:
+
+   \code
+   using Alloc = MyAllocator<double>;
+
+   using Type1 = blaze::DynamicVector<double>;                     // Vector with default allocator
+   using Type2 = blaze::DynamicVector<double,columnVector,Alloc>;  // Vector with custom allocator
+
+   blaze::DynamicAllocator< int, Type1 >::Type         // corresponds to AlignedAllocator<int>
+   blaze::DynamicAllocator< int, Type2 >::Type         // corresponds to MyAllocator<int>
+   blaze::DynamicAllocator< int, Type1, Type2 >::Type  // corresponds to MyAllocator<int>
+   blaze::DynamicAllocator< int, double >::Type        // corresponds to AlignedAllocator<int>
+   \endcode
+*/
+template< typename T        // Type of the allocated elements
+        , typename... Ts >  // Types of the operands
+struct DynamicAllocator
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   using Type = typename DynamicAllocatorHelper1< T, RemoveCVRef_t<Ts>... >::Type;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary alias declaration for the DynamicAllocator type trait.
+// \ingroup math_type_traits
+//
+// The DynamicAllocator_t alias declaration provides a convenient shortcut to access the nested
+// \a Type of the DynamicAllocator class template. For instance, given the element type \a T and
+// the operand types \a T1 and \a T2 the following two type definitions are identical:
+
+   \code
+   using Type1 = typename blaze::DynamicAllocator<T,T1,T2>::Type;
+   using Type2 = blaze::DynamicAllocator_t<T,T1,T2>;
+   \endcode
+*/
+template< typename T        // Type of the allocated elements
+        , typename... Ts >  // Types of the operands
+using DynamicAllocator_t = typename DynamicAllocator<T,Ts...>::Type;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First auxiliary helper struct for the DynamicAllocator type trait.
+// \ingroup math_type_traits
+*/
+template< typename T, typename... Ts >
+struct DynamicAllocatorHelper1
+{
+   using Type = AlignedAllocator<T>;
+};
+
+template< typename T, typename U, typename... Ts >
+struct DynamicAllocatorHelper1<T,U,Ts...>
+{
+   using Type = typename If_t< DynamicAllocatorHelper2<T,U>::value
+                             , DynamicAllocatorHelper2<T,U>
+                             , DynamicAllocatorHelper1<T,Ts...> >::Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Second auxiliary helper struct for the DynamicAllocator type trait.
+// \ingroup math_type_traits
+*/
+template< typename T, typename U, typename >
+struct DynamicAllocatorHelper2
+{
+   static constexpr bool value = false;
+};
+
+template< typename T, typename U >
+struct DynamicAllocatorHelper2< T, U, Void_t< typename U::AllocatorType > >
+{
+   static constexpr bool value = true;
+
+   using Type = typename std::allocator_traits< typename U::AllocatorType >::template rebind_alloc<T>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
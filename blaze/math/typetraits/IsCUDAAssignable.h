@@ -46,6 +46,7 @@
 #include <blaze/math/typetraits/IsView.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/Void.h>
 #include <blaze/util/EnableIf.h>
 
@@ -138,7 +139,7 @@ struct IsCUDAAssignableHelper< T, Void_t< decltype( T::cudaAssignable ) > >
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-struct IsCUDAAssignableHelper_Expression < T, Void_t< EnableIf_t< IsExpression_v<T> > > >
+struct IsCUDAAssignableHelper_Expression < T, Void_t< EnableIf_t< IsExpression_v<T> && !IsSame_v< T, typename T::ResultType > > > >
    : public BoolConstant< IsCUDAAssignable_v< typename T::ResultType > >
 {};
 /*! \endcond */
@@ -43,6 +43,7 @@
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 
 
 namespace blaze {
@@ -115,7 +116,7 @@ struct IsSIMDCombinableHelper<T1,T2>
 */
 template< typename T1, typename T2, typename... Ts >
 struct IsSIMDCombinable
-   : public BoolConstant< IsSIMDCombinableHelper< T1, T2, Ts... >::value >
+   : public BoolConstant< IsSIMDCombinableHelper< RemoveCV_t<T1>, RemoveCV_t<T2>, RemoveCV_t<Ts>... >::value >
 {};
 //*************************************************************************************************
 
@@ -0,0 +1,153 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/TemporaryType.h
+//  \brief Header file for the TemporaryType type trait
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_TEMPORARYTYPE_H_
+#define _BLAZE_MATH_TYPETRAITS_TEMPORARYTYPE_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluation of the type of an evaluation temporary.
+// \ingroup math_type_traits
+//
+// The TemporaryType type trait evaluates the type of a temporary that is created internally
+// during the evaluation of an expression with the given result type \a T. In case the given
+// type is a dynamically allocated vector or matrix (DynamicVector, DynamicMatrix, ...), the
+// nested \a Type corresponds to the same vector or matrix type with a TemporaryAllocator, which
+// places the temporary in the arena of an active TemporaryScope. Else the given type is returned
+// as is. Note that cv-qualifiers are preserved.
+
+   \code
+   using blaze::DynamicVector;
+   using blaze::DynamicMatrix;
+   using blaze::StaticMatrix;
+   using blaze::TemporaryAllocator;
+
+   blaze::TemporaryType< DynamicVector<int> >::Type           // Results in 'DynamicVector<int,columnVector,TemporaryAllocator<int>>'
+   blaze::TemporaryType< const DynamicMatrix<double> >::Type  // Results in 'const DynamicMatrix<double,rowMajor,TemporaryAllocator<double>>'
+   blaze::TemporaryType< StaticMatrix<int,3UL,3UL> >::Type    // Results in 'StaticMatrix<int,3UL,3UL>'
+   blaze::TemporaryType< int >::Type                          // Results in 'int'
+   \endcode
+*/
+template< typename T >
+struct TemporaryType
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   using Type = T;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TemporaryType type trait for const types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct TemporaryType< const T >
+{
+ public:
+   //**********************************************************************************************
+   using Type = const typename TemporaryType<T>::Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TemporaryType type trait for volatile types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct TemporaryType< volatile T >
+{
+ public:
+   //**********************************************************************************************
+   using Type = volatile typename TemporaryType<T>::Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TemporaryType type trait for cv qualified types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct TemporaryType< const volatile T >
+{
+ public:
+   //**********************************************************************************************
+   using Type = const volatile typename TemporaryType<T>::Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary alias declaration for the TemporaryType type trait.
+// \ingroup math_type_traits
+//
+// The TemporaryType_t alias declaration provides a convenient shortcut to access the nested
+// \a Type of the TemporaryType class template. For instance, given the type \a T the following
+// two type definitions are identical:
+
+   \code
+   using Type1 = typename blaze::TemporaryType<T>::Type;
+   using Type2 = blaze::TemporaryType_t<T>;
+   \endcode
+*/
+template< typename T >
+using TemporaryType_t = typename TemporaryType<T>::Type;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
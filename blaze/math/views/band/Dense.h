@@ -60,6 +60,7 @@
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/BandTrait.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
@@ -1771,7 +1772,7 @@ template< typename MT          // Type of the dense matrix
         , ptrdiff_t... CBAs >  // Compile time band arguments
 inline bool Band<MT,TF,true,false,CBAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -63,6 +63,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/ColumnTrait.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
@@ -1495,7 +1496,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 inline bool Column<MT,true,true,SF,CCAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3847,7 +3848,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 inline bool Column<MT,false,true,false,CCAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5482,7 +5483,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 inline bool Column<MT,false,true,true,CCAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
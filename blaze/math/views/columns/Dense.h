@@ -60,6 +60,7 @@
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
@@ -1901,7 +1902,7 @@ template< typename MT         // Type of the dense matrix
         , typename... CCAs >  // Compile time column arguments
 inline bool Columns<MT,true,true,SF,CCAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() > smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5110,7 +5111,7 @@ template< typename MT         // Type of the dense matrix
         , typename... CCAs >  // Compile time column arguments
 inline bool Columns<MT,false,true,false,CCAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() > smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -6760,7 +6761,7 @@ template< typename MT         // Type of the dense matrix
         , typename... CCAs >  // Compile time column arguments
 inline bool Columns<MT,false,true,true,CCAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() > smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -58,6 +58,7 @@
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/ElementsTrait.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
@@ -1615,7 +1616,7 @@ template< typename VT         // Type of the dense vector
         , typename... CEAs >  // Compile time element arguments
 inline bool Elements<VT,TF,true,CEAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
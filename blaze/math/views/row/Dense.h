@@ -63,6 +63,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/RowTrait.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
@@ -1495,7 +1496,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CRAs >  // Compile time row arguments
 inline bool Row<MT,true,true,SF,CRAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3849,7 +3850,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CRAs >  // Compile time row arguments
 inline bool Row<MT,false,true,false,CRAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5484,7 +5485,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CRAs >  // Compile time row arguments
 inline bool Row<MT,false,true,true,CRAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
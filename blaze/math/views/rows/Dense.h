@@ -60,6 +60,7 @@
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/RowsTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
@@ -1896,7 +1897,7 @@ template< typename MT         // Type of the dense matrix
         , typename... CRAs >  // Compile time row arguments
 inline bool Rows<MT,true,true,SF,CRAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() > smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5102,7 +5103,7 @@ template< typename MT         // Type of the dense matrix
         , typename... CRAs >  // Compile time row arguments
 inline bool Rows<MT,false,true,false,CRAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() > smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -6753,7 +6754,7 @@ template< typename MT         // Type of the dense matrix
         , typename... CRAs >  // Compile time row arguments
 inline bool Rows<MT,false,true,true,CRAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() > smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -62,6 +62,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
@@ -2327,7 +2328,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 inline bool Submatrix<MT,unaligned,false,true,CSAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5572,7 +5573,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 inline bool Submatrix<MT,unaligned,true,true,CSAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -8439,7 +8440,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 inline bool Submatrix<MT,aligned,false,true,CSAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -11264,7 +11265,7 @@ template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 inline bool Submatrix<MT,aligned,true,true,CSAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() >= smpThreshold( SMP_DMATASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
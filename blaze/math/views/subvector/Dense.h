@@ -61,6 +61,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Thresholds.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/SubvectorTrait.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
@@ -1868,7 +1869,7 @@ template< typename VT       // Type of the dense vector
         , size_t... CSAs >  // Compile time subvector arguments
 inline bool Subvector<VT,unaligned,TF,true,CSAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3994,7 +3995,7 @@ template< typename VT       // Type of the dense vector
         , size_t... CSAs >  // Compile time subvector arguments
 inline bool Subvector<VT,aligned,TF,true,CSAs...>::canSMPAssign() const noexcept
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > smpThreshold( SMP_DVECASSIGN ) );
 }
 /*! \endcond */
 //*************************************************************************************************
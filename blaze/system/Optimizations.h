@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/config/Optimizations.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -57,9 +59,40 @@ constexpr bool usePadding               = BLAZE_USE_PADDING;
 constexpr bool useStreaming             = BLAZE_USE_STREAMING;
 constexpr bool useOptimizedKernels      = BLAZE_USE_OPTIMIZED_KERNELS;
 constexpr bool useDefaultInitialization = BLAZE_USE_DEFAULT_INITIALIZATION;
+constexpr bool useNUMAFirstTouch        = BLAZE_USE_NUMA_FIRST_TOUCH;
+constexpr bool useNUMAInterleave        = BLAZE_USE_NUMA_INTERLEAVE;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t useHugePages = BLAZE_USE_HUGE_PAGES;
+
+constexpr size_t hugePageThreshold = ( BLAZE_HUGE_PAGE_THRESHOLD < 2097152UL ? 2097152UL
+                                                                              : BLAZE_HUGE_PAGE_THRESHOLD );
 /*! \endcond */
 //*************************************************************************************************
 
 } // namespace blaze
 
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::useHugePages <= 2UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
 #endif
@@ -715,6 +715,48 @@ constexpr size_t SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix addition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATSMATADD_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a sparse matrix/sparse matrix addition with a dense
+// target matrix can be executed in parallel. In case the total number of non-zero elements of both
+// operands is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of non-zero elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSMATADD_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix subtraction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATSMATSUB_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a sparse matrix/sparse matrix subtraction with a dense
+// target matrix can be executed in parallel. In case the total number of non-zero elements of both
+// operands is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of non-zero elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSMATSUB_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix Schur product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATSMATSCHUR_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a sparse matrix/sparse matrix Schur product with a dense
+// target matrix can be executed in parallel. In case the total number of non-zero elements of both
+// operands is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of non-zero elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSMATSCHUR_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/row-major dense matrix multiplication threshold.
 // \ingroup config
@@ -967,57 +1009,212 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix permutation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATPERMUTE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the symmetric permutation of a sparse matrix can be
+// executed in parallel. In case the number of non-zero elements of the sparse matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATPERMUTE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP pattern-preserving sparse matrix assignment threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATASSIGN_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the pattern-preserving assignment of the values of a sparse
+// matrix can be executed in parallel. In case the number of non-zero elements of the target
+// matrix is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of non-zero elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATASSIGN_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECREDUCE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the reduction of a dense vector (as for instance via the
+// reduce(), sum(), prod(), min(), or max() functions) can be executed in parallel. In case the
+// number of elements of the dense vector is larger or equal to this threshold, the operation is
+// executed in parallel. If the number of elements is below this threshold the operation is
+// executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector norm threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECNORM_THRESHOLD while the Blaze debug mode
+// is active. It specifies when the norm of a dense vector (as for instance via the norm(),
+// l1Norm(), or lpNorm() functions) can be executed in parallel. In case the number of elements of
+// the dense vector is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECNORM_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECDVECINNER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the inner product of two dense vectors (as for instance via
+// the dot() function) can be executed in parallel. In case the number of elements of the dense
+// vectors is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECDVECINNER_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the total reduction of a dense matrix (as for instance
+// via the reduce(), sum(), prod(), min(), or max() functions) can be executed in parallel. In
+// case the number of elements of the dense matrix is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix norm threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATNORM_THRESHOLD while the Blaze debug mode
+// is active. It specifies when the norm of a dense matrix (as for instance via the norm(),
+// l1Norm(), or lpNorm() functions) can be executed in parallel. In case the number of elements of
+// the dense matrix is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATNORM_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SVECREDUCE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the reduction or the norm of a sparse vector can be executed
+// in parallel. In case the number of non-zero elements of the sparse vector is larger or equal to
+// this threshold, the operation is executed in parallel. If the number of non-zero elements is
+// below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SVECREDUCE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix total reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATTOTALREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the total reduction or the norm of a sparse matrix can
+// be executed in parallel. In case the number of non-zero elements of the sparse matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATTOTALREDUCE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix in-place transposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATTRANSPOSE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the in-place transposition of a square dense matrix
+// can be executed in parallel. In case the number of elements of the dense matrix is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATTRANSPOSE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
-constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    );
-constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECSUB_THRESHOLD    );
-constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   );
-constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    );
-constexpr size_t SMP_DVECDVECOUTER_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  );
-constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     );
-constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  );
-constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD );
-constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
-constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_DVECASSIGN_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD      : BLAZE_SMP_DVECASSIGN_THRESHOLD      );
+constexpr size_t SMP_DVECSCALARMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DVECSCALARMULT_THRESHOLD  );
+constexpr size_t SMP_DVECDVECADD_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD     : BLAZE_SMP_DVECDVECADD_THRESHOLD     );
+constexpr size_t SMP_DVECDVECSUB_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD     : BLAZE_SMP_DVECDVECSUB_THRESHOLD     );
+constexpr size_t SMP_DVECDVECMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECMULT_THRESHOLD    );
+constexpr size_t SMP_DVECDVECDIV_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD     : BLAZE_SMP_DVECDVECDIV_THRESHOLD     );
+constexpr size_t SMP_DVECDVECOUTER_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECOUTER_THRESHOLD   );
+constexpr size_t SMP_DMATDVECMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDVECMULT_THRESHOLD    );
+constexpr size_t SMP_TDMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDMATDVECMULT_THRESHOLD   );
+constexpr size_t SMP_TDVECDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDVECDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_DMATSVECMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DMATSVECMULT_THRESHOLD    );
+constexpr size_t SMP_TDMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDMATSVECMULT_THRESHOLD   );
+constexpr size_t SMP_TSVECDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSVECDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATDVECMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SMATDVECMULT_THRESHOLD    );
+constexpr size_t SMP_TSMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSMATDVECMULT_THRESHOLD   );
+constexpr size_t SMP_TDVECSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDVECSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATSVECMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SMATSVECMULT_THRESHOLD    );
+constexpr size_t SMP_TSMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSMATSVECMULT_THRESHOLD   );
+constexpr size_t SMP_TSVECSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSVECSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_DMATASSIGN_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD      : BLAZE_SMP_DMATASSIGN_THRESHOLD      );
+constexpr size_t SMP_DMATSCALARMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATSCALARMULT_THRESHOLD  );
+constexpr size_t SMP_DMATDMATADD_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD     : BLAZE_SMP_DMATDMATADD_THRESHOLD     );
+constexpr size_t SMP_DMATTDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATTDMATADD_THRESHOLD    );
+constexpr size_t SMP_DMATDMATSUB_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD     : BLAZE_SMP_DMATDMATSUB_THRESHOLD     );
+constexpr size_t SMP_DMATTDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATTDMATSUB_THRESHOLD    );
+constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD   );
+constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD  );
+constexpr size_t SMP_SMATSMATADD_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATADD_DEBUG_THRESHOLD     : BLAZE_SMP_SMATSMATADD_THRESHOLD     );
+constexpr size_t SMP_SMATSMATSUB_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATSUB_DEBUG_THRESHOLD     : BLAZE_SMP_SMATSMATSUB_THRESHOLD     );
+constexpr size_t SMP_SMATSMATSCHUR_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATSCHUR_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATSCHUR_THRESHOLD   );
+constexpr size_t SMP_DMATDMATMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATMULT_THRESHOLD    );
+constexpr size_t SMP_DMATTDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDMATDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_DMATSMATMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DMATSMATMULT_THRESHOLD    );
+constexpr size_t SMP_DMATTSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDMATSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATDMATMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SMATDMATMULT_THRESHOLD    );
+constexpr size_t SMP_SMATTDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATTDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSMATDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATSMATMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SMATSMATMULT_THRESHOLD    );
+constexpr size_t SMP_SMATTSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATTSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSMATSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_DMATREDUCE_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD      : BLAZE_SMP_DMATREDUCE_THRESHOLD      );
+constexpr size_t SMP_SMATREDUCE_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD      : BLAZE_SMP_SMATREDUCE_THRESHOLD      );
+constexpr size_t SMP_SMATPERMUTE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATPERMUTE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATPERMUTE_THRESHOLD     );
+constexpr size_t SMP_SMATASSIGN_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_SMATASSIGN_DEBUG_THRESHOLD      : BLAZE_SMP_SMATASSIGN_THRESHOLD      );
+constexpr size_t SMP_DVECREDUCE_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD      : BLAZE_SMP_DVECREDUCE_THRESHOLD      );
+constexpr size_t SMP_DVECNORM_THRESHOLD        = ( BLAZE_DEBUG_MODE ? SMP_DVECNORM_DEBUG_THRESHOLD        : BLAZE_SMP_DVECNORM_THRESHOLD        );
+constexpr size_t SMP_DVECDVECINNER_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECINNER_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECINNER_THRESHOLD   );
+constexpr size_t SMP_DMATTOTALREDUCE_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD );
+constexpr size_t SMP_DMATNORM_THRESHOLD        = ( BLAZE_DEBUG_MODE ? SMP_DMATNORM_DEBUG_THRESHOLD        : BLAZE_SMP_DMATNORM_THRESHOLD        );
+constexpr size_t SMP_SVECREDUCE_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_SVECREDUCE_DEBUG_THRESHOLD      : BLAZE_SMP_SVECREDUCE_THRESHOLD      );
+constexpr size_t SMP_SMATTOTALREDUCE_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_SMATTOTALREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_SMATTOTALREDUCE_THRESHOLD );
+constexpr size_t SMP_DMATTRANSPOSE_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTRANSPOSE_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTRANSPOSE_THRESHOLD   );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1045,55 +1242,68 @@ BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
 
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATADD_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATSUB_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATSCHUR_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATPERMUTE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATASSIGN_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECNORM_THRESHOLD        >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECINNER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTOTALREDUCE_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATNORM_THRESHOLD        >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SVECREDUCE_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTOTALREDUCE_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTRANSPOSE_THRESHOLD   >= 0UL );
 
 }
 /*! \endcond */
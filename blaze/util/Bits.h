@@ -0,0 +1,150 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Bits.h
+//  \brief Header file for bit manipulation functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_BITS_H_
+#define _BLAZE_UTIL_BITS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Compiler.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_MSC_COMPILER
+#  include <intrin.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BIT MANIPULATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Counts the number of set bits in the given 64-bit word.
+// \ingroup util
+//
+// \param word The word to be inspected.
+// \return The number of set bits in \a word.
+//
+// This function returns the population count of the given 64-bit word. In case the compiler
+// provides a corresponding intrinsic, the population count is computed via a single POPCNT
+// instruction (given that the target architecture supports it).
+*/
+BLAZE_ALWAYS_INLINE size_t popcount( uint64_t word ) noexcept
+{
+#if BLAZE_MSC_COMPILER && defined(_M_X64)
+   return static_cast<size_t>( __popcnt64( word ) );
+#elif BLAZE_MSC_COMPILER
+   return static_cast<size_t>( __popcnt( static_cast<uint32_t>( word       ) ) +
+                               __popcnt( static_cast<uint32_t>( word >> 32 ) ) );
+#else
+   return static_cast<size_t>( __builtin_popcountll( word ) );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counts the number of trailing zero bits in the given 64-bit word.
+// \ingroup util
+//
+// \param word The word to be inspected. The word must not be zero.
+// \return The index of the least significant set bit in \a word.
+//
+// This function returns the number of trailing zero bits of the given 64-bit word, i.e. the
+// index of the least significant set bit. Note that the result is undefined in case \a word
+// is zero!
+*/
+BLAZE_ALWAYS_INLINE size_t ctz( uint64_t word ) noexcept
+{
+#if BLAZE_MSC_COMPILER && defined(_M_X64)
+   unsigned long index( 0UL );
+   _BitScanForward64( &index, word );
+   return static_cast<size_t>( index );
+#elif BLAZE_MSC_COMPILER
+   unsigned long index( 0UL );
+   if( _BitScanForward( &index, static_cast<uint32_t>( word ) ) )
+      return static_cast<size_t>( index );
+   _BitScanForward( &index, static_cast<uint32_t>( word >> 32 ) );
+   return static_cast<size_t>( index ) + 32UL;
+#else
+   return static_cast<size_t>( __builtin_ctzll( word ) );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counts the number of set bits in the given range of 64-bit words.
+// \ingroup util
+//
+// \param words Pointer to the first word of the range.
+// \param n The number of words in the range.
+// \return The total number of set bits in the range.
+//
+// This function returns the total population count of the given range of 64-bit words. In
+// order to hide the latency of the POPCNT instruction and to break the dependency chain on
+// a single accumulator, the loop is unrolled by a factor of four with separate accumulators.
+*/
+inline size_t popcount( const uint64_t* words, size_t n ) noexcept
+{
+   const size_t ipos( n & size_t(-4) );
+
+   size_t c1( 0UL ), c2( 0UL ), c3( 0UL ), c4( 0UL );
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=4UL ) {
+      c1 += popcount( words[i    ] );
+      c2 += popcount( words[i+1UL] );
+      c3 += popcount( words[i+2UL] );
+      c4 += popcount( words[i+3UL] );
+   }
+   for( ; i<n; ++i ) {
+      c1 += popcount( words[i] );
+   }
+
+   return c1 + c2 + c3 + c4;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,967 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ConcurrentMemoryPool.h
+//  \brief Header file for the thread-safe memory pool
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_CONCURRENTMEMORYPOOL_H_
+#define _BLAZE_UTIL_CONCURRENTMEMORYPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THREAD INDICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Registry for the indices of all live threads.
+// \ingroup util
+//
+// The ThreadIndexRegistry assigns a small, unique index to every thread that requests one. The
+// index of a terminated thread is handed to the next thread requesting an index. Therefore the
+// indices of all live threads are always in the range \f$ [0..N) \f$, where \a N is the maximum
+// number of simultaneously live threads.
+*/
+class ThreadIndexRegistry
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The default constructor for ThreadIndexRegistry.
+   */
+   explicit inline ThreadIndexRegistry()
+      : mutex_()       // Synchronization mutex
+      , free_ ()       // The indices of all terminated threads
+      , count_( 0UL )  // The total number of assigned indices
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Acquires an index for the calling thread.
+   //
+   // \return The index of the calling thread.
+   */
+   inline size_t acquire() {
+      std::lock_guard<std::mutex> lock( mutex_ );
+      if( free_.empty() )
+         return count_++;
+      const size_t index( free_.back() );
+      free_.pop_back();
+      return index;
+   }
+
+   /*!\brief Releases the given index of a terminating thread.
+   //
+   // \param index The index to be released.
+   // \return void
+   */
+   inline void release( size_t index ) noexcept {
+      std::lock_guard<std::mutex> lock( mutex_ );
+      try {
+         free_.push_back( index );
+      }
+      catch( ... ) {}
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   std::mutex          mutex_;  //!< Synchronization mutex.
+   std::vector<size_t> free_;   //!< The indices of all terminated threads.
+   size_t              count_;  //!< The total number of assigned indices.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the global registry of thread indices.
+// \ingroup util
+//
+// \return Reference to the global registry of thread indices.
+//
+// The registry is intentionally never destroyed since threads may terminate (and release their
+// indices) after the destruction of all static objects.
+*/
+inline ThreadIndexRegistry& theThreadIndexRegistry()
+{
+   static ThreadIndexRegistry* registry( new ThreadIndexRegistry() );
+   return *registry;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the calling thread.
+// \ingroup util
+//
+// \return The index of the calling thread.
+//
+// This function returns a small index that is unique among all live threads. The index is
+// acquired on the first call of a thread and released when the thread terminates.
+*/
+inline size_t getThreadIndex()
+{
+   struct Index
+   {
+      inline Index() : value_( theThreadIndexRegistry().acquire() ) {}
+      inline ~Index() { theThreadIndexRegistry().release( value_ ); }
+      size_t value_;
+   };
+
+   thread_local Index index;
+   return index.value_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-safe memory pool for small objects.
+// \ingroup util
+//
+// The ConcurrentMemoryPool is the thread-safe counterpart of the MemoryPool class template. It
+// provides raw memory for objects of type \a Type, which can be allocated and released by any
+// number of threads. In particular, an object can be released by a different thread than the
+// one that allocated it. The pool is organized in three layers:
+//
+//  - Each thread owns a cache of two \a magazines, i.e. lists of up to \a MagazineSize free
+//    objects. As long as the cache can serve a request, allocations and deallocations neither
+//    require synchronization nor atomic read-modify-write operations.
+//  - Full magazines are exchanged with a global \a depot, which is implemented as a lock-free
+//    stack. Thus a thread only synchronizes with other threads once every \a MagazineSize
+//    allocations or deallocations.
+//  - New memory is allocated in blocks of \a Blocksize objects, which are released only on
+//    destruction of the pool.
+//
+// Threads are assigned to caches based on a small, unique thread index. The cache of a
+// terminated thread, including all its free objects, is inherited by the next thread that is
+// assigned the same index. In case more than \a maxThreads threads are simultaneously using
+// the pool, the additional threads share a single free list that is protected by a mutex.
+//
+// The following example demonstrates the use of the ConcurrentMemoryPool:
+
+   \code
+   blaze::ConcurrentMemoryPool<Task,1024UL> pool;
+
+   void* raw = pool.malloc();  // Can be called by any thread
+   Task* task = new( raw ) Task();
+   // ... Passing the task to another thread
+   task->~Task();
+   pool.free( task );          // Can be called by any thread
+
+   const auto stats( pool.getStatistics() );
+   \endcode
+*/
+template< typename Type                 // Type of the allocated objects
+        , size_t Blocksize              // Number of objects per memory block
+        , size_t MagazineSize = 32UL >  // Number of objects per magazine
+class ConcurrentMemoryPool
+   : private NonCopyable
+{
+ public:
+   //**Compile time constants**********************************************************************
+   //! Maximum number of threads with a thread-local cache.
+   static constexpr size_t maxThreads = 256UL;
+   //**********************************************************************************************
+
+   //**struct Statistics***************************************************************************
+   /*!\brief Usage statistics of the memory pool.
+   */
+   struct Statistics
+   {
+      size_t blocks;            //!< Number of allocated memory blocks.
+      size_t capacity;          //!< Total number of objects in all memory blocks.
+      size_t allocations;       //!< Total number of allocations.
+      size_t deallocations;     //!< Total number of deallocations.
+      size_t depotTransfers;    //!< Number of magazines exchanged with the global depot.
+      size_t sharedOperations;  //!< Number of operations performed under the pool mutex.
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline ConcurrentMemoryPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ConcurrentMemoryPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   inline void* malloc();
+   inline void  free( void* rawMemory ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Statistics getStatistics() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**union FreeObject****************************************************************************
+   /*!\brief A single element of the free lists of the memory pool.
+   */
+   union FreeObject {
+      FreeObject* next_;  //!< Pointer to the next free object.
+      std::aligned_storage_t< sizeof(Type), alignof(Type) > dummy_;  //!< Storage for a single object.
+   };
+   //**********************************************************************************************
+
+   //**struct Magazine*****************************************************************************
+   /*!\brief Descriptor of a full magazine stored in the global depot.
+   */
+   struct Magazine
+   {
+      FreeObject*           head_;  //!< The first free object of the magazine.
+      std::atomic<uint32_t> next_;  //!< Index of the next magazine in the stack.
+   };
+   //**********************************************************************************************
+
+   //**struct Cache********************************************************************************
+   /*!\brief Thread-local cache of the memory pool.
+   //
+   // The cache consists of the loaded magazine, which holds between 0 and \a MagazineSize free
+   // objects, and the previous magazine, which is either empty or full. The statistics counters
+   // are only modified by the owning thread, but can be read by any thread.
+   */
+   struct Cache
+   {
+      FreeObject*         loaded_;          //!< The currently loaded magazine.
+      size_t              loadedCount_;     //!< The number of objects in the loaded magazine.
+      FreeObject*         previous_;        //!< The previously loaded magazine.
+      size_t              previousCount_;   //!< The number of objects in the previous magazine.
+      std::atomic<size_t> allocations_;     //!< Number of allocations via the cache.
+      std::atomic<size_t> deallocations_;   //!< Number of deallocations via the cache.
+      std::atomic<size_t> transfers_;       //!< Number of magazines exchanged with the depot.
+      byte_t              padding_[64UL];   //!< Padding to avoid false sharing between caches.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Stack = std::atomic<uint64_t>;  //!< Head of a lock-free stack of magazine descriptors.
+   //**********************************************************************************************
+
+   //**Compile time constants**********************************************************************
+   static constexpr size_t segmentSize = 64UL;  //!< Number of descriptors in the first segment.
+   static constexpr size_t maxSegments = 24UL;  //!< Maximum number of descriptor segments.
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   inline Cache* getCache() noexcept;
+   inline void   refill( Cache& cache );
+   inline void   flush( FreeObject* magazine ) noexcept;
+   inline void*  mallocShared();
+   inline void   freeShared( FreeObject* objects, FreeObject* last ) noexcept;
+   inline void   allocateBlock();
+   //@}
+   //**********************************************************************************************
+
+   //**Depot functions*****************************************************************************
+   /*!\name Depot functions */
+   //@{
+   inline Magazine& getMagazine( uint32_t index ) const noexcept;
+   inline uint32_t  createMagazines() noexcept;
+   inline void      push( Stack& stack, uint32_t index ) noexcept;
+   inline uint32_t  pop( Stack& stack ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void increment( std::atomic<size_t>& counter ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Stack depot_;  //!< Lock-free stack of full magazines.
+   Stack spare_;  //!< Lock-free stack of unused magazine descriptors.
+
+   std::atomic<Magazine*> segments_[maxSegments];  //!< Segments of magazine descriptors.
+   std::atomic<Cache*>    caches_[maxThreads];     //!< Thread-local caches of the memory pool.
+
+   mutable std::mutex       mutex_;           //!< Synchronization mutex for the shared state.
+   std::vector<FreeObject*> blocks_;          //!< Vector of available memory blocks.
+   size_t                   numSegments_;     //!< Number of allocated descriptor segments.
+   FreeObject*              shared_;          //!< Shared list of free objects.
+   size_t                   sharedAllocs_;    //!< Number of allocations from the shared list.
+   size_t                   sharedDeallocs_;  //!< Number of deallocations to the shared list.
+   size_t                   sharedOps_;       //!< Number of operations on the shared list.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( Blocksize > 0UL );
+   BLAZE_STATIC_ASSERT( MagazineSize > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor of the concurrent memory pool.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::ConcurrentMemoryPool()
+   : depot_         ( 0UL )      // Lock-free stack of full magazines
+   , spare_         ( 0UL )      // Lock-free stack of unused magazine descriptors
+   , mutex_         ()           // Synchronization mutex for the shared state
+   , blocks_        ()           // Vector of available memory blocks
+   , numSegments_   ( 0UL )      // Number of allocated descriptor segments
+   , shared_        ( nullptr )  // Shared list of free objects
+   , sharedAllocs_  ( 0UL )      // Number of allocations from the shared list
+   , sharedDeallocs_( 0UL )      // Number of deallocations to the shared list
+   , sharedOps_     ( 0UL )      // Number of operations on the shared list
+{
+   for( size_t s=0UL; s<maxSegments; ++s ) {
+      segments_[s].store( nullptr, std::memory_order_relaxed );
+   }
+
+   for( size_t i=0UL; i<maxThreads; ++i ) {
+      caches_[i].store( nullptr, std::memory_order_relaxed );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the concurrent memory pool.
+//
+// The destructor releases all memory blocks of the memory pool. Note that at this point no
+// object allocated from the pool must be in use anymore.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::~ConcurrentMemoryPool()
+{
+   for( size_t i=0UL; i<maxThreads; ++i ) {
+      delete caches_[i].load( std::memory_order_relaxed );
+   }
+
+   for( size_t s=0UL; s<numSegments_; ++s ) {
+      delete [] segments_[s].load( std::memory_order_relaxed );
+   }
+
+   for( FreeObject* block : blocks_ ) {
+      deallocate_backend( block );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of raw memory for an object of type \a Type.
+//
+// \return Pointer to the raw memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function returns raw memory for a single object of type \a Type. It can be called by
+// any thread.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void* ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::malloc()
+{
+   Cache* const cache( getCache() );
+
+   if( cache == nullptr )
+      return mallocShared();
+
+   if( cache->loadedCount_ == 0UL )
+   {
+      if( cache->previousCount_ > 0UL ) {
+         std::swap( cache->loaded_, cache->previous_ );
+         std::swap( cache->loadedCount_, cache->previousCount_ );
+      }
+      else {
+         refill( *cache );
+      }
+   }
+
+   FreeObject* const ptr( cache->loaded_ );
+   cache->loaded_ = ptr->next_;
+   --cache->loadedCount_;
+   increment( cache->allocations_ );
+
+   return ptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of raw memory for an object of type \a Type.
+//
+// \param rawMemory Pointer to the raw memory.
+// \return void
+//
+// This function returns the given memory to the pool. It can be called by any thread, i.e. in
+// particular also by a different thread than the one that allocated the memory.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::free( void* rawMemory ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( rawMemory != nullptr, "Invalid memory detected" );
+
+   FreeObject* const ptr( reinterpret_cast<FreeObject*>( rawMemory ) );
+   Cache* const cache( getCache() );
+
+   if( cache == nullptr ) {
+      std::lock_guard<std::mutex> lock( mutex_ );
+      ptr->next_ = shared_;
+      shared_ = ptr;
+      ++sharedDeallocs_;
+      ++sharedOps_;
+      return;
+   }
+
+   if( cache->loadedCount_ == MagazineSize )
+   {
+      if( cache->previousCount_ > 0UL ) {
+         flush( cache->previous_ );
+         increment( cache->transfers_ );
+      }
+
+      cache->previous_      = cache->loaded_;
+      cache->previousCount_ = cache->loadedCount_;
+      cache->loaded_        = nullptr;
+      cache->loadedCount_   = 0UL;
+   }
+
+   ptr->next_ = cache->loaded_;
+   cache->loaded_ = ptr;
+   ++cache->loadedCount_;
+   increment( cache->deallocations_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the cache of the calling thread.
+//
+// \return Pointer to the cache of the calling thread, \a nullptr if no cache is available.
+//
+// This function returns the cache of the calling thread. In case the calling thread does not
+// have a cache yet, a new cache is created. In case the index of the calling thread exceeds
+// the maximum number of threads or in case no cache can be created, the function returns
+// \a nullptr.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline typename ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::Cache*
+   ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::getCache() noexcept
+{
+   size_t index( maxThreads );
+
+   try {
+      index = getThreadIndex();
+   }
+   catch( ... ) {}
+
+   if( index >= maxThreads )
+      return nullptr;
+
+   Cache* cache( caches_[index].load( std::memory_order_acquire ) );
+
+   if( cache == nullptr ) {
+      cache = new( std::nothrow ) Cache();
+      caches_[index].store( cache, std::memory_order_release );
+   }
+
+   return cache;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Refilling the loaded magazine of the given cache.
+//
+// \param cache The cache to be refilled.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function loads a full magazine from the global depot into the given cache. In case the
+// depot is empty, the objects are taken from the shared list of free objects. In case the shared
+// list is empty, too, a new memory block is allocated.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::refill( Cache& cache )
+{
+   BLAZE_INTERNAL_ASSERT( cache.loadedCount_ == 0UL, "Invalid loaded magazine detected" );
+
+   const uint32_t index( pop( depot_ ) );
+
+   if( index != 0U ) {
+      Magazine& magazine( getMagazine( index ) );
+      cache.loaded_      = magazine.head_;
+      cache.loadedCount_ = MagazineSize;
+      push( spare_, index );
+      increment( cache.transfers_ );
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   if( shared_ == nullptr ) {
+      allocateBlock();
+   }
+
+   FreeObject* last( shared_ );
+   size_t count( 1UL );
+
+   while( count < MagazineSize && last->next_ != nullptr ) {
+      last = last->next_;
+      ++count;
+   }
+
+   cache.loaded_      = shared_;
+   cache.loadedCount_ = count;
+   shared_            = last->next_;
+   last->next_        = nullptr;
+   ++sharedOps_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the given full magazine to the global depot.
+//
+// \param magazine The first object of the full magazine.
+// \return void
+//
+// This function pushes the given full magazine on the global depot. In case no magazine
+// descriptor can be provided, the objects are moved to the shared list of free objects.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::flush( FreeObject* magazine ) noexcept
+{
+   uint32_t index( pop( spare_ ) );
+
+   if( index == 0U ) {
+      index = createMagazines();
+   }
+
+   if( index == 0U ) {
+      FreeObject* last( magazine );
+      while( last->next_ != nullptr ) {
+         last = last->next_;
+      }
+      freeShared( magazine, last );
+      return;
+   }
+
+   getMagazine( index ).head_ = magazine;
+   push( depot_, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of raw memory for threads without cache.
+//
+// \return Pointer to the raw memory.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void* ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::mallocShared()
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   if( shared_ == nullptr )
+   {
+      const uint32_t index( pop( depot_ ) );
+
+      if( index != 0U ) {
+         shared_ = getMagazine( index ).head_;
+         push( spare_, index );
+      }
+      else {
+         allocateBlock();
+      }
+   }
+
+   FreeObject* const ptr( shared_ );
+   shared_ = ptr->next_;
+   ++sharedAllocs_;
+   ++sharedOps_;
+
+   return ptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the given list of free objects to the shared list.
+//
+// \param objects The first object of the list.
+// \param last The last object of the list.
+// \return void
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::freeShared( FreeObject* objects, FreeObject* last ) noexcept
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   last->next_ = shared_;
+   shared_ = objects;
+   ++sharedOps_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of a new memory block.
+//
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates a new memory block for \a Blocksize objects and prepends all objects
+// to the shared list of free objects. It must only be called while the pool mutex is locked.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::allocateBlock()
+{
+   blocks_.reserve( blocks_.size() + 1UL );
+
+   FreeObject* const block( reinterpret_cast<FreeObject*>(
+      allocate_backend( Blocksize*sizeof(FreeObject), alignof(FreeObject) ) ) );
+
+   for( size_t i=0UL; i<Blocksize-1UL; ++i ) {
+      block[i].next_ = &block[i+1UL];
+   }
+   block[Blocksize-1UL].next_ = shared_;
+
+   shared_ = block;
+   blocks_.push_back( block );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEPOT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the magazine descriptor with the given index.
+//
+// \param index The index of the magazine descriptor (starting with 1).
+// \return Reference to the magazine descriptor.
+//
+// The magazine descriptors are stored in segments of increasing size: segment \a s holds
+// \f$ 64 \cdot 2^s \f$ descriptors. Since segments are never moved or released before the
+// destruction of the pool, descriptors can be safely accessed by any thread.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline typename ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::Magazine&
+   ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::getMagazine( uint32_t index ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( index != 0U, "Invalid magazine index detected" );
+
+   const size_t i( index - 1UL );
+   size_t q( i / segmentSize + 1UL );
+   size_t s( 0UL );
+
+   while( q >>= 1UL ) {
+      ++s;
+   }
+
+   BLAZE_INTERNAL_ASSERT( s < maxSegments, "Invalid segment detected" );
+
+   return segments_[s].load( std::memory_order_acquire )[ i - segmentSize*( ( 1UL << s ) - 1UL ) ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a new segment of magazine descriptors.
+//
+// \return The index of an unused magazine descriptor, 0 in case no descriptor could be created.
+//
+// This function allocates the next segment of magazine descriptors. One of the descriptors is
+// returned, all remaining descriptors are pushed on the stack of unused descriptors.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline uint32_t ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::createMagazines() noexcept
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   const uint32_t index( pop( spare_ ) );
+   if( index != 0U || numSegments_ == maxSegments )
+      return index;
+
+   const size_t s( numSegments_ );
+   const size_t size( segmentSize << s );
+   Magazine* const segment( new( std::nothrow ) Magazine[size] );
+
+   if( segment == nullptr )
+      return 0U;
+
+   segments_[s].store( segment, std::memory_order_release );
+   ++numSegments_;
+
+   const uint32_t first( static_cast<uint32_t>( segmentSize*( ( 1UL << s ) - 1UL ) + 1UL ) );
+
+   for( size_t i=1UL; i<size; ++i ) {
+      push( spare_, static_cast<uint32_t>( first + i ) );
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pushing the given magazine descriptor on the given lock-free stack.
+//
+// \param stack The lock-free stack.
+// \param index The index of the magazine descriptor.
+// \return void
+//
+// The head of the stack combines the index of the top descriptor (lower 32 bits) with a
+// modification counter (upper 32 bits), which protects the stack against the ABA problem.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::push( Stack& stack, uint32_t index ) noexcept
+{
+   Magazine& magazine( getMagazine( index ) );
+   uint64_t head( stack.load( std::memory_order_relaxed ) );
+   uint64_t next( 0UL );
+
+   do {
+      magazine.next_.store( static_cast<uint32_t>( head ), std::memory_order_relaxed );
+      next = ( ( head >> 32 ) + 1UL ) << 32 | index;
+   }
+   while( !stack.compare_exchange_weak( head, next, std::memory_order_release,
+                                        std::memory_order_relaxed ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Popping the top magazine descriptor from the given lock-free stack.
+//
+// \param stack The lock-free stack.
+// \return The index of the popped magazine descriptor, 0 in case the stack is empty.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline uint32_t ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::pop( Stack& stack ) noexcept
+{
+   uint64_t head( stack.load( std::memory_order_acquire ) );
+
+   while( static_cast<uint32_t>( head ) != 0U )
+   {
+      const uint32_t index( static_cast<uint32_t>( head ) );
+      const uint64_t next( ( ( head >> 32 ) + 1UL ) << 32 |
+                           getMagazine( index ).next_.load( std::memory_order_relaxed ) );
+
+      if( stack.compare_exchange_weak( head, next, std::memory_order_acquire,
+                                       std::memory_order_acquire ) )
+         return index;
+   }
+
+   return 0U;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the usage statistics of the memory pool.
+//
+// \return The current usage statistics.
+//
+// This function returns the usage statistics of the memory pool. The function can be called
+// by any thread. However, in case other threads are concurrently using the pool, the returned
+// statistics represent a snapshot that is not necessarily consistent.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline typename ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::Statistics
+   ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::getStatistics() const
+{
+   Statistics stats{ 0UL, 0UL, 0UL, 0UL, 0UL, 0UL };
+
+   for( size_t i=0UL; i<maxThreads; ++i )
+   {
+      const Cache* const cache( caches_[i].load( std::memory_order_acquire ) );
+
+      if( cache != nullptr ) {
+         stats.allocations    += cache->allocations_.load( std::memory_order_relaxed );
+         stats.deallocations  += cache->deallocations_.load( std::memory_order_relaxed );
+         stats.depotTransfers += cache->transfers_.load( std::memory_order_relaxed );
+      }
+   }
+
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   stats.allocations     += sharedAllocs_;
+   stats.deallocations   += sharedDeallocs_;
+   stats.blocks           = blocks_.size();
+   stats.capacity         = blocks_.size() * Blocksize;
+   stats.sharedOperations = sharedOps_;
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Incrementing the given statistics counter.
+//
+// \param counter The counter to be incremented.
+// \return void
+//
+// Since all counters are only modified by a single thread, the increment does not require an
+// atomic read-modify-write operation.
+*/
+template< typename Type          // Type of the allocated objects
+        , size_t Blocksize       // Number of objects per memory block
+        , size_t MagazineSize >  // Number of objects per magazine
+inline void ConcurrentMemoryPool<Type,Blocksize,MagazineSize>::increment( std::atomic<size_t>& counter ) noexcept
+{
+   counter.store( counter.load( std::memory_order_relaxed ) + 1UL, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
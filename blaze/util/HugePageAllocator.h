@@ -0,0 +1,406 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/HugePageAllocator.h
+//  \brief Header file for the HugePageAllocator implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_HUGEPAGEALLOCATOR_H_
+#define _BLAZE_UTIL_HUGEPAGEALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/HugePages.h>
+#include <blaze/util/MaybeUnused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocator for memory backed by huge pages.
+// \ingroup util
+//
+// The HugePageAllocator class template represents an implementation of the allocator concept
+// of the standard library for the allocation of type-specific, aligned, uninitialized memory
+// that is backed by huge pages. All allocations of at least BLAZE_HUGE_PAGE_THRESHOLD bytes are
+// backed by the kind of huge pages specified by the \a Mode template parameter (see the
+// HugePageMode enumeration), independent of the global BLAZE_USE_HUGE_PAGES setting. All
+// smaller allocations are performed via the AlignedAllocator class template. The following
+// example demonstrates the use of the HugePageAllocator for a large dynamic matrix:
+
+   \code
+   using blaze::rowMajor;
+   using blaze::hugetlbPages;
+
+   using Allocator = blaze::HugePageAllocator<double,hugetlbPages>;
+
+   blaze::DynamicMatrix<double,rowMajor,Allocator> A( 100000UL, 50000UL );
+   \endcode
+
+// Please note that huge pages are only supported on Linux systems. On all other systems, the
+// HugePageAllocator behaves exactly as the AlignedAllocator.
+*/
+template< typename Type                              // Type of the allocated values
+        , HugePageMode Mode = transparentHugePages >  // Kind of huge pages
+class HugePageAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ValueType      = Type;            //!< Type of the allocated values.
+   using Pointer        = Type*;           //!< Type of a pointer to the allocated values.
+   using ConstPointer   = const Type*;     //!< Type of a pointer-to-const to the allocated values.
+   using Reference      = Type&;           //!< Type of a reference to the allocated values.
+   using ConstReference = const Type&;     //!< Type of a reference-to-const to the allocated values.
+   using SizeType       = std::size_t;     //!< Size type of the huge page allocator.
+   using DifferenceType = std::ptrdiff_t;  //!< Difference type of the huge page allocator.
+
+   // STL allocator requirements
+   using value_type      = ValueType;       //!< Type of the allocated values.
+   using pointer         = Pointer;         //!< Type of a pointer to the allocated values.
+   using const_pointer   = ConstPointer;    //!< Type of a pointer-to-const to the allocated values.
+   using reference       = Reference;       //!< Type of a reference to the allocated values.
+   using const_reference = ConstReference;  //!< Type of a reference-to-const to the allocated values.
+   using size_type       = SizeType;        //!< Size type of the huge page allocator.
+   using difference_type = DifferenceType;  //!< Difference type of the huge page allocator.
+   //**********************************************************************************************
+
+   //**rebind class definition*********************************************************************
+   /*!\brief Implementation of the HugePageAllocator rebind mechanism.
+   */
+   template< typename Type2 >
+   struct rebind
+   {
+      using other = HugePageAllocator<Type2,Mode>;  //!< Type of the other allocator.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline HugePageAllocator();
+
+   template< typename Type2 >
+   inline HugePageAllocator( const HugePageAllocator<Type2,Mode>& );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline constexpr size_t max_size() const noexcept;
+   inline Pointer          address( Reference x ) const noexcept;
+   inline ConstPointer     address( ConstReference x ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline Pointer allocate  ( size_t numObjects, const void* localityHint = nullptr );
+   inline void    deallocate( Pointer ptr, size_t numObjects ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Construction functions**********************************************************************
+   /*!\name Construction functions */
+   //@{
+   template< typename... Args >
+   inline void construct( Pointer ptr, Args&&... args );
+
+   inline void destroy( Pointer ptr ) noexcept;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for HugePageAllocator.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+inline HugePageAllocator<Type,Mode>::HugePageAllocator()
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different HugePageAllocator instances.
+//
+// \param allocator The foreign huge page allocator to be copied.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+template< typename Type2 >     // Type of the foreign allocated values
+inline HugePageAllocator<Type,Mode>::HugePageAllocator( const HugePageAllocator<Type2,Mode>& allocator )
+{
+   MAYBE_UNUSED( allocator );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the maximum possible number of elements that can be allocated together.
+//
+// \return The maximum number of elements that can be allocated together.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+inline constexpr size_t HugePageAllocator<Type,Mode>::max_size() const noexcept
+{
+   return size_t(-1) / sizeof( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the given element.
+//
+// \return The address of the given element.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+inline typename HugePageAllocator<Type,Mode>::Pointer
+   HugePageAllocator<Type,Mode>::address( Reference x ) const noexcept
+{
+   return &x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the given element.
+//
+// \return The address of the given element.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+inline typename HugePageAllocator<Type,Mode>::ConstPointer
+   HugePageAllocator<Type,Mode>::address( ConstReference x ) const noexcept
+{
+   return &x;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates aligned memory for the specified number of objects.
+//
+// \param numObjects The number of objects to be allocated.
+// \param localityHint Hint for improved locality.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates a junk of memory for the specified number of objects of type \a Type.
+// In case the size of the memory is at least BLAZE_HUGE_PAGE_THRESHOLD bytes, the memory is
+// backed by the kind of huge pages specified by the \a Mode template parameter. Else the memory
+// is allocated via the AlignedAllocator. In both cases the returned pointer is guaranteed to be
+// aligned according to the alignment restrictions of the data type \a Type.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+inline typename HugePageAllocator<Type,Mode>::Pointer
+   HugePageAllocator<Type,Mode>::allocate( size_t numObjects, const void* localityHint )
+{
+   const size_t size( numObjects*sizeof(Type) );
+
+   if( size >= hugePageThreshold ) {
+      byte_t* const ptr( allocateHugePages( size, Mode ) );
+      if( ptr != nullptr ) {
+         return reinterpret_cast<Pointer>( ptr );
+      }
+   }
+
+   return AlignedAllocator<Type>().allocate( numObjects, localityHint );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory.
+//
+// \param ptr The address of the first element of the array to be deallocated.
+// \param numObjects The number of objects to be deallocated.
+// \return void
+//
+// This function deallocates a junk of memory that was previously allocated via the allocate()
+// function. Note that the argument \a numObjects must be equal ot the first argument of the call
+// to allocate() that origianlly produced \a ptr.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+inline void HugePageAllocator<Type,Mode>::deallocate( Pointer ptr, size_t numObjects ) noexcept
+{
+   if( !deallocateHugePages( ptr ) ) {
+      AlignedAllocator<Type>().deallocate( ptr, numObjects );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructs an object of type \a Type at the specified memory location.
+//
+// \param ptr Pointer to the allocated, uninitialized storage.
+// \param args The constructor arguments.
+// \return void
+//
+// This function constructs an object of type \a Type in the allocated, uninitialized storage
+// pointed to by \a ptr. This construction is performed via placement-new.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+template< typename... Args >   // Types of the constructor arguments
+inline void HugePageAllocator<Type,Mode>::construct( Pointer ptr, Args&&... args )
+{
+   ::new( ptr ) Type( std::forward<Args>( args )... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys the object of type \a Type at the specified memory location.
+//
+// \param ptr Pointer to the object to be destroyed.
+// \return void
+//
+// This function destroys the object at the specified memory location via a direct call to its
+// destructor.
+*/
+template< typename Type        // Type of the allocated values
+        , HugePageMode Mode >  // Kind of huge pages
+inline void HugePageAllocator<Type,Mode>::destroy( Pointer ptr ) noexcept
+{
+   ptr->~Type();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name HugePageAllocator operators */
+//@{
+template< typename T1, typename T2, HugePageMode M >
+inline bool operator==( const HugePageAllocator<T1,M>& lhs, const HugePageAllocator<T2,M>& rhs ) noexcept;
+
+template< typename T1, typename T2, HugePageMode M >
+inline bool operator!=( const HugePageAllocator<T1,M>& lhs, const HugePageAllocator<T2,M>& rhs ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two HugePageAllocator objects.
+//
+// \param lhs The left-hand side huge page allocator.
+// \param rhs The right-hand side huge page allocator.
+// \return \a true.
+*/
+template< typename T1       // Type of the left-hand side huge page allocator
+        , typename T2       // Type of the right-hand side huge page allocator
+        , HugePageMode M >  // Kind of huge pages
+inline bool operator==( const HugePageAllocator<T1,M>& lhs, const HugePageAllocator<T2,M>& rhs ) noexcept
+{
+   MAYBE_UNUSED( lhs, rhs );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two HugePageAllocator objects.
+//
+// \param lhs The left-hand side huge page allocator.
+// \param rhs The right-hand side huge page allocator.
+// \return \a false.
+*/
+template< typename T1       // Type of the left-hand side huge page allocator
+        , typename T2       // Type of the right-hand side huge page allocator
+        , HugePageMode M >  // Kind of huge pages
+inline bool operator!=( const HugePageAllocator<T1,M>& lhs, const HugePageAllocator<T2,M>& rhs ) noexcept
+{
+   MAYBE_UNUSED( lhs, rhs );
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,460 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/HugePages.h
+//  \brief Header file for the huge page allocation functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_HUGEPAGES_H_
+#define _BLAZE_UTIL_HUGEPAGES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#endif
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  HUGE PAGE MODES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Huge page backing of large dynamic allocations.
+// \ingroup util
+//
+// The HugePageMode enumeration specifies the kind of huge pages that are requested for a large
+// dynamic allocation (see the BLAZE_USE_HUGE_PAGES switch and the HugePageAllocator class
+// template):
+//
+//  - \a noHugePages: No huge pages are requested and the use of huge pages is left to the system.
+//  - \a transparentHugePages: The memory is aligned to 2 MiB and marked as eligible for
+//       transparent huge pages via \c madvise(MADV_HUGEPAGE).
+//  - \a hugetlbPages: The memory is mapped from the hugetlbfs pool, first attempting 1 GiB pages
+//       and afterwards 2 MiB pages. In case the pool is exhausted, the memory falls back to
+//       transparent huge pages.
+*/
+enum HugePageMode
+{
+   noHugePages          = 0,  //!< No huge page backing.
+   transparentHugePages = 1,  //!< Transparent huge pages via madvise().
+   hugetlbPages         = 2   //!< Explicit huge pages from the hugetlbfs pool.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS HUGEPAGEREGISTRY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Registry of all huge page allocations of the Blaze library.
+// \ingroup util
+//
+// The HugePageRegistry keeps track of all memory that has been allocated via the
+// allocateHugePages() function. It stores the size and the kind of each allocation, which is
+// required to correctly release the memory, and provides the counters reported by the
+// getHugetlbBytes(), getAdvisedHugePageBytes(), and getHugePageFallbacks() functions.
+*/
+struct HugePageRegistry
+{
+   //**Allocation kinds****************************************************************************
+   enum Kind { plain, advised, mapped };
+   //**********************************************************************************************
+
+   //**Entry definition****************************************************************************
+   struct Entry
+   {
+      size_t size;  //!< The size of the allocation in bytes.
+      Kind   kind;  //!< The kind of the allocation.
+   };
+   //**********************************************************************************************
+
+   std::mutex mutex_;                               //!< Synchronization of all registry accesses.
+   std::unordered_map<const void*,Entry> entries_;  //!< The currently active allocations.
+   size_t mappedBytes_  = 0UL;                      //!< The number of bytes mapped from hugetlbfs.
+   size_t advisedBytes_ = 0UL;                      //!< The number of bytes advised for THP.
+   size_t fallbacks_    = 0UL;                      //!< The number of allocations without huge pages.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the huge page registry of the Blaze library.
+// \ingroup util
+//
+// \return Reference to the huge page registry.
+//
+// The registry is intentionally never destroyed, since vectors and matrices with static storage
+// duration may release their memory after the destruction of all function-local statics.
+*/
+inline HugePageRegistry& theHugePageRegistry()
+{
+   static HugePageRegistry* registry( new HugePageRegistry() );
+   return *registry;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BACKEND HUGE PAGE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the allocation of memory backed by transparent huge pages.
+// \ingroup util
+//
+// \param size The number of bytes to be allocated.
+// \param kind Output parameter for the kind of the resulting allocation.
+// \return Pointer to the allocated memory or \a nullptr in case the allocation failed.
+//
+// This function allocates the given number of bytes, rounded up to a multiple of 2 MiB, with
+// an alignment of 2 MiB and marks the memory as eligible for transparent huge pages.
+*/
+inline void* allocateTransparentHugePages( size_t& size, HugePageRegistry::Kind& kind ) noexcept
+{
+#if defined(__linux__)
+   constexpr size_t pagesize( 2097152UL );
+
+   size = ( size + pagesize - 1UL ) & ~( pagesize - 1UL );
+
+   void* raw( nullptr );
+
+   if( posix_memalign( &raw, pagesize, size ) )
+      return nullptr;
+
+#  if defined(MADV_HUGEPAGE)
+   kind = ( madvise( raw, size, MADV_HUGEPAGE ) == 0 ? HugePageRegistry::advised : HugePageRegistry::plain );
+#  else
+   kind = HugePageRegistry::plain;
+#  endif
+
+   return raw;
+#else
+   MAYBE_UNUSED( size, kind );
+   return nullptr;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the allocation of memory from the hugetlbfs pool.
+// \ingroup util
+//
+// \param size The number of bytes to be allocated.
+// \return Pointer to the allocated memory or \a nullptr in case the pool is exhausted.
+//
+// This function maps the given number of bytes from the hugetlbfs pool. In case the requested
+// size is at least 1 GiB, the function first attempts to use 1 GiB pages. Afterwards it attempts
+// to use 2 MiB pages. On success, the given size is rounded up to a multiple of the page size.
+*/
+inline void* allocateHugetlbPages( size_t& size ) noexcept
+{
+#if defined(__linux__) && defined(MAP_HUGETLB)
+   constexpr int shift( 26 );  // Corresponds to MAP_HUGE_SHIFT
+
+   constexpr size_t pagesizes[] = { 1073741824UL, 2097152UL };
+   constexpr int    exponents[] = { 30, 21 };
+
+   for( size_t i=0UL; i<2UL; ++i )
+   {
+      if( size < pagesizes[i] && i == 0UL )
+         continue;
+
+      const size_t bytes( ( size + pagesizes[i] - 1UL ) & ~( pagesizes[i] - 1UL ) );
+      const int flags( MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | ( exponents[i] << shift ) );
+
+      void* const ptr( mmap( nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0 ) );
+
+      if( ptr != MAP_FAILED ) {
+         size = bytes;
+         return ptr;
+      }
+   }
+
+   return nullptr;
+#else
+   MAYBE_UNUSED( size );
+   return nullptr;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HUGE PAGE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Allocates memory backed by huge pages.
+// \ingroup util
+//
+// \param size The number of bytes to be allocated.
+// \param mode The requested kind of huge pages.
+// \return Pointer to the allocated memory or \a nullptr in case the allocation failed.
+//
+// This function allocates the given number of bytes and requests the given kind of huge pages
+// for the memory. In case the hugetlbfs pool is exhausted, the function falls back to transparent
+// huge pages. In case transparent huge pages are not available, the function returns ordinary
+// memory with an alignment of 2 MiB. The returned memory must be released via the according
+// deallocateHugePages() function. In case the memory cannot be allocated at all, or huge pages
+// are not supported on the system (i.e. on all non-Linux systems), the function returns
+// \a nullptr.
+*/
+inline byte_t* allocateHugePages( size_t size, HugePageMode mode ) noexcept
+{
+   if( mode == noHugePages )
+      return nullptr;
+
+   HugePageRegistry::Kind kind( HugePageRegistry::mapped );
+   void* ptr( nullptr );
+
+   if( mode == hugetlbPages ) {
+      ptr = allocateHugetlbPages( size );
+   }
+
+   if( ptr == nullptr ) {
+      ptr = allocateTransparentHugePages( size, kind );
+   }
+
+   if( ptr == nullptr )
+      return nullptr;
+
+   HugePageRegistry& registry( theHugePageRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+
+   try {
+      registry.entries_.emplace( ptr, HugePageRegistry::Entry{ size, kind } );
+   }
+   catch( ... ) {
+#if defined(__linux__)
+      if( kind == HugePageRegistry::mapped ) munmap( ptr, size );
+      else free( ptr );
+#endif
+      return nullptr;
+   }
+
+   if( kind == HugePageRegistry::mapped )
+      registry.mappedBytes_ += size;
+   else if( kind == HugePageRegistry::advised )
+      registry.advisedBytes_ += size;
+   else
+      ++registry.fallbacks_;
+
+   return static_cast<byte_t*>( ptr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deallocates memory that was allocated via the allocateHugePages() function.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory to be deallocated.
+// \return \a true in case the memory was allocated via allocateHugePages(), \a false if not.
+//
+// This function releases the given memory in case it was allocated via the allocateHugePages()
+// function. Else the function returns \a false and the memory has to be released by the caller.
+// Since all huge page allocations are aligned to 2 MiB, only such addresses are looked up in
+// the registry of huge page allocations.
+*/
+inline bool deallocateHugePages( const void* address ) noexcept
+{
+   if( address == nullptr || reinterpret_cast<size_t>( address ) % 2097152UL != 0UL )
+      return false;
+
+   HugePageRegistry& registry( theHugePageRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+
+   const auto pos( registry.entries_.find( address ) );
+
+   if( pos == registry.entries_.end() )
+      return false;
+
+   const HugePageRegistry::Entry entry( pos->second );
+   registry.entries_.erase( pos );
+
+#if defined(__linux__)
+   if( entry.kind == HugePageRegistry::mapped ) {
+      munmap( const_cast<void*>( address ), entry.size );
+      registry.mappedBytes_ -= entry.size;
+   }
+   else {
+      free( const_cast<void*>( address ) );
+      if( entry.kind == HugePageRegistry::advised )
+         registry.advisedBytes_ -= entry.size;
+   }
+#endif
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes currently mapped from the hugetlbfs pool.
+// \ingroup util
+//
+// \return The number of bytes of all live allocations backed by hugetlbfs pages.
+//
+// This function returns the total number of bytes of all currently live allocations of the
+// Blaze library that are backed by explicit huge pages from the hugetlbfs pool. Since these
+// pages are reserved at the time of the allocation, all of these bytes are guaranteed to be
+// backed by huge pages.
+*/
+inline size_t getHugetlbBytes()
+{
+   HugePageRegistry& registry( theHugePageRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+   return registry.mappedBytes_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes currently advised for transparent huge pages.
+// \ingroup util
+//
+// \return The number of bytes of all live allocations advised for transparent huge pages.
+//
+// This function returns the total number of bytes of all currently live allocations of the
+// Blaze library that have been successfully marked as eligible for transparent huge pages.
+// Note that it is up to the kernel to actually back this memory by huge pages. The number of
+// bytes that actually reside in transparent huge pages is reported by the
+// getTransparentHugePageBytes() function.
+*/
+inline size_t getAdvisedHugePageBytes()
+{
+   HugePageRegistry& registry( theHugePageRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+   return registry.advisedBytes_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of huge page allocations that did not receive any huge pages.
+// \ingroup util
+//
+// \return The number of allocations that fell back to ordinary pages.
+//
+// This function returns the total number of allocations that requested huge pages, but could
+// neither be mapped from the hugetlbfs pool nor be advised for transparent huge pages (for
+// instance because transparent huge pages are disabled on the system).
+*/
+inline size_t getHugePageFallbacks()
+{
+   HugePageRegistry& registry( theHugePageRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+   return registry.fallbacks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes of the process that actually reside in transparent huge pages.
+// \ingroup util
+//
+// \return The number of bytes backed by transparent huge pages.
+//
+// This function returns the number of bytes of anonymous memory of the calling process that
+// are currently backed by transparent huge pages, as reported by the kernel. Note that this
+// number includes all memory of the process, not only the memory allocated by Blaze. The
+// function is only supported on Linux systems. On all other systems it returns 0.
+*/
+inline size_t getTransparentHugePageBytes()
+{
+#if defined(__linux__)
+   std::FILE* file( std::fopen( "/proc/self/smaps_rollup", "r" ) );
+
+   if( file == nullptr )
+      return 0UL;
+
+   char line[256];
+   size_t kilobytes( 0UL );
+
+   while( std::fgets( line, sizeof( line ), file ) != nullptr ) {
+      if( std::strncmp( line, "AnonHugePages:", 14UL ) == 0 ) {
+         kilobytes = std::strtoul( line+14, nullptr, 10 );
+         break;
+      }
+   }
+
+   std::fclose( file );
+
+   return kilobytes * 1024UL;
+#else
+   return 0UL;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
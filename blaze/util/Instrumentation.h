@@ -0,0 +1,128 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Instrumentation.h
+//  \brief Header file for the instrumentation macros
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_INSTRUMENTATION_H_
+#define _BLAZE_UTIL_INSTRUMENTATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Debugging.h>
+#if BLAZE_USE_INSTRUMENTATION
+#  include <blaze/util/instrumentation/Instrumentation.h>
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUMENTATION MACROS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Instrumentation of an allocation of vector or matrix elements.
+// \ingroup util
+//
+// This macro records an allocation of the given number of bytes in the global and thread-local
+// instrumentation counters. In case the instrumentation is deactivated (see the
+// BLAZE_USE_INSTRUMENTATION switch), the macro is completely removed from the code.
+*/
+#if BLAZE_USE_INSTRUMENTATION
+#  define BLAZE_INSTRUMENT_ALLOCATION( bytes ) \
+   blaze::recordAllocation( bytes )
+#else
+#  define BLAZE_INSTRUMENT_ALLOCATION( bytes )
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Instrumentation of a deallocation of vector or matrix elements.
+// \ingroup util
+//
+// This macro records a deallocation of the given number of bytes in the global and thread-local
+// instrumentation counters. In case the instrumentation is deactivated (see the
+// BLAZE_USE_INSTRUMENTATION switch), the macro is completely removed from the code.
+*/
+#if BLAZE_USE_INSTRUMENTATION
+#  define BLAZE_INSTRUMENT_DEALLOCATION( bytes ) \
+   blaze::recordDeallocation( bytes )
+#else
+#  define BLAZE_INSTRUMENT_DEALLOCATION( bytes )
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Instrumentation of the construction of a vector or matrix from an expression.
+// \ingroup util
+//
+// This macro records the construction of a vector or matrix from another vector, matrix or
+// expression (as for instance a temporary during the evaluation of an expression) in the global
+// and thread-local instrumentation counters. In case the instrumentation is deactivated (see the
+// BLAZE_USE_INSTRUMENTATION switch), the macro is completely removed from the code.
+*/
+#if BLAZE_USE_INSTRUMENTATION
+#  define BLAZE_INSTRUMENT_TEMPORARY \
+   blaze::recordTemporary()
+#else
+#  define BLAZE_INSTRUMENT_TEMPORARY
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Instrumentation of an assignment.
+// \ingroup util
+//
+// This macro instruments the remainder of the current scope as an assignment of the given type
+// (see AssignmentType) to a target of size \f$ rows \times columns \f$. In case an assignment
+// callback is set (see setAssignmentCallback()), the callback is called at the end of the scope
+// with the elapsed time of the assignment. The \a parallel argument specifies whether the
+// assignment is executed in parallel. In case the instrumentation is deactivated (see the
+// BLAZE_USE_INSTRUMENTATION switch), the macro is completely removed from the code.
+*/
+#if BLAZE_USE_INSTRUMENTATION
+#  define BLAZE_INSTRUMENT_ASSIGNMENT( type, rows, columns, parallel ) \
+   blaze::AssignmentTrace BLAZE_ASSIGNMENT_TRACE_OBJECT( blaze::type, rows, columns, parallel )
+#else
+#  define BLAZE_INSTRUMENT_ASSIGNMENT( type, rows, columns, parallel )
+#endif
+//*************************************************************************************************
+
+#endif
@@ -44,11 +44,16 @@
 #  include <malloc.h>
 #endif
 #include <cstdlib>
+#include <memory>
 #include <new>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/HugePages.h>
+#include <blaze/util/Instrumentation.h>
+#include <blaze/util/NUMA.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -74,23 +79,37 @@ namespace blaze {
 //
 // This function provides the functionality to allocate memory based on the given alignment
 // restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// functions. In case the huge page backing is enabled (see the BLAZE_USE_HUGE_PAGES switch),
+// allocations of at least BLAZE_HUGE_PAGE_THRESHOLD bytes are backed by huge pages. In case the
+// interleaved NUMA placement is enabled (see the BLAZE_USE_NUMA_INTERLEAVE switch), all complete
+// memory pages of the allocated memory are interleaved across all NUMA nodes.
 */
 inline byte_t* allocate_backend( size_t size, size_t alignment )
 {
    void* raw( nullptr );
 
+   if( useHugePages != noHugePages && size >= hugePageThreshold ) {
+      raw = allocateHugePages( size, static_cast<HugePageMode>( useHugePages ) );
+   }
+
+   if( raw == nullptr )
+   {
 #if BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM
-   raw = _aligned_malloc( size, alignment );
-   if( raw == nullptr ) {
+      raw = _aligned_malloc( size, alignment );
+      if( raw == nullptr ) {
 #elif BLAZE_MINGW32_PLATFORM
-   raw = __mingw_aligned_malloc( size, alignment );
-   if( raw == nullptr ) {
+      raw = __mingw_aligned_malloc( size, alignment );
+      if( raw == nullptr ) {
 #else
-   alignment = ( alignment < sizeof(void*) ? sizeof(void*) : alignment );
-   if( posix_memalign( &raw, alignment, size ) ) {
+      alignment = ( alignment < sizeof(void*) ? sizeof(void*) : alignment );
+      if( posix_memalign( &raw, alignment, size ) ) {
 #endif
-      BLAZE_THROW_BAD_ALLOC;
+         BLAZE_THROW_BAD_ALLOC;
+      }
+   }
+
+   if( useNUMAInterleave ) {
+      interleaveMemory( raw, size );
    }
 
    return reinterpret_cast<byte_t*>( raw );
@@ -112,6 +131,9 @@ inline byte_t* allocate_backend( size_t size, size_t alignment )
 */
 inline void deallocate_backend( const void* address ) noexcept
 {
+   if( useHugePages != noHugePages && deallocateHugePages( address ) )
+      return;
+
 #if BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM
    _aligned_free( const_cast<void*>( address ) );
 #elif BLAZE_MINGW32_PLATFORM
@@ -263,6 +285,179 @@ DisableIf_t< IsBuiltin_v<T> > deallocate( T* address )
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  ALLOCATOR-BASED ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Allocation of raw memory by means of the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator to be used for the allocation.
+// \param size The number of elements to allocate.
+// \return Pointer to the first element of the allocated array.
+// \exception std::bad_alloc Allocation failed or invalid alignment detected.
+//
+// This function allocates memory for the given number of elements by means of the given
+// allocator and checks that the memory satisfies the alignment restrictions of the element
+// type (see the AlignmentOf type trait). In case the alignment restrictions are not satisfied,
+// the memory is returned to the allocator and a \a std::bad_alloc exception is thrown.
+*/
+template< typename Alloc >  // Type of the allocator
+typename std::allocator_traits<Alloc>::value_type* allocate_raw( Alloc& alloc, size_t size )
+{
+   using Traits = std::allocator_traits<Alloc>;
+   using T      = typename Traits::value_type;
+
+   constexpr size_t alignment( AlignmentOf_v<T> );
+
+   T* const address( Traits::allocate( alloc, size ) );
+
+   if( reinterpret_cast<size_t>( address ) % alignment != 0UL ) {
+      Traits::deallocate( alloc, address, size );
+      BLAZE_THROW_BAD_ALLOC;
+   }
+
+   BLAZE_INSTRUMENT_ALLOCATION( size*sizeof(T) );
+
+   return address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned array allocation for built-in data types by means of the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator to be used for the allocation.
+// \param size The number of elements to allocate.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed or invalid alignment detected.
+//
+// This function allocates an array of the given number of elements of built-in data type by
+// means of the given allocator. The elements are not initialized. The allocator is required to
+// return plain pointers and memory that satisfies the alignment restrictions of the element
+// type (see the AlignmentOf type trait). In case the returned memory is not properly aligned,
+// a \a std::bad_alloc exception is thrown.
+*/
+template< typename Alloc >  // Type of the allocator
+EnableIf_t< IsBuiltin_v< typename std::allocator_traits<Alloc>::value_type >
+          , typename std::allocator_traits<Alloc>::value_type* >
+   allocate( Alloc& alloc, size_t size )
+{
+   return allocate_raw( alloc, size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned array allocation for user-specific class types by means of the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator to be used for the allocation.
+// \param size The number of elements to allocate.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed or invalid alignment detected.
+//
+// This function allocates an array of the given number of elements of user-specific class type
+// by means of the given allocator. All elements of the array are default constructed via the
+// allocator. In case any element throws an exception during construction, all elements that
+// have already been constructed are destroyed in reverse order and the memory is returned to
+// the allocator. The allocator is required to return plain pointers and memory that satisfies
+// the alignment restrictions of the element type (see the AlignmentOf type trait).
+*/
+template< typename Alloc >  // Type of the allocator
+DisableIf_t< IsBuiltin_v< typename std::allocator_traits<Alloc>::value_type >
+           , typename std::allocator_traits<Alloc>::value_type* >
+   allocate( Alloc& alloc, size_t size )
+{
+   using Traits = std::allocator_traits<Alloc>;
+   using T      = typename Traits::value_type;
+
+   T* const address( allocate_raw( alloc, size ) );
+   size_t i( 0UL );
+
+   try {
+      for( ; i<size; ++i )
+         Traits::construct( alloc, address+i );
+   }
+   catch( ... ) {
+      while( i != 0UL )
+         Traits::destroy( alloc, address+(--i) );
+      Traits::deallocate( alloc, address, size );
+      throw;
+   }
+
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory for built-in data types by means of the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator that was used for the allocation.
+// \param address The address of the first element of the array to be deallocated.
+// \param size The number of elements of the array.
+// \return void
+//
+// This function deallocates the given memory that was previously allocated via the allocate()
+// function with the given allocator. The given size must be equal to the size that was used
+// for the allocation.
+*/
+template< typename Alloc >  // Type of the allocator
+EnableIf_t< IsBuiltin_v< typename std::allocator_traits<Alloc>::value_type > >
+   deallocate( Alloc& alloc, typename std::allocator_traits<Alloc>::value_type* address, size_t size ) noexcept
+{
+   if( address == nullptr )
+      return;
+
+   BLAZE_INSTRUMENT_DEALLOCATION( size*sizeof( *address ) );
+
+   std::allocator_traits<Alloc>::deallocate( alloc, address, size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory for user-specific class types by means of the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator that was used for the allocation.
+// \param address The address of the first element of the array to be deallocated.
+// \param size The number of elements of the array.
+// \return void
+//
+// This function destroys all elements of the given array and deallocates the memory that was
+// previously allocated via the allocate() function with the given allocator. The given size
+// must be equal to the size that was used for the allocation.
+*/
+template< typename Alloc >  // Type of the allocator
+DisableIf_t< IsBuiltin_v< typename std::allocator_traits<Alloc>::value_type > >
+   deallocate( Alloc& alloc, typename std::allocator_traits<Alloc>::value_type* address, size_t size )
+{
+   using Traits = std::allocator_traits<Alloc>;
+
+   if( address == nullptr )
+      return;
+
+   for( size_t i=0UL; i<size; ++i )
+      Traits::destroy( alloc, address+i );
+
+   BLAZE_INSTRUMENT_DEALLOCATION( size*sizeof( *address ) );
+
+   Traits::deallocate( alloc, address, size );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
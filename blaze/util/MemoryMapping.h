@@ -0,0 +1,537 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryMapping.h
+//  \brief Header file for the memory mapping of files
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MEMORYMAPPING_H_
+#define _BLAZE_UTIL_MEMORYMAPPING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  define BLAZE_MEMORY_MAPPING_AVAILABLE 1
+#else
+#  define BLAZE_MEMORY_MAPPING_AVAILABLE 0
+#endif
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ACCESS PATTERNS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expected access pattern of a memory mapped file.
+// \ingroup util
+//
+// The AccessPattern enumeration specifies the expected access pattern to the memory of a memory
+// mapped file (see the MemoryMapping class). The pattern is passed to the operating system via
+// \c madvise() and controls the read-ahead of the mapped file:
+//
+//  - \a normalAccess: No specific access pattern is expected (\c MADV_NORMAL).
+//  - \a sequentialAccess: The memory is expected to be accessed in sequential order, e.g. row by
+//       row in case of a row-major matrix. This enables aggressive read-ahead (\c MADV_SEQUENTIAL).
+//  - \a randomAccess: The memory is expected to be accessed in random order. This disables
+//       read-ahead (\c MADV_RANDOM).
+*/
+enum AccessPattern
+{
+   normalAccess     = 0,  //!< No specific access pattern.
+   sequentialAccess = 1,  //!< Sequential access with aggressive read-ahead.
+   randomAccess     = 2   //!< Random access without read-ahead.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapping of a file.
+// \ingroup util
+//
+// The MemoryMapping class represents the mapping of a complete file into the address space of
+// the process. In case the file is mapped read-only, any write access to the mapped memory
+// results in a segmentation fault. In case the file is mapped read-write, all modifications of
+// the mapped memory are written back to the file. The mapping is released on destruction of
+// the MemoryMapping instance:
+
+   \code
+   blaze::MemoryMapping mapping( "data.bin", false, blaze::sequentialAccess );
+
+   const char* begin( static_cast<const char*>( mapping.address() ) );
+   const char* end  ( begin + mapping.bytes() );
+   \endcode
+
+// Memory mappings are currently only available on POSIX systems. On all other systems the
+// construction of a memory mapping results in a \a std::runtime_error exception.
+*/
+class MemoryMapping
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MemoryMapping() noexcept;
+   explicit inline MemoryMapping( const std::string& file, bool writable,
+                                  AccessPattern pattern = normalAccess );
+   explicit inline MemoryMapping( const std::string& file, size_t bytes,
+                                  AccessPattern pattern = normalAccess );
+
+   MemoryMapping( const MemoryMapping& ) = delete;
+   inline MemoryMapping( MemoryMapping&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryMapping();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   MemoryMapping& operator=( const MemoryMapping& ) = delete;
+   inline MemoryMapping& operator=( MemoryMapping&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void*  address   () const noexcept;
+   inline size_t bytes     () const noexcept;
+   inline bool   isWritable() const noexcept;
+   inline void   advise    ( AccessPattern pattern ) const;
+   inline void   prefetch  ( size_t offset, size_t bytes ) const;
+   inline void   sync      () const;
+   inline void   unmap     () noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void map( int fd, AccessPattern pattern );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   void*  address_;   //!< The address of the mapped memory.
+   size_t bytes_;     //!< The size of the mapped memory in bytes.
+   bool   writable_;  //!< Flag for a read-write mapping.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MemoryMapping.
+//
+// The default constructor creates an empty mapping.
+*/
+inline MemoryMapping::MemoryMapping() noexcept
+   : address_ ( nullptr )  // The address of the mapped memory
+   , bytes_   ( 0UL )      // The size of the mapped memory in bytes
+   , writable_( false )    // Flag for a read-write mapping
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mapping of an existing file.
+//
+// \param file The name of the file to be mapped.
+// \param writable \a true for a read-write mapping, \a false for a read-only mapping.
+// \param pattern The expected access pattern to the mapped memory.
+// \exception std::runtime_error File could not be mapped.
+//
+// This constructor maps the complete given file into memory. In case the file cannot be opened
+// or mapped, a \a std::runtime_error exception is thrown.
+*/
+inline MemoryMapping::MemoryMapping( const std::string& file, bool writable, AccessPattern pattern )
+   : address_ ( nullptr )   // The address of the mapped memory
+   , bytes_   ( 0UL )       // The size of the mapped memory in bytes
+   , writable_( writable )  // Flag for a read-write mapping
+{
+#if BLAZE_MEMORY_MAPPING_AVAILABLE
+   const int fd( ::open( file.c_str(), writable ? O_RDWR : O_RDONLY ) );
+
+   if( fd < 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   struct stat info;
+
+   if( ::fstat( fd, &info ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "File size could not be determined" );
+   }
+
+   bytes_ = static_cast<size_t>( info.st_size );
+
+   map( fd, pattern );
+#else
+   MAYBE_UNUSED( file, pattern );
+   BLAZE_THROW_RUNTIME_ERROR( "Memory mapped files are not supported" );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation and mapping of a new file.
+//
+// \param file The name of the file to be created.
+// \param bytes The size of the file in bytes.
+// \param pattern The expected access pattern to the mapped memory.
+// \exception std::runtime_error File could not be created.
+//
+// This constructor creates a new file of the given size (or truncates an existing file to the
+// given size) and maps it read-write into memory. All bytes of the file are initialized to zero.
+// Note that on most file systems the file is created as sparse file, i.e. disk space is only
+// occupied as soon as the memory is written. In case the file cannot be created or mapped, a
+// \a std::runtime_error exception is thrown.
+*/
+inline MemoryMapping::MemoryMapping( const std::string& file, size_t bytes, AccessPattern pattern )
+   : address_ ( nullptr )  // The address of the mapped memory
+   , bytes_   ( bytes )    // The size of the mapped memory in bytes
+   , writable_( true )     // Flag for a read-write mapping
+{
+#if BLAZE_MEMORY_MAPPING_AVAILABLE
+   const int fd( ::open( file.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 ) );
+
+   if( fd < 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be created" );
+   }
+
+   if( ::ftruncate( fd, static_cast<off_t>( bytes ) ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be resized" );
+   }
+
+   map( fd, pattern );
+#else
+   MAYBE_UNUSED( file, pattern );
+   BLAZE_THROW_RUNTIME_ERROR( "Memory mapped files are not supported" );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MemoryMapping.
+//
+// \param m The mapping to be moved into this instance.
+*/
+inline MemoryMapping::MemoryMapping( MemoryMapping&& m ) noexcept
+   : address_ ( m.address_  )  // The address of the mapped memory
+   , bytes_   ( m.bytes_    )  // The size of the mapped memory in bytes
+   , writable_( m.writable_ )  // Flag for a read-write mapping
+{
+   m.address_ = nullptr;
+   m.bytes_   = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MemoryMapping.
+*/
+inline MemoryMapping::~MemoryMapping()
+{
+   unmap();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MemoryMapping.
+//
+// \param m The mapping to be moved into this instance.
+// \return Reference to the assigned mapping.
+*/
+inline MemoryMapping& MemoryMapping::operator=( MemoryMapping&& m ) noexcept
+{
+   if( &m != this ) {
+      unmap();
+
+      address_  = m.address_;
+      bytes_    = m.bytes_;
+      writable_ = m.writable_;
+
+      m.address_ = nullptr;
+      m.bytes_   = 0UL;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the address of the mapped memory.
+//
+// \return The address of the mapped memory.
+//
+// The mapped memory is aligned to the page size of the system. In case of an empty mapping the
+// function returns \a nullptr.
+*/
+inline void* MemoryMapping::address() const noexcept
+{
+   return address_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped memory.
+//
+// \return The size of the mapped memory in bytes.
+*/
+inline size_t MemoryMapping::bytes() const noexcept
+{
+   return bytes_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the file is mapped read-write.
+//
+// \return \a true in case the file is mapped read-write, \a false if not.
+*/
+inline bool MemoryMapping::isWritable() const noexcept
+{
+   return writable_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the expected access pattern to the mapped memory.
+//
+// \param pattern The expected access pattern to the mapped memory.
+// \return void
+//
+// This function passes the given access pattern to the operating system. Since the access
+// pattern is only a hint, any failure is silently ignored.
+*/
+inline void MemoryMapping::advise( AccessPattern pattern ) const
+{
+#if BLAZE_MEMORY_MAPPING_AVAILABLE
+   if( address_ == nullptr )
+      return;
+
+   const int advice( pattern == sequentialAccess ? MADV_SEQUENTIAL :
+                     pattern == randomAccess     ? MADV_RANDOM     : MADV_NORMAL );
+
+   ::madvise( address_, bytes_, advice );
+#else
+   MAYBE_UNUSED( pattern );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the asynchronous read-ahead of a range of the mapped memory.
+//
+// \param offset The offset of the first byte of the range.
+// \param bytes The number of bytes of the range.
+// \return void
+//
+// This function notifies the operating system that the given range of the mapped memory will
+// be accessed in the near future (\c MADV_WILLNEED), which triggers the asynchronous read-ahead
+// of the according part of the file. Since the request is only a hint, any failure is silently
+// ignored.
+*/
+inline void MemoryMapping::prefetch( size_t offset, size_t bytes ) const
+{
+#if BLAZE_MEMORY_MAPPING_AVAILABLE
+   if( address_ == nullptr || offset >= bytes_ )
+      return;
+
+   const size_t pagesize( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+   const size_t begin( offset - offset % pagesize );
+   const size_t end  ( bytes < bytes_ - offset ? offset + bytes : bytes_ );
+
+   ::madvise( static_cast<char*>( address_ ) + begin, end - begin, MADV_WILLNEED );
+#else
+   MAYBE_UNUSED( offset, bytes );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing all modifications of the mapped memory back to the file.
+//
+// \return void
+// \exception std::runtime_error File could not be synchronized.
+//
+// This function blocks until all modifications of the mapped memory have been written to the
+// file. In case of a read-only mapping the function has no effect.
+*/
+inline void MemoryMapping::sync() const
+{
+#if BLAZE_MEMORY_MAPPING_AVAILABLE
+   if( address_ == nullptr || !writable_ )
+      return;
+
+   if( ::msync( address_, bytes_, MS_SYNC ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be synchronized" );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releasing the mapping.
+//
+// \return void
+//
+// This function releases the mapping. All pointers and references into the mapped memory are
+// invalidated. Modifications of a read-write mapping are written back to the file by the
+// operating system.
+*/
+inline void MemoryMapping::unmap() noexcept
+{
+#if BLAZE_MEMORY_MAPPING_AVAILABLE
+   if( address_ != nullptr ) {
+      ::munmap( address_, bytes_ );
+   }
+#endif
+
+   address_ = nullptr;
+   bytes_   = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mapping of the given open file.
+//
+// \param fd The file descriptor of the file to be mapped.
+// \param pattern The expected access pattern to the mapped memory.
+// \return void
+// \exception std::runtime_error File could not be mapped.
+//
+// This function maps the first \a bytes_ bytes of the given file and closes the file descriptor.
+// The file remains accessible via the mapping until the mapping is released.
+*/
+inline void MemoryMapping::map( int fd, AccessPattern pattern )
+{
+#if BLAZE_MEMORY_MAPPING_AVAILABLE
+   if( bytes_ > 0UL ) {
+      void* address( ::mmap( nullptr, bytes_, writable_ ? PROT_READ | PROT_WRITE : PROT_READ,
+                             MAP_SHARED, fd, 0 ) );
+
+      if( address == MAP_FAILED ) {
+         ::close( fd );
+         bytes_ = 0UL;
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+
+      address_ = address;
+   }
+
+   ::close( fd );
+
+   advise( pattern );
+#else
+   MAYBE_UNUSED( fd, pattern );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,175 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/NUMA.h
+//  \brief Header file for the NUMA memory placement functionality
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_NUMA_H_
+#define _BLAZE_UTIL_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BACKEND NUMA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for setting the NUMA memory policy of a memory range.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory range.
+// \param size The size of the memory range in bytes.
+// \param interleave \a true for an interleaved policy, \a false for a node-bound policy.
+// \param node The NUMA node for a node-bound policy; ignored for an interleaved policy.
+// \return \a true in case the memory policy was successfully set, \a false if not.
+//
+// This function sets the given NUMA memory policy for all pages that lie completely within the
+// given memory range via the \c mbind() system call. Pages that are already in use are moved
+// accordingly. Partially covered pages at the beginning and at the end of the range are not
+// affected in order to not change the placement of neighboring memory.
+*/
+inline bool mbind_backend( const void* address, size_t size, bool interleave, size_t node ) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+   constexpr int    MPOL_BIND_      ( 2 );
+   constexpr int    MPOL_INTERLEAVE_( 3 );
+   constexpr int    MPOL_MF_MOVE_   ( 1 << 1 );
+   constexpr int    MEMS_ALLOWED_   ( 1 << 2 );
+   constexpr size_t maxnodes( 1024UL );
+   constexpr size_t bits( 8UL*sizeof(unsigned long) );
+
+   const long pagesize( sysconf( _SC_PAGESIZE ) );
+
+   if( pagesize <= 0L )
+      return false;
+
+   const size_t mask ( static_cast<size_t>( pagesize ) - 1UL );
+   const size_t begin( ( reinterpret_cast<size_t>( address ) + mask ) & ~mask );
+   const size_t end  ( ( reinterpret_cast<size_t>( address ) + size ) & ~mask );
+
+   if( begin >= end )
+      return false;
+
+   unsigned long nodes[maxnodes/bits] = {};
+
+   if( interleave ) {
+      int current( 0 );
+      if( syscall( SYS_get_mempolicy, &current, nodes, maxnodes, nullptr, MEMS_ALLOWED_ ) != 0L )
+         return false;
+   }
+   else {
+      if( node >= maxnodes )
+         return false;
+      nodes[node/bits] = 1UL << ( node % bits );
+   }
+
+   const int mode( interleave ? MPOL_INTERLEAVE_ : MPOL_BIND_ );
+
+   return syscall( SYS_mbind, begin, end-begin, mode, nodes, maxnodes, MPOL_MF_MOVE_ ) == 0L;
+#else
+   MAYBE_UNUSED( address, size, interleave, node );
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Interleaves the given memory range across all NUMA nodes.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory range.
+// \param size The size of the memory range in bytes.
+// \return \a true in case the memory policy was successfully set, \a false if not.
+//
+// This function distributes the pages of the given memory range round-robin across all NUMA
+// nodes the calling process is allowed to use. Pages that have already been touched are moved
+// accordingly, all other pages are placed as soon as they are touched for the first time. Only
+// pages that lie completely within the given range are affected. NUMA placement is only
+// supported on Linux systems. On all other systems the function has no effect and returns
+// \a false.
+*/
+inline bool interleaveMemory( const void* address, size_t size ) noexcept
+{
+   return mbind_backend( address, size, true, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given memory range to the given NUMA node.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory range.
+// \param size The size of the memory range in bytes.
+// \param node The index of the NUMA node.
+// \return \a true in case the memory policy was successfully set, \a false if not.
+//
+// This function places all pages of the given memory range on the given NUMA node. Pages that
+// have already been touched are moved accordingly, all other pages are placed as soon as they
+// are touched for the first time. Only pages that lie completely within the given range are
+// affected. NUMA placement is only supported on Linux systems. On all other systems the
+// function has no effect and returns \a false.
+*/
+inline bool bindMemory( const void* address, size_t size, size_t node ) noexcept
+{
+   return mbind_backend( address, size, false, node );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
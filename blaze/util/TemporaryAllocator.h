@@ -0,0 +1,422 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/TemporaryAllocator.h
+//  \brief Header file for the TemporaryAllocator implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TEMPORARYALLOCATOR_H_
+#define _BLAZE_UTIL_TEMPORARYALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Assert.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/TemporaryScope.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocator for the evaluation temporaries of Blaze.
+// \ingroup util
+//
+// The TemporaryAllocator class template represents an implementation of the allocator concept
+// of the standard library for the allocation of type-specific, aligned, uninitialized memory
+// for short-lived temporaries. While a TemporaryScope is active on the current thread, the
+// allocator places all memory in the thread-local arena of the scope. In case no scope is
+// active or the arena is exhausted, the allocator falls back to a dynamic aligned allocation.
+// Each allocation records the arena it was taken from, such that the memory can be released
+// by any thread. However, all memory allocated via a TemporaryAllocator has to be released
+// before the end of the scope that was active during the allocation.\n
+// The TemporaryAllocator is used internally by Blaze for all temporaries that are created
+// during the evaluation of an expression (see for instance the TemporaryType type trait). It
+// should not be used for any vector or matrix that outlives the current TemporaryScope.
+*/
+template< typename Type >
+class TemporaryAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ValueType      = Type;            //!< Type of the allocated values.
+   using Pointer        = Type*;           //!< Type of a pointer to the allocated values.
+   using ConstPointer   = const Type*;     //!< Type of a pointer-to-const to the allocated values.
+   using Reference      = Type&;           //!< Type of a reference to the allocated values.
+   using ConstReference = const Type&;     //!< Type of a reference-to-const to the allocated values.
+   using SizeType       = std::size_t;     //!< Size type of the temporary allocator.
+   using DifferenceType = std::ptrdiff_t;  //!< Difference type of the temporary allocator.
+
+   // STL allocator requirements
+   using value_type      = ValueType;       //!< Type of the allocated values.
+   using pointer         = Pointer;         //!< Type of a pointer to the allocated values.
+   using const_pointer   = ConstPointer;    //!< Type of a pointer-to-const to the allocated values.
+   using reference       = Reference;       //!< Type of a reference to the allocated values.
+   using const_reference = ConstReference;  //!< Type of a reference-to-const to the allocated values.
+   using size_type       = SizeType;        //!< Size type of the temporary allocator.
+   using difference_type = DifferenceType;  //!< Difference type of the temporary allocator.
+   //**********************************************************************************************
+
+   //**rebind class definition*********************************************************************
+   /*!\brief Implementation of the TemporaryAllocator rebind mechanism.
+   */
+   template< typename Type2 >
+   struct rebind
+   {
+      using other = TemporaryAllocator<Type2>;  //!< Type of the other allocator.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline TemporaryAllocator();
+
+   template< typename Type2 >
+   inline TemporaryAllocator( const TemporaryAllocator<Type2>& );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline constexpr size_t max_size() const noexcept;
+   inline Pointer          address( Reference x ) const noexcept;
+   inline ConstPointer     address( ConstReference x ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline Pointer allocate  ( size_t numObjects, const void* localityHint = nullptr );
+   inline void    deallocate( Pointer ptr, size_t numObjects ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Construction functions**********************************************************************
+   /*!\name Construction functions */
+   //@{
+   template< typename... Args >
+   inline void construct( Pointer ptr, Args&&... args );
+
+   inline void destroy( Pointer ptr ) noexcept;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for TemporaryAllocator.
+*/
+template< typename Type >
+inline TemporaryAllocator<Type>::TemporaryAllocator()
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different TemporaryAllocator instances.
+//
+// \param allocator The foreign temporary allocator to be copied.
+*/
+template< typename Type >
+template< typename Type2 >
+inline TemporaryAllocator<Type>::TemporaryAllocator( const TemporaryAllocator<Type2>& allocator )
+{
+   MAYBE_UNUSED( allocator );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the maximum possible number of elements that can be allocated together.
+//
+// \return The maximum number of elements that can be allocated together.
+*/
+template< typename Type >
+inline constexpr size_t TemporaryAllocator<Type>::max_size() const noexcept
+{
+   return size_t(-1) / sizeof( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the given element.
+//
+// \return The address of the given element.
+*/
+template< typename Type >
+inline typename TemporaryAllocator<Type>::Pointer
+   TemporaryAllocator<Type>::address( Reference x ) const noexcept
+{
+   return &x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the given element.
+//
+// \return The address of the given element.
+*/
+template< typename Type >
+inline typename TemporaryAllocator<Type>::ConstPointer
+   TemporaryAllocator<Type>::address( ConstReference x ) const noexcept
+{
+   return &x;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates aligned memory for the specified number of objects.
+//
+// \param numObjects The number of objects to be allocated.
+// \param localityHint Hint for improved locality.
+// \return Pointer to the newly allocated memory.
+//
+// This function allocates a junk of memory for the specified number of objects of type \a Type.
+// While a TemporaryScope is active on the current thread, the memory is taken from the arena of
+// the scope. In case no scope is active or the arena is exhausted, the memory is allocated
+// dynamically. In both cases the returned pointer is guaranteed to be aligned according to the
+// alignment restrictions of the data type \a Type. The arena the memory was taken from (if any)
+// is stored in a small header in front of the returned memory.
+*/
+template< typename Type >
+inline typename TemporaryAllocator<Type>::Pointer
+   TemporaryAllocator<Type>::allocate( size_t numObjects, const void* localityHint )
+{
+   MAYBE_UNUSED( localityHint );
+
+   constexpr size_t alignment ( ( AlignmentOf_v<Type> < alignof( TemporaryArena* ) )
+                                ?( alignof( TemporaryArena* ) )
+                                :( AlignmentOf_v<Type> ) );
+   constexpr size_t headersize( ( sizeof( TemporaryArena* ) < alignment )
+                                ?( alignment )
+                                :( sizeof( TemporaryArena* ) ) );
+
+   BLAZE_INTERNAL_ASSERT( headersize % alignment == 0UL, "Invalid header size detected" );
+
+   const size_t bytes( numObjects*sizeof(Type) + headersize );
+
+   TemporaryArena* arena( &theTemporaryArena() );
+   byte_t* raw( static_cast<byte_t*>( arena->allocate( bytes, alignment ) ) );
+
+   if( raw == nullptr ) {
+      arena = nullptr;
+      raw   = allocate_backend( bytes, alignment );
+   }
+
+   *reinterpret_cast<TemporaryArena**>( raw ) = arena;
+
+   return reinterpret_cast<Pointer>( raw + headersize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory.
+//
+// \param ptr The address of the first element of the array to be deallocated.
+// \param numObjects The number of objects to be deallocated.
+// \return void
+//
+// This function deallocates a junk of memory that was previously allocated via the allocate()
+// function. Note that the argument \a numObjects must be equal ot the first argument of the call
+// to allocate() that origianlly produced \a ptr. The memory may be deallocated by any thread:
+// Dynamically allocated memory is released immediately. Memory taken from the arena of the
+// calling thread is returned to the arena, memory taken from the arena of another thread is
+// released at the end of the according scope of this thread. In the latter case the arena of
+// the other thread is not accessed.
+*/
+template< typename Type >
+inline void TemporaryAllocator<Type>::deallocate( Pointer ptr, size_t numObjects ) noexcept
+{
+   if( ptr == nullptr )
+      return;
+
+   constexpr size_t alignment ( ( AlignmentOf_v<Type> < alignof( TemporaryArena* ) )
+                                ?( alignof( TemporaryArena* ) )
+                                :( AlignmentOf_v<Type> ) );
+   constexpr size_t headersize( ( sizeof( TemporaryArena* ) < alignment )
+                                ?( alignment )
+                                :( sizeof( TemporaryArena* ) ) );
+
+   byte_t* const raw( reinterpret_cast<byte_t*>( ptr ) - headersize );
+   TemporaryArena* const arena( *reinterpret_cast<TemporaryArena**>( raw ) );
+
+   if( arena == nullptr ) {
+      deallocate_backend( raw );
+   }
+   else if( arena == &theTemporaryArena() ) {
+      arena->deallocate( raw, numObjects*sizeof(Type) + headersize );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructs an object of type \a Type at the specified memory location.
+//
+// \param ptr Pointer to the allocated, uninitialized storage.
+// \param args The constructor arguments.
+// \return void
+//
+// This function constructs an object of type \a Type in the allocated, uninitialized storage
+// pointed to by \a ptr. This construction is performed via placement-new.
+*/
+template< typename Type >
+template< typename... Args >
+inline void TemporaryAllocator<Type>::construct( Pointer ptr, Args&&... args )
+{
+   ::new( ptr ) Type( std::forward<Args>( args )... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys the object of type \a Type at the specified memory location.
+//
+// \param ptr Pointer to the object to be destroyed.
+// \return void
+//
+// This function destroys the object at the specified memory location via a direct call to its
+// destructor.
+*/
+template< typename Type >
+inline void TemporaryAllocator<Type>::destroy( Pointer ptr ) noexcept
+{
+   ptr->~Type();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name TemporaryAllocator operators */
+//@{
+template< typename T1, typename T2 >
+inline bool operator==( const TemporaryAllocator<T1>& lhs, const TemporaryAllocator<T2>& rhs ) noexcept;
+
+template< typename T1, typename T2 >
+inline bool operator!=( const TemporaryAllocator<T1>& lhs, const TemporaryAllocator<T2>& rhs ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two TemporaryAllocator objects.
+//
+// \param lhs The left-hand side temporary allocator.
+// \param rhs The right-hand side temporary allocator.
+// \return \a true.
+*/
+template< typename T1    // Type of the left-hand side temporary allocator
+        , typename T2 >  // Type of the right-hand side temporary allocator
+inline bool operator==( const TemporaryAllocator<T1>& lhs, const TemporaryAllocator<T2>& rhs ) noexcept
+{
+   MAYBE_UNUSED( lhs, rhs );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two TemporaryAllocator objects.
+//
+// \param lhs The left-hand side temporary allocator.
+// \param rhs The right-hand side temporary allocator.
+// \return \a false.
+*/
+template< typename T1    // Type of the left-hand side temporary allocator
+        , typename T2 >  // Type of the right-hand side temporary allocator
+inline bool operator!=( const TemporaryAllocator<T1>& lhs, const TemporaryAllocator<T2>& rhs ) noexcept
+{
+   MAYBE_UNUSED( lhs, rhs );
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
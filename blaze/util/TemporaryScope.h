@@ -0,0 +1,624 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/TemporaryScope.h
+//  \brief Header file for the TemporaryScope class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TEMPORARYSCOPE_H_
+#define _BLAZE_UTIL_TEMPORARYSCOPE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TEMPORARYARENA
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread-local bump arena for the evaluation temporaries of Blaze.
+// \ingroup util
+//
+// The TemporaryArena class represents the memory arena that serves all allocations of the
+// TemporaryAllocator class template while a TemporaryScope is active on the current thread.
+// Each thread owns a single arena (see the theTemporaryArena() function), which keeps its
+// buffer until the thread terminates. Thus after the first scope of the required size has
+// been opened, no further dynamic memory is requested from the system. Allocations are served
+// by simply bumping the current top of the arena. Deallocations of the most recent allocation
+// immediately release the memory, all other memory is released at the end of the scope.
+*/
+class TemporaryArena
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TemporaryArena() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TemporaryArena();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t capacity () const noexcept;
+   inline size_t used     () const noexcept;
+   inline size_t highWater() const noexcept;
+   inline size_t misses   () const noexcept;
+   inline bool   isActive () const noexcept;
+   inline void   reset    () noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline void* allocate  ( size_t bytes, size_t alignment ) noexcept;
+   inline bool  deallocate( const void* address, size_t bytes ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Scope functions*****************************************************************************
+   /*!\name Scope functions */
+   //@{
+   inline size_t open ( size_t bytes );
+   inline void   close( size_t mark ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t* buffer_;     //!< The memory buffer of the arena.
+   size_t  capacity_;   //!< The total number of bytes of the memory buffer.
+   size_t  top_;        //!< The number of bytes currently in use.
+   size_t  highWater_;  //!< The maximum number of bytes required so far.
+   size_t  misses_;     //!< The number of allocations that could not be served by the arena.
+   size_t  depth_;      //!< The number of currently active scopes.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the TemporaryArena class.
+*/
+inline TemporaryArena::TemporaryArena() noexcept
+   : buffer_   ( nullptr )  // The memory buffer of the arena
+   , capacity_ ( 0UL )      // The total number of bytes of the memory buffer
+   , top_      ( 0UL )      // The number of bytes currently in use
+   , highWater_( 0UL )      // The maximum number of bytes required so far
+   , misses_   ( 0UL )      // The number of allocations that could not be served by the arena
+   , depth_    ( 0UL )      // The number of currently active scopes
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the TemporaryArena class.
+*/
+inline TemporaryArena::~TemporaryArena()
+{
+   deallocate_backend( buffer_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of bytes of the arena.
+//
+// \return The total number of bytes of the arena.
+*/
+inline size_t TemporaryArena::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes of the arena that are currently in use.
+//
+// \return The number of bytes currently in use.
+*/
+inline size_t TemporaryArena::used() const noexcept
+{
+   return top_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of bytes that has been required so far.
+//
+// \return The high-water mark of the arena.
+//
+// This function returns the maximum number of bytes that has been in use at any time since
+// the construction of the arena or the last call to reset(). In case an allocation could not
+// be served by the arena, the high-water mark includes the number of bytes that would have
+// been required to serve this allocation.
+*/
+inline size_t TemporaryArena::highWater() const noexcept
+{
+   return highWater_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of allocations that could not be served by the arena.
+//
+// \return The number of allocations that fell back to the default aligned allocation.
+*/
+inline size_t TemporaryArena::misses() const noexcept
+{
+   return misses_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a scope is currently active for the arena.
+//
+// \return \a true in case a scope is active, \a false if not.
+*/
+inline bool TemporaryArena::isActive() const noexcept
+{
+   return depth_ > 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the high-water mark and the number of misses of the arena.
+//
+// \return void
+*/
+inline void TemporaryArena::reset() noexcept
+{
+   highWater_ = top_;
+   misses_    = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates the given number of bytes from the arena.
+//
+// \param bytes The number of bytes to be allocated.
+// \param alignment The required alignment of the memory (must be a power of two).
+// \return Pointer to the allocated memory or \a nullptr if the memory cannot be served.
+//
+// This function tries to allocate the given number of bytes with the given alignment from the
+// arena. In case no scope is active or the remaining memory of the arena is not sufficient,
+// the function returns \a nullptr. In the latter case the allocation is counted as miss. In
+// case the HPX parallelization is active, the function always returns \a nullptr.
+*/
+inline void* TemporaryArena::allocate( size_t bytes, size_t alignment ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( ( alignment & ( alignment - 1UL ) ) == 0UL, "Invalid alignment detected" );
+
+   if( BLAZE_HPX_PARALLEL_MODE || depth_ == 0UL )
+      return nullptr;
+
+   const size_t base  ( reinterpret_cast<size_t>( buffer_ ) );
+   const size_t offset( ( ( base + top_ + alignment - 1UL ) & ~( alignment - 1UL ) ) - base );
+
+   if( offset + bytes > highWater_ )
+      highWater_ = offset + bytes;
+
+   if( offset >= capacity_ || bytes > capacity_ - offset ) {
+      ++misses_;
+      return nullptr;
+   }
+
+   top_ = offset + bytes;
+
+   return buffer_ + offset;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocates the given memory.
+//
+// \param address The address of the first byte of the memory to be deallocated.
+// \param bytes The number of bytes to be deallocated.
+// \return \a true in case the memory belongs to the arena, \a false if not.
+//
+// This function releases the given memory in case it belongs to the arena. In case the memory
+// was allocated last, it is immediately available for subsequent allocations, all other memory
+// is released at the end of the current scope. In case the memory does not belong to the arena,
+// the function returns \a false and the memory has to be released by the caller.
+*/
+inline bool TemporaryArena::deallocate( const void* address, size_t bytes ) noexcept
+{
+   const byte_t* const ptr( static_cast<const byte_t*>( address ) );
+
+   if( ptr < buffer_ || ptr >= buffer_ + capacity_ )
+      return false;
+
+   if( ptr + bytes == buffer_ + top_ ) {
+      top_ = ptr - buffer_;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCOPE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Opens a new scope on the arena.
+//
+// \param bytes The requested minimum capacity of the arena.
+// \return The current top of the arena, which has to be passed to the according call to close().
+// \exception std::bad_alloc Allocation failed.
+//
+// This function opens a new scope on the arena. In case the arena is not used by any other
+// scope and the current capacity is smaller than the requested number of bytes, the buffer
+// of the arena is enlarged. Else the buffer remains unchanged.
+*/
+inline size_t TemporaryArena::open( size_t bytes )
+{
+   if( top_ == 0UL && bytes > capacity_ )
+   {
+      byte_t* const tmp( allocate_backend( bytes, 64UL ) );
+      deallocate_backend( buffer_ );
+      buffer_   = tmp;
+      capacity_ = bytes;
+   }
+
+   ++depth_;
+
+   return top_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Closes the current scope of the arena.
+//
+// \param mark The top of the arena at the time the scope was opened.
+// \return void
+//
+// This function closes the current scope and releases all memory that has been allocated
+// since the scope was opened.
+*/
+inline void TemporaryArena::close( size_t mark ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( depth_ > 0UL, "No active scope detected" );
+
+   top_ = mark;
+   --depth_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEMPORARYARENA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the temporary arena of the calling thread.
+// \ingroup util
+//
+// \return Reference to the temporary arena of the calling thread.
+*/
+inline TemporaryArena& theTemporaryArena() noexcept
+{
+   thread_local TemporaryArena arena;
+   return arena;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPORARYSCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope for the arena allocation of the evaluation temporaries of Blaze.
+// \ingroup util
+//
+// The evaluation of many expressions requires the creation of temporary vectors and matrices
+// (as for instance the evaluation of the operands of a dense matrix multiplication or the
+// packing buffers of the matrix multiplication kernels). By default, these temporaries are
+// dynamically allocated and released on every assignment. The TemporaryScope class enables
+// the allocation of all these internal temporaries from a thread-local bump arena:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D;
+   // ... Resizing and initialization
+
+   for( ... )
+   {
+      blaze::TemporaryScope scope( 1048576UL );  // Arena of 1 MiB
+
+      D = ( A + B ) * C;  // The evaluation of (A+B) is placed in the arena
+   }
+   \endcode
+
+// While a TemporaryScope is active, all temporaries that Blaze creates internally during the
+// evaluation of an expression on the current thread are placed in the arena. The arena itself
+// is owned by the thread and keeps its memory across scopes. Thus only the first scope of a
+// given size requests memory from the system, all following scopes run without any dynamic
+// memory allocation. In case the arena is not large enough to hold a temporary, the temporary
+// is allocated dynamically as usual. In order to find the required size of the arena, the
+// highWater() and misses() functions report the maximum number of bytes that has been required
+// and the number of temporaries that could not be placed in the arena:
+
+   \code
+   std::cout << "Required arena size: " << scope.highWater() << " bytes\n"
+             << "Missed temporaries : " << scope.misses() << "\n";
+   \endcode
+
+// Note that the arena is only used for temporaries that never leave an assignment. Vectors and
+// matrices that are created by the user, including the result of the evaluate() function, are
+// never placed in the arena. Also note that scopes can be nested, but that the arena can only
+// be enlarged as long as it does not hold any temporaries. In case the HPX parallelization is
+// active, the arena is not used since HPX tasks may migrate between the threads of the system.
+*/
+class TemporaryScope
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TemporaryScope( size_t bytes );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TemporaryScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t capacity () const noexcept;
+   inline size_t used     () const noexcept;
+   inline size_t highWater() const noexcept;
+   inline size_t misses   () const noexcept;
+   inline void   reset    () noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   TemporaryArena& arena_;  //!< The temporary arena of the current thread.
+   const size_t mark_;      //!< The top of the arena at the time the scope was opened.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the TemporaryScope class.
+//
+// \param bytes The requested size of the arena in bytes.
+// \exception std::bad_alloc Allocation failed.
+//
+// This constructor activates the temporary arena of the current thread. In case the arena is
+// not used by an enclosing scope and its current size is smaller than the requested number
+// of bytes, the arena is enlarged accordingly.
+*/
+inline TemporaryScope::TemporaryScope( size_t bytes )
+   : arena_( theTemporaryArena() )    // The temporary arena of the current thread
+   , mark_ ( arena_.open( bytes ) )  // The top of the arena at the time the scope was opened
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the TemporaryScope class.
+//
+// The destructor releases all temporaries that have been placed in the arena since the
+// construction of the scope and deactivates the arena in case this is the outermost scope.
+*/
+inline TemporaryScope::~TemporaryScope()
+{
+   arena_.close( mark_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of bytes of the arena.
+//
+// \return The total number of bytes of the arena.
+*/
+inline size_t TemporaryScope::capacity() const noexcept
+{
+   return arena_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes of the arena that are currently in use.
+//
+// \return The number of bytes currently in use.
+*/
+inline size_t TemporaryScope::used() const noexcept
+{
+   return arena_.used();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of bytes that has been required so far.
+//
+// \return The high-water mark of the arena.
+//
+// This function returns the maximum number of bytes of the arena of the current thread that
+// has been required at any time since the start of the thread or the last call to reset().
+// In case no temporary had to be allocated dynamically (see the misses() function), an arena
+// of this size is able to hold all temporaries of this time span. Else the high-water mark
+// only represents a lower bound of the required size.
+*/
+inline size_t TemporaryScope::highWater() const noexcept
+{
+   return arena_.highWater();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of temporaries that could not be placed in the arena.
+//
+// \return The number of temporaries that have been allocated dynamically.
+*/
+inline size_t TemporaryScope::misses() const noexcept
+{
+   return arena_.misses();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the high-water mark and the number of misses of the arena.
+//
+// \return void
+*/
+inline void TemporaryScope::reset() noexcept
+{
+   arena_.reset();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
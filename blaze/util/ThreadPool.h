@@ -40,14 +40,21 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <thread>
 #include <vector>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/InjectionQueue.h>
 #include <blaze/util/threadpool/Task.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
@@ -189,8 +196,52 @@ namespace blaze {
    }
    \endcode
 
-// Note that the ThreadPool class template schedule() function allows for up to five arguments
-// for the given functions/functors.
+// Note that the schedule() function stores copies of the given function/functor and of the given
+// arguments inside the task. Arguments that have to be passed by reference must be wrapped via
+// \c std::ref() or \c std::cref().
+//
+//
+// \section threadpool_scheduling Scheduling strategy
+//
+// Every thread of the pool owns a lock-free work-stealing task queue (see the TaskQueue class
+// description). Tasks scheduled from within a thread of the pool are pushed to the task queue
+// of this thread. Every other thread scheduling tasks is assigned a task queue of its own on
+// its first call of schedule() or scheduleOn(), to which it pushes all of its tasks. Idle
+// threads take tasks from their own task queue first, then from the task queues of the external
+// threads and finally steal tasks from the task queues of the other threads. Thus the scheduling
+// of a task neither requires to lock any mutex nor to wait for any other scheduling thread. The
+// tasks are stored in recycled task records, i.e. after a short warm-up phase no dynamic memory
+// is allocated during the scheduling of tasks.
+//
+// In case no task is available, a thread spins for a short while before it is parked on a
+// condition variable. The number of spin iterations adapts to the frequency of the scheduled
+// tasks. Additionally, a thread calling the wait() function helps with the execution of the
+// scheduled tasks. This considerably reduces the latency of short, frequently scheduled tasks.
+//
+//
+// \section threadpool_affinity Thread affinity
+//
+// Additionally to its task queue, every thread owns a mailbox for tasks that are explicitly
+// scheduled for this thread via the scheduleOn() function. The mailbox is a lock-free injection
+// queue, to which any thread can push tasks without waiting (see the InjectionQueue class
+// description). A thread takes tasks from its mailbox before it considers the task queues of
+// the external threads and other threads only steal from a mailbox in case no other task is
+// available. In combination with pinned threads this enables to keep tasks
+// that work on the same data on the same core and cache:
+
+   \code
+   // Creating a thread pool with four threads pinned to the logical CPUs 0, 2, 4, and 6
+   StdThreadPool threadpool( 4, { 0, 2, 4, 6 } );
+
+   // Scheduling a task for the second thread (i.e. for logical CPU 2)
+   threadpool.scheduleOn( 1, task, 1.0 );
+
+   // Pinning the threads to the logical CPUs 0 to 3
+   threadpool.pin( { 0, 1, 2, 3 } );
+   \endcode
+
+// The thread with index \a i is pinned to the logical CPU \a cpus[i % cpus.size()]. In case the
+// operating system does not support thread pinning, the threads silently remain unpinned.
 //
 //
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
@@ -319,17 +370,69 @@ class ThreadPool
    //! Type of the thread container.
    using Threads = std::vector< std::unique_ptr<ManagedThread> >;
 
-   using TaskQueue = threadpool::TaskQueue;  //!< Type of the task queue.
-   using Mutex     = MT;                     //!< Type of the mutex.
-   using Lock      = LT;                     //!< Type of a locking object.
-   using Condition = CT;                     //!< Condition variable type.
+   using Task           = threadpool::Task;            //!< Type of a single task.
+   using TaskQueue      = threadpool::TaskQueue;       //!< Type of the task queues.
+   using InjectionQueue = threadpool::InjectionQueue;  //!< Type of the mailboxes.
+   using Mutex          = MT;                          //!< Type of the mutex.
+   using Lock           = LT;                          //!< Type of a locking object.
+   using Condition      = CT;                          //!< Condition variable type.
+   //**********************************************************************************************
+
+   //**Private class Slot**************************************************************************
+   /*!\brief The task queues of a single thread of the pool.
+   */
+   struct Slot
+   {
+      TaskQueue      queue;    //!< Task queue for the tasks scheduled by the thread itself.
+      InjectionQueue mailbox;  //!< Queue for the tasks explicitly scheduled on the thread.
+   };
+   //**********************************************************************************************
+
+   //**Private class Source************************************************************************
+   /*!\brief The task queue of a single external thread scheduling tasks.
+   */
+   struct Source
+   {
+      std::thread::id owner;  //!< The ID of the thread owning the task queue.
+      TaskQueue       queue;  //!< Task queue for the tasks scheduled by the thread.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Slots     = std::vector< std::unique_ptr<Slot> >;           //!< Container for slots.
+   using Victims   = std::vector<Slot*>;                             //!< Slots to steal from.
+   using Snapshots = std::vector< std::unique_ptr<const Victims> >;  //!< Container for victims.
+
+   using Sources   = std::vector< std::unique_ptr<Source> >;         //!< Container for sources.
+   using Origins   = std::vector<Source*>;                           //!< Sources to steal from.
+   using Registry  = std::vector< std::unique_ptr<const Origins> >;  //!< Container for origins.
+   //**********************************************************************************************
+
+   //**Private class Context***********************************************************************
+   /*!\brief Execution context of a single thread.
+   */
+   struct Context
+   {
+      const ThreadPool* pool;      //!< The thread pool the thread belongs to.
+      Slot*             slot;      //!< The task queues owned by the thread.
+      size_t            index;     //!< The index of the task queues owned by the thread.
+      size_t            spins;     //!< The current number of spin iterations before parking.
+      size_t            affinity;  //!< The version of the applied thread affinity.
+      size_t            origin;    //!< The ID of the pool of the cached external task queue.
+      TaskQueue*        source;    //!< The cached external task queue of the thread.
+   };
+   //**********************************************************************************************
+
+   //**Compile time constants**********************************************************************
+   static constexpr size_t minSpins = 16UL;    //!< Minimum number of spin iterations.
+   static constexpr size_t maxSpins = 1024UL;  //!< Maximum number of spin iterations.
    //**********************************************************************************************
 
  public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, const std::vector<size_t>& cpus = std::vector<size_t>() );
    //@}
    //**********************************************************************************************
 
@@ -355,6 +458,9 @@ class ThreadPool
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void scheduleOn( size_t thread, Callable func, Args&&... args );
    //@}
    //**********************************************************************************************
 
@@ -364,6 +470,7 @@ class ThreadPool
    void resize( size_t n, bool block=false );
    void wait();
    void clear();
+   void pin( const std::vector<size_t>& cpus );
    //@}
    //**********************************************************************************************
 
@@ -372,23 +479,56 @@ class ThreadPool
    /*!\name Thread functions */
    //@{
    void createThread();
-   bool executeTask();
+   bool executeTask( size_t index );
+   //@}
+   //**********************************************************************************************
+
+   //**Task functions******************************************************************************
+   /*!\name Task functions */
+   //@{
+   inline Task*      acquireTask  ( const Context& context );
+   inline void       runTask      ( Task* task );
+   inline void       finishTask   ();
+          void       discardTasks ();
+          void       applyAffinity( Context& context );
+          TaskQueue& sourceQueue  ( Context& context );
+          TaskQueue& createSource ( Context& context );
+   //@}
+   //**********************************************************************************************
+
+   //**Context functions***************************************************************************
+   /*!\name Context functions */
+   //@{
+   static inline Context& context() noexcept;
+   static inline size_t   nextID () noexcept;
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile size_t total_;     //!< Total number of threads in the thread pool.
-   volatile size_t expected_;  //!< Expected number of threads in the thread pool.
-                               /*!< This number may differ from the total number of threads
-                                    during a resize of the thread pool. */
-   volatile size_t active_;    //!< Number of currently active/busy threads.
-   Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
-   mutable Mutex mutex_;       //!< Synchronization mutex.
-   Condition waitForTask_;     //!< Wait condition for idle threads.
-   Condition waitForThread_;   //!< Wait condition for the thread management.
+   volatile size_t total_;                 //!< Total number of threads in the thread pool.
+   volatile size_t expected_;              //!< Expected number of threads in the thread pool.
+                                           /*!< This number may differ from the total number of
+                                                threads during a resize of the thread pool. */
+   std::atomic<size_t> active_;            //!< Number of currently active/busy threads.
+   std::atomic<size_t> sleeping_;          //!< Number of currently parked threads.
+   std::atomic<size_t> queued_;            //!< Number of scheduled, not yet started tasks.
+   std::atomic<size_t> unfinished_;        //!< Number of scheduled, not yet completed tasks.
+   const size_t id_;                       //!< The unique ID of the thread pool.
+   Threads threads_;                       //!< The threads contained in the thread pool.
+   Slots slots_;                           //!< The task queues of the threads of the pool.
+   Sources sources_;                       //!< The task queues of the external threads.
+   Registry registry_;                     //!< All published sets of external task queues.
+   std::atomic<const Origins*> origins_;   //!< The current set of external task queues.
+   std::vector<size_t> unused_;            //!< Indices of currently unused slots.
+   Snapshots snapshots_;                   //!< All published sets of victim slots.
+   std::atomic<const Victims*> victims_;   //!< The current set of victim slots.
+   std::vector<size_t> cpus_;              //!< The logical CPUs the threads are pinned to.
+   std::atomic<size_t> affinity_;          //!< The version of the thread affinity.
+   mutable Mutex mutex_;                   //!< Synchronization mutex.
+   Condition waitForTask_;                 //!< Wait condition for idle threads.
+   Condition waitForThread_;               //!< Wait condition for the thread management.
    //@}
    //**********************************************************************************************
 
@@ -413,6 +553,7 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param cpus The logical CPUs the threads are pinned to (see the pin() function).
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
 // initially idle until a task is scheduled.
@@ -421,16 +562,34 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
-   : total_   ( 0UL )  // Total number of threads in the thread pool
-   , expected_( 0UL )  // Expected number of threads in the thread pool
-   , active_  ( 0UL )  // Number of currently active/busy threads
-   , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
-   , mutex_        ()  // Synchronization mutex
-   , waitForTask_  ()  // Wait condition for idle threads
-   , waitForThread_()  // Wait condition for the thread management
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, const std::vector<size_t>& cpus )
+   : total_     ( 0UL )      // Total number of threads in the thread pool
+   , expected_  ( 0UL )      // Expected number of threads in the thread pool
+   , active_    ( 0UL )      // Number of currently active/busy threads
+   , sleeping_  ( 0UL )      // Number of currently parked threads
+   , queued_    ( 0UL )      // Number of scheduled, not yet started tasks
+   , unfinished_( 0UL )      // Number of scheduled, not yet completed tasks
+   , id_        ( nextID() ) // The unique ID of the thread pool
+   , threads_        ()      // The threads contained in the thread pool
+   , slots_          ()      // The task queues of the threads of the pool
+   , sources_        ()      // The task queues of the external threads
+   , registry_       ()      // All published sets of external task queues
+   , origins_   ( nullptr )  // The current set of external task queues
+   , unused_         ()      // Indices of currently unused slots
+   , snapshots_      ()      // All published sets of victim slots
+   , victims_   ( nullptr )  // The current set of victim slots
+   , cpus_      ( cpus )     // The logical CPUs the threads are pinned to
+   , affinity_  ( cpus.empty() ? 0UL : 1UL )  // The version of the thread affinity
+   , mutex_          ()      // Synchronization mutex
+   , waitForTask_    ()      // Wait condition for idle threads
+   , waitForThread_  ()      // Wait condition for the thread management
 {
+   snapshots_.emplace_back( new Victims() );
+   victims_.store( snapshots_.back().get(), std::memory_order_release );
+
+   registry_.emplace_back( new Origins() );
+   origins_.store( registry_.back().get(), std::memory_order_release );
+
    resize( n );
 }
 //*************************************************************************************************
@@ -447,7 +606,7 @@ ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
 //*************************************************************************************************
 /*!\brief Destructor for the ThreadPool class.
 //
-// The destructor clears all remaining tasks from the task queue and waits for the currently
+// The destructor clears all remaining tasks from the task queues and waits for the currently
 // active threads to complete their tasks.
 */
 template< typename TT    // Type of the encapsulated thread
@@ -459,7 +618,7 @@ ThreadPool<TT,MT,LT,CT>::~ThreadPool()
    Lock lock( mutex_ );
 
    // Removing all currently queued tasks
-   taskqueue_.clear();
+   discardTasks();
 
    // Setting the expected number of threads
    expected_ = 0UL;
@@ -502,8 +661,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
-   Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return queued_ == 0UL;
 }
 //*************************************************************************************************
 
@@ -529,6 +687,9 @@ inline size_t ThreadPool<TT,MT,LT,CT>::size() const
 /*!\brief Returns the number of currently active/busy threads.
 //
 // \return The number of currently active threads.
+//
+// This function returns the number of threads that are currently executing or searching for
+// tasks, i.e. all threads that are not parked.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -536,7 +697,6 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadPool<TT,MT,LT,CT>::active() const
 {
-   Lock lock( mutex_ );
    return active_;
 }
 //*************************************************************************************************
@@ -576,7 +736,10 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //
 // This function schedules the given function/functor for execution. The given function/functor
 // must be copyable, must be callable with the given type and number of arguments and must return
-// \c void.
+// \c void. Tasks scheduled from within a thread of the pool are pushed to the task queue of
+// the according thread, all other tasks are pushed to the task queue of the scheduling thread
+// (which is created on its first call of schedule() or scheduleOn()). In both cases the task
+// is stored in a recycled task record and therefore no dynamic memory is allocated.
 */
 template< typename TT         // Type of the encapsulated thread
         , typename MT         // Type of the synchronization mutex
@@ -586,9 +749,59 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
-   waitForTask_.notify_one();
+   // Announcing the task before it becomes visible to any other thread
+   ++unfinished_;
+   ++queued_;
+
+   sourceQueue( context() ).push( std::move( func ), std::forward<Args>( args )... );
+
+   // Waking up a parked thread
+   if( sleeping_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution on a specific thread.
+//
+// \param thread The index of the preferred thread of the pool.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution on the thread with the given
+// index (modulo the number of threads of the pool). The task is pushed to the mailbox of the
+// according thread, which takes precedence over the task queues of the external threads and of
+// the other threads of the pool. Therefore
+// tasks that work on the same data can be kept on the same thread and thus on the same core
+// and cache. Note however that the preferred thread is only a hint: In order to balance the
+// load, idle threads are still able to steal the task.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void ThreadPool<TT,MT,LT,CT>::scheduleOn( size_t thread, Callable func, Args&&... args )
+{
+   // Announcing the task before it becomes visible to any other thread
+   ++unfinished_;
+   ++queued_;
+
+   Task* task( sourceQueue( context() ).prepare( std::move( func ), std::forward<Args>( args )... ) );
+
+   const Victims& victims( *victims_.load( std::memory_order_acquire ) );
+   victims[thread % victims.size()]->mailbox.push( task );
+
+   // Waking up a parked thread
+   if( sleeping_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
 }
 //*************************************************************************************************
 
@@ -658,14 +871,8 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
    {
       Lock lock( mutex_ );
 
-      // Adding new threads to the thread pool
-      if( n > expected_ ) {
-         for( size_t i=expected_; i<n; ++i )
-            createThread();
-      }
-
       // Removing threads from the pool
-      else {
+      if( n < expected_ ) {
          expected_ = n;
          waitForTask_.notify_all();
 
@@ -678,10 +885,16 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
       for( typename Threads::iterator thread=threads_.begin(); thread!=threads_.end(); ) {
          if( (*thread)->hasTerminated() ) {
             (*thread)->join();
+            unused_.push_back( (*thread)->index_ );
             thread = threads_.erase( thread );
          }
          else ++thread;
       }
+
+      // Adding new threads to the thread pool
+      for( size_t i=expected_; i<n; ++i ) {
+         createThread();
+      }
    }
 }
 //*************************************************************************************************
@@ -692,7 +905,9 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. While waiting, the calling
+// thread helps with the execution of the scheduled tasks. Only in case no task is left to be
+// started, the calling thread spins for a short while and is parked afterwards.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -700,10 +915,25 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::wait()
 {
-   Lock lock( mutex_ );
+   const Context& ctx( context() );
+   size_t spins( 0UL );
 
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
-      waitForThread_.wait( lock );
+   while( unfinished_ > 0UL )
+   {
+      if( Task* task = acquireTask( ctx ) ) {
+         runTask( task );
+         spins = 0UL;
+      }
+      else if( spins < maxSpins ) {
+         std::this_thread::yield();
+         ++spins;
+      }
+      else {
+         Lock lock( mutex_ );
+         while( unfinished_ > 0UL ) {
+            waitForThread_.wait( lock );
+         }
+      }
    }
 }
 //*************************************************************************************************
@@ -724,7 +954,33 @@ template< typename TT    // Type of the encapsulated thread
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
    Lock lock( mutex_ );
-   taskqueue_.clear();
+   discardTasks();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pinning the threads of the pool to the given logical CPUs.
+//
+// \param cpus The logical CPUs the threads are pinned to.
+// \return void
+//
+// This function pins the threads of the pool to the given logical CPUs. The thread with index
+// \a i is pinned to the logical CPU \a cpus[i % cpus.size()]. The threads apply the new affinity
+// the next time they look for a task, threads that are added later on are pinned immediately.
+// Note that an empty list of CPUs does not unpin threads that have already been pinned, but
+// only prevents the pinning of threads. In case a thread cannot be pinned (for instance since
+// the operating system does not support thread pinning), it silently continues unpinned.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::pin( const std::vector<size_t>& cpus )
+{
+   Lock lock( mutex_ );
+   cpus_ = cpus;
+   ++affinity_;
 }
 //*************************************************************************************************
 
@@ -741,6 +997,12 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// This function adds a new thread to the thread pool. The new thread either takes over the
+// unused slot with the smallest index or a new slot is added to the pool. In the latter case a
+// new set of victim slots is published. Previously published sets are kept alive since they
+// might still be used by concurrent steal operations. This function must only be called while
+// the mutex is locked.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -748,7 +1010,27 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
-   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this ) ) );
+   size_t index( slots_.size() );
+
+   if( !unused_.empty() ) {
+      const auto pos( std::min_element( unused_.begin(), unused_.end() ) );
+      index = *pos;
+      unused_.erase( pos );
+   }
+   else {
+      slots_.emplace_back( new Slot() );
+
+      std::unique_ptr<Victims> victims( new Victims() );
+      victims->reserve( slots_.size() );
+      for( auto const& slot : slots_ ) {
+         victims->push_back( slot.get() );
+      }
+
+      victims_.store( victims.get(), std::memory_order_release );
+      snapshots_.push_back( std::move( victims ) );
+   }
+
+   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this, index ) ) );
    ++total_;
    ++expected_;
    ++active_;
@@ -759,46 +1041,381 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
-// \return \a true in case a task was successfully finished, \a false if not.
+// \param index The index of the task queue owned by the calling thread.
+// \return \a true in case the thread should continue, \a false if it should terminate.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// A thread first takes tasks from its own task queue and mailbox, then from the task queues of
+// the external threads and finally steals tasks from the other threads. In case no task is
+// available, the thread spins for a short while before it is parked until new tasks are
+// scheduled. The number of spin iterations adapts to the time between consecutive tasks: It
+// is increased whenever a task was found while spinning and decreased whenever the thread had
+// to be parked.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-bool ThreadPool<TT,MT,LT,CT>::executeTask()
+bool ThreadPool<TT,MT,LT,CT>::executeTask( size_t index )
 {
-   threadpool::Task task;
+   Context& ctx( context() );
+
+   if( ctx.pool != this ) {
+      ctx.pool     = this;
+      ctx.slot     = (*victims_.load( std::memory_order_acquire ))[index];
+      ctx.index    = index;
+      ctx.spins    = minSpins;
+      ctx.affinity = 0UL;
+   }
+
+   if( ctx.affinity != affinity_.load( std::memory_order_relaxed ) ) {
+      applyAffinity( ctx );
+   }
 
    // Acquiring a scheduled task
+   Task* task( acquireTask( ctx ) );
+
+   for( size_t i=0UL; task == nullptr && i<ctx.spins; ++i ) {
+      std::this_thread::yield();
+      if( ( task = acquireTask( ctx ) ) != nullptr ) {
+         ctx.spins = min( 2UL*ctx.spins, size_t( maxSpins ) );
+      }
+   }
+
+   // Executing the task
+   if( task != nullptr ) {
+      runTask( task );
+      return true;
+   }
+
+   // Parking the thread
+   ctx.spins = max( ctx.spins/2UL, size_t( minSpins ) );
+
+   Lock lock( mutex_ );
+
+   --active_;
+   ++sleeping_;
+
+   while( queued_ == 0UL )
    {
+      if( total_ > expected_ ) {
+         --total_;
+         --sleeping_;
+         waitForThread_.notify_all();
+         return false;
+      }
+
+      waitForTask_.wait( lock );
+   }
+
+   --sleeping_;
+   ++active_;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Acquiring a scheduled task.
+//
+// \param ctx The execution context of the calling thread.
+// \return The acquired task or \c nullptr in case no task is available.
+//
+// This function first tries to pop a task from the task queue owned by the calling thread (if
+// any) and to take a task from its mailbox, then tries to steal a task from the task queues of
+// the external threads and finally tries to steal a task from the other threads of the pool.
+// Tasks scheduled for a specific thread are only stolen from its mailbox in case no other task
+// is available.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadPool<TT,MT,LT,CT>::Task*
+   ThreadPool<TT,MT,LT,CT>::acquireTask( const Context& ctx )
+{
+   const bool owner( ctx.pool == this );
+   Task* task( nullptr );
+
+   if( owner && ( task = ctx.slot->queue.pop() ) == nullptr ) {
+      task = ctx.slot->mailbox.pop();
+   }
+   else if( !owner && ctx.origin == id_ ) {
+      task = ctx.source->pop();
+   }
+
+   if( task == nullptr )
+   {
+      const Origins& origins( *origins_.load( std::memory_order_acquire ) );
+      const size_t n( origins.size() );
+
+      for( size_t i=0UL; task == nullptr && i<n; ++i ) {
+         task = origins[(ctx.index+i)%n]->queue.steal();
+      }
+   }
+
+   if( task == nullptr )
+   {
+      const Victims& victims( *victims_.load( std::memory_order_acquire ) );
+      const size_t n( victims.size() );
+      const size_t offset( owner ? ctx.index+1UL : 0UL );
+
+      for( size_t i=0UL; task == nullptr && i<2UL*n; ++i ) {
+         Slot* victim( victims[(offset+i)%n] );
+         if( !owner || victim != ctx.slot ) {
+            task = ( i < n ? victim->queue.steal() : victim->mailbox.pop() );
+         }
+      }
+   }
+
+   if( task != nullptr ) {
+      --queued_;
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing the given task.
+//
+// \param task The task to be executed.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadPool<TT,MT,LT,CT>::runTask( Task* task )
+{
+   (*task)();
+   TaskQueue::release( task );
+   finishTask();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marking a single task as completed.
+//
+// \return void
+//
+// This function decrements the number of unfinished tasks. In case the last unfinished task has
+// been completed, all waiting threads are notified.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadPool<TT,MT,LT,CT>::finishTask()
+{
+   if( unfinished_.fetch_sub( 1UL ) == 1UL ) {
       Lock lock( mutex_ );
+      waitForThread_.notify_all();
+   }
+}
+//*************************************************************************************************
 
-      while( taskqueue_.isEmpty() )
-      {
-         --active_;
-         waitForThread_.notify_all();
 
-         if( total_ > expected_ ) {
-            --total_;
-            return false;
+//*************************************************************************************************
+/*!\brief Removing all scheduled tasks from the task queues.
+//
+// \return void
+//
+// This function removes all currently scheduled tasks from all task queues of the thread pool.
+// This function must only be called while the mutex is locked.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::discardTasks()
+{
+   const auto discard = [this]( auto& queue, auto take )
+   {
+      while( Task* task = ( queue.*take )() ) {
+         --queued_;
+         TaskQueue::release( task );
+         if( unfinished_.fetch_sub( 1UL ) == 1UL ) {
+            waitForThread_.notify_all();
          }
+      }
+   };
+
+   for( auto const& source : sources_ ) {
+      discard( source->queue, &TaskQueue::steal );
+   }
+
+   for( auto const& slot : slots_ ) {
+      discard( slot->mailbox, &InjectionQueue::pop );
+      discard( slot->queue, &TaskQueue::steal );
+   }
+}
+//*************************************************************************************************
+
 
-         waitForTask_.wait( lock );
-         ++active_;
+//*************************************************************************************************
+/*!\brief Pinning the calling thread according to the current thread affinity.
+//
+// \param ctx The execution context of the calling thread.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::applyAffinity( Context& ctx )
+{
+   Lock lock( mutex_ );
+
+   if( !cpus_.empty() ) {
+      threadpool::pinThread( cpus_[ctx.index % cpus_.size()] );
+   }
+
+   ctx.affinity = affinity_.load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the task queue for the tasks scheduled by the calling thread.
+//
+// \param ctx The execution context of the calling thread.
+// \return Reference to the task queue owned by the calling thread.
+//
+// For the threads of the pool, this function returns the task queue of the thread. For all
+// other threads it returns the task queue of the external thread, which is looked up in the
+// current set of external task queues without locking the mutex. Only on the first call of
+// an external thread a new task queue is created (see the createSource() function).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename ThreadPool<TT,MT,LT,CT>::TaskQueue& ThreadPool<TT,MT,LT,CT>::sourceQueue( Context& ctx )
+{
+   if( ctx.pool == this ) {
+      return ctx.slot->queue;
+   }
+
+   if( ctx.origin != id_ )
+   {
+      const std::thread::id id( std::this_thread::get_id() );
+      const Origins& origins( *origins_.load( std::memory_order_acquire ) );
+
+      const auto pos( std::find_if( origins.begin(), origins.end(),
+                                    [id]( const Source* source ) { return source->owner == id; } ) );
+
+      if( pos == origins.end() ) {
+         return createSource( ctx );
       }
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+      ctx.origin = id_;
+      ctx.source = &(*pos)->queue;
    }
 
-   // Executing the task
-   task();
+   return *ctx.source;
+}
+//*************************************************************************************************
 
-   return true;
+
+//*************************************************************************************************
+/*!\brief Creating the task queue for the tasks scheduled by an external thread.
+//
+// \param ctx The execution context of the calling thread.
+// \return Reference to the new task queue owned by the calling thread.
+//
+// This function creates a new task queue for the calling external thread and publishes a new
+// set of external task queues. Previously published sets are kept alive since they might still
+// be used by concurrent steal operations. The task queues of terminated external threads are
+// kept as well, since they might still contain tasks and since the task records of executed
+// tasks are handed back to them. A task queue is taken over by any later thread with the same
+// thread ID.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename ThreadPool<TT,MT,LT,CT>::TaskQueue& ThreadPool<TT,MT,LT,CT>::createSource( Context& ctx )
+{
+   Lock lock( mutex_ );
+
+   sources_.emplace_back( new Source() );
+   sources_.back()->owner = std::this_thread::get_id();
+
+   std::unique_ptr<Origins> origins( new Origins() );
+   origins->reserve( sources_.size() );
+   for( auto const& source : sources_ ) {
+      origins->push_back( source.get() );
+   }
+
+   origins_.store( origins.get(), std::memory_order_release );
+   registry_.push_back( std::move( origins ) );
+
+   ctx.origin = id_;
+   ctx.source = &sources_.back()->queue;
+
+   return *ctx.source;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONTEXT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the execution context of the calling thread.
+//
+// \return Reference to the execution context of the calling thread.
+//
+// The execution context identifies the threads of a thread pool and their task queues. For
+// all other threads, the pool of the execution context is \c nullptr. Additionally, the context
+// caches the task queue of an external thread for the thread pool it has last scheduled on.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadPool<TT,MT,LT,CT>::Context& ThreadPool<TT,MT,LT,CT>::context() noexcept
+{
+   thread_local Context ctx{ nullptr, nullptr, 0UL, minSpins, 0UL, 0UL, nullptr };
+   return ctx;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a new, unique ID for a thread pool.
+//
+// \return The new thread pool ID.
+//
+// In contrast to the address of a thread pool, the ID of a thread pool is never reused. Thus
+// the cached external task queue of an execution context never refers to a destroyed pool.
+// The first ID is 1, the ID 0 represents no thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadPool<TT,MT,LT,CT>::nextID() noexcept
+{
+   static std::atomic<size_t> counter( 0UL );
+   return ++counter;
 }
 //*************************************************************************************************
 
@@ -0,0 +1,406 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/instrumentation/Instrumentation.h
+//  \brief Header file for the instrumentation counters and the AssignmentTrace class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_INSTRUMENTATION_INSTRUMENTATION_H_
+#define _BLAZE_UTIL_INSTRUMENTATION_INSTRUMENTATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Time.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Snapshot of the instrumentation counters.
+// \ingroup util
+//
+// The InstrumentationCounters structure represents the state of the instrumentation counters
+// at a specific point in time (see the globalCounters() and threadCounters() functions).
+*/
+struct InstrumentationCounters
+{
+   size_t allocations;       //!< The number of allocations of vector and matrix elements.
+   size_t deallocations;     //!< The number of deallocations of vector and matrix elements.
+   size_t allocatedBytes;    //!< The total number of allocated bytes.
+   size_t deallocatedBytes;  //!< The total number of deallocated bytes.
+   size_t temporaries;       //!< The number of vectors and matrices constructed from expressions.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Type of an instrumented assignment.
+// \ingroup util
+*/
+enum AssignmentType
+{
+   plainAssignment          = 0,  //!< Plain assignment (\c smpAssign()).
+   additionAssignment       = 1,  //!< Addition assignment (\c smpAddAssign()).
+   subtractionAssignment    = 2,  //!< Subtraction assignment (\c smpSubAssign()).
+   multiplicationAssignment = 3,  //!< Multiplication assignment (\c smpMultAssign()).
+   divisionAssignment       = 4,  //!< Division assignment (\c smpDivAssign()).
+   schurAssignment          = 5   //!< Schur product assignment (\c smpSchurAssign()).
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Information about a single instrumented assignment.
+// \ingroup util
+//
+// The AssignmentInfo structure is passed to the assignment callback (see setAssignmentCallback())
+// after each assignment. In case the target of the assignment is a vector, \a rows holds the
+// size of the vector and \a columns is 1.
+*/
+struct AssignmentInfo
+{
+   AssignmentType type;      //!< The type of the assignment.
+   size_t         rows;      //!< The number of rows of the target.
+   size_t         columns;   //!< The number of columns of the target.
+   bool           parallel;  //!< \a true in case the assignment was executed in parallel.
+   double         seconds;   //!< The elapsed wall clock time of the assignment in seconds.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Type of the assignment callback.
+// \ingroup util
+*/
+using AssignmentCallback = void (*)( const AssignmentInfo& info );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUMENTATION STATE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Global state of the instrumentation.
+// \ingroup util
+*/
+struct InstrumentationState
+{
+   std::atomic<size_t>             allocations;       //!< The number of allocations.
+   std::atomic<size_t>             deallocations;     //!< The number of deallocations.
+   std::atomic<size_t>             allocatedBytes;    //!< The total number of allocated bytes.
+   std::atomic<size_t>             deallocatedBytes;  //!< The total number of deallocated bytes.
+   std::atomic<size_t>             temporaries;       //!< The number of constructed temporaries.
+   std::atomic<AssignmentCallback> callback;          //!< The current assignment callback.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the global state of the instrumentation.
+// \ingroup util
+//
+// \return Reference to the global instrumentation state.
+*/
+inline InstrumentationState& theInstrumentationState() noexcept
+{
+   static InstrumentationState state{};
+   return state;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the instrumentation counters of the calling thread.
+// \ingroup util
+//
+// \return Reference to the thread-local instrumentation counters.
+*/
+inline InstrumentationCounters& theThreadCounters() noexcept
+{
+   static thread_local InstrumentationCounters counters{};
+   return counters;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUMENTATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Instrumentation functions */
+//@{
+inline InstrumentationCounters globalCounters() noexcept;
+inline InstrumentationCounters threadCounters() noexcept;
+inline void resetGlobalCounters() noexcept;
+inline void resetThreadCounters() noexcept;
+inline AssignmentCallback setAssignmentCallback( AssignmentCallback callback ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instrumentation counters accumulated over all threads.
+// \ingroup util
+//
+// \return Snapshot of the global instrumentation counters.
+*/
+inline InstrumentationCounters globalCounters() noexcept
+{
+   const InstrumentationState& state( theInstrumentationState() );
+
+   return { state.allocations.load( std::memory_order_relaxed )
+          , state.deallocations.load( std::memory_order_relaxed )
+          , state.allocatedBytes.load( std::memory_order_relaxed )
+          , state.deallocatedBytes.load( std::memory_order_relaxed )
+          , state.temporaries.load( std::memory_order_relaxed ) };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instrumentation counters of the calling thread.
+// \ingroup util
+//
+// \return Snapshot of the instrumentation counters of the calling thread.
+*/
+inline InstrumentationCounters threadCounters() noexcept
+{
+   return theThreadCounters();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the instrumentation counters accumulated over all threads.
+// \ingroup util
+//
+// \return void
+*/
+inline void resetGlobalCounters() noexcept
+{
+   InstrumentationState& state( theInstrumentationState() );
+
+   state.allocations.store( 0UL, std::memory_order_relaxed );
+   state.deallocations.store( 0UL, std::memory_order_relaxed );
+   state.allocatedBytes.store( 0UL, std::memory_order_relaxed );
+   state.deallocatedBytes.store( 0UL, std::memory_order_relaxed );
+   state.temporaries.store( 0UL, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the instrumentation counters of the calling thread.
+// \ingroup util
+//
+// \return void
+*/
+inline void resetThreadCounters() noexcept
+{
+   theThreadCounters() = InstrumentationCounters{};
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the callback for all instrumented assignments.
+// \ingroup util
+//
+// \param callback The new assignment callback (\c nullptr to disable the callback).
+// \return The previous assignment callback.
+//
+// The given callback is called after each SMP assignment (i.e. each evaluation of an expression
+// into a vector or matrix) by the thread that initiated the assignment. The callback may be
+// called concurrently and therefore has to be thread-safe. Also, it must not throw.
+*/
+inline AssignmentCallback setAssignmentCallback( AssignmentCallback callback ) noexcept
+{
+   return theInstrumentationState().callback.exchange( callback );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recording of an allocation of the given number of bytes.
+// \ingroup util
+//
+// \param bytes The number of allocated bytes.
+// \return void
+*/
+inline void recordAllocation( size_t bytes ) noexcept
+{
+   InstrumentationState& state( theInstrumentationState() );
+   state.allocations.fetch_add( 1UL, std::memory_order_relaxed );
+   state.allocatedBytes.fetch_add( bytes, std::memory_order_relaxed );
+
+   InstrumentationCounters& counters( theThreadCounters() );
+   ++counters.allocations;
+   counters.allocatedBytes += bytes;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recording of a deallocation of the given number of bytes.
+// \ingroup util
+//
+// \param bytes The number of deallocated bytes.
+// \return void
+*/
+inline void recordDeallocation( size_t bytes ) noexcept
+{
+   InstrumentationState& state( theInstrumentationState() );
+   state.deallocations.fetch_add( 1UL, std::memory_order_relaxed );
+   state.deallocatedBytes.fetch_add( bytes, std::memory_order_relaxed );
+
+   InstrumentationCounters& counters( theThreadCounters() );
+   ++counters.deallocations;
+   counters.deallocatedBytes += bytes;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recording of the construction of a vector or matrix from an expression.
+// \ingroup util
+//
+// \return void
+*/
+inline void recordTemporary() noexcept
+{
+   theInstrumentationState().temporaries.fetch_add( 1UL, std::memory_order_relaxed );
+   ++theThreadCounters().temporaries;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASSIGNMENTTRACE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief RAII object for the instrumentation of a single assignment.
+// \ingroup util
+//
+// The AssignmentTrace class measures the elapsed time between its construction and destruction
+// and passes the according AssignmentInfo to the current assignment callback. In case no
+// callback is set at the time of construction, the assignment is not timed.
+*/
+class AssignmentTrace
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AssignmentTrace class.
+   //
+   // \param type The type of the assignment.
+   // \param rows The number of rows of the target (the size in case of a vector).
+   // \param columns The number of columns of the target (1 in case of a vector).
+   // \param parallel \a true in case the assignment is executed in parallel.
+   */
+   inline AssignmentTrace( AssignmentType type, size_t rows, size_t columns, bool parallel )
+      : callback_( theInstrumentationState().callback.load() )  // The assignment callback
+      , info_    { type, rows, columns, parallel, 0.0 }         // The assignment information
+      , start_   ( callback_ ? getWcTime() : 0.0 )              // The start time of the assignment
+   {}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor for the AssignmentTrace class.
+   */
+   inline ~AssignmentTrace()
+   {
+      if( callback_ ) {
+         info_.seconds = getWcTime() - start_;
+         callback_( info_ );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   AssignmentCallback callback_;  //!< The assignment callback.
+   AssignmentInfo     info_;      //!< The assignment information.
+   double             start_;     //!< The start time of the assignment.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,222 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Affinity.h
+//  \brief Header file for the thread affinity functionality
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+#define _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/threadpool/Topology.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the ordered list of logical CPUs for the given affinity policy.
+// \ingroup threads
+//
+// \param policy The affinity policy.
+// \param topology The topology of the available logical CPUs.
+// \return The logical CPUs for the threads of a thread pool.
+// \exception std::invalid_argument Invalid affinity policy.
+//
+// This function returns the list of logical CPUs the threads of a thread pool are pinned to:
+// The \a i-th thread is pinned to the \a i-th logical CPU of the list (modulo the length of the
+// list). The following affinity policies are available:
+//
+//  - \c none (or an empty string): The threads are not pinned (the returned list is empty).
+//  - \c compact: The threads are placed as close as possible, i.e. consecutive threads fill
+//    the SMT siblings of a core, the cores sharing a last-level cache and finally the packages.
+//  - \c cores: The threads are placed on distinct physical cores, skipping SMT siblings. Only
+//    in case there are more threads than cores, the SMT siblings are used in a second round.
+//  - \c scatter: The threads are distributed round-robin across all last-level cache domains
+//    and packages, using distinct physical cores first.
+//  - An explicit list of logical CPUs, as for instance "0-3,8,10-11".
+//
+// In case the given policy is invalid or in case an explicitly specified logical CPU is not
+// available, a \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> createAffinity( const std::string& policy, const Topology& topology )
+{
+   std::vector<size_t> cpus;
+
+   if( policy.empty() || policy == "none" ) {
+      return cpus;
+   }
+
+   // Splitting the logical CPUs into the first SMT siblings of all cores and all other siblings
+   std::vector<const CPU*> primary;
+   std::vector<const CPU*> secondary;
+
+   for( auto cpu=topology.begin(); cpu!=topology.end(); ++cpu ) {
+      const bool first( cpu == topology.begin() ||
+                        (cpu-1)->package != cpu->package || (cpu-1)->core != cpu->core );
+      ( first ? primary : secondary ).push_back( &(*cpu) );
+   }
+
+   if( policy == "compact" )
+   {
+      for( const CPU& cpu : topology ) {
+         cpus.push_back( cpu.id );
+      }
+   }
+   else if( policy == "cores" )
+   {
+      for( const CPU* cpu : primary ) {
+         cpus.push_back( cpu->id );
+      }
+      for( const CPU* cpu : secondary ) {
+         cpus.push_back( cpu->id );
+      }
+   }
+   else if( policy == "scatter" )
+   {
+      // Grouping the logical CPUs by last-level cache domain, distinct cores first
+      std::vector<const CPU*> candidates( primary );
+      candidates.insert( candidates.end(), secondary.begin(), secondary.end() );
+
+      std::vector< std::pair<size_t,size_t> > keys;  // Package and cache of the domains
+      std::vector< std::vector<size_t> > domains;     // Logical CPUs of the domains
+      std::vector<size_t> ranks;                      // Ranks of the domains within their package
+
+      for( const CPU* cpu : candidates )
+      {
+         const std::pair<size_t,size_t> key( cpu->package, cpu->cache );
+         const size_t d( std::find( keys.begin(), keys.end(), key ) - keys.begin() );
+
+         if( d == keys.size() ) {
+            ranks.push_back( std::count_if( keys.begin(), keys.end(),
+                                            [&key]( const std::pair<size_t,size_t>& k ) {
+                                               return k.first == key.first;
+                                            } ) );
+            keys.push_back( key );
+            domains.emplace_back();
+         }
+
+         domains[d].push_back( cpu->id );
+      }
+
+      // Ordering the domains such that consecutive domains belong to different packages
+      std::vector<size_t> order( domains.size() );
+      for( size_t d=0UL; d<order.size(); ++d ) {
+         order[d] = d;
+      }
+      std::stable_sort( order.begin(), order.end(), [&ranks]( size_t a, size_t b ) {
+         return ranks[a] < ranks[b];
+      } );
+
+      // Distributing the logical CPUs round-robin across all domains
+      for( size_t i=0UL; cpus.size()<topology.size(); ++i ) {
+         for( size_t d : order ) {
+            if( i < domains[d].size() ) {
+               cpus.push_back( domains[d][i] );
+            }
+         }
+      }
+   }
+   else
+   {
+      cpus = parseCPUList( policy );
+
+      if( cpus.empty() ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid affinity policy" );
+      }
+
+      for( size_t cpu : cpus ) {
+         if( topology.find( cpu ) == nullptr ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid affinity: logical CPU not available" );
+         }
+      }
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pinning the calling thread to the given logical CPU.
+// \ingroup threads
+//
+// \param cpu The operating system index of the logical CPU.
+// \return \a true in case the thread was successfully pinned, \a false if not.
+//
+// This function pins the calling thread to the given logical CPU. Pinning is only supported on
+// Linux systems. On all other systems the function has no effect and returns \a false.
+*/
+inline bool pinThread( size_t cpu ) noexcept
+{
+#if defined(__linux__)
+   if( cpu >= CPU_SETSIZE )
+      return false;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   CPU_SET( cpu, &set );
+
+   return pthread_setaffinity_np( pthread_self(), sizeof( set ), &set ) == 0;
+#else
+   MAYBE_UNUSED( cpu );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,285 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/InjectionQueue.h
+//  \brief Multi-producer injection queue for the thread pool
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_INJECTIONQUEUE_H_
+#define _BLAZE_UTIL_THREADPOOL_INJECTIONQUEUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free multi-producer injection queue for the thread pool.
+// \ingroup threads
+//
+// The InjectionQueue class represents a queue for tasks that are handed to a specific thread
+// of a thread pool by any other thread. It is implemented as intrusive, non-blocking queue
+// according to Vyukov (see [1]): Any thread can push a task by means of a single atomic exchange
+// and without ever waiting for another thread. The tasks are taken from the queue in FIFO order.
+// Taking a task is reserved for a single consumer at a time, which is ensured by a flag that is
+// only tried but never waited for: In case another thread is currently taking a task from the
+// queue, the pop() function immediately returns \c nullptr and the calling thread can look for
+// tasks elsewhere.
+//
+// In contrast to the TaskQueue class, the injection queue does not own the task records of the
+// contained tasks. Instead, the pushing thread prepares the task record in a task queue it owns
+// (see the TaskQueue::prepare() function), to which the record is handed back after execution.
+//
+// [1] D. Vyukov: Intrusive MPSC node-based queue, 1024cores.net, 2010\n
+*/
+class InjectionQueue
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline InjectionQueue();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~InjectionQueue();
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void  push( Task* task ) noexcept;
+   inline Task* pop () noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void  enqueue( Task* task ) noexcept;
+   inline Task* dequeue() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<Task*> head_;       //!< The most recently pushed task record.
+   char padding_[64UL];            //!< Padding to avoid false sharing between producers and consumer.
+   Task*              tail_;       //!< The least recently pushed task record.
+   std::atomic_flag   consuming_;  //!< Flag for the exclusive access of a single consumer.
+   Task               stub_;       //!< Placeholder record that keeps the queue non-empty.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for InjectionQueue.
+*/
+inline InjectionQueue::InjectionQueue()
+   : head_     ( &stub_ )  // The most recently pushed task record
+   , padding_  ()          // Padding to avoid false sharing between producers and consumer
+   , tail_     ( &stub_ )  // The least recently pushed task record
+   , consuming_()          // Flag for the exclusive access of a single consumer
+   , stub_     ()          // Placeholder record that keeps the queue non-empty
+{
+   consuming_.clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the InjectionQueue class.
+//
+// The destructor hands back all remaining tasks to their owning task queues.
+*/
+inline InjectionQueue::~InjectionQueue()
+{
+   while( Task* task = dequeue() ) {
+      TaskQueue::release( task );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the injection queue.
+//
+// \param task The task to be added (see the TaskQueue::prepare() function).
+// \return void
+//
+// This function adds the given task to the end of the injection queue. It can be called by any
+// thread at any time and never waits for another thread.
+*/
+inline void InjectionQueue::push( Task* task ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( task != nullptr, "Invalid task detected" );
+   BLAZE_INTERNAL_ASSERT( task->queue_ != nullptr, "Unowned task detected" );
+
+   enqueue( task );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a task from the front of the injection queue.
+//
+// \return The removed task or \c nullptr in case no task can be taken.
+//
+// This function removes the least recently pushed task from the injection queue. It can be
+// called by any thread. In case another thread is currently taking a task or in case the most
+// recently started push operation has not been completed yet, the function returns \c nullptr
+// instead of waiting. The returned task has to be handed back to its owning task queue via the
+// TaskQueue::release() function after its execution.
+*/
+inline Task* InjectionQueue::pop() noexcept
+{
+   if( consuming_.test_and_set( std::memory_order_acquire ) )
+      return nullptr;
+
+   Task* const task( dequeue() );
+   consuming_.clear( std::memory_order_release );
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Linking the given task record to the end of the injection queue.
+//
+// \param task The task record to be linked.
+// \return void
+*/
+inline void InjectionQueue::enqueue( Task* task ) noexcept
+{
+   task->link_.store( nullptr, std::memory_order_relaxed );
+   Task* const prev( head_.exchange( task, std::memory_order_acq_rel ) );
+   prev->link_.store( task, std::memory_order_release );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unlinking the task record at the front of the injection queue.
+//
+// \return The unlinked task record or \c nullptr in case no task can be taken.
+//
+// This function must only be called by a single consumer at a time.
+*/
+inline Task* InjectionQueue::dequeue() noexcept
+{
+   Task* tail( tail_ );
+   Task* next( tail->link_.load( std::memory_order_acquire ) );
+
+   if( tail == &stub_ ) {
+      if( next == nullptr )
+         return nullptr;
+      tail_ = next;
+      tail  = next;
+      next  = next->link_.load( std::memory_order_acquire );
+   }
+
+   if( next != nullptr ) {
+      tail_ = next;
+      return tail;
+   }
+
+   // A push operation has been started, but the task has not been linked yet
+   if( tail != head_.load( std::memory_order_acquire ) )
+      return nullptr;
+
+   enqueue( &stub_ );
+   next = tail->link_.load( std::memory_order_acquire );
+
+   if( next != nullptr ) {
+      tail_ = next;
+      return tail;
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
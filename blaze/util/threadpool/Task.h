@@ -1,7 +1,7 @@
 //=================================================================================================
 /*!
 //  \file blaze/util/threadpool/Task.h
-//  \brief Header file for the Task base class
+//  \brief Header file for the Task class
 //
 //  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
 //
@@ -32,6 +32,7 @@
 */
 //=================================================================================================
 
+
 #ifndef _BLAZE_UTIL_THREADPOOL_TASK_H_
 #define _BLAZE_UTIL_THREADPOOL_TASK_H_
 
@@ -40,7 +41,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <blaze/util/Assert.h>
+#include <blaze/util/ConcurrentMemoryPool.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -49,15 +61,475 @@ namespace threadpool {
 
 //=================================================================================================
 //
-//  TYPE DEFINITIONS
+//  ::blaze::threadpool NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+class InjectionQueue;
+class TaskQueue;
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Handle for a single, executable task.
+/*!\brief Record for a single, executable task.
 // \ingroup threads
+//
+// The Task class represents a single task of a thread pool. It stores an arbitrary function or
+// functor together with the arguments it is called with. In contrast to for instance
+// \c std::function or \c std::bind(), the decayed function/functor and its decayed arguments
+// are stored directly inside the task record as long as they fit into the internal buffer of
+// \a bufferSize bytes, which is the case for all tasks of the thread-based SMP backend. Larger callables of up to \a poolBufferSize bytes are stored
+// in a global concurrent memory pool (see the ConcurrentMemoryPool class description), which
+// can be released by any worker thread without synchronizing on the system allocator. Only
+// even larger callables are moved to dynamic memory. Since the task records are recycled by
+// the owning task queue (see the TaskQueue class description), scheduling a task does not
+// require any dynamic memory allocation.
+*/
+class Task
+   : private NonCopyable
+{
+ public:
+   //**Compile time constants**********************************************************************
+   //! Size of the internal buffer for the stored callable (in bytes).
+   static constexpr size_t bufferSize = 192UL;
+
+   //! Size of the pooled buffers for larger callables (in bytes).
+   static constexpr size_t poolBufferSize = 1024UL;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Task() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Task();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Callable, typename... Args >
+   inline void assign( Callable&& func, Args&&... args );
+
+   inline bool isEmpty() const noexcept;
+   inline void reset() noexcept;
+   inline void operator()();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the internal buffer for the stored callable.
+   using Buffer = typename std::aligned_storage< bufferSize, alignof( std::max_align_t ) >::type;
+
+   //! Type of the pooled buffers for larger callables.
+   using PoolBuffer = typename std::aligned_storage< poolBufferSize, alignof( std::max_align_t ) >::type;
+
+   //! Type of the memory pool for larger callables.
+   using Pool = ConcurrentMemoryPool<PoolBuffer,64UL>;
+
+   //! Type of the type-erased execution and destruction functions.
+   using Function = void (*)( void* );
+   //**********************************************************************************************
+
+   //**Private class Invocation********************************************************************
+   /*!\brief A function/functor bound to its arguments.
+   //
+   // The arguments are stored in a tuple, which (in case of an empty tuple) does not add to the
+   // size of the invocation. On execution, the stored arguments are passed as lvalues, while
+   // arguments wrapped in a \c std::reference_wrapper are passed as the wrapped reference.
+   */
+   template< typename Callable     // Type of the function/functor
+           , typename... Args >    // Types of the function/functor arguments
+   class Invocation
+      : private std::tuple<Args...>
+   {
+    public:
+      /*!\brief Constructor for the Invocation class template.
+      //
+      // \param func The function/functor to be called.
+      // \param args The arguments for the function/functor.
+      */
+      template< typename F, typename... As >
+      explicit inline Invocation( F&& func, As&&... args )
+         : std::tuple<Args...>( std::forward<As>( args )... )  // The bound arguments
+         , func_( std::forward<F>( func ) )                     // The function/functor
+      {}
+
+      /*!\brief Calling the function/functor with the bound arguments.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         apply( std::index_sequence_for<Args...>() );
+      }
+
+    private:
+      /*!\brief Calling the function/functor with the unpacked arguments.
+      //
+      // \return void
+      */
+      template< size_t... Is >
+      inline void apply( std::index_sequence<Is...> ) {
+         func_( unwrap( std::get<Is>( static_cast< std::tuple<Args...>& >( *this ) ) )... );
+      }
+
+      /*!\brief Passing an argument as lvalue.
+      //
+      // \param arg The stored argument.
+      // \return Reference to the stored argument.
+      */
+      template< typename T >
+      static inline T& unwrap( T& arg ) noexcept {
+         return arg;
+      }
+
+      /*!\brief Passing an argument stored in a \c std::reference_wrapper as the wrapped reference.
+      //
+      // \param arg The stored reference wrapper.
+      // \return The wrapped reference.
+      */
+      template< typename T >
+      static inline T& unwrap( std::reference_wrapper<T>& arg ) noexcept {
+         return arg.get();
+      }
+
+      Callable func_;  //!< The function/functor.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename IT, typename... Args > inline void emplace       ( TrueType , Args&&... args );
+   template< typename IT, typename... Args > inline void emplace       ( FalseType, Args&&... args );
+   template< typename IT, typename... Args > inline void emplaceDynamic( TrueType , Args&&... args );
+   template< typename IT, typename... Args > inline void emplaceDynamic( FalseType, Args&&... args );
+
+   static inline Pool& thePool();
+   //@}
+   //**********************************************************************************************
+
+   //**Execution functions*************************************************************************
+   /*!\name Execution functions */
+   //@{
+   template< typename Callable > static void execute( void* callable );
+   template< typename Callable > static void destroyInPlace( void* callable ) noexcept;
+   template< typename Callable > static void destroyInPool ( void* callable ) noexcept;
+   template< typename Callable > static void destroyOnHeap ( void* callable ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   void*              callable_;  //!< Pointer to the stored callable.
+   Function           execute_;   //!< Execution function for the stored callable.
+   Function           destroy_;   //!< Destruction function for the stored callable.
+   Task*              next_;      //!< The next task record in a list of free records.
+   std::atomic<Task*> link_;      //!< The next task record in an injection queue.
+   TaskQueue*         queue_;     //!< The task queue owning the task record.
+   Buffer             buffer_;    //!< Internal buffer for small callables.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class InjectionQueue;
+   friend class TaskQueue;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for Task.
+*/
+inline Task::Task() noexcept
+   : callable_( nullptr )  // Pointer to the stored callable
+   , execute_ ( nullptr )  // Execution function for the stored callable
+   , destroy_ ( nullptr )  // Destruction function for the stored callable
+   , next_    ( nullptr )  // The next task record in a list of free records
+   , link_    ( nullptr )  // The next task record in an injection queue
+   , queue_   ( nullptr )  // The task queue owning the task record
+   , buffer_  ()           // Internal buffer for small callables
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the Task class.
+//
+// The destructor destroys the stored callable, if any.
+*/
+inline Task::~Task()
+{
+   reset();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Storing the given function/functor and its arguments in the task record.
+//
+// \param func The function/functor to be stored.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function stores the decayed function/functor and the decayed arguments in the task
+// record. Any previously stored callable is destroyed. The function/functor must be callable
+// with the given type and number of arguments. Its return value (if any) is discarded.
+*/
+template< typename Callable     // Type of the function/functor
+        , typename... Args >    // Types of the function/functor arguments
+inline void Task::assign( Callable&& func, Args&&... args )
+{
+   using IT = Invocation< std::decay_t<Callable>, std::decay_t<Args>... >;
+
+   reset();
+   emplace<IT>( BoolConstant< sizeof( IT ) <= bufferSize && alignof( IT ) <= alignof( Buffer ) >(),
+                std::forward<Callable>( func ), std::forward<Args>( args )... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructing the given invocation inside the internal buffer of the task record.
+//
+// \param args The constructor arguments for the invocation.
+// \return void
+*/
+template< typename IT         // Type of the invocation
+        , typename... Args >  // Types of the constructor arguments
+inline void Task::emplace( TrueType, Args&&... args )
+{
+   callable_ = ::new( &buffer_ ) IT( std::forward<Args>( args )... );
+   execute_  = &execute<IT>;
+   destroy_  = &destroyInPlace<IT>;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructing the given invocation outside the task record.
+//
+// \param args The constructor arguments for the invocation.
+// \return void
+*/
+template< typename IT         // Type of the invocation
+        , typename... Args >  // Types of the constructor arguments
+inline void Task::emplace( FalseType, Args&&... args )
+{
+   emplaceDynamic<IT>( BoolConstant< sizeof( IT ) <= poolBufferSize && alignof( IT ) <= alignof( PoolBuffer ) >(),
+                       std::forward<Args>( args )... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructing the given invocation in the memory pool for larger callables.
+//
+// \param args The constructor arguments for the invocation.
+// \return void
+*/
+template< typename IT         // Type of the invocation
+        , typename... Args >  // Types of the constructor arguments
+inline void Task::emplaceDynamic( TrueType, Args&&... args )
+{
+   void* const raw( thePool().malloc() );
+
+   try {
+      callable_ = ::new( raw ) IT( std::forward<Args>( args )... );
+   }
+   catch( ... ) {
+      thePool().free( raw );
+      throw;
+   }
+
+   execute_ = &execute<IT>;
+   destroy_ = &destroyInPool<IT>;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructing the given invocation in dynamic memory.
+//
+// \param args The constructor arguments for the invocation.
+// \return void
+*/
+template< typename IT         // Type of the invocation
+        , typename... Args >  // Types of the constructor arguments
+inline void Task::emplaceDynamic( FalseType, Args&&... args )
+{
+   callable_ = new IT( std::forward<Args>( args )... );
+   execute_  = &execute<IT>;
+   destroy_  = &destroyOnHeap<IT>;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the memory pool for larger callables.
+//
+// \return Reference to the memory pool for larger callables.
+//
+// The memory pool is created by the first task queue (see the TaskQueue class description).
+// Since the memory pool is therefore completely constructed before any task queue, it is
+// destroyed only after all task queues with static storage duration (and all thread pools
+// owning them) have been destroyed and all their tasks have been released.
+*/
+inline Task::Pool& Task::thePool()
+{
+   static Pool pool;
+   return pool;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the task record currently stores a callable.
+//
+// \return \a true in case no callable is stored, \a false if a callable is stored.
+*/
+inline bool Task::isEmpty() const noexcept
+{
+   return callable_ == nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroying the stored callable.
+//
+// \return void
+*/
+inline void Task::reset() noexcept
+{
+   if( callable_ != nullptr ) {
+      destroy_( callable_ );
+      callable_ = nullptr;
+      execute_  = nullptr;
+      destroy_  = nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing the stored callable.
+//
+// \return void
+*/
+inline void Task::operator()()
+{
+   BLAZE_INTERNAL_ASSERT( !isEmpty(), "Execution of empty task detected" );
+
+   execute_( callable_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Calling the given type-erased function/functor.
+//
+// \param callable Pointer to the stored function/functor.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+void Task::execute( void* callable )
+{
+   ( *static_cast<Callable*>( callable ) )();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroying a function/functor stored in the internal buffer.
+//
+// \param callable Pointer to the stored function/functor.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+void Task::destroyInPlace( void* callable ) noexcept
+{
+   static_cast<Callable*>( callable )->~Callable();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroying a function/functor stored in the memory pool for larger callables.
+//
+// \param callable Pointer to the stored function/functor.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+void Task::destroyInPool( void* callable ) noexcept
+{
+   static_cast<Callable*>( callable )->~Callable();
+   thePool().free( callable );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroying a function/functor stored in dynamic memory.
+//
+// \param callable Pointer to the stored function/functor.
+// \return void
 */
-using Task = std::function<void(void)>;
+template< typename Callable >  // Type of the function/functor
+void Task::destroyOnHeap( void* callable ) noexcept
+{
+   delete static_cast<Callable*>( callable );
+}
 //*************************************************************************************************
 
 } // namespace threadpool
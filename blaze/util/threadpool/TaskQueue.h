@@ -32,6 +32,7 @@
 */
 //=================================================================================================
 
+
 #ifndef _BLAZE_UTIL_THREADPOOL_TASKQUEUE_H_
 #define _BLAZE_UTIL_THREADPOOL_TASKQUEUE_H_
 
@@ -40,8 +41,14 @@
 // Includes
 //*************************************************************************************************
 
-#include <deque>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
 #include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -55,28 +62,101 @@ namespace threadpool {
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Task queue for the thread pool.
+/*!\brief Work-stealing task queue for the thread pool.
 // \ingroup threads
 //
-// The TaskQueue class represents the internal task container of a thread pool. It uses a FIFO
-// (first in, first out) strategy to store and remove the assigned tasks.
+// The TaskQueue class represents a single task queue of a thread pool. It is implemented as
+// lock-free double-ended queue according to Chase and Lev (see [1] and [2]): The owner of the
+// queue pushes and pops tasks at the bottom end of the queue (LIFO), whereas any other thread
+// can concurrently steal tasks from the top end of the queue (FIFO). Only the push() and pop()
+// functions are restricted to the owning thread, the steal() function can be called by any
+// thread at any time.
+//
+// Each task queue additionally manages the task records for all tasks pushed into the queue.
+// Executed or discarded tasks are handed back to the owning queue via the release() function
+// and are reused for subsequent tasks. Therefore after a short warm-up phase pushing a task
+// does not involve any dynamic memory allocation. The construction of the first task queue
+// also creates the memory pool for larger callables (see the Task class description), which
+// guarantees that the memory pool outlives all task queues.
+//
+// [1] D. Chase, Y. Lev: Dynamic Circular Work-Stealing Deque, SPAA 2005\n
+// [2] N. M. Le, A. Pop, A. Cohen, F. Zappa Nardelli: Correct and Efficient Work-Stealing for
+//     Weak Memory Models, PPoPP 2013\n
 */
 class TaskQueue
+   : private NonCopyable
 {
  private:
    //**Type definitions****************************************************************************
-   using Tasks = std::deque<Task>;  //!< FIFO container for tasks.
+   using Slot = std::atomic<Task*>;  //!< Type of a single slot of the circular buffer.
+   //**********************************************************************************************
+
+   //**Private class Buffer************************************************************************
+   /*!\brief Circular buffer for the tasks of the task queue.
+   */
+   struct Buffer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Buffer class.
+      //
+      // \param n The capacity of the buffer (must be a power of two).
+      */
+      explicit inline Buffer( size_t n )
+         : mask_ ( n - 1UL )      // Bit mask for the mapping of indices to slots
+         , slots_( new Slot[n] )  // The slots of the circular buffer
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Returns the capacity of the buffer.
+      //
+      // \return The capacity of the buffer.
+      */
+      inline size_t capacity() const noexcept {
+         return mask_ + 1UL;
+      }
+
+      /*!\brief Returns the task stored at the given index.
+      //
+      // \param i The index of the task.
+      // \return The task stored at the given index.
+      */
+      inline Task* load( ptrdiff_t i ) const noexcept {
+         return slots_[ static_cast<size_t>( i ) & mask_ ].load( std::memory_order_relaxed );
+      }
+
+      /*!\brief Stores the given task at the given index.
+      //
+      // \param i The index of the task.
+      // \param task The task to be stored.
+      // \return void
+      */
+      inline void store( ptrdiff_t i, Task* task ) noexcept {
+         slots_[ static_cast<size_t>( i ) & mask_ ].store( task, std::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t                  mask_;   //!< Bit mask for the mapping of indices to slots.
+      std::unique_ptr<Slot[]> slots_;  //!< The slots of the circular buffer.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Buffers = std::vector< std::unique_ptr<Buffer> >;  //!< Container for circular buffers.
+   using Tasks   = std::vector< std::unique_ptr<Task> >;    //!< Container for task records.
    //**********************************************************************************************
 
  public:
    //**Type definitions****************************************************************************
-   using SizeType = Tasks::size_type;  //!< Size type of the task queue.
+   using SizeType = size_t;  //!< Size type of the task queue.
    //**********************************************************************************************
 
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit inline TaskQueue();
+   explicit inline TaskQueue( size_t capacity = 64UL );
    //@}
    //**********************************************************************************************
 
@@ -90,33 +170,56 @@ class TaskQueue
    //**Get functions*******************************************************************************
    /*!\name Get functions */
    //@{
-   inline SizeType maxSize()  const;
-   inline SizeType size()     const;
-   inline bool     isEmpty()  const;
+   inline SizeType size()    const noexcept;
+   inline bool     isEmpty() const noexcept;
    //@}
    //**********************************************************************************************
 
    //**Element functions***************************************************************************
    /*!\name Element functions */
    //@{
-   inline void push ( Task task );
-   inline Task pop  ();
-   inline void clear();
+   template< typename Callable, typename... Args >
+   inline void push( Callable&& func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   inline Task* prepare( Callable&& func, Args&&... args );
+
+   inline Task* pop  () noexcept;
+   inline Task* steal() noexcept;
    //@}
    //**********************************************************************************************
 
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   inline void swap( TaskQueue& tq ) noexcept;
+   static inline void release( Task* task ) noexcept;
    //@}
    //**********************************************************************************************
 
  private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Task*   acquire();
+   inline Buffer* grow( Buffer* buffer, ptrdiff_t top, ptrdiff_t bottom );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Tasks tasks_;  //!< FIFO container for the contained tasks.
+   std::atomic<ptrdiff_t> top_;       //!< Index of the top end of the queue.
+   char padding1_[64UL];              //!< Padding to avoid false sharing between top and bottom.
+   std::atomic<ptrdiff_t> bottom_;    //!< Index of the bottom end of the queue.
+   std::atomic<Buffer*>   buffer_;    //!< The currently active circular buffer.
+   Task*                  free_;      //!< List of free task records (owner only).
+   char padding2_[64UL];              //!< Padding to avoid false sharing with released records.
+   std::atomic<Task*>     released_;  //!< List of task records released by any thread.
+   Buffers                buffers_;   //!< All circular buffers of the queue.
+                                      /*!< Buffers replaced by a larger buffer are kept alive
+                                           until the destruction of the queue since concurrent
+                                           steal operations might still access them. */
+   Tasks                  tasks_;     //!< All task records of the queue.
    //@}
    //**********************************************************************************************
 };
@@ -133,10 +236,28 @@ class TaskQueue
 
 //*************************************************************************************************
 /*!\brief Default constructor for TaskQueue.
+//
+// \param capacity The initial capacity of the task queue (must be a power of two).
 */
-inline TaskQueue::TaskQueue()
-   : tasks_()  // FIFO container for the contained tasks
-{}
+inline TaskQueue::TaskQueue( size_t capacity )
+   : top_      ( 0 )        // Index of the top end of the queue
+   , padding1_ ()           // Padding to avoid false sharing between top and bottom
+   , bottom_   ( 0 )        // Index of the bottom end of the queue
+   , buffer_   ( nullptr )  // The currently active circular buffer
+   , free_     ( nullptr )  // List of free task records (owner only)
+   , padding2_ ()           // Padding to avoid false sharing with released records
+   , released_ ( nullptr )  // List of task records released by any thread
+   , buffers_  ()           // All circular buffers of the queue
+   , tasks_    ()           // All task records of the queue
+{
+   BLAZE_INTERNAL_ASSERT( capacity > 0UL && ( capacity & ( capacity - 1UL ) ) == 0UL,
+                          "Invalid capacity detected" );
+
+   buffers_.emplace_back( new Buffer( capacity ) );
+   buffer_.store( buffers_.back().get(), std::memory_order_relaxed );
+
+   Task::thePool();
+}
 //*************************************************************************************************
 
 
@@ -153,9 +274,11 @@ inline TaskQueue::TaskQueue()
 //
 // The destructor destroys any remaining task in the task queue.
 */
-TaskQueue::~TaskQueue()
+inline TaskQueue::~TaskQueue()
 {
-   clear();
+   while( Task* task = pop() ) {
+      release( task );
+   }
 }
 //*************************************************************************************************
 
@@ -168,28 +291,19 @@ TaskQueue::~TaskQueue()
 //
 //=================================================================================================
 
-//*************************************************************************************************
-/*!\brief Returns the maximum possible size of a task queue.
-//
-// \return The maximum possible size.
-*/
-inline TaskQueue::SizeType TaskQueue::maxSize() const
-{
-   return tasks_.max_size();
-}
-//*************************************************************************************************
-
-
 //*************************************************************************************************
 /*!\brief Returns the current size of the task queue.
 //
 // \return The current size.
 //
-// This function returns the number of the currently contained tasks.
+// This function returns the number of the currently contained tasks. Note that in case of
+// concurrent push, pop, or steal operations the returned value is only a snapshot.
 */
-inline TaskQueue::SizeType TaskQueue::size() const
+inline TaskQueue::SizeType TaskQueue::size() const noexcept
 {
-   return tasks_.size();
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( std::memory_order_relaxed ) );
+   return ( bottom > top ? static_cast<SizeType>( bottom - top ) : 0UL );
 }
 //*************************************************************************************************
 
@@ -199,9 +313,9 @@ inline TaskQueue::SizeType TaskQueue::size() const
 //
 // \return \a true if the task queue is empty, \a false if it is not.
 */
-inline bool TaskQueue::isEmpty() const
+inline bool TaskQueue::isEmpty() const noexcept
 {
-   return tasks_.empty();
+   return size() == 0UL;
 }
 //*************************************************************************************************
 
@@ -215,42 +329,123 @@ inline bool TaskQueue::isEmpty() const
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Adding a task to the end of the task queue.
+/*!\brief Adding a task to the bottom end of the task queue.
 //
-// \param task The task to be added to the end of the task queue.
+// \param func The function/functor to be added to the task queue.
+// \param args The arguments for the function/functor.
 // \return void
 //
-// This function adds the given task to the end of the task queue. It runs in constant time.
+// This function adds the given function/functor, bound to the given arguments, to the bottom
+// end of the task queue. It must only be called by the owner of the task queue.
 */
-inline void TaskQueue::push( Task task )
+template< typename Callable     // Type of the function/functor
+        , typename... Args >    // Types of the function/functor arguments
+inline void TaskQueue::push( Callable&& func, Args&&... args )
 {
-   tasks_.push_back( task );
+   Task* task( prepare( std::forward<Callable>( func ), std::forward<Args>( args )... ) );
+
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( std::memory_order_acquire ) );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+
+   if( bottom - top >= static_cast<ptrdiff_t>( buffer->capacity() ) ) {
+      buffer = grow( buffer, top, bottom );
+   }
+
+   buffer->store( bottom, task );
+   bottom_.store( bottom + 1, std::memory_order_release );
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Returns the task from the front of the task queue.
+/*!\brief Preparing a task record without adding it to the task queue.
+//
+// \param func The function/functor to be stored in the task record.
+// \param args The arguments for the function/functor.
+// \return The prepared task record.
 //
-// \return The first task in the task queue.
+// This function stores the given function/functor, bound to the given arguments, in a free task
+// record of the task queue, but does not add the task to the queue. This enables to hand the
+// task to another queue (as for instance an injection queue), while the record is still handed
+// back to this task queue via the release() function. This function must only be called by the
+// owner of the task queue.
 */
-inline Task TaskQueue::pop()
+template< typename Callable     // Type of the function/functor
+        , typename... Args >    // Types of the function/functor arguments
+inline Task* TaskQueue::prepare( Callable&& func, Args&&... args )
 {
-   const Task task( tasks_.front() );
-   tasks_.pop_front();
+   Task* task( acquire() );
+   task->assign( std::forward<Callable>( func ), std::forward<Args>( args )... );
    return task;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Removing all tasks from the task queue.
+/*!\brief Removing a task from the bottom end of the task queue.
 //
-// \return void
+// \return The removed task or \c nullptr in case the task queue is empty.
+//
+// This function removes the most recently pushed task from the task queue. It must only be
+// called by the owner of the task queue. The returned task has to be handed back to the task
+// queue via the release() function after its execution.
+*/
+inline Task* TaskQueue::pop() noexcept
+{
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) - 1 );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+   bottom_.store( bottom, std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   ptrdiff_t top( top_.load( std::memory_order_relaxed ) );
+
+   if( top > bottom ) {
+      bottom_.store( bottom + 1, std::memory_order_relaxed );
+      return nullptr;
+   }
+
+   Task* task( buffer->load( bottom ) );
+
+   if( top == bottom ) {
+      if( !top_.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed ) ) {
+         task = nullptr;
+      }
+      bottom_.store( bottom + 1, std::memory_order_relaxed );
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a task from the top end of the task queue.
+//
+// \return The removed task or \c nullptr in case the task queue is empty.
+//
+// This function removes the least recently pushed task from the task queue. In contrast to the
+// push() and pop() functions it can be called by any thread. The returned task has to be handed
+// back to the task queue via the release() function after its execution.
 */
-inline void TaskQueue::clear()
+inline Task* TaskQueue::steal() noexcept
 {
-   tasks_.clear();
+   while( true )
+   {
+      ptrdiff_t top( top_.load( std::memory_order_acquire ) );
+      std::atomic_thread_fence( std::memory_order_seq_cst );
+      const ptrdiff_t bottom( bottom_.load( std::memory_order_acquire ) );
+
+      if( top >= bottom )
+         return nullptr;
+
+      Task* task( buffer_.load( std::memory_order_acquire )->load( top ) );
+
+      if( top_.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed ) ) {
+         return task;
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -264,46 +459,78 @@ inline void TaskQueue::clear()
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
+/*!\brief Handing back an executed or discarded task to its owning task queue.
 //
-// \param tq The task queue to be swapped.
+// \param task The task to be released.
 // \return void
-// \exception no-throw guarantee.
+//
+// This function destroys the callable stored in the given task and hands back the task record
+// to the task queue it originated from. It can be called by any thread.
 */
-inline void TaskQueue::swap( TaskQueue& tq ) noexcept
+inline void TaskQueue::release( Task* task ) noexcept
 {
-   tasks_.swap( tq.tasks_ );
-}
-//*************************************************************************************************
+   BLAZE_INTERNAL_ASSERT( task != nullptr, "Invalid task detected" );
+   BLAZE_INTERNAL_ASSERT( task->queue_ != nullptr, "Unowned task detected" );
 
+   task->reset();
 
+   std::atomic<Task*>& released( task->queue_->released_ );
+   task->next_ = released.load( std::memory_order_relaxed );
 
+   while( !released.compare_exchange_weak( task->next_, task, std::memory_order_release,
+                                           std::memory_order_relaxed ) ) {}
+}
+//*************************************************************************************************
 
-//=================================================================================================
-//
-//  GLOBAL OPERATORS
-//
-//=================================================================================================
 
 //*************************************************************************************************
-/*!\name TaskQueue operators */
-//@{
-inline void swap( TaskQueue& a, TaskQueue& b ) noexcept;
-//@}
+/*!\brief Acquiring a free task record.
+//
+// \return A free task record.
+//
+// This function returns a free task record of the task queue. Records released by other threads
+// are collected at once, which avoids the ABA problem since the owner is the only thread taking
+// records from the list. Only in case no free record is available a new record is allocated.
+*/
+inline Task* TaskQueue::acquire()
+{
+   if( free_ == nullptr ) {
+      free_ = released_.exchange( nullptr, std::memory_order_acquire );
+   }
+
+   if( free_ == nullptr ) {
+      tasks_.emplace_back( new Task() );
+      tasks_.back()->queue_ = this;
+      return tasks_.back().get();
+   }
+
+   Task* task( free_ );
+   free_ = task->next_;
+   task->next_ = nullptr;
+   return task;
+}
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
+/*!\brief Replacing the given circular buffer by a buffer with twice the capacity.
 //
-// \param a The first task queue to be swapped.
-// \param b The second task queue to be swapped.
-// \return void
-// \exception no-throw guarantee.
+// \param buffer The currently active circular buffer.
+// \param top The current index of the top end of the queue.
+// \param bottom The current index of the bottom end of the queue.
+// \return The new circular buffer.
 */
-inline void swap( TaskQueue& a, TaskQueue& b ) noexcept
+inline TaskQueue::Buffer* TaskQueue::grow( Buffer* buffer, ptrdiff_t top, ptrdiff_t bottom )
 {
-   a.swap( b );
+   buffers_.emplace_back( new Buffer( 2UL * buffer->capacity() ) );
+   Buffer* larger( buffers_.back().get() );
+
+   for( ptrdiff_t i=top; i<bottom; ++i ) {
+      larger->store( i, buffer->load( i ) );
+   }
+
+   buffer_.store( larger, std::memory_order_release );
+   return larger;
 }
 //*************************************************************************************************
 
@@ -311,5 +538,4 @@ inline void swap( TaskQueue& a, TaskQueue& b ) noexcept
 
 } // namespace blaze
 
-
 #endif
@@ -0,0 +1,496 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Topology.h
+//  \brief Header file for the Topology class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TOPOLOGY_H_
+#define _BLAZE_UTIL_THREADPOOL_TOPOLOGY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Description of a single logical CPU.
+// \ingroup threads
+*/
+struct CPU
+{
+   size_t id;       //!< The operating system index of the logical CPU.
+   size_t core;     //!< Index of the physical core within the package.
+   size_t package;  //!< Index of the physical package (socket).
+   size_t cache;    //!< Index of the last-level cache domain.
+                    /*!< The index of a cache domain is given by the smallest index of all
+                         logical CPUs sharing the according last-level cache. */
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Topology of the logical CPUs available to the process.
+// \ingroup threads
+//
+// The Topology class represents the logical CPUs the process is allowed to run on, including
+// their mapping to physical cores, packages and last-level cache domains. On Linux systems the
+// topology is read from \c /sys/devices/system/cpu and restricted to the affinity mask of the
+// process. On all other systems, or in case the topology is not available, the logical CPUs are
+// assumed to be independent cores sharing a single package and cache. The logical CPUs are
+// sorted by package, cache domain, core and index, i.e. SMT siblings are adjacent and all
+// logical CPUs sharing a last-level cache form a contiguous range.
+*/
+class Topology
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ConstIterator = std::vector<CPU>::const_iterator;  //!< Iterator over the logical CPUs.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Topology( const std::string& root = "/sys/devices/system/cpu" );
+   explicit inline Topology( std::vector<CPU> cpus );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t        size()                   const noexcept;
+   inline const CPU&    operator[]( size_t index ) const noexcept;
+   inline ConstIterator begin()                  const noexcept;
+   inline ConstIterator end()                    const noexcept;
+   inline const CPU*    find( size_t id )        const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline bool   read( const std::string& file, std::string& value );
+   static inline size_t readIndex( const std::string& file, size_t fallback );
+   static inline size_t readCache( const std::string& cpu, size_t fallback );
+   static inline bool   isAllowed( size_t id );
+
+   inline void sort();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<CPU> cpus_;  //!< The available logical CPUs.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parsing a list of CPU indices.
+// \ingroup threads
+//
+// \param list The list of CPU indices (e.g. "0-3,8,10-11").
+// \return The parsed CPU indices in the given order.
+// \exception std::invalid_argument Invalid CPU list.
+//
+// This function parses the given comma-separated list of CPU indices and CPU ranges as used by
+// the Linux kernel (see for instance \c /sys/devices/system/cpu/online). In case the given list
+// is malformed, a \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> parseCPUList( const std::string& list )
+{
+   std::vector<size_t> cpus;
+
+   const auto parseIndex = [&list]( size_t& pos ) -> size_t
+   {
+      if( pos >= list.size() || !std::isdigit( static_cast<unsigned char>( list[pos] ) ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+      }
+
+      size_t index( 0UL );
+      while( pos < list.size() && std::isdigit( static_cast<unsigned char>( list[pos] ) ) ) {
+         index = 10UL*index + static_cast<size_t>( list[pos] - '0' );
+         ++pos;
+      }
+      return index;
+   };
+
+   size_t pos( 0UL );
+
+   while( pos < list.size() && !std::isspace( static_cast<unsigned char>( list[pos] ) ) )
+   {
+      const size_t first( parseIndex( pos ) );
+      size_t last( first );
+
+      if( pos < list.size() && list[pos] == '-' ) {
+         ++pos;
+         last = parseIndex( pos );
+      }
+
+      if( last < first ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+      }
+
+      for( size_t cpu=first; cpu<=last; ++cpu ) {
+         cpus.push_back( cpu );
+      }
+
+      if( pos < list.size() && list[pos] == ',' ) {
+         ++pos;
+         if( pos == list.size() ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+         }
+      }
+      else if( pos < list.size() && !std::isspace( static_cast<unsigned char>( list[pos] ) ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+      }
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Topology class.
+//
+// \param root The sysfs directory describing the logical CPUs.
+*/
+inline Topology::Topology( const std::string& root )
+   : cpus_()  // The available logical CPUs
+{
+   std::string online;
+   std::vector<size_t> ids;
+
+   if( read( root + "/online", online ) ) {
+      try {
+         ids = parseCPUList( online );
+      }
+      catch( const std::invalid_argument& ) {
+         ids.clear();
+      }
+   }
+
+   for( size_t id : ids )
+   {
+      if( !isAllowed( id ) )
+         continue;
+
+      const std::string cpu( root + "/cpu" + std::to_string( id ) );
+      const size_t core   ( readIndex( cpu + "/topology/core_id", id ) );
+      const size_t package( readIndex( cpu + "/topology/physical_package_id", 0UL ) );
+      const size_t cache  ( readCache( cpu, package ) );
+
+      cpus_.push_back( CPU{ id, core, package, cache } );
+   }
+
+   if( cpus_.empty() ) {
+      const size_t n( std::max( 1U, std::thread::hardware_concurrency() ) );
+      for( size_t id=0UL; id<n; ++id ) {
+         cpus_.push_back( CPU{ id, id, 0UL, 0UL } );
+      }
+   }
+
+   sort();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an explicitly given set of logical CPUs.
+//
+// \param cpus The available logical CPUs.
+//
+// This constructor creates a topology from the given logical CPUs, independent of the logical
+// CPUs of the system and of the affinity mask of the process. The logical CPUs are sorted by
+// package, cache domain, core and index. In case the given list is empty, the logical CPUs are
+// assumed to be independent cores sharing a single package and cache.
+*/
+inline Topology::Topology( std::vector<CPU> cpus )
+   : cpus_( std::move( cpus ) )  // The available logical CPUs
+{
+   if( cpus_.empty() ) {
+      const size_t n( std::max( 1U, std::thread::hardware_concurrency() ) );
+      for( size_t id=0UL; id<n; ++id ) {
+         cpus_.push_back( CPU{ id, id, 0UL, 0UL } );
+      }
+   }
+
+   sort();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of available logical CPUs.
+//
+// \return The number of available logical CPUs.
+*/
+inline size_t Topology::size() const noexcept
+{
+   return cpus_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the logical CPUs.
+//
+// \param index Access index. The index has to be in the range \f$[0..size-1]\f$.
+// \return Reference to the accessed logical CPU.
+*/
+inline const CPU& Topology::operator[]( size_t index ) const noexcept
+{
+   return cpus_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first logical CPU.
+//
+// \return Iterator to the first logical CPU.
+*/
+inline Topology::ConstIterator Topology::begin() const noexcept
+{
+   return cpus_.begin();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last logical CPU.
+//
+// \return Iterator just past the last logical CPU.
+*/
+inline Topology::ConstIterator Topology::end() const noexcept
+{
+   return cpus_.end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searching for the logical CPU with the given operating system index.
+//
+// \param id The operating system index of the logical CPU.
+// \return Pointer to the logical CPU or \c nullptr in case the CPU is not available.
+*/
+inline const CPU* Topology::find( size_t id ) const noexcept
+{
+   for( const CPU& cpu : cpus_ ) {
+      if( cpu.id == id ) return &cpu;
+   }
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reading the first line of the given file.
+//
+// \param file The file to be read.
+// \param value The first line of the file.
+// \return \a true in case the file could be read, \a false if not.
+*/
+inline bool Topology::read( const std::string& file, std::string& value )
+{
+   std::ifstream in( file );
+   return static_cast<bool>( std::getline( in, value ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a single index from the given file.
+//
+// \param file The file to be read.
+// \param fallback The index returned in case the file cannot be read.
+// \return The index contained in the file.
+*/
+inline size_t Topology::readIndex( const std::string& file, size_t fallback )
+{
+   std::string value;
+
+   if( !read( file, value ) || value.empty() ||
+       !std::isdigit( static_cast<unsigned char>( value[0] ) ) )
+      return fallback;
+
+   return static_cast<size_t>( std::stoul( value ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determining the last-level cache domain of the given logical CPU.
+//
+// \param cpu The sysfs directory of the logical CPU.
+// \param fallback The domain returned in case no cache information is available.
+// \return The index of the last-level cache domain.
+*/
+inline size_t Topology::readCache( const std::string& cpu, size_t fallback )
+{
+   size_t level( 0UL );
+   size_t domain( fallback );
+
+   for( size_t index=0UL; ; ++index )
+   {
+      const std::string cache( cpu + "/cache/index" + std::to_string( index ) );
+      const size_t current( readIndex( cache + "/level", 0UL ) );
+      std::string shared;
+
+      if( current == 0UL )
+         break;
+
+      if( current >= level && read( cache + "/shared_cpu_list", shared ) ) {
+         try {
+            const std::vector<size_t> cpus( parseCPUList( shared ) );
+            if( !cpus.empty() ) {
+               level  = current;
+               domain = *std::min_element( cpus.begin(), cpus.end() );
+            }
+         }
+         catch( const std::invalid_argument& ) {}
+      }
+   }
+
+   return domain;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the process is allowed to run on the given logical CPU.
+//
+// \param id The operating system index of the logical CPU.
+// \return \a true in case the process may run on the logical CPU, \a false if not.
+*/
+inline bool Topology::isAllowed( size_t id )
+{
+#if defined(__linux__)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( id >= CPU_SETSIZE || sched_getaffinity( 0, sizeof( set ), &set ) != 0 )
+      return true;
+
+   return CPU_ISSET( id, &set );
+#else
+   MAYBE_UNUSED( id );
+   return true;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sorting the logical CPUs by package, cache domain, core and index.
+//
+// \return void
+*/
+inline void Topology::sort()
+{
+   std::stable_sort( cpus_.begin(), cpus_.end(), []( const CPU& a, const CPU& b ) {
+      if( a.package != b.package ) return a.package < b.package;
+      if( a.cache   != b.cache   ) return a.cache   < b.cache;
+      if( a.core    != b.core    ) return a.core    < b.core;
+      return a.id < b.id;
+   } );
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,245 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/ArenaAllocator.h
+//  \brief Header file for the ArenaAllocator class template
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_ARENAALLOCATOR_H_
+#define _BLAZETEST_MATHTEST_ARENAALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <map>
+#include <mutex>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+//=================================================================================================
+//
+//  CLASS ARENA
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Bookkeeping of the memory acquired via the ArenaAllocator class template.
+//
+// The Arena class keeps track of all memory blocks that have been acquired via an ArenaAllocator
+// referring to the arena. In case a block is released via an allocator referring to a different
+// arena or with a different size, the block is counted as an error.
+*/
+class Arena
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Arena() : allocated_( 0UL ), errors_( 0UL ), blocks_(), mutex_() {}
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t allocated() const noexcept { return allocated_; }
+   inline size_t errors   () const noexcept { return errors_;    }
+
+   inline void add   ( void* ptr, size_t bytes );
+   inline void remove( void* ptr, size_t bytes );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t allocated_;               //!< The total number of currently allocated bytes.
+   size_t errors_;                  //!< The number of invalid deallocations.
+   std::map<void*,size_t> blocks_;  //!< The currently allocated blocks and their sizes.
+   std::mutex mutex_;               //!< Synchronization of the bookkeeping.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Registration of a newly allocated memory block.
+//
+// \param ptr The address of the memory block.
+// \param bytes The size of the memory block in bytes.
+// \return void
+*/
+inline void Arena::add( void* ptr, size_t bytes )
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+   blocks_[ptr] = bytes;
+   allocated_ += bytes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deregistration of a memory block.
+//
+// \param ptr The address of the memory block.
+// \param bytes The size of the memory block in bytes.
+// \return void
+*/
+inline void Arena::remove( void* ptr, size_t bytes )
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   const auto pos( blocks_.find( ptr ) );
+
+   if( pos == blocks_.end() || pos->second != bytes ) {
+      ++errors_;
+      return;
+   }
+
+   allocated_ -= bytes;
+   blocks_.erase( pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the arena of all default constructed ArenaAllocator instances.
+//
+// \return Reference to the default arena.
+*/
+inline Arena& defaultArena()
+{
+   static Arena arena;
+   return arena;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE ARENAALLOCATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stateful allocator for the tests of allocator-aware data structures.
+//
+// The ArenaAllocator acquires its memory via the blaze::AlignedAllocator and registers all
+// memory blocks in the arena it refers to. Two allocators compare equal if they refer to the
+// same arena. Default constructed allocators refer to the default arena (see the defaultArena()
+// function).
+*/
+template< typename Type >
+class ArenaAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using value_type = Type;  //!< Type of the allocated elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   ArenaAllocator() noexcept : arena_( &defaultArena() ) {}
+
+   explicit ArenaAllocator( Arena* arena ) noexcept : arena_( arena ) {}
+
+   template< typename Other >
+   ArenaAllocator( const ArenaAllocator<Other>& alloc ) noexcept : arena_( alloc.arena() ) {}
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   Type* allocate( size_t n ) {
+      Type* const ptr( blaze::AlignedAllocator<Type>().allocate( n ) );
+      arena_->add( ptr, n*sizeof(Type) );
+      return ptr;
+   }
+
+   void deallocate( Type* ptr, size_t n ) noexcept {
+      arena_->remove( ptr, n*sizeof(Type) );
+      blaze::AlignedAllocator<Type>().deallocate( ptr, n );
+   }
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   Arena* arena() const noexcept { return arena_; }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Arena* arena_;  //!< The arena of all memory blocks acquired by the allocator.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two ArenaAllocator objects.
+*/
+template< typename T1, typename T2 >
+bool operator==( const ArenaAllocator<T1>& lhs, const ArenaAllocator<T2>& rhs ) noexcept
+{
+   return lhs.arena() == rhs.arena();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two ArenaAllocator objects.
+*/
+template< typename T1, typename T2 >
+bool operator!=( const ArenaAllocator<T1>& lhs, const ArenaAllocator<T2>& rhs ) noexcept
+{
+   return lhs.arena() != rhs.arena();
+}
+//*************************************************************************************************
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,224 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/densematrix/TransposeTest.h
+//  \brief Header file for the dense matrix transposition test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DENSEMATRIX_TRANSPOSETEST_H_
+#define _BLAZETEST_MATHTEST_DENSEMATRIX_TRANSPOSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace densematrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the dense transposition kernels.
+//
+// This class represents a test suite for the cache-oblivious transposition kernels contained in
+// the <em><blaze/math/dense/Transpose.h></em> header file and their use by the in-place and
+// out-of-place transpositions of dense matrices. It performs a series of runtime tests with
+// square and rectangular matrices of various element types, sizes, and spacings.
+*/
+class TransposeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TransposeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T > void testOutOfPlaceKernel();
+   template< typename T > void testSquareKernel();
+   template< typename T > void testCycleKernel();
+
+   void testDynamicMatrix();
+   void testCustomMatrix();
+   void testAssignment();
+
+   template< typename T >
+   void checkElement( const std::string& kernel, blaze::size_t m, blaze::size_t n,
+                      blaze::size_t i, blaze::size_t j, const T& value, const T& expected ) const;
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single element of a transposed block.
+//
+// \param kernel The name of the checked kernel.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param i The row index of the checked element.
+// \param j The column index of the checked element.
+// \param value The value of the checked element.
+// \param expected The expected value of the element.
+// \return void
+// \exception std::runtime_error Invalid element detected.
+*/
+template< typename T >  // Data type of the elements
+void TransposeTest::checkElement( const std::string& kernel, blaze::size_t m, blaze::size_t n,
+                                  blaze::size_t i, blaze::size_t j, const T& value, const T& expected ) const
+{
+   if( value != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid element detected\n"
+          << " Details:\n"
+          << "   Kernel: " << kernel << "\n"
+          << "   Size of the block: " << m << "x" << n << "\n"
+          << "   Position: (" << i << "," << j << ")\n"
+          << "   Result: " << value << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a transposition.
+//
+// \param result The result of the transposition.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void TransposeTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense transposition kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   TransposeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense transposition test.
+*/
+#define RUN_DENSEMATRIX_TRANSPOSE_TEST \
+   blazetest::mathtest::densematrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace densematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -54,6 +54,7 @@
 #include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/constraints/SameType.h>
+#include <blazetest/mathtest/ArenaAllocator.h>
 #include <blazetest/system/Types.h>
 
 
@@ -117,6 +118,8 @@ class ClassTest
    void testSwap        ();
    void testTranspose   ();
    void testCTranspose  ();
+   void testNUMA        ();
+   void testAllocator   ();
    void testIsDefault   ();
 
    template< typename Type >
@@ -133,6 +136,8 @@ class ClassTest
 
    template< typename Type >
    void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   void checkArena( const blazetest::Arena& arena, size_t expectedBytes ) const;
    //@}
    //**********************************************************************************************
 
@@ -574,6 +579,38 @@ void ClassTest::checkNonZeros( const Type& matrix, size_t index, size_t expected
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the memory acquired from the given arena.
+//
+// \param arena The arena to be checked.
+// \param expectedBytes The expected number of currently allocated bytes.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void ClassTest::checkArena( const blazetest::Arena& arena, size_t expectedBytes ) const
+{
+   if( arena.allocated() != expectedBytes ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of allocated bytes detected\n"
+          << " Details:\n"
+          << "   Number of allocated bytes         : " << arena.allocated() << "\n"
+          << "   Expected number of allocated bytes: " << expectedBytes << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( arena.errors() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Memory released via a foreign allocator\n"
+          << " Details:\n"
+          << "   Number of invalid deallocations: " << arena.errors() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
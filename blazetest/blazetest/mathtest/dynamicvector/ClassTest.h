@@ -68,6 +68,76 @@ namespace dynamicvector {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Counting allocator for the tests of the DynamicVector class template.
+//
+// This allocator acquires its memory via the blaze::AlignedAllocator and keeps track of the
+// total number of currently allocated elements.
+*/
+template< typename Type >
+class CountingAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using value_type = Type;  //!< Type of the allocated elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   CountingAllocator() = default;
+
+   template< typename Other >
+   CountingAllocator( const CountingAllocator<Other>& ) noexcept {}
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   Type* allocate( size_t n ) {
+      Type* const ptr( blaze::AlignedAllocator<Type>().allocate( n ) );
+      allocated() += n;
+      return ptr;
+   }
+
+   void deallocate( Type* ptr, size_t n ) noexcept {
+      blaze::AlignedAllocator<Type>().deallocate( ptr, n );
+      allocated() -= n;
+   }
+
+   static size_t& allocated() noexcept {
+      static size_t count( 0UL );
+      return count;
+   }
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two CountingAllocator objects.
+*/
+template< typename T1, typename T2 >
+bool operator==( const CountingAllocator<T1>&, const CountingAllocator<T2>& ) noexcept
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two CountingAllocator objects.
+*/
+template< typename T1, typename T2 >
+bool operator!=( const CountingAllocator<T1>&, const CountingAllocator<T2>& ) noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Auxiliary class for all tests of the DynamicVector class template.
 //
@@ -115,6 +185,8 @@ class ClassTest
    void testReserve     ();
    void testShrinkToFit ();
    void testSwap        ();
+   void testNUMA        ();
+   void testAllocator   ();
    void testIsDefault   ();
 
    template< typename Type >
@@ -0,0 +1,362 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/mappedmatrix/ClassTest.h
+//  \brief Header file for the MappedMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_MAPPEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MAPPEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/math/constraints/ColumnMajorMatrix.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsCustom.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MappedMatrix class template.
+//
+// This class represents a test suite for the blaze::MappedMatrix class template. It performs a
+// series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ClassTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors  ();
+   void testAssignment    ();
+   void testReset         ();
+   void testMultiplication();
+   void testAccessPattern ();
+
+   template< bool SO >
+   void testFileRoundTrip();
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkElements( const Type1& matrix, const Type2& reference ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< Name of the temporary file used by all tests.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Type of the row-major mapped matrix.
+   using MT = blaze::MappedMatrix<double,blaze::rowMajor>;
+
+   //! Type of the column-major mapped matrix.
+   using OMT = blaze::MappedMatrix<double,blaze::columnMajor>;
+
+   //! Type of the read-only row-major mapped matrix.
+   using CMT = blaze::MappedMatrix<const double,blaze::rowMajor>;
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT              );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OMT             );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OMT::ResultType );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( CMT             );
+
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( MT              );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( MT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OMT             );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OMT::ResultType );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType,  double                       );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType,  MT::ResultType::ElementType  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( OMT::ElementType, OMT::ResultType::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( CMT::ElementType, const double                 );
+
+   BLAZE_STATIC_ASSERT( blaze::IsCustom_v<MT>  && blaze::IsCustom_v<CMT>  );
+   BLAZE_STATIC_ASSERT( blaze::IsAligned_v<MT> && blaze::IsAligned_v<CMT> );
+   BLAZE_STATIC_ASSERT( blaze::IsPadded_v<MT>  && blaze::IsPadded_v<CMT>  );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of writing a matrix to a new file and mapping the file again.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes random matrices of the given storage order and of various sizes to a
+// newly created file and maps the file again, both read-write and read-only. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the matrix
+void ClassTest::testFileRoundTrip()
+{
+   for( size_t m=0UL; m<=19UL; m+=3UL ) {
+      for( size_t n=0UL; n<=19UL; n+=4UL )
+      {
+         blaze::DynamicMatrix<double,SO> ref( m, n );
+         blaze::randomize( ref );
+
+         {
+            blaze::MappedMatrix<double,SO> mat( file_, m, n );
+
+            checkRows   ( mat, m );
+            checkColumns( mat, n );
+
+            if( !isIntact( mat ) || !isZero( mat ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid initialization of new file\n"
+                   << " Details:\n"
+                   << "   Result:\n" << mat << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            mat = ref;
+            mat.sync();
+         }
+
+         {
+            const blaze::MappedMatrix<double,SO> mat( file_ );
+            checkElements( mat, ref );
+         }
+
+         {
+            const blaze::MappedMatrix<const double,SO> mat( file_, blaze::sequentialAccess );
+            checkElements( mat, ref );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given matrix. In case the actual number of
+// rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( rows( matrix ) != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << rows( matrix ) << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given matrix. In case the actual number of
+// columns does not correspond to the given expected number of columns, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( columns( matrix ) != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << columns( matrix ) << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking all elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param reference The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares all elements of the given matrix to the elements of the given
+// reference matrix. In case any element does not match, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type1    // Type of the matrix
+        , typename Type2 >  // Type of the reference matrix
+void ClassTest::checkElements( const Type1& matrix, const Type2& reference ) const
+{
+   checkRows   ( matrix, rows( reference ) );
+   checkColumns( matrix, columns( reference ) );
+
+   for( size_t i=0UL; i<rows( reference ); ++i ) {
+      for( size_t j=0UL; j<columns( reference ); ++j ) {
+         if( matrix(i,j) != reference(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element (" << i << "," << j << ") detected\n"
+                << " Details:\n"
+                << "   Result:\n" << matrix << "\n"
+                << "   Expected result:\n" << reference << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MappedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MappedMatrix class test.
+*/
+#define RUN_MAPPEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::mappedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mappedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,329 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/reordering/SparseTest.h
+//  \brief Header file for the sparse matrix reordering test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_REORDERING_SPARSETEST_H_
+#define _BLAZETEST_MATHTEST_REORDERING_SPARSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace reordering {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all sparse matrix reordering tests.
+//
+// This class represents a test suite for the sparse matrix reordering functionality. It tests
+// the reverse Cuthill-McKee and nested dissection orderings as well as the symmetric sparse
+// matrix permutation and the dense vector permutation.
+*/
+class SparseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testRCM();
+   void testNestedDissection();
+   void testPermute();
+   void testVectorPermute();
+
+   template< typename Type >
+   void checkPermutation( const Type& A, const blaze::DynamicVector<size_t>& p ) const;
+
+   template< typename Type >
+   void checkPermuted( const Type& A, const blaze::DynamicVector<size_t>& p ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   blaze::CompressedMatrix<double,SO> grid( size_t m, size_t n, bool shuffle ) const;
+
+   template< typename Type >
+   size_t bandwidth( const Type& A ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking whether the given vector is a valid permutation of the rows of the given matrix.
+//
+// \param A The permuted matrix.
+// \param p The permutation vector to be checked.
+// \return void
+// \exception std::runtime_error Invalid permutation vector detected.
+*/
+template< typename Type >  // Type of the sparse matrix
+void SparseTest::checkPermutation( const Type& A, const blaze::DynamicVector<size_t>& p ) const
+{
+   std::vector<bool> found( A.rows(), false );
+   bool valid( p.size() == A.rows() );
+
+   for( size_t i=0UL; valid && i<p.size(); ++i ) {
+      if( p[i] >= A.rows() || found[p[i]] )
+         valid = false;
+      else
+         found[p[i]] = true;
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation vector detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Number of rows: " << A.rows() << "\n"
+          << "   Permutation:\n" << p << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the symmetric permutation of the given matrix.
+//
+// \param A The matrix to be permuted.
+// \param p The permutation vector.
+// \return void
+// \exception std::runtime_error Invalid permuted matrix detected.
+*/
+template< typename Type >  // Type of the sparse matrix
+void SparseTest::checkPermuted( const Type& A, const blaze::DynamicVector<size_t>& p ) const
+{
+   const Type B( blaze::permute( A, p ) );
+
+   bool valid( B.rows() == A.rows() && B.columns() == A.columns() && B.nonZeros() == A.nonZeros() );
+
+   for( size_t i=0UL; valid && i<A.rows(); ++i ) {
+      for( size_t j=0UL; valid && j<A.columns(); ++j ) {
+         if( B(i,j) != A(p[i],p[j]) )
+            valid = false;
+      }
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid symmetric permutation detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Permutation:\n" << p << "\n"
+          << "   Original matrix:\n" << A << "\n"
+          << "   Permuted matrix:\n" << B << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of the 5-point stencil matrix of a 2D grid.
+//
+// \param m The number of grid points in x-direction.
+// \param n The number of grid points in y-direction.
+// \param shuffle \a true to randomly relabel the grid points, \a false to keep the natural order.
+// \return The resulting sparse matrix.
+*/
+template< bool SO >  // Storage order of the sparse matrix
+blaze::CompressedMatrix<double,SO> SparseTest::grid( size_t m, size_t n, bool shuffle ) const
+{
+   const size_t N( m*n );
+
+   std::vector<size_t> label( N );
+   for( size_t i=0UL; i<N; ++i ) {
+      label[i] = i;
+   }
+
+   if( shuffle ) {
+      for( size_t i=N-1UL; i>0UL; --i ) {
+         std::swap( label[i], label[blaze::rand<size_t>( 0UL, i )] );
+      }
+   }
+
+   blaze::CompressedMatrix<double,SO> A( N, N );
+   A.reserve( 5UL*N );
+
+   for( size_t y=0UL; y<n; ++y ) {
+      for( size_t x=0UL; x<m; ++x ) {
+         const size_t k( label[y*m+x] );
+         A(k,k) = 4.0;
+         if( x > 0UL   ) A(k,label[y*m+x-1UL]) = -1.0;
+         if( x+1UL < m ) A(k,label[y*m+x+1UL]) = -1.0;
+         if( y > 0UL   ) A(k,label[(y-1UL)*m+x]) = -1.0;
+         if( y+1UL < n ) A(k,label[(y+1UL)*m+x]) = -1.0;
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of the given sparse matrix.
+//
+// \param A The given sparse matrix.
+// \return The maximum distance of any non-zero element from the diagonal.
+*/
+template< typename Type >  // Type of the sparse matrix
+size_t SparseTest::bandwidth( const Type& A ) const
+{
+   size_t bw( 0UL );
+
+   for( size_t i=0UL; i<( blaze::IsRowMajorMatrix<Type>::value ? A.rows() : A.columns() ); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         bw = std::max( bw, ( i > j ? i-j : j-i ) );
+      }
+   }
+
+   return bw;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix reordering functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix reordering test.
+*/
+#define RUN_SPARSE_REORDERING_TEST \
+   blazetest::mathtest::reordering::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace reordering
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
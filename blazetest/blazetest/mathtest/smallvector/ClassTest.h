@@ -0,0 +1,298 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smallvector/ClassTest.h
+//  \brief Header file for the SmallVector class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMALLVECTOR_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SMALLVECTOR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/constraints/ColumnVector.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RowVector.h>
+#include <blaze/math/SmallVector.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smallvector {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SmallVector class template.
+//
+// This class represents a test suite for the blaze::SmallVector class template. It performs a
+// series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testResize      ();
+   void testShrinkToFit ();
+   void testSwap        ();
+   void testArithmetic  ();
+
+   template< typename Type >
+   void checkSize( const Type& vector, size_t expectedSize ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& vector, size_t minCapacity ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkElements( const Type1& vector, const Type2& reference ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Type of the small column vector.
+   using VT = blaze::SmallVector<int,4UL,blaze::columnVector>;
+
+   //! Type of the small row vector.
+   using TVT = blaze::SmallVector<int,4UL,blaze::rowVector>;
+
+   //! Type of the small vector with non-trivial element type.
+   using SVT = blaze::SmallVector<std::string,2UL,blaze::columnVector>;
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT              );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( TVT             );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( TVT::ResultType );
+
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT              );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE   ( TVT             );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE   ( TVT::ResultType );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( VT::ElementType, int                         );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( VT::ElementType, VT::ResultType::ElementType );
+
+   BLAZE_STATIC_ASSERT( blaze::IsAligned_v<VT> && blaze::IsResizable_v<VT> && blaze::IsShrinkable_v<VT> );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given vector.
+//
+// \param vector The vector to be checked.
+// \param expectedSize The expected size of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size of the given vector. In case the actual size does not
+// correspond to the given expected size, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the vector
+void ClassTest::checkSize( const Type& vector, size_t expectedSize ) const
+{
+   if( size( vector ) != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Size         : " << size( vector ) << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given vector.
+//
+// \param vector The vector to be checked.
+// \param minCapacity The expected minimum capacity of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of the given vector. In case the actual capacity is smaller
+// than the given expected minimum capacity, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the vector
+void ClassTest::checkCapacity( const Type& vector, size_t minCapacity ) const
+{
+   if( capacity( vector ) < minCapacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity                 : " << capacity( vector ) << "\n"
+          << "   Expected minimum capacity: " << minCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking all elements of the given vector.
+//
+// \param vector The vector to be checked.
+// \param reference The reference vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares all elements of the given vector to the elements of the given
+// reference vector and checks the invariants of the vector. In case any element does not
+// match or the invariants are violated, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the vector
+        , typename Type2 >  // Type of the reference vector
+void ClassTest::checkElements( const Type1& vector, const Type2& reference ) const
+{
+   checkSize( vector, size( reference ) );
+
+   if( !isIntact( vector ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<size( reference ); ++i ) {
+      if( vector[i] != reference[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid vector element " << i << " detected\n"
+             << " Details:\n"
+             << "   Result         : " << vector[i] << "\n"
+             << "   Expected result: " << reference[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the SmallVector class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SmallVector class test.
+*/
+#define RUN_SMALLVECTOR_CLASS_TEST \
+   blazetest::mathtest::smallvector::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smallvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,289 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/ThresholdTest.h
+//  \brief Header file for the runtime SMP threshold test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_THRESHOLDTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_THRESHOLDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/SMP.h>
+#include <blaze/math/smp/Thresholds.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all runtime SMP threshold tests.
+//
+// This class represents a test suite for the runtime SMP thresholds. It tests the parsing and
+// the application of SMP threshold files as well as the setting, resetting, loading, saving and
+// calibration of the SMP thresholds.
+*/
+class ThresholdTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ThresholdTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testParse();
+   void testApply();
+   void testSet();
+   void testLoad();
+   void testSave();
+   void testCalibrate();
+
+   void checkValue( blaze::SMPThresholdID id, size_t expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   bool parse( const std::string& content, blaze::SMPThresholdSections& sections ) const;
+   bool parse( blaze::SMPThresholdSections& sections ) const;
+
+   static size_t count( const blaze::SMPThresholdSections& sections, size_t threads );
+   static size_t value( const blaze::SMPThresholdSections& sections, size_t threads, blaze::SMPThresholdID id );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< Name of the temporary SMP threshold file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the current value of the given SMP threshold.
+//
+// \param id The identifier of the SMP threshold to be checked.
+// \param expected The expected value of the SMP threshold.
+// \return void
+// \exception std::runtime_error Invalid SMP threshold detected.
+*/
+inline void ThresholdTest::checkValue( blaze::SMPThresholdID id, size_t expected ) const
+{
+   if( blaze::smpThreshold( id ) != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid SMP threshold detected\n"
+          << " Details:\n"
+          << "   Threshold: " << blaze::SMP_THRESHOLD_NAMES[id] << "\n"
+          << "   Result: " << blaze::smpThreshold( id ) << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writing and parsing the given content of an SMP threshold file.
+//
+// \param content The content of the SMP threshold file.
+// \param sections The parsed sections of the SMP threshold file.
+// \return \a true in case the content has been parsed successfully, \a false if not.
+*/
+inline bool ThresholdTest::parse( const std::string& content, blaze::SMPThresholdSections& sections ) const
+{
+   {
+      std::ofstream out( file_ );
+      out << content;
+   }
+
+   return parse( sections );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing the temporary SMP threshold file.
+//
+// \param sections The parsed sections of the SMP threshold file.
+// \return \a true in case the file has been parsed successfully, \a false if not.
+*/
+inline bool ThresholdTest::parse( blaze::SMPThresholdSections& sections ) const
+{
+   std::FILE* file( std::fopen( file_.c_str(), "r" ) );
+
+   if( file == nullptr )
+      return false;
+
+   const bool result( blaze::parseSMPThresholds( file, sections ) );
+   std::fclose( file );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of values in the section for the given number of threads.
+//
+// \param sections The sections of an SMP threshold file.
+// \param threads The number of threads of the section.
+// \return The number of values of the section (\c size_t(-1) in case there is no such section).
+*/
+inline size_t ThresholdTest::count( const blaze::SMPThresholdSections& sections, size_t threads )
+{
+   for( const blaze::SMPThresholdSection& section : sections ) {
+      if( section.threads == threads )
+         return section.values.size();
+   }
+
+   return size_t(-1);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the value of an SMP threshold in the section for the given number of threads.
+//
+// \param sections The sections of an SMP threshold file.
+// \param threads The number of threads of the section.
+// \param id The identifier of the SMP threshold.
+// \return The value of the SMP threshold (\c size_t(-1) in case there is no such value).
+*/
+inline size_t ThresholdTest::value( const blaze::SMPThresholdSections& sections, size_t threads,
+                                    blaze::SMPThresholdID id )
+{
+   for( const blaze::SMPThresholdSection& section : sections ) {
+      if( section.threads != threads ) continue;
+      for( const auto& entry : section.values ) {
+         if( entry.first == id )
+            return entry.second;
+      }
+   }
+
+   return size_t(-1);
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime SMP thresholds.
+//
+// \return void
+*/
+void runTest()
+{
+   ThresholdTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime SMP threshold test.
+*/
+#define RUN_SMP_THRESHOLD_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
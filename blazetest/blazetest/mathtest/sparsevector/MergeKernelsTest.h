@@ -0,0 +1,171 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/sparsevector/MergeKernelsTest.h
+//  \brief Header file for the sparse merge kernel test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SPARSEVECTOR_MERGEKERNELSTEST_H_
+#define _BLAZETEST_MATHTEST_SPARSEVECTOR_MERGEKERNELSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsevector {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the sparse merge kernels.
+//
+// This class represents a test suite for the union and intersection kernels for sorted sparse
+// index streams contained in the <em><blaze/math/sparse/MergeKernels.h></em> header file. All
+// kernels are compared to a reference merge for a variety of index patterns.
+*/
+class MergeKernelsTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MergeKernelsTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using VT      = blaze::CompressedVector<int>;       //!< Type of the sparse test vectors.
+   using Indices = std::vector<blaze::size_t>;         //!< Type of a sorted list of indices.
+   using Pairs   = std::vector< std::pair<int,int> >;  //!< Type of the visited pairs of values.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testGallop();
+   void testPatterns();
+   void testBlockBoundaries();
+   void testUnequalSizes();
+   void testRandom();
+   void testProbe();
+
+   void checkKernels( const Indices& a, const Indices& b );
+   void checkPairs( const std::string& kernel, const Indices& a, const Indices& b,
+                    const Pairs& result, const Pairs& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static VT    create( const Indices& indices, bool left );
+   static Pairs intersection( const Indices& a, const Indices& b );
+   static Pairs merge( const Indices& a, const Indices& b );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse merge kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   MergeKernelsTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse merge kernel tests.
+*/
+#define RUN_SPARSEVECTOR_MERGEKERNELS_TEST \
+   blazetest::mathtest::sparsevector::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace sparsevector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
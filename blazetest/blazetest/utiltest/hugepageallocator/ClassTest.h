@@ -0,0 +1,357 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/hugepageallocator/ClassTest.h
+//  \brief Header file for the HugePageAllocator test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_UTILTEST_HUGEPAGEALLOCATOR_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_HUGEPAGEALLOCATOR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/HugePageAllocator.h>
+#include <blaze/util/HugePages.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace hugepageallocator {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the HugePageAllocator class template.
+//
+// This class represents the collection of tests for the HugePageAllocator class template and
+// the according huge page statistics.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T, blaze::HugePageMode Mode > void testSmallAllocation();
+   template< typename T, blaze::HugePageMode Mode > void testLargeAllocation();
+   template< blaze::HugePageMode Mode > void testVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Type of the huge page statistics.
+   struct Statistics
+   {
+      size_t hugetlbBytes;  //!< Number of bytes mapped from the hugetlbfs pool.
+      size_t advisedBytes;  //!< Number of bytes advised for transparent huge pages.
+      size_t fallbacks;     //!< Number of allocations without huge page support.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Statistics getStatistics() const;
+   inline void checkStatistics( const std::string& test, const Statistics& before,
+                                const Statistics& after, size_t bytes ) const;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a small allocation/deallocation for a specific data type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs an allocation/deallocation of a small array of the given type \a T,
+// which is expected to be properly aligned and to not affect the huge page statistics. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T                 // Type of the allocated values
+        , blaze::HugePageMode Mode >  // Kind of huge pages
+void ClassTest::testSmallAllocation()
+{
+   const size_t numObjects( 64UL );
+
+   const Statistics before( getStatistics() );
+
+   blaze::HugePageAllocator<T,Mode> allocator;
+   T* const ptr = allocator.allocate( numObjects );
+
+   if( !blaze::checkAlignment( ptr ) ) {
+      std::ostringstream oss;
+      oss << " Test: Small allocation test for type '" << typeid( T ).name() << "'\n"
+          << " Error: Invalid alignment detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkStatistics( "Small allocation test", before, getStatistics(), 0UL );
+
+   allocator.deallocate( ptr, numObjects );
+
+   checkStatistics( "Small deallocation test", before, getStatistics(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a large allocation/deallocation for a specific data type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs an allocation/deallocation of a large array of the given type \a T,
+// which is expected to be aligned to 2 MiB and to be accounted for in the huge page statistics.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T                 // Type of the allocated values
+        , blaze::HugePageMode Mode >  // Kind of huge pages
+void ClassTest::testLargeAllocation()
+{
+   const size_t numObjects( blaze::hugePageThreshold / sizeof(T) + 1UL );
+
+   const Statistics before( getStatistics() );
+
+   blaze::HugePageAllocator<T,Mode> allocator;
+   T* const ptr = allocator.allocate( numObjects );
+
+   if( !blaze::checkAlignment( ptr ) ) {
+      std::ostringstream oss;
+      oss << " Test: Large allocation test for type '" << typeid( T ).name() << "'\n"
+          << " Error: Invalid alignment detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+#if defined(__linux__)
+   if( reinterpret_cast<size_t>( ptr ) % 2097152UL != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: Large allocation test for type '" << typeid( T ).name() << "'\n"
+          << " Error: Missing 2 MiB alignment detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkStatistics( "Large allocation test", before, getStatistics(), numObjects*sizeof(T) );
+#endif
+
+   for( size_t i=0UL; i<numObjects; ++i ) {
+      ptr[i] = T( 1 );
+   }
+
+   allocator.deallocate( ptr, numObjects );
+
+   checkStatistics( "Large deallocation test", before, getStatistics(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a dynamic vector using the HugePageAllocator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the use of the HugePageAllocator as allocator of a large dynamic vector.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< blaze::HugePageMode Mode >  // Kind of huge pages
+void ClassTest::testVector()
+{
+   using VectorType = blaze::DynamicVector<double,blaze::columnVector,blaze::HugePageAllocator<double,Mode>>;
+
+   const size_t size( blaze::hugePageThreshold / sizeof(double) );
+
+   const Statistics before( getStatistics() );
+
+   {
+      VectorType a( size, 2.0 );
+      VectorType b( a );
+      b += a;
+
+      if( b[0] != 4.0 || b[size-1UL] != 4.0 ) {
+         std::ostringstream oss;
+         oss << " Test: Vector test\n"
+             << " Error: Invalid vector addition\n"
+             << " Details:\n"
+             << "   Result: b[0] = " << b[0] << ", b[" << size-1UL << "] = " << b[size-1UL] << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkStatistics( "Vector test", before, getStatistics(), 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current huge page statistics.
+//
+// \return The current huge page statistics.
+*/
+inline ClassTest::Statistics ClassTest::getStatistics() const
+{
+   return Statistics{ blaze::getHugetlbBytes(), blaze::getAdvisedHugePageBytes(), blaze::getHugePageFallbacks() };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the change of the huge page statistics.
+//
+// \param test The name of the current test.
+// \param before The huge page statistics before the test.
+// \param after The huge page statistics after the test.
+// \param bytes The number of bytes that are expected to be backed by huge pages.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that either at least the given number of bytes has been added to the
+// huge page statistics or that exactly one allocation has fallen back to ordinary pages. In
+// case \a bytes is 0, the number of huge page bytes is expected to be unchanged. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ClassTest::checkStatistics( const std::string& test, const Statistics& before,
+                                        const Statistics& after, size_t bytes ) const
+{
+   const size_t added( ( after.hugetlbBytes + after.advisedBytes ) -
+                       ( before.hugetlbBytes + before.advisedBytes ) );
+   const size_t fallbacks( after.fallbacks - before.fallbacks );
+
+   const bool valid( bytes == 0UL
+                     ? ( added == 0UL )
+                     : ( ( added >= bytes && fallbacks == 0UL ) || ( added == 0UL && fallbacks == 1UL ) ) );
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test << "\n"
+          << " Error: Invalid huge page statistics detected\n"
+          << " Details:\n"
+          << "   Expected huge page bytes = " << bytes << "\n"
+          << "   Added huge page bytes    = " << added << "\n"
+          << "   Added fallbacks          = " << fallbacks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the HugePageAllocator class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the HugePageAllocator class test.
+*/
+#define RUN_HUGEPAGEALLOCATOR_CLASS_TEST \
+   blazetest::utiltest::hugepageallocator::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace hugepageallocator
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
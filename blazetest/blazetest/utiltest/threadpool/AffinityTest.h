@@ -0,0 +1,234 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/threadpool/AffinityTest.h
+//  \brief Header file for the ThreadPool affinity test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_THREADPOOL_AFFINITYTEST_H_
+#define _BLAZETEST_UTILTEST_THREADPOOL_AFFINITYTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Topology.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the thread affinity of the ThreadPool class template.
+//
+// This class represents the collection of tests for the parsing of CPU lists, the Topology
+// class, the affinity policies of the createAffinity() function and the pinning of threads.
+*/
+class AffinityTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AffinityTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using CPU      = blaze::threadpool::CPU;       //!< Type of the logical CPUs.
+   using Topology = blaze::threadpool::Topology;  //!< Type of the tested topology.
+   using CPUs     = std::vector<blaze::size_t>;   //!< Type of a list of logical CPUs.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testParseCPUList();
+   void testTopology();
+   void testSysfs();
+   void testPolicies();
+   void testPinning();
+
+   void checkCPUs( const CPUs& cpus, const CPUs& expected ) const;
+   void checkInvalid( const std::string& list ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static std::vector<CPU> createCPUs();
+   static CPUs allowedCPUs();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a list of logical CPUs.
+//
+// \param cpus The list of logical CPUs to be checked.
+// \param expected The expected list of logical CPUs.
+// \return void
+// \exception std::runtime_error Invalid list of logical CPUs detected.
+*/
+inline void AffinityTest::checkCPUs( const CPUs& cpus, const CPUs& expected ) const
+{
+   if( cpus != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid list of logical CPUs\n"
+          << " Details:\n"
+          << "   Result:  ";
+      for( blaze::size_t cpu : cpus ) {
+         oss << " " << cpu;
+      }
+      oss << "\n"
+          << "   Expected:";
+      for( blaze::size_t cpu : expected ) {
+         oss << " " << cpu;
+      }
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given CPU list or affinity policy is rejected.
+//
+// \param list The invalid CPU list or affinity policy.
+// \return void
+// \exception std::runtime_error The invalid setting has been accepted.
+*/
+inline void AffinityTest::checkInvalid( const std::string& list ) const
+{
+   const Topology topology( createCPUs() );
+
+   try {
+      blaze::threadpool::createAffinity( list, topology );
+   }
+   catch( const std::invalid_argument& ) {
+      return;
+   }
+
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Accepting an invalid affinity setting\n"
+       << " Details:\n"
+       << "   Setting: \"" << list << "\"\n";
+   throw std::runtime_error( oss.str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the thread affinity of the ThreadPool class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   AffinityTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the ThreadPool affinity test.
+*/
+#define RUN_THREADPOOL_AFFINITY_TEST \
+   blazetest::utiltest::threadpool::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,962 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/bitmatrix/ClassTest.cpp
+//  \brief Source file for the BitMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/bitmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bitmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BitMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testBitwise();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testBitFunctions();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testMultiplication();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BitMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BitMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BitMatrix default constructor";
+
+      blaze::BitMatrix<blaze::rowMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BitMatrix size constructor (3x130)";
+
+      blaze::BitMatrix<blaze::rowMajor> mat( 3UL, 130UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 130UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+   {
+      test_ = "Row-major BitMatrix homogeneous initialization (3x130)";
+
+      blaze::BitMatrix<blaze::rowMajor> mat( 3UL, 130UL, true );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 130UL );
+      checkNonZeros( mat, 390UL );
+      checkNonZeros( mat, 1UL, 130UL );
+
+      if( !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the bit matrix are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BitMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1{ { 1, 0, 2 }, { 0, 0, 3 } };
+      blaze::BitMatrix<blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 2UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+
+      if( mat2(0,0) != true || mat2(0,1) != false || mat2(0,2) != true ||
+          mat2(1,0) != false || mat2(1,1) != false || mat2(1,2) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 1 )\n( 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BitMatrix sparse matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 2UL, 100UL );
+      mat1(0,99) = 1;
+      mat1(1,64) = 2;
+
+      blaze::BitMatrix<blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 100UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2(0,99) != true || mat2(1,64) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BitMatrix size constructor (130x3)";
+
+      blaze::BitMatrix<blaze::columnMajor> mat( 130UL, 3UL, true );
+
+      checkRows    ( mat, 130UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 390UL );
+      checkNonZeros( mat, 2UL, 130UL );
+   }
+
+   {
+      test_ = "Column-major BitMatrix copy constructor from row-major";
+
+      blaze::BitMatrix<blaze::rowMajor> mat1( 3UL, 70UL );
+      mat1(0,0)  = true;
+      mat1(2,69) = true;
+
+      blaze::BitMatrix<blaze::columnMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 70UL );
+      checkNonZeros( mat2, 2UL );
+      checkNonZeros( mat2, 69UL, 1UL );
+
+      if( mat2(0,0) != true || mat2(2,69) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BitMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BitMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "Row-major BitMatrix homogeneous assignment";
+
+      blaze::BitMatrix<blaze::rowMajor> mat( 5UL, 67UL );
+      mat = true;
+
+      checkNonZeros( mat, 335UL );
+
+      mat = false;
+
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major BitMatrix copy assignment";
+
+      blaze::BitMatrix<blaze::rowMajor> mat1( 4UL, 4UL );
+      mat1(3,3) = true;
+
+      blaze::BitMatrix<blaze::rowMajor> mat2( 2UL, 200UL, true );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 4UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 1UL );
+
+      if( mat2(3,3) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BitMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat1{ { 0.0, 1.0 }, { 2.0, 0.0 }, { 0.0, 0.0 } };
+      blaze::BitMatrix<blaze::columnMajor> mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2(0,1) != true || mat2(1,0) != true || mat2(0,0) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the bitwise operations of the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the bitwise AND, OR, XOR, and NOT operations of the
+// BitMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testBitwise()
+{
+   const size_t M( 7UL );
+   const size_t N( 131UL );
+
+   blaze::BitMatrix<blaze::rowMajor> a( M, N ), b( M, N );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         a(i,j) = ( ( i+j ) % 3UL == 0UL );
+         b(i,j) = ( ( i*j ) % 4UL == 0UL );
+      }
+   }
+
+   {
+      test_ = "Row-major BitMatrix bitwise operations";
+
+      const blaze::BitMatrix<blaze::rowMajor> c1( a & b );
+      const blaze::BitMatrix<blaze::rowMajor> c2( a | b );
+      const blaze::BitMatrix<blaze::rowMajor> c3( a ^ b );
+      const blaze::BitMatrix<blaze::rowMajor> c4( ~a );
+
+      blaze::BitMatrix<blaze::rowMajor> d1( a ), d2( a ), d3( a );
+      d1 &= b;
+      d2 |= b;
+      d3 ^= b;
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            if( c1(i,j) != ( a(i,j) && b(i,j) ) || d1(i,j) != c1(i,j) ||
+                c2(i,j) != ( a(i,j) || b(i,j) ) || d2(i,j) != c2(i,j) ||
+                c3(i,j) != ( a(i,j) != b(i,j) ) || d3(i,j) != c3(i,j) ||
+                c4(i,j) == a(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Bitwise operation failed at (" << i << "," << j << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      checkNonZeros( c4, M*N - a.count() );
+
+      if( !isIntact( c4 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the bit matrix are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BitMatrix bitwise AND with size mismatch";
+
+      blaze::BitMatrix<blaze::rowMajor> c( M, N+1UL );
+
+      try {
+         c &= a;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation with mismatching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BitMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call
+// operator of the BitMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major BitMatrix::operator()";
+
+      blaze::BitMatrix<blaze::rowMajor> mat( 3UL, 100UL );
+
+      mat(0,63) = true;
+      mat(1,64) = mat(0,63);
+      mat(2,99) |= true;
+      mat(1,64) ^= true;
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+
+   {
+      test_ = "Column-major BitMatrix::operator()";
+
+      blaze::BitMatrix<blaze::columnMajor> mat( 100UL, 3UL );
+
+      mat(63,0) = true;
+      mat(64,1) = true;
+      mat(64,1) = false;
+      mat(99,2) = true;
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the \c at() member
+// function of the BitMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "Row-major BitMatrix::at()";
+
+   blaze::BitMatrix<blaze::rowMajor> mat( 2UL, 3UL );
+
+   mat.at(1,2) = true;
+
+   if( mat.at(1,2) != true || mat.at(0,0) != false ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat.at(2,0) = true;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BitMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the BitMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   {
+      test_ = "Row-major BitMatrix iterator";
+
+      using MatrixType    = blaze::BitMatrix<blaze::rowMajor>;
+      using Iterator      = MatrixType::Iterator;
+      using ConstIterator = MatrixType::ConstIterator;
+
+      MatrixType mat( 3UL, 70UL );
+      mat(1,0)  = true;
+      mat(1,69) = true;
+
+      if( end( mat, 1UL ) - begin( mat, 1UL ) != 70L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      size_t count( 0UL );
+      for( ConstIterator it=cbegin( mat, 1UL ); it!=cend( mat, 1UL ); ++it ) {
+         if( *it ) ++count;
+      }
+
+      if( count != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid read access via ConstIterator\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( Iterator it=begin( mat, 2UL ); it!=end( mat, 2UL ); ++it ) {
+         *it = true;
+      }
+
+      checkNonZeros( mat, 72UL );
+      checkNonZeros( mat, 2UL, 70UL );
+   }
+
+   {
+      test_ = "Column-major BitMatrix iterator";
+
+      using MatrixType = blaze::BitMatrix<blaze::columnMajor>;
+      using Iterator   = MatrixType::Iterator;
+
+      MatrixType mat( 70UL, 3UL );
+
+      for( Iterator it=begin( mat, 0UL ); it!=end( mat, 0UL ); it+=2L ) {
+         *it = true;
+      }
+
+      checkNonZeros( mat, 35UL );
+      checkNonZeros( mat, 0UL, 35UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the BitMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "Row-major BitMatrix::nonZeros()";
+
+   for( size_t n=1UL; n<200UL; n+=41UL )
+   {
+      blaze::BitMatrix<blaze::rowMajor> mat( 3UL, n );
+      size_t expected( 0UL );
+
+      for( size_t i=0UL; i<3UL; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( blaze::rand<int>( 0, 1 ) ) {
+               mat(i,j) = true;
+               ++expected;
+            }
+         }
+      }
+
+      checkNonZeros( mat, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the bit functions of the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set(), \c unset(), \c flip(), \c test(), \c any(),
+// \c all(), and \c none() member functions of the BitMatrix class template. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBitFunctions()
+{
+   test_ = "Row-major BitMatrix bit functions";
+
+   blaze::BitMatrix<blaze::rowMajor> mat( 2UL, 65UL );
+
+   if( mat.any() || mat.all() || !mat.none() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid any()/all()/none() result for an empty bit matrix\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   mat.set( 1UL, 64UL );
+
+   if( !mat.any() || mat.all() || !mat.test( 1UL, 64UL ) || mat.test( 0UL, 64UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: set() failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   mat.set();
+
+   if( !mat.all() || mat.count() != 130UL || !isIntact( mat ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: set() of all bits failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   mat.unset( 0UL, 3UL ).flip( 1UL, 4UL ).flip();
+
+   if( mat.count() != 2UL || !mat.test( 0UL, 3UL ) || !mat.test( 1UL, 4UL ) || !isIntact( mat ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: unset()/flip() failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the BitMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "Row-major BitMatrix::reset()";
+
+   blaze::BitMatrix<blaze::rowMajor> mat( 3UL, 100UL, true );
+
+   reset( mat, 1UL );
+
+   checkNonZeros( mat, 200UL );
+   checkNonZeros( mat, 1UL, 0UL );
+
+   reset( mat );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 100UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the BitMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "Row-major BitMatrix::clear()";
+
+   blaze::BitMatrix<blaze::rowMajor> mat( 3UL, 100UL, true );
+
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the BitMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major BitMatrix::resize()";
+
+      blaze::BitMatrix<blaze::rowMajor> mat( 3UL, 100UL, true );
+
+      mat.resize( 2UL, 70UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 70UL );
+      checkNonZeros( mat, 140UL );
+
+      mat.resize( 4UL, 200UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 200UL );
+      checkNonZeros( mat, 140UL );
+      checkNonZeros( mat, 1UL, 70UL );
+      checkNonZeros( mat, 3UL, 0UL );
+
+      if( !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the bit matrix are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BitMatrix::resize()";
+
+      blaze::BitMatrix<blaze::columnMajor> mat( 100UL, 3UL, true );
+
+      mat.resize( 65UL, 1UL );
+
+      checkRows    ( mat, 65UL );
+      checkColumns ( mat, 1UL );
+      checkNonZeros( mat, 65UL );
+
+      mat.resize( 0UL, 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BitMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "Row-major BitMatrix swap";
+
+   blaze::BitMatrix<blaze::rowMajor> mat1( 2UL, 2UL, true );
+   blaze::BitMatrix<blaze::rowMajor> mat2( 3UL, 100UL );
+   mat2(2,99) = true;
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkColumns ( mat1, 100UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 4UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of bit matrices with dense vectors and bit vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the matrix/vector multiplications involving bit matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const size_t M( 9UL );
+   const size_t N( 150UL );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> ref( M, N, 0 );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         ref(i,j) = blaze::rand<int>( 0, 1 );
+      }
+   }
+
+   const blaze::BitMatrix<blaze::rowMajor>    mat ( ref );
+   const blaze::BitMatrix<blaze::columnMajor> tmat( ref );
+
+   blaze::DynamicVector<int,blaze::columnVector> x( N );
+   blaze::DynamicVector<int,blaze::rowVector>    y( M );
+   blaze::BitVector<blaze::columnVector>         b( N );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      x[j] = blaze::rand<int>( -10, 10 );
+      b[j] = ( j % 3UL == 1UL );
+   }
+   for( size_t i=0UL; i<M; ++i ) {
+      y[i] = blaze::rand<int>( -10, 10 );
+   }
+
+   const blaze::DynamicVector<int,blaze::columnVector> bref( b );
+
+   {
+      test_ = "BitMatrix/dense vector multiplication";
+
+      const blaze::DynamicVector<int,blaze::columnVector> res1( mat  * x );
+      const blaze::DynamicVector<int,blaze::columnVector> res2( tmat * x );
+      const blaze::DynamicVector<int,blaze::columnVector> exp ( ref  * x );
+
+      if( res1 != exp || res2 != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << res1 << "\n"
+             << "   Column-major result:\n" << res2 << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Dense vector/BitMatrix multiplication";
+
+      const blaze::DynamicVector<int,blaze::rowVector> res1( y * mat  );
+      const blaze::DynamicVector<int,blaze::rowVector> res2( y * tmat );
+      const blaze::DynamicVector<int,blaze::rowVector> exp ( y * ref  );
+
+      if( res1 != exp || res2 != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << res1 << "\n"
+             << "   Column-major result:\n" << res2 << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BitMatrix/BitVector multiplication";
+
+      const blaze::DynamicVector<size_t,blaze::columnVector> res1( mat  * b );
+      const blaze::DynamicVector<size_t,blaze::columnVector> res2( tmat * b );
+      const blaze::DynamicVector<int,blaze::columnVector>    exp ( ref  * bref );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         if( res1[i] != static_cast<size_t>( exp[i] ) || res2[i] != static_cast<size_t>( exp[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Row-major result:\n" << res1 << "\n"
+                << "   Column-major result:\n" << res2 << "\n"
+                << "   Expected result:\n" << exp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the BitMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the BitMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   {
+      blaze::BitMatrix<blaze::rowMajor> mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::BitMatrix<blaze::rowMajor> mat( 2UL, 3UL );
+
+      if( isDefault( mat(0,1) ) != true || isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace bitmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BitMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BITMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BitMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
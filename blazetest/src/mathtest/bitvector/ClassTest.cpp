@@ -0,0 +1,1081 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/bitvector/ClassTest.cpp
+//  \brief Source file for the BitVector class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/bitvector/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bitvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BitVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testBitwise();
+   testSubscript();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testBitFunctions();
+   testReset();
+   testClear();
+   testResize();
+   testExtend();
+   testSwap();
+   testInner();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BitVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BitVector class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BitVector default constructor";
+
+      blaze::BitVector<blaze::rowVector> vec;
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BitVector size constructor (size 0)";
+
+      blaze::BitVector<blaze::rowVector> vec( 0UL );
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "BitVector size constructor (size 130)";
+
+      blaze::BitVector<blaze::rowVector> vec( 130UL );
+
+      checkSize    ( vec, 130UL );
+      checkCapacity( vec, 130UL );
+      checkNonZeros( vec, 0UL );
+
+      if( !isIntact( vec ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the bit vector are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "BitVector homogeneous initialization constructor (size 130)";
+
+      blaze::BitVector<blaze::rowVector> vec( 130UL, true );
+
+      checkSize    ( vec, 130UL );
+      checkCapacity( vec, 130UL );
+      checkNonZeros( vec, 130UL );
+
+      if( !isIntact( vec ) || !vec.all() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 1 1 ... 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // List initialization
+   //=====================================================================================
+
+   {
+      test_ = "BitVector initializer list constructor";
+
+      blaze::BitVector<blaze::rowVector> vec{ true, false, false, true };
+
+      checkSize    ( vec, 4UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != true || vec[1] != false || vec[2] != false || vec[3] != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy/move constructor
+   //=====================================================================================
+
+   {
+      test_ = "BitVector copy constructor";
+
+      blaze::BitVector<blaze::rowVector> vec1{ true, false, true };
+      blaze::BitVector<blaze::rowVector> vec2( vec1 );
+
+      checkSize    ( vec2, 3UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != true || vec2[1] != false || vec2[2] != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BitVector move constructor";
+
+      blaze::BitVector<blaze::rowVector> vec1{ true, false, true };
+      blaze::BitVector<blaze::rowVector> vec2( std::move( vec1 ) );
+
+      checkSize    ( vec2, 3UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != true || vec2[1] != false || vec2[2] != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "BitVector dense vector constructor";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1{ 0, 2, 0, -1, 0 };
+      blaze::BitVector<blaze::rowVector> vec2( vec1 );
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != false || vec2[1] != true || vec2[2] != false || vec2[3] != true || vec2[4] != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 0 1 0 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BitVector sparse vector constructor";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 100UL );
+      vec1[7UL]  = 1;
+      vec1[64UL] = 3;
+      vec1[99UL] = 0;
+
+      blaze::BitVector<blaze::rowVector> vec2( vec1 );
+
+      checkSize    ( vec2, 100UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[7] != true || vec2[64] != true || vec2[99] != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BitVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BitVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "BitVector homogeneous assignment";
+
+      blaze::BitVector<blaze::rowVector> vec( 70UL );
+      vec = true;
+
+      checkSize    ( vec, 70UL );
+      checkNonZeros( vec, 70UL );
+
+      vec = false;
+
+      checkSize    ( vec, 70UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "BitVector initializer list assignment";
+
+      blaze::BitVector<blaze::rowVector> vec;
+      vec = { false, true, true };
+
+      checkSize    ( vec, 3UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != false || vec[1] != true || vec[2] != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 1 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BitVector copy assignment";
+
+      blaze::BitVector<blaze::rowVector> vec1( 200UL );
+      vec1.set( 0UL ).set( 199UL );
+
+      blaze::BitVector<blaze::rowVector> vec2( 10UL, true );
+      vec2 = vec1;
+
+      checkSize    ( vec2, 200UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != true || vec2[199] != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BitVector dense vector assignment";
+
+      blaze::DynamicVector<double,blaze::rowVector> vec1{ 1.0, 0.0, 0.5 };
+      blaze::BitVector<blaze::rowVector> vec2;
+      vec2 = vec1;
+
+      checkSize    ( vec2, 3UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != true || vec2[1] != false || vec2[2] != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the bitwise operations of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the bitwise AND, OR, XOR, and NOT operations of the
+// BitVector class template. The test is performed with a size that exceeds several SIMD
+// widths to cover both the vectorized and the tail handling. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBitwise()
+{
+   const size_t N( 517UL );
+
+   blaze::BitVector<blaze::rowVector> a( N ), b( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      a[i] = ( i % 3UL == 0UL );
+      b[i] = ( i % 5UL == 0UL );
+   }
+
+   {
+      test_ = "BitVector bitwise AND";
+
+      blaze::BitVector<blaze::rowVector> c( a & b );
+      blaze::BitVector<blaze::rowVector> d( a );
+      d &= b;
+
+      for( size_t i=0UL; i<N; ++i ) {
+         if( c[i] != ( a[i] && b[i] ) || d[i] != c[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Bitwise AND failed at index " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkNonZeros( c, ( N + 14UL ) / 15UL );
+   }
+
+   {
+      test_ = "BitVector bitwise OR";
+
+      blaze::BitVector<blaze::rowVector> c( a | b );
+      blaze::BitVector<blaze::rowVector> d( a );
+      d |= b;
+
+      for( size_t i=0UL; i<N; ++i ) {
+         if( c[i] != ( a[i] || b[i] ) || d[i] != c[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Bitwise OR failed at index " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "BitVector bitwise XOR";
+
+      blaze::BitVector<blaze::rowVector> c( a ^ b );
+      blaze::BitVector<blaze::rowVector> d( a );
+      d ^= b;
+
+      for( size_t i=0UL; i<N; ++i ) {
+         if( c[i] != ( a[i] != b[i] ) || d[i] != c[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Bitwise XOR failed at index " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "BitVector bitwise NOT";
+
+      blaze::BitVector<blaze::rowVector> c( ~a );
+
+      checkSize    ( c, N );
+      checkNonZeros( c, N - a.count() );
+
+      if( !isIntact( c ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the bit vector are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BitVector bitwise AND with size mismatch";
+
+      blaze::BitVector<blaze::rowVector> c( N+1UL );
+
+      try {
+         c &= a;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation with mismatching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BitVector subscript operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the subscript operator
+// of the BitVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSubscript()
+{
+   test_ = "BitVector::operator[]";
+
+   blaze::BitVector<blaze::rowVector> vec( 100UL );
+
+   vec[63] = true;
+   vec[64] = vec[63];
+   vec[0] |= true;
+   vec[64] ^= true;
+   vec[99].flip();
+
+   checkSize    ( vec, 100UL );
+   checkNonZeros( vec, 3UL );
+
+   if( vec[0] != true || vec[63] != true || vec[64] != false || vec[99] != true ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Subscript operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::BitVector<blaze::rowVector>& cvec( vec );
+
+   if( cvec[63] != true || cvec[62] != false ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Const subscript operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << cvec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the \c at() member
+// function of the BitVector class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "BitVector::at()";
+
+   blaze::BitVector<blaze::rowVector> vec( 10UL );
+
+   vec.at(2) = true;
+
+   if( vec.at(2) != true || vec.at(3) != false ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      vec.at(10) = true;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BitVector iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the BitVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   using VectorType    = blaze::BitVector<blaze::rowVector>;
+   using Iterator      = VectorType::Iterator;
+   using ConstIterator = VectorType::ConstIterator;
+
+   VectorType vec( 130UL );
+   vec[1] = true;
+   vec[64] = true;
+   vec[129] = true;
+
+   // Testing the Iterator default constructor
+   {
+      test_ = "Iterator default constructor";
+
+      Iterator it{};
+
+      if( it != Iterator() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator default constructor\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing conversion from Iterator to ConstIterator
+   {
+      test_ = "Iterator/ConstIterator conversion";
+
+      ConstIterator it( begin( vec ) );
+
+      if( it == end( vec ) || *it != false || *(it+1) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements via Iterator (end-begin)
+   {
+      test_ = "Iterator subtraction (end-begin)";
+
+      const ptrdiff_t number( end( vec ) - begin( vec ) );
+
+      if( number != 130L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 130\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "read-only access via ConstIterator";
+
+      size_t count( 0UL );
+      for( ConstIterator it=cbegin( vec ); it!=cend( vec ); ++it ) {
+         if( *it ) ++count;
+      }
+
+      if( count != 3UL || cbegin( vec )[64] != true || *( cend( vec ) - 1L ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid read access via ConstIterator\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via Iterator
+   {
+      test_ = "assignment via Iterator";
+
+      for( Iterator it=begin( vec ); it!=end( vec ); ++it ) {
+         *it = !*it;
+      }
+
+      checkNonZeros( vec, 127UL );
+
+      if( vec[1] != false || vec[64] != false || vec[129] != false || vec[0] != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the BitVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "BitVector::nonZeros()";
+
+   for( size_t n=0UL; n<300UL; n+=37UL )
+   {
+      blaze::BitVector<blaze::rowVector> vec( n );
+      size_t expected( 0UL );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( blaze::rand<int>( 0, 1 ) ) {
+            vec[i] = true;
+            ++expected;
+         }
+      }
+
+      checkSize    ( vec, n );
+      checkNonZeros( vec, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the bit functions of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set(), \c unset(), \c flip(), \c test(), \c any(),
+// \c all(), and \c none() member functions of the BitVector class template. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBitFunctions()
+{
+   test_ = "BitVector bit functions";
+
+   blaze::BitVector<blaze::rowVector> vec( 65UL );
+
+   if( vec.any() || vec.all() || !vec.none() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid any()/all()/none() result for an empty bit vector\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   vec.set( 64UL );
+
+   if( !vec.any() || vec.all() || vec.none() || !vec.test( 64UL ) || vec.test( 63UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: set() failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   vec.set();
+
+   if( !vec.all() || vec.count() != 65UL || !isIntact( vec ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: set() of all bits failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   vec.unset( 3UL ).flip( 4UL );
+
+   if( vec.test( 3UL ) || vec.test( 4UL ) || vec.count() != 63UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: unset()/flip() failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   vec.flip();
+
+   if( vec.count() != 2UL || !vec.test( 3UL ) || !vec.test( 4UL ) || !isIntact( vec ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: flip() of all bits failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the BitVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "BitVector::reset()";
+
+   blaze::BitVector<blaze::rowVector> vec( 100UL, true );
+
+   reset( vec );
+
+   checkSize    ( vec, 100UL );
+   checkNonZeros( vec, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the BitVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "BitVector::clear()";
+
+   blaze::BitVector<blaze::rowVector> vec( 100UL, true );
+
+   clear( vec );
+
+   checkSize    ( vec, 0UL );
+   checkNonZeros( vec, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the BitVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "BitVector::resize()";
+
+   blaze::BitVector<blaze::rowVector> vec( 100UL, true );
+
+   vec.resize( 70UL );
+
+   checkSize    ( vec, 70UL );
+   checkNonZeros( vec, 70UL );
+
+   vec.resize( 300UL );
+
+   checkSize    ( vec, 300UL );
+   checkCapacity( vec, 300UL );
+   checkNonZeros( vec, 70UL );
+
+   if( !isIntact( vec ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariants of the bit vector are violated\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   vec.resize( 0UL );
+
+   checkSize    ( vec, 0UL );
+   checkNonZeros( vec, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c extend() member function of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c extend() member function of the BitVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExtend()
+{
+   test_ = "BitVector::extend()";
+
+   blaze::BitVector<blaze::rowVector> vec( 60UL, true );
+
+   vec.extend( 10UL );
+
+   checkSize    ( vec, 70UL );
+   checkCapacity( vec, 70UL );
+   checkNonZeros( vec, 60UL );
+
+   vec.extend( 200UL );
+
+   checkSize    ( vec, 270UL );
+   checkCapacity( vec, 270UL );
+   checkNonZeros( vec, 60UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BitVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BitVector swap";
+
+   blaze::BitVector<blaze::rowVector> vec1( 10UL, true );
+   blaze::BitVector<blaze::rowVector> vec2( 200UL );
+   vec2[100] = true;
+
+   swap( vec1, vec2 );
+
+   checkSize    ( vec1, 200UL );
+   checkNonZeros( vec1, 1UL );
+   checkSize    ( vec2, 10UL );
+   checkNonZeros( vec2, 10UL );
+
+   if( vec1[100] != true ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first vector failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the inner products involving bit vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the inner product of two bit vectors and of a bit vector
+// and a dense vector. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInner()
+{
+   const size_t N( 333UL );
+
+   blaze::BitVector<blaze::rowVector> a( N );
+   blaze::BitVector<blaze::columnVector> b( N );
+   blaze::DynamicVector<double,blaze::columnVector> x( N );
+
+   size_t ref1( 0UL );
+   double ref2( 0.0 );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      a[i] = ( i % 2UL == 0UL );
+      b[i] = ( i % 7UL == 0UL );
+      x[i] = static_cast<double>( i );
+      if( a[i] && b[i] ) ++ref1;
+      if( a[i] ) ref2 += x[i];
+   }
+
+   {
+      test_ = "Inner product of two bit vectors";
+
+      const size_t res1( inner( a, b ) );
+      const size_t res2( a * b );
+
+      if( res1 != ref1 || res2 != ref1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inner product failed\n"
+             << " Details:\n"
+             << "   Result         : " << res1 << " / " << res2 << "\n"
+             << "   Expected result: " << ref1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Inner product of a bit vector and a dense vector";
+
+      const double res1( inner( a, x ) );
+      const double res2( a * x );
+      const double res3( trans( x ) * trans( a ) );
+
+      if( res1 != ref2 || res2 != ref2 || res3 != ref2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inner product failed\n"
+             << " Details:\n"
+             << "   Result         : " << res1 << " / " << res2 << " / " << res3 << "\n"
+             << "   Expected result: " << ref2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the BitVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the BitVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with 0-dimensional vector
+   {
+      blaze::BitVector<blaze::rowVector> vec;
+
+      if( isDefault( vec ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with default vector
+   {
+      blaze::BitVector<blaze::rowVector> vec( 3UL, false );
+
+      if( isDefault( vec[1] ) != true || isDefault( vec ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace bitvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BitVector class test..." << std::endl;
+
+   try
+   {
+      RUN_BITVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BitVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
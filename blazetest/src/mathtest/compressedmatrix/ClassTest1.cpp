@@ -80,6 +80,7 @@ ClassTest::ClassTest()
    testSchurAssign();
    testMultAssign();
    testScaling();
+   testAssignValues();
 }
 //*************************************************************************************************
 
@@ -5575,6 +5576,446 @@ void ClassTest::testScaling()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the pattern-preserving \c assignValues() member function of CompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the pattern-preserving \c assignValues() member function of
+// the CompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAssignValues()
+{
+   //=====================================================================================
+   // Row-major assignValues() (same pattern)
+   //=====================================================================================
+
+   {
+      test_ = "Row-major assignValues() (same pattern)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat{ {  0, 1, 0 },
+                                                        {  2, 0, 3 },
+                                                        {  0, 0, 4 } };
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> rhs{ {  0, 5, 0 },
+                                                        {  6, 0, 7 },
+                                                        {  0, 0, 8 } };
+
+      mat.assignValues( rhs );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 5 || mat(0,2) != 0 ||
+          mat(1,0) != 6 || mat(1,1) != 0 || mat(1,2) != 7 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 5 0 )\n( 6 0 7 )\n( 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major assignValues() (subset of the pattern)
+   //=====================================================================================
+
+   {
+      test_ = "Row-major assignValues() (subset of the pattern)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat{ {  0, 1, 0 },
+                                                        {  2, 0, 3 },
+                                                        {  0, 0, 4 } };
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> rhs( 3UL, 3UL );
+      rhs(1,0) = 6;
+      rhs(2,2) = 8;
+
+      mat.assignValues( rhs );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 6 || mat(1,1) != 0 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 6 0 0 )\n( 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major assignValues() (aliased expression)
+   //=====================================================================================
+
+   {
+      test_ = "Row-major assignValues() (aliased expression)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat{ {  0, 1, 0 },
+                                                        {  2, 0, 3 },
+                                                        {  0, 0, 4 } };
+
+      mat.assignValues( mat * 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 2 || mat(0,2) != 0 ||
+          mat(1,0) != 4 || mat(1,1) != 0 || mat(1,2) != 6 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 2 0 )\n( 4 0 6 )\n( 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major assignValues() (opposite storage order)
+   //=====================================================================================
+
+   {
+      test_ = "Row-major assignValues() (opposite storage order)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat{ {  0, 1, 0 },
+                                                        {  2, 0, 3 },
+                                                        {  0, 0, 4 } };
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> rhs{ {  0, 5, 0 },
+                                                           {  6, 0, 7 },
+                                                           {  0, 0, 8 } };
+
+      mat.assignValues( rhs );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 5 || mat(0,2) != 0 ||
+          mat(1,0) != 6 || mat(1,1) != 0 || mat(1,2) != 7 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 5 0 )\n( 6 0 7 )\n( 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major assignValues() (non-matching pattern)
+   //=====================================================================================
+
+   {
+      test_ = "Row-major assignValues() (non-matching pattern)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat{ {  0, 1, 0 },
+                                                        {  2, 0, 3 },
+                                                        {  0, 0, 4 } };
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> rhs{ {  0, 5, 0 },
+                                                        {  6, 0, 7 },
+                                                        {  1, 0, 8 } };
+
+      try {
+         mat.assignValues( rhs );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-matching sparsity pattern succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 0 || mat(0,1) != 1 || mat(0,2) != 0 ||
+          mat(1,0) != 2 || mat(1,1) != 0 || mat(1,2) != 3 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment changed the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 2 0 3 )\n( 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major assignValues() (non-matching sizes)
+   //=====================================================================================
+
+   {
+      test_ = "Row-major assignValues() (non-matching sizes)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+      blaze::CompressedMatrix<int,blaze::rowMajor> rhs( 3UL, 4UL );
+
+      try {
+         mat.assignValues( rhs );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-matching matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major assignValues() (same pattern)
+   //=====================================================================================
+
+   {
+      test_ = "Column-major assignValues() (same pattern)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat{ {  0, 1, 0 },
+                                                           {  2, 0, 3 },
+                                                           {  0, 0, 4 } };
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> rhs{ {  0, 5, 0 },
+                                                           {  6, 0, 7 },
+                                                           {  0, 0, 8 } };
+
+      mat.assignValues( rhs );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 5 || mat(0,2) != 0 ||
+          mat(1,0) != 6 || mat(1,1) != 0 || mat(1,2) != 7 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 5 0 )\n( 6 0 7 )\n( 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major assignValues() (subset of the pattern)
+   //=====================================================================================
+
+   {
+      test_ = "Column-major assignValues() (subset of the pattern)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat{ {  0, 1, 0 },
+                                                           {  2, 0, 3 },
+                                                           {  0, 0, 4 } };
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> rhs( 3UL, 3UL );
+      rhs(1,0) = 6;
+      rhs(2,2) = 8;
+
+      mat.assignValues( rhs );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 6 || mat(1,1) != 0 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 6 0 0 )\n( 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major assignValues() (aliased expression)
+   //=====================================================================================
+
+   {
+      test_ = "Column-major assignValues() (aliased expression)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat{ {  0, 1, 0 },
+                                                           {  2, 0, 3 },
+                                                           {  0, 0, 4 } };
+
+      mat.assignValues( mat * 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 2 || mat(0,2) != 0 ||
+          mat(1,0) != 4 || mat(1,1) != 0 || mat(1,2) != 6 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 2 0 )\n( 4 0 6 )\n( 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major assignValues() (opposite storage order)
+   //=====================================================================================
+
+   {
+      test_ = "Column-major assignValues() (opposite storage order)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat{ {  0, 1, 0 },
+                                                           {  2, 0, 3 },
+                                                           {  0, 0, 4 } };
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> rhs{ {  0, 5, 0 },
+                                                        {  6, 0, 7 },
+                                                        {  0, 0, 8 } };
+
+      mat.assignValues( rhs );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 5 || mat(0,2) != 0 ||
+          mat(1,0) != 6 || mat(1,1) != 0 || mat(1,2) != 7 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 5 0 )\n( 6 0 7 )\n( 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major assignValues() (non-matching pattern)
+   //=====================================================================================
+
+   {
+      test_ = "Column-major assignValues() (non-matching pattern)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat{ {  0, 1, 0 },
+                                                           {  2, 0, 3 },
+                                                           {  0, 0, 4 } };
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> rhs{ {  0, 5, 1 },
+                                                           {  6, 0, 7 },
+                                                           {  0, 0, 8 } };
+
+      try {
+         mat.assignValues( rhs );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-matching sparsity pattern succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 0 || mat(0,1) != 1 || mat(0,2) != 0 ||
+          mat(1,0) != 2 || mat(1,1) != 0 || mat(1,2) != 3 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed pattern-preserving assignment changed the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 2 0 3 )\n( 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major assignValues() (non-matching sizes)
+   //=====================================================================================
+
+   {
+      test_ = "Column-major assignValues() (non-matching sizes)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 3UL );
+      blaze::CompressedMatrix<int,blaze::columnMajor> rhs( 3UL, 4UL );
+
+      try {
+         mat.assignValues( rhs );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-matching matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedmatrix
 
 } // namespace mathtest
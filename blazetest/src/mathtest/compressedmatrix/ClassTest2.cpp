@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/mathtest/compressedmatrix/ClassTest.h>
@@ -89,6 +90,7 @@ ClassTest::ClassTest()
    testUpperBound();
    testTranspose();
    testCTranspose();
+   testAllocator();
    testIsDefault();
 }
 //*************************************************************************************************
@@ -7009,6 +7011,194 @@ void ClassTest::testCTranspose()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the allocator support of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CompressedMatrix class template in combination with a
+// stateful allocator. It checks that every matrix acquires and releases its memory via its
+// own allocator, including resizing, copy and move operations, swapping, and aliased
+// assignments. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocator()
+{
+   using AllocatorType = blazetest::ArenaAllocator<int>;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix allocator";
+
+      using MatrixType = blaze::CompressedMatrix<int,blaze::rowMajor,AllocatorType>;
+
+      blazetest::Arena arena1, arena2;
+      const AllocatorType alloc1( &arena1 ), alloc2( &arena2 );
+      const size_t defaults( blazetest::defaultArena().allocated() );
+
+      {
+         MatrixType mat1( alloc1 );
+         mat1.resize( 4UL, 6UL );
+         mat1.reserve( 10UL );
+         mat1.resize( 6UL, 6UL, true );
+         mat1(0,0) = 1;
+         mat1(1,2) = 2;
+         mat1(4,5) = 3;
+         mat1(5,5) = 4;
+         mat1.shrinkToFit();
+
+         MatrixType mat2( 3UL, 5UL, 4UL, alloc2 );
+         mat2 = mat1;
+
+         MatrixType mat3( mat1 );
+         MatrixType mat4( trans( mat1 ), alloc2 );
+
+         mat4 = trans( mat4 );
+         mat4 += mat1;
+         mat4.transpose();
+
+         MatrixType mat6( 6UL, 6UL, alloc2 );
+         mat6(2,3) = 2;
+         mat6 = mat6 * mat4;
+
+         if( arena1.allocated() == 0UL || arena2.allocated() == 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Memory not acquired via the given allocators\n"
+                << " Details:\n"
+                << "   Number of allocated bytes (arena 1): " << arena1.allocated() << "\n"
+                << "   Number of allocated bytes (arena 2): " << arena2.allocated() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         MatrixType mat5( std::move( mat3 ) );
+         swap( mat2, mat5 );
+         mat5 = std::move( mat4 );
+
+         checkArena( blazetest::defaultArena(), defaults );
+
+         checkRows    ( mat2, 6UL );
+         checkColumns ( mat2, 6UL );
+         checkNonZeros( mat2, 4UL );
+         checkRows    ( mat5, 6UL );
+         checkColumns ( mat5, 6UL );
+         checkNonZeros( mat5, 4UL );
+         checkRows    ( mat6, 6UL );
+         checkColumns ( mat6, 6UL );
+         checkNonZeros( mat6, 0UL );
+
+         if( mat2(0,0) != 1 || mat2(1,2) != 2 || mat2(4,5) != 3 || mat2(5,5) != 4 ||
+             mat5(0,0) != 2 || mat5(2,1) != 4 || mat5(5,4) != 6 || mat5(5,5) != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Operation with stateful allocator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat2 << "\n" << mat5 << "\n"
+                << "   Expected result:\n"
+                   "( 1 0 0 0 0 0 )\n( 0 0 2 0 0 0 )\n( 0 0 0 0 0 0 )\n"
+                   "( 0 0 0 0 0 0 )\n( 0 0 0 0 0 3 )\n( 0 0 0 0 0 4 )\n"
+                   "( 2 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n( 0 4 0 0 0 0 )\n"
+                   "( 0 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n( 0 0 0 0 6 8 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkArena( arena1, 0UL );
+      checkArena( arena2, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix allocator";
+
+      using MatrixType = blaze::CompressedMatrix<int,blaze::columnMajor,AllocatorType>;
+
+      blazetest::Arena arena1, arena2;
+      const AllocatorType alloc1( &arena1 ), alloc2( &arena2 );
+      const size_t defaults( blazetest::defaultArena().allocated() );
+
+      {
+         MatrixType mat1( alloc1 );
+         mat1.resize( 4UL, 6UL );
+         mat1.reserve( 10UL );
+         mat1.resize( 6UL, 6UL, true );
+         mat1(0,0) = 1;
+         mat1(1,2) = 2;
+         mat1(4,5) = 3;
+         mat1(5,5) = 4;
+         mat1.shrinkToFit();
+
+         MatrixType mat2( 3UL, 5UL, 4UL, alloc2 );
+         mat2 = mat1;
+
+         MatrixType mat3( mat1 );
+         MatrixType mat4( trans( mat1 ), alloc2 );
+
+         mat4 = trans( mat4 );
+         mat4 += mat1;
+         mat4.transpose();
+
+         MatrixType mat6( 6UL, 6UL, alloc2 );
+         mat6(2,3) = 2;
+         mat6 = mat6 * mat4;
+
+         if( arena1.allocated() == 0UL || arena2.allocated() == 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Memory not acquired via the given allocators\n"
+                << " Details:\n"
+                << "   Number of allocated bytes (arena 1): " << arena1.allocated() << "\n"
+                << "   Number of allocated bytes (arena 2): " << arena2.allocated() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         MatrixType mat5( std::move( mat3 ) );
+         swap( mat2, mat5 );
+         mat5 = std::move( mat4 );
+
+         checkArena( blazetest::defaultArena(), defaults );
+
+         checkRows    ( mat2, 6UL );
+         checkColumns ( mat2, 6UL );
+         checkNonZeros( mat2, 4UL );
+         checkRows    ( mat5, 6UL );
+         checkColumns ( mat5, 6UL );
+         checkNonZeros( mat5, 4UL );
+         checkRows    ( mat6, 6UL );
+         checkColumns ( mat6, 6UL );
+         checkNonZeros( mat6, 0UL );
+
+         if( mat2(0,0) != 1 || mat2(1,2) != 2 || mat2(4,5) != 3 || mat2(5,5) != 4 ||
+             mat5(0,0) != 2 || mat5(2,1) != 4 || mat5(5,4) != 6 || mat5(5,5) != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Operation with stateful allocator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat2 << "\n" << mat5 << "\n"
+                << "   Expected result:\n"
+                   "( 1 0 0 0 0 0 )\n( 0 0 2 0 0 0 )\n( 0 0 0 0 0 0 )\n"
+                   "( 0 0 0 0 0 0 )\n( 0 0 0 0 0 3 )\n( 0 0 0 0 0 4 )\n"
+                   "( 2 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n( 0 4 0 0 0 0 )\n"
+                   "( 0 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n( 0 0 0 0 6 8 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkArena( arena1, 0UL );
+      checkArena( arena2, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c isDefault() function with the CompressedMatrix class template.
 //
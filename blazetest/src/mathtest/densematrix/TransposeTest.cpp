@@ -0,0 +1,612 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/densematrix/TransposeTest.cpp
+//  \brief Source file for the dense matrix transposition test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/dense/Transpose.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Submatrix.h>
+#include <blazetest/mathtest/densematrix/TransposeTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace densematrix {
+
+using blaze::conj;
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the given element to a value that is unique for the position \f$ (i,j) \f$.
+//
+// \param x The element to be set.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return void
+*/
+template< typename T >
+void setValue( T& x, size_t i, size_t j )
+{
+   x = T( ( i*131UL + j ) % 20000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the given complex element to a value that is unique for the position \f$ (i,j) \f$.
+//
+// \param x The element to be set.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return void
+*/
+template< typename T >
+void setValue( std::complex<T>& x, size_t i, size_t j )
+{
+   x = std::complex<T>( T( ( i*131UL + j ) % 20000UL ), T( int( i ) - int( j ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the value of the element at position \f$ (i,j) \f$.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The value of the element.
+*/
+template< typename T >
+T valueAt( size_t i, size_t j )
+{
+   T x{};
+   setValue( x, i, j );
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes all elements of the given matrix with their unique values.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< typename MT >
+void initialize( MT& A )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         setValue( A(i,j), i, j );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the (conjugate) transpose of the given matrix element by element.
+//
+// \param A The matrix to be transposed.
+// \param conjugate \a true for the conjugate transpose, \a false for the transpose.
+// \return The (conjugate) transpose of the matrix.
+*/
+template< typename MT >
+blaze::DynamicMatrix< blaze::ElementType_t<MT> > reference( const MT& A, bool conjugate )
+{
+   blaze::DynamicMatrix< blaze::ElementType_t<MT> > B( A.columns(), A.rows() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         B(j,i) = conjugate ? conj( A(i,j) ) : A(i,j);
+      }
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TransposeTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+TransposeTest::TransposeTest()
+   : test_()  // Label of the currently performed test
+{
+   testOutOfPlaceKernel<float>();
+   testOutOfPlaceKernel<double>();
+   testOutOfPlaceKernel<short>();
+   testOutOfPlaceKernel< std::complex<float> >();
+   testOutOfPlaceKernel< std::complex<double> >();
+
+   testSquareKernel<float>();
+   testSquareKernel<double>();
+   testSquareKernel<short>();
+   testSquareKernel< std::complex<float> >();
+   testSquareKernel< std::complex<double> >();
+
+   testCycleKernel<int>();
+   testCycleKernel<double>();
+   testCycleKernel< std::complex<float> >();
+
+   testDynamicMatrix();
+   testCustomMatrix();
+   testAssignment();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the cache-oblivious out-of-place transposition kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the transposeKernel() function for blocks of various sizes (including
+// sizes that are not multiples of the micro tiles and sizes that require a recursive split)
+// and for spacings larger than the block sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the elements
+void TransposeTest::testOutOfPlaceKernel()
+{
+   test_ = "Out-of-place transposition kernel";
+
+   const T sentinel( valueAt<T>( 150UL, 100UL ) );
+
+   for( size_t m : { 1UL, 2UL, 3UL, 4UL, 5UL, 8UL, 9UL, 16UL, 17UL, 31UL, 33UL, 64UL, 70UL, 129UL } ) {
+      for( size_t n : { 1UL, 3UL, 4UL, 7UL, 8UL, 9UL, 16UL, 33UL, 65UL, 100UL } )
+      {
+         const size_t ss( m+3UL );  // Spacing of the n x m source block
+         const size_t ds( n+5UL );  // Spacing of the m x n target block
+
+         std::vector<T> src( n*ss, sentinel ), dst( m*ds, sentinel );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               setValue( src[i*ss+j], i, j );
+            }
+         }
+
+         blaze::transposeKernel( src.data(), ss, dst.data(), ds, m, n );
+
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<ds; ++j ) {
+               checkElement( "transposeKernel", m, n, i, j, dst[i*ds+j],
+                             j < n ? valueAt<T>( j, i ) : sentinel );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the cache-oblivious in-place transposition kernel for square blocks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the transposeSquareKernel() function with and without conjugation for
+// square blocks of various sizes and a spacing larger than the block size. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the elements
+void TransposeTest::testSquareKernel()
+{
+   test_ = "In-place transposition kernel for square blocks";
+
+   const T sentinel( valueAt<T>( 150UL, 100UL ) );
+
+   for( size_t n : { 1UL, 2UL, 3UL, 4UL, 5UL, 8UL, 9UL, 16UL, 17UL, 32UL, 33UL, 63UL, 64UL, 65UL, 100UL, 129UL } ) {
+      for( bool conjugate : { false, true } )
+      {
+         const size_t s( n+2UL );
+
+         std::vector<T> a( n*s, sentinel );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               setValue( a[i*s+j], i, j );
+            }
+         }
+
+         if( conjugate ) blaze::transposeSquareKernel<true >( a.data(), s, n );
+         else       blaze::transposeSquareKernel<false>( a.data(), s, n );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<s; ++j ) {
+               const T expected( j < n ? valueAt<T>( j, i ) : sentinel );
+               checkElement( conjugate ? "transposeSquareKernel (conjugate)" : "transposeSquareKernel",
+                             n, n, i, j, a[i*s+j], ( conjugate && j < n ? conj( expected ) : expected ) );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the cycle-following in-place transposition kernel for rectangular blocks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the transposeCycleKernel() function with and without conjugation for
+// contiguously stored rectangular blocks of various sizes, including single rows and columns
+// and coprime extents. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename T >  // Data type of the elements
+void TransposeTest::testCycleKernel()
+{
+   test_ = "Cycle-following in-place transposition kernel";
+
+   for( size_t m : { 1UL, 2UL, 3UL, 5UL, 7UL, 8UL, 13UL, 16UL, 37UL, 64UL } ) {
+      for( size_t n : { 1UL, 2UL, 3UL, 4UL, 7UL, 8UL, 24UL, 48UL, 91UL } ) {
+         for( bool conjugate : { false, true } )
+         {
+            std::vector<T> a( m*n );
+
+            for( size_t i=0UL; i<m; ++i ) {
+               for( size_t j=0UL; j<n; ++j ) {
+                  setValue( a[i*n+j], i, j );
+               }
+            }
+
+            if( conjugate ) blaze::transposeCycleKernel<true >( a.data(), m, n );
+            else       blaze::transposeCycleKernel<false>( a.data(), m, n );
+
+            // The n x m result is stored contiguously
+            for( size_t i=0UL; i<n; ++i ) {
+               for( size_t j=0UL; j<m; ++j ) {
+                  const T expected( valueAt<T>( j, i ) );
+                  checkElement( conjugate ? "transposeCycleKernel (conjugate)" : "transposeCycleKernel",
+                                m, n, i, j, a[i*m+j], ( conjugate ? conj( expected ) : expected ) );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the in-place transposition of dynamic matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the transpose() and ctranspose() member functions of row-major and
+// column-major dynamic matrices for square matrices (including matrices above the SMP
+// threshold), for non-square matrices without padding (cycle-following kernel), and for
+// non-square matrices with padding. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void TransposeTest::testDynamicMatrix()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using cfloat = std::complex<float>;
+
+   test_ = "DynamicMatrix::transpose() for square matrices";
+
+   for( size_t n : { 1UL, 17UL, 70UL, 250UL } )
+   {
+      blaze::DynamicMatrix<double,rowMajor> A( n, n );
+      blaze::DynamicMatrix<double,columnMajor> B( n, n );
+      initialize( A );
+      initialize( B );
+
+      const auto refA( reference( A, false ) );
+      const auto refB( reference( B, false ) );
+
+      A.transpose();
+      B.transpose();
+
+      checkResult( A, refA );
+      checkResult( B, refB );
+   }
+
+   test_ = "DynamicMatrix::ctranspose() for square matrices";
+
+   for( size_t n : { 1UL, 17UL, 70UL, 250UL } )
+   {
+      blaze::DynamicMatrix<cfloat,rowMajor> A( n, n );
+      blaze::DynamicMatrix<cfloat,columnMajor> B( n, n );
+      initialize( A );
+      initialize( B );
+
+      const auto refA( reference( A, true ) );
+      const auto refB( reference( B, true ) );
+
+      A.ctranspose();
+      B.ctranspose();
+
+      checkResult( A, refA );
+      checkResult( B, refB );
+   }
+
+   test_ = "DynamicMatrix::transpose() for non-square matrices";
+
+   // 16x24 and 24x16 matrices are not padded, 7x5 and 5x7 matrices require padding
+   for( size_t m : { 16UL, 24UL, 7UL, 5UL } )
+   {
+      const size_t n( m == 16UL ? 24UL : m == 24UL ? 16UL : m == 7UL ? 5UL : 7UL );
+
+      blaze::DynamicMatrix<double,rowMajor> A( m, n );
+      blaze::DynamicMatrix<double,columnMajor> B( m, n );
+      blaze::DynamicMatrix<cfloat,rowMajor> C( m, n );
+      blaze::DynamicMatrix<cfloat,columnMajor> D( m, n );
+      initialize( A );
+      initialize( B );
+      initialize( C );
+      initialize( D );
+
+      const auto refA( reference( A, false ) );
+      const auto refB( reference( B, false ) );
+      const auto refC( reference( C, true ) );
+      const auto refD( reference( D, true ) );
+
+      A.transpose();
+      B.transpose();
+      C.ctranspose();
+      D.ctranspose();
+
+      checkResult( A, refA );
+      checkResult( B, refB );
+      checkResult( C, refC );
+      checkResult( D, refD );
+
+      // Transposing back restores the original matrices
+      A.transpose();
+      C.ctranspose();
+
+      checkResult( A, reference( refA, false ) );
+      checkResult( C, reference( refC, true ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the in-place transposition of custom matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the transpose() and ctranspose() member functions of unpadded row-major
+// and column-major custom matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void TransposeTest::testCustomMatrix()
+{
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using cdouble = std::complex<double>;
+
+   test_ = "CustomMatrix::transpose() and CustomMatrix::ctranspose()";
+
+   for( size_t n : { 1UL, 5UL, 33UL, 70UL } )
+   {
+      std::vector<float> v1( n*n ), v2( n*n );
+      std::vector<cdouble> v3( n*n ), v4( n*n );
+
+      blaze::CustomMatrix<float,unaligned,unpadded,rowMajor> A( v1.data(), n, n );
+      blaze::CustomMatrix<float,unaligned,unpadded,columnMajor> B( v2.data(), n, n );
+      blaze::CustomMatrix<cdouble,unaligned,unpadded,rowMajor> C( v3.data(), n, n );
+      blaze::CustomMatrix<cdouble,unaligned,unpadded,columnMajor> D( v4.data(), n, n );
+      initialize( A );
+      initialize( B );
+      initialize( C );
+      initialize( D );
+
+      const auto refA( reference( A, false ) );
+      const auto refB( reference( B, false ) );
+      const auto refC( reference( C, true ) );
+      const auto refD( reference( D, true ) );
+
+      A.transpose();
+      B.transpose();
+      C.ctranspose();
+      D.ctranspose();
+
+      checkResult( A, refA );
+      checkResult( B, refB );
+      checkResult( C, refC );
+      checkResult( D, refD );
+   }
+
+   test_ = "CustomMatrix::transpose() for a non-square matrix";
+
+   std::vector<float> v( 6UL );
+   blaze::CustomMatrix<float,unaligned,unpadded,rowMajor> A( v.data(), 2UL, 3UL );
+
+   try {
+      A.transpose();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Transposition of a non-square custom matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::logic_error& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the out-of-place transposition of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment of transposed dense matrices and submatrices to row-major
+// and column-major dynamic and custom matrices, including matrices above the SMP threshold. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TransposeTest::testAssignment()
+{
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Assignment of a transposed dense matrix";
+
+   for( size_t m : { 3UL, 70UL, 300UL } )
+   {
+      const size_t n( m - m/3UL );
+
+      blaze::DynamicMatrix<double,rowMajor> A( m, n );
+      blaze::DynamicMatrix<float,columnMajor> B( m, n );
+      initialize( A );
+      initialize( B );
+
+      blaze::DynamicMatrix<double,rowMajor> C1;
+      blaze::DynamicMatrix<double,columnMajor> C2;
+      blaze::DynamicMatrix<float,rowMajor> C3;
+
+      C1 = trans( A );
+      C2 = trans( A );
+      C3 = trans( B );
+
+      checkResult( C1, reference( A, false ) );
+      checkResult( C2, reference( A, false ) );
+      checkResult( C3, reference( B, false ) );
+
+      std::vector<double> v( m*n );
+      blaze::CustomMatrix<double,unaligned,unpadded,rowMajor> D( v.data(), n, m );
+
+      D = trans( A );
+
+      checkResult( D, reference( A, false ) );
+   }
+
+   test_ = "Assignment of a transposed submatrix";
+
+   {
+      blaze::DynamicMatrix<double,rowMajor> A( 80UL, 90UL );
+      initialize( A );
+
+      auto sm( blaze::submatrix( A, 3UL, 5UL, 41UL, 67UL ) );
+
+      blaze::DynamicMatrix<double,rowMajor> C;
+      C = trans( sm );
+
+      checkResult( C, reference( sm, false ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace densematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense matrix transposition test..." << std::endl;
+
+   try
+   {
+      RUN_DENSEMATRIX_TRANSPOSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense matrix transposition test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
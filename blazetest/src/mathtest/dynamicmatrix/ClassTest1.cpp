@@ -250,6 +250,41 @@ void ClassTest::testConstructors()
    }
 
 
+   //=====================================================================================
+   // Row-major first-touch initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix first-touch initialization constructor (0x0)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 0UL, 0UL, 2, blaze::firstTouch );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major DynamicMatrix first-touch initialization constructor (301x403)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 301UL, 403UL, 2, blaze::firstTouch );
+
+      checkRows    ( mat, 301UL );
+      checkColumns ( mat, 403UL );
+      checkNonZeros( mat, 121303UL );
+
+      if( mat(0UL,0UL) != 2 || mat(150UL,201UL) != 2 || mat(300UL,402UL) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mat(0UL,0UL) << " ... " << mat(150UL,201UL) << " ... " << mat(300UL,402UL) << " )\n"
+             << "   Expected result: ( 2 ... 2 ... 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
    //=====================================================================================
    // Row-major list initialization
    //=====================================================================================
@@ -838,6 +873,41 @@ void ClassTest::testConstructors()
    }
 
 
+   //=====================================================================================
+   // Column-major first-touch initialization
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicMatrix first-touch initialization constructor (0x0)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 0UL, 0UL, 2, blaze::firstTouch );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major DynamicMatrix first-touch initialization constructor (301x403)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 301UL, 403UL, 2, blaze::firstTouch );
+
+      checkRows    ( mat, 301UL );
+      checkColumns ( mat, 403UL );
+      checkNonZeros( mat, 121303UL );
+
+      if( mat(0UL,0UL) != 2 || mat(150UL,201UL) != 2 || mat(300UL,402UL) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mat(0UL,0UL) << " ... " << mat(150UL,201UL) << " ... " << mat(300UL,402UL) << " )\n"
+             << "   Expected result: ( 2 ... 2 ... 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
    //=====================================================================================
    // Column-major list initialization
    //=====================================================================================
@@ -40,6 +40,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <utility>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
@@ -93,6 +94,8 @@ ClassTest::ClassTest()
    testSwap();
    testTranspose();
    testCTranspose();
+   testNUMA();
+   testAllocator();
    testIsDefault();
 }
 //*************************************************************************************************
@@ -6143,6 +6146,277 @@ void ClassTest::testCTranspose()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the NUMA placement functionality of the DynamicMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c interleave() and \c bindToNode() functions with the
+// DynamicMatrix class template. Since NUMA placement depends on the operating system, only the
+// preservation of the matrix elements is checked. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNUMA()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix NUMA placement";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 300UL, 400UL, 2 );
+      mat(0UL,0UL) = 1;
+      mat(299UL,399UL) = 3;
+
+      interleave( mat );
+
+      checkRows    ( mat, 300UL );
+      checkColumns ( mat, 400UL );
+      checkNonZeros( mat, 120000UL );
+
+      if( mat(0UL,0UL) != 1 || mat(0UL,1UL) != 2 || mat(299UL,398UL) != 2 || mat(299UL,399UL) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Interleaving the matrix failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mat(0UL,0UL) << " " << mat(0UL,1UL) << " ... " << mat(299UL,398UL) << " " << mat(299UL,399UL) << " )\n"
+             << "   Expected result: ( 1 2 ... 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      bindToNode( mat, 0UL );
+
+      checkRows    ( mat, 300UL );
+      checkColumns ( mat, 400UL );
+      checkNonZeros( mat, 120000UL );
+
+      if( mat(0UL,0UL) != 1 || mat(0UL,1UL) != 2 || mat(299UL,398UL) != 2 || mat(299UL,399UL) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Binding the matrix to a NUMA node failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mat(0UL,0UL) << " " << mat(0UL,1UL) << " ... " << mat(299UL,398UL) << " " << mat(299UL,399UL) << " )\n"
+             << "   Expected result: ( 1 2 ... 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicMatrix NUMA placement";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 300UL, 400UL, 2 );
+      mat(0UL,0UL) = 1;
+      mat(299UL,399UL) = 3;
+
+      interleave( mat );
+
+      checkRows    ( mat, 300UL );
+      checkColumns ( mat, 400UL );
+      checkNonZeros( mat, 120000UL );
+
+      if( mat(0UL,0UL) != 1 || mat(0UL,1UL) != 2 || mat(299UL,398UL) != 2 || mat(299UL,399UL) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Interleaving the matrix failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mat(0UL,0UL) << " " << mat(0UL,1UL) << " ... " << mat(299UL,398UL) << " " << mat(299UL,399UL) << " )\n"
+             << "   Expected result: ( 1 2 ... 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      bindToNode( mat, 0UL );
+
+      checkRows    ( mat, 300UL );
+      checkColumns ( mat, 400UL );
+      checkNonZeros( mat, 120000UL );
+
+      if( mat(0UL,0UL) != 1 || mat(0UL,1UL) != 2 || mat(299UL,398UL) != 2 || mat(299UL,399UL) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Binding the matrix to a NUMA node failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mat(0UL,0UL) << " " << mat(0UL,1UL) << " ... " << mat(299UL,398UL) << " " << mat(299UL,399UL) << " )\n"
+             << "   Expected result: ( 1 2 ... 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the allocator support of the DynamicMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the DynamicMatrix class template in combination with a
+// stateful allocator. It checks that every matrix acquires and releases its memory via its
+// own allocator, including resizing, copy and move operations, swapping, and aliased
+// assignments. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocator()
+{
+   using AllocatorType = blazetest::ArenaAllocator<int>;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix allocator";
+
+      using MatrixType = blaze::DynamicMatrix<int,blaze::rowMajor,AllocatorType>;
+
+      blazetest::Arena arena1, arena2;
+      const AllocatorType alloc1( &arena1 ), alloc2( &arena2 );
+      const size_t defaults( blazetest::defaultArena().allocated() );
+
+      {
+         MatrixType mat1( alloc1 );
+         mat1.resize( 4UL, 6UL );
+         mat1.resize( 8UL, 10UL, true );
+         mat1.reserve( 200UL );
+         mat1.shrinkToFit();
+         mat1 = 2;
+
+         checkArena( arena1, mat1.capacity()*sizeof(int) );
+
+         MatrixType mat2( 3UL, 5UL, alloc2 );
+         mat2 = mat1;
+
+         checkArena( arena2, mat2.capacity()*sizeof(int) );
+
+         MatrixType mat3( mat1 );
+         MatrixType mat4( trans( mat1 ), alloc2 );
+
+         mat4 = trans( mat4 );
+         mat4 = 2 * mat4;
+         mat4.transpose();
+
+         MatrixType mat6( 4UL, 4UL, alloc2 );
+         mat6 = 1;
+         mat6 = mat6 * mat6;
+
+         checkArena( arena1, ( mat1.capacity() + mat3.capacity() )*sizeof(int) );
+         checkArena( arena2, ( mat2.capacity() + mat4.capacity() + mat6.capacity() )*sizeof(int) );
+
+         MatrixType mat5( std::move( mat3 ) );
+         swap( mat2, mat5 );
+         mat5 = std::move( mat4 );
+
+         checkArena( arena1, ( mat1.capacity() + mat2.capacity() )*sizeof(int) );
+         checkArena( arena2, ( mat5.capacity() + mat6.capacity() )*sizeof(int) );
+         checkArena( blazetest::defaultArena(), defaults );
+
+         checkRows    ( mat2,  8UL );
+         checkColumns ( mat2, 10UL );
+         checkNonZeros( mat2, 80UL );
+         checkRows    ( mat5, 10UL );
+         checkColumns ( mat5,  8UL );
+         checkNonZeros( mat5, 80UL );
+
+         if( mat2(0,0) != 2 || mat2(7,9) != 2 || mat5(0,0) != 4 || mat5(9,7) != 4 ||
+             mat6(0,0) != 4 || mat6(3,3) != 4 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Operation with stateful allocator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat2 << "\n" << mat5 << "\n" << mat6 << "\n"
+                << "   Expected result:\n8x10 matrix of 2s\n10x8 matrix of 4s\n4x4 matrix of 4s\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkArena( arena1, 0UL );
+      checkArena( arena2, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicMatrix allocator";
+
+      using MatrixType = blaze::DynamicMatrix<int,blaze::columnMajor,AllocatorType>;
+
+      blazetest::Arena arena1, arena2;
+      const AllocatorType alloc1( &arena1 ), alloc2( &arena2 );
+      const size_t defaults( blazetest::defaultArena().allocated() );
+
+      {
+         MatrixType mat1( alloc1 );
+         mat1.resize( 4UL, 6UL );
+         mat1.resize( 8UL, 10UL, true );
+         mat1.reserve( 200UL );
+         mat1.shrinkToFit();
+         mat1 = 2;
+
+         checkArena( arena1, mat1.capacity()*sizeof(int) );
+
+         MatrixType mat2( 3UL, 5UL, alloc2 );
+         mat2 = mat1;
+
+         checkArena( arena2, mat2.capacity()*sizeof(int) );
+
+         MatrixType mat3( mat1 );
+         MatrixType mat4( trans( mat1 ), alloc2 );
+
+         mat4 = trans( mat4 );
+         mat4 = 2 * mat4;
+         mat4.transpose();
+
+         MatrixType mat6( 4UL, 4UL, alloc2 );
+         mat6 = 1;
+         mat6 = mat6 * mat6;
+
+         checkArena( arena1, ( mat1.capacity() + mat3.capacity() )*sizeof(int) );
+         checkArena( arena2, ( mat2.capacity() + mat4.capacity() + mat6.capacity() )*sizeof(int) );
+
+         MatrixType mat5( std::move( mat3 ) );
+         swap( mat2, mat5 );
+         mat5 = std::move( mat4 );
+
+         checkArena( arena1, ( mat1.capacity() + mat2.capacity() )*sizeof(int) );
+         checkArena( arena2, ( mat5.capacity() + mat6.capacity() )*sizeof(int) );
+         checkArena( blazetest::defaultArena(), defaults );
+
+         checkRows    ( mat2,  8UL );
+         checkColumns ( mat2, 10UL );
+         checkNonZeros( mat2, 80UL );
+         checkRows    ( mat5, 10UL );
+         checkColumns ( mat5,  8UL );
+         checkNonZeros( mat5, 80UL );
+
+         if( mat2(0,0) != 2 || mat2(7,9) != 2 || mat5(0,0) != 4 || mat5(9,7) != 4 ||
+             mat6(0,0) != 4 || mat6(3,3) != 4 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Operation with stateful allocator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat2 << "\n" << mat5 << "\n" << mat6 << "\n"
+                << "   Expected result:\n8x10 matrix of 2s\n10x8 matrix of 4s\n4x4 matrix of 4s\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkArena( arena1, 0UL );
+      checkArena( arena2, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c isDefault() function with the DynamicMatrix class template.
 //
@@ -40,6 +40,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <utility>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/CustomVector.h>
 #include <blaze/math/shims/Equal.h>
@@ -117,6 +118,8 @@ ClassTest::ClassTest()
    testReserve();
    testShrinkToFit();
    testSwap();
+   testNUMA();
+   testAllocator();
    testIsDefault();
 }
 //*************************************************************************************************
@@ -178,6 +181,20 @@ void ClassTest::testConstructors()
    }
 
 
+   //=====================================================================================
+   // Uninitialized constructor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector uninitialized constructor (size 10)";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec( 10UL, blaze::uninitialized );
+
+      checkSize    ( vec, 10UL );
+      checkCapacity( vec, 10UL );
+   }
+
+
    //=====================================================================================
    // Homogeneous initialization
    //=====================================================================================
@@ -212,6 +229,40 @@ void ClassTest::testConstructors()
    }
 
 
+   //=====================================================================================
+   // First-touch initialization
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector first-touch initialization constructor (size 0)";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec( 0UL, 2, blaze::firstTouch );
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "DynamicVector first-touch initialization constructor (size 100001)";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec( 100001UL, 2, blaze::firstTouch );
+
+      checkSize    ( vec, 100001UL );
+      checkCapacity( vec, 100001UL );
+      checkNonZeros( vec, 100001UL );
+
+      if( vec[0UL] != 2 || vec[50000UL] != 2 || vec[100000UL] != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result: ( " << vec[0UL] << " ... " << vec[50000UL] << " ... " << vec[100000UL] << " )\n"
+             << "   Expected result: ( 2 ... 2 ... 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
    //=====================================================================================
    // List initialization
    //=====================================================================================
@@ -2636,6 +2687,28 @@ void ClassTest::testResize()
       throw std::runtime_error( oss.str() );
    }
 
+   // Resizing to the current size
+   {
+      const int* const data( vec.data() );
+      const size_t capacity( vec.capacity() );
+
+      vec.resize( 2UL, false );
+
+      checkSize    ( vec, 2UL );
+      checkCapacity( vec, capacity );
+      checkNonZeros( vec, 2UL );
+
+      if( vec.data() != data || vec[0] != 1 || vec[1] != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the vector to its current size failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
    // Resizing to 1
    vec.resize( 1UL );
 
@@ -2647,6 +2720,39 @@ void ClassTest::testResize()
 
    checkSize    ( vec, 0UL );
    checkNonZeros( vec, 0UL );
+
+   // Resizing to 4 without initialization
+   vec.resize( 4UL, false, blaze::uninitialized );
+
+   checkSize    ( vec, 4UL );
+   checkCapacity( vec, 4UL );
+
+   // Resizing to 6 without initialization and preserving the elements
+   vec[0] = 1;
+   vec[1] = 2;
+   vec[2] = 3;
+   vec[3] = 4;
+   vec.resize( 6UL, true, blaze::uninitialized );
+
+   checkSize    ( vec, 6UL );
+   checkCapacity( vec, 6UL );
+
+   if( vec[0] != 1 || vec[1] != 2 || vec[2] != 3 || vec[3] != 4 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the vector failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n( 1 2 3 4 x x )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Resizing to 2 without initialization
+   vec.resize( 2UL, true, blaze::uninitialized );
+
+   checkSize    ( vec, 2UL );
+   checkCapacity( vec, 2UL );
+   checkNonZeros( vec, 2UL );
 }
 //*************************************************************************************************
 
@@ -2868,6 +2974,133 @@ void ClassTest::testSwap()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the NUMA placement functionality of the DynamicVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c interleave() and \c bindToNode() functions with the
+// DynamicVector class template. Since NUMA placement depends on the operating system, only the
+// preservation of the vector elements is checked. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNUMA()
+{
+   test_ = "DynamicVector NUMA placement";
+
+   blaze::DynamicVector<int,blaze::rowVector> vec( 100000UL, 2 );
+   vec[0UL] = 1;
+   vec[99999UL] = 3;
+
+   interleave( vec );
+
+   checkSize    ( vec, 100000UL );
+   checkCapacity( vec, 100000UL );
+   checkNonZeros( vec, 100000UL );
+
+   if( vec[0UL] != 1 || vec[1UL] != 2 || vec[99998UL] != 2 || vec[99999UL] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Interleaving the vector failed\n"
+          << " Details:\n"
+          << "   Result: ( " << vec[0UL] << " " << vec[1UL] << " ... " << vec[99998UL] << " " << vec[99999UL] << " )\n"
+          << "   Expected result: ( 1 2 ... 2 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   bindToNode( vec, 0UL );
+
+   checkSize    ( vec, 100000UL );
+   checkCapacity( vec, 100000UL );
+   checkNonZeros( vec, 100000UL );
+
+   if( vec[0UL] != 1 || vec[1UL] != 2 || vec[99998UL] != 2 || vec[99999UL] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Binding the vector to a NUMA node failed\n"
+          << " Details:\n"
+          << "   Result: ( " << vec[0UL] << " " << vec[1UL] << " ... " << vec[99998UL] << " " << vec[99999UL] << " )\n"
+          << "   Expected result: ( 1 2 ... 2 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the allocator support of the DynamicVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the DynamicVector class template in combination with a
+// custom allocator. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocator()
+{
+   test_ = "DynamicVector allocator";
+
+   using AllocatorType = CountingAllocator<int>;
+   using VectorType    = blaze::DynamicVector<int,blaze::rowVector,AllocatorType>;
+
+   using RebindType = VectorType::Rebind<double>::Other;
+   using AddType    = blaze::AddTrait_t<VectorType,VectorType>;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( VectorType::AllocatorType, AllocatorType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RebindType::AllocatorType, CountingAllocator<double> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( AddType, VectorType );
+
+   {
+      VectorType vec1{ 1, 2, 3 };
+      VectorType vec2( vec1 );
+
+      vec2.resize( 100UL, true );
+      vec2.shrinkToFit();
+
+      VectorType vec3( vec1 + vec1 );
+
+      swap( vec1, vec3 );
+      vec2 = std::move( vec3 );
+
+      checkSize    ( vec1, 3UL );
+      checkCapacity( vec1, 3UL );
+      checkSize    ( vec2, 3UL );
+      checkCapacity( vec2, 3UL );
+
+      if( vec1[0] != 2 || vec1[1] != 4 || vec1[2] != 6 || vec2[0] != 1 || vec2[1] != 2 || vec2[2] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation with custom allocator failed\n"
+             << " Details:\n"
+             << "   Result:\n( " << vec1[0] << " " << vec1[1] << " " << vec1[2] << " )\n" << vec2 << "\n"
+             << "   Expected result:\n( 2 4 6 )\n( 1 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( AllocatorType::allocated() < 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory has not been acquired via the custom allocator\n"
+             << " Details:\n"
+             << "   Allocated elements: " << AllocatorType::allocated() << "\n"
+             << "   Expected minimum  : 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( AllocatorType::allocated() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Memory has not been returned to the custom allocator\n"
+          << " Details:\n"
+          << "   Allocated elements: " << AllocatorType::allocated() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c isDefault() function with the DynamicVector class template.
 //
@@ -0,0 +1,448 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mappedmatrix/ClassTest.cpp
+//  \brief Source file for the MappedMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/mappedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()
+   , file_( "MappedMatrixClassTest.blaze" )
+{
+   testConstructors();
+   testAssignment();
+   testReset();
+   testMultiplication();
+   testAccessPattern();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the MappedMatrix class test.
+//
+// The destructor removes the temporary file used by the tests.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MappedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the MappedMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // File constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major MappedMatrix file constructors";
+      testFileRoundTrip<blaze::rowMajor>();
+   }
+
+   {
+      test_ = "Column-major MappedMatrix file constructors";
+      testFileRoundTrip<blaze::columnMajor>();
+   }
+
+   {
+      test_ = "MappedMatrix spacing";
+
+      const MT mat( file_, 5UL, 3UL );
+
+      if( mat.spacing() * sizeof( double ) % 64UL != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid spacing detected\n"
+             << " Details:\n"
+             << "   Spacing: " << mat.spacing() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Invalid files
+   //=====================================================================================
+
+   {
+      test_ = "MappedMatrix missing file";
+
+      try {
+         const CMT mat( file_ + ".missing" );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of a missing file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+
+   {
+      test_ = "MappedMatrix storage order mismatch";
+
+      { MT mat( file_, 4UL, 3UL ); }
+
+      try {
+         const OMT mat( file_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of a row-major file as column-major matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+
+   {
+      test_ = "MappedMatrix element type mismatch";
+
+      { MT mat( file_, 4UL, 3UL ); }
+
+      try {
+         const blaze::MappedMatrix<const float,blaze::rowMajor> mat( file_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of a double precision file as single precision matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "MappedMatrix move constructor";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( 7UL, 5UL );
+      blaze::randomize( ref );
+
+      MT mat1( file_, 7UL, 5UL );
+      mat1 = ref;
+
+      MT mat2( std::move( mat1 ) );
+      mat2(2,3) = 1.0;
+      ref(2,3) = 1.0;
+
+      checkElements( mat2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MappedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the MappedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "MappedMatrix copy assignment";
+
+      const std::string file2( file_ + ".copy" );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( 6UL, 9UL );
+      blaze::randomize( ref );
+
+      {
+         MT mat1( file_, 6UL, 9UL );
+         MT mat2( file2, 6UL, 9UL );
+
+         mat1 = ref;
+         mat2 = mat1;
+      }
+
+      const CMT mat( file2 );
+      std::remove( file2.c_str() );
+
+      checkElements( mat, ref );
+   }
+
+   {
+      test_ = "MappedMatrix expression assignment";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> ref( 6UL, 9UL );
+      blaze::randomize( ref );
+
+      {
+         OMT mat( file_, 6UL, 9UL );
+         mat = 2.0 * ref;
+         mat += ref;
+      }
+
+      const blaze::MappedMatrix<const double,blaze::columnMajor> mat( file_ );
+
+      checkElements( mat, 3.0 * ref );
+   }
+
+   {
+      test_ = "MappedMatrix assignment of different size";
+
+      MT mat( file_, 6UL, 9UL );
+
+      try {
+         mat = blaze::DynamicMatrix<double,blaze::rowMajor>( 9UL, 6UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a matrix with different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MappedMatrix reset functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reset functions of the MappedMatrix class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   {
+      test_ = "MappedMatrix::reset( size_t )";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( 5UL, 7UL );
+      blaze::randomize( ref, 1.0, 2.0 );
+
+      MT mat( file_, 5UL, 7UL );
+      mat = ref;
+
+      reset( mat, 2UL );
+      blaze::reset( row( ref, 2UL ) );
+
+      checkElements( mat, ref );
+
+      reset( mat );
+
+      if( !isZero( mat ) || isDefault( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication with read-only mapped matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the matrix/vector and the matrix/matrix multiplication with read-only
+// mapped matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "MappedMatrix multiplication";
+
+   for( size_t m=1UL; m<=40UL; m+=13UL ) {
+      for( size_t n=1UL; n<=40UL; n+=7UL )
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> A( m, n );
+         blaze::randomize( A );
+
+         blaze::DynamicVector<double,blaze::columnVector> x( n );
+         blaze::randomize( x );
+
+         { MT mat( file_, m, n ); mat = A; }
+
+         const CMT mat( file_ );
+
+         const blaze::DynamicVector<double,blaze::columnVector> y( mat * x );
+         const blaze::DynamicMatrix<double,blaze::rowMajor> B( trans( mat ) * mat );
+
+         if( y != A * x || B != trans( A ) * A ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix:\n" << A << "\n"
+                << "   Vector:\n" << x << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the access pattern functions of the MappedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the advise(), prefetch() and sync() functions of the MappedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAccessPattern()
+{
+   test_ = "MappedMatrix access patterns";
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> ref( 300UL, 200UL );
+   blaze::randomize( ref );
+
+   {
+      OMT mat( file_, 300UL, 200UL, blaze::randomAccess );
+      mat = ref;
+      mat.sync();
+   }
+
+   const blaze::MappedMatrix<const double,blaze::columnMajor> mat( file_, blaze::normalAccess );
+
+   mat.advise( blaze::sequentialAccess );
+   mat.prefetch( 0UL, 50UL );
+   mat.prefetch( 150UL, 50UL );
+   mat.advise( blaze::randomAccess );
+   mat.sync();
+
+   checkElements( mat, ref );
+}
+//*************************************************************************************************
+
+} // namespace mappedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,420 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mappedvector/ClassTest.cpp
+//  \brief Source file for the MappedVector class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/mappedvector/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()
+   , file_( "MappedVectorClassTest.blaze" )
+{
+   testConstructors();
+   testAssignment();
+   testReset();
+   testAccessPattern();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the MappedVector class test.
+//
+// The destructor removes the temporary file used by the tests.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MappedVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the MappedVector class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // File constructors
+   //=====================================================================================
+
+   {
+      test_ = "MappedVector file constructors";
+
+      for( size_t n=0UL; n<=70UL; ++n )
+      {
+         blaze::DynamicVector<int,blaze::columnVector> ref( n );
+         blaze::randomize( ref );
+
+         {
+            VT vec( file_, n );
+
+            checkSize( vec, n );
+
+            if( !isIntact( vec ) || !isZero( vec ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid initialization of new file\n"
+                   << " Details:\n"
+                   << "   Result:\n" << vec << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            vec = ref;
+         }
+
+         {
+            const VT vec( file_ );
+            checkElements( vec, ref );
+         }
+
+         {
+            const CVT vec( file_, blaze::sequentialAccess );
+            checkElements( vec, ref );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Invalid files
+   //=====================================================================================
+
+   {
+      test_ = "MappedVector missing file";
+
+      try {
+         const CVT vec( file_ + ".missing" );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of a missing file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+
+   {
+      test_ = "MappedVector element type mismatch";
+
+      { VT vec( file_, 5UL ); }
+
+      try {
+         const blaze::MappedVector<const double,blaze::columnVector> vec( file_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of an integer file as double precision vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+
+   {
+      test_ = "MappedVector matrix file";
+
+      { blaze::MappedMatrix<int,blaze::rowMajor> mat( file_, 5UL, 1UL ); }
+
+      try {
+         const CVT vec( file_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of a matrix file as vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "MappedVector move constructor";
+
+      blaze::DynamicVector<int,blaze::rowVector> ref( 9UL );
+      blaze::randomize( ref );
+
+      TVT vec1( file_, 9UL );
+      vec1 = ref;
+
+      TVT vec2( std::move( vec1 ) );
+      vec2[4] = 42;
+      ref[4] = 42;
+
+      checkElements( vec2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MappedVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the MappedVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "MappedVector copy assignment";
+
+      const std::string file2( file_ + ".copy" );
+
+      blaze::DynamicVector<int,blaze::columnVector> ref( 17UL );
+      blaze::randomize( ref );
+
+      {
+         VT vec1( file_, 17UL );
+         VT vec2( file2, 17UL );
+
+         vec1 = ref;
+         vec2 = vec1;
+      }
+
+      const CVT vec( file2 );
+      std::remove( file2.c_str() );
+
+      checkElements( vec, ref );
+   }
+
+   {
+      test_ = "MappedVector expression assignment";
+
+      blaze::DynamicVector<int,blaze::columnVector> ref( 17UL );
+      blaze::randomize( ref, -10, 10 );
+
+      {
+         VT vec( file_, 17UL );
+         vec = 2 * ref;
+         vec += ref;
+      }
+
+      const CVT vec( file_ );
+
+      checkElements( vec, 3 * ref );
+   }
+
+   {
+      test_ = "MappedVector assignment of different size";
+
+      VT vec( file_, 17UL );
+
+      try {
+         vec = blaze::DynamicVector<int,blaze::columnVector>( 16UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a vector with different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MappedVector reset functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reset functions of the MappedVector class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "MappedVector::reset()";
+
+   {
+      VT vec( file_, 11UL );
+      vec = blaze::DynamicVector<int,blaze::columnVector>( 11UL, 2 );
+      reset( vec );
+   }
+
+   const CVT vec( file_ );
+
+   checkSize( vec, 11UL );
+
+   if( !isZero( vec ) || isDefault( vec ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the access pattern functions of the MappedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the advise(), prefetch() and sync() functions of the MappedVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAccessPattern()
+{
+   test_ = "MappedVector access patterns";
+
+   blaze::DynamicVector<int,blaze::columnVector> ref( 10000UL );
+   blaze::randomize( ref );
+
+   {
+      VT vec( file_, 10000UL, blaze::sequentialAccess );
+      vec = ref;
+      vec.sync();
+   }
+
+   const CVT vec( file_, blaze::randomAccess );
+
+   vec.prefetch( 0UL, 1000UL );
+   vec.prefetch( 5000UL, 5000UL );
+   vec.advise( blaze::normalAccess );
+   vec.sync();
+
+   checkElements( vec, ref );
+
+   if( blaze::sum( vec ) != blaze::sum( ref ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reduction failed\n"
+          << " Details:\n"
+          << "   Result         : " << blaze::sum( vec ) << "\n"
+          << "   Expected result: " << blaze::sum( ref ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace mappedvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedVector class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
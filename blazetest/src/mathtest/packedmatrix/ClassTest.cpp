@@ -0,0 +1,881 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/ClassTest.cpp
+//  \brief Source file for the PackedMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/packedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testNonZeros();
+   testResize();
+   testTranspose();
+   testAdaptors();
+   testMultiplication();
+   testRankUpdate();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the PackedMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructors
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix homogeneous initialization (4x4)";
+
+      MT mat( 4UL, 4UL, 2 );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 16UL );
+      checkNonZeros( mat, 2UL, 4UL );
+
+      if( !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the packed matrix are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PackedMatrix non-square size constructor";
+
+      try {
+         MT mat( 3UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of non-square packed matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // List initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix initializer list constructor";
+
+      const MT mat{ { 1, 9, 9 }, { 2, 3, 9 }, { 4, 5, 6 } };
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 2, 4 }, { 2, 3, 5 }, { 4, 5, 6 } };
+
+      checkElements( mat, ref );
+   }
+
+   {
+      test_ = "Column-major PackedMatrix initializer list constructor";
+
+      const OMT mat{ { 1, 2, 4 }, { 9, 3, 5 }, { 9, 9, 6 } };
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 2, 4 }, { 2, 3, 5 }, { 4, 5, 6 } };
+
+      checkElements( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix dense matrix constructor (lower)";
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> mat1{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+      const blaze::PackedMatrix<int,blaze::packedLower,blaze::rowMajor> mat2( mat1 );
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 0, 0 }, { 4, 5, 0 }, { 7, 8, 9 } };
+
+      checkElements( mat2, ref );
+      checkNonZeros( mat2, 6UL );
+   }
+
+   {
+      test_ = "PackedMatrix dense matrix constructor (upper)";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+      const blaze::PackedMatrix<int,blaze::packedUpper,blaze::columnMajor> mat2( mat1 );
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 2, 3 }, { 0, 5, 6 }, { 0, 0, 9 } };
+
+      checkElements( mat2, ref );
+      checkNonZeros( mat2, 6UL );
+   }
+
+   {
+      test_ = "PackedMatrix sparse matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 3UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(2,1) = 2;
+      mat1(1,2) = 7;
+
+      const MT mat2( mat1 );
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 0, 0 }, { 0, 0, 2 }, { 0, 2, 0 } };
+
+      checkElements( mat2, ref );
+   }
+
+   {
+      test_ = "PackedMatrix copy constructor";
+
+      const MT mat1{ { 1 }, { 2, 3 } };
+      const MT mat2( mat1 );
+
+      checkElements( mat2, mat1 );
+   }
+
+   {
+      test_ = "PackedMatrix move constructor";
+
+      MT mat1{ { 1 }, { 2, 3 } };
+      const MT mat2( std::move( mat1 ) );
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 2 }, { 2, 3 } };
+
+      checkElements( mat2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "PackedMatrix homogeneous assignment";
+
+      MT mat( 3UL, 3UL );
+      mat = 2;
+
+      checkNonZeros( mat, 9UL );
+      checkElements( mat, blaze::DynamicMatrix<int>( 3UL, 3UL, 2 ) );
+   }
+
+   {
+      test_ = "PackedMatrix dense matrix assignment";
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> mat1{ { 1, 2, 3 }, { 2, 4, 5 }, { 3, 5, 6 } };
+
+      MT mat2;
+      mat2 = mat1;
+
+      checkElements( mat2, mat1 );
+   }
+
+   {
+      test_ = "PackedMatrix addition assignment";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 1, 2 }, { 2, 3 } };
+
+      OMT mat2{ { 1, 1 }, { 1, 1 } };
+      mat2 += mat1;
+
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 2, 3 }, { 3, 4 } } );
+   }
+
+   {
+      test_ = "PackedMatrix subtraction assignment";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 1, 2 }, { 2, 3 } };
+
+      MT mat2{ { 1, 1 }, { 1, 1 } };
+      mat2 -= mat1;
+
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 0, -1 }, { -1, -2 } } );
+   }
+
+   {
+      test_ = "PackedMatrix Schur product assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 2UL, 2UL );
+      mat1(0,1) = 3;
+      mat1(1,0) = 3;
+
+      MT mat2{ { 1, 2 }, { 2, 3 } };
+      mat2 %= mat1;
+
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 0, 6 }, { 6, 0 } } );
+   }
+
+   {
+      test_ = "PackedMatrix non-square assignment";
+
+      try {
+         MT mat;
+         mat = blaze::DynamicMatrix<int>( 2UL, 3UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the PackedMatrix class
+// template, including the access to the elements of the unstored triangle. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Hermitian PackedMatrix function call operator";
+
+      using cplx = std::complex<int>;
+
+      blaze::PackedMatrix<cplx,blaze::packedHermitian,blaze::columnMajor> mat( 3UL, 3UL );
+      mat(0,2) = cplx( 1, 2 );
+      mat(1,1) = cplx( 3, 0 );
+      mat(2,0) = cplx( 7, 7 );  // Unstored element: No effect
+
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> ref{ { cplx( 0, 0 ), cplx( 0, 0 ), cplx( 1,  2 ) },
+                                                            { cplx( 0, 0 ), cplx( 3, 0 ), cplx( 0,  0 ) },
+                                                            { cplx( 1,-2 ), cplx( 0, 0 ), cplx( 0,  0 ) } };
+
+      checkElements( mat, ref );
+   }
+
+   {
+      test_ = "Upper PackedMatrix function call operator";
+
+      blaze::PackedMatrix<int,blaze::packedUpper,blaze::rowMajor> mat( 3UL, 3UL );
+      mat(0,1) = 2;
+      mat(2,2) = 3;
+      mat(2,0) = 4;  // Unstored element: No effect
+
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 0, 2, 0 }, { 0, 0, 0 }, { 0, 0, 3 } } );
+
+      if( mat.at(1,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Checked access failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at(3,0) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+   {
+      test_ = "PackedMatrix iterator";
+
+      const MT mat{ { 1 }, { 2, 3 }, { 4, 5, 6 } };
+
+      int sum( 0 );
+      for( auto it=mat.cbegin(0UL); it!=mat.cend(0UL); ++it ) {
+         sum += *it;
+      }
+
+      if( sum != 7 || mat.end(2UL) - mat.begin(2UL) != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iteration over the first row failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   {
+      test_ = "Symmetric PackedMatrix::nonZeros()";
+
+      const OMT mat{ { 1, 0, 2 }, { 0, 0, 0 }, { 2, 0, 0 } };
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+
+   {
+      test_ = "Lower PackedMatrix::nonZeros()";
+
+      const blaze::PackedMatrix<int,blaze::packedLower,blaze::columnMajor> mat{ { 1 }, { 2, 3 }, { 0, 4, 5 } };
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the PackedMatrix class
+// template for both the leading and the trailing packed storage layout. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Symmetric PackedMatrix::resize()";
+
+      MT mat{ { 1 }, { 2, 3 } };
+
+      mat.resize( 3UL, 3UL );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2, 0 }, { 2, 3, 0 }, { 0, 0, 0 } } );
+
+      mat.resize( 1UL, 1UL );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1 } } );
+
+      mat.resize( 2UL, 2UL, false );
+      checkElements( mat, blaze::DynamicMatrix<int>( 2UL, 2UL, 0 ) );
+   }
+
+   {
+      test_ = "Upper PackedMatrix::resize()";
+
+      blaze::PackedMatrix<int,blaze::packedUpper,blaze::rowMajor> mat{ { 1, 2 }, { 0, 3 } };
+
+      mat.resize( 3UL, 3UL );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2, 0 }, { 0, 3, 0 }, { 0, 0, 0 } } );
+
+      mat.resize( 2UL, 2UL );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2 }, { 0, 3 } } );
+
+      mat.shrinkToFit();
+
+      if( mat.capacity() != 3UL || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Shrinking the packed matrix failed\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat.capacity() << "\n"
+             << "   Expected capacity: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PackedMatrix non-square resize";
+
+      try {
+         MT mat;
+         mat.resize( 2UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-square resize succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c transpose() and \c ctranspose() member functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c transpose() and \c ctranspose() member functions of
+// the PackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   {
+      test_ = "Hermitian PackedMatrix::transpose()";
+
+      using cplx = std::complex<int>;
+
+      blaze::PackedMatrix<cplx,blaze::packedHermitian,blaze::rowMajor> mat( 2UL, 2UL );
+      mat(1,0) = cplx( 1, 2 );
+
+      mat.transpose();
+
+      if( mat(1,0) != cplx( 1, -2 ) || mat(0,1) != cplx( 1, 2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.ctranspose();
+
+      if( mat(1,0) != cplx( 1, -2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conjugate transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Lower PackedMatrix::transpose()";
+
+      try {
+         blaze::PackedMatrix<int,blaze::packedLower,blaze::rowMajor> mat( 2UL, 2UL );
+         mat.transpose();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: In-place transpose of triangular packed matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::logic_error& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix class template as underlying matrix of the adaptors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the PackedMatrix class template as underlying matrix of
+// the SymmetricMatrix, HermitianMatrix, LowerMatrix, and UpperMatrix adaptors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAdaptors()
+{
+   {
+      test_ = "SymmetricMatrix<PackedMatrix>";
+
+      blaze::SymmetricMatrix<OMT> sym( 3UL );
+      sym(0,1) = 2;
+      sym(2,0) = 3;
+      sym(1,1) += 4;
+
+      checkElements( sym, blaze::DynamicMatrix<int>{ { 0, 2, 3 }, { 2, 4, 0 }, { 3, 0, 0 } } );
+
+      sym.resize( 4UL );
+      checkElements( sym, blaze::DynamicMatrix<int>{ { 0, 2, 3, 0 }, { 2, 4, 0, 0 },
+                                                     { 3, 0, 0, 0 }, { 0, 0, 0, 0 } } );
+   }
+
+   {
+      test_ = "HermitianMatrix<PackedMatrix>";
+
+      using cplx = std::complex<int>;
+
+      blaze::HermitianMatrix< blaze::PackedMatrix<cplx,blaze::packedHermitian,blaze::rowMajor> > herm( 2UL );
+      herm(0,1) = cplx( 1, 2 );
+
+      if( herm(1,0) != cplx( 1, -2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Hermitian update failed\n"
+             << " Details:\n"
+             << "   Result:\n" << herm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         herm(1,1) = cplx( 1, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-real diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "LowerMatrix<PackedMatrix>";
+
+      blaze::LowerMatrix< blaze::PackedMatrix<int,blaze::packedLower,blaze::columnMajor> > lower( 3UL );
+      lower(1,0) = 2;
+      lower(2,2) = 3;
+
+      checkElements( lower, blaze::DynamicMatrix<int>{ { 0, 0, 0 }, { 2, 0, 0 }, { 0, 0, 3 } } );
+
+      try {
+         lower(0,1) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to upper element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "UpperMatrix<PackedMatrix>";
+
+      blaze::UpperMatrix< blaze::PackedMatrix<int,blaze::packedUpper,blaze::rowMajor> > upper( 2UL );
+      upper = blaze::DynamicMatrix<int>{ { 1, 2 }, { 0, 3 } };
+
+      checkElements( upper, blaze::DynamicMatrix<int>{ { 1, 2 }, { 0, 3 } } );
+   }
+
+   {
+      test_ = "DiagonalMatrix<PackedMatrix>";
+
+      blaze::DiagonalMatrix< blaze::PackedMatrix<int,blaze::packedDiagonal,blaze::rowMajor> > diag( 3UL );
+      diag(0,0) = 1;
+      diag(2,2) = 3;
+
+      checkElements( diag, blaze::DynamicMatrix<int>{ { 1, 0, 0 }, { 0, 0, 0 }, { 0, 0, 3 } } );
+
+      if( derestrict( diag ).capacity() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Capacity         : " << derestrict( diag ).capacity() << "\n"
+             << "   Expected capacity: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         diag(1,2) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to off-diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      diag.resize( 4UL );
+      checkElements( diag, blaze::DynamicMatrix<int>{ { 1, 0, 0, 0 }, { 0, 0, 0, 0 },
+                                                      { 0, 0, 3, 0 }, { 0, 0, 0, 0 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of packed matrices of all structures and
+// both storage orders with a dense vector. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "PackedMatrix/DynamicVector multiplication";
+
+   testMultiplication<blaze::packedSymmetric,blaze::rowMajor   >();
+   testMultiplication<blaze::packedSymmetric,blaze::columnMajor>();
+   testMultiplication<blaze::packedHermitian,blaze::rowMajor   >();
+   testMultiplication<blaze::packedHermitian,blaze::columnMajor>();
+   testMultiplication<blaze::packedLower    ,blaze::rowMajor   >();
+   testMultiplication<blaze::packedLower    ,blaze::columnMajor>();
+   testMultiplication<blaze::packedUpper    ,blaze::rowMajor   >();
+   testMultiplication<blaze::packedUpper    ,blaze::columnMajor>();
+   testMultiplication<blaze::packedDiagonal ,blaze::rowMajor   >();
+   testMultiplication<blaze::packedDiagonal ,blaze::columnMajor>();
+
+   {
+      test_ = "SymmetricMatrix<PackedMatrix>/DynamicVector multiplication";
+
+      blaze::SymmetricMatrix<MT> sym( 3UL );
+      sym(0,1) = 2;
+      sym(2,2) = 3;
+
+      const blaze::DynamicVector<int> vec{ 1, 2, 3 };
+      const blaze::DynamicVector<int> res( sym * vec );
+
+      if( res[0] != 4 || res[1] != 2 || res[2] != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n( 4 2 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DiagonalMatrix<PackedMatrix>/DynamicMatrix multiplication";
+
+      blaze::DiagonalMatrix< blaze::PackedMatrix<int,blaze::packedDiagonal,blaze::columnMajor> > diag( 3UL );
+      diag(0,0) = 2;
+      diag(1,1) = 3;
+      diag(2,2) = -1;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+
+      checkElements( diag * mat, blaze::DynamicMatrix<int>{ { 2, 4 }, { 9, 12 }, { -5, -6 } } );
+      checkElements( trans( mat ) * diag, blaze::DynamicMatrix<int>{ { 2, 9, -5 }, { 4, 12, -6 } } );
+   }
+
+   {
+      test_ = "Large PackedMatrix<packedDiagonal>/DynamicMatrix multiplication";
+
+      blaze::PackedMatrix<int,blaze::packedDiagonal,blaze::rowMajor> diag( 500UL, 500UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( 500UL, 500UL, 0 );
+      for( size_t i=0UL; i<500UL; ++i ) {
+         diag(i,i) = ref(i,i) = blaze::rand<int>( -5, 5 );
+      }
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 500UL, 200UL );
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            mat(i,j) = blaze::rand<int>( -5, 5 );
+         }
+      }
+
+      const blaze::DynamicVector<int> vec( column( mat, 0UL ) );
+
+      checkElements( diag * mat, blaze::DynamicMatrix<int>( ref * mat ) );
+      checkElements( trans( mat ) * diag, blaze::DynamicMatrix<int>( trans( mat ) * ref ) );
+
+      const blaze::DynamicVector<int> res( diag * vec );
+
+      if( res != ref * vec ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rank-k update of packed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c rankUpdate() function for symmetric and Hermitian
+// packed matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRankUpdate()
+{
+   {
+      test_ = "Symmetric PackedMatrix rank-k update";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> B( 150UL, 3UL );
+      for( size_t i=0UL; i<B.rows(); ++i ) {
+         for( size_t j=0UL; j<B.columns(); ++j ) {
+            B(i,j) = blaze::rand<int>( -5, 5 );
+         }
+      }
+
+      blaze::SymmetricMatrix<OMT> sym( 150UL );
+      sym(3,140) = 1;
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( sym );
+      ref += 2 * B * trans( B );
+
+      rankUpdate( sym, B, 2 );
+
+      checkElements( sym, ref );
+   }
+
+   {
+      test_ = "Hermitian PackedMatrix rank-k update";
+
+      using cplx = std::complex<int>;
+
+      blaze::DynamicMatrix<cplx,blaze::columnMajor> B{ { cplx( 1, 2 ), cplx( 0, 1 ) },
+                                                       { cplx( 3, 0 ), cplx( 2,-1 ) },
+                                                       { cplx( 0,-1 ), cplx( 1, 1 ) } };
+
+      blaze::HermitianMatrix< blaze::PackedMatrix<cplx,blaze::packedHermitian,blaze::columnMajor> > herm( 3UL );
+      rankUpdate( herm, B, 1 );
+
+      checkElements( herm, blaze::DynamicMatrix<cplx>( B * ctrans( B ) ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
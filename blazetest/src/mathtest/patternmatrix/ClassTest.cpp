@@ -0,0 +1,1198 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/patternmatrix/ClassTest.cpp
+//  \brief Source file for the PatternMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/patternmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace patternmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PatternMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testReserve();
+   testSet();
+   testInsert();
+   testAppend();
+   testErase();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testSwap();
+   testMultiplication();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PatternMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the PatternMatrix class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PatternMatrix default constructor";
+
+      blaze::PatternMatrix<blaze::rowMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PatternMatrix size constructor (3x4)";
+
+      blaze::PatternMatrix<blaze::rowMajor> mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+   {
+      test_ = "Row-major PatternMatrix size constructor (3x4, 7)";
+
+      blaze::PatternMatrix<blaze::rowMajor> mat( 3UL, 4UL, 7UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+
+      if( mat.capacity() < 7UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Capacity                 : " << mat.capacity() << "\n"
+             << "   Expected minimum capacity: 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PatternMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 1, 0, 2 }, { 0, 0, 3 } };
+      blaze::PatternMatrix<blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 2UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+
+      if( mat2(0,0) != true || mat2(0,1) != false || mat2(0,2) != true ||
+          mat2(1,0) != false || mat2(1,1) != false || mat2(1,2) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 1 )\n( 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PatternMatrix sparse matrix constructor (same storage order)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,3) = 1;
+      mat1(2,0) = 2;
+      mat1(2,1) = 3;
+
+      blaze::PatternMatrix<blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,3) != true || mat2(2,0) != true || mat2(2,1) != true || !isIntact( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PatternMatrix sparse matrix constructor (opposite storage order)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 3UL, 4UL );
+      mat1(0,3) = 1;
+      mat1(2,0) = 2;
+      mat1(2,1) = 3;
+
+      blaze::PatternMatrix<blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,3) != true || mat2(2,0) != true || mat2(2,1) != true || !isIntact( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PatternMatrix copy constructor";
+
+      blaze::PatternMatrix<blaze::columnMajor> mat1( 3UL, 4UL );
+      mat1.insert( 1UL, 0UL );
+      mat1.insert( 2UL, 3UL );
+
+      blaze::PatternMatrix<blaze::columnMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 2UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 3UL, 1UL );
+
+      if( mat2(1,0) != true || mat2(2,3) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PatternMatrix move constructor";
+
+      blaze::PatternMatrix<blaze::columnMajor> mat1( 3UL, 4UL );
+      mat1.insert( 1UL, 0UL );
+
+      blaze::PatternMatrix<blaze::columnMajor> mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 1UL );
+   }
+
+   {
+      test_ = "Column-major PatternMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 1, 0, 2 }, { 0, 0, 3 } };
+      blaze::PatternMatrix<blaze::columnMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+   }
+
+   {
+      test_ = "Column-major PatternMatrix pattern matrix constructor (opposite storage order)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 1, 0, 2 }, { 0, 0, 3 } };
+      blaze::PatternMatrix<blaze::rowMajor> mat2( mat1 );
+      blaze::PatternMatrix<blaze::columnMajor> mat3( mat2 );
+
+      checkRows    ( mat3, 2UL );
+      checkColumns ( mat3, 3UL );
+      checkNonZeros( mat3, 3UL );
+      checkNonZeros( mat3, 2UL, 2UL );
+
+      if( mat3(0,0) != true || mat3(0,2) != true || mat3(1,2) != true || !isIntact( mat3 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat3 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PatternMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "Row-major PatternMatrix copy assignment";
+
+      blaze::PatternMatrix<blaze::rowMajor> mat1( 3UL, 3UL );
+      mat1.insert( 2UL, 2UL );
+
+      blaze::PatternMatrix<blaze::rowMajor> mat2( 5UL, 5UL );
+      mat2.insert( 0UL, 0UL );
+      mat2.insert( 4UL, 4UL );
+
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 1UL );
+
+      if( mat2(2,2) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PatternMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat1( 2UL, 3UL );
+      mat1(0,1) = 1.0;
+      mat1(1,2) = 2.0;
+
+      blaze::PatternMatrix<blaze::rowMajor> mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2(0,1) != true || mat2(1,2) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PatternMatrix to dense matrix conversion";
+
+      blaze::PatternMatrix<blaze::rowMajor> mat1( 2UL, 2UL );
+      mat1.insert( 0UL, 1UL );
+      mat1.insert( 1UL, 0UL );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      if( mat2(0,0) != 0 || mat2(0,1) != 1 || mat2(1,0) != 1 || mat2(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 )\n( 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PatternMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// PatternMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "Row-major PatternMatrix::operator()";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat( 3UL, 5UL );
+   mat.insert( 1UL, 4UL );
+   mat.insert( 1UL, 0UL );
+   mat.insert( 1UL, 2UL );
+
+   for( size_t j=0UL; j<5UL; ++j ) {
+      if( mat(0,j) != false || mat(1,j) != ( j % 2UL == 0UL ) || mat(2,j) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 0 )\n( 1 0 1 0 1 )\n( 0 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the \c at() member function of the
+// PatternMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "Row-major PatternMatrix::at()";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat( 2UL, 3UL );
+   mat.insert( 1UL, 2UL );
+
+   if( mat.at(1,2) != true || mat.at(0,0) != false ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat.at(0,3);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PatternMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   using MatrixType    = blaze::PatternMatrix<blaze::rowMajor>;
+   using ConstIterator = MatrixType::ConstIterator;
+
+   MatrixType mat( 3UL, 6UL );
+   mat.insert( 1UL, 5UL );
+   mat.insert( 1UL, 1UL );
+   mat.insert( 1UL, 3UL );
+
+   {
+      test_ = "Row-major ConstIterator default constructor";
+
+      ConstIterator it{};
+
+      if( it != ConstIterator() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator default constructor\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major ConstIterator subtraction (end-begin)";
+
+      const ptrdiff_t number( end( mat, 1UL ) - begin( mat, 1UL ) );
+
+      if( number != 3L || end( mat, 0UL ) - begin( mat, 0UL ) != 0L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major read-only access via ConstIterator";
+
+      size_t expected( 1UL );
+
+      for( ConstIterator it=cbegin( mat, 1UL ); it!=cend( mat, 1UL ); ++it, expected+=2UL ) {
+         if( it->index() != expected || it->value() != true || (*it).index() != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Index         : " << it->index() << "\n"
+                << "   Expected index: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the PatternMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "Column-major PatternMatrix::nonZeros()";
+
+   blaze::PatternMatrix<blaze::columnMajor> mat( 4UL, 3UL );
+   mat.insert( 0UL, 0UL );
+   mat.insert( 3UL, 0UL );
+   mat.insert( 2UL, 2UL );
+
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 0UL );
+   checkNonZeros( mat, 2UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "Row-major PatternMatrix::reset()";
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 1, 0 }, { 0, 1, 1 }, { 1, 0, 1 } };
+   blaze::PatternMatrix<blaze::rowMajor> mat( ref );
+
+   reset( mat, 1UL );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 3UL );
+   checkNonZeros( mat, 4UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 0UL );
+   checkNonZeros( mat, 2UL, 2UL );
+
+   if( mat(2,0) != true || mat(2,2) != true || !isIntact( mat ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   reset( mat );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 3UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "Row-major PatternMatrix::clear()";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat( 3UL, 3UL );
+   mat.insert( 1UL, 1UL );
+
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major PatternMatrix::resize()";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 1, 0 }, { 0, 1, 1 }, { 1, 0, 1 } };
+      blaze::PatternMatrix<blaze::rowMajor> mat( ref );
+
+      mat.resize( 2UL, 2UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      mat.resize( 4UL, 5UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 3UL, 0UL );
+
+      if( !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the pattern matrix are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.resize( 3UL, 3UL, false );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major PatternMatrix::resize()";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 1, 0 }, { 0, 1, 1 }, { 1, 0, 1 } };
+      blaze::PatternMatrix<blaze::columnMajor> mat( ref );
+
+      mat.resize( 2UL, 3UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() member function of the PatternMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   test_ = "Row-major PatternMatrix::reserve()";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat( 3UL, 3UL );
+   mat.insert( 2UL, 1UL );
+
+   mat.reserve( 20UL );
+
+   checkNonZeros( mat, 1UL );
+
+   if( mat.capacity() < 20UL || mat(2,1) != true ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reserving capacity failed\n"
+          << " Details:\n"
+          << "   Capacity                 : " << mat.capacity() << "\n"
+          << "   Expected minimum capacity: 20\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   mat.shrinkToFit();
+
+   if( mat.capacity() != 1UL || mat(2,1) != true ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Shrinking failed\n"
+          << " Details:\n"
+          << "   Capacity         : " << mat.capacity() << "\n"
+          << "   Expected capacity: 1\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c set() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set() member function of the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSet()
+{
+   test_ = "Row-major PatternMatrix::set()";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat( 2UL, 4UL );
+
+   mat.set( 0UL, 2UL );
+   mat.set( 0UL, 2UL );
+   auto pos = mat.set( 0UL, 1UL );
+
+   checkNonZeros( mat, 2UL );
+   checkNonZeros( mat, 0UL, 2UL );
+
+   if( pos->index() != 1UL || pos != mat.begin( 0UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid iterator returned\n"
+          << " Details:\n"
+          << "   Index         : " << pos->index() << "\n"
+          << "   Expected index: 1\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c insert() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c insert() member function of the PatternMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   test_ = "Column-major PatternMatrix::insert()";
+
+   blaze::PatternMatrix<blaze::columnMajor> mat( 5UL, 3UL );
+
+   for( size_t k=0UL; k<15UL; k+=2UL ) {
+      mat.insert( k%5UL, k/5UL );
+   }
+
+   checkNonZeros( mat, 8UL );
+   checkNonZeros( mat, 0UL, 3UL );
+   checkNonZeros( mat, 1UL, 2UL );
+   checkNonZeros( mat, 2UL, 3UL );
+
+   if( !isIntact( mat ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariants of the pattern matrix are violated\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat.insert( 0UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inserting an existing element succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() and \c finalize() member functions of the
+// PatternMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "Row-major PatternMatrix::append()";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat( 4UL, 4UL, 5UL );
+
+   mat.append( 0UL, 1UL );
+   mat.append( 0UL, 3UL );
+   mat.finalize( 0UL );
+   mat.finalize( 1UL );
+   mat.append( 2UL, 0UL );
+   mat.append( 2UL, 1UL, false );
+   mat.append( 2UL, 2UL );
+   mat.finalize( 2UL );
+   mat.append( 3UL, 3UL );
+   mat.finalize( 3UL );
+
+   checkNonZeros( mat, 5UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 0UL );
+   checkNonZeros( mat, 2UL, 2UL );
+   checkNonZeros( mat, 3UL, 1UL );
+
+   if( mat(0,1) != true || mat(0,3) != true || mat(2,0) != true || mat(2,1) != false ||
+       mat(2,2) != true || mat(3,3) != true || !isIntact( mat ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Append operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member function of the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   test_ = "Row-major PatternMatrix::erase()";
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 1, 0 }, { 0, 1, 1 }, { 1, 0, 1 } };
+   blaze::PatternMatrix<blaze::rowMajor> mat( ref );
+
+   mat.erase( 1UL, 2UL );
+   mat.erase( 0UL, 0UL );
+   mat.erase( 0UL, 2UL );
+
+   checkNonZeros( mat, 4UL );
+   checkNonZeros( mat, 0UL, 1UL );
+   checkNonZeros( mat, 1UL, 1UL );
+   checkNonZeros( mat, 2UL, 2UL );
+
+   if( mat(0,1) != true || mat(1,1) != true || mat(1,2) != false || !isIntact( mat ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Erase operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "Column-major PatternMatrix::find()";
+
+   blaze::PatternMatrix<blaze::columnMajor> mat( 6UL, 2UL );
+   mat.insert( 1UL, 1UL );
+   mat.insert( 4UL, 1UL );
+
+   const auto pos1( mat.find( 4UL, 1UL ) );
+   const auto pos2( mat.find( 3UL, 1UL ) );
+
+   if( pos1 == mat.end( 1UL ) || pos1->index() != 4UL || pos2 != mat.end( 1UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Find operation failed\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the PatternMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "Row-major PatternMatrix::lowerBound()";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat( 2UL, 6UL );
+   mat.insert( 1UL, 1UL );
+   mat.insert( 1UL, 4UL );
+
+   const auto pos1( mat.lowerBound( 1UL, 1UL ) );
+   const auto pos2( mat.lowerBound( 1UL, 2UL ) );
+   const auto pos3( mat.lowerBound( 1UL, 5UL ) );
+
+   if( pos1->index() != 1UL || pos2->index() != 4UL || pos3 != mat.end( 1UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Lower bound operation failed\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the PatternMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "Row-major PatternMatrix::upperBound()";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat( 2UL, 6UL );
+   mat.insert( 1UL, 1UL );
+   mat.insert( 1UL, 4UL );
+
+   const auto pos1( mat.upperBound( 1UL, 0UL ) );
+   const auto pos2( mat.upperBound( 1UL, 1UL ) );
+   const auto pos3( mat.upperBound( 1UL, 4UL ) );
+
+   if( pos1->index() != 1UL || pos2->index() != 4UL || pos3 != mat.end( 1UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Upper bound operation failed\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the PatternMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "Row-major PatternMatrix swap";
+
+   blaze::PatternMatrix<blaze::rowMajor> mat1( 2UL, 2UL );
+   mat1.insert( 0UL, 0UL );
+
+   blaze::PatternMatrix<blaze::rowMajor> mat2( 3UL, 4UL );
+   mat2.insert( 2UL, 3UL );
+   mat2.insert( 1UL, 3UL );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkColumns ( mat1, 4UL );
+   checkNonZeros( mat1, 2UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of pattern matrices with dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the matrix/vector multiplications involving pattern
+// matrices. The results are compared to the multiplication with an equivalent compressed
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const size_t M( 17UL );
+   const size_t N( 23UL );
+
+   const blaze::PatternMatrix<blaze::rowMajor>    mat ( blaze::rand< blaze::PatternMatrix<blaze::rowMajor> >( M, N, 60UL ) );
+   const blaze::PatternMatrix<blaze::columnMajor> tmat( mat );
+   const blaze::CompressedMatrix<int,blaze::rowMajor> ref( mat );
+
+   blaze::DynamicVector<int,blaze::columnVector> x( N );
+   blaze::DynamicVector<int,blaze::rowVector>    y( M );
+   randomize( x, -10, 10 );
+   randomize( y, -10, 10 );
+
+   checkNonZeros( mat , 60UL );
+   checkNonZeros( tmat, 60UL );
+   checkNonZeros( ref , 60UL );
+
+   {
+      test_ = "PatternMatrix/dense vector multiplication";
+
+      const blaze::DynamicVector<int,blaze::columnVector> res1( mat  * x );
+      const blaze::DynamicVector<int,blaze::columnVector> res2( tmat * x );
+      const blaze::DynamicVector<int,blaze::columnVector> exp ( ref  * x );
+
+      if( res1 != exp || res2 != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << res1 << "\n"
+             << "   Column-major result:\n" << res2 << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Dense vector/PatternMatrix multiplication";
+
+      const blaze::DynamicVector<int,blaze::rowVector> res1( y * mat  );
+      const blaze::DynamicVector<int,blaze::rowVector> res2( y * tmat );
+      const blaze::DynamicVector<int,blaze::rowVector> exp ( y * ref  );
+
+      if( res1 != exp || res2 != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << res1 << "\n"
+             << "   Column-major result:\n" << res2 << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the PatternMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   {
+      blaze::PatternMatrix<blaze::rowMajor> mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::PatternMatrix<blaze::rowMajor> mat( 2UL, 3UL );
+
+      if( blaze::isDefault( mat(0,1) ) != true || isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace patternmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PatternMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PATTERNMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PatternMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,545 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/reordering/SparseTest.cpp
+//  \brief Source file for the sparse matrix reordering test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/reordering/SparseTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace reordering {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SparseTest test.
+//
+// \exception std::runtime_error Error during sparse matrix reordering detected.
+*/
+SparseTest::SparseTest()
+{
+   testRCM();
+   testNestedDissection();
+   testPermute();
+   testVectorPermute();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reverse Cuthill-McKee ordering.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rcm() function for row-major and column-major sparse matrices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testRCM()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major rcm() (shuffled grid)";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( grid<blaze::rowMajor>( 20UL, 15UL, true ) );
+      blaze::DynamicVector<size_t> p;
+
+      blaze::rcm( A, p );
+
+      checkPermutation( A, p );
+      checkPermuted( A, p );
+
+      const size_t bw( bandwidth( blaze::CompressedMatrix<double,blaze::rowMajor>( blaze::permute( A, p ) ) ) );
+
+      if( bw > 30UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth reduction failed\n"
+             << " Details:\n"
+             << "   Original bandwidth: " << bandwidth( A ) << "\n"
+             << "   Resulting bandwidth: " << bw << "\n"
+             << "   Expected bandwidth: <= 30\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major rcm() (disconnected graph)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 7UL, 7UL );
+      A(0,0) = 1;
+      A(0,5) = 2;
+      A(5,3) = 3;
+      A(2,2) = 4;
+      A(4,6) = 5;
+      A(1,4) = 6;
+
+      blaze::DynamicVector<size_t> p;
+
+      blaze::rcm( A, p );
+
+      checkPermutation( A, p );
+      checkPermuted( A, p );
+   }
+
+   {
+      test_ = "Row-major rcm() (empty matrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      blaze::DynamicVector<size_t> p( 3UL );
+
+      blaze::rcm( A, p );
+
+      checkPermutation( A, p );
+   }
+
+   {
+      test_ = "Row-major rcm() (non-square matrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 4UL );
+      blaze::DynamicVector<size_t> p;
+
+      try {
+         blaze::rcm( A, p );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reordering of a non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << p << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major rcm() (shuffled grid)";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> A( grid<blaze::columnMajor>( 15UL, 20UL, true ) );
+      blaze::DynamicVector<size_t> p;
+
+      blaze::rcm( A, p );
+
+      checkPermutation( A, p );
+      checkPermuted( A, p );
+
+      const size_t bw( bandwidth( blaze::CompressedMatrix<double,blaze::columnMajor>( blaze::permute( A, p ) ) ) );
+
+      if( bw > 30UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth reduction failed\n"
+             << " Details:\n"
+             << "   Original bandwidth: " << bandwidth( A ) << "\n"
+             << "   Resulting bandwidth: " << bw << "\n"
+             << "   Expected bandwidth: <= 30\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major rcm() (unsymmetric pattern)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> A( 6UL, 6UL );
+      A(0,3) = 1;
+      A(3,5) = 2;
+      A(5,1) = 3;
+      A(4,2) = 4;
+      A(1,1) = 5;
+
+      blaze::DynamicVector<size_t> p;
+
+      blaze::rcm( A, p );
+
+      checkPermutation( A, p );
+      checkPermuted( A, p );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nested dissection ordering.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the nestedDissection() function for row-major and column-major sparse
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testNestedDissection()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major nestedDissection() (shuffled grid)";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( grid<blaze::rowMajor>( 40UL, 30UL, true ) );
+      blaze::DynamicVector<size_t> p;
+
+      blaze::nestedDissection( A, p );
+
+      checkPermutation( A, p );
+      checkPermuted( A, p );
+   }
+
+   {
+      test_ = "Row-major nestedDissection() (diagonal matrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 100UL, 100UL );
+      for( size_t i=0UL; i<100UL; ++i ) {
+         A(i,i) = 1;
+      }
+
+      blaze::DynamicVector<size_t> p;
+
+      blaze::nestedDissection( A, p );
+
+      checkPermutation( A, p );
+      checkPermuted( A, p );
+   }
+
+   {
+      test_ = "Row-major nestedDissection() (non-square matrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 4UL, 3UL );
+      blaze::DynamicVector<size_t> p;
+
+      try {
+         blaze::nestedDissection( A, p );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reordering of a non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << p << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major nestedDissection() (two shuffled grids)";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> A1( grid<blaze::columnMajor>( 25UL, 12UL, true ) );
+      const blaze::CompressedMatrix<double,blaze::columnMajor> A2( grid<blaze::columnMajor>( 10UL, 30UL, true ) );
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> A( 600UL, 600UL );
+      submatrix( A,   0UL,   0UL, 300UL, 300UL ) = A1;
+      submatrix( A, 300UL, 300UL, 300UL, 300UL ) = A2;
+
+      blaze::DynamicVector<size_t> p;
+
+      blaze::nestedDissection( A, p );
+
+      checkPermutation( A, p );
+      checkPermuted( A, p );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the symmetric sparse matrix permutation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the permute() function for row-major and column-major sparse matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testPermute()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major permute()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 4UL, 4UL );
+      A(0,0) = 1;
+      A(0,2) = 2;
+      A(1,3) = 3;
+      A(2,1) = 4;
+      A(3,0) = 5;
+      A(3,3) = 6;
+
+      const blaze::DynamicVector<size_t> p{ 2UL, 0UL, 3UL, 1UL };
+
+      checkPermuted( A, p );
+   }
+
+   {
+      test_ = "Row-major permute() (random matrix)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 50UL, 50UL );
+      blaze::randomize( A, 400UL );
+
+      blaze::DynamicVector<size_t> p;
+      blaze::rcm( A, p );
+
+      checkPermuted( A, p );
+   }
+
+   {
+      test_ = "Row-major permute() (invalid permutation)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 3UL );
+      const blaze::DynamicVector<size_t> p{ 0UL, 2UL, 2UL };
+
+      try {
+         const blaze::CompressedMatrix<int,blaze::rowMajor> B( blaze::permute( A, p ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with an invalid permutation vector succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major permute()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> A( 4UL, 4UL );
+      A(0,0) = 1;
+      A(0,2) = 2;
+      A(1,3) = 3;
+      A(2,1) = 4;
+      A(3,0) = 5;
+      A(3,3) = 6;
+
+      const blaze::DynamicVector<size_t> p{ 1UL, 3UL, 0UL, 2UL };
+
+      checkPermuted( A, p );
+   }
+
+   {
+      test_ = "Column-major permute() (invalid permutation size)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> A( 3UL, 3UL );
+      const blaze::DynamicVector<size_t> p{ 0UL, 1UL };
+
+      try {
+         const blaze::CompressedMatrix<int,blaze::columnMajor> B( blaze::permute( A, p ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with an invalid permutation vector succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense vector permutation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the permute() function for dense vectors. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testVectorPermute()
+{
+   {
+      test_ = "Dense vector permute()";
+
+      const blaze::DynamicVector<int> x{ 1, 2, 3, 4, 5 };
+      const blaze::DynamicVector<size_t> p{ 4UL, 0UL, 3UL, 1UL, 2UL };
+
+      const blaze::DynamicVector<int> y( blaze::permute( x, p ) );
+
+      if( y[0] != 5 || y[1] != 1 || y[2] != 4 || y[3] != 2 || y[4] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 5 1 4 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicVector<int> z( 5UL, 0 );
+      blaze::permute( z, p ) = y;
+
+      if( z != x ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inverse permutation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Dense vector permute() (permuted matrix/vector multiplication)";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( grid<blaze::rowMajor>( 12UL, 9UL, true ) );
+      blaze::DynamicVector<double> x( A.columns() );
+      blaze::randomize( x );
+
+      blaze::DynamicVector<size_t> p;
+      blaze::nestedDissection( A, p );
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( blaze::permute( A, p ) );
+      const blaze::DynamicVector<double> xp( blaze::permute( x, p ) );
+
+      blaze::DynamicVector<double> y( A.rows() );
+      blaze::permute( y, p ) = B * xp;
+
+      const blaze::DynamicVector<double> ref( A * x );
+
+      if( y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permuted matrix/vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Dense vector permute() (invalid permutation size)";
+
+      blaze::DynamicVector<int> x( 4UL, 1 );
+      const blaze::DynamicVector<size_t> p{ 0UL, 1UL };
+
+      try {
+         const blaze::DynamicVector<int> y( blaze::permute( x, p ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with an invalid permutation vector succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace reordering
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse matrix reordering test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSE_REORDERING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse matrix reordering test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,701 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smallmatrix/ClassTest.cpp
+//  \brief Source file for the SmallMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SmallVector.h>
+#include <blazetest/mathtest/smallmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smallmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SmallMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()
+{
+   testConstructors();
+   testAssignment();
+   testResize();
+   testShrinkToFit();
+   testSwap();
+   testArithmetic();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SmallMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SmallMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major SmallMatrix default constructor";
+
+      MT mat;
+
+      checkCapacity( mat, 6UL );
+      checkElements( mat, blaze::DynamicMatrix<int>() );
+   }
+
+
+   //=====================================================================================
+   // Row-major size and homogeneous initialization constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major SmallMatrix homogeneous initialization constructor (preallocated)";
+
+      MT mat( 2UL, 3UL, 2 );
+
+      checkElements( mat, blaze::DynamicMatrix<int>( 2UL, 3UL, 2 ) );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix homogeneous initialization constructor (dynamic)";
+
+      MT mat( 10UL, 10UL, 2 );
+
+      checkCapacity( mat, 100UL );
+      checkElements( mat, blaze::DynamicMatrix<int>( 10UL, 10UL, 2 ) );
+   }
+
+
+   //=====================================================================================
+   // Row-major list initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major SmallMatrix initializer list constructor";
+
+      MT mat{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } } );
+   }
+
+
+   //=====================================================================================
+   // Row-major copy and move constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major SmallMatrix copy constructor (preallocated)";
+
+      const MT mat1{ { 1, 2, 3 }, { 4, 5, 6 } };
+      const MT mat2( mat1 );
+
+      checkElements( mat2, mat1 );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix copy constructor (dynamic)";
+
+      const MT mat1( 7UL, 9UL, 5 );
+      const MT mat2( mat1 );
+
+      checkElements( mat2, mat1 );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix move constructor (preallocated)";
+
+      MT mat1{ { 1, 2, 3 }, { 4, 5, 6 } };
+      MT mat2( std::move( mat1 ) );
+
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 1, 2, 3 }, { 4, 5, 6 } } );
+      checkElements( mat1, blaze::DynamicMatrix<int>() );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix move constructor (dynamic)";
+
+      MT mat1( 7UL, 9UL, 5 );
+      const int* const data( mat1.data() );
+      MT mat2( std::move( mat1 ) );
+
+      checkElements( mat2, blaze::DynamicMatrix<int>( 7UL, 9UL, 5 ) );
+      checkElements( mat1, blaze::DynamicMatrix<int>() );
+
+      if( mat2.data() != data ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dynamic memory has not been transferred\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major SmallMatrix default constructor";
+
+      OMT mat;
+
+      checkCapacity( mat, 6UL );
+      checkElements( mat, blaze::DynamicMatrix<int>() );
+   }
+
+   {
+      test_ = "Column-major SmallMatrix initializer list constructor";
+
+      OMT mat{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2, 3 }, { 4, 5, 6 } } );
+   }
+
+   {
+      test_ = "Column-major SmallMatrix copy constructor (dynamic)";
+
+      const OMT mat1( 9UL, 7UL, 5 );
+      const OMT mat2( mat1 );
+
+      checkElements( mat2, mat1 );
+   }
+
+   {
+      test_ = "Column-major SmallMatrix move constructor (preallocated)";
+
+      OMT mat1{ { 1, 2, 3 }, { 4, 5, 6 } };
+      OMT mat2( std::move( mat1 ) );
+
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 1, 2, 3 }, { 4, 5, 6 } } );
+      checkElements( mat1, blaze::DynamicMatrix<int>() );
+   }
+
+   {
+      test_ = "Column-major SmallMatrix move constructor (dynamic)";
+
+      OMT mat1( 9UL, 7UL, 5 );
+      OMT mat2( std::move( mat1 ) );
+
+      checkElements( mat2, blaze::DynamicMatrix<int>( 9UL, 7UL, 5 ) );
+      checkElements( mat1, blaze::DynamicMatrix<int>() );
+   }
+
+
+   //=====================================================================================
+   // Non-trivial element type
+   //=====================================================================================
+
+   {
+      test_ = "SmallMatrix constructors with non-trivial element type";
+
+      SMT mat1{ { "a", "b" } };
+      SMT mat2{ { "a", "b", "c" }, { "d", "e", "f" } };
+      SMT mat3( mat2 );
+      SMT mat4( std::move( mat1 ) );
+
+      checkElements( mat3, mat2 );
+      checkElements( mat4, SMT{ { "a", "b" } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SmallMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment operators of the SmallMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "Row-major SmallMatrix copy assignment (preallocated to dynamic)";
+
+      const MT mat1( 8UL, 8UL, 3 );
+      MT mat2{ { 1, 2 } };
+
+      mat2 = mat1;
+
+      checkElements( mat2, mat1 );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix copy assignment (dynamic to preallocated)";
+
+      const MT mat1{ { 1, 2 } };
+      MT mat2( 8UL, 8UL, 3 );
+
+      mat2 = mat1;
+
+      checkElements( mat2, mat1 );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix move assignment (preallocated)";
+
+      MT mat1{ { 1, 2 } };
+      MT mat2( 8UL, 8UL, 3 );
+
+      mat2 = std::move( mat1 );
+
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+      checkElements( mat1, blaze::DynamicMatrix<int>() );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix move assignment (dynamic)";
+
+      MT mat1( 8UL, 8UL, 3 );
+      MT mat2{ { 1, 2 }, { 3, 4 } };
+
+      mat2 = std::move( mat1 );
+
+      checkElements( mat2, blaze::DynamicMatrix<int>( 8UL, 8UL, 3 ) );
+      checkElements( mat1, blaze::DynamicMatrix<int>() );
+   }
+
+   {
+      test_ = "Column-major SmallMatrix move assignment (dynamic)";
+
+      OMT mat1( 8UL, 8UL, 3 );
+      OMT mat2{ { 1, 2 }, { 3, 4 } };
+
+      mat2 = std::move( mat1 );
+
+      checkElements( mat2, blaze::DynamicMatrix<int>( 8UL, 8UL, 3 ) );
+      checkElements( mat1, blaze::DynamicMatrix<int>() );
+   }
+
+   {
+      test_ = "SmallMatrix assignment of a matrix with opposite storage order";
+
+      const OMT mat1{ { 1, 2, 3 }, { 4, 5, 6 } };
+      MT mat2;
+
+      mat2 = mat1;
+
+      checkElements( mat2, mat1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() and reserve() member functions of the SmallMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() and reserve() member functions of the
+// SmallMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major SmallMatrix::resize()";
+
+      MT mat{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+      mat.resize( 2UL, 2UL, true );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2 }, { 4, 5 } } );
+
+      mat.resize( 6UL, 7UL, true );
+      checkCapacity( mat, 42UL );
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 7UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(1,0) != 4 || mat(1,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Elements have not been preserved\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.resize( 1UL, 2UL, true );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+
+      mat.resize( 0UL, 0UL );
+      checkElements( mat, blaze::DynamicMatrix<int>() );
+   }
+
+   {
+      test_ = "Column-major SmallMatrix::resize()";
+
+      OMT mat{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+      mat.resize( 2UL, 2UL, true );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2 }, { 4, 5 } } );
+
+      mat.resize( 6UL, 7UL, true );
+      checkCapacity( mat, 42UL );
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 7UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(1,0) != 4 || mat(1,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Elements have not been preserved\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.resize( 1UL, 2UL, true );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+
+      mat.resize( 0UL, 0UL );
+      checkElements( mat, blaze::DynamicMatrix<int>() );
+   }
+
+   {
+      test_ = "SmallMatrix::reserve()";
+
+      MT mat{ { 1, 2 }, { 3, 4 } };
+
+      mat.reserve( 4UL );
+      mat.reserve( 100UL );
+
+      checkCapacity( mat, 100UL );
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2 }, { 3, 4 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the shrinkToFit() member function of the SmallMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the shrinkToFit() member function of the SmallMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testShrinkToFit()
+{
+   {
+      test_ = "Row-major SmallMatrix::shrinkToFit() (back to preallocated storage)";
+
+      MT mat( 10UL, 10UL, 1 );
+      mat = { { 1, 2, 3 }, { 4, 5, 6 } };
+      mat.shrinkToFit();
+
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2, 3 }, { 4, 5, 6 } } );
+
+      if( capacity( mat ) >= 100UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dynamic memory has not been released\n"
+             << " Details:\n"
+             << "   Capacity: " << capacity( mat ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major SmallMatrix::shrinkToFit() (back to preallocated storage)";
+
+      OMT mat( 10UL, 10UL, 1 );
+      mat = { { 1, 2, 3 }, { 4, 5, 6 } };
+      mat.shrinkToFit();
+
+      checkElements( mat, blaze::DynamicMatrix<int>{ { 1, 2, 3 }, { 4, 5, 6 } } );
+
+      if( capacity( mat ) >= 100UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dynamic memory has not been released\n"
+             << " Details:\n"
+             << "   Capacity: " << capacity( mat ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SmallMatrix::shrinkToFit() (non-trivial element type)";
+
+      SMT mat{ { "a", "b", "c" }, { "d", "e", "f" } };
+      mat.resize( 1UL, 1UL, true );
+      mat.shrinkToFit();
+
+      checkElements( mat, SMT{ { "a" } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the SmallMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the SmallMatrix class template for all
+// combinations of preallocated and dynamic storage. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   {
+      test_ = "Row-major SmallMatrix swap (preallocated/preallocated)";
+
+      MT mat1{ { 1, 2 } };
+      MT mat2{ { 3, 4, 5 }, { 6, 7, 8 } };
+
+      swap( mat1, mat2 );
+
+      checkElements( mat1, blaze::DynamicMatrix<int>{ { 3, 4, 5 }, { 6, 7, 8 } } );
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix swap (preallocated/dynamic)";
+
+      MT mat1{ { 1, 2 } };
+      MT mat2( 9UL, 10UL, 7 );
+
+      swap( mat1, mat2 );
+
+      checkElements( mat1, blaze::DynamicMatrix<int>( 9UL, 10UL, 7 ) );
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+
+      swap( mat1, mat2 );
+
+      checkElements( mat1, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+      checkElements( mat2, blaze::DynamicMatrix<int>( 9UL, 10UL, 7 ) );
+   }
+
+   {
+      test_ = "Row-major SmallMatrix swap (dynamic/dynamic)";
+
+      MT mat1( 8UL, 8UL, 1 );
+      MT mat2( 9UL, 10UL, 7 );
+
+      swap( mat1, mat2 );
+
+      checkElements( mat1, blaze::DynamicMatrix<int>( 9UL, 10UL, 7 ) );
+      checkElements( mat2, blaze::DynamicMatrix<int>( 8UL, 8UL, 1 ) );
+   }
+
+   {
+      test_ = "Column-major SmallMatrix swap (preallocated/preallocated)";
+
+      OMT mat1{ { 1, 2 } };
+      OMT mat2{ { 3, 4, 5 }, { 6, 7, 8 } };
+
+      swap( mat1, mat2 );
+
+      checkElements( mat1, blaze::DynamicMatrix<int>{ { 3, 4, 5 }, { 6, 7, 8 } } );
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+   }
+
+   {
+      test_ = "Column-major SmallMatrix swap (preallocated/dynamic)";
+
+      OMT mat1{ { 1, 2 } };
+      OMT mat2( 10UL, 9UL, 7 );
+
+      swap( mat1, mat2 );
+
+      checkElements( mat1, blaze::DynamicMatrix<int>( 10UL, 9UL, 7 ) );
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+
+      swap( mat1, mat2 );
+
+      checkElements( mat1, blaze::DynamicMatrix<int>{ { 1, 2 } } );
+      checkElements( mat2, blaze::DynamicMatrix<int>( 10UL, 9UL, 7 ) );
+   }
+
+   {
+      test_ = "SmallMatrix swap (non-trivial element type)";
+
+      SMT mat1{ { "a" } };
+      SMT mat2{ { "b", "c" }, { "d", "e" }, { "f", "g" } };
+
+      swap( mat1, mat2 );
+
+      checkElements( mat1, SMT{ { "b", "c" }, { "d", "e" }, { "f", "g" } } );
+      checkElements( mat2, SMT{ { "a" } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of arithmetic operations with SmallMatrix operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the use of SmallMatrix within matrix and vector expressions.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testArithmetic()
+{
+   {
+      test_ = "SmallMatrix addition and scaling (preallocated)";
+
+      MT  mat1{ { 1, 2, 3 }, { 4, 5, 6 } };
+      OMT mat2{ { 1, 1, 1 }, { 2, 2, 2 } };
+
+      mat1 = 2 * mat1 + mat2;
+      mat2 += mat1;
+
+      checkElements( mat1, blaze::DynamicMatrix<int>{ { 3, 5, 7 }, { 10, 12, 14 } } );
+      checkElements( mat2, blaze::DynamicMatrix<int>{ { 4, 6, 8 }, { 12, 14, 16 } } );
+   }
+
+   {
+      test_ = "SmallMatrix addition and scaling (dynamic)";
+
+      blaze::DynamicMatrix<int> ref( 9UL, 11UL, 0 );
+      MT mat( 9UL, 11UL, 0 );
+
+      for( size_t i=0UL; i<9UL; ++i ) {
+         for( size_t j=0UL; j<11UL; ++j ) {
+            ref(i,j) = static_cast<int>( i*11UL + j );
+            mat(i,j) = static_cast<int>( i*11UL + j );
+         }
+      }
+
+      mat = mat + trans( trans( mat ) );
+      ref = ref + ref;
+
+      checkElements( mat, ref );
+   }
+
+   {
+      test_ = "SmallMatrix matrix/matrix and matrix/vector multiplication";
+
+      const MT  mat1{ { 1, 2, 3 }, { 4, 5, 6 } };
+      const OMT mat2{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+
+      const MT mat3( mat1 * mat2 );
+
+      checkElements( mat3, blaze::DynamicMatrix<int>{ { 22, 28 }, { 49, 64 } } );
+
+      const blaze::SmallVector<int,3UL> vec{ 1, 1, 1 };
+      const blaze::DynamicVector<int> res( mat1 * vec );
+
+      if( res.size() != 2UL || res[0] != 6 || res[1] != 15 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix/vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace smallmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SmallMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SMALLMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SmallMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
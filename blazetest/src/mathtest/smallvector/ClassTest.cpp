@@ -0,0 +1,542 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smallvector/ClassTest.cpp
+//  \brief Source file for the SmallVector class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/smallvector/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smallvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SmallVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()
+{
+   testConstructors();
+   testAssignment();
+   testResize();
+   testShrinkToFit();
+   testSwap();
+   testArithmetic();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SmallVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SmallVector class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SmallVector default constructor";
+
+      VT vec;
+
+      checkSize    ( vec, 0UL );
+      checkCapacity( vec, 4UL );
+      checkElements( vec, blaze::DynamicVector<int>() );
+   }
+
+
+   //=====================================================================================
+   // Size and homogeneous initialization constructors
+   //=====================================================================================
+
+   {
+      test_ = "SmallVector homogeneous initialization constructor (preallocated)";
+
+      VT vec( 3UL, 2 );
+
+      checkElements( vec, blaze::DynamicVector<int>( 3UL, 2 ) );
+   }
+
+   {
+      test_ = "SmallVector homogeneous initialization constructor (dynamic)";
+
+      VT vec( 11UL, 2 );
+
+      checkCapacity( vec, 11UL );
+      checkElements( vec, blaze::DynamicVector<int>( 11UL, 2 ) );
+   }
+
+
+   //=====================================================================================
+   // List initialization
+   //=====================================================================================
+
+   {
+      test_ = "SmallVector initializer list constructor";
+
+      VT vec{ 1, 2, 3, 4, 5 };
+
+      checkElements( vec, blaze::DynamicVector<int>{ 1, 2, 3, 4, 5 } );
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructors
+   //=====================================================================================
+
+   {
+      test_ = "SmallVector copy constructor (preallocated)";
+
+      const VT vec1{ 1, 2, 3 };
+      const VT vec2( vec1 );
+
+      checkElements( vec2, vec1 );
+   }
+
+   {
+      test_ = "SmallVector copy constructor (dynamic)";
+
+      const VT vec1( 9UL, 5 );
+      const VT vec2( vec1 );
+
+      checkElements( vec2, vec1 );
+   }
+
+   {
+      test_ = "SmallVector move constructor (preallocated)";
+
+      VT vec1{ 1, 2, 3 };
+      VT vec2( std::move( vec1 ) );
+
+      checkElements( vec2, blaze::DynamicVector<int>{ 1, 2, 3 } );
+      checkElements( vec1, blaze::DynamicVector<int>() );
+   }
+
+   {
+      test_ = "SmallVector move constructor (dynamic)";
+
+      VT vec1( 9UL, 5 );
+      const int* const data( vec1.data() );
+      VT vec2( std::move( vec1 ) );
+
+      checkElements( vec2, blaze::DynamicVector<int>( 9UL, 5 ) );
+      checkElements( vec1, blaze::DynamicVector<int>() );
+
+      if( vec2.data() != data ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dynamic memory has not been transferred\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Non-trivial element type
+   //=====================================================================================
+
+   {
+      test_ = "SmallVector constructors with non-trivial element type";
+
+      SVT vec1{ "a", "b" };
+      SVT vec2{ "a", "b", "c", "d", "e" };
+      SVT vec3( vec2 );
+      SVT vec4( std::move( vec1 ) );
+
+      checkElements( vec3, vec2 );
+      checkElements( vec4, SVT{ "a", "b" } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SmallVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment operators of the SmallVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "SmallVector copy assignment (preallocated to dynamic)";
+
+      const VT vec1( 10UL, 3 );
+      VT vec2{ 1, 2 };
+
+      vec2 = vec1;
+
+      checkElements( vec2, vec1 );
+   }
+
+   {
+      test_ = "SmallVector copy assignment (dynamic to preallocated)";
+
+      const VT vec1{ 1, 2 };
+      VT vec2( 10UL, 3 );
+
+      vec2 = vec1;
+
+      checkElements( vec2, vec1 );
+   }
+
+   {
+      test_ = "SmallVector move assignment (preallocated)";
+
+      VT vec1{ 1, 2 };
+      VT vec2( 10UL, 3 );
+
+      vec2 = std::move( vec1 );
+
+      checkElements( vec2, blaze::DynamicVector<int>{ 1, 2 } );
+      checkElements( vec1, blaze::DynamicVector<int>() );
+   }
+
+   {
+      test_ = "SmallVector move assignment (dynamic)";
+
+      VT vec1( 10UL, 3 );
+      VT vec2{ 1, 2, 3, 4 };
+
+      vec2 = std::move( vec1 );
+
+      checkElements( vec2, blaze::DynamicVector<int>( 10UL, 3 ) );
+      checkElements( vec1, blaze::DynamicVector<int>() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() and reserve() member functions of the SmallVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() and reserve() member functions of the
+// SmallVector class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "SmallVector::resize()";
+
+   VT vec{ 1, 2, 3 };
+
+   vec.resize( 2UL );
+   checkElements( vec, blaze::DynamicVector<int>{ 1, 2 } );
+
+   vec.resize( 12UL, true );
+   checkCapacity( vec, 12UL );
+   checkSize( vec, 12UL );
+
+   if( vec[0] != 1 || vec[1] != 2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Elements have not been preserved\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   vec.resize( 0UL );
+   checkElements( vec, blaze::DynamicVector<int>() );
+
+
+   test_ = "SmallVector::reserve()";
+
+   VT vec2{ 1, 2 };
+
+   vec2.reserve( 3UL );
+   vec2.reserve( 20UL );
+
+   checkCapacity( vec2, 20UL );
+   checkElements( vec2, blaze::DynamicVector<int>{ 1, 2 } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the shrinkToFit() member function of the SmallVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the shrinkToFit() member function of the SmallVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testShrinkToFit()
+{
+   {
+      test_ = "SmallVector::shrinkToFit() (back to preallocated storage)";
+
+      VT vec( 20UL, 1 );
+      vec.resize( 3UL );
+      vec.shrinkToFit();
+
+      checkElements( vec, blaze::DynamicVector<int>( 3UL, 1 ) );
+
+      vec.resize( 4UL, true );
+      vec[3] = 2;
+
+      checkElements( vec, blaze::DynamicVector<int>{ 1, 1, 1, 2 } );
+   }
+
+   {
+      test_ = "SmallVector::shrinkToFit() (non-trivial element type)";
+
+      SVT vec{ "a", "b", "c", "d" };
+      vec.resize( 1UL );
+      vec.shrinkToFit();
+
+      checkElements( vec, SVT{ "a" } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the SmallVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the SmallVector class template for all
+// combinations of preallocated and dynamic storage. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   {
+      test_ = "SmallVector swap (preallocated/preallocated)";
+
+      VT vec1{ 1, 2 };
+      VT vec2{ 3, 4, 5 };
+
+      swap( vec1, vec2 );
+
+      checkElements( vec1, blaze::DynamicVector<int>{ 3, 4, 5 } );
+      checkElements( vec2, blaze::DynamicVector<int>{ 1, 2 } );
+   }
+
+   {
+      test_ = "SmallVector swap (preallocated/dynamic)";
+
+      VT vec1{ 1, 2 };
+      VT vec2( 10UL, 7 );
+
+      swap( vec1, vec2 );
+
+      checkElements( vec1, blaze::DynamicVector<int>( 10UL, 7 ) );
+      checkElements( vec2, blaze::DynamicVector<int>{ 1, 2 } );
+
+      swap( vec1, vec2 );
+
+      checkElements( vec1, blaze::DynamicVector<int>{ 1, 2 } );
+      checkElements( vec2, blaze::DynamicVector<int>( 10UL, 7 ) );
+   }
+
+   {
+      test_ = "SmallVector swap (dynamic/dynamic)";
+
+      VT vec1( 8UL, 1 );
+      VT vec2( 10UL, 7 );
+
+      swap( vec1, vec2 );
+
+      checkElements( vec1, blaze::DynamicVector<int>( 10UL, 7 ) );
+      checkElements( vec2, blaze::DynamicVector<int>( 8UL, 1 ) );
+   }
+
+   {
+      test_ = "SmallVector swap (non-trivial element type)";
+
+      SVT vec1{ "a" };
+      SVT vec2{ "b", "c", "d" };
+
+      swap( vec1, vec2 );
+
+      checkElements( vec1, SVT{ "b", "c", "d" } );
+      checkElements( vec2, SVT{ "a" } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of arithmetic operations with SmallVector operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the use of SmallVector within vector expressions. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testArithmetic()
+{
+   {
+      test_ = "SmallVector addition and scaling (preallocated)";
+
+      VT vec1{ 1, 2, 3 };
+      VT vec2{ 4, 5, 6 };
+
+      vec1 = 2 * vec1 + vec2;
+      vec2 += vec1;
+
+      checkElements( vec1, blaze::DynamicVector<int>{ 6, 9, 12 } );
+      checkElements( vec2, blaze::DynamicVector<int>{ 10, 14, 18 } );
+   }
+
+   {
+      test_ = "SmallVector addition and scaling (dynamic)";
+
+      blaze::DynamicVector<int> ref( 13UL, 0 );
+      VT vec( 13UL, 0 );
+
+      for( size_t i=0UL; i<13UL; ++i ) {
+         ref[i] = static_cast<int>( i );
+         vec[i] = static_cast<int>( i );
+      }
+
+      vec = vec + vec;
+      ref = ref + ref;
+
+      checkElements( vec, ref );
+   }
+
+   {
+      test_ = "SmallVector inner and outer product";
+
+      const TVT vec1{ 1, 2 };
+      const VT  vec2{ 3, 4 };
+
+      if( vec1 * vec2 != 11 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inner product failed\n"
+             << " Details:\n"
+             << "   Result         : " << ( vec1 * vec2 ) << "\n"
+             << "   Expected result: 11\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::DynamicMatrix<int> mat( vec2 * vec1 );
+
+      if( mat(0,0) != 3 || mat(0,1) != 6 || mat(1,0) != 4 || mat(1,1) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Outer product failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace smallvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SmallVector class test..." << std::endl;
+
+   try
+   {
+      RUN_SMALLVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SmallVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
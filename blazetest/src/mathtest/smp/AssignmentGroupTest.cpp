@@ -0,0 +1,436 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/AssignmentGroupTest.cpp
+//  \brief Source file for the AssignmentGroup test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blazetest/mathtest/smp/AssignmentGroupTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializes the given dense vector with a deterministic pattern.
+//
+// \param v The vector to be initialized.
+// \param seed Offset of the pattern.
+// \return void
+*/
+template< typename VT >
+void initialize( VT& v, size_t seed )
+{
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      v[i] = int( ( i + seed ) % 7UL ) - 3;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the given dense matrix with a deterministic pattern.
+//
+// \param A The matrix to be initialized.
+// \param seed Offset of the pattern.
+// \return void
+*/
+template< typename MT >
+void initializeMatrix( MT& A, size_t seed )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = int( ( i*A.columns() + j + seed ) % 5UL ) - 2;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AssignmentGroupTest test.
+//
+// \exception std::runtime_error Error during the AssignmentGroup test detected.
+*/
+AssignmentGroupTest::AssignmentGroupTest()
+   : test_()  // Label of the currently performed test
+{
+   testVectors();
+   testMatrices();
+   testSpecialTargets();
+   testReuse();
+   testSerialSection();
+   testException();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent evaluation of vector assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a group of small and large dense vector assignments, i.e. assignments
+// that are evaluated as whole tasks and assignments that are partitioned among all threads.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AssignmentGroupTest::testVectors()
+{
+   test_ = "Concurrent evaluation of vector assignments";
+
+   const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD + 19UL );
+
+   blaze::DynamicVector<int> a( N ), b( N ), c( 17UL ), d( 17UL ), x( 11UL );
+   blaze::DynamicMatrix<int> A( 13UL, 11UL );
+   initialize( a, 0UL );
+   initialize( b, 1UL );
+   initialize( c, 2UL );
+   initialize( d, 3UL );
+   initialize( x, 4UL );
+   initializeMatrix( A, 0UL );
+
+   const blaze::DynamicVector<int> r1( serial( a + b ) );
+   const blaze::DynamicVector<int> r2( serial( c - d ) );
+   const blaze::DynamicVector<int> r3( serial( A * x ) );
+   const blaze::DynamicVector<int> r4( serial( a * 3 ) );
+
+   blaze::DynamicVector<int> y1, y2( 5UL, 1 ), y3, y4( N, 1 );
+
+   blaze::AssignmentGroup group;
+   group.add( y1, a + b );
+   group.add( y2, c - d );
+   group.add( y3, A * x );
+   group.add( y4, a * 3 );
+
+   checkSize( group, 4UL );
+
+   group.run();
+
+   checkSize( group, 0UL );
+   checkResult( y1, r1 );
+   checkResult( y2, r2 );
+   checkResult( y3, r3 );
+   checkResult( y4, r4 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent evaluation of matrix assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a group of small and large dense matrix assignments with row-major and
+// column-major targets. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void AssignmentGroupTest::testMatrices()
+{
+   test_ = "Concurrent evaluation of matrix assignments";
+
+   const size_t N( size_t( std::sqrt( double( blaze::SMP_DMATDMATADD_THRESHOLD ) ) ) + 7UL );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( N, N+3UL ), B( N, N+3UL ), D( 9UL, 12UL );
+   blaze::DynamicMatrix<int,blaze::columnMajor> E( 12UL, 7UL );
+   initializeMatrix( A, 0UL );
+   initializeMatrix( B, 1UL );
+   initializeMatrix( D, 2UL );
+   initializeMatrix( E, 3UL );
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> r1( serial( A + B ) );
+   const blaze::DynamicMatrix<int,blaze::columnMajor> r2( serial( trans( A ) ) );
+   const blaze::DynamicMatrix<int,blaze::rowMajor> r3( serial( D * E ) );
+   const blaze::DynamicMatrix<int,blaze::columnMajor> r4( serial( E * 2 ) );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> C1, C3;
+   blaze::DynamicMatrix<int,blaze::columnMajor> C2( 3UL, 3UL, 1 ), C4;
+
+   blaze::AssignmentGroup group;
+   group.add( C1, A + B );
+   group.add( C2, trans( A ) );
+   group.add( C3, D * E );
+   group.add( C4, E * 2 );
+   group.run();
+
+   checkResult( C1, r1 );
+   checkResult( C2, r2 );
+   checkResult( C3, r3 );
+   checkResult( C4, r4 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of assignments that are not evaluated concurrently.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests assignments to sparse and restricted targets, assignments of sparse
+// operands to dense targets, and assignments whose target is an operand of the right-hand
+// side expression within a group of concurrently evaluated assignments. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void AssignmentGroupTest::testSpecialTargets()
+{
+   test_ = "Sparse, restricted, and aliased targets";
+
+   const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD + 19UL );
+
+   blaze::CompressedVector<int> s1( 50UL ), s2( 50UL ), s;
+   s1[3] = 1; s1[17] = -2; s1[49] = 4;
+   s2[3] = 2; s2[20] =  5;
+
+   blaze::DynamicMatrix<int> A( 8UL, 8UL );
+   blaze::DynamicVector<int> a( N ), b( N ), x( 8UL );
+   initializeMatrix( A, 0UL );
+   initialize( a, 1UL );
+   initialize( b, 2UL );
+   initialize( x, 3UL );
+
+   const blaze::CompressedVector<int> r1( serial( s1 + s2 ) );
+   const blaze::DynamicVector<int> r2( s1 );
+   const blaze::DynamicMatrix<int> r3( serial( A + trans( A ) ) );
+   const blaze::DynamicVector<int> r4( serial( A * x ) );
+   const blaze::DynamicVector<int> r5( serial( a - b ) );
+
+   blaze::DynamicVector<int> d( 50UL, 7 ), y;
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<int> > S;
+
+   blaze::AssignmentGroup group;
+   group.add( s, s1 + s2 );       // Sparse target
+   group.add( d, s1 );            // Sparse operand
+   group.add( S, A + trans( A ) );  // Restricted target
+   group.add( x, A * x );         // Aliased target
+   group.add( y, a - b );         // Large assignment
+   group.run();
+
+   checkResult( s, r1 );
+   checkResult( d, r2 );
+   checkResult( S, r3 );
+   checkResult( x, r4 );
+   checkResult( y, r5 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of an assignment group.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the run() function of an empty group has no effect and that a group
+// can be reused after the run() function. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void AssignmentGroupTest::testReuse()
+{
+   test_ = "Reuse of an assignment group";
+
+   blaze::DynamicVector<int> a( 20UL ), b( 20UL ), y, z;
+   initialize( a, 0UL );
+   initialize( b, 1UL );
+
+   blaze::AssignmentGroup group;
+   group.run();
+   checkSize( group, 0UL );
+
+   group.add( y, a + b );
+   group.run();
+   checkResult( y, blaze::DynamicVector<int>( serial( a + b ) ) );
+
+   group.add( y, a - b );
+   group.add( z, b );
+   checkSize( group, 2UL );
+   group.run();
+   checkSize( group, 0UL );
+
+   checkResult( y, blaze::DynamicVector<int>( serial( a - b ) ) );
+   checkResult( z, b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the evaluation of an assignment group within a serial section.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the evaluation of a group of small and large assignments within a serial
+// section. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AssignmentGroupTest::testSerialSection()
+{
+   test_ = "Evaluation within a serial section";
+
+   const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD + 19UL );
+
+   blaze::DynamicVector<int> a( N ), b( N ), c( 10UL ), y1, y2;
+   initialize( a, 0UL );
+   initialize( b, 1UL );
+   initialize( c, 2UL );
+
+   blaze::AssignmentGroup group;
+   group.add( y1, a + b );
+   group.add( y2, c * 2 );
+
+   BLAZE_SERIAL_SECTION
+   {
+      group.run();
+   }
+
+   checkResult( y1, blaze::DynamicVector<int>( serial( a + b ) ) );
+   checkResult( y2, blaze::DynamicVector<int>( serial( c * 2 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of an invalid assignment within a group.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the run() function throws a \a std::invalid_argument exception for
+// a target that cannot be resized and that all assignments of the group are discarded. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AssignmentGroupTest::testException()
+{
+   test_ = "Invalid assignment within a group";
+
+   blaze::DynamicVector<int> a( 5UL ), y;
+   blaze::StaticVector<int,3UL> x;
+   initialize( a, 0UL );
+
+   blaze::AssignmentGroup group;
+   group.add( x, a );
+   group.add( y, a );
+
+   try {
+      group.run();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid assignment succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkSize( group, 0UL );
+
+   group.add( y, a );
+   group.run();
+
+   checkResult( y, a );
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running AssignmentGroup test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_ASSIGNMENTGROUP_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during AssignmentGroup test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
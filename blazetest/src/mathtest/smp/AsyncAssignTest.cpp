@@ -0,0 +1,728 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/AsyncAssignTest.cpp
+//  \brief Source file for the asynchronous assignment test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blazetest/mathtest/smp/AsyncAssignTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Blocks all asynchronous assignments to the given target until the given gate is opened.
+//
+// \param gate The gate to be waited for.
+// \param target The target of the blocked assignments.
+// \return Handle for the blocking task.
+//
+// The blocking task pretends to write to the given target. Therefore all subsequent asynchronous
+// assignments to the target have to wait for the blocking task, whereas all other asynchronous
+// assignments are not blocked.
+*/
+blaze::AsyncAssignment blockTarget( std::shared_future<void> gate, const void* target )
+{
+   return blaze::AsyncAssignment(
+      blaze::AsyncExecutor::instance().submit( [gate]() { gate.wait(); }, target,
+                                               []( const void* ) { return false; } ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opens the given gate after a short delay on a separate thread.
+//
+// \param gate The gate to be opened.
+// \return The thread opening the gate.
+*/
+std::thread openGate( std::promise<void>& gate )
+{
+   return std::thread( [&gate]() {
+      std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+      gate.set_value();
+   } );
+}
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AsyncAssignTest test.
+//
+// \exception std::runtime_error Error during the asynchronous assignment test detected.
+*/
+AsyncAssignTest::AsyncAssignTest()
+   : test_()  // Label of the currently performed test
+{
+   testVector();
+   testMatrix();
+   testOperands();
+   testSynchronization();
+   testConcurrency();
+   testTargets();
+   testException();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment of dense vectors and dense vector expressions
+// to dense vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testVector()
+{
+   {
+      test_ = "Asynchronous assignment of a dense vector expression";
+
+      const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD + 19UL );
+
+      blaze::DynamicVector<int> a( N ), b( N ), y;
+      for( size_t i=0UL; i<N; ++i ) {
+         a[i] = int( i % 7UL );
+         b[i] = int( i % 3UL ) - 1;
+      }
+
+      blaze::AsyncAssignment f( blaze::async_assign( y, a + b ) );
+      f.wait();
+
+      checkReady( f, true );
+      checkResult( y, blaze::DynamicVector<int>( a + b ) );
+   }
+
+   {
+      test_ = "Asynchronous assignment of a matrix/vector multiplication";
+
+      const size_t M( 43UL );
+      const size_t N( 37UL );
+
+      blaze::DynamicMatrix<int> A( M, N );
+      blaze::DynamicVector<int> x( N ), y( M );
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            A(i,j) = int( ( i+j ) % 5UL ) - 2;
+         }
+      }
+      for( size_t j=0UL; j<N; ++j ) {
+         x[j] = int( j % 4UL );
+      }
+
+      blaze::AsyncAssignment f1( blaze::async_assign( y, A * x ) );
+      blaze::AsyncAssignment f2( blaze::async_assign( y, y * 2 ) );  // Executed after f1
+      f2.wait();
+      f1.wait();
+
+      checkResult( y, blaze::DynamicVector<int>( 2 * ( A * x ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment of dense matrices and dense matrix expressions
+// to dense matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testMatrix()
+{
+   test_ = "Asynchronous assignment of a dense matrix expression";
+
+   const size_t M( 53UL );
+   const size_t N( 41UL );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( M, N ), C( M, N );
+   blaze::DynamicMatrix<double,blaze::columnMajor> B( M, N ), D;
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         A(i,j) = double( ( i*N+j ) % 11UL );
+         B(i,j) = double( ( i+j ) % 5UL ) - 2.0;
+      }
+   }
+
+   blaze::AsyncAssignment f1( blaze::async_assign( C, A - B ) );
+   blaze::AsyncAssignment f2( blaze::async_assign( D, trans( trans( C ) ) ) );
+   f1.wait();
+   f2.wait();
+
+   checkResult( C, blaze::DynamicMatrix<double>( A - B ) );
+   checkResult( D, C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the handling of lvalue and rvalue operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that lvalue operands are referenced instead of copied and thus evaluated
+// at the time the assignment is executed, and that temporary operands are moved into the
+// assignment. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testOperands()
+{
+   {
+      test_ = "Asynchronous assignment of an lvalue vector";
+
+      const size_t N( 1021UL );
+
+      const blaze::DynamicVector<int> a( N, 5 );
+      blaze::DynamicVector<int> x( N, 1 ), y;
+
+      blaze::AsyncAssignment f1( blaze::async_assign( x, a ) );
+      blaze::AsyncAssignment f2( blaze::async_assign( y, x ) );  // Refers to the result of f1
+      f2.wait();
+      f1.wait();
+
+      checkResult( y, a );
+   }
+
+   {
+      test_ = "Asynchronous assignment of a temporary vector";
+
+      blaze::DynamicVector<int> y;
+
+      blaze::AsyncAssignment f( blaze::async_assign( y, blaze::DynamicVector<int>( 1021UL, 3 ) ) );
+      f.wait();
+
+      checkResult( y, blaze::DynamicVector<int>( 1021UL, 3 ) );
+   }
+
+   {
+      test_ = "Asynchronous assignment of an lvalue matrix";
+
+      const blaze::DynamicMatrix<int> A( 31UL, 29UL, 2 );
+      blaze::DynamicMatrix<int> B( 31UL, 29UL, 1 ), C;
+
+      blaze::AsyncAssignment f1( blaze::async_assign( B, A ) );
+      blaze::AsyncAssignment f2( blaze::async_assign( C, B ) );  // Refers to the result of f1
+      f2.wait();
+      f1.wait();
+
+      checkResult( C, A );
+   }
+
+   {
+      test_ = "Asynchronous assignment of a temporary matrix";
+
+      blaze::DynamicMatrix<int> C;
+
+      blaze::AsyncAssignment f( blaze::async_assign( C, blaze::DynamicMatrix<int>( 31UL, 29UL, 4 ) ) );
+      f.wait();
+
+      checkResult( C, blaze::DynamicMatrix<int>( 31UL, 29UL, 4 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the automatic synchronization with pending asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that serial vector and matrix assignments, reductions, in-place
+// transpositions, and permutations wait for the completion of all pending asynchronous
+// assignments they conflict with, and that independent operations are not blocked. In order to
+// guarantee that the assignment is still pending, the assignment is blocked until shortly after
+// the subsequent operation has been started. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testSynchronization()
+{
+   const size_t N( 1021UL );
+
+   const blaze::DynamicVector<int> a( N, 2 );
+
+   {
+      test_ = "Serial assignment of the target of a pending assignment";
+
+      blaze::DynamicVector<int> y( N, 0 ), z;
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &y ) );
+      std::thread opener( openGate( gate ) );
+#endif
+
+      blaze::AsyncAssignment f( blaze::async_assign( y, a ) );
+      z = blaze::serial( y );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      opener.join();
+#endif
+
+      checkReady( f, true );
+      checkResult( z, a );
+   }
+
+   {
+      test_ = "Serial matrix assignment of the target of a pending assignment";
+
+      const blaze::DynamicMatrix<int> A( 37UL, 29UL, 3 );
+      blaze::DynamicMatrix<int> B( 37UL, 29UL, 0 ), C;
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &B ) );
+      std::thread opener( openGate( gate ) );
+#endif
+
+      blaze::AsyncAssignment f( blaze::async_assign( B, A ) );
+      C = blaze::serial( B );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      opener.join();
+#endif
+
+      checkReady( f, true );
+      checkResult( C, A );
+   }
+
+   {
+      test_ = "Reduction of the target of a pending assignment";
+
+      blaze::DynamicVector<int> y( N, 0 );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &y ) );
+      std::thread opener( openGate( gate ) );
+#endif
+
+      blaze::AsyncAssignment f( blaze::async_assign( y, a ) );
+      const int result( blaze::sum( y ) );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      opener.join();
+#endif
+
+      checkReady( f, true );
+      checkResult( result, int( 2UL*N ) );
+   }
+
+   {
+      test_ = "Assignment to an operand of a pending assignment";
+
+      blaze::DynamicVector<int> x( N, 3 ), y( N, 0 );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &y ) );
+      std::thread opener( openGate( gate ) );
+#endif
+
+      blaze::AsyncAssignment f( blaze::async_assign( y, a + x ) );
+      x = a;
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      opener.join();
+#endif
+
+      checkReady( f, true );
+      checkResult( y, blaze::DynamicVector<int>( N, 5 ) );
+   }
+
+   {
+      test_ = "In-place transposition of the target of a pending assignment";
+
+      blaze::DynamicMatrix<int> A( 37UL, 29UL ), B( 37UL, 29UL, 0 );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = int( i*A.columns() + j );
+         }
+      }
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &B ) );
+      std::thread opener( openGate( gate ) );
+#endif
+
+      blaze::AsyncAssignment f( blaze::async_assign( B, A ) );
+      B.transpose();
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      opener.join();
+#endif
+
+      checkReady( f, true );
+      checkResult( B, blaze::trans( A ) );
+   }
+
+   {
+      test_ = "Assignment of the values of the target of a pending assignment";
+
+      blaze::CompressedMatrix<int> A( 37UL, 29UL ), B;
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         A(i,(i*7UL)%A.columns()) = int( i+1UL );
+      }
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &B ) );
+      std::thread opener( openGate( gate ) );
+#endif
+
+      blaze::AsyncAssignment f( blaze::async_assign( B, A ) );
+      B.assignValues( A * 2 );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      opener.join();
+#endif
+
+      checkReady( f, true );
+      checkResult( B, A * 2 );
+   }
+
+   {
+      test_ = "Permutation of the target of a pending assignment";
+
+      blaze::CompressedMatrix<int> A( 31UL, 31UL ), B;
+      blaze::DynamicVector<size_t> p( 31UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         A(i,(i*7UL)%A.columns()) = int( i+1UL );
+         p[i] = A.rows() - i - 1UL;
+      }
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &B ) );
+      std::thread opener( openGate( gate ) );
+#endif
+
+      blaze::AsyncAssignment f( blaze::async_assign( B, A ) );
+      const blaze::CompressedMatrix<int> C( blaze::permute( B, p ) );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      opener.join();
+#endif
+
+      checkReady( f, true );
+      checkResult( C, blaze::permute( A, p ) );
+   }
+
+   {
+      test_ = "Independent operations during a pending assignment";
+
+      const blaze::DynamicVector<int> b( N, 4 );
+      blaze::DynamicVector<int> y( N, 0 ), z( N, 0 );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &y ) );
+#endif
+
+      blaze::AsyncAssignment f( blaze::async_assign( y, a ) );
+      z = a + b;
+      const int result( blaze::sum( a ) );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+      checkReady( f, false );
+      gate.set_value();
+#endif
+
+      f.wait();
+
+      checkResult( z, blaze::DynamicVector<int>( N, 6 ) );
+      checkResult( result, int( 2UL*N ) );
+      checkResult( y, a );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent execution of asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that independent asynchronous assignments are executed concurrently to
+// each other, whereas an asynchronous assignment reading the target of a pending asynchronous
+// assignment is executed after its completion. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testConcurrency()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   const size_t N( 1021UL );
+
+   const blaze::DynamicVector<int> a( N, 2 );
+
+   {
+      test_ = "Independent asynchronous assignments";
+
+      blaze::DynamicVector<int> y( N, 0 ), z( N, 0 );
+
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &y ) );
+
+      blaze::AsyncAssignment f1( blaze::async_assign( y, a ) );
+      blaze::AsyncAssignment f2( blaze::async_assign( z, a + a ) );
+
+      f2.wait();
+
+      checkReady( f1, false );
+      checkResult( z, blaze::DynamicVector<int>( N, 4 ) );
+
+      gate.set_value();
+      f1.wait();
+
+      checkResult( y, a );
+   }
+
+   {
+      test_ = "Dependent asynchronous assignments";
+
+      blaze::DynamicVector<int> y( N, 0 ), z( N, 0 );
+
+      std::promise<void> gate;
+      blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &y ) );
+
+      blaze::AsyncAssignment f1( blaze::async_assign( y, a ) );
+      blaze::AsyncAssignment f2( blaze::async_assign( z, y + a ) );
+
+      checkReady( f2, false );
+
+      gate.set_value();
+      f2.wait();
+
+      checkReady( f1, true );
+      checkResult( z, blaze::DynamicVector<int>( N, 4 ) );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the tracking of the targets of pending asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the target and the operands of a pending asynchronous assignment
+// are reported as pending target and pending operands to the thread that started the assignment
+// (and only to this thread) until the assignment has been completed. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testTargets()
+{
+   test_ = "Tracking of the targets and operands of pending assignments";
+
+   const blaze::DynamicMatrix<int> A( 1021UL, 13UL, 1 );
+   const blaze::DynamicVector<int> a( 1021UL, 7 ), x( 13UL, 2 );
+   blaze::DynamicVector<int> y;
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   std::promise<void> gate;
+   blaze::AsyncAssignment blocker( blockTarget( gate.get_future().share(), &y ) );
+
+   blaze::AsyncAssignment f( blaze::async_assign( y, A * x + a ) );
+
+   bool other( true );
+   std::thread( [&other,&y,&x]() {
+      other = blaze::AsyncExecutor::isPendingTarget( &y ) || blaze::AsyncExecutor::isPendingOperand( &x );
+   } ).join();
+
+   const bool target    ( blaze::AsyncExecutor::isPendingTarget( &y ) );
+   const bool operandA  ( blaze::AsyncExecutor::isPendingOperand( &A ) );
+   const bool operandx  ( blaze::AsyncExecutor::isPendingOperand( &x ) );
+   const bool operanda  ( blaze::AsyncExecutor::isPendingOperand( &a ) );
+   const bool nonTarget ( blaze::AsyncExecutor::isPendingTarget( &a ) );
+   const bool nonOperand( blaze::AsyncExecutor::isPendingOperand( &y ) );
+   const bool ready     ( f.isReady() );
+
+   gate.set_value();
+   f.wait();
+
+   if( !target || !operandA || !operandx || !operanda || nonTarget || nonOperand || other || ready ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid pending target or operand detected\n"
+          << " Details:\n"
+          << "   Pending target: " << target << " (expected 1)\n"
+          << "   Pending operands: " << operandA << operandx << operanda << " (expected 111)\n"
+          << "   Operand as pending target: " << nonTarget << " (expected 0)\n"
+          << "   Target as pending operand: " << nonOperand << " (expected 0)\n"
+          << "   Pending accesses of other thread: " << other << " (expected 0)\n"
+          << "   Completed assignment: " << ready << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+#else
+   blaze::AsyncAssignment f( blaze::async_assign( y, A * x + a ) );
+   f.wait();
+#endif
+
+   if( blaze::AsyncExecutor::isPendingTarget( &y ) || blaze::AsyncExecutor::isPendingOperand( &x ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Completed assignment still reported as pending\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkResult( y, blaze::DynamicVector<int>( 1021UL, 33 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions of asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown by an asynchronous assignment is rethrown by the
+// wait() function of the according handle and that subsequent assignments are not affected. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testException()
+{
+   test_ = "Propagation of the exception of an asynchronous assignment";
+
+   const blaze::DynamicVector<int> a( 5UL, 1 );
+   blaze::StaticVector<int,3UL> x;
+   blaze::DynamicVector<int> y;
+
+   blaze::AsyncAssignment f1( blaze::async_assign( x, a ) );
+   blaze::AsyncAssignment f2( blaze::async_assign( y, a ) );
+
+   try {
+      f1.wait();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid assignment succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   f2.wait();
+
+   checkResult( y, a );
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous assignment test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_ASYNCASSIGN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
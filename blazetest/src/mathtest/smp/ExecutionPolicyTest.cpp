@@ -0,0 +1,411 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ExecutionPolicyTest.cpp
+//  \brief Source file for the execution policy test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/smp/ExecutionPolicyTest.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ExecutionPolicyTest test.
+//
+// \exception std::runtime_error Error during the execution policy test detected.
+*/
+ExecutionPolicyTest::ExecutionPolicyTest()
+   : test_()  // Label of the currently performed test
+{
+   testPolicy();
+   testScope();
+   testNested();
+   testExecutor();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the settings of an execution policy.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the default settings of an execution policy and the setting of the number
+// of threads, the nested flag, and the executor. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ExecutionPolicyTest::testPolicy()
+{
+   test_ = "ExecutionPolicy settings";
+
+   blaze::ExecutionPolicy policy;
+
+   checkValue( "default number of threads", policy.threads(), 0UL );
+   checkValue( "default nested flag", policy.nested(), false );
+   checkValue( "default executor", static_cast<bool>( policy.executor() ), false );
+
+   size_t calls( 0UL );
+   policy.threads( 3UL )
+         .nested( true )
+         .executor( [&calls]( size_t n, const std::function<void(size_t)>& task ) {
+            for( size_t i=0UL; i<n; ++i ) task( i );
+            ++calls;
+         } );
+
+   checkValue( "number of threads", policy.threads(), 3UL );
+   checkValue( "nested flag", policy.nested(), true );
+   checkValue( "executor", static_cast<bool>( policy.executor() ), true );
+
+   policy.executor()( 2UL, []( size_t ) {} );
+   checkValue( "number of executor calls", calls, 1UL );
+
+   policy.executor( blaze::ExecutionPolicy::Executor() );
+   checkValue( "executor", static_cast<bool>( policy.executor() ), false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the activation, nesting, and restoration of execution scopes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an execution scope activates its policy for the calling thread only,
+// that nested scopes can only further restrict the number of threads, that the previous policy
+// is restored at the end of a scope, and that a single thread enforces a serial execution. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ExecutionPolicyTest::testScope()
+{
+   test_ = "ExecutionScope activation and restoration";
+
+   checkValue( "number of threads", blaze::getExecutionPolicy().threads(), 0UL );
+   checkValue( "serial section flag", blaze::isSerialSectionActive(), false );
+
+   {
+      blaze::ExecutionScope outer( blaze::ExecutionPolicy().threads( 4UL ).nested( true ) );
+
+      checkValue( "number of threads", blaze::getExecutionPolicy().threads(), 4UL );
+      checkValue( "nested flag", blaze::getExecutionPolicy().nested(), true );
+
+      {
+         blaze::ExecutionScope inner( blaze::ExecutionPolicy().threads( 8UL ) );
+         checkValue( "number of threads (larger inner limit)", blaze::getExecutionPolicy().threads(), 4UL );
+         checkValue( "nested flag", blaze::getExecutionPolicy().nested(), false );
+      }
+
+      {
+         const blaze::ExecutionPolicy unrestricted;
+         blaze::ExecutionScope inner( unrestricted );
+         checkValue( "number of threads (unrestricted inner scope)", blaze::getExecutionPolicy().threads(), 4UL );
+      }
+
+      {
+         blaze::ExecutionScope inner( blaze::ExecutionPolicy().threads( 2UL ) );
+         checkValue( "number of threads (smaller inner limit)", blaze::getExecutionPolicy().threads(), 2UL );
+      }
+
+      checkValue( "number of threads", blaze::getExecutionPolicy().threads(), 4UL );
+      checkValue( "nested flag", blaze::getExecutionPolicy().nested(), true );
+
+      // The policy is only active for the calling thread
+      size_t threads( 1UL );
+      std::thread other( [&threads]() { threads = blaze::getExecutionPolicy().threads(); } );
+      other.join();
+      checkValue( "number of threads of another thread", threads, 0UL );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+      if( omp_get_max_threads() > 2 ) {
+         const int previous( omp_get_max_threads() );
+         {
+            blaze::ExecutionScope inner( blaze::ExecutionPolicy().threads( 2UL ) );
+            checkValue( "number of OpenMP threads", omp_get_max_threads(), 2 );
+         }
+         checkValue( "number of OpenMP threads", omp_get_max_threads(), previous );
+      }
+#endif
+   }
+
+   checkValue( "number of threads", blaze::getExecutionPolicy().threads(), 0UL );
+   checkValue( "nested flag", blaze::getExecutionPolicy().nested(), false );
+
+   test_ = "Serial execution enforced by a single thread";
+
+   {
+      blaze::ExecutionScope scope( blaze::ExecutionPolicy().threads( 1UL ) );
+      checkValue( "serial section flag", blaze::isSerialSectionActive(), true );
+
+      const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD + 19UL );
+      blaze::DynamicVector<int> a( N, 2 ), b( N, 3 ), c;
+      c = a + b;
+      checkValue( "result of the assignment", c, blaze::DynamicVector<int>( N, 5 ) );
+   }
+
+   checkValue( "serial section flag", blaze::isSerialSectionActive(), false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the execution of nested parallel operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that operations started from within the tasks of a parallel operation
+// are executed serially by default. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ExecutionPolicyTest::testNested()
+{
+#if BLAZE_HPX_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   if( !blaze::canSMPFor() )
+      return;
+
+   test_ = "Serial execution of nested parallel operations";
+
+   const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD + 19UL );
+   const blaze::DynamicVector<int> a( N, 2 ), b( N, 3 );
+
+   std::vector< blaze::DynamicVector<int> > results( 4UL );
+   std::atomic<size_t> parallel( 0UL );
+
+   blaze::smpFor( results.size(), [&]( size_t k ) {
+      if( !blaze::isSerialSectionActive() ) ++parallel;
+      results[k] = a + b;
+   } );
+
+   checkValue( "number of parallel nested operations", parallel.load(), 0UL );
+
+   for( const auto& result : results ) {
+      checkValue( "result of a nested assignment", result, blaze::DynamicVector<int>( N, 5 ) );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the execution of parallel operations by a user-defined executor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the tasks of parallel operations are executed by the executor of
+// the active execution policy, that the number of tasks is limited by the number of threads of
+// the policy, that the policy is active within the tasks, and that nested operations are only
+// executed by the executor in case the policy allows a nested parallel execution. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ExecutionPolicyTest::testExecutor()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   std::atomic<size_t> calls( 0UL ), tasks( 0UL ), invalid( 0UL );
+
+   // Executes each task on a separate thread and checks that each task is executed exactly once
+   const auto executor = [&]( size_t n, const std::function<void(size_t)>& task )
+   {
+      ++calls;
+      tasks += n;
+
+      std::vector< std::atomic<size_t> > executed( n );
+      std::vector<std::thread> threads;
+
+      for( size_t i=0UL; i<n; ++i ) {
+         executed[i] = 0UL;
+         threads.emplace_back( [&task,&executed,i]() { task( i ); ++executed[i]; } );
+      }
+      for( auto& thread : threads ) {
+         thread.join();
+      }
+      for( size_t i=0UL; i<n; ++i ) {
+         if( executed[i] != 1UL ) ++invalid;
+      }
+   };
+
+   const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD + 19UL );
+   const blaze::DynamicVector<int> a( N, 2 ), b( N, 3 ), expected( N, 5 );
+
+   {
+      test_ = "Assignment by a user-defined executor";
+
+      blaze::ExecutionScope scope( blaze::ExecutionPolicy().threads( 3UL ).executor( executor ) );
+
+      blaze::DynamicVector<int> c;
+      c = a + b;
+
+      checkValue( "result of the assignment", c, expected );
+      checkValue( "number of executor calls", calls.load(), 1UL );
+      checkValue( "number of invalid task executions", invalid.load(), 0UL );
+
+      if( tasks < 2UL || tasks > 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of tasks detected\n"
+             << " Details:\n"
+             << "   Number of tasks: " << tasks << "\n"
+             << "   Expected number of tasks: 2 or 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Execution policy within the tasks of an executor";
+
+      calls = 0UL;
+      std::atomic<size_t> mismatch( 0UL );
+
+      blaze::ExecutionScope scope( blaze::ExecutionPolicy().threads( 3UL ).executor( executor ) );
+
+      blaze::smpFor( 3UL, [&mismatch]( size_t ) {
+         if( blaze::getExecutionPolicy().threads() != 3UL || !blaze::isSerialSectionActive() )
+            ++mismatch;
+      } );
+
+      checkValue( "number of executor calls", calls.load(), 1UL );
+      checkValue( "number of tasks with invalid policy", mismatch.load(), 0UL );
+   }
+
+   for( bool nested : { false, true } )
+   {
+      test_ = nested ? "Nested operations with a nested executor"
+                     : "Nested operations without a nested executor";
+
+      calls = 0UL;
+
+      blaze::ExecutionScope scope( blaze::ExecutionPolicy().threads( 2UL ).nested( nested ).executor( executor ) );
+
+      std::vector< blaze::DynamicVector<int> > results( 2UL );
+
+      blaze::smpFor( results.size(), [&]( size_t k ) {
+         results[k] = a + b;
+      } );
+
+      checkValue( "number of executor calls", calls.load(), nested ? 3UL : 1UL );
+      checkValue( "number of invalid task executions", invalid.load(), 0UL );
+
+      for( const auto& result : results ) {
+         checkValue( "result of a nested assignment", result, expected );
+      }
+   }
+
+   test_ = "Single thread with a user-defined executor";
+
+   {
+      calls = 0UL;
+
+      blaze::ExecutionScope scope( blaze::ExecutionPolicy().threads( 1UL ).executor( executor ) );
+
+      blaze::DynamicVector<int> c;
+      c = a + b;
+
+      checkValue( "result of the assignment", c, expected );
+      checkValue( "number of executor calls", calls.load(), 0UL );
+   }
+#endif
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running execution policy test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_EXECUTIONPOLICY_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during execution policy test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,501 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ParallelForTest.cpp
+//  \brief Source file for the parallel loop test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/smp/ParallelForTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializes the given sparse matrix with a fixed sparsity pattern.
+//
+// \param A The sparse matrix to be initialized.
+// \return void
+//
+// This function inserts an element with value 1 at all positions \f$ (i,j) \f$ with
+// \f$ (7i+3j) \bmod 5 = 0 \f$.
+*/
+template< typename MT >
+void initializePattern( MT& A )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( ( i*7UL + j*3UL ) % 5UL == 0UL )
+            A(i,j) = 1.0;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ParallelForTest test.
+//
+// \exception std::runtime_error Error during the parallel loop test detected.
+*/
+ParallelForTest::ParallelForTest()
+   : test_()  // Label of the currently performed test
+{
+   testFor();
+   testNested();
+   testReduceChunks();
+   testAssignValues();
+   testPermute();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the smpFor() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the smpFor() function executes every iteration exactly once, that
+// the loop body is executed within a parallel section (which prevents the parallel execution
+// of nested operations), and that the previous state is restored after the loop. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ParallelForTest::testFor()
+{
+   test_ = "smpFor()";
+
+   const bool parallel( blaze::canSMPFor() );
+
+   for( size_t n : { 0UL, 1UL, 2UL, 3UL, 4UL, 7UL, 16UL, 100UL, 1000UL } )
+   {
+      std::vector<int> counts( n, 0 ), active( n, 0 ), nested( n, 0 );
+
+      blaze::smpFor( n, [&]( size_t k ) {
+         ++counts[k];
+         active[k] = blaze::isParallelSectionActive();
+         nested[k] = blaze::canSMPFor();
+      } );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         checkValue( "number of executions", counts[k], 1 );
+
+         // A single iteration is executed directly by the calling thread
+         if( n > 1UL ) {
+            checkValue( "parallel section state within the loop", active[k], 1 );
+            checkValue( "nested parallel loop state", nested[k], 0 );
+         }
+      }
+
+      checkValue( "parallel section state after the loop", blaze::isParallelSectionActive(), false );
+      checkValue( "parallel loop state after the loop", blaze::canSMPFor(), parallel );
+   }
+
+   test_ = "smpFor() within a serial section";
+
+   BLAZE_SERIAL_SECTION
+   {
+      checkValue( "parallel loop state", blaze::canSMPFor(), false );
+
+      std::vector<int> counts( 10UL, 0 );
+
+      blaze::smpFor( counts.size(), [&]( size_t k ) {
+         ++counts[k];
+      } );
+
+      for( size_t k=0UL; k<counts.size(); ++k ) {
+         checkValue( "number of executions", counts[k], 1 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel operations nested into the smpFor() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that dense vector operations and reductions that would be executed in
+// parallel on their own are executed serially (and correctly) when they are nested into a
+// parallel loop. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ParallelForTest::testNested()
+{
+   test_ = "Parallel operations within smpFor()";
+
+   blaze::setSMPThreshold( blaze::SMP_DVECDVECADD, 0UL );
+   blaze::setSMPThreshold( blaze::SMP_DVECREDUCE, 0UL );
+
+   const size_t n( 16UL );
+   std::vector< blaze::DynamicVector<double> > results( n );
+   std::vector<double> sums( n, 0.0 );
+
+   blaze::smpFor( n, [&]( size_t k )
+   {
+      blaze::DynamicVector<double> x( 500UL );
+
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         x[i] = double( i + k );
+      }
+
+      results[k] = x + x;
+      sums[k] = blaze::sum( x );
+   } );
+
+   blaze::resetSMPThresholds();
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      blaze::DynamicVector<double> expected( 500UL );
+
+      for( size_t i=0UL; i<expected.size(); ++i ) {
+         expected[i] = 2.0 * double( i + k );
+      }
+
+      checkValue( "vector addition result", results[k], expected );
+      checkValue( "reduction result", sums[k], 500.0*( 499.0/2.0 + double( k ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the smpReduceChunks() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the smpReduceChunks() function computes every chunk exactly once,
+// skips empty chunks, and combines the partial results in ascending order of the chunks by
+// means of non-commutative reduction operations. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ParallelForTest::testReduceChunks()
+{
+   test_ = "smpReduceChunks()";
+
+   const auto concat = []( const std::string& a, const std::string& b ) {
+      return a + "," + b;
+   };
+
+   // No chunks
+   {
+      const std::string result( blaze::smpReduceChunks<std::string>( 0UL,
+         []( size_t, std::string& ) { return true; }, concat ) );
+
+      checkValue( "result for zero chunks", result, std::string() );
+   }
+
+   // Single chunk
+   {
+      const std::string result( blaze::smpReduceChunks<std::string>( 1UL,
+         []( size_t i, std::string& partial ) { partial = std::to_string( i ); return true; }, concat ) );
+
+      checkValue( "result for a single chunk", result, std::string( "0" ) );
+   }
+
+   // Empty chunks
+   {
+      const std::string result( blaze::smpReduceChunks<std::string>( 10UL,
+         []( size_t i, std::string& partial ) {
+            if( i % 3UL == 1UL ) return false;
+            partial = std::to_string( i );
+            return true;
+         }, concat ) );
+
+      checkValue( "result with empty chunks", result, std::string( "0,2,3,5,6,8,9" ) );
+   }
+
+   // Only empty chunks
+   {
+      const std::string result( blaze::smpReduceChunks<std::string>( 7UL,
+         []( size_t, std::string& partial ) { partial = "x"; return false; }, concat ) );
+
+      checkValue( "result for empty chunks", result, std::string() );
+   }
+
+   // Large number of chunks
+   {
+      const size_t chunks( 1000UL );
+      std::vector<int> counts( chunks, 0 );
+
+      const size_t result( blaze::smpReduceChunks<size_t>( chunks,
+         [&]( size_t i, size_t& partial ) { ++counts[i]; partial = i*i + 1UL; return true; },
+         []( size_t a, size_t b ) { return a*31UL + b; } ) );
+
+      size_t expected( 1UL );
+      for( size_t i=1UL; i<chunks; ++i ) {
+         expected = expected*31UL + ( i*i + 1UL );
+      }
+
+      for( size_t i=0UL; i<chunks; ++i ) {
+         checkValue( "number of chunk evaluations", counts[i], 1 );
+      }
+
+      checkValue( "ordered reduction result", result, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignValues() function of the compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the pattern-preserving assignment of row-major and column-major sparse
+// matrices to row-major and column-major compressed matrices, with the rows (or columns) of the
+// target updated by means of the smpFor() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ParallelForTest::testAssignValues()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   blaze::setSMPThreshold( blaze::SMP_SMATASSIGN, 0UL );
+
+   const size_t m( 150UL );
+   const size_t n( 130UL );
+
+   blaze::CompressedMatrix<double,rowMajor> B( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( ( i*7UL + j*3UL ) % 10UL == 0UL )
+            B(i,j) = double( i + j + 1UL );
+      }
+   }
+
+   const blaze::CompressedMatrix<double,columnMajor> C( B );
+
+   test_ = "Row-major CompressedMatrix::assignValues()";
+
+   {
+      blaze::CompressedMatrix<double,rowMajor> A( m, n );
+      initializePattern( A );
+      const size_t nonzeros( A.nonZeros() );
+
+      A.assignValues( B );
+      checkValue( "number of non-zero elements", A.nonZeros(), nonzeros );
+      checkValue( "result", A, B );
+
+      A.assignValues( 2.0 * A );
+      checkValue( "number of non-zero elements", A.nonZeros(), nonzeros );
+      checkValue( "result", A, 2.0 * B );
+
+      A.assignValues( C );
+      checkValue( "number of non-zero elements", A.nonZeros(), nonzeros );
+      checkValue( "result", A, B );
+   }
+
+   test_ = "Column-major CompressedMatrix::assignValues()";
+
+   {
+      blaze::CompressedMatrix<double,columnMajor> A( m, n );
+      initializePattern( A );
+      const size_t nonzeros( A.nonZeros() );
+
+      A.assignValues( C );
+      checkValue( "number of non-zero elements", A.nonZeros(), nonzeros );
+      checkValue( "result", A, C );
+
+      A.assignValues( 2.0 * A );
+      checkValue( "number of non-zero elements", A.nonZeros(), nonzeros );
+      checkValue( "result", A, 2.0 * C );
+
+      A.assignValues( B );
+      checkValue( "number of non-zero elements", A.nonZeros(), nonzeros );
+      checkValue( "result", A, C );
+   }
+
+   test_ = "CompressedMatrix::assignValues() with a non-matching pattern";
+
+   {
+      blaze::CompressedMatrix<double,rowMajor> A( m, n );
+      initializePattern( A );
+
+      blaze::CompressedMatrix<double,rowMajor> D( B );
+      D(m-1UL,n-2UL) = 1.0;
+
+      try {
+         A.assignValues( D );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a matrix with a non-matching pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel permute() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the symmetric permutation of row-major and column-major sparse matrices,
+// with the rows (or columns) of the result computed by means of the smpFor() function. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ParallelForTest::testPermute()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Parallel permute()";
+
+   blaze::setSMPThreshold( blaze::SMP_SMATPERMUTE, 0UL );
+
+   const size_t n( 200UL );
+
+   blaze::CompressedMatrix<double,rowMajor> A( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( ( i*7UL + j*3UL ) % 5UL == 0UL )
+            A(i,j) = double( i*n + j + 1UL );
+      }
+   }
+
+   blaze::DynamicVector<size_t> p( n ), inv( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      p[i] = ( i*37UL + 11UL ) % n;
+      inv[p[i]] = i;
+   }
+
+   // B(i,k) = A(p[i],p[k])
+   blaze::CompressedMatrix<double,rowMajor> expected( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         expected(inv[i],inv[element->index()]) = element->value();
+      }
+   }
+
+   const blaze::CompressedMatrix<double,columnMajor> C( A );
+
+   const blaze::CompressedMatrix<double,rowMajor> B1( blaze::permute( A, p ) );
+   const blaze::CompressedMatrix<double,columnMajor> B2( blaze::permute( C, p ) );
+
+   checkValue( "row-major result", B1, expected );
+   checkValue( "column-major result", B2, expected );
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running parallel loop test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_PARALLELFOR_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during parallel loop test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
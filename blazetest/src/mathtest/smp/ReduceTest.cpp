@@ -0,0 +1,345 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ReduceTest.cpp
+//  \brief Source file for the SMP reduction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/BitVector.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/smp/ReduceTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ReduceTest test.
+//
+// \exception std::runtime_error Error during the SMP reduction detected.
+*/
+ReduceTest::ReduceTest()
+{
+   testInner();
+   testReduce();
+   testNorm();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel inner product of two dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the inner product of two dense vectors whose size exceeds the
+// BLAZE_SMP_DVECDVECINNER_THRESHOLD. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ReduceTest::testInner()
+{
+   const size_t N( blaze::SMP_DVECDVECINNER_THRESHOLD + 137UL );
+
+   {
+      test_ = "Inner product of two dense vectors";
+
+      const blaze::DynamicVector<int> a( setup<int>( N ) );
+      const blaze::DynamicVector<int> b( setup<int>( N+3UL ) );
+
+      int expected( 0 );
+      for( size_t i=0UL; i<N; ++i ) {
+         expected += a[i] * b[i+3UL];
+      }
+
+      checkResult( inner( a, subvector( b, 3UL, N ) ), expected );
+      checkResult( trans( a ) * subvector( b, 3UL, N ), expected );
+   }
+
+   {
+      test_ = "Inner product of two dense vector expressions";
+
+      const blaze::DynamicVector<double> a( setup<double>( N ) );
+      const blaze::DynamicVector<double> b( setup<double>( N ) );
+
+      double expected( 0.0 );
+      for( size_t i=0UL; i<N; ++i ) {
+         expected += ( a[i] + b[i] ) * ( a[i] - 1.0 );
+      }
+
+      checkResult( inner( a + b, a - 1.0 ), expected );
+   }
+
+   {
+      test_ = "Inner product of a bit vector and a dense vector";
+
+      blaze::BitVector<> a( N );
+      for( size_t i=0UL; i<N; i+=3UL ) {
+         a[i] = true;
+      }
+
+      const blaze::DynamicVector<double> x( setup<double>( N ) );
+
+      double expected( 0.0 );
+      for( size_t i=0UL; i<N; i+=3UL ) {
+         expected += x[i];
+      }
+
+      checkResult( inner( a, x ), expected );
+      checkResult( inner( x, a ), expected );
+      checkResult( trans( x ) * a, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reduction of dense and sparse vectors and dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the total reductions of dense vectors, sparse vectors and dense matrices
+// whose size exceeds the according SMP thresholds. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ReduceTest::testReduce()
+{
+   {
+      test_ = "Reduction of a dense vector";
+
+      const size_t N( blaze::SMP_DVECREDUCE_THRESHOLD + 61UL );
+      const blaze::DynamicVector<int> a( setup<int>( N ) );
+
+      int sum( 0 ), max( a[0] ), min( a[0] );
+      for( size_t i=0UL; i<N; ++i ) {
+         sum += a[i];
+         max = std::max( max, a[i] );
+         min = std::min( min, a[i] );
+      }
+
+      checkResult( blaze::sum( a ), sum );
+      checkResult( blaze::max( a ), max );
+      checkResult( blaze::min( a ), min );
+      checkResult( reduce( a, blaze::Add() ), sum );
+      checkResult( reduce( subvector( a, 1UL, N-1UL ), blaze::Add() ), sum - a[0] );
+      checkResult( reduce( a * 2, []( int x, int y ){ return x + y; } ), 2*sum );
+   }
+
+   {
+      test_ = "Reduction of a sparse vector";
+
+      const size_t N( blaze::SMP_SVECREDUCE_THRESHOLD + 29UL );
+      blaze::CompressedVector<int> a( 3UL*N, N );
+
+      int sum( 0 );
+      for( size_t i=0UL; i<N; ++i ) {
+         a.append( 3UL*i, int( i % 5UL ) + 1 );
+         sum += int( i % 5UL ) + 1;
+      }
+
+      checkResult( blaze::sum( a ), sum );
+      checkResult( blaze::max( a ), 5 );
+   }
+
+   {
+      test_ = "Reduction of a dense matrix";
+
+      const size_t M( 7UL );
+      const size_t N( blaze::SMP_DMATTOTALREDUCE_THRESHOLD / M + 5UL );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> A( M, N );
+      int sum( 0 );
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            A(i,j) = int( ( i*N+j ) % 9UL ) - 4;
+            sum += A(i,j);
+         }
+      }
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> B( A );
+
+      checkResult( blaze::sum( A ), sum );
+      checkResult( blaze::sum( B ), sum );
+      checkResult( blaze::max( A ), 4 );
+      checkResult( blaze::min( B ), -4 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel computation of vector and matrix norms.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the norms of dense vectors, sparse vectors and dense matrices whose size
+// exceeds the according SMP thresholds. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ReduceTest::testNorm()
+{
+   {
+      test_ = "Norm of a dense vector";
+
+      const size_t N( blaze::SMP_DVECNORM_THRESHOLD + 77UL );
+      const blaze::DynamicVector<double> a( setup<double>( N ) );
+
+      double sqr( 0.0 ), l1( 0.0 ), linf( 0.0 );
+      for( size_t i=0UL; i<N; ++i ) {
+         sqr += a[i] * a[i];
+         l1  += std::abs( a[i] );
+         linf = std::max( linf, std::abs( a[i] ) );
+      }
+
+      checkResult( sqrNorm( a ), sqr );
+      checkResult( norm( a ), std::sqrt( sqr ) );
+      checkResult( l1Norm( a ), l1 );
+      checkResult( l2Norm( a ), std::sqrt( sqr ) );
+      checkResult( linfNorm( a ), linf );
+      checkResult( sqrNorm( subvector( a, 5UL, N-5UL ) + 1.0 ), [&a,N](){
+         double res( 0.0 );
+         for( size_t i=5UL; i<N; ++i ) res += ( a[i] + 1.0 ) * ( a[i] + 1.0 );
+         return res;
+      }() );
+   }
+
+   {
+      test_ = "Norm of a sparse vector";
+
+      const size_t N( blaze::SMP_SVECREDUCE_THRESHOLD + 29UL );
+      blaze::CompressedVector<double> a( 2UL*N, N );
+
+      double sqr( 0.0 ), l1( 0.0 );
+      for( size_t i=0UL; i<N; ++i ) {
+         const double value( double( i % 7UL ) - 3.0 );
+         a.append( 2UL*i, value );
+         sqr += value * value;
+         l1  += std::abs( value );
+      }
+
+      checkResult( sqrNorm( a ), sqr );
+      checkResult( l1Norm( a ), l1 );
+      checkResult( maxNorm( a ), 3.0 );
+   }
+
+   {
+      test_ = "Norm of a dense matrix";
+
+      const size_t M( 5UL );
+      const size_t N( blaze::SMP_DMATNORM_THRESHOLD / M + 11UL );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> A( M, N );
+      double sqr( 0.0 ), l1( 0.0 );
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            A(i,j) = double( ( i+j ) % 6UL ) - 2.0;
+            sqr += A(i,j) * A(i,j);
+            l1  += std::abs( A(i,j) );
+         }
+      }
+
+      checkResult( sqrNorm( A ), sqr );
+      checkResult( l1Norm( A ), l1 );
+      checkResult( norm( A ), std::sqrt( sqr ) );
+      checkResult( maxNorm( A ), 3.0 );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP reduction test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_REDUCE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,525 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ThresholdTest.cpp
+//  \brief Source file for the runtime SMP threshold test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <blaze/math/SMP.h>
+#include <blaze/math/smp/Thresholds.h>
+#include <blazetest/mathtest/smp/ThresholdTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThresholdTest test.
+//
+// \exception std::runtime_error Error during the SMP threshold test detected.
+*/
+ThresholdTest::ThresholdTest()
+   : test_()                                 // Label of the currently performed test
+   , file_( "blazetest_smp_thresholds.txt" )  // Name of the temporary SMP threshold file
+{
+   testParse();
+   testApply();
+   testSet();
+   testLoad();
+   testSave();
+   testCalibrate();
+
+   std::remove( file_.c_str() );
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parsing of SMP threshold files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parseSMPThresholds() function for both valid and malformed SMP
+// threshold files. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testParse()
+{
+   {
+      test_ = "Parsing a valid SMP threshold file";
+
+      blaze::SMPThresholdSections sections;
+
+      if( !parse( "# Blaze SMP thresholds\n"
+                  "DVECDVECADD 100\n"
+                  "\n"
+                  "threads 2\n"
+                  "DVECDVECADD 200   # comment\n"
+                  "   DMATDMATMULT\t300\n"
+                  "threads 4\n", sections ) ||
+          sections.size() != 3UL ||
+          count( sections, 0UL ) != 1UL || value( sections, 0UL, blaze::SMP_DVECDVECADD ) != 100UL ||
+          count( sections, 2UL ) != 2UL || value( sections, 2UL, blaze::SMP_DVECDVECADD ) != 200UL ||
+          value( sections, 2UL, blaze::SMP_DMATDMATMULT ) != 300UL ||
+          count( sections, 4UL ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing the SMP threshold file failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Parsing malformed SMP threshold files";
+
+      const char* files[] = { "DVECDVECADD\n"
+                            , "DVECDVECADD 100 200\n"
+                            , "DVECDVECADD abc\n"
+                            , "DVECDVECADD -5x\n"
+                            , "threads 0\n"
+                            , "threads\n" };
+
+      for( const char* file : files )
+      {
+         blaze::SMPThresholdSections sections;
+
+         if( parse( file, sections ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Parsing a malformed SMP threshold file succeeded\n"
+                << " Details:\n"
+                << "   File content: \"" << file << "\"\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the application of SMP threshold files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the applySMPThresholds() function for different numbers of threads. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testApply()
+{
+   test_ = "Applying an SMP threshold file";
+
+   blaze::SMPThresholdSections sections;
+   parse( "DVECDVECADD 100\n"
+          "UNKNOWN 1\n"
+          "threads 2\n"
+          "DVECDVECADD 200\n"
+          "DMATDMATMULT 300\n"
+          "threads 4\n"
+          "DMATDMATMULT 400\n", sections );
+
+   const size_t threads [] = { 1UL, 2UL, 3UL, 4UL, 16UL };
+   const size_t expAdd  [] = { 100UL, 200UL, 200UL, 100UL, 100UL };
+   const size_t expMult [] = { blaze::SMP_DMATDMATMULT_THRESHOLD, 300UL, 300UL, 400UL, 400UL };
+
+   for( size_t i=0UL; i<5UL; ++i )
+   {
+      blaze::resetSMPThresholds();
+      blaze::applySMPThresholds( sections, threads[i] );
+
+      const size_t add ( blaze::smpThreshold( blaze::SMP_DVECDVECADD ) );
+      const size_t mult( blaze::smpThreshold( blaze::SMP_DMATDMATMULT ) );
+
+      if( add != expAdd[i] || mult != expMult[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid SMP thresholds detected\n"
+             << " Details:\n"
+             << "   Number of threads: " << threads[i] << "\n"
+             << "   Result: DVECDVECADD=" << add << ", DMATDMATMULT=" << mult << "\n"
+             << "   Expected result: DVECDVECADD=" << expAdd[i] << ", DMATDMATMULT=" << expMult[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setSMPThreshold() and resetSMPThresholds() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setting and resetting of SMP thresholds. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testSet()
+{
+   test_ = "setSMPThreshold() and resetSMPThresholds()";
+
+   blaze::setSMPThreshold( blaze::SMP_DVECDVECADD, 12345UL );
+   blaze::setSMPThreshold( blaze::SMP_DMATTRANSPOSE, 0UL );
+
+   checkValue( blaze::SMP_DVECDVECADD, 12345UL );
+   checkValue( blaze::SMP_DMATTRANSPOSE, 0UL );
+
+   blaze::resetSMPThresholds();
+
+   for( size_t i=0UL; i<blaze::SMP_THRESHOLD_COUNT; ++i ) {
+      checkValue( blaze::SMPThresholdID( i ), blaze::SMP_THRESHOLD_DEFAULTS[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadSMPThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the loading of SMP threshold files. In particular it tests that the
+// section for the current number of threads is applied. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testLoad()
+{
+   const size_t threads( blaze::getNumThreads() );
+
+   {
+      std::ofstream out( file_ );
+      out << "DVECDVECADD 100\n"
+          << "threads " << threads << "\n"
+          << "DVECDVECADD 200\n"
+          << "DMATDMATMULT 300\n"
+          << "threads " << threads+1UL << "\n"
+          << "DVECDVECADD 400\n";
+   }
+
+   {
+      test_ = "Loading an SMP threshold file";
+
+      blaze::setSMPThreshold( blaze::SMP_DVECASSIGN, 7UL );
+
+      blaze::loadSMPThresholds( file_ );
+
+      checkValue( blaze::SMP_DVECDVECADD, 200UL );
+      checkValue( blaze::SMP_DMATDMATMULT, 300UL );
+      checkValue( blaze::SMP_DVECASSIGN, blaze::SMP_DVECASSIGN_THRESHOLD );
+   }
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   {
+      test_ = "Loading an SMP threshold file after changing the number of threads";
+
+      blaze::setNumThreads( threads+1UL );
+      blaze::loadSMPThresholds( file_ );
+      blaze::setNumThreads( threads );
+
+      checkValue( blaze::SMP_DVECDVECADD, 400UL );
+      checkValue( blaze::SMP_DMATDMATMULT, blaze::SMP_DMATDMATMULT_THRESHOLD );
+   }
+#endif
+
+   {
+      test_ = "Loading a non-existing SMP threshold file";
+
+      blaze::setSMPThreshold( blaze::SMP_DVECDVECADD, 500UL );
+
+      try {
+         blaze::loadSMPThresholds( "blazetest_non_existing_file.txt" );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a non-existing SMP threshold file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Unable to open SMP threshold file" )
+            throw;
+      }
+
+      checkValue( blaze::SMP_DVECDVECADD, 500UL );
+   }
+
+   {
+      test_ = "Loading a malformed SMP threshold file";
+
+      {
+         std::ofstream out( file_ );
+         out << "DVECDVECADD 100\n"
+             << "DMATDMATMULT\n";
+      }
+
+      try {
+         blaze::loadSMPThresholds( file_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a malformed SMP threshold file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Invalid SMP threshold file" )
+            throw;
+      }
+
+      checkValue( blaze::SMP_DVECDVECADD, 500UL );
+   }
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the saveSMPThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the saving of the current SMP thresholds. In particular it tests that
+// the sections for other numbers of threads are preserved and that a saved file restores the
+// SMP thresholds. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testSave()
+{
+   const size_t threads( blaze::getNumThreads() );
+
+   {
+      test_ = "Saving the SMP thresholds";
+
+      {
+         std::ofstream out( file_ );
+         out << "threads " << threads+7UL << "\n"
+             << "DVECDVECADD 42\n";
+      }
+
+      blaze::setSMPThreshold( blaze::SMP_DVECDVECADD, 1000UL );
+      blaze::setSMPThreshold( blaze::SMP_DMATTRANSPOSE, 2000UL );
+
+      blaze::saveSMPThresholds( file_ );
+
+      blaze::SMPThresholdSections sections;
+
+      if( !parse( sections ) ||
+          count( sections, threads+7UL ) != 1UL ||
+          value( sections, threads+7UL, blaze::SMP_DVECDVECADD ) != 42UL ||
+          count( sections, threads ) != blaze::SMP_THRESHOLD_COUNT ||
+          value( sections, threads, blaze::SMP_DVECDVECADD ) != 1000UL ||
+          value( sections, threads, blaze::SMP_DMATTRANSPOSE ) != 2000UL ||
+          value( sections, threads, blaze::SMP_DVECASSIGN ) != blaze::SMP_DVECASSIGN_THRESHOLD ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid SMP threshold file written\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Restoring saved SMP thresholds";
+
+      blaze::resetSMPThresholds();
+      blaze::loadSMPThresholds( file_ );
+
+      checkValue( blaze::SMP_DVECDVECADD, 1000UL );
+      checkValue( blaze::SMP_DMATTRANSPOSE, 2000UL );
+      checkValue( blaze::SMP_DVECASSIGN, blaze::SMP_DVECASSIGN_THRESHOLD );
+   }
+
+   {
+      test_ = "Saving the SMP thresholds to a malformed file";
+
+      {
+         std::ofstream out( file_ );
+         out << "threads 0\n";
+      }
+
+      try {
+         blaze::saveSMPThresholds( file_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Saving to a malformed SMP threshold file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Invalid SMP threshold file" )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the calibration of the SMP thresholds for several numbers of threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the calibration of the SMP thresholds for a given list of numbers of
+// threads. In particular it tests that the according sections are written to the SMP threshold
+// file and that the number of threads is restored afterwards. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testCalibrate()
+{
+   const size_t threads( blaze::getNumThreads() );
+
+   {
+      test_ = "Calibrating the SMP thresholds for an invalid number of threads";
+
+      std::remove( file_.c_str() );
+
+      try {
+         blaze::calibrateSMPThresholds( file_, { 2UL, 0UL } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Calibration for 0 threads succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( std::ifstream( file_ ) || blaze::getNumThreads() != threads ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed calibration has side effects\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   {
+      test_ = "Calibrating the SMP thresholds for several numbers of threads";
+
+      blaze::resetSMPThresholds();
+      blaze::calibrateSMPThresholds( file_, { 2UL, 3UL } );
+
+      blaze::SMPThresholdSections sections;
+
+      if( !parse( sections ) ||
+          sections.size() != 2UL ||
+          count( sections, 2UL ) != blaze::SMP_THRESHOLD_COUNT ||
+          count( sections, 3UL ) != blaze::SMP_THRESHOLD_COUNT ||
+          value( sections, 2UL, blaze::SMP_SMATSMATMULT ) != blaze::SMP_SMATSMATMULT_THRESHOLD ||
+          value( sections, 3UL, blaze::SMP_SMATSMATMULT ) != blaze::SMP_SMATSMATMULT_THRESHOLD ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid SMP threshold file written\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( blaze::getNumThreads() != threads ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Number of threads not restored\n"
+             << " Details:\n"
+             << "   Result:   " << blaze::getNumThreads() << "\n"
+             << "   Expected: " << threads << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::resetSMPThresholds();
+   }
+#endif
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime SMP threshold test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_THRESHOLD_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime SMP threshold test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,602 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sparsevector/MergeKernelsTest.cpp
+//  \brief Source file for the sparse merge kernel test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <blaze/math/sparse/MergeKernels.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blazetest/mathtest/sparsevector/MergeKernelsTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsevector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MergeKernelsTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MergeKernelsTest::MergeKernelsTest()
+   : test_()
+{
+   testGallop();
+   testPatterns();
+   testBlockBoundaries();
+   testUnequalSizes();
+   testRandom();
+   testProbe();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the exponential search of the gallop() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the gallop() function with a binary search for all
+// possible search indices in ranges of various lengths. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void MergeKernelsTest::testGallop()
+{
+   test_ = "gallop()";
+
+   for( blaze::size_t n : { 0UL, 1UL, 2UL, 3UL, 5UL, 16UL, 17UL, 100UL } )
+   {
+      Indices indices;
+      for( blaze::size_t i=0UL; i<n; ++i ) {
+         indices.push_back( 3UL*i + 1UL );
+      }
+
+      const VT v( create( indices, true ) );
+
+      for( blaze::size_t index=0UL; index<=3UL*n+2UL; ++index )
+      {
+         const auto result  ( blaze::gallop( v.begin(), v.end(), index ) );
+         const auto expected( std::lower_bound( v.begin(), v.end(), index,
+                                 []( const auto& element, blaze::size_t i ) {
+                                    return element.index() < i;
+                                 } ) );
+
+         if( result != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid search result\n"
+                << " Details:\n"
+                << "   Length of the range: " << n << "\n"
+                << "   Search index: " << index << "\n"
+                << "   Result position: " << ( result - v.begin() ) << "\n"
+                << "   Expected position: " << ( expected - v.begin() ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merge kernels for empty, disjoint, and identical ranges.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests all merge kernels for empty ranges, ranges without common indices (both
+// interleaved and separated) and ranges with completely identical indices. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void MergeKernelsTest::testPatterns()
+{
+   Indices evens, odds, front, back, all;
+
+   for( blaze::size_t i=0UL; i<200UL; ++i ) {
+      ( i % 2UL == 0UL ? evens : odds ).push_back( i );
+      ( i < 100UL ? front : back ).push_back( i );
+      all.push_back( i );
+   }
+
+   test_ = "Empty ranges";
+   checkKernels( Indices{}, Indices{} );
+   checkKernels( Indices{}, all );
+   checkKernels( all, Indices{} );
+
+   test_ = "No overlap";
+   checkKernels( evens, odds );
+   checkKernels( odds, evens );
+   checkKernels( front, back );
+   checkKernels( back, front );
+
+   test_ = "Full overlap";
+   checkKernels( all, all );
+   checkKernels( evens, evens );
+   checkKernels( Indices{ 7UL }, Indices{ 7UL } );
+
+   test_ = "Partial overlap";
+   checkKernels( all, evens );
+   checkKernels( odds, all );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merge kernels for runs crossing the boundaries of the SIMD blocks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests all merge kernels for runs of matching and non-matching indices that
+// cross the boundaries of the blocks of 4 (AVX2) and 8 (AVX-512) indices of the vectorized
+// intersection kernel, for blocks with equal and different maximum indices and for ranges
+// whose lengths are not multiples of the block size. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void MergeKernelsTest::testBlockBoundaries()
+{
+   test_ = "Runs crossing SIMD block boundaries";
+
+   // Matches at the end of a block and at the beginning of the next block
+   checkKernels( Indices{ 0UL, 1UL, 2UL, 3UL, 4UL, 5UL, 6UL, 7UL, 8UL, 9UL },
+                 Indices{ 3UL, 4UL, 7UL, 8UL, 9UL } );
+
+   // Equal maximum indices of both blocks
+   checkKernels( Indices{ 0UL, 2UL, 4UL, 6UL, 8UL, 10UL, 12UL, 14UL },
+                 Indices{ 1UL, 3UL, 5UL, 6UL, 9UL, 11UL, 13UL, 14UL } );
+
+   // Match of the first element of one block with the last element of the other block
+   checkKernels( Indices{ 0UL, 1UL, 2UL, 10UL, 11UL, 12UL, 13UL, 20UL },
+                 Indices{ 10UL, 30UL, 31UL, 32UL, 33UL, 34UL, 35UL, 36UL } );
+
+   // Runs of matching indices of all offsets and lengths
+   Indices all;
+   for( blaze::size_t i=0UL; i<48UL; ++i ) {
+      all.push_back( i );
+   }
+
+   for( blaze::size_t first=0UL; first<17UL; ++first ) {
+      for( blaze::size_t length=1UL; length<19UL; ++length )
+      {
+         Indices run;
+         for( blaze::size_t i=first; i<first+length; ++i ) {
+            run.push_back( i );
+         }
+
+         // Additional elements behind the run to shift the block boundaries
+         Indices shifted( run );
+         for( blaze::size_t i=0UL; i<first%5UL; ++i ) {
+            shifted.push_back( 100UL + i );
+         }
+
+         checkKernels( all, run );
+         checkKernels( run, all );
+         checkKernels( shifted, all );
+         checkKernels( all, shifted );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merge kernels for ranges of very unequal sizes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests all merge kernels for ranges whose length ratio is close to, equal to,
+// and far beyond the galloping ratio, such that both the vectorized and the galloping kernels
+// are selected by mergeIntersection(). In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void MergeKernelsTest::testUnequalSizes()
+{
+   test_ = "Very unequal sizes";
+
+   Indices large;
+   for( blaze::size_t i=0UL; i<1000UL; ++i ) {
+      large.push_back( i );
+   }
+
+   for( blaze::size_t n : { 60UL, 63UL, 64UL, 65UL, 100UL, 1000UL } )
+   {
+      const Indices longer( large.begin(), large.begin()+n );
+      const Indices shorter{ 0UL, 3UL, n/2UL, n-1UL };
+
+      checkKernels( shorter, longer );
+      checkKernels( longer, shorter );
+   }
+
+   checkKernels( Indices{ 0UL }, large );
+   checkKernels( Indices{ 999UL }, large );
+   checkKernels( large, Indices{ 500UL, 1000UL, 2000UL } );
+   checkKernels( Indices{ 1000UL, 1001UL }, large );
+   checkKernels( large, Indices{ 1000UL, 1001UL } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merge kernels for random index patterns.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests all merge kernels for random ranges of various lengths and densities.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MergeKernelsTest::testRandom()
+{
+   test_ = "Random index patterns";
+
+   std::mt19937 engine( 42U );
+
+   for( blaze::size_t trial=0UL; trial<1000UL; ++trial )
+   {
+      const blaze::size_t size( 1UL + engine() % 300UL );
+      std::uniform_real_distribution<double> density( 0.0, 1.0 );
+      const double pa( density( engine ) );
+      const double pb( density( engine ) * ( trial % 4UL == 0UL ? 0.05 : 1.0 ) );
+
+      Indices a, b;
+      for( blaze::size_t i=0UL; i<size; ++i ) {
+         if( density( engine ) < pa ) a.push_back( i );
+         if( density( engine ) < pb ) b.push_back( i );
+      }
+
+      checkKernels( a, b );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the IntersectionProbe class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the intersection of several probing ranges with a fixed range by means
+// of the index bitmap, in particular for indices at the boundaries of the 64-bit words of the
+// bitmap and for a total number of indices that is not a multiple of 64. Additionally, it tests
+// the selection of the index bitmap. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void MergeKernelsTest::testProbe()
+{
+   test_ = "IntersectionProbe bitmap";
+
+   const Indices fixed{ 0UL, 1UL, 63UL, 64UL, 65UL, 127UL, 128UL, 129UL };
+   const VT b( create( fixed, false ) );
+
+   const auto probe( blaze::makeIntersectionProbe( b.begin(), b.end(), 130UL, true ) );
+
+   Indices all;
+   for( blaze::size_t i=0UL; i<130UL; ++i ) {
+      all.push_back( i );
+   }
+
+   const Indices probes[] = { Indices{}, all, fixed,
+                              Indices{ 2UL, 62UL, 66UL, 126UL },
+                              Indices{ 63UL, 64UL }, Indices{ 129UL } };
+
+   for( const Indices& indices : probes )
+   {
+      const VT a( create( indices, true ) );
+
+      Pairs result;
+      probe.intersect( a.begin(), a.end(), [&result]( auto l, auto r ) {
+         result.emplace_back( l->value(), r->value() );
+      } );
+      checkPairs( "IntersectionProbe (bitmap)", indices, fixed, result, intersection( indices, fixed ) );
+   }
+
+   test_ = "IntersectionProbe of an empty range";
+
+   const VT empty( 0UL );
+   const auto none( blaze::makeIntersectionProbe( empty.begin(), empty.end(), 0UL, true ) );
+
+   Pairs result;
+   none.intersect( empty.begin(), empty.end(), [&result]( auto l, auto r ) {
+      result.emplace_back( l->value(), r->value() );
+   } );
+   checkPairs( "IntersectionProbe (empty)", Indices{}, Indices{}, result, Pairs{} );
+
+   test_ = "IntersectionProbe selection";
+
+   if( !blaze::useIntersectionBitmap( 100UL, 1000UL, 50UL, 500UL ) ||
+       blaze::useIntersectionBitmap( 5UL, 1000UL, 50UL, 500UL ) ||
+       blaze::useIntersectionBitmap( 100UL, 100000UL, 50UL, 500UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid selection of the index bitmap\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking all merge kernels for the given index patterns.
+//
+// \param a The indices of the left-hand side range.
+// \param b The indices of the right-hand side range.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs the union kernel, all intersection kernels (both for contiguous and for
+// non-contiguous ranges) and the intersection probes (with and without bitmap) for the given
+// index patterns and compares the visited pairs of elements with a reference merge.
+*/
+void MergeKernelsTest::checkKernels( const Indices& a, const Indices& b )
+{
+   const VT va( create( a, true  ) );
+   const VT vb( create( b, false ) );
+
+   // Copies of the elements accessed via non-pointer iterators
+   std::vector< blaze::ValueIndexPair<int> > la, lb;
+   for( const auto& element : va ) la.emplace_back( element.value(), element.index() );
+   for( const auto& element : vb ) lb.emplace_back( element.value(), element.index() );
+
+   const Pairs expected( intersection( a, b ) );
+   Pairs result;
+
+   const auto record = [&result]( auto l, auto r ) {
+      result.emplace_back( l->value(), r->value() );
+   };
+
+   // Union kernel
+   blaze::mergeUnion( va.begin(), va.end(), vb.begin(), vb.end(),
+                      [&result]( auto l ) { result.emplace_back( l->value(), 0 ); },
+                      [&result]( auto r ) { result.emplace_back( 0, r->value() ); },
+                      record );
+   checkPairs( "mergeUnion", a, b, result, merge( a, b ) );
+
+   // Intersection kernels for contiguous ranges
+   result.clear();
+   blaze::mergeIntersectionScalar( va.begin(), va.end(), vb.begin(), vb.end(), record );
+   checkPairs( "mergeIntersectionScalar", a, b, result, expected );
+
+   result.clear();
+   blaze::mergeIntersectionSIMD( va.begin(), va.end(), vb.begin(), vb.end(), record );
+   checkPairs( "mergeIntersectionSIMD", a, b, result, expected );
+
+   result.clear();
+   blaze::mergeIntersectionGalloping( va.begin(), va.end(), vb.begin(), vb.end(), record );
+   checkPairs( "mergeIntersectionGalloping", a, b, result, expected );
+
+   result.clear();
+   blaze::mergeIntersection( va.begin(), va.end(), vb.begin(), vb.end(), record );
+   checkPairs( "mergeIntersection (contiguous)", a, b, result, expected );
+
+   // Intersection kernel for non-contiguous ranges
+   result.clear();
+   blaze::mergeIntersection( la.begin(), la.end(), lb.begin(), lb.end(), record );
+   checkPairs( "mergeIntersection (non-contiguous)", a, b, result, expected );
+
+   // Intersection probes
+   const blaze::size_t size( std::max( va.size(), vb.size() ) );
+
+   for( bool bitmap : { false, true } ) {
+      result.clear();
+      const auto probe( blaze::makeIntersectionProbe( vb.begin(), vb.end(), size, bitmap ) );
+      probe.intersect( va.begin(), va.end(), record );
+      checkPairs( bitmap ? "IntersectionProbe (bitmap)" : "IntersectionProbe (merge)",
+                  a, b, result, expected );
+   }
+
+   result.clear();
+   const auto probe( blaze::makeIntersectionProbe( lb.begin(), lb.end(), size, true ) );
+   probe.intersect( la.begin(), la.end(), record );
+   checkPairs( "IntersectionProbe (non-contiguous)", a, b, result, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the pairs of elements visited by a merge kernel.
+//
+// \param kernel The name of the checked merge kernel.
+// \param a The indices of the left-hand side range.
+// \param b The indices of the right-hand side range.
+// \param result The visited pairs of elements.
+// \param expected The expected pairs of elements.
+// \return void
+// \exception std::runtime_error Invalid pairs of elements detected.
+*/
+void MergeKernelsTest::checkPairs( const std::string& kernel, const Indices& a, const Indices& b,
+                                   const Pairs& result, const Pairs& expected ) const
+{
+   if( result != expected )
+   {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid merge result\n"
+          << " Details:\n"
+          << "   Kernel: " << kernel << "\n"
+          << "   Left-hand side indices:";
+      for( blaze::size_t i : a ) oss << " " << i;
+      oss << "\n   Right-hand side indices:";
+      for( blaze::size_t i : b ) oss << " " << i;
+      oss << "\n   Result:";
+      for( const auto& p : result ) oss << " (" << p.first << "," << p.second << ")";
+      oss << "\n   Expected result:";
+      for( const auto& p : expected ) oss << " (" << p.first << "," << p.second << ")";
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a sparse vector with the given non-zero indices.
+//
+// \param indices The sorted indices of the non-zero elements.
+// \param left \a true for a left-hand side vector, \a false for a right-hand side vector.
+// \return The sparse vector.
+//
+// The value of the element at index \a i is \f$ i+1 \f$ for left-hand side vectors and
+// \f$ -(i+1) \f$ for right-hand side vectors, which identifies each visited element.
+*/
+MergeKernelsTest::VT MergeKernelsTest::create( const Indices& indices, bool left )
+{
+   VT v( indices.empty() ? 0UL : indices.back()+1UL, indices.size() );
+
+   for( blaze::size_t i : indices ) {
+      const int value( static_cast<int>( i ) + 1 );
+      v.append( i, left ? value : -value );
+   }
+
+   return v;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computing the reference intersection of two index patterns.
+//
+// \param a The indices of the left-hand side range.
+// \param b The indices of the right-hand side range.
+// \return The expected pairs of element values.
+*/
+MergeKernelsTest::Pairs MergeKernelsTest::intersection( const Indices& a, const Indices& b )
+{
+   Indices common;
+   std::set_intersection( a.begin(), a.end(), b.begin(), b.end(), std::back_inserter( common ) );
+
+   Pairs pairs;
+   for( blaze::size_t i : common ) {
+      const int value( static_cast<int>( i ) + 1 );
+      pairs.emplace_back( value, -value );
+   }
+
+   return pairs;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computing the reference union of two index patterns.
+//
+// \param a The indices of the left-hand side range.
+// \param b The indices of the right-hand side range.
+// \return The expected pairs of element values (0 for missing elements).
+*/
+MergeKernelsTest::Pairs MergeKernelsTest::merge( const Indices& a, const Indices& b )
+{
+   Indices all;
+   std::set_union( a.begin(), a.end(), b.begin(), b.end(), std::back_inserter( all ) );
+
+   Pairs pairs;
+   for( blaze::size_t i : all ) {
+      const int value( static_cast<int>( i ) + 1 );
+      pairs.emplace_back( std::binary_search( a.begin(), a.end(), i ) ?  value : 0,
+                          std::binary_search( b.begin(), b.end(), i ) ? -value : 0 );
+   }
+
+   return pairs;
+}
+//*************************************************************************************************
+
+} // namespace sparsevector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse merge kernel test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEVECTOR_MERGEKERNELS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse merge kernel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,353 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/concurrentmemorypool/ClassTest.cpp
+//  \brief Source file for the ConcurrentMemoryPool class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/utiltest/concurrentmemorypool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace concurrentmemorypool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ConcurrentMemoryPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()
+{
+   testSingleThread();
+   testCrossThread();
+   testMultipleThreads();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the memory pool within a single thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a number of allocations and deallocations within a single thread. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSingleThread()
+{
+   test_ = "Single thread test";
+
+   Pool pool;
+   std::vector<void*> objects;
+
+   for( blaze::size_t i=0UL; i<250UL; ++i ) {
+      objects.push_back( pool.malloc() );
+      static_cast<Object*>( objects.back() )->id_ = i;
+   }
+
+   std::vector<void*> sorted( objects );
+   std::sort( sorted.begin(), sorted.end() );
+
+   if( std::adjacent_find( sorted.begin(), sorted.end() ) != sorted.end() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Duplicate allocation detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( blaze::size_t i=0UL; i<objects.size(); ++i )
+   {
+      if( reinterpret_cast<blaze::size_t>( objects[i] ) % alignof( Object ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( static_cast<Object*>( objects[i] )->id_ != i ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Overlapping allocations detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( void* ptr : objects ) {
+      pool.free( ptr );
+   }
+
+   checkStatistics( pool, 250UL, 250UL );
+
+   if( pool.getStatistics().blocks != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of memory blocks\n"
+          << " Details:\n"
+          << "   Result: " << pool.getStatistics().blocks << "\n"
+          << "   Expected result: 3\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( blaze::size_t i=0UL; i<250UL; ++i ) {
+      objects[i] = pool.malloc();
+   }
+
+   for( void* ptr : objects ) {
+      pool.free( ptr );
+   }
+
+   if( pool.getStatistics().blocks != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Memory was not reused\n"
+          << " Details:\n"
+          << "   Number of blocks: " << pool.getStatistics().blocks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the release of memory by a different thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function allocates memory in one thread and releases it in another thread. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCrossThread()
+{
+   test_ = "Cross-thread test";
+
+   Pool pool;
+   std::vector<void*> objects( 1000UL );
+   blaze::size_t errors( 0UL );
+
+   for( int round=0; round<3; ++round )
+   {
+      std::thread producer( [&]() {
+         for( blaze::size_t i=0UL; i<objects.size(); ++i ) {
+            objects[i] = pool.malloc();
+            static_cast<Object*>( objects[i] )->id_ = i;
+         }
+      } );
+      producer.join();
+
+      std::thread consumer( [&]() {
+         for( blaze::size_t i=0UL; i<objects.size(); ++i ) {
+            if( static_cast<Object*>( objects[i] )->id_ != i ) {
+               ++errors;
+            }
+            pool.free( objects[i] );
+         }
+      } );
+      consumer.join();
+   }
+
+   if( errors > 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Overlapping allocations detected\n"
+          << " Details:\n"
+          << "   Number of errors: " << errors << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkStatistics( pool, 3000UL, 3000UL );
+
+   if( pool.getStatistics().blocks > 20UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Released memory was not reused\n"
+          << " Details:\n"
+          << "   Number of blocks: " << pool.getStatistics().blocks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent use of the memory pool by several threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function uses the memory pool concurrently from several threads, which exchange the
+// allocated objects with each other. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultipleThreads()
+{
+   test_ = "Multiple threads test";
+
+   const blaze::size_t numThreads( 8UL );
+   const blaze::size_t numObjects( 2000UL );
+
+   Pool pool;
+   std::vector< std::vector<void*> > objects( numThreads, std::vector<void*>( numObjects ) );
+   std::atomic<blaze::size_t> errors( 0UL );
+   std::atomic<blaze::size_t> ready( 0UL );
+
+   std::vector<std::thread> threads;
+
+   for( blaze::size_t t=0UL; t<numThreads; ++t )
+   {
+      threads.emplace_back( [&,t]()
+      {
+         for( blaze::size_t i=0UL; i<numObjects; ++i ) {
+            objects[t][i] = pool.malloc();
+            static_cast<Object*>( objects[t][i] )->id_ = t*numObjects + i;
+         }
+
+         ++ready;
+         while( ready.load() < numThreads ) {
+            std::this_thread::yield();
+         }
+
+         const blaze::size_t u( ( t + 1UL ) % numThreads );
+
+         for( blaze::size_t i=0UL; i<numObjects; ++i ) {
+            if( static_cast<Object*>( objects[u][i] )->id_ != u*numObjects + i ) {
+               ++errors;
+            }
+            pool.free( objects[u][i] );
+         }
+      } );
+   }
+
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+
+   if( errors.load() > 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Overlapping allocations detected\n"
+          << " Details:\n"
+          << "   Number of errors: " << errors.load() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkStatistics( pool, numThreads*numObjects, numThreads*numObjects );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the statistics of the given memory pool.
+//
+// \param pool The memory pool to be checked.
+// \param allocations The expected number of allocations.
+// \param deallocations The expected number of deallocations.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkStatistics( const Pool& pool, blaze::size_t allocations,
+                                 blaze::size_t deallocations ) const
+{
+   const Pool::Statistics stats( pool.getStatistics() );
+
+   if( stats.allocations != allocations || stats.deallocations != deallocations ||
+       stats.capacity != stats.blocks*100UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid statistics detected\n"
+          << " Details:\n"
+          << "   Allocations   = " << stats.allocations << " (expected " << allocations << ")\n"
+          << "   Deallocations = " << stats.deallocations << " (expected " << deallocations << ")\n"
+          << "   Blocks        = " << stats.blocks << "\n"
+          << "   Capacity      = " << stats.capacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace concurrentmemorypool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ConcurrentMemoryPool class test..." << std::endl;
+
+   try
+   {
+      RUN_CONCURRENTMEMORYPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ConcurrentMemoryPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
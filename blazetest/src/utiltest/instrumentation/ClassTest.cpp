@@ -0,0 +1,347 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/instrumentation/ClassTest.cpp
+//  \brief Source file for the instrumentation class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/utiltest/instrumentation/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace instrumentation {
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+blaze::AssignmentInfo ClassTest::last_{};
+size_t ClassTest::calls_( 0UL );
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the instrumentation class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAllocations();
+   testTemporaries();
+   testAssignments();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the allocation counters.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the global and thread-local counting of allocations and deallocations.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocations()
+{
+   blaze::resetGlobalCounters();
+   blaze::resetThreadCounters();
+
+   {
+      blaze::DynamicVector<double> vec( 100UL );
+
+      const blaze::InstrumentationCounters counters( blaze::threadCounters() );
+
+      if( counters.allocations != 1UL || counters.deallocations != 0UL ||
+          counters.allocatedBytes < 100UL*sizeof(double) ) {
+         std::ostringstream oss;
+         oss << " Test: Allocation of a dynamic vector\n"
+             << " Error: Invalid allocation counters\n"
+             << " Details:\n"
+             << "   Allocations     = " << counters.allocations << " (expected 1)\n"
+             << "   Deallocations   = " << counters.deallocations << " (expected 0)\n"
+             << "   Allocated bytes = " << counters.allocatedBytes << " (expected at least " << 100UL*sizeof(double) << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const blaze::InstrumentationCounters counters( blaze::threadCounters() );
+   const blaze::InstrumentationCounters global( blaze::globalCounters() );
+
+   if( counters.deallocations != 1UL || counters.deallocatedBytes != counters.allocatedBytes ) {
+      std::ostringstream oss;
+      oss << " Test: Deallocation of a dynamic vector\n"
+          << " Error: Invalid deallocation counters\n"
+          << " Details:\n"
+          << "   Deallocations     = " << counters.deallocations << " (expected 1)\n"
+          << "   Deallocated bytes = " << counters.deallocatedBytes << " (expected " << counters.allocatedBytes << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( global.allocations < counters.allocations || global.allocatedBytes < counters.allocatedBytes ) {
+      std::ostringstream oss;
+      oss << " Test: Global allocation counters\n"
+          << " Error: Invalid global counters\n"
+          << " Details:\n"
+          << "   Allocations     = " << global.allocations << " (expected at least " << counters.allocations << ")\n"
+          << "   Allocated bytes = " << global.allocatedBytes << " (expected at least " << counters.allocatedBytes << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the counting of temporaries.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the counting of vectors and matrices that are constructed from
+// expressions. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTemporaries()
+{
+   blaze::DynamicMatrix<int> A( 4UL, 4UL, 2 );
+   blaze::DynamicVector<int> x( 4UL, 1 );
+
+   blaze::resetThreadCounters();
+
+   // Construction from an expression
+   blaze::DynamicVector<int> y( A * x );
+
+   if( blaze::threadCounters().temporaries != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: Construction from an expression\n"
+          << " Error: Invalid number of temporaries\n"
+          << " Details:\n"
+          << "   Temporaries = " << blaze::threadCounters().temporaries << " (expected 1)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Assignment of an expression
+   y = A * x;
+
+   if( blaze::threadCounters().temporaries != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: Assignment of an expression\n"
+          << " Error: Invalid number of temporaries\n"
+          << " Details:\n"
+          << "   Temporaries = " << blaze::threadCounters().temporaries << " (expected 1)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Assignment of a nested expression requiring an intermediate evaluation
+   y = ( A * A ) * x;
+
+   if( blaze::threadCounters().temporaries <= 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: Assignment of a nested expression\n"
+          << " Error: Invalid number of temporaries\n"
+          << " Details:\n"
+          << "   Temporaries = " << blaze::threadCounters().temporaries << " (expected more than 1)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assignment callback.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment callback for vector and matrix assignments. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignments()
+{
+   blaze::DynamicMatrix<int> A( 3UL, 5UL, 2 );
+   blaze::DynamicMatrix<int> B( 3UL, 5UL );
+   blaze::DynamicVector<int> x( 5UL, 1 );
+   blaze::DynamicVector<int> y( 3UL );
+
+   const blaze::AssignmentCallback previous( blaze::setAssignmentCallback( &ClassTest::record ) );
+   calls_ = 0UL;
+
+   // Vector assignment
+   y = A * x;
+
+   if( calls_ != 1UL || last_.type != blaze::plainAssignment ||
+       last_.rows != 3UL || last_.columns != 1UL || last_.parallel || last_.seconds < 0.0 ) {
+      std::ostringstream oss;
+      oss << " Test: Vector assignment\n"
+          << " Error: Invalid assignment information\n"
+          << " Details:\n"
+          << "   Calls   = " << calls_ << " (expected 1)\n"
+          << "   Type    = " << last_.type << " (expected " << blaze::plainAssignment << ")\n"
+          << "   Rows    = " << last_.rows << " (expected 3)\n"
+          << "   Columns = " << last_.columns << " (expected 1)\n"
+          << "   Seconds = " << last_.seconds << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Vector addition assignment
+   y += A * x;
+
+   if( calls_ != 2UL || last_.type != blaze::additionAssignment || last_.rows != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: Vector addition assignment\n"
+          << " Error: Invalid assignment information\n"
+          << " Details:\n"
+          << "   Calls = " << calls_ << " (expected 2)\n"
+          << "   Type  = " << last_.type << " (expected " << blaze::additionAssignment << ")\n"
+          << "   Rows  = " << last_.rows << " (expected 3)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Matrix Schur product assignment
+   B = A;
+   B %= A;
+
+   if( calls_ != 4UL || last_.type != blaze::schurAssignment ||
+       last_.rows != 3UL || last_.columns != 5UL ) {
+      std::ostringstream oss;
+      oss << " Test: Matrix Schur product assignment\n"
+          << " Error: Invalid assignment information\n"
+          << " Details:\n"
+          << "   Calls   = " << calls_ << " (expected 4)\n"
+          << "   Type    = " << last_.type << " (expected " << blaze::schurAssignment << ")\n"
+          << "   Rows    = " << last_.rows << " (expected 3)\n"
+          << "   Columns = " << last_.columns << " (expected 5)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Resetting the callback
+   if( blaze::setAssignmentCallback( previous ) != &ClassTest::record ) {
+      std::ostringstream oss;
+      oss << " Test: Resetting the assignment callback\n"
+          << " Error: Invalid previous callback\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   y = A * x;
+
+   if( calls_ != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: Assignment without callback\n"
+          << " Error: Callback called after reset\n"
+          << " Details:\n"
+          << "   Calls = " << calls_ << " (expected 4)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment callback for the test of the instrumentation.
+//
+// \param info The information about the assignment.
+// \return void
+*/
+void ClassTest::record( const blaze::AssignmentInfo& info )
+{
+   last_ = info;
+   ++calls_;
+}
+//*************************************************************************************************
+
+} // namespace instrumentation
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running instrumentation class test..." << std::endl;
+
+   try
+   {
+      RUN_INSTRUMENTATION_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during instrumentation class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
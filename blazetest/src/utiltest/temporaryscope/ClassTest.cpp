@@ -0,0 +1,311 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/temporaryscope/ClassTest.cpp
+//  \brief Source file for the TemporaryScope class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/utiltest/temporaryscope/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace temporaryscope {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TemporaryScope class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAllocation<char          >();
+   testAllocation<signed char   >();
+   testAllocation<unsigned char >();
+   testAllocation<wchar_t       >();
+   testAllocation<short         >();
+   testAllocation<unsigned short>();
+   testAllocation<int           >();
+   testAllocation<unsigned int  >();
+   testAllocation<long          >();
+   testAllocation<unsigned long >();
+   testAllocation<float         >();
+   testAllocation<double        >();
+   testAllocation<long double   >();
+   testAllocation<Aligned16     >();
+   testAllocation<Aligned32     >();
+   testAllocation<Aligned64     >();
+   testAllocation<Aligned128    >();
+
+   testScope();
+   testNesting();
+   testThreads();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the bookkeeping of the TemporaryScope class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the number of used bytes, the high-water mark, and the number of misses
+// reported by a temporary scope. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testScope()
+{
+   blaze::TemporaryAllocator<double> allocator;
+
+   blaze::TemporaryScope scope( 4096UL );
+   scope.reset();
+
+   if( scope.capacity() < 4096UL || scope.used() != 0UL ||
+       scope.highWater() != 0UL || scope.misses() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: Construction of a temporary scope\n"
+          << " Error: Invalid initial state\n"
+          << " Details:\n"
+          << "   Capacity   = " << scope.capacity() << " (expected at least 4096)\n"
+          << "   Used       = " << scope.used() << " (expected 0)\n"
+          << "   High-water = " << scope.highWater() << " (expected 0)\n"
+          << "   Misses     = " << scope.misses() << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   double* const ptr1 = allocator.allocate( 128UL );
+   double* const ptr2 = allocator.allocate( 128UL );
+   const size_t used( scope.used() );
+
+   // Releasing the last allocation directly frees the memory
+   allocator.deallocate( ptr2, 128UL );
+
+   if( scope.used() >= used || scope.highWater() != used ) {
+      std::ostringstream oss;
+      oss << " Test: Release of the last allocation\n"
+          << " Error: Invalid arena state\n"
+          << " Details:\n"
+          << "   Used       = " << scope.used() << " (expected less than " << used << ")\n"
+          << "   High-water = " << scope.highWater() << " (expected " << used << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Exceeding the capacity of the arena results in a miss
+   const size_t n( scope.capacity() / sizeof(double) + 1UL );
+   double* const ptr3 = allocator.allocate( n );
+
+   if( scope.misses() != 1UL || scope.highWater() <= scope.capacity() ) {
+      std::ostringstream oss;
+      oss << " Test: Exceeding the capacity of the arena\n"
+          << " Error: Invalid arena state\n"
+          << " Details:\n"
+          << "   Misses     = " << scope.misses() << " (expected 1)\n"
+          << "   High-water = " << scope.highWater() << " (expected more than " << scope.capacity() << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   allocator.deallocate( ptr3, n );
+   allocator.deallocate( ptr1, 128UL );
+
+   if( scope.used() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: Release of all allocations\n"
+          << " Error: Invalid arena state\n"
+          << " Details:\n"
+          << "   Used = " << scope.used() << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested temporary scopes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an inner temporary scope releases all its allocations at the end
+// of the scope without affecting the allocations of the outer scope. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNesting()
+{
+   blaze::TemporaryAllocator<int> allocator;
+
+   blaze::TemporaryScope outer( 4096UL );
+
+   int* const ptr1 = allocator.allocate( 64UL );
+   const size_t used( outer.used() );
+
+   {
+      blaze::TemporaryScope inner( 8192UL );
+
+      allocator.allocate( 64UL );
+      allocator.allocate( 64UL );
+
+      if( inner.used() <= used ) {
+         std::ostringstream oss;
+         oss << " Test: Allocation within a nested scope\n"
+             << " Error: Allocations not placed in the arena\n"
+             << " Details:\n"
+             << "   Used = " << inner.used() << " (expected more than " << used << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( outer.used() != used ) {
+      std::ostringstream oss;
+      oss << " Test: Closing a nested scope\n"
+          << " Error: Invalid arena state\n"
+          << " Details:\n"
+          << "   Used = " << outer.used() << " (expected " << used << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   allocator.deallocate( ptr1, 64UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!rief Test of the deallocation of temporaries by another thread.
+//
+// eturn void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that memory allocated via a TemporaryAllocator can be released by any
+// thread, both in case it was taken from the arena of another thread and in case it was
+// allocated dynamically. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testThreads()
+{
+   blaze::TemporaryAllocator<double> allocator;
+
+   blaze::TemporaryScope scope( 4096UL );
+
+   double* const ptr1 = allocator.allocate( 128UL );
+   const size_t used( scope.used() );
+
+   double* ptr2( nullptr );
+
+   std::thread thread( [&]()
+   {
+      // Releasing memory of the arena of the main thread
+      allocator.deallocate( ptr1, 128UL );
+
+      // Allocating memory while no scope is active on this thread
+      ptr2 = allocator.allocate( 128UL );
+   } );
+   thread.join();
+
+   if( scope.used() != used ) {
+      std::ostringstream oss;
+      oss << " Test: Release of arena memory by another thread\n"
+          << " Error: Invalid arena state\n"
+          << " Details:\n"
+          << "   Used = " << scope.used() << " (expected " << used << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Releasing dynamically allocated memory of another thread within the active scope
+   allocator.deallocate( ptr2, 128UL );
+
+   if( scope.used() != used ) {
+      std::ostringstream oss;
+      oss << " Test: Release of dynamic memory of another thread\n"
+          << " Error: Invalid arena state\n"
+          << " Details:\n"
+          << "   Used = " << scope.used() << " (expected " << used << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace temporaryscope
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running TemporaryScope class test..." << std::endl;
+
+   try
+   {
+      RUN_TEMPORARYSCOPE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during TemporaryScope class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,553 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/AffinityTest.cpp
+//  \brief Source file for the ThreadPool affinity test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sched.h>
+#  include <stdlib.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <blaze/util/ThreadPool.h>
+#include <blazetest/utiltest/threadpool/AffinityTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool affinity test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+AffinityTest::AffinityTest()
+   : test_()
+{
+   testParseCPUList();
+   testTopology();
+   testSysfs();
+   testPolicies();
+   testPinning();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parseCPUList() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parsing of valid and malformed lists of logical CPUs. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AffinityTest::testParseCPUList()
+{
+   using blaze::threadpool::parseCPUList;
+
+   test_ = "parseCPUList()";
+
+   checkCPUs( parseCPUList( "" ), CPUs{} );
+   checkCPUs( parseCPUList( "5" ), CPUs{ 5UL } );
+   checkCPUs( parseCPUList( "0-3,8,10-11" ), CPUs{ 0UL, 1UL, 2UL, 3UL, 8UL, 10UL, 11UL } );
+   checkCPUs( parseCPUList( "7,2-2,0" ), CPUs{ 7UL, 2UL, 0UL } );
+   checkCPUs( parseCPUList( "0-1\n" ), CPUs{ 0UL, 1UL } );
+
+   checkInvalid( "a" );
+   checkInvalid( "1," );
+   checkInvalid( "1-" );
+   checkInvalid( "-1" );
+   checkInvalid( "3-1" );
+   checkInvalid( "1;2" );
+   checkInvalid( "1,,2" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Topology class for an explicitly given set of logical CPUs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the ordering of the logical CPUs by package, cache domain, core and index
+// and the find() function. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void AffinityTest::testTopology()
+{
+   test_ = "Topology construction from logical CPUs";
+
+   const Topology topology( createCPUs() );
+
+   CPUs ids;
+   for( const CPU& cpu : topology ) {
+      ids.push_back( cpu.id );
+   }
+   checkCPUs( ids, CPUs{ 0UL, 4UL, 1UL, 5UL, 2UL, 6UL, 3UL, 7UL } );
+
+   const CPU* cpu( topology.find( 6UL ) );
+
+   if( cpu == nullptr || cpu->core != 0UL || cpu->package != 1UL || cpu->cache != 2UL ||
+       topology.find( 8UL ) != nullptr ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of find()\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "Topology construction from an empty set of logical CPUs";
+
+   const Topology fallback( std::vector<CPU>{} );
+
+   if( fallback.size() != std::max( 1U, std::thread::hardware_concurrency() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of logical CPUs\n"
+          << " Details:\n"
+          << "   Size: " << fallback.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Topology class for a sysfs directory.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates a fake sysfs directory for two packages with two cores and two SMT
+// siblings each and tests that the topology is correctly read and restricted to the affinity
+// mask of the process. Additionally, it tests the fallback for missing and malformed sysfs
+// directories. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AffinityTest::testSysfs()
+{
+#if defined(__linux__)
+   test_ = "Topology construction from sysfs";
+
+   char pattern[] = "/tmp/blazetest_sysfs_XXXXXX";
+   if( mkdtemp( pattern ) == nullptr ) {
+      return;
+   }
+
+   const std::string root( pattern );
+   std::vector<std::string> dirs;
+   std::vector<std::string> files;
+
+   const auto createDir = [&dirs]( const std::string& dir ) {
+      mkdir( dir.c_str(), 0700 );
+      dirs.push_back( dir );
+   };
+
+   const auto createFile = [&files]( const std::string& file, const std::string& content ) {
+      std::ofstream( file ) << content << "\n";
+      files.push_back( file );
+   };
+
+   createFile( root + "/online", "0-7" );
+
+   for( const CPU& cpu : createCPUs() )
+   {
+      const std::string dir( root + "/cpu" + std::to_string( cpu.id ) );
+      const std::string siblings( std::to_string( cpu.id%4UL ) + "," + std::to_string( cpu.id%4UL+4UL ) );
+      const std::string llc( cpu.package == 0UL ? "0-1,4-5" : "2-3,6-7" );
+
+      createDir( dir );
+      createDir( dir + "/topology" );
+      createFile( dir + "/topology/core_id", std::to_string( cpu.core ) );
+      createFile( dir + "/topology/physical_package_id", std::to_string( cpu.package ) );
+      createDir( dir + "/cache" );
+
+      const std::string levels[] = { "1", "2", "3" };
+      const std::string shared[] = { siblings, siblings, llc };
+
+      for( blaze::size_t i=0UL; i<3UL; ++i ) {
+         const std::string index( dir + "/cache/index" + std::to_string( i ) );
+         createDir( index );
+         createFile( index + "/level", levels[i] );
+         createFile( index + "/shared_cpu_list", shared[i] );
+      }
+   }
+
+   const Topology topology( root );
+
+   // Restricting the expected logical CPUs to the affinity mask of the process
+   const CPUs allowed( allowedCPUs() );
+   CPUs expected;
+
+   for( blaze::size_t id : CPUs{ 0UL, 4UL, 1UL, 5UL, 2UL, 6UL, 3UL, 7UL } ) {
+      if( std::find( allowed.begin(), allowed.end(), id ) != allowed.end() )
+         expected.push_back( id );
+   }
+
+   CPUs ids;
+   for( const CPU& cpu : topology ) {
+      ids.push_back( cpu.id );
+   }
+
+   bool valid( expected.empty() || ids == expected );
+
+   for( const CPU& cpu : topology ) {
+      if( expected.empty() )
+         break;
+      const blaze::size_t package( cpu.id%4UL < 2UL ? 0UL : 1UL );
+      if( cpu.core != cpu.id%2UL || cpu.package != package || cpu.cache != 2UL*package )
+         valid = false;
+   }
+
+   // Breaking the list of online CPUs
+   createFile( root + "/online", "0-" );
+   const Topology malformed( root );
+
+   for( auto file=files.rbegin(); file!=files.rend(); ++file ) {
+      std::remove( file->c_str() );
+   }
+   for( auto dir=dirs.rbegin(); dir!=dirs.rend(); ++dir ) {
+      rmdir( dir->c_str() );
+   }
+   rmdir( root.c_str() );
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid topology\n"
+          << " Details:\n"
+          << "   Result (id/core/package/cache):";
+      for( const CPU& cpu : topology ) {
+         oss << " " << cpu.id << "/" << cpu.core << "/" << cpu.package << "/" << cpu.cache;
+      }
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "Topology construction from a malformed sysfs directory";
+
+   if( malformed.size() != std::max( 1U, std::thread::hardware_concurrency() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of logical CPUs\n"
+          << " Details:\n"
+          << "   Size: " << malformed.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "Topology construction from a missing sysfs directory";
+
+   const Topology missing( root );
+
+   if( missing.size() != std::max( 1U, std::thread::hardware_concurrency() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of logical CPUs\n"
+          << " Details:\n"
+          << "   Size: " << missing.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the affinity policies of the createAffinity() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the \c none, \c compact, \c cores and \c scatter policies and explicit
+// lists of logical CPUs. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void AffinityTest::testPolicies()
+{
+   using blaze::threadpool::createAffinity;
+
+   const Topology topology( createCPUs() );
+
+   test_ = "\"none\" affinity policy";
+   checkCPUs( createAffinity( "", topology ), CPUs{} );
+   checkCPUs( createAffinity( "none", topology ), CPUs{} );
+
+   test_ = "\"compact\" affinity policy";
+   checkCPUs( createAffinity( "compact", topology ), CPUs{ 0UL, 4UL, 1UL, 5UL, 2UL, 6UL, 3UL, 7UL } );
+
+   test_ = "\"cores\" affinity policy";
+   checkCPUs( createAffinity( "cores", topology ), CPUs{ 0UL, 1UL, 2UL, 3UL, 4UL, 5UL, 6UL, 7UL } );
+
+   test_ = "\"scatter\" affinity policy";
+   checkCPUs( createAffinity( "scatter", topology ), CPUs{ 0UL, 2UL, 1UL, 3UL, 4UL, 6UL, 5UL, 7UL } );
+
+   // Two packages with two last-level cache domains each
+   const Topology domains( std::vector<CPU>{ CPU{ 0UL, 0UL, 0UL, 0UL }, CPU{ 1UL, 1UL, 0UL, 1UL },
+                                             CPU{ 2UL, 0UL, 1UL, 2UL }, CPU{ 3UL, 1UL, 1UL, 3UL } } );
+   checkCPUs( createAffinity( "scatter", domains ), CPUs{ 0UL, 2UL, 1UL, 3UL } );
+
+   test_ = "Explicit affinity";
+   checkCPUs( createAffinity( "3,0-1", topology ), CPUs{ 3UL, 0UL, 1UL } );
+   checkCPUs( createAffinity( "6-7,6", topology ), CPUs{ 6UL, 7UL, 6UL } );
+
+   checkInvalid( "9" );
+   checkInvalid( "0-8" );
+   checkInvalid( " " );
+   checkInvalid( "compactly" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the pinning of threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the pinThread() function and the pinning of the threads of a thread pool,
+// both via the constructor and via the pin() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AffinityTest::testPinning()
+{
+#if defined(__linux__)
+   using Pool = blaze::ThreadPool< std::thread
+                                 , std::mutex
+                                 , std::unique_lock<std::mutex>
+                                 , std::condition_variable >;
+
+   const CPUs allowed( allowedCPUs() );
+
+   if( allowed.empty() ) {
+      return;
+   }
+
+   // Returns whether the calling thread is pinned to a single logical CPU out of the given list
+   const auto isPinned = []( const CPUs& cpus ) {
+      const CPUs current( allowedCPUs() );
+      return current.size() == 1UL &&
+             std::find( cpus.begin(), cpus.end(), current[0] ) != cpus.end();
+   };
+
+   test_ = "pinThread()";
+
+   {
+      bool pinned( false );
+      bool valid ( false );
+      bool denied( true  );
+
+      std::thread thread( [&]() {
+         denied = !blaze::threadpool::pinThread( CPU_SETSIZE );
+         pinned = blaze::threadpool::pinThread( allowed.back() );
+         valid  = isPinned( CPUs{ allowed.back() } );
+      } );
+      thread.join();
+
+      if( !pinned || !valid || !denied ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pinning failed\n"
+             << " Details:\n"
+             << "   Logical CPU: " << allowed.back() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "ThreadPool pinning";
+
+   {
+      const CPUs first ( 1UL, allowed.front() );
+      const CPUs second( allowed.rbegin(), allowed.rend() );
+
+      std::atomic<blaze::size_t> invalid( 0UL );
+
+      Pool threadpool( 2UL, first );
+
+      for( blaze::size_t i=0UL; i<16UL; ++i ) {
+         threadpool.schedule( [&]() { if( !isPinned( first ) ) ++invalid; } );
+      }
+      threadpool.wait();
+
+      if( invalid != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Tasks executed on unpinned threads\n"
+             << " Details:\n"
+             << "   Number of tasks: " << invalid << "\n"
+             << "   Logical CPU: " << first[0] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Re-pinning the threads; the parked threads apply the new affinity before their next task
+      threadpool.pin( second );
+      std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+
+      for( blaze::size_t i=0UL; i<16UL; ++i ) {
+         threadpool.schedule( [&]() { if( !isPinned( second ) ) ++invalid; } );
+      }
+      threadpool.wait();
+
+      if( invalid != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Tasks executed on threads with outdated affinity\n"
+             << " Details:\n"
+             << "   Number of tasks: " << invalid << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating the logical CPUs of two packages with two cores and two SMT siblings each.
+//
+// \return The unsorted logical CPUs.
+//
+// The logical CPUs \a i and \a i+4 are the SMT siblings of a core, the logical CPUs 0, 1, 4 and
+// 5 form the first package and the first last-level cache domain, the logical CPUs 2, 3, 6 and
+// 7 the second package and the second cache domain.
+*/
+std::vector<AffinityTest::CPU> AffinityTest::createCPUs()
+{
+   std::vector<CPU> cpus;
+
+   for( blaze::size_t id=0UL; id<8UL; ++id ) {
+      const blaze::size_t package( id%4UL < 2UL ? 0UL : 1UL );
+      cpus.push_back( CPU{ id, id%2UL, package, 2UL*package } );
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the logical CPUs the calling thread is allowed to run on.
+//
+// \return The allowed logical CPUs in ascending order.
+*/
+AffinityTest::CPUs AffinityTest::allowedCPUs()
+{
+   CPUs cpus;
+
+#if defined(__linux__)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 ) {
+      for( blaze::size_t id=0UL; id<CPU_SETSIZE; ++id ) {
+         if( CPU_ISSET( id, &set ) ) cpus.push_back( id );
+      }
+   }
+#endif
+
+   return cpus;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool affinity test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_AFFINITY_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool affinity test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,674 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()
+{
+   testTaskQueue();
+   testRecycling();
+   testStealing();
+   testInjection();
+   testSchedule();
+   testExternalSchedule();
+   testResize();
+   testExternalWait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the push(), pop(), and steal() functions of the TaskQueue class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the order in which tasks are taken from both ends of a task queue, which
+// repeatedly has to grow its circular buffer. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTaskQueue()
+{
+   test_ = "TaskQueue push(), pop(), and steal()";
+
+   Queue queue( 4UL );
+   std::vector<blaze::size_t> order;
+
+   for( blaze::size_t i=0UL; i<100UL; ++i ) {
+      queue.push( [&order,i]() { order.push_back( i ); } );
+   }
+
+   if( queue.size() != 100UL || queue.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid queue size detected\n"
+          << " Details:\n"
+          << "   Size: " << queue.size() << "\n"
+          << "   Expected size: 100\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( blaze::size_t i=0UL; i<50UL; ++i ) {
+      Task* task( queue.pop() );
+      if( task == nullptr ) break;
+      (*task)();
+      Queue::release( task );
+   }
+
+   for( blaze::size_t i=0UL; i<50UL; ++i ) {
+      Task* task( queue.steal() );
+      if( task == nullptr ) break;
+      (*task)();
+      Queue::release( task );
+   }
+
+   bool valid( order.size() == 100UL && queue.isEmpty() &&
+               queue.pop() == nullptr && queue.steal() == nullptr );
+
+   for( blaze::size_t i=0UL; valid && i<50UL; ++i ) {
+      valid = ( order[i] == 99UL-i ) && ( order[50UL+i] == i );
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid order of executed tasks\n"
+          << " Details:\n"
+          << "   Number of executed tasks: " << order.size() << "\n"
+          << "   Expected order: 99, 98, ..., 50, 0, 1, ..., 49\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of released task records.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that task records released by the owner or by any other thread are reused
+// by the owning task queue. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testRecycling()
+{
+   test_ = "TaskQueue task record recycling";
+
+   Queue queue( 2UL );
+   std::atomic<blaze::size_t> count( 0UL );
+   std::array<char,512UL> large{};
+   std::array<char,2048UL> huge{};
+
+   const auto run = [&queue]( std::vector<Task*>& tasks )
+   {
+      while( Task* task = queue.pop() ) {
+         (*task)();
+         tasks.push_back( task );
+      }
+      std::sort( tasks.begin(), tasks.end() );
+   };
+
+   // Scheduling small, pooled, and heap-allocated callables
+   for( blaze::size_t i=0UL; i<64UL; ++i ) {
+      if( i % 3UL == 0UL )
+         queue.push( [&count]() { ++count; } );
+      else if( i % 3UL == 1UL )
+         queue.push( [&count,large]() { count += 1UL + large[0]; } );
+      else
+         queue.push( [&count,huge]() { count += 1UL + huge[0]; } );
+   }
+
+   std::vector<Task*> first;
+   run( first );
+
+   // Releasing the task records from another thread
+   std::thread releaser( [&first]() {
+      for( Task* task : first ) {
+         Queue::release( task );
+      }
+   } );
+   releaser.join();
+
+   for( blaze::size_t i=0UL; i<64UL; ++i ) {
+      queue.push( [&count]() { ++count; } );
+   }
+
+   std::vector<Task*> second;
+   run( second );
+
+   for( Task* task : second ) {
+      Queue::release( task );
+   }
+
+   checkCount( count, 128UL );
+
+   if( first.size() != 64UL || first != second ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Released task records have not been reused\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of concurrent stealing from a growing task queue.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a task queue whose owner pushes and pops tasks while several other threads
+// steal tasks at the same time. During the test the queue repeatedly has to grow its circular
+// buffer. Every task has to be executed exactly once. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testStealing()
+{
+   test_ = "TaskQueue concurrent stealing";
+
+   constexpr blaze::size_t N( 20000UL );
+
+   Queue queue( 4UL );
+   std::unique_ptr< std::atomic<blaze::size_t>[] > executed( new std::atomic<blaze::size_t>[N] );
+   std::atomic<bool> done( false );
+   std::atomic<blaze::size_t> stolen( 0UL );
+
+   for( blaze::size_t i=0UL; i<N; ++i ) {
+      executed[i] = 0UL;
+   }
+
+   std::vector<std::thread> thieves;
+
+   for( blaze::size_t t=0UL; t<3UL; ++t ) {
+      thieves.emplace_back( [&queue,&done,&stolen]() {
+         while( !done || !queue.isEmpty() ) {
+            if( Task* task = queue.steal() ) {
+               (*task)();
+               Queue::release( task );
+               ++stolen;
+            }
+         }
+      } );
+   }
+
+   for( blaze::size_t i=0UL; i<N; ++i )
+   {
+      queue.push( [&executed,i]() { ++executed[i]; } );
+
+      if( i % 3UL == 0UL ) {
+         if( Task* task = queue.pop() ) {
+            (*task)();
+            Queue::release( task );
+         }
+      }
+   }
+
+   while( Task* task = queue.pop() ) {
+      (*task)();
+      Queue::release( task );
+   }
+
+   done = true;
+
+   for( std::thread& thief : thieves ) {
+      thief.join();
+   }
+
+   for( blaze::size_t i=0UL; i<N; ++i ) {
+      if( executed[i] != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Task has not been executed exactly once\n"
+             << " Details:\n"
+             << "   Task: " << i << "\n"
+             << "   Number of executions: " << executed[i] << "\n"
+             << "   Number of stolen tasks: " << stolen << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of concurrent pushes to and pops from an injection queue.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests an injection queue to which several threads push tasks at the same time,
+// while one or several other threads concurrently take tasks from the queue. The task records
+// are prepared in task queues owned by the pushing threads. Every task has to be executed
+// exactly once. In case of a single consuming thread, the tasks of every pushing thread have
+// to be executed in FIFO order. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testInjection()
+{
+   constexpr blaze::size_t P( 4UL );
+   constexpr blaze::size_t N( 10000UL );
+
+   for( blaze::size_t consumers : { 1UL, 3UL } )
+   {
+      test_ = ( consumers == 1UL ? "InjectionQueue concurrent push()"
+                                 : "InjectionQueue concurrent push() and pop()" );
+
+      Injection injection;
+      std::unique_ptr< std::atomic<blaze::size_t>[] > executed( new std::atomic<blaze::size_t>[P*N] );
+      std::atomic<blaze::size_t> last[P];
+      std::atomic<blaze::size_t> disorder( 0UL );
+      std::atomic<blaze::size_t> count( 0UL );
+
+      for( blaze::size_t i=0UL; i<P*N; ++i ) {
+         executed[i] = 0UL;
+      }
+
+      for( blaze::size_t p=0UL; p<P; ++p ) {
+         last[p] = 0UL;
+      }
+
+      std::vector<Queue> origins( P );
+      std::vector<std::thread> threads;
+
+      for( blaze::size_t p=0UL; p<P; ++p ) {
+         threads.emplace_back( [&,p]() {
+            for( blaze::size_t i=0UL; i<N; ++i ) {
+               injection.push( origins[p].prepare( [&,p,i]() {
+                  if( last[p].exchange( i+1UL ) > i ) ++disorder;
+                  ++executed[p*N+i];
+                  ++count;
+               } ) );
+            }
+         } );
+      }
+
+      for( blaze::size_t t=0UL; t<consumers; ++t ) {
+         threads.emplace_back( [&]() {
+            while( count < P*N ) {
+               if( Task* task = injection.pop() ) {
+                  (*task)();
+                  Queue::release( task );
+               }
+            }
+         } );
+      }
+
+      for( std::thread& thread : threads ) {
+         thread.join();
+      }
+
+      // With a single consumer, the tasks of every pushing thread are executed in FIFO order
+      if( consumers == 1UL ) {
+         checkCount( disorder, 0UL );
+      }
+
+      for( blaze::size_t i=0UL; i<P*N; ++i ) {
+         if( executed[i] != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Task has not been executed exactly once\n"
+                << " Details:\n"
+                << "   Task: " << i << "\n"
+                << "   Number of executions: " << executed[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the schedule() and scheduleOn() functions of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks from an external thread as well as from within the threads of
+// the pool (which are stolen by the other threads), including tasks with arguments bound by
+// reference and by value. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testSchedule()
+{
+   {
+      test_ = "ThreadPool schedule() from an external thread";
+
+      Pool pool( 4UL );
+      std::atomic<blaze::size_t> count( 0UL );
+      std::array<char,512UL> large{};
+
+      for( blaze::size_t i=0UL; i<1000UL; ++i ) {
+         pool.schedule( [&count]( blaze::size_t n ) { count += n; }, 1UL );
+         pool.schedule( [&count,large]() { count += 1UL + large[0]; } );
+      }
+
+      pool.wait();
+
+      checkCount( count, 2000UL );
+
+      if( !pool.isEmpty() || pool.size() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid thread pool state\n"
+             << " Details:\n"
+             << "   Size: " << pool.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "ThreadPool schedule() from within the pool";
+
+      Pool pool( 4UL );
+      std::atomic<blaze::size_t> count( 0UL );
+
+      for( blaze::size_t i=0UL; i<100UL; ++i ) {
+         pool.schedule( [&pool,&count]() {
+            for( blaze::size_t j=0UL; j<10UL; ++j ) {
+               pool.schedule( [&count]() { ++count; } );
+            }
+            ++count;
+         } );
+      }
+
+      pool.wait();
+
+      checkCount( count, 1100UL );
+   }
+
+   {
+      test_ = "ThreadPool schedule() with bound arguments";
+
+      Pool pool( 2UL );
+      std::atomic<blaze::size_t> count( 0UL );
+      std::array<blaze::size_t,64UL> large{};
+      large[63] = 2UL;
+
+      const auto add = []( std::atomic<blaze::size_t>& c, blaze::size_t n ) { c += n; };
+      const auto addLast = []( std::atomic<blaze::size_t>& c, const std::array<blaze::size_t,64UL>& a ) { c += a[63]; };
+
+      for( blaze::size_t i=0UL; i<100UL; ++i ) {
+         pool.schedule( add, std::ref( count ), 1UL );
+         pool.schedule( addLast, std::ref( count ), large );
+      }
+
+      pool.wait();
+
+      checkCount( count, 300UL );
+   }
+
+   {
+      test_ = "ThreadPool scheduleOn()";
+
+      Pool pool( 3UL );
+      std::atomic<blaze::size_t> count( 0UL );
+
+      for( blaze::size_t i=0UL; i<300UL; ++i ) {
+         pool.scheduleOn( i, [&count]( blaze::size_t n ) { count += n; }, 2UL );
+      }
+
+      pool.wait();
+
+      checkCount( count, 600UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the schedule() and scheduleOn() functions called from external threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks from several external threads at the same time, each of which
+// alternately schedules tasks on two thread pools. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExternalSchedule()
+{
+   test_ = "ThreadPool schedule() and scheduleOn() from external threads";
+
+   Pool first( 3UL );
+   Pool second( 2UL );
+   std::atomic<blaze::size_t> count( 0UL );
+
+   std::vector<std::thread> threads;
+
+   for( blaze::size_t t=0UL; t<4UL; ++t ) {
+      threads.emplace_back( [&first,&second,&count,t]() {
+         for( blaze::size_t i=0UL; i<500UL; ++i ) {
+            Pool& pool( ( i % 2UL ) ? first : second );
+            pool.schedule( [&count]() { ++count; } );
+            pool.scheduleOn( t+i, [&count]( blaze::size_t n ) { count += n; }, 2UL );
+         }
+      } );
+   }
+
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+
+   first.wait();
+   second.wait();
+
+   checkCount( count, 6000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of resizing a ThreadPool while tasks are queued.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function resizes a thread pool while tasks are queued both in the shared task queue and
+// in the task queues of the threads of the pool. All tasks have to be executed. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "ThreadPool resize() with queued tasks";
+
+   Pool pool( 2UL );
+   std::atomic<blaze::size_t> count( 0UL );
+
+   const auto work = [&count]() {
+      volatile blaze::size_t sum( 0UL );
+      for( blaze::size_t k=0UL; k<1000UL; ++k ) sum += k;
+      ++count;
+   };
+
+   for( blaze::size_t i=0UL; i<200UL; ++i ) {
+      pool.schedule( [&pool,work]() {
+         for( blaze::size_t j=0UL; j<5UL; ++j ) {
+            pool.schedule( work );
+         }
+         work();
+      } );
+   }
+
+   pool.resize( 4UL );
+   pool.resize( 1UL );
+   pool.resize( 3UL, true );
+
+   for( blaze::size_t i=0UL; i<200UL; ++i ) {
+      pool.schedule( work );
+   }
+
+   pool.resize( 1UL, true );
+   pool.wait();
+
+   checkCount( count, 1400UL );
+
+   if( pool.size() != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread pool size\n"
+          << " Details:\n"
+          << "   Size: " << pool.size() << "\n"
+          << "   Expected size: 1\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the wait() function called from external threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function calls the wait() function from several external threads while the threads of
+// the pool steal tasks from each other. The waiting threads must not return before all tasks
+// have been executed. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExternalWait()
+{
+   test_ = "ThreadPool wait() from external threads";
+
+   Pool pool( 4UL );
+   std::atomic<blaze::size_t> count( 0UL );
+
+   for( blaze::size_t i=0UL; i<200UL; ++i ) {
+      pool.schedule( [&pool,&count]() {
+         for( blaze::size_t j=0UL; j<20UL; ++j ) {
+            pool.schedule( [&count]() {
+               volatile blaze::size_t sum( 0UL );
+               for( blaze::size_t k=0UL; k<500UL; ++k ) sum += k;
+               ++count;
+            } );
+         }
+         ++count;
+      } );
+   }
+
+   std::atomic<blaze::size_t> observed[2];
+   std::vector<std::thread> waiters;
+
+   for( blaze::size_t t=0UL; t<2UL; ++t ) {
+      waiters.emplace_back( [&pool,&count,&observed,t]() {
+         pool.wait();
+         observed[t] = count.load();
+      } );
+   }
+
+   for( std::thread& waiter : waiters ) {
+      waiter.join();
+   }
+
+   checkCount( observed[0], 4200UL );
+   checkCount( observed[1], 4200UL );
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************